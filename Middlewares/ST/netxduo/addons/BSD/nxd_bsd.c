@@ -199,6 +199,19 @@ extern TX_THREAD       *_tx_thread_current_ptr;
 static ULONG  _nx_bsd_serv_list_len;
 static struct NX_BSD_SERVICE_LIST  *_nx_bsd_serv_list_ptr;
 
+#ifdef NX_BSD_ENABLE_EPOLL
+
+/* Define the array of epoll instances.  */
+
+static NX_BSD_EPOLL     nx_bsd_epoll_array[NX_BSD_EPOLL_MAX_INSTANCES];
+
+static ULONG nx_bsd_epoll_socket_events(UINT sock_id);
+static VOID  nx_bsd_epoll_ready_add(NX_BSD_EPOLL *epoll_ptr, UINT sock_id);
+static VOID  nx_bsd_epoll_notify(UINT sock_id, UINT fd_sets);
+static VOID  nx_bsd_epoll_socket_remove(UINT sock_id);
+static INT   nx_bsd_epoll_close(UINT epoll_index);
+#endif /* NX_BSD_ENABLE_EPOLL */
+
 
 /**************************************************************************/
 /*                                                                        */
@@ -4680,7 +4693,7 @@ struct sockaddr_in6 peer6_address;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    soc_close                                           PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -4703,6 +4716,9 @@ struct sockaddr_in6 peer6_address;
 /*    application to perform asynchronous disconnects without having to   */
 /*    wait for the disconnect to complete.                                */
 /*                                                                        */
+/*    An epoll descriptor returned by epoll_create is also released by    */
+/*    this function.                                                      */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    socketID                                                            */
@@ -4725,6 +4741,8 @@ struct sockaddr_in6 peer6_address;
 /*    tx_block_release                      Release block for socket      */
 /*    tx_mutex_get                          Get protection                */
 /*    tx_mutex_put                          Release protection            */
+/*    nx_bsd_epoll_close                    Release epoll instance        */
+/*    nx_bsd_epoll_socket_remove            Remove from epoll instances   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -4737,6 +4755,9 @@ struct sockaddr_in6 peer6_address;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            epoll support,              */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 INT  soc_close(INT sockID)
@@ -4756,6 +4777,16 @@ INT                  protocol;
 UINT                 index;
 #endif
 
+#ifdef NX_BSD_ENABLE_EPOLL
+    /* Is this an epoll descriptor?  */
+    if ((sockID >= NX_BSD_EPOLL_FD_START) && (sockID < (NX_BSD_EPOLL_FD_START + NX_BSD_EPOLL_MAX_INSTANCES)))
+    {
+
+        /* Yes, release the epoll instance.  */
+        return(nx_bsd_epoll_close((UINT)(sockID - NX_BSD_EPOLL_FD_START)));
+    }
+
+#endif /* NX_BSD_ENABLE_EPOLL */
     /* Check for a valid socket ID.  */
     if ((sockID < NX_BSD_SOCKFD_START) || (sockID >= (NX_BSD_SOCKFD_START + NX_BSD_MAX_SOCKETS)))
     {
@@ -4804,6 +4835,11 @@ UINT                 index;
         return(NX_SOC_ERROR);
     }        
 
+#ifdef NX_BSD_ENABLE_EPOLL
+    /* Remove the socket from the epoll interest lists.  */
+    nx_bsd_epoll_socket_remove((UINT)sockID);
+
+#endif /* NX_BSD_ENABLE_EPOLL */
     /* Set NetX socket pointers.  */
     tcp_socket_ptr =  bsd_socket_ptr -> nx_bsd_socket_tcp_socket;
     udp_socket_ptr =  bsd_socket_ptr -> nx_bsd_socket_udp_socket;
@@ -7868,216 +7904,1259 @@ INT                     ret;
 
 
 
-/**************************************************************************/ 
-/*                                                                        */ 
-/*  FUNCTION                                               RELEASE        */ 
-/*                                                                        */ 
-/*    nx_bsd_tcp_receive_notify                           PORTABLE C      */ 
-/*                                                           6.1          */
+#ifdef NX_BSD_ENABLE_EPOLL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    epoll_create                                        PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
-/*  DESCRIPTION                                                           */ 
-/*                                                                        */ 
-/*    This is the NetX callback function for TCP Socket receive operation */
-/*    This function resumes all the threads suspended on the socket.      */
-/*                                                                        */ 
-/*  INPUT                                                                 */ 
-/*                                                                        */ 
-/*    *socket_ptr                           Pointer to the socket which   */
-/*                                            received the data packet    */  
-/*                                                                        */ 
-/*  OUTPUT                                                                */ 
-/*                                                                        */ 
-/*    None                                                                */ 
-/*                                                                        */ 
-/*  CALLS                                                                 */ 
-/*                                                                        */ 
-/*    FD_ZERO                               Clear a socket ready list     */
-/*    FD_ISSET                              Check a socket is ready       */
-/*    FD_SET                                Set a socket to check         */ 
-/*    tx_event_flags_get                    Get events                    */ 
-/*    tx_mutex_get                          Get protection                */ 
-/*    tx_mutex_put                          Release protection            */ 
-/*    tx_thread_identify                    Get current thread pointer    */ 
+/*  DESCRIPTION                                                           */
 /*                                                                        */
-/*  CALLED BY                                                             */ 
-/*                                                                        */ 
-/*    NetX                                                                */ 
-/*                                                                        */ 
-/*  RELEASE HISTORY                                                       */ 
-/*                                                                        */ 
-/*    DATE              NAME                      DESCRIPTION             */
+/*    This function creates an epoll instance and returns its descriptor. */
+/*    Sockets are added to the instance with epoll_ctl and ready sockets  */
+/*    are retrieved with epoll_wait. The descriptor is released with      */
+/*    soc_close.                                                          */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  INPUT                                                                 */
 /*                                                                        */
-/**************************************************************************/
-static VOID  nx_bsd_tcp_receive_notify(NX_TCP_SOCKET *socket_ptr)
-{
-UINT                    bsd_socket_index;
-
-    /* Figure out what BSD socket this is.  */
-    bsd_socket_index =  (UINT) socket_ptr -> nx_tcp_socket_reserved_ptr;
-    
-    /* Determine if this is a good index into the BSD socket array.  */
-    if (bsd_socket_index >= NX_BSD_MAX_SOCKETS)
-    {
-    
-        /* Bad socket index... simply return!  */
-        return;
-    }
-
-    /* Now check if the socket may have been released (e.g. socket closed) while
-       waiting for the mutex. */
-    if( socket_ptr -> nx_tcp_socket_id == 0 )    
-    {
-
-        return;          
-    }     
-
-    /* Check the suspended socket list for one ready to receive or send packets. */
-    nx_bsd_select_wakeup(bsd_socket_index, FDSET_READ);
-
-
-    return;
-}
-
-
-/**************************************************************************/ 
-/*                                                                        */ 
-/*  FUNCTION                                               RELEASE        */ 
-/*                                                                        */ 
-/*    nx_bsd_tcp_establish_notify                         PORTABLE C      */ 
-/*                                                           6.1          */
-/*  AUTHOR                                                                */
+/*    size                                  Size hint, must be positive   */
 /*                                                                        */
-/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*  OUTPUT                                                                */
 /*                                                                        */
-/*  DESCRIPTION                                                           */ 
-/*                                                                        */ 
-/*    This is the NetX callback function for TCP Server Socket listen.    */
-/*    This function resumes all the threads suspended on the socket.      */
-/*                                                                        */ 
-/*  INPUT                                                                 */ 
-/*                                                                        */ 
-/*    *socket_ptr                           Pointer to the socket which   */
-/*                                          Received the data packet      */  
+/*    epfd                                  Epoll descriptor on success   */
+/*    NX_SOC_ERROR (-1)                     On failure                    */
 /*                                                                        */
-/*  OUTPUT                                                                */ 
-/*                                                                        */ 
-/*    None                                                                */ 
-/*                                                                        */ 
-/*  CALLS                                                                 */ 
-/*                                                                        */ 
-/*    FD_ZERO                               Clear a socket ready list     */
-/*    FD_ISSET                              Check a socket is ready       */
-/*    FD_SET                                Set a socket to check         */ 
-/*    tx_event_flags_get                    Get events                    */ 
-/*    tx_mutex_get                          Get protection                */ 
-/*    tx_mutex_put                          Release protection            */ 
-/*    tx_thread_identify                    Get current thread pointer    */ 
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    memset                                Clear memory                  */
+/*    tx_event_flags_create                 Create event flag group       */
+/*    tx_mutex_get                          Get protection                */
+/*    tx_mutex_put                          Release protection            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
 /*                                                                        */
-/*  CALLED BY                                                             */ 
-/*                                                                        */ 
-/*    NetX                                                                */ 
-/*                                                                        */ 
-/*  RELEASE HISTORY                                                       */ 
-/*                                                                        */ 
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-#ifndef NX_DISABLE_EXTENDED_NOTIFY_SUPPORT
-static VOID  nx_bsd_tcp_establish_notify(NX_TCP_SOCKET *socket_ptr)
+INT  epoll_create(INT size)
 {
-UINT                    bsd_socket_index;
-UINT                    master_socket_index; 
 
-    /* Figure out what BSD socket this is.  */
-    bsd_socket_index =  (UINT) socket_ptr -> nx_tcp_socket_reserved_ptr;
-    
-    /* Determine if this is a good index into the BSD socket array.  */
-    if (bsd_socket_index >= NX_BSD_MAX_SOCKETS)
-    {
-    
-        /* Bad socket index... simply return!  */
-        return;
-    }
+UINT            i;
+UINT            status;
+NX_BSD_EPOLL   *epoll_ptr;
 
-    /* Initialize the master socket index to an invalid value so we can check if it was actually used
-       later.  */
-    master_socket_index =  NX_BSD_MAX_SOCKETS;
 
-    /* Mark the socket as connected, and also clear the EINPROGRESS flag */
-    nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags |= NX_BSD_SOCKET_CONNECTED;
+    /* Check for valid input parameters.  */
+    if (size <= 0)
+    {
 
-    nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags |=  NX_BSD_SOCKET_CONNECTION_REQUEST;
+        /* Set the socket error.  */
+        set_errno(EINVAL);
 
-    /* Reset the listen-enabled flag. */
-    nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags &= (ULONG)(~NX_BSD_SOCKET_ENABLE_LISTEN);
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
+    }
 
-    /* Mark the socket is bound. */
-    nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags |= NX_BSD_SOCKET_BOUND;
+    /* Get the protection mutex.  */
+    status =  tx_mutex_get(nx_bsd_protection_ptr, NX_BSD_TIMEOUT);
 
-#ifndef NX_DISABLE_IPV4
-    /* Find out the local address this socket is connected on. */
-    if(nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_family == AF_INET)
+    /* Check the status.  */
+    if (status != NX_SUCCESS)
     {
-        /* IPv4 case */
-        nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_local_bind_interface = (ULONG)socket_ptr -> nx_tcp_socket_connect_interface;
+
+        /* Set the socket error.  */
+        set_errno(EACCES);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_BSD_MUTEX_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
     }
-#endif /* NX_DISABLE_IPV4 */
-#ifdef FEATURE_NX_IPV6
-    if(nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_family == AF_INET6)
+
+    /* Search for a free epoll instance.  */
+    for (i = 0; i < NX_BSD_EPOLL_MAX_INSTANCES; i++)
     {
-        /* IPv6 */
-        nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_local_bind_interface = (ULONG)socket_ptr -> nx_tcp_socket_ipv6_addr;
-    }
-#endif
-    /* Determine if the BSD socket is server socket. */
 
+        if (!nx_bsd_epoll_array[i].nx_bsd_epoll_in_use)
+        {
+            break;
+        }
+    }
 
-    /* Is this a secondary socket? */
-    if (nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags & NX_BSD_SOCKET_SERVER_SECONDARY_SOCKET)
+    /* Check if an instance is available.  */
+    if (i == NX_BSD_EPOLL_MAX_INSTANCES)
     {
 
-        /* Yes, get the master socket.  */
-        master_socket_index =  (UINT)(nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_union_id.nx_bsd_socket_master_socket_id);
-
-        /* Mark the server socket as also connected. */
-        nx_bsd_socket_array[master_socket_index].nx_bsd_socket_status_flags |= NX_BSD_SOCKET_CONNECTED;
+        /* Release the protection mutex.  */
+        tx_mutex_put(nx_bsd_protection_ptr);
 
-        nx_bsd_socket_array[master_socket_index].nx_bsd_socket_status_flags |= NX_BSD_SOCKET_CONNECTION_REQUEST;
+        /* Set the socket error.  */
+        set_errno(EMFILE);
 
-        /* Check on connect requests for all server sockets for this master socket. */
-        nx_bsd_select_wakeup(master_socket_index, FDSET_READ);
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
     }
-    else
+
+    /* Set up a pointer to the epoll instance and clear it.  */
+    epoll_ptr =  &nx_bsd_epoll_array[i];
+    memset((VOID *)epoll_ptr, 0, sizeof(NX_BSD_EPOLL));
+
+    /* Create the event flag group used to wake up threads waiting on this instance.  */
+    status =  tx_event_flags_create(&epoll_ptr -> nx_bsd_epoll_events, "NetX BSD Epoll Events");
+
+    /* Check the status.  */
+    if (status != TX_SUCCESS)
     {
-        /* This is a client socket. */
-        nx_bsd_select_wakeup(bsd_socket_index, FDSET_WRITE);
+
+        /* Release the protection mutex.  */
+        tx_mutex_put(nx_bsd_protection_ptr);
+
+        /* Set the socket error.  */
+        set_errno(ENOMEM);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_BSD_EVENT_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
     }
+
+    /* The ready list is empty.  */
+    epoll_ptr -> nx_bsd_epoll_ready_head =  NX_BSD_MAX_SOCKETS;
+    epoll_ptr -> nx_bsd_epoll_ready_tail =  NX_BSD_MAX_SOCKETS;
+    epoll_ptr -> nx_bsd_epoll_in_use =      NX_TRUE;
+
+    /* Release the protection mutex.  */
+    tx_mutex_put(nx_bsd_protection_ptr);
+
+    /* Return the epoll descriptor.  */
+    return((INT)i + NX_BSD_EPOLL_FD_START);
 }
-#endif /* NX_DISABLE_EXTENDED_NOTIFY_SUPPORT */
 
-/**************************************************************************/ 
-/*                                                                        */ 
-/*  FUNCTION                                               RELEASE        */ 
-/*                                                                        */ 
-/*    nx_bsd_tcp_socket_disconnect_notify                 PORTABLE C      */ 
-/*                                                           6.1          */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    epoll_ctl                                           PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
-/*  DESCRIPTION                                                           */ 
-/*                                                                        */ 
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds, modifies or removes a socket on the interest    */
+/*    list of an epoll instance. EPOLLERR and EPOLLHUP are always         */
+/*    reported. A socket that is already ready when it is added or        */
+/*    modified is placed on the ready list immediately.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    epfd                                  Epoll descriptor              */
+/*    op                                    EPOLL_CTL_ADD, EPOLL_CTL_MOD  */
+/*                                            or EPOLL_CTL_DEL            */
+/*    sockID                                BSD socket descriptor         */
+/*    event                                 Requested events and data,    */
+/*                                            ignored for EPOLL_CTL_DEL   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_SOC_OK (0)                         On success                    */
+/*    NX_SOC_ERROR (-1)                     On failure                    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_bsd_epoll_socket_events            Get socket readiness          */
+/*    nx_bsd_epoll_ready_add                Add socket to ready list      */
+/*    TX_DISABLE                            Disable Interrupt             */
+/*    TX_RESTORE                            Enable Interrupt              */
+/*    tx_event_flags_set                    Set events                    */
+/*    tx_mutex_get                          Get protection                */
+/*    tx_mutex_put                          Release protection            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+INT  epoll_ctl(INT epfd, INT op, INT sockID, struct epoll_event *event)
+{
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+ULONG           ready_events;
+NX_BSD_EPOLL   *epoll_ptr;
+UINT            sock_id;
+
+
+    /* Check for a valid epoll descriptor and socket ID.  */
+    if ((epfd < NX_BSD_EPOLL_FD_START) || (epfd >= (NX_BSD_EPOLL_FD_START + NX_BSD_EPOLL_MAX_INSTANCES)) ||
+        (sockID < NX_BSD_SOCKFD_START) || (sockID >= (NX_BSD_SOCKFD_START + NX_BSD_MAX_SOCKETS)))
+    {
+
+        /* Set the socket error.  */
+        set_errno(EBADF);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
+    }
+
+    /* Check the operation and the event pointer.  */
+    if (((op != EPOLL_CTL_ADD) && (op != EPOLL_CTL_MOD) && (op != EPOLL_CTL_DEL)) ||
+        ((op != EPOLL_CTL_DEL) && (event == NX_NULL)))
+    {
+
+        /* Set the socket error.  */
+        set_errno(EINVAL);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
+    }
+
+    /* Normalize the descriptors.  */
+    epoll_ptr =  &nx_bsd_epoll_array[epfd - NX_BSD_EPOLL_FD_START];
+    sock_id =  (UINT)(sockID - NX_BSD_SOCKFD_START);
+
+    /* Get the protection mutex.  */
+    status =  tx_mutex_get(nx_bsd_protection_ptr, NX_BSD_TIMEOUT);
+
+    /* Check the status.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Set the socket error.  */
+        set_errno(EACCES);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_BSD_MUTEX_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
+    }
+
+    /* Check that both the epoll instance and the socket are in use.  */
+    if ((!epoll_ptr -> nx_bsd_epoll_in_use) ||
+        (!(nx_bsd_socket_array[sock_id].nx_bsd_socket_status_flags & NX_BSD_SOCKET_IN_USE)))
+    {
+
+        /* Release the protection mutex.  */
+        tx_mutex_put(nx_bsd_protection_ptr);
+
+        /* Set the socket error.  */
+        set_errno(EBADF);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
+    }
+
+    /* Check the operation against the interest list.  */
+    if (op == EPOLL_CTL_ADD)
+    {
+
+        /* The socket must not be registered yet.  */
+        if (epoll_ptr -> nx_bsd_epoll_socket_flags[sock_id] & NX_BSD_EPOLL_REGISTERED)
+        {
+
+            /* Release the protection mutex.  */
+            tx_mutex_put(nx_bsd_protection_ptr);
+
+            /* Set the socket error.  */
+            set_errno(EEXIST);
+
+            /* Return an error.  */
+            NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+            return(NX_SOC_ERROR);
+        }
+    }
+    else if (!(epoll_ptr -> nx_bsd_epoll_socket_flags[sock_id] & NX_BSD_EPOLL_REGISTERED))
+    {
+
+        /* Release the protection mutex.  */
+        tx_mutex_put(nx_bsd_protection_ptr);
+
+        /* Set the socket error.  */
+        set_errno(ENOENT);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
+    }
+
+    if (op == EPOLL_CTL_DEL)
+    {
+
+        /* Remove the socket from the interest list. If it is still on the ready list
+           it is dropped by epoll_wait. The flags are shared with the notify callbacks.  */
+        TX_DISABLE
+        epoll_ptr -> nx_bsd_epoll_socket_flags[sock_id] &= (UCHAR)(~NX_BSD_EPOLL_REGISTERED);
+        TX_RESTORE
+    }
+    else
+    {
+
+        ready_events =  nx_bsd_epoll_socket_events(sock_id);
+
+        /* Record the requested events and user data. The notify callbacks read them on
+           the IP thread, so update them with interrupts disabled.  */
+        TX_DISABLE
+        epoll_ptr -> nx_bsd_epoll_interest[sock_id] =  event -> events;
+        epoll_ptr -> nx_bsd_epoll_data[sock_id] =  event -> data;
+        epoll_ptr -> nx_bsd_epoll_socket_flags[sock_id] |= NX_BSD_EPOLL_REGISTERED;
+
+        /* Queue the socket now if it is already ready, since no notify callback will report
+           a state that has already been reached.  */
+        if (ready_events & (event -> events | EPOLLERR | EPOLLHUP))
+        {
+
+            nx_bsd_epoll_ready_add(epoll_ptr, sock_id);
+            TX_RESTORE
+
+            /* Wakeup the threads waiting on this instance.  */
+            tx_event_flags_set(&epoll_ptr -> nx_bsd_epoll_events, NX_BSD_EPOLL_EVENT, TX_OR);
+        }
+        else
+        {
+            TX_RESTORE
+        }
+    }
+
+    /* Release the protection mutex.  */
+    tx_mutex_put(nx_bsd_protection_ptr);
+
+    return(NX_SOC_OK);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    epoll_wait                                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the ready sockets of an epoll instance. Only  */
+/*    the sockets on the ready list are examined, so the cost does not    */
+/*    depend on the number of sockets on the interest list. Level         */
+/*    triggered sockets are put back at the tail of the ready list while  */
+/*    they are still ready; edge triggered (EPOLLET) sockets are reported */
+/*    once per readiness notification.                                    */
+/*                                                                        */
+/*    Timeout is in milliseconds. A negative timeout waits forever and a  */
+/*    zero timeout returns immediately.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    epfd                                  Epoll descriptor              */
+/*    events                                Returned events               */
+/*    maxevents                             Maximum number of events      */
+/*    timeout                               Timeout in milliseconds       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    count                                 Number of ready sockets, 0 on */
+/*                                            timeout                     */
+/*    NX_SOC_ERROR (-1)                     On failure                    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_bsd_epoll_socket_events            Get socket readiness          */
+/*    nx_bsd_epoll_ready_add                Add socket to ready list      */
+/*    TX_DISABLE                            Disable Interrupt             */
+/*    TX_RESTORE                            Enable Interrupt              */
+/*    tx_event_flags_get                    Get events                    */
+/*    tx_mutex_get                          Get protection                */
+/*    tx_mutex_put                          Release protection            */
+/*    tx_time_get                           Get system time               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+INT  epoll_wait(INT epfd, struct epoll_event *events, INT maxevents, INT timeout)
+{
+TX_INTERRUPT_SAVE_AREA
+
+UINT            status;
+NX_BSD_EPOLL   *epoll_ptr;
+UINT            sock_id;
+UINT            ready_count;
+ULONG           ready_events;
+INT             found;
+ULONG           ticks;
+ULONG           start_time;
+ULONG           elapsed;
+ULONG           actual_events;
+
+
+    /* Check for a valid epoll descriptor.  */
+    if ((epfd < NX_BSD_EPOLL_FD_START) || (epfd >= (NX_BSD_EPOLL_FD_START + NX_BSD_EPOLL_MAX_INSTANCES)))
+    {
+
+        /* Set the socket error.  */
+        set_errno(EBADF);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
+    }
+
+    /* Check for valid input parameters.  */
+    if ((events == NX_NULL) || (maxevents <= 0))
+    {
+
+        /* Set the socket error.  */
+        set_errno(EINVAL);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
+    }
+
+    /* Set up a pointer to the epoll instance.  */
+    epoll_ptr =  &nx_bsd_epoll_array[epfd - NX_BSD_EPOLL_FD_START];
+
+    /* Compute the timeout for the suspension.  */
+    if (timeout < 0)
+    {
+        ticks =  TX_WAIT_FOREVER;
+    }
+    else
+    {
+        ticks =  ((ULONG)timeout / 1000) * NX_IP_PERIODIC_RATE + (((ULONG)timeout % 1000) * 1000) / NX_MICROSECOND_PER_CPU_TICK;
+    }
+
+    start_time =  tx_time_get();
+
+    for (;;)
+    {
+
+        /* Get the protection mutex.  */
+        status =  tx_mutex_get(nx_bsd_protection_ptr, NX_BSD_TIMEOUT);
+
+        /* Check the status.  */
+        if (status != NX_SUCCESS)
+        {
+
+            /* Set the socket error.  */
+            set_errno(EACCES);
+
+            /* Return an error.  */
+            NX_BSD_ERROR(NX_BSD_MUTEX_ERROR, __LINE__);
+            return(NX_SOC_ERROR);
+        }
+
+        /* Check that the epoll instance is in use.  */
+        if (!epoll_ptr -> nx_bsd_epoll_in_use)
+        {
+
+            /* Release the protection mutex.  */
+            tx_mutex_put(nx_bsd_protection_ptr);
+
+            /* Set the socket error.  */
+            set_errno(EBADF);
+
+            /* Return an error.  */
+            NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+            return(NX_SOC_ERROR);
+        }
+
+        /* Visit each socket that is currently on the ready list at most once.  */
+        found =  0;
+        ready_count =  epoll_ptr -> nx_bsd_epoll_ready_count;
+        while (ready_count-- && (found < maxevents))
+        {
+
+            /* Remove the socket from the head of the ready list. The notify callbacks append
+               to the list on the IP thread, so update it with interrupts disabled.  */
+            TX_DISABLE
+            sock_id =  epoll_ptr -> nx_bsd_epoll_ready_head;
+            epoll_ptr -> nx_bsd_epoll_ready_head =  epoll_ptr -> nx_bsd_epoll_ready_next[sock_id];
+            if (epoll_ptr -> nx_bsd_epoll_ready_head == NX_BSD_MAX_SOCKETS)
+            {
+                epoll_ptr -> nx_bsd_epoll_ready_tail =  NX_BSD_MAX_SOCKETS;
+            }
+            epoll_ptr -> nx_bsd_epoll_ready_count--;
+            epoll_ptr -> nx_bsd_epoll_socket_flags[sock_id] &= (UCHAR)(~NX_BSD_EPOLL_QUEUED);
+            TX_RESTORE
+
+            /* Skip the socket if it has been removed from the interest list.  */
+            if (!(epoll_ptr -> nx_bsd_epoll_socket_flags[sock_id] & NX_BSD_EPOLL_REGISTERED))
+            {
+                continue;
+            }
+
+            /* Report the requested events the socket is still ready for.  */
+            ready_events =  nx_bsd_epoll_socket_events(sock_id) &
+                            (epoll_ptr -> nx_bsd_epoll_interest[sock_id] | EPOLLERR | EPOLLHUP);
+            if (ready_events == 0)
+            {
+                continue;
+            }
+
+            events[found].events =  ready_events;
+            events[found].data =  epoll_ptr -> nx_bsd_epoll_data[sock_id];
+            found++;
+
+            /* Level triggered sockets stay on the ready list until they are no longer ready.  */
+            if (!(epoll_ptr -> nx_bsd_epoll_interest[sock_id] & EPOLLET))
+            {
+                TX_DISABLE
+                nx_bsd_epoll_ready_add(epoll_ptr, sock_id);
+                TX_RESTORE
+            }
+        }
+
+        /* Release the protection mutex.  */
+        tx_mutex_put(nx_bsd_protection_ptr);
+
+        /* Return if any socket is ready or if the caller does not wait.  */
+        if ((found) || (ticks == 0))
+        {
+            return(found);
+        }
+
+        /* Compute the remaining wait time.  */
+        if (ticks != TX_WAIT_FOREVER)
+        {
+
+            elapsed =  tx_time_get() - start_time;
+            if (elapsed >= ticks)
+            {
+                return(0);
+            }
+
+            ticks -=  elapsed;
+            start_time +=  elapsed;
+        }
+
+        /* Wait for a notify callback to put a socket on the ready list. An event set after the
+           mutex was released is kept in the flag group, so it is not lost.  */
+        status =  tx_event_flags_get(&epoll_ptr -> nx_bsd_epoll_events, NX_BSD_EPOLL_EVENT, TX_OR_CLEAR, &actual_events, ticks);
+
+        /* Check for a timeout.  */
+        if (status == TX_NO_EVENTS)
+        {
+            return(0);
+        }
+        else if (status != TX_SUCCESS)
+        {
+
+            /* The epoll instance was closed while waiting.  */
+            set_errno(EBADF);
+
+            /* Return an error.  */
+            NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+            return(NX_SOC_ERROR);
+        }
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    nx_bsd_epoll_socket_events                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the epoll events a socket is ready for. The   */
+/*    conditions match those checked by select, without consuming any     */
+/*    queued packet.                                                      */
+/*                                                                        */
+/*    The caller must own the BSD mutex.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    sock_id                               BSD socket index              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    events                                Ready epoll events            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    epoll_ctl                                                           */
+/*    epoll_wait                                                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static ULONG nx_bsd_epoll_socket_events(UINT sock_id)
+{
+
+NX_BSD_SOCKET   *bsd_socket_ptr;
+ULONG            events =  0;
+
+
+    bsd_socket_ptr =  &nx_bsd_socket_array[sock_id];
+
+    /* Is this BSD socket in use?  */
+    if (!(bsd_socket_ptr -> nx_bsd_socket_status_flags & NX_BSD_SOCKET_IN_USE))
+    {
+        return(0);
+    }
+
+    /* Check to see if there is a disconnection request pending.  */
+    if (bsd_socket_ptr -> nx_bsd_socket_status_flags & NX_BSD_SOCKET_DISCONNECTION_REQUEST)
+    {
+        events |=  EPOLLIN | EPOLLHUP;
+    }
+
+    /* Check to see if there is a receive packet pending.  */
+    if (bsd_socket_ptr -> nx_bsd_socket_received_packet)
+    {
+        events |=  EPOLLIN;
+    }
+    else if (bsd_socket_ptr -> nx_bsd_socket_tcp_socket)
+    {
+
+        /* A listening master socket is readable when its secondary socket is connected.  */
+        if (bsd_socket_ptr -> nx_bsd_socket_status_flags & NX_BSD_SOCKET_SERVER_MASTER_SOCKET)
+        {
+            if ((bsd_socket_ptr -> nx_bsd_socket_status_flags & NX_BSD_SOCKET_ENABLE_LISTEN) &&
+                (bsd_socket_ptr -> nx_bsd_socket_status_flags & NX_BSD_SOCKET_CONNECTED))
+            {
+                events |=  EPOLLIN;
+            }
+        }
+
+        /* A connected socket is readable when NetX has queued data.  */
+        else if ((bsd_socket_ptr -> nx_bsd_socket_status_flags & NX_BSD_SOCKET_CONNECTED) &&
+                 (bsd_socket_ptr -> nx_bsd_socket_tcp_socket -> nx_tcp_socket_receive_queue_count))
+        {
+            events |=  EPOLLIN;
+        }
+    }
+#ifdef NX_ENABLE_IP_RAW_PACKET_FILTER
+
+    /* A raw socket is readable when the raw packet filter has queued packets for it.  */
+    else if ((bsd_socket_ptr -> nx_bsd_socket_option_flags & NX_BSD_SOCKET_ENABLE_RAW_SOCKET) &&
+             (bsd_socket_ptr -> nx_bsd_socket_received_packet_count))
+    {
+        events |=  EPOLLIN;
+    }
+#endif /* NX_ENABLE_IP_RAW_PACKET_FILTER */
+
+    /* Check to see if there is a connection request pending.  */
+    if (bsd_socket_ptr -> nx_bsd_socket_status_flags & NX_BSD_SOCKET_CONNECTION_REQUEST)
+    {
+        events |=  EPOLLOUT;
+    }
+
+    /* Check to see if there is an error.  */
+    if (bsd_socket_ptr -> nx_bsd_socket_status_flags & NX_BSD_SOCKET_ERROR)
+    {
+        events |=  EPOLLOUT | EPOLLERR;
+    }
+
+    return(events);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    nx_bsd_epoll_ready_add                              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function appends a socket to the ready list of an epoll        */
+/*    instance if it is not already on it.                                */
+/*                                                                        */
+/*    The ready list is also updated by the NetX notify callbacks on the  */
+/*    IP thread, which do not own the BSD mutex, so the caller must have  */
+/*    interrupts disabled.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    epoll_ptr                             Pointer to epoll instance     */
+/*    sock_id                               BSD socket index              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    epoll_ctl                                                           */
+/*    epoll_wait                                                          */
+/*    nx_bsd_epoll_notify                                                 */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID nx_bsd_epoll_ready_add(NX_BSD_EPOLL *epoll_ptr, UINT sock_id)
+{
+
+    /* Is the socket already on the ready list?  */
+    if (epoll_ptr -> nx_bsd_epoll_socket_flags[sock_id] & NX_BSD_EPOLL_QUEUED)
+    {
+        return;
+    }
+
+    /* Append the socket to the tail.  */
+    epoll_ptr -> nx_bsd_epoll_socket_flags[sock_id] |= NX_BSD_EPOLL_QUEUED;
+    epoll_ptr -> nx_bsd_epoll_ready_next[sock_id] =  NX_BSD_MAX_SOCKETS;
+
+    if (epoll_ptr -> nx_bsd_epoll_ready_head == NX_BSD_MAX_SOCKETS)
+    {
+        epoll_ptr -> nx_bsd_epoll_ready_head =  sock_id;
+    }
+    else
+    {
+        epoll_ptr -> nx_bsd_epoll_ready_next[epoll_ptr -> nx_bsd_epoll_ready_tail] =  sock_id;
+    }
+
+    epoll_ptr -> nx_bsd_epoll_ready_tail =  sock_id;
+    epoll_ptr -> nx_bsd_epoll_ready_count++;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    nx_bsd_epoll_notify                                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function records a readiness change reported by a NetX         */
+/*    notify callback. The socket is queued on every epoll instance       */
+/*    watching it for the reported events, and the threads waiting on     */
+/*    those instances are woken up.                                       */
+/*                                                                        */
+/*    This function is called from the NetX notify callbacks on the IP    */
+/*    thread without the BSD mutex, so the ready lists are updated with   */
+/*    interrupts disabled.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    sock_id                               BSD socket index              */
+/*    fd_sets                               The FD sets that changed      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_bsd_epoll_ready_add                Add socket to ready list      */
+/*    TX_DISABLE                            Disable Interrupt             */
+/*    TX_RESTORE                            Enable Interrupt              */
+/*    tx_event_flags_set                    Set events                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    nx_bsd_select_wakeup                                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID nx_bsd_epoll_notify(UINT sock_id, UINT fd_sets)
+{
+TX_INTERRUPT_SAVE_AREA
+
+UINT            i;
+ULONG           events =  0;
+NX_BSD_EPOLL   *epoll_ptr;
+
+
+    /* Map the FD sets to epoll events.  */
+    if (fd_sets & FDSET_READ)
+    {
+        events |=  EPOLLIN;
+    }
+    if (fd_sets & FDSET_WRITE)
+    {
+        events |=  EPOLLOUT;
+    }
+    if (fd_sets & FDSET_EXCEPTION)
+    {
+        events |=  EPOLLERR | EPOLLHUP;
+    }
+
+    for (i = 0; i < NX_BSD_EPOLL_MAX_INSTANCES; i++)
+    {
+
+        epoll_ptr =  &nx_bsd_epoll_array[i];
+
+        /* Disable interrupts temporarily.  */
+        TX_DISABLE
+
+        /* Is this instance watching the socket for these events?  */
+        if ((!epoll_ptr -> nx_bsd_epoll_in_use) ||
+            (!(epoll_ptr -> nx_bsd_epoll_socket_flags[sock_id] & NX_BSD_EPOLL_REGISTERED)) ||
+            (!((epoll_ptr -> nx_bsd_epoll_interest[sock_id] | EPOLLERR | EPOLLHUP) & events)))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+            continue;
+        }
+
+        /* Queue the socket.  */
+        nx_bsd_epoll_ready_add(epoll_ptr, sock_id);
+
+        /* Keep epoll close from deleting the event flags group until they are set.  */
+        epoll_ptr -> nx_bsd_epoll_notify_count++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Wakeup the threads waiting on this instance.  */
+        tx_event_flags_set(&epoll_ptr -> nx_bsd_epoll_events, NX_BSD_EPOLL_EVENT, TX_OR);
+
+        /* Disable interrupts temporarily.  */
+        TX_DISABLE
+
+        epoll_ptr -> nx_bsd_epoll_notify_count--;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    nx_bsd_epoll_socket_remove                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a socket being closed from the interest list  */
+/*    of every epoll instance.                                            */
+/*                                                                        */
+/*    The caller must own the BSD mutex.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    sock_id                               BSD socket index              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    TX_DISABLE                            Disable Interrupt             */
+/*    TX_RESTORE                            Enable Interrupt              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    soc_close                                                           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID nx_bsd_epoll_socket_remove(UINT sock_id)
+{
+TX_INTERRUPT_SAVE_AREA
+
+UINT            i;
+
+
+    for (i = 0; i < NX_BSD_EPOLL_MAX_INSTANCES; i++)
+    {
+
+        /* Entries still on the ready list are dropped by epoll_wait. The flags are shared
+           with the notify callbacks.  */
+        TX_DISABLE
+        nx_bsd_epoll_array[i].nx_bsd_epoll_socket_flags[sock_id] &= (UCHAR)(~NX_BSD_EPOLL_REGISTERED);
+        TX_RESTORE
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    nx_bsd_epoll_close                                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases an epoll instance. Threads waiting in        */
+/*    epoll_wait on the instance return with EBADF.                       */
+/*                                                                        */
+/*    The instance is unhooked from the notify callbacks with interrupts  */
+/*    disabled, and its event flags group is deleted once no callback is  */
+/*    still setting it.                                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    epoll_index                           Epoll instance index          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_SOC_OK (0)                         On success                    */
+/*    NX_SOC_ERROR (-1)                     On failure                    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    TX_DISABLE                            Disable Interrupt             */
+/*    TX_RESTORE                            Enable Interrupt              */
+/*    tx_event_flags_delete                 Delete event flag group       */
+/*    tx_mutex_get                          Get protection                */
+/*    tx_mutex_put                          Release protection            */
+/*    tx_thread_sleep                       Sleep until callbacks finish  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    soc_close                                                           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static INT nx_bsd_epoll_close(UINT epoll_index)
+{
+TX_INTERRUPT_SAVE_AREA
+
+UINT            i;
+NX_BSD_EPOLL   *epoll_ptr;
+
+
+    epoll_ptr =  &nx_bsd_epoll_array[epoll_index];
+
+    /* Get the protection mutex.  */
+    tx_mutex_get(nx_bsd_protection_ptr, NX_BSD_TIMEOUT);
+
+    /* Is the epoll instance in use?  */
+    if (!epoll_ptr -> nx_bsd_epoll_in_use)
+    {
+
+        /* Release the protection mutex.  */
+        tx_mutex_put(nx_bsd_protection_ptr);
+
+        /* Set the socket error.  */
+        set_errno(EBADF);
+
+        /* Return an error.  */
+        NX_BSD_ERROR(NX_SOC_ERROR, __LINE__);
+        return(NX_SOC_ERROR);
+    }
+
+    /* Unhook the instance so the notify callbacks no longer queue sockets on it.  */
+    TX_DISABLE
+    epoll_ptr -> nx_bsd_epoll_in_use =  NX_FALSE;
+    for (i = 0; i < NX_BSD_MAX_SOCKETS; i++)
+    {
+        epoll_ptr -> nx_bsd_epoll_socket_flags[i] =  0;
+    }
+    epoll_ptr -> nx_bsd_epoll_ready_head =  NX_BSD_MAX_SOCKETS;
+    epoll_ptr -> nx_bsd_epoll_ready_tail =  NX_BSD_MAX_SOCKETS;
+    epoll_ptr -> nx_bsd_epoll_ready_count =  0;
+    TX_RESTORE
+
+    /* A notify callback on the IP thread may still be setting the event flags.  Wait for it
+       to finish before the group is deleted.  */
+    while (epoll_ptr -> nx_bsd_epoll_notify_count)
+    {
+        tx_thread_sleep(1);
+    }
+
+    /* Delete the event flags group, which resumes any waiting thread.  */
+    tx_event_flags_delete(&epoll_ptr -> nx_bsd_epoll_events);
+
+    /* Release the protection mutex.  */
+    tx_mutex_put(nx_bsd_protection_ptr);
+
+    return(NX_SOC_OK);
+}
+#endif /* NX_BSD_ENABLE_EPOLL */
+
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    nx_bsd_tcp_receive_notify                           PORTABLE C      */ 
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */ 
+/*                                                                        */ 
+/*    This is the NetX callback function for TCP Socket receive operation */
+/*    This function resumes all the threads suspended on the socket.      */
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    *socket_ptr                           Pointer to the socket which   */
+/*                                            received the data packet    */  
+/*                                                                        */ 
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    FD_ZERO                               Clear a socket ready list     */
+/*    FD_ISSET                              Check a socket is ready       */
+/*    FD_SET                                Set a socket to check         */ 
+/*    tx_event_flags_get                    Get events                    */ 
+/*    tx_mutex_get                          Get protection                */ 
+/*    tx_mutex_put                          Release protection            */ 
+/*    tx_thread_identify                    Get current thread pointer    */ 
+/*                                                                        */
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    NetX                                                                */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*                                                                        */
+/**************************************************************************/
+static VOID  nx_bsd_tcp_receive_notify(NX_TCP_SOCKET *socket_ptr)
+{
+UINT                    bsd_socket_index;
+
+    /* Figure out what BSD socket this is.  */
+    bsd_socket_index =  (UINT) socket_ptr -> nx_tcp_socket_reserved_ptr;
+    
+    /* Determine if this is a good index into the BSD socket array.  */
+    if (bsd_socket_index >= NX_BSD_MAX_SOCKETS)
+    {
+    
+        /* Bad socket index... simply return!  */
+        return;
+    }
+
+    /* Now check if the socket may have been released (e.g. socket closed) while
+       waiting for the mutex. */
+    if( socket_ptr -> nx_tcp_socket_id == 0 )    
+    {
+
+        return;          
+    }     
+
+    /* Check the suspended socket list for one ready to receive or send packets. */
+    nx_bsd_select_wakeup(bsd_socket_index, FDSET_READ);
+
+
+    return;
+}
+
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    nx_bsd_tcp_establish_notify                         PORTABLE C      */ 
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */ 
+/*                                                                        */ 
+/*    This is the NetX callback function for TCP Server Socket listen.    */
+/*    This function resumes all the threads suspended on the socket.      */
+/*                                                                        */ 
+/*  INPUT                                                                 */ 
+/*                                                                        */ 
+/*    *socket_ptr                           Pointer to the socket which   */
+/*                                          Received the data packet      */  
+/*                                                                        */
+/*  OUTPUT                                                                */ 
+/*                                                                        */ 
+/*    None                                                                */ 
+/*                                                                        */ 
+/*  CALLS                                                                 */ 
+/*                                                                        */ 
+/*    FD_ZERO                               Clear a socket ready list     */
+/*    FD_ISSET                              Check a socket is ready       */
+/*    FD_SET                                Set a socket to check         */ 
+/*    tx_event_flags_get                    Get events                    */ 
+/*    tx_mutex_get                          Get protection                */ 
+/*    tx_mutex_put                          Release protection            */ 
+/*    tx_thread_identify                    Get current thread pointer    */ 
+/*                                                                        */
+/*  CALLED BY                                                             */ 
+/*                                                                        */ 
+/*    NetX                                                                */ 
+/*                                                                        */ 
+/*  RELEASE HISTORY                                                       */ 
+/*                                                                        */ 
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*                                                                        */
+/**************************************************************************/
+#ifndef NX_DISABLE_EXTENDED_NOTIFY_SUPPORT
+static VOID  nx_bsd_tcp_establish_notify(NX_TCP_SOCKET *socket_ptr)
+{
+UINT                    bsd_socket_index;
+UINT                    master_socket_index; 
+
+    /* Figure out what BSD socket this is.  */
+    bsd_socket_index =  (UINT) socket_ptr -> nx_tcp_socket_reserved_ptr;
+    
+    /* Determine if this is a good index into the BSD socket array.  */
+    if (bsd_socket_index >= NX_BSD_MAX_SOCKETS)
+    {
+    
+        /* Bad socket index... simply return!  */
+        return;
+    }
+
+    /* Initialize the master socket index to an invalid value so we can check if it was actually used
+       later.  */
+    master_socket_index =  NX_BSD_MAX_SOCKETS;
+
+    /* Mark the socket as connected, and also clear the EINPROGRESS flag */
+    nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags |= NX_BSD_SOCKET_CONNECTED;
+
+    nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags |=  NX_BSD_SOCKET_CONNECTION_REQUEST;
+
+    /* Reset the listen-enabled flag. */
+    nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags &= (ULONG)(~NX_BSD_SOCKET_ENABLE_LISTEN);
+
+    /* Mark the socket is bound. */
+    nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags |= NX_BSD_SOCKET_BOUND;
+
+#ifndef NX_DISABLE_IPV4
+    /* Find out the local address this socket is connected on. */
+    if(nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_family == AF_INET)
+    {
+        /* IPv4 case */
+        nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_local_bind_interface = (ULONG)socket_ptr -> nx_tcp_socket_connect_interface;
+    }
+#endif /* NX_DISABLE_IPV4 */
+#ifdef FEATURE_NX_IPV6
+    if(nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_family == AF_INET6)
+    {
+        /* IPv6 */
+        nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_local_bind_interface = (ULONG)socket_ptr -> nx_tcp_socket_ipv6_addr;
+    }
+#endif
+    /* Determine if the BSD socket is server socket. */
+
+
+    /* Is this a secondary socket? */
+    if (nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_status_flags & NX_BSD_SOCKET_SERVER_SECONDARY_SOCKET)
+    {
+
+        /* Yes, get the master socket.  */
+        master_socket_index =  (UINT)(nx_bsd_socket_array[bsd_socket_index].nx_bsd_socket_union_id.nx_bsd_socket_master_socket_id);
+
+        /* Mark the server socket as also connected. */
+        nx_bsd_socket_array[master_socket_index].nx_bsd_socket_status_flags |= NX_BSD_SOCKET_CONNECTED;
+
+        nx_bsd_socket_array[master_socket_index].nx_bsd_socket_status_flags |= NX_BSD_SOCKET_CONNECTION_REQUEST;
+
+        /* Check on connect requests for all server sockets for this master socket. */
+        nx_bsd_select_wakeup(master_socket_index, FDSET_READ);
+    }
+    else
+    {
+        /* This is a client socket. */
+        nx_bsd_select_wakeup(bsd_socket_index, FDSET_WRITE);
+    }
+}
+#endif /* NX_DISABLE_EXTENDED_NOTIFY_SUPPORT */
+
+/**************************************************************************/ 
+/*                                                                        */ 
+/*  FUNCTION                                               RELEASE        */ 
+/*                                                                        */ 
+/*    nx_bsd_tcp_socket_disconnect_notify                 PORTABLE C      */ 
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */ 
+/*                                                                        */ 
 /*    This is the NetX callback function for TCP Socket disconnect.       */
 /*    This function resumes all the BSD threads suspended on the socket.  */
 /*                                                                        */ 
@@ -9728,7 +10807,7 @@ TX_THREAD       *current_thread_ptr;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    nx_bsd_select_wakeup                                PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -9754,6 +10833,8 @@ TX_THREAD       *current_thread_ptr;
 /*    TX_DISABLE                            Disable Interrupt             */
 /*    TX_RESTORE                            Enable Interrupt              */
 /*    tx_event_flags_set                    Set an event flag             */
+/*    nx_bsd_epoll_notify                   Queue socket on epoll ready   */
+/*                                            lists                       */
 /*                                                                        */
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -9771,6 +10852,9 @@ TX_THREAD       *current_thread_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            epoll notification,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID nx_bsd_select_wakeup(UINT sock_id, UINT fd_sets)
@@ -9786,6 +10870,11 @@ NX_BSD_SOCKET_SUSPEND   *suspend_info;
     /* At this point the thread should NOT own the IP mutex, and it must own the 
        BSD mutex. */
 
+#ifdef NX_BSD_ENABLE_EPOLL
+
+    /* Queue the socket on the epoll instances watching it.  */
+    nx_bsd_epoll_notify(sock_id, fd_sets);
+#endif /* NX_BSD_ENABLE_EPOLL */
  
     FD_ZERO(&local_fd);
     FD_SET((INT)sock_id + NX_BSD_SOCKFD_START, &local_fd);
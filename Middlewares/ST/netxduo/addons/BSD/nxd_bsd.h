@@ -25,7 +25,7 @@
 /*  BSD DEFINITIONS                                        RELEASE        */ 
 /*                                                                        */ 
 /*    nxd_bsd.h                                           PORTABLE C      */ 
-/*                                                           6.1.5        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -46,6 +46,9 @@
 /*  03-02-2021     Yuxin Zhou               Modified comment(s), and      */
 /*                                            fixed compiler warnings,    */
 /*                                            resulting in version 6.1.5  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            epoll readiness interface,  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -99,6 +102,13 @@ extern   "C" {
 #define NX_BSD_ENABLE_DNS
 */
 
+/* Defined, epoll_create, epoll_ctl and epoll_wait are available. Socket readiness is recorded by the
+   NetX receive notify callbacks on a per-instance ready list, so epoll_wait only visits sockets that
+   are ready instead of scanning every watched socket as select does. */
+/*
+#define NX_BSD_ENABLE_EPOLL
+*/
+
 
 /* 
    Define the BSD socket timeout process to execute in the timer context. 
@@ -163,6 +173,17 @@ extern   "C" {
 #define NX_BSD_TIMER_RATE                   (1 * NX_IP_PERIODIC_RATE)        /* Rate at which BSD timer runs.                                   */
 #endif                                                                      
 
+#ifdef NX_BSD_ENABLE_EPOLL
+#ifndef NX_BSD_EPOLL_MAX_INSTANCES
+#define NX_BSD_EPOLL_MAX_INSTANCES          2                       /* Maximum number of epoll instances.                                   */
+#endif
+
+#ifndef NX_BSD_EPOLL_FD_START
+#define NX_BSD_EPOLL_FD_START               (NX_BSD_SOCKFD_START + NX_BSD_MAX_SOCKETS)
+                                                                    /* Logical FD starting value of epoll instances, after the socket FDs.  */
+#endif
+#endif /* NX_BSD_ENABLE_EPOLL */
+
            
 /* Define BSD events */
 
@@ -173,6 +194,7 @@ extern   "C" {
 #define NX_BSD_LINGER_EVENT                 ((ULONG) 0x00000004)    /* Event flag to signal a timed linger state has expired on a socket    */
 #define NX_BSD_TIMED_WAIT_EVENT             ((ULONG) 0x00000008)    /* Event flag to signal a timed wait state has expired on a socket      */
 #define NX_BSD_TIMER_EVENT                  ((ULONG) 0x00000010)    /* Event flag to singal a BSD 1 sec timer */
+#define NX_BSD_EPOLL_EVENT                  ((ULONG) 0x00000001)    /* Event flag to signal a socket is ready on an epoll instance          */
 
 /* For compatibility undefine the fd_set.  Then define the FD set size.  */
 
@@ -590,6 +612,59 @@ typedef struct NX_BSD_SOCKET_SUSPEND_STRUCT
 } NX_BSD_SOCKET_SUSPEND;
 
 
+#ifdef NX_BSD_ENABLE_EPOLL
+
+/* Define the epoll events.  */
+
+#define EPOLLIN                             0x00000001              /* Socket is readable                                                   */
+#define EPOLLOUT                            0x00000004              /* Socket is writable                                                   */
+#define EPOLLERR                            0x00000008              /* Error on socket, always reported                                     */
+#define EPOLLHUP                            0x00000010              /* Peer disconnected, always reported                                   */
+#define EPOLLET                             0x80000000              /* Edge triggered: report once per readiness notification               */
+
+/* Define the epoll_ctl operations.  */
+
+#define EPOLL_CTL_ADD                       1                       /* Add a socket to the interest list                                    */
+#define EPOLL_CTL_DEL                       2                       /* Remove a socket from the interest list                               */
+#define EPOLL_CTL_MOD                       3                       /* Change the events of a socket in the interest list                   */
+
+typedef union epoll_data
+{
+    VOID               *ptr;
+    INT                 fd;
+    ULONG               u32;
+} epoll_data_t;
+
+struct epoll_event
+{
+    ULONG               events;             /* Requested or returned epoll events.                                  */
+    epoll_data_t        data;               /* User data returned with the events.                                  */
+};
+
+/* Define the epoll instance. The interest list is indexed by BSD socket index, the ready list links
+   the ready sockets through nx_bsd_epoll_ready_next and ends with NX_BSD_MAX_SOCKETS.  */
+
+#define NX_BSD_EPOLL_REGISTERED             0x01                    /* Socket is on the interest list                                       */
+#define NX_BSD_EPOLL_QUEUED                 0x02                    /* Socket is on the ready list                                          */
+
+typedef struct NX_BSD_EPOLL_STRUCT
+{
+    UINT                 nx_bsd_epoll_in_use;
+    TX_EVENT_FLAGS_GROUP nx_bsd_epoll_events;
+    ULONG                nx_bsd_epoll_interest[NX_BSD_MAX_SOCKETS];
+    epoll_data_t         nx_bsd_epoll_data[NX_BSD_MAX_SOCKETS];
+    UCHAR                nx_bsd_epoll_socket_flags[NX_BSD_MAX_SOCKETS];
+    UINT                 nx_bsd_epoll_ready_next[NX_BSD_MAX_SOCKETS];
+    UINT                 nx_bsd_epoll_ready_head;
+    UINT                 nx_bsd_epoll_ready_tail;
+    UINT                 nx_bsd_epoll_ready_count;
+    UINT                 nx_bsd_epoll_notify_count;
+
+} NX_BSD_EPOLL;
+
+#endif /* NX_BSD_ENABLE_EPOLL */
+
+
 struct ip_mreq 
 {
     struct in_addr imr_multiaddr;     /* The IPv4 multicast address to join. */
@@ -839,6 +914,11 @@ INT  getaddrinfo(const CHAR *node, const CHAR *service, const struct addrinfo *h
 VOID freeaddrinfo(struct addrinfo *res);
 INT  getnameinfo(const struct sockaddr *sa, socklen_t salen, char *host, size_t hostlen, char *serv, size_t servlen, int flags);
 VOID nx_bsd_set_service_list(struct NX_BSD_SERVICE_LIST *serv_list_ptr, ULONG serv_list_len);
+#ifdef NX_BSD_ENABLE_EPOLL
+INT  epoll_create(INT size);
+INT  epoll_ctl(INT epfd, INT op, INT sockID, struct epoll_event *event);
+INT  epoll_wait(INT epfd, struct epoll_event *events, INT maxevents, INT timeout);
+#endif /* NX_BSD_ENABLE_EPOLL */
 
 #undef FD_SET
 #undef FD_CLR
@@ -221,3 +221,666 @@ UINT nx_azure_iot_json_reader_token_type(NX_AZURE_IOT_JSON_READER *reader_ptr)
 
     return(reader_ptr -> json_reader.token.kind);
 }
+
+/* Stream reader states.  */
+#define NX_AZURE_IOT_STREAM_STATE_VALUE             0
+#define NX_AZURE_IOT_STREAM_STATE_ARRAY_FIRST       1
+#define NX_AZURE_IOT_STREAM_STATE_OBJECT_FIRST      2
+#define NX_AZURE_IOT_STREAM_STATE_NAME              3
+#define NX_AZURE_IOT_STREAM_STATE_COLON             4
+#define NX_AZURE_IOT_STREAM_STATE_NEXT              5
+#define NX_AZURE_IOT_STREAM_STATE_STRING            6
+#define NX_AZURE_IOT_STREAM_STATE_NUMBER            7
+#define NX_AZURE_IOT_STREAM_STATE_LITERAL           8
+#define NX_AZURE_IOT_STREAM_STATE_DONE              9
+
+/* String sub states.  */
+#define NX_AZURE_IOT_STREAM_STRING_NORMAL           0
+#define NX_AZURE_IOT_STREAM_STRING_ESCAPE           1
+#define NX_AZURE_IOT_STREAM_STRING_UNICODE          2
+
+/* Number sub states, following the JSON number grammar.  */
+#define NX_AZURE_IOT_STREAM_NUMBER_MINUS            0
+#define NX_AZURE_IOT_STREAM_NUMBER_ZERO             1
+#define NX_AZURE_IOT_STREAM_NUMBER_INTEGER          2
+#define NX_AZURE_IOT_STREAM_NUMBER_DOT              3
+#define NX_AZURE_IOT_STREAM_NUMBER_FRACTION         4
+#define NX_AZURE_IOT_STREAM_NUMBER_EXPONENT         5
+#define NX_AZURE_IOT_STREAM_NUMBER_EXPONENT_SIGN    6
+#define NX_AZURE_IOT_STREAM_NUMBER_EXPONENT_DIGIT   7
+
+static UINT nx_azure_iot_json_stream_reader_byte_process(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                         UCHAR c);
+
+static UINT nx_azure_iot_json_stream_reader_append(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                   const UCHAR *data_ptr, UINT data_len)
+{
+    if ((reader_ptr -> buffer_size - reader_ptr -> buffer_len) < data_len)
+    {
+        return(NX_AZURE_IOT_INSUFFICIENT_BUFFER_SPACE);
+    }
+
+    memcpy(reader_ptr -> buffer_ptr + reader_ptr -> buffer_len, data_ptr, data_len); /* Use case of memcpy is verified. */
+    reader_ptr -> buffer_len += data_len;
+
+    return(NX_AZURE_IOT_SUCCESS);
+}
+
+static VOID nx_azure_iot_json_stream_reader_value_end(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr)
+{
+    if (reader_ptr -> depth == 0)
+    {
+        reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_DONE;
+    }
+    else
+    {
+        reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_NEXT;
+    }
+}
+
+static UINT nx_azure_iot_json_stream_reader_top_is_object(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr)
+{
+UINT depth = reader_ptr -> depth - 1;
+
+    return((UINT)((reader_ptr -> container_stack[depth >> 5] >> (depth & 31)) & 1));
+}
+
+static UINT nx_azure_iot_json_stream_reader_container_begin(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                            UINT is_object)
+{
+UINT depth = reader_ptr -> depth;
+
+    if (depth >= NX_AZURE_IOT_STREAM_READER_MAX_DEPTH)
+    {
+        return(NX_AZURE_IOT_INSUFFICIENT_BUFFER_SPACE);
+    }
+
+    if (is_object)
+    {
+        reader_ptr -> container_stack[depth >> 5] |= ((ULONG)1 << (depth & 31));
+        reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_OBJECT_FIRST;
+    }
+    else
+    {
+        reader_ptr -> container_stack[depth >> 5] &= ~((ULONG)1 << (depth & 31));
+        reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_ARRAY_FIRST;
+    }
+    reader_ptr -> depth++;
+
+    return(reader_ptr -> callback(reader_ptr -> callback_context,
+                                  is_object ? NX_AZURE_IOT_READER_TOKEN_BEGIN_OBJECT :
+                                              NX_AZURE_IOT_READER_TOKEN_BEGIN_ARRAY,
+                                  NX_NULL, 0));
+}
+
+static UINT nx_azure_iot_json_stream_reader_container_end(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                          UINT is_object)
+{
+    if (nx_azure_iot_json_stream_reader_top_is_object(reader_ptr) != is_object)
+    {
+        return(NX_AZURE_IOT_INVALID_PACKET);
+    }
+
+    reader_ptr -> depth--;
+    nx_azure_iot_json_stream_reader_value_end(reader_ptr);
+
+    return(reader_ptr -> callback(reader_ptr -> callback_context,
+                                  is_object ? NX_AZURE_IOT_READER_TOKEN_END_OBJECT :
+                                              NX_AZURE_IOT_READER_TOKEN_END_ARRAY,
+                                  NX_NULL, 0));
+}
+
+static UINT nx_azure_iot_json_stream_reader_value_begin(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                        UCHAR c)
+{
+    reader_ptr -> buffer_len = 0;
+
+    switch (c)
+    {
+    case '{':
+        return(nx_azure_iot_json_stream_reader_container_begin(reader_ptr, NX_TRUE));
+
+    case '[':
+        return(nx_azure_iot_json_stream_reader_container_begin(reader_ptr, NX_FALSE));
+
+    case '"':
+        reader_ptr -> token_type = NX_AZURE_IOT_READER_TOKEN_STRING;
+        reader_ptr -> sub_state = NX_AZURE_IOT_STREAM_STRING_NORMAL;
+        reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_STRING;
+        return(NX_AZURE_IOT_SUCCESS);
+
+    case 't':
+        reader_ptr -> token_type = NX_AZURE_IOT_READER_TOKEN_TRUE;
+        reader_ptr -> literal_ptr = (const UCHAR *)"true";
+        break;
+
+    case 'f':
+        reader_ptr -> token_type = NX_AZURE_IOT_READER_TOKEN_FALSE;
+        reader_ptr -> literal_ptr = (const UCHAR *)"false";
+        break;
+
+    case 'n':
+        reader_ptr -> token_type = NX_AZURE_IOT_READER_TOKEN_NULL;
+        reader_ptr -> literal_ptr = (const UCHAR *)"null";
+        break;
+
+    default:
+        if (c == '-')
+        {
+            reader_ptr -> sub_state = NX_AZURE_IOT_STREAM_NUMBER_MINUS;
+        }
+        else if (c == '0')
+        {
+            reader_ptr -> sub_state = NX_AZURE_IOT_STREAM_NUMBER_ZERO;
+        }
+        else if ((c >= '1') && (c <= '9'))
+        {
+            reader_ptr -> sub_state = NX_AZURE_IOT_STREAM_NUMBER_INTEGER;
+        }
+        else
+        {
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+
+        reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_NUMBER;
+        return(nx_azure_iot_json_stream_reader_append(reader_ptr, &c, 1));
+    }
+
+    /* Literal, first character already matched.  */
+    reader_ptr -> literal_index = 1;
+    reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_LITERAL;
+
+    return(NX_AZURE_IOT_SUCCESS);
+}
+
+static UINT nx_azure_iot_json_stream_reader_unicode_append(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                           ULONG code_point)
+{
+UCHAR utf8[4];
+UINT length;
+
+    if (code_point < 0x80)
+    {
+        utf8[0] = (UCHAR)code_point;
+        length = 1;
+    }
+    else if (code_point < 0x800)
+    {
+        utf8[0] = (UCHAR)(0xC0 | (code_point >> 6));
+        utf8[1] = (UCHAR)(0x80 | (code_point & 0x3F));
+        length = 2;
+    }
+    else if (code_point < 0x10000)
+    {
+        utf8[0] = (UCHAR)(0xE0 | (code_point >> 12));
+        utf8[1] = (UCHAR)(0x80 | ((code_point >> 6) & 0x3F));
+        utf8[2] = (UCHAR)(0x80 | (code_point & 0x3F));
+        length = 3;
+    }
+    else
+    {
+        utf8[0] = (UCHAR)(0xF0 | (code_point >> 18));
+        utf8[1] = (UCHAR)(0x80 | ((code_point >> 12) & 0x3F));
+        utf8[2] = (UCHAR)(0x80 | ((code_point >> 6) & 0x3F));
+        utf8[3] = (UCHAR)(0x80 | (code_point & 0x3F));
+        length = 4;
+    }
+
+    return(nx_azure_iot_json_stream_reader_append(reader_ptr, utf8, length));
+}
+
+static UINT nx_azure_iot_json_stream_reader_string_process(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                           UCHAR c)
+{
+UCHAR escaped;
+ULONG code_point;
+
+    if (reader_ptr -> sub_state == NX_AZURE_IOT_STREAM_STRING_NORMAL)
+    {
+
+        /* A high surrogate must be followed by an escaped low surrogate.  */
+        if ((reader_ptr -> high_surrogate != 0) && (c != '\\'))
+        {
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+
+        if (c == '\\')
+        {
+            reader_ptr -> sub_state = NX_AZURE_IOT_STREAM_STRING_ESCAPE;
+            return(NX_AZURE_IOT_SUCCESS);
+        }
+
+        if (c < 0x20)
+        {
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+
+        if (c != '"')
+        {
+            return(nx_azure_iot_json_stream_reader_append(reader_ptr, &c, 1));
+        }
+
+        /* End of string.  */
+        if (reader_ptr -> token_type == NX_AZURE_IOT_READER_TOKEN_PROPERTY_NAME)
+        {
+            reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_COLON;
+        }
+        else
+        {
+            nx_azure_iot_json_stream_reader_value_end(reader_ptr);
+        }
+
+        return(reader_ptr -> callback(reader_ptr -> callback_context, reader_ptr -> token_type,
+                                      reader_ptr -> buffer_ptr, reader_ptr -> buffer_len));
+    }
+
+    if (reader_ptr -> sub_state == NX_AZURE_IOT_STREAM_STRING_ESCAPE)
+    {
+        if (c == 'u')
+        {
+            reader_ptr -> sub_state = NX_AZURE_IOT_STREAM_STRING_UNICODE;
+            reader_ptr -> literal_index = 0;
+            reader_ptr -> unicode_value = 0;
+            return(NX_AZURE_IOT_SUCCESS);
+        }
+
+        if (reader_ptr -> high_surrogate != 0)
+        {
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+
+        switch (c)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            escaped = c;
+            break;
+        case 'b':
+            escaped = '\b';
+            break;
+        case 'f':
+            escaped = '\f';
+            break;
+        case 'n':
+            escaped = '\n';
+            break;
+        case 'r':
+            escaped = '\r';
+            break;
+        case 't':
+            escaped = '\t';
+            break;
+        default:
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+
+        reader_ptr -> sub_state = NX_AZURE_IOT_STREAM_STRING_NORMAL;
+        return(nx_azure_iot_json_stream_reader_append(reader_ptr, &escaped, 1));
+    }
+
+    /* \uXXXX escape.  */
+    if ((c >= '0') && (c <= '9'))
+    {
+        reader_ptr -> unicode_value = (reader_ptr -> unicode_value << 4) | (ULONG)(c - '0');
+    }
+    else if ((c >= 'a') && (c <= 'f'))
+    {
+        reader_ptr -> unicode_value = (reader_ptr -> unicode_value << 4) | (ULONG)(c - 'a' + 10);
+    }
+    else if ((c >= 'A') && (c <= 'F'))
+    {
+        reader_ptr -> unicode_value = (reader_ptr -> unicode_value << 4) | (ULONG)(c - 'A' + 10);
+    }
+    else
+    {
+        return(NX_AZURE_IOT_INVALID_PACKET);
+    }
+
+    if (++(reader_ptr -> literal_index) < 4)
+    {
+        return(NX_AZURE_IOT_SUCCESS);
+    }
+
+    reader_ptr -> sub_state = NX_AZURE_IOT_STREAM_STRING_NORMAL;
+    code_point = reader_ptr -> unicode_value;
+
+    if (reader_ptr -> high_surrogate != 0)
+    {
+        if ((code_point < 0xDC00) || (code_point > 0xDFFF))
+        {
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+
+        code_point = 0x10000 + ((reader_ptr -> high_surrogate - 0xD800) << 10) + (code_point - 0xDC00);
+        reader_ptr -> high_surrogate = 0;
+    }
+    else if ((code_point >= 0xD800) && (code_point <= 0xDBFF))
+    {
+        reader_ptr -> high_surrogate = code_point;
+        return(NX_AZURE_IOT_SUCCESS);
+    }
+    else if ((code_point >= 0xDC00) && (code_point <= 0xDFFF))
+    {
+        return(NX_AZURE_IOT_INVALID_PACKET);
+    }
+
+    return(nx_azure_iot_json_stream_reader_unicode_append(reader_ptr, code_point));
+}
+
+static UINT nx_azure_iot_json_stream_reader_number_end(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr)
+{
+    if ((reader_ptr -> sub_state != NX_AZURE_IOT_STREAM_NUMBER_ZERO) &&
+        (reader_ptr -> sub_state != NX_AZURE_IOT_STREAM_NUMBER_INTEGER) &&
+        (reader_ptr -> sub_state != NX_AZURE_IOT_STREAM_NUMBER_FRACTION) &&
+        (reader_ptr -> sub_state != NX_AZURE_IOT_STREAM_NUMBER_EXPONENT_DIGIT))
+    {
+        return(NX_AZURE_IOT_INVALID_PACKET);
+    }
+
+    nx_azure_iot_json_stream_reader_value_end(reader_ptr);
+
+    return(reader_ptr -> callback(reader_ptr -> callback_context, NX_AZURE_IOT_READER_TOKEN_NUMBER,
+                                  reader_ptr -> buffer_ptr, reader_ptr -> buffer_len));
+}
+
+static UINT nx_azure_iot_json_stream_reader_number_process(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                           UCHAR c)
+{
+UINT sub_state = reader_ptr -> sub_state;
+UINT next_state;
+UINT status;
+
+    if ((c >= '0') && (c <= '9'))
+    {
+        switch (sub_state)
+        {
+        case NX_AZURE_IOT_STREAM_NUMBER_MINUS:
+            next_state = (c == '0') ? NX_AZURE_IOT_STREAM_NUMBER_ZERO : NX_AZURE_IOT_STREAM_NUMBER_INTEGER;
+            break;
+        case NX_AZURE_IOT_STREAM_NUMBER_INTEGER:
+            next_state = NX_AZURE_IOT_STREAM_NUMBER_INTEGER;
+            break;
+        case NX_AZURE_IOT_STREAM_NUMBER_DOT:
+        case NX_AZURE_IOT_STREAM_NUMBER_FRACTION:
+            next_state = NX_AZURE_IOT_STREAM_NUMBER_FRACTION;
+            break;
+        case NX_AZURE_IOT_STREAM_NUMBER_EXPONENT:
+        case NX_AZURE_IOT_STREAM_NUMBER_EXPONENT_SIGN:
+        case NX_AZURE_IOT_STREAM_NUMBER_EXPONENT_DIGIT:
+            next_state = NX_AZURE_IOT_STREAM_NUMBER_EXPONENT_DIGIT;
+            break;
+        default:
+
+            /* Leading zero.  */
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+    }
+    else if ((c == '.') &&
+             ((sub_state == NX_AZURE_IOT_STREAM_NUMBER_ZERO) ||
+              (sub_state == NX_AZURE_IOT_STREAM_NUMBER_INTEGER)))
+    {
+        next_state = NX_AZURE_IOT_STREAM_NUMBER_DOT;
+    }
+    else if (((c == 'e') || (c == 'E')) &&
+             ((sub_state == NX_AZURE_IOT_STREAM_NUMBER_ZERO) ||
+              (sub_state == NX_AZURE_IOT_STREAM_NUMBER_INTEGER) ||
+              (sub_state == NX_AZURE_IOT_STREAM_NUMBER_FRACTION)))
+    {
+        next_state = NX_AZURE_IOT_STREAM_NUMBER_EXPONENT;
+    }
+    else if (((c == '+') || (c == '-')) &&
+             (sub_state == NX_AZURE_IOT_STREAM_NUMBER_EXPONENT))
+    {
+        next_state = NX_AZURE_IOT_STREAM_NUMBER_EXPONENT_SIGN;
+    }
+    else
+    {
+
+        /* The number is terminated by a character that belongs to the next token.  */
+        status = nx_azure_iot_json_stream_reader_number_end(reader_ptr);
+        if (status)
+        {
+            return(status);
+        }
+
+        return(nx_azure_iot_json_stream_reader_byte_process(reader_ptr, c));
+    }
+
+    reader_ptr -> sub_state = next_state;
+
+    return(nx_azure_iot_json_stream_reader_append(reader_ptr, &c, 1));
+}
+
+static UINT nx_azure_iot_json_stream_reader_byte_process(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                         UCHAR c)
+{
+    switch (reader_ptr -> state)
+    {
+    case NX_AZURE_IOT_STREAM_STATE_STRING:
+        return(nx_azure_iot_json_stream_reader_string_process(reader_ptr, c));
+
+    case NX_AZURE_IOT_STREAM_STATE_NUMBER:
+        return(nx_azure_iot_json_stream_reader_number_process(reader_ptr, c));
+
+    case NX_AZURE_IOT_STREAM_STATE_LITERAL:
+        if (reader_ptr -> literal_ptr[reader_ptr -> literal_index] != c)
+        {
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+
+        reader_ptr -> literal_index++;
+        if (reader_ptr -> literal_ptr[reader_ptr -> literal_index] != 0)
+        {
+            return(NX_AZURE_IOT_SUCCESS);
+        }
+
+        nx_azure_iot_json_stream_reader_value_end(reader_ptr);
+        return(reader_ptr -> callback(reader_ptr -> callback_context, reader_ptr -> token_type,
+                                      reader_ptr -> literal_ptr, reader_ptr -> literal_index));
+
+    default:
+        break;
+    }
+
+    /* Skip whitespace between tokens.  */
+    if ((c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'))
+    {
+        return(NX_AZURE_IOT_SUCCESS);
+    }
+
+    switch (reader_ptr -> state)
+    {
+    case NX_AZURE_IOT_STREAM_STATE_ARRAY_FIRST:
+        if (c == ']')
+        {
+            return(nx_azure_iot_json_stream_reader_container_end(reader_ptr, NX_FALSE));
+        }
+        return(nx_azure_iot_json_stream_reader_value_begin(reader_ptr, c));
+
+    case NX_AZURE_IOT_STREAM_STATE_VALUE:
+        return(nx_azure_iot_json_stream_reader_value_begin(reader_ptr, c));
+
+    case NX_AZURE_IOT_STREAM_STATE_OBJECT_FIRST:
+        if (c == '}')
+        {
+            return(nx_azure_iot_json_stream_reader_container_end(reader_ptr, NX_TRUE));
+        }
+
+        /* fallthrough */
+    case NX_AZURE_IOT_STREAM_STATE_NAME:
+        if (c != '"')
+        {
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+
+        reader_ptr -> buffer_len = 0;
+        reader_ptr -> token_type = NX_AZURE_IOT_READER_TOKEN_PROPERTY_NAME;
+        reader_ptr -> sub_state = NX_AZURE_IOT_STREAM_STRING_NORMAL;
+        reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_STRING;
+        return(NX_AZURE_IOT_SUCCESS);
+
+    case NX_AZURE_IOT_STREAM_STATE_COLON:
+        if (c != ':')
+        {
+            return(NX_AZURE_IOT_INVALID_PACKET);
+        }
+
+        reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_VALUE;
+        return(NX_AZURE_IOT_SUCCESS);
+
+    case NX_AZURE_IOT_STREAM_STATE_NEXT:
+        if (c == ',')
+        {
+            if (nx_azure_iot_json_stream_reader_top_is_object(reader_ptr))
+            {
+                reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_NAME;
+            }
+            else
+            {
+                reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_VALUE;
+            }
+            return(NX_AZURE_IOT_SUCCESS);
+        }
+
+        if ((c == '}') || (c == ']'))
+        {
+            return(nx_azure_iot_json_stream_reader_container_end(reader_ptr, (c == '}')));
+        }
+
+        return(NX_AZURE_IOT_INVALID_PACKET);
+
+    default:
+
+        /* Only whitespace may follow the top level value.  */
+        return(NX_AZURE_IOT_INVALID_PACKET);
+    }
+}
+
+UINT nx_azure_iot_json_stream_reader_init(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                          UCHAR *buffer_ptr, UINT buffer_size,
+                                          UINT (*callback)(VOID *context_ptr, UINT token_type,
+                                                           const UCHAR *text_ptr, UINT text_len),
+                                          VOID *context_ptr)
+{
+    if ((reader_ptr == NX_NULL) ||
+        (buffer_ptr == NX_NULL) || (buffer_size == 0) ||
+        (callback == NX_NULL))
+    {
+        return(NX_AZURE_IOT_INVALID_PARAMETER);
+    }
+
+    memset(reader_ptr, 0, sizeof(NX_AZURE_IOT_JSON_STREAM_READER));
+
+    reader_ptr -> callback = callback;
+    reader_ptr -> callback_context = context_ptr;
+    reader_ptr -> buffer_ptr = buffer_ptr;
+    reader_ptr -> buffer_size = buffer_size;
+    reader_ptr -> state = NX_AZURE_IOT_STREAM_STATE_VALUE;
+
+    return(NX_AZURE_IOT_SUCCESS);
+}
+
+UINT nx_azure_iot_json_stream_reader_feed(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                          const UCHAR *data_ptr, UINT data_len)
+{
+const UCHAR *end_ptr;
+const UCHAR *run_ptr;
+UINT status = NX_AZURE_IOT_SUCCESS;
+
+    if ((reader_ptr == NX_NULL) ||
+        ((data_ptr == NX_NULL) && (data_len != 0)))
+    {
+        return(NX_AZURE_IOT_INVALID_PARAMETER);
+    }
+
+    if (reader_ptr -> status)
+    {
+        return(reader_ptr -> status);
+    }
+
+    end_ptr = data_ptr + data_len;
+
+    while ((data_ptr < end_ptr) && (status == NX_AZURE_IOT_SUCCESS))
+    {
+
+        /* Copy runs of plain string characters at once rather than byte by byte.  */
+        if ((reader_ptr -> state == NX_AZURE_IOT_STREAM_STATE_STRING) &&
+            (reader_ptr -> sub_state == NX_AZURE_IOT_STREAM_STRING_NORMAL) &&
+            (reader_ptr -> high_surrogate == 0))
+        {
+            run_ptr = data_ptr;
+            while ((run_ptr < end_ptr) && (*run_ptr >= 0x20) &&
+                   (*run_ptr != '"') && (*run_ptr != '\\'))
+            {
+                run_ptr++;
+            }
+
+            if (run_ptr != data_ptr)
+            {
+                status = nx_azure_iot_json_stream_reader_append(reader_ptr, data_ptr,
+                                                                (UINT)(run_ptr - data_ptr));
+                data_ptr = run_ptr;
+                continue;
+            }
+        }
+
+        status = nx_azure_iot_json_stream_reader_byte_process(reader_ptr, *data_ptr);
+        data_ptr++;
+    }
+
+    reader_ptr -> status = status;
+
+    return(status);
+}
+
+UINT nx_azure_iot_json_stream_reader_packet_feed(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                 NX_PACKET *packet_ptr)
+{
+UINT status = NX_AZURE_IOT_SUCCESS;
+
+    if ((reader_ptr == NX_NULL) || (packet_ptr == NX_NULL))
+    {
+        return(NX_AZURE_IOT_INVALID_PARAMETER);
+    }
+
+    while ((packet_ptr != NX_NULL) && (status == NX_AZURE_IOT_SUCCESS))
+    {
+        status = nx_azure_iot_json_stream_reader_feed(reader_ptr, packet_ptr -> nx_packet_prepend_ptr,
+                                                      (UINT)(packet_ptr -> nx_packet_append_ptr -
+                                                             packet_ptr -> nx_packet_prepend_ptr));
+        packet_ptr = packet_ptr -> nx_packet_next;
+    }
+
+    return(status);
+}
+
+UINT nx_azure_iot_json_stream_reader_finish(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr)
+{
+    if (reader_ptr == NX_NULL)
+    {
+        return(NX_AZURE_IOT_INVALID_PARAMETER);
+    }
+
+    if (reader_ptr -> status)
+    {
+        return(reader_ptr -> status);
+    }
+
+    /* A top level number is only terminated by the end of the text.  */
+    if (reader_ptr -> state == NX_AZURE_IOT_STREAM_STATE_NUMBER)
+    {
+        reader_ptr -> status = nx_azure_iot_json_stream_reader_number_end(reader_ptr);
+        if (reader_ptr -> status)
+        {
+            return(reader_ptr -> status);
+        }
+    }
+
+    if (reader_ptr -> state != NX_AZURE_IOT_STREAM_STATE_DONE)
+    {
+        reader_ptr -> status = NX_AZURE_IOT_INVALID_PACKET;
+    }
+
+    return(reader_ptr -> status);
+}
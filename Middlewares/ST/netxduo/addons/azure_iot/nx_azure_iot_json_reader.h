@@ -30,6 +30,10 @@ extern   "C" {
 #define NX_AZURE_IOT_READER_MAX_LIST                (15)
 #endif /* NX_AZURE_IOT_READER_MAX_LIST */
 
+#ifndef NX_AZURE_IOT_STREAM_READER_MAX_DEPTH
+#define NX_AZURE_IOT_STREAM_READER_MAX_DEPTH        (64)
+#endif /* NX_AZURE_IOT_STREAM_READER_MAX_DEPTH */
+
 /**
  * Defines symbols for the various kinds of JSON tokens that make up any JSON text.
  */
@@ -56,6 +60,30 @@ typedef struct NX_AZURE_IOT_READER_STRUCT
       az_span span_list[NX_AZURE_IOT_READER_MAX_LIST];
 } NX_AZURE_IOT_JSON_READER;
 
+/**
+ * @brief Tokenizes JSON text pushed to it in arbitrary fragments and reports every token to a
+ * callback (SAX style), without requiring the text to be contiguous in memory.
+ *
+ */
+typedef struct NX_AZURE_IOT_STREAM_READER_STRUCT
+{
+    UINT (*callback)(VOID *context_ptr, UINT token_type, const UCHAR *text_ptr, UINT text_len);
+    VOID *callback_context;
+    UCHAR *buffer_ptr;
+    UINT buffer_size;
+    UINT buffer_len;
+    UINT state;
+    UINT sub_state;
+    UINT token_type;
+    UINT status;
+    const UCHAR *literal_ptr;
+    UINT literal_index;
+    ULONG unicode_value;
+    ULONG high_surrogate;
+    UINT depth;
+    ULONG container_stack[(NX_AZURE_IOT_STREAM_READER_MAX_DEPTH + 31) / 32];
+} NX_AZURE_IOT_JSON_STREAM_READER;
+
 /**
  * @brief Initializes an #NX_AZURE_IOT_JSON_READER to read the JSON payload contained within the provided
  * buffer.
@@ -203,6 +231,71 @@ UINT nx_azure_iot_json_reader_token_is_text_equal(NX_AZURE_IOT_JSON_READER *read
  */
 UINT nx_azure_iot_json_reader_token_type(NX_AZURE_IOT_JSON_READER *reader_ptr);
 
+/**
+ * @brief Initializes an #NX_AZURE_IOT_JSON_STREAM_READER to tokenize JSON text fed incrementally.
+ *
+ * @param[out] reader_ptr A pointer to an #NX_AZURE_IOT_JSON_STREAM_READER instance to initialize.
+ * @param[in] buffer_ptr A pointer to a scratch buffer holding the current string or number token.
+ * @param[in] buffer_size Size of the scratch buffer, which bounds the longest unescaped token.
+ * @param[in] callback Function invoked for every token, in document order.
+ * @param[in] context_ptr Context passed back to the callback.
+ *
+ * @return An `UINT` value indicating the result of the operation.
+ * @retval #NX_AZURE_IOT_SUCCESS The #NX_AZURE_IOT_JSON_STREAM_READER is initialized successfully.
+ *
+ * @remarks The callback receives one of the `NX_AZURE_IOT_READER_TOKEN_*` types. Property names
+ * and strings are passed unescaped, numbers and literals as their JSON text, and structural tokens
+ * with a NULL text pointer. Text is only valid for the duration of the callback. Any return value
+ * other than #NX_AZURE_IOT_SUCCESS stops parsing and is returned by the feed function.
+ */
+UINT nx_azure_iot_json_stream_reader_init(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                          UCHAR *buffer_ptr, UINT buffer_size,
+                                          UINT (*callback)(VOID *context_ptr, UINT token_type,
+                                                           const UCHAR *text_ptr, UINT text_len),
+                                          VOID *context_ptr);
+
+/**
+ * @brief Feeds the next fragment of JSON text to an #NX_AZURE_IOT_JSON_STREAM_READER.
+ *
+ * @param[in] reader_ptr A pointer to an #NX_AZURE_IOT_JSON_STREAM_READER instance.
+ * @param[in] data_ptr A pointer to the JSON text fragment.
+ * @param[in] data_len Length of the fragment.
+ *
+ * @return An `UINT` value indicating the result of the operation.
+ * @retval #NX_AZURE_IOT_SUCCESS The fragment was tokenized successfully.
+ * @retval #NX_AZURE_IOT_INVALID_PACKET The JSON text is malformed.
+ * @retval #NX_AZURE_IOT_INSUFFICIENT_BUFFER_SPACE A token or the nesting depth exceeds the limits.
+ *
+ * @remarks Tokens may be split at any byte between fragments. Errors are sticky.
+ */
+UINT nx_azure_iot_json_stream_reader_feed(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                          const UCHAR *data_ptr, UINT data_len);
+
+/**
+ * @brief Feeds the JSON text contained within an #NX_PACKET chain to an #NX_AZURE_IOT_JSON_STREAM_READER.
+ *
+ * @param[in] reader_ptr A pointer to an #NX_AZURE_IOT_JSON_STREAM_READER instance.
+ * @param[in] packet_ptr A pointer to #NX_PACKET containing the next part of the JSON text.
+ *
+ * @return An `UINT` value indicating the result of the operation.
+ * @retval #NX_AZURE_IOT_SUCCESS The packet was tokenized successfully.
+ *
+ * @remarks Ownership of #NX_PACKET is not taken; it can be released as soon as this returns.
+ */
+UINT nx_azure_iot_json_stream_reader_packet_feed(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr,
+                                                 NX_PACKET *packet_ptr);
+
+/**
+ * @brief Signals the end of the JSON text to an #NX_AZURE_IOT_JSON_STREAM_READER.
+ *
+ * @param[in] reader_ptr A pointer to an #NX_AZURE_IOT_JSON_STREAM_READER instance.
+ *
+ * @return An `UINT` value indicating the result of the operation.
+ * @retval #NX_AZURE_IOT_SUCCESS The JSON text is complete and valid.
+ * @retval #NX_AZURE_IOT_INVALID_PACKET The JSON text is truncated or malformed.
+ */
+UINT nx_azure_iot_json_stream_reader_finish(NX_AZURE_IOT_JSON_STREAM_READER *reader_ptr);
+
 #ifdef __cplusplus
 }
 #endif
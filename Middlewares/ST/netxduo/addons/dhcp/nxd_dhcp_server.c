@@ -71,10 +71,18 @@ static UINT        _nx_dhcp_server_assign_ip_address(NX_DHCP_SERVER *dhcp_ptr, N
 static UINT        _nx_dhcp_find_interface_table_ip_address(NX_DHCP_SERVER *dhcp_ptr, UINT iface_index, ULONG ip_address, NX_DHCP_INTERFACE_IP_ADDRESS **return_interface_address);
 static UINT        _nx_dhcp_update_assignable_ip_address(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_CLIENT *dhcp_client_ptr, ULONG ip_address, UINT assign_status); 
 static UINT        _nx_dhcp_find_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface_owner, NX_DHCP_CLIENT *client_record_ptr, UINT *assigned_to_client);
-static UINT        _nx_dhcp_record_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface_owner, NX_DHCP_CLIENT *client_record_ptr, UINT lease_time);
-static UINT        _nx_dhcp_clear_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface_owner);
+static UINT        _nx_dhcp_record_ip_address_owner(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_INTERFACE_IP_ADDRESS *iface_owner, NX_DHCP_CLIENT *client_record_ptr, UINT lease_time);
+static UINT        _nx_dhcp_clear_ip_address_owner(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_INTERFACE_IP_ADDRESS *iface_owner);
+static UINT        _nx_dhcp_client_hash_index(ULONG client_mac_msw, ULONG client_mac_lsw);
+static VOID        _nx_dhcp_client_record_unlink(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_CLIENT *dhcp_client_ptr);
+static UINT        _nx_dhcp_free_map_search(ULONG *free_map, UINT map_bits);
+static VOID        _nx_dhcp_update_lease_timer(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_INTERFACE_IP_ADDRESS *iface_address_ptr);
 static VOID        _nx_dhcp_server_socket_receive_notify(NX_UDP_SOCKET *socket_ptr);
 
+/* Define macros to mark entries in the free client record and free IP address bitmaps.  */
+#define NX_DHCP_FREE_MAP_SET(map, index)     ((map)[(index) >> 5] |= ((ULONG)1 << ((index) & 31)))
+#define NX_DHCP_FREE_MAP_CLEAR(map, index)   ((map)[(index) >> 5] &= ~((ULONG)1 << ((index) & 31)))
+
 
 /* To enable dhcp server output, define TESTOUTPUT. */
 /* #define     TESTOUTPUT          1  */ 
@@ -173,8 +181,8 @@ UINT    status;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_server_create                              PORTABLE C      */  
-/*                                                           6.1          */
+/*    _nx_dhcp_server_create                              PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -224,6 +232,9 @@ UINT    status;
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), improved */
 /*                                            buffer length verification, */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            free client record bitmap,  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_dhcp_server_create(NX_DHCP_SERVER *dhcp_ptr, NX_IP *ip_ptr, VOID *stack_ptr, ULONG stack_size, 
@@ -278,6 +289,9 @@ UINT  i, j;
 
         /* Clear the client record. */
         memset(&dhcp_ptr -> client_records[i], 0, sizeof(NX_DHCP_CLIENT));
+
+        /* Mark the client record as available.  */
+        NX_DHCP_FREE_MAP_SET(dhcp_ptr -> nx_dhcp_client_record_free_map, i);
     }
 
     /* Verify the application has defined a server option list. */
@@ -845,8 +859,8 @@ UINT            status;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_create_server_ip_address_list              PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_create_server_ip_address_list              PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -900,6 +914,9 @@ UINT            status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            free address bitmap,        */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_dhcp_create_server_ip_address_list(NX_DHCP_SERVER *dhcp_ptr, UINT iface_index, 
@@ -966,8 +983,21 @@ NX_DHCP_INTERFACE_TABLE      *dhcp_interface_table_ptr;
         return(NX_DHCP_SERVER_BAD_INTERFACE_INDEX);
     }
 
-    /* Zero out the list size. */
+    /* Take any addresses of the previous list off the lease timer.  */
+    for (i = 0; i < NX_DHCP_IP_ADDRESS_MAX_LIST_SIZE; i++)
+    {
+
+        ip_address_entry_ptr = &dhcp_interface_table_ptr -> nx_dhcp_ip_address_list[i];
+        if (ip_address_entry_ptr -> nx_dhcp_lease_expire_tick)
+        {
+            ip_address_entry_ptr -> lease_time = 0;
+            _nx_dhcp_update_lease_timer(dhcp_ptr, ip_address_entry_ptr);
+        }
+    }
+
+    /* Zero out the list size and the free address bitmap. */
     dhcp_interface_table_ptr -> nx_dhcp_address_list_size = 0;
+    memset(dhcp_interface_table_ptr -> nx_dhcp_ip_address_free_map, 0, sizeof(dhcp_interface_table_ptr -> nx_dhcp_ip_address_free_map));
 
     /* Check for invalid list parameters. */
     if ((start_ip_address > end_ip_address) || !start_ip_address || !end_ip_address)
@@ -995,6 +1025,10 @@ NX_DHCP_INTERFACE_TABLE      *dhcp_interface_table_ptr;
 
         /* Add the next IP address to the list. */
         ip_address_entry_ptr -> nx_assignable_ip_address = next_ip_address;
+        ip_address_entry_ptr -> nx_dhcp_lease_iface_index = iface_index;
+
+        /* Mark the address as available.  */
+        NX_DHCP_FREE_MAP_SET(dhcp_interface_table_ptr -> nx_dhcp_ip_address_free_map, i);
 
         /* Increase the list size. */
         dhcp_interface_table_ptr -> nx_dhcp_address_list_size++;
@@ -1490,8 +1524,8 @@ UINT    current_preemption;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_server_thread_entry                        PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_server_thread_entry                        PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -1529,6 +1563,9 @@ UINT    current_preemption;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            lease timer wheel,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID  _nx_dhcp_server_thread_entry(ULONG info)
@@ -1536,10 +1573,9 @@ static VOID  _nx_dhcp_server_thread_entry(ULONG info)
 
 NX_DHCP_SERVER                  *dhcp_ptr;
 ULONG                           dhcp_events;
-NX_DHCP_INTERFACE_TABLE         *iface_table_ptr;
 NX_DHCP_INTERFACE_IP_ADDRESS    *iface_address_ptr;
 NX_DHCP_CLIENT                  *dhcp_client_ptr;
-UINT                            iface_index, i;
+UINT                            i;
 UINT                            status;
 NX_PACKET                       *packet_ptr;
 
@@ -1666,71 +1702,52 @@ NX_PACKET                       *packet_ptr;
         if (dhcp_events & NX_DHCP_SERVER_SLOW_PERIODIC_EVENT)
         {
 
-            for (iface_index = 0; iface_index < NX_MAX_PHYSICAL_INTERFACES; iface_index++)
-            {
+            /* Advance the lease timer and pick up the wheel slot of the addresses expiring on this tick. */
+            dhcp_ptr -> nx_dhcp_lease_tick++;
+            i = (UINT)(dhcp_ptr -> nx_dhcp_lease_tick & (NX_DHCP_LEASE_WHEEL_SIZE - 1));
 
-                /* Set a local pointer for convenience. */
-                iface_table_ptr = &dhcp_ptr -> nx_dhcp_interface_table[iface_index];
+            iface_address_ptr = dhcp_ptr -> nx_dhcp_lease_wheel[i];
+            while (iface_address_ptr)
+            {
 
-                /* Check the interface addresses in the table for lease expiration. */
-                for (i = 0; i < iface_table_ptr -> nx_dhcp_address_list_size; i++)
+                /* Skip addresses whose lease runs out on a later round of the wheel. */
+                if (iface_address_ptr -> nx_dhcp_lease_expire_tick != dhcp_ptr -> nx_dhcp_lease_tick)
                 {
+                    iface_address_ptr = iface_address_ptr -> nx_dhcp_lease_next;
+                    continue;
+                }
 
-                    iface_address_ptr = &iface_table_ptr -> nx_dhcp_ip_address_list[i];
-
-                    /* Skip all the entries who are not assigned or assigned indefinately (static). */ 
-                    if(iface_address_ptr -> assigned == NX_FALSE)
-                        continue;
-                    if(iface_address_ptr -> lease_time == TX_WAIT_FOREVER)
-                        continue;
-
-                    /* Check how much time is left before decreasing the time remaining on the lease timeout. */
-                    if (iface_address_ptr -> lease_time >= NX_DHCP_SLOW_PERIODIC_TIME_INTERVAL)
-                    {
-
-                        /* Ok to decrement the full amount. */
-                        iface_address_ptr -> lease_time -= NX_DHCP_SLOW_PERIODIC_TIME_INTERVAL;
-                    }
-                    else
-                    {
-
-                        /* Set to zero. Time's up! */
-                        iface_address_ptr -> lease_time = 0;
-                    }
-
-                    /* Has time expired on this lease? */
-                    if (iface_address_ptr -> lease_time == 0)
-                    {
-
-                        /* Yes, make this address available. */
-
-                        /* Clear the 'owner' field. */
-                        _nx_dhcp_clear_ip_address_owner(iface_address_ptr);
+                /* Time's up! Look up the client in the server database by its assigned address
+                   before the owner information is cleared. */
+                _nx_dhcp_find_client_record_by_ip_address(dhcp_ptr, &dhcp_client_ptr, 
+                                                          iface_address_ptr -> nx_dhcp_lease_iface_index, 
+                                                          iface_address_ptr -> nx_assignable_ip_address);
 
-                        /* Look up the client in the server database by its assigned address. */
-                        _nx_dhcp_find_client_record_by_ip_address(dhcp_ptr, &dhcp_client_ptr, iface_index, 
-                                                                  iface_address_ptr -> nx_assignable_ip_address);
+                /* Make this address available. This also takes it off the lease timer. */
+                _nx_dhcp_clear_ip_address_owner(dhcp_ptr, iface_address_ptr);
 
-                        /* Did we find it? */
-                        if (dhcp_client_ptr != NX_NULL)
-                        {
+                /* Did we find it? */
+                if (dhcp_client_ptr != NX_NULL)
+                {
 
-                            /* Remove the assigned IP address and reset the Client to the INIT state. */
-                            dhcp_client_ptr -> nx_dhcp_assigned_ip_address = NX_DHCP_NO_ADDRESS;
-                            dhcp_client_ptr -> nx_dhcp_client_state = NX_DHCP_STATE_INIT;
+                    /* Remove the assigned IP address and reset the Client to the INIT state. */
+                    dhcp_client_ptr -> nx_dhcp_assigned_ip_address = NX_DHCP_NO_ADDRESS;
+                    dhcp_client_ptr -> nx_dhcp_client_state = NX_DHCP_STATE_INIT;
 
 #ifdef EL_PRINTF_ENABLE
-                            EL_PRINTF("DHCPserv: client IP lease expired. Clear client data, release IP address\n");
+                    EL_PRINTF("DHCPserv: client IP lease expired. Clear client data, release IP address\n");
 #endif
 
-                            /* Clear all session data if there is any for this client. */
-                            _nx_dhcp_clear_client_session(dhcp_ptr, dhcp_client_ptr);
+                    /* Clear all session data if there is any for this client. */
+                    _nx_dhcp_clear_client_session(dhcp_ptr, dhcp_client_ptr);
 
-                            /* No, we should have this client in the server client records table but we don't. 
-                            That's all we can do right now. */
-                        }
-                    }
+                    /* No, we should have this client in the server client records table but we don't. 
+                    That's all we can do right now. */
                 }
+
+                /* Removing a client record may take other addresses off the wheel, so start over
+                   from the head of the slot. */
+                iface_address_ptr = dhcp_ptr -> nx_dhcp_lease_wheel[i];
             }
         }
     };
@@ -2201,8 +2218,8 @@ UINT status;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_clear_client_record                        PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_clear_client_record                        PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -2242,13 +2259,15 @@ UINT status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            client hash index,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_dhcp_clear_client_record(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_CLIENT *dhcp_client_ptr)
 {
 
-UINT                     i;
-NX_DHCP_INTERFACE_TABLE  *iface_table_ptr;
+NX_DHCP_INTERFACE_IP_ADDRESS *interface_address_ptr;
 
 
     if (dhcp_client_ptr == 0x0)
@@ -2260,34 +2279,21 @@ NX_DHCP_INTERFACE_TABLE  *iface_table_ptr;
     /* Obtain DHCP Server mutex protection,. */
     tx_mutex_get(&dhcp_ptr -> nx_dhcp_mutex, NX_WAIT_FOREVER);
 
-    /* Set local pointer for convenience. */
-    iface_table_ptr = &dhcp_ptr -> nx_dhcp_interface_table[dhcp_client_ptr -> nx_dhcp_client_iface_index];
-
-    i = 0;
+    /* Find the Client's assigned IP address in the server database. */
+    _nx_dhcp_find_interface_table_ip_address(dhcp_ptr, dhcp_client_ptr -> nx_dhcp_client_iface_index,
+                                             dhcp_client_ptr -> nx_dhcp_assigned_ip_address, &interface_address_ptr);
 
     /* Does the client have an assigned IP address? */
-    if (iface_table_ptr -> nx_dhcp_ip_address_list[i].nx_assignable_ip_address)
+    if (interface_address_ptr)
     {
-    
-        /* Yes, We need to free up the Client's assigned IP address in the server database. */
-        while (i < iface_table_ptr -> nx_dhcp_address_list_size)
-        {
-    
-            /* Find the interface table entry by matching IP address. */
-            if (iface_table_ptr -> nx_dhcp_ip_address_list[i].nx_assignable_ip_address == 
-                dhcp_client_ptr -> nx_dhcp_assigned_ip_address)
-            {
-
-                /* Clear the owner information.  */
-                _nx_dhcp_clear_ip_address_owner(&(iface_table_ptr -> nx_dhcp_ip_address_list[i]));
 
-                /* Address now available for DHCP client. */
-                break;
-            }
-            i++;
-        }
+        /* Yes, clear the owner information. Address now available for DHCP client. */
+        _nx_dhcp_clear_ip_address_owner(dhcp_ptr, interface_address_ptr);
     }
 
+    /* Remove the record from the hardware address index. */
+    _nx_dhcp_client_record_unlink(dhcp_ptr, dhcp_client_ptr);
+
     /* Ok to clear the Client record. */
     memset(dhcp_client_ptr, 0, sizeof(NX_DHCP_CLIENT));
 
@@ -3117,8 +3123,8 @@ ULONG           offset;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_find_client_record_by_ip_address           PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_find_client_record_by_ip_address           PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3157,19 +3163,52 @@ ULONG           offset;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            lookup by lease owner,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_dhcp_find_client_record_by_ip_address(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_CLIENT **dhcp_client_ptr, 
                                                UINT iface_index, ULONG assigned_ip_address)
 {
 
-UINT            i;
-NX_DHCP_CLIENT  *client_record_ptr;
+UINT                         i;
+NX_DHCP_CLIENT               *client_record_ptr;
+NX_DHCP_INTERFACE_IP_ADDRESS *interface_address_ptr;
 
 
     /* Initialize the search results to unsuccessful. */
     *dhcp_client_ptr = NX_NULL;
 
+    /* Look up the address in the interface table. */
+    _nx_dhcp_find_interface_table_ip_address(dhcp_ptr, iface_index, assigned_ip_address, &interface_address_ptr);
+
+    /* Is the address leased to a known hardware address? */
+    if (interface_address_ptr && (interface_address_ptr -> owner_mac_msw || interface_address_ptr -> owner_mac_lsw))
+    {
+
+        /* Yes, the lease owner is normally the client holding the address. Check its hash bucket first. */
+        client_record_ptr = dhcp_ptr -> nx_dhcp_client_hash[_nx_dhcp_client_hash_index(interface_address_ptr -> owner_mac_msw,
+                                                                                       interface_address_ptr -> owner_mac_lsw)];
+        while (client_record_ptr)
+        {
+
+            if ((client_record_ptr -> nx_dhcp_client_mac_msw == interface_address_ptr -> owner_mac_msw) &&
+                (client_record_ptr -> nx_dhcp_client_mac_lsw == interface_address_ptr -> owner_mac_lsw) &&
+                (client_record_ptr -> nx_dhcp_assigned_ip_address == assigned_ip_address) &&
+                (client_record_ptr -> nx_dhcp_client_iface_index == iface_index))
+            {
+
+                /* Return the client record location. */
+                *dhcp_client_ptr = client_record_ptr;
+
+                return(NX_SUCCESS);
+            }
+
+            client_record_ptr = client_record_ptr -> nx_dhcp_client_mac_next;
+        }
+    }
+
     i = 0;
 
     /* Records are not necessarily added and deleted sequentially, 
@@ -3218,8 +3257,8 @@ NX_DHCP_CLIENT  *client_record_ptr;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_find_client_record_by_chaddr               PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_find_client_record_by_chaddr               PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3260,43 +3299,32 @@ NX_DHCP_CLIENT  *client_record_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            client hash index,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_dhcp_find_client_record_by_chaddr(NX_DHCP_SERVER *dhcp_ptr, UINT iface_index, ULONG client_mac_msw, 
                                  ULONG client_mac_lsw, NX_DHCP_CLIENT **dhcp_client_ptr, UINT add_on)
 {
 
-UINT            i;
+UINT            hash_index;
 UINT            available_index;
 NX_DHCP_CLIENT  *client_record_ptr;
+NX_DHCP_CLIENT  *next_record_ptr;
 
 
     /* Initialize the search results to unsuccessful. */
     *dhcp_client_ptr = NX_NULL;
 
-    /* Initialize an available slot in the table as outside the boundary (e.g. no slots available). */
-    available_index = NX_DHCP_CLIENT_RECORD_TABLE_SIZE;
-
-    /* Records are not necessarily added and deleted sequentially, 
-       so search the whole table until a match is found. */
-    i = 0;
-    while (i < NX_DHCP_CLIENT_RECORD_TABLE_SIZE) 
+    /* Only records with this hardware address's hash can match, so search its bucket. */
+    hash_index = _nx_dhcp_client_hash_index(client_mac_msw, client_mac_lsw);
+    client_record_ptr = dhcp_ptr -> nx_dhcp_client_hash[hash_index];
+    while (client_record_ptr) 
     {
 
-        /* Set local pointer for convenience. */
-        client_record_ptr = &dhcp_ptr -> client_records[i];
-
-        /* Skip empty records. Assume a client with no mac address is empty. */
-        if ((client_record_ptr -> nx_dhcp_client_mac_msw == 0) && (client_record_ptr -> nx_dhcp_client_mac_lsw == 0))
-        {
-
-            /* Flag the first empty record in case we need to add the current client to the table. */
-            if (i < available_index)
-                available_index = i;
-
-            i++;
-            continue;
-        }
+        /* Save the next record, this one may be removed below. */
+        next_record_ptr = client_record_ptr -> nx_dhcp_client_mac_next;
 
         /* Check the mac address of each record for a match. */
         if ((client_record_ptr -> nx_dhcp_client_mac_msw == client_mac_msw) &&
@@ -3326,7 +3354,7 @@ NX_DHCP_CLIENT  *client_record_ptr;
             }
         }
 
-        i++;
+        client_record_ptr = next_record_ptr;
     }
 
     /* Not found. Create a record for this client? */
@@ -3342,6 +3370,7 @@ NX_DHCP_CLIENT  *client_record_ptr;
     }
 
     /* Check if there is available room in the table for a new client. */
+    available_index = _nx_dhcp_free_map_search(dhcp_ptr -> nx_dhcp_client_record_free_map, NX_DHCP_CLIENT_RECORD_TABLE_SIZE);
     if (available_index >= NX_DHCP_CLIENT_RECORD_TABLE_SIZE)
     {
 
@@ -3363,6 +3392,11 @@ NX_DHCP_CLIENT  *client_record_ptr;
     /* Initialize the client state as the init state. */
     client_record_ptr -> nx_dhcp_client_state = NX_DHCP_STATE_INIT;
 
+    /* Link the record into its hash bucket and mark the slot as used. */
+    client_record_ptr -> nx_dhcp_client_mac_next = dhcp_ptr -> nx_dhcp_client_hash[hash_index];
+    dhcp_ptr -> nx_dhcp_client_hash[hash_index] = client_record_ptr;
+    NX_DHCP_FREE_MAP_CLEAR(dhcp_ptr -> nx_dhcp_client_record_free_map, available_index);
+
     /* Return the location of the newly created client record. */
     *dhcp_client_ptr = client_record_ptr; 
 
@@ -3374,8 +3408,8 @@ NX_DHCP_CLIENT  *client_record_ptr;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_find_interface_table_ip_address            PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_find_interface_table_ip_address            PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3414,13 +3448,16 @@ NX_DHCP_CLIENT  *client_record_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            direct index lookup,        */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_dhcp_find_interface_table_ip_address(NX_DHCP_SERVER *dhcp_ptr, UINT iface_index, ULONG ip_address, 
                                               NX_DHCP_INTERFACE_IP_ADDRESS **return_interface_address)
 {
 
-UINT i;
+ULONG i;
 NX_DHCP_INTERFACE_TABLE *dhcp_interface_table_ptr;         
 
 
@@ -3430,19 +3467,19 @@ NX_DHCP_INTERFACE_TABLE *dhcp_interface_table_ptr;
     /* Set a local varible to the IP address list for this client. */
     dhcp_interface_table_ptr = &(dhcp_ptr -> nx_dhcp_interface_table[iface_index]);
 
-    /* Yes, search for an available ip address in the IP list for this interface */
-    for(i = 0; i < dhcp_interface_table_ptr -> nx_dhcp_address_list_size; i++)
-    {
+    /* The list holds a contiguous range of addresses, so the entry index is the offset of the
+       address from the start of the range. */
+    i = ip_address - dhcp_interface_table_ptr -> nx_dhcp_ip_address_list[0].nx_assignable_ip_address;
 
-        /* Is this address a match? */
-        if (dhcp_interface_table_ptr -> nx_dhcp_ip_address_list[i].nx_assignable_ip_address == ip_address)
-        {
-            /* Yes, set a pointer to the location and return. */
-            *return_interface_address =  &dhcp_interface_table_ptr -> nx_dhcp_ip_address_list[i];
+    /* Is this address in the list? */
+    if ((i < dhcp_interface_table_ptr -> nx_dhcp_address_list_size) &&
+        (dhcp_interface_table_ptr -> nx_dhcp_ip_address_list[i].nx_assignable_ip_address == ip_address))
+    {
+        /* Yes, set a pointer to the location and return. */
+        *return_interface_address =  &dhcp_interface_table_ptr -> nx_dhcp_ip_address_list[i];
 
-            /* And we're done! */
-            return(NX_SUCCESS);
-        }
+        /* And we're done! */
+        return(NX_SUCCESS);
     }
 
     /* Not found, so return null pointer and successful search status. */
@@ -3454,8 +3491,8 @@ NX_DHCP_INTERFACE_TABLE *dhcp_interface_table_ptr;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_update_assignable_ip_address               PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_update_assignable_ip_address               PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3506,6 +3543,9 @@ NX_DHCP_INTERFACE_TABLE *dhcp_interface_table_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            lease timer wheel,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_dhcp_update_assignable_ip_address(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_CLIENT *dhcp_client_ptr, 
@@ -3549,7 +3589,7 @@ NX_DHCP_INTERFACE_IP_ADDRESS    *interface_address_ptr;
         }
 
         /* Yes, clear the owner information.  */
-        _nx_dhcp_clear_ip_address_owner(interface_address_ptr);
+        _nx_dhcp_clear_ip_address_owner(dhcp_ptr, interface_address_ptr);
     }
 
     /* Was the IP address assigned externally from the DHCP process?  */
@@ -3561,6 +3601,13 @@ NX_DHCP_INTERFACE_IP_ADDRESS    *interface_address_ptr;
         { 
             /* If this already has a lease time (because we assigned it most likely) don't change it. */
             lease_time = interface_address_ptr -> lease_time; 
+
+            /* Carry over the time remaining on a lease running on the lease timer. */
+            if (interface_address_ptr -> nx_dhcp_lease_expire_tick)
+            {
+                lease_time = (UINT)((interface_address_ptr -> nx_dhcp_lease_expire_tick - dhcp_ptr -> nx_dhcp_lease_tick) * 
+                                    NX_DHCP_SLOW_PERIODIC_TIME_INTERVAL);
+            }
         }
         else
         {  
@@ -3569,7 +3616,7 @@ NX_DHCP_INTERFACE_IP_ADDRESS    *interface_address_ptr;
         }
 
         /*  Set the current client as the owner.  */
-        _nx_dhcp_record_ip_address_owner(interface_address_ptr, dhcp_client_ptr, lease_time);
+        _nx_dhcp_record_ip_address_owner(dhcp_ptr, interface_address_ptr, dhcp_client_ptr, lease_time);
     }
 
     /* Is the client informing us the IP address is already in use (e.g. it has
@@ -3583,13 +3630,13 @@ NX_DHCP_INTERFACE_IP_ADDRESS    *interface_address_ptr;
 
             /* Yes, remove the Client as owner of this IP lease.
                Record owner information with null 'owner' ID since we don't know who the owner is.  */
-            _nx_dhcp_record_ip_address_owner(interface_address_ptr, NX_NULL, NX_WAIT_FOREVER);
+            _nx_dhcp_record_ip_address_owner(dhcp_ptr, interface_address_ptr, NX_NULL, NX_WAIT_FOREVER);
         }
         else
         {
 
             /* Record owner information.  */
-            _nx_dhcp_record_ip_address_owner(interface_address_ptr, dhcp_client_ptr, NX_WAIT_FOREVER);
+            _nx_dhcp_record_ip_address_owner(dhcp_ptr, interface_address_ptr, dhcp_client_ptr, NX_WAIT_FOREVER);
         }
     }
     else
@@ -3676,8 +3723,8 @@ static UINT  _nx_dhcp_find_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface_
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_record_ip_address_owner                    PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_record_ip_address_owner                    PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3689,6 +3736,7 @@ static UINT  _nx_dhcp_find_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface_
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
+/*    dhcp_ptr                              Pointer to DHCP Server        */
 /*    iface_owner                           Pointer to table entry        */ 
 /*    client_record_ptr                     Pointer to DHCP client        */
 /*    lease_time                            Lease duration in secs        */
@@ -3699,7 +3747,7 @@ static UINT  _nx_dhcp_find_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface_
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    None                                                                */ 
+/*    _nx_dhcp_update_lease_timer           Schedule lease expiration     */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -3715,11 +3763,18 @@ static UINT  _nx_dhcp_find_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface_
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            free address bitmap and     */
+/*                                            lease timer wheel,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static UINT  _nx_dhcp_record_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface_owner, NX_DHCP_CLIENT *client_record_ptr, UINT lease_time)
+static UINT  _nx_dhcp_record_ip_address_owner(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_INTERFACE_IP_ADDRESS *iface_owner, NX_DHCP_CLIENT *client_record_ptr, UINT lease_time)
 {
 
+NX_DHCP_INTERFACE_TABLE *iface_table_ptr;
+
+
     /* Check the client_record_ptr.  */
     if (client_record_ptr)
     {
@@ -3744,6 +3799,14 @@ static UINT  _nx_dhcp_record_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *ifac
     /* Set the assigned status.  */
     iface_owner -> assigned = NX_TRUE;
 
+    /* Remove the address from the free address bitmap.  */
+    iface_table_ptr = &dhcp_ptr -> nx_dhcp_interface_table[iface_owner -> nx_dhcp_lease_iface_index];
+    NX_DHCP_FREE_MAP_CLEAR(iface_table_ptr -> nx_dhcp_ip_address_free_map, 
+                           (UINT)(iface_owner - iface_table_ptr -> nx_dhcp_ip_address_list));
+
+    /* Schedule the lease expiration.  */
+    _nx_dhcp_update_lease_timer(dhcp_ptr, iface_owner);
+
     /* Return.  */
     return(NX_SUCCESS);
 }
@@ -3753,8 +3816,8 @@ static UINT  _nx_dhcp_record_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *ifac
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_clear_ip_address_owner                     PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_clear_ip_address_owner                     PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3765,6 +3828,7 @@ static UINT  _nx_dhcp_record_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *ifac
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
+/*    dhcp_ptr                              Pointer to DHCP Server        */
 /*    iface_owner                           Pointer to table entry        */
 /*                                                                        */ 
 /*  OUTPUT                                                                */ 
@@ -3773,7 +3837,7 @@ static UINT  _nx_dhcp_record_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *ifac
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    None                                                                */
+/*    _nx_dhcp_update_lease_timer           Schedule lease expiration     */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -3791,11 +3855,18 @@ static UINT  _nx_dhcp_record_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *ifac
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            free address bitmap and     */
+/*                                            lease timer wheel,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static UINT  _nx_dhcp_clear_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface_owner)
+static UINT  _nx_dhcp_clear_ip_address_owner(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_INTERFACE_IP_ADDRESS *iface_owner)
 {
 
+NX_DHCP_INTERFACE_TABLE *iface_table_ptr;
+
+
     /* Clear the owner information.  */
     iface_owner -> owner_hwtype = 0;
     iface_owner -> owner_mac_msw = 0;
@@ -3807,11 +3878,346 @@ static UINT  _nx_dhcp_clear_ip_address_owner(NX_DHCP_INTERFACE_IP_ADDRESS *iface
     /* Clear the assigned status.  */
     iface_owner -> assigned = NX_FALSE;
 
+    /* Return the address to the free address bitmap.  */
+    iface_table_ptr = &dhcp_ptr -> nx_dhcp_interface_table[iface_owner -> nx_dhcp_lease_iface_index];
+    NX_DHCP_FREE_MAP_SET(iface_table_ptr -> nx_dhcp_ip_address_free_map, 
+                         (UINT)(iface_owner - iface_table_ptr -> nx_dhcp_ip_address_list));
+
+    /* Take the address off the lease timer.  */
+    _nx_dhcp_update_lease_timer(dhcp_ptr, iface_owner);
+
     /* Return.  */
     return(NX_SUCCESS);
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dhcp_client_hash_index                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the client record hash bucket index for the  */
+/*    specified client hardware address.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_mac_msw                        MSB of client hardware address*/
+/*    client_mac_lsw                        LSB of client hardware address*/
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                                 Hash bucket index             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_dhcp_find_client_record_by_chaddr Find client record by MAC     */
+/*    _nx_dhcp_find_client_record_by_ip_address                           */
+/*                                          Find client record by IP      */
+/*    _nx_dhcp_client_record_unlink         Remove record from hash index */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT  _nx_dhcp_client_hash_index(ULONG client_mac_msw, ULONG client_mac_lsw)
+{
+
+ULONG hash;
+
+
+    /* Fold the vendor specific low bits of the hardware address into the bucket index. */
+    hash = client_mac_lsw ^ (client_mac_lsw >> 8) ^ (client_mac_lsw >> 16) ^ (client_mac_lsw >> 24) ^ client_mac_msw;
+
+    /* Return the hash bucket index.  */
+    return((UINT)(hash & (NX_DHCP_CLIENT_HASH_SIZE - 1)));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dhcp_client_record_unlink                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the specified client record from its hardware */
+/*    address hash bucket and marks the record slot as available.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    dhcp_ptr                              Pointer to DHCP Server        */
+/*    dhcp_client_ptr                       Pointer to DHCP client        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dhcp_client_hash_index            Compute hash bucket index     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_dhcp_clear_client_record          Clear Client record           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID  _nx_dhcp_client_record_unlink(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_CLIENT *dhcp_client_ptr)
+{
+
+NX_DHCP_CLIENT **record_link_ptr;
+
+
+    /* Empty records are not in the index. */
+    if ((dhcp_client_ptr -> nx_dhcp_client_mac_msw == 0) && (dhcp_client_ptr -> nx_dhcp_client_mac_lsw == 0))
+    {
+        return;
+    }
+
+    /* Search the bucket for the link to this record. */
+    record_link_ptr = &dhcp_ptr -> nx_dhcp_client_hash[_nx_dhcp_client_hash_index(dhcp_client_ptr -> nx_dhcp_client_mac_msw,
+                                                                                  dhcp_client_ptr -> nx_dhcp_client_mac_lsw)];
+    while (*record_link_ptr)
+    {
+
+        if (*record_link_ptr == dhcp_client_ptr)
+        {
+
+            /* Unlink the record. */
+            *record_link_ptr = dhcp_client_ptr -> nx_dhcp_client_mac_next;
+            break;
+        }
+
+        record_link_ptr = &((*record_link_ptr) -> nx_dhcp_client_mac_next);
+    }
+
+    dhcp_client_ptr -> nx_dhcp_client_mac_next = NX_NULL;
+
+    /* Mark the record slot as available.  */
+    NX_DHCP_FREE_MAP_SET(dhcp_ptr -> nx_dhcp_client_record_free_map, (UINT)(dhcp_client_ptr - dhcp_ptr -> client_records));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dhcp_free_map_search                            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the index of the first set bit in the         */
+/*    specified free record or free address bitmap.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    free_map                              Pointer to bitmap             */
+/*    map_bits                              Number of bits in use         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                                 Index of first free entry, or */
+/*                                          map_bits if none is free      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_dhcp_find_client_record_by_chaddr Find client record by MAC     */
+/*    _nx_dhcp_server_assign_ip_address     Assign an IP address to the   */
+/*                                          current client                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT  _nx_dhcp_free_map_search(ULONG *free_map, UINT map_bits)
+{
+
+UINT  i;
+UINT  bit;
+ULONG word;
+
+
+    /* Skip 32 entries at a time until a word with a free entry is found. */
+    for (i = 0; i < map_bits; i += 32)
+    {
+
+        word = free_map[i >> 5];
+        if (word == 0)
+        {
+            continue;
+        }
+
+        /* Locate the lowest free entry in this word. */
+        bit = 0;
+        while ((word & ((ULONG)1 << bit)) == 0)
+        {
+            bit++;
+        }
+
+        /* Entries beyond the bitmap size are never marked free. */
+        if ((i + bit) < map_bits)
+        {
+            return(i + bit);
+        }
+
+        break;
+    }
+
+    /* No free entry. */
+    return(map_bits);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dhcp_update_lease_timer                         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function (re)schedules the lease expiration of the specified   */
+/*    IP address on the lease timer wheel. The address is taken off the   */
+/*    wheel first, then put back in the slot of the slow periodic tick its*/
+/*    lease expires on if it is assigned with a finite lease time.        */
+/*                                                                        */
+/*    Each wheel slot holds the addresses whose expiration tick maps to   */
+/*    it, so the slow periodic event only visits the addresses in one     */
+/*    slot instead of every address in every interface table.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    dhcp_ptr                              Pointer to DHCP Server        */
+/*    iface_address_ptr                     Pointer to table entry        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_dhcp_create_server_ip_address_list                              */
+/*                                          Create server IP address list */
+/*    _nx_dhcp_record_ip_address_owner      Set Client as IP address owner*/
+/*    _nx_dhcp_clear_ip_address_owner       Clear IP address owner        */
+/*    _nx_dhcp_server_assign_ip_address     Assign an IP address to the   */
+/*                                          current client                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID  _nx_dhcp_update_lease_timer(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_INTERFACE_IP_ADDRESS *iface_address_ptr)
+{
+
+ULONG                        expire_tick;
+NX_DHCP_INTERFACE_IP_ADDRESS **slot_ptr;
+
+
+    /* Is the address on the wheel?  */
+    if (iface_address_ptr -> nx_dhcp_lease_expire_tick)
+    {
+
+        /* Yes, unlink it from its slot.  */
+        if (iface_address_ptr -> nx_dhcp_lease_previous)
+        {
+            iface_address_ptr -> nx_dhcp_lease_previous -> nx_dhcp_lease_next = iface_address_ptr -> nx_dhcp_lease_next;
+        }
+        else
+        {
+            dhcp_ptr -> nx_dhcp_lease_wheel[iface_address_ptr -> nx_dhcp_lease_expire_tick & (NX_DHCP_LEASE_WHEEL_SIZE - 1)] = 
+                iface_address_ptr -> nx_dhcp_lease_next;
+        }
+
+        if (iface_address_ptr -> nx_dhcp_lease_next)
+        {
+            iface_address_ptr -> nx_dhcp_lease_next -> nx_dhcp_lease_previous = iface_address_ptr -> nx_dhcp_lease_previous;
+        }
+
+        iface_address_ptr -> nx_dhcp_lease_next = NX_NULL;
+        iface_address_ptr -> nx_dhcp_lease_previous = NX_NULL;
+        iface_address_ptr -> nx_dhcp_lease_expire_tick = 0;
+    }
+
+    /* Static and unassigned addresses do not expire.  */
+    if ((iface_address_ptr -> assigned == NX_FALSE) || (iface_address_ptr -> lease_time == 0) || 
+        (iface_address_ptr -> lease_time == NX_WAIT_FOREVER))
+    {
+        return;
+    }
+
+    /* Compute the slow periodic tick the lease runs out on, rounding up to a whole interval. */
+    expire_tick = iface_address_ptr -> lease_time / NX_DHCP_SLOW_PERIODIC_TIME_INTERVAL;
+    if (iface_address_ptr -> lease_time % NX_DHCP_SLOW_PERIODIC_TIME_INTERVAL)
+    {
+        expire_tick++;
+    }
+    expire_tick += dhcp_ptr -> nx_dhcp_lease_tick;
+
+    /* Zero marks an address that is not on the wheel; expire a tick late on wrap around.  */
+    if (expire_tick == 0)
+    {
+        expire_tick = 1;
+    }
+
+    /* Link the address at the head of its slot.  */
+    iface_address_ptr -> nx_dhcp_lease_expire_tick = expire_tick;
+    slot_ptr = &dhcp_ptr -> nx_dhcp_lease_wheel[expire_tick & (NX_DHCP_LEASE_WHEEL_SIZE - 1)];
+    iface_address_ptr -> nx_dhcp_lease_next = *slot_ptr;
+    if (*slot_ptr)
+    {
+        (*slot_ptr) -> nx_dhcp_lease_previous = iface_address_ptr;
+    }
+    *slot_ptr = iface_address_ptr;
+}
+
+
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
@@ -4534,8 +4940,8 @@ NX_DHCP_INTERFACE_TABLE *dhcp_interface_table_ptr;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dhcp_server_assign_ip_address                   PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dhcp_server_assign_ip_address                   PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -4589,6 +4995,9 @@ NX_DHCP_INTERFACE_TABLE *dhcp_interface_table_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            free address bitmap,        */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_dhcp_server_assign_ip_address(NX_DHCP_SERVER *dhcp_ptr, NX_DHCP_CLIENT *dhcp_client_ptr)
@@ -4656,6 +5065,7 @@ UINT                            lease_time;
 
                     /* Renew the lease time. */
                     interface_address_ptr -> lease_time = lease_time;
+                    _nx_dhcp_update_lease_timer(dhcp_ptr, interface_address_ptr);
 
                     /* Set the Your IP address field for the server response message. */
                     dhcp_client_ptr -> nx_dhcp_your_ip_address = interface_address_ptr -> nx_assignable_ip_address;
@@ -4721,24 +5131,17 @@ UINT                            lease_time;
         /* Set a local varible to the IP address list for this client. */
         dhcp_interface_table_ptr = &(dhcp_ptr -> nx_dhcp_interface_table[dhcp_client_ptr -> nx_dhcp_client_iface_index]);
     
-        /* Yes, search for an available ip address in the IP list for this interface */
-        for(i = 0; i < dhcp_interface_table_ptr -> nx_dhcp_address_list_size; i++)
+        /* Yes, pick the first available ip address in the IP list for this interface */
+        i = _nx_dhcp_free_map_search(dhcp_interface_table_ptr -> nx_dhcp_ip_address_free_map, 
+                                     dhcp_interface_table_ptr -> nx_dhcp_address_list_size);
+        if (i < dhcp_interface_table_ptr -> nx_dhcp_address_list_size)
         {
-    
-            /* Set a local pointer variable to the next address. */
-            interface_address_ptr = &dhcp_interface_table_ptr -> nx_dhcp_ip_address_list[i];
-    
-            /* Is this address assigned already? */
-            if (interface_address_ptr -> assigned == NX_FALSE)
-            {
 
-                /* No, but it is now! */
-
-                /* Indicate the search was successful. */
-                assigned_ip = NX_TRUE;
+            /* Set a local pointer variable to the address. It is not assigned yet, but it is now! */
+            interface_address_ptr = &dhcp_interface_table_ptr -> nx_dhcp_ip_address_list[i];
 
-                break;
-            }
+            /* Indicate the search was successful. */
+            assigned_ip = NX_TRUE;
         }
 
         /* Check if we were able to find an available IP address. */
@@ -4772,7 +5175,7 @@ UINT                            lease_time;
     {
 
         /* Set the client as the IP address owner in the server interface table. */
-        _nx_dhcp_record_ip_address_owner(interface_address_ptr, dhcp_client_ptr, lease_time);
+        _nx_dhcp_record_ip_address_owner(dhcp_ptr, interface_address_ptr, dhcp_client_ptr, lease_time);
 
         /* Set the client's assigned IP address. */
         dhcp_client_ptr -> nx_dhcp_assigned_ip_address = interface_address_ptr -> nx_assignable_ip_address;
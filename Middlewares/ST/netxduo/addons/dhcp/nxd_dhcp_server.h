@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */  
 /*                                                                        */   
 /*    nxd_dhcp_server.h                                   PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -49,6 +49,11 @@
 /*                                            improved buffer length      */
 /*                                            verification,               */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            client hash index, free     */
+/*                                            address bitmap and lease    */
+/*                                            timer wheel,                */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -229,11 +234,31 @@ extern   "C" {
 
 #ifndef NX_DHCP_CLIENT_RECORD_TABLE_SIZE
 #define NX_DHCP_CLIENT_RECORD_TABLE_SIZE      50 
+#endif
+
+/* Define the number of hash buckets used to look up client records by hardware address.
+   This must be a power of two. */
+
+#ifndef NX_DHCP_CLIENT_HASH_SIZE
+#define NX_DHCP_CLIENT_HASH_SIZE              32
+#endif
+
+/* Define the number of slots in the IP lease timer wheel. Each slot covers one slow periodic
+   time interval; leases further out than the wheel stay in their slot until their round
+   comes up. This must be a power of two. */
+
+#ifndef NX_DHCP_LEASE_WHEEL_SIZE
+#define NX_DHCP_LEASE_WHEEL_SIZE              64
 #endif
 
     /* END OF CONFIGURABLE OPTIONS */
 
 
+/* Define the number of words in the free client record and free IP address bitmaps. */
+#define NX_DHCP_CLIENT_RECORD_MAP_SIZE        ((NX_DHCP_CLIENT_RECORD_TABLE_SIZE + 31) / 32)
+#define NX_DHCP_IP_ADDRESS_MAP_SIZE           ((NX_DHCP_IP_ADDRESS_MAX_LIST_SIZE + 31) / 32)
+
+
 /* Define the size of the BOOT buffer. This should be large enough for all the
    required DHCP fields plus the minimum requirement of 312 bytes of option data
    stated in RFC 2131; 2. Protocol Summary. */
@@ -454,6 +479,8 @@ typedef struct NX_DHCP_CLIENT_STRUCT
     ULONG           nx_dhcp_session_timeout;     /* Time out on waiting for client's next response */
     UINT            nx_dhcp_response_type_to_client; 
                                                  /* DHCP code for response to send back to client. */
+    struct NX_DHCP_CLIENT_STRUCT
+                   *nx_dhcp_client_mac_next;     /* Next client record in the same hardware address hash bucket. */
 
 } NX_DHCP_CLIENT;
 
@@ -467,6 +494,12 @@ typedef struct NX_DHCP_INTERFACE_IP_ADDRESS_STRUCT
     UINT            owner_hwtype;                   /* Hardware type.  */
     UINT            owner_mac_msw;                  /* MAC address high bits.  */
     UINT            owner_mac_lsw;                  /* MAC address low bits.  */
+    UINT            nx_dhcp_lease_iface_index;      /* Server interface table this address belongs to. */
+    ULONG           nx_dhcp_lease_expire_tick;      /* Lease timer tick the lease expires on, zero if not on the wheel. */
+    struct NX_DHCP_INTERFACE_IP_ADDRESS_STRUCT
+                   *nx_dhcp_lease_next;             /* Next address in the same lease timer wheel slot. */
+    struct NX_DHCP_INTERFACE_IP_ADDRESS_STRUCT
+                   *nx_dhcp_lease_previous;         /* Previous address in the same lease timer wheel slot. */
 } NX_DHCP_INTERFACE_IP_ADDRESS;
 
 
@@ -482,6 +515,8 @@ typedef struct NX_DHCP_INTERFACE_TABLE_STRUCT
     ULONG           nx_dhcp_subnet;                 /* DHCP server interface subnet. */
     ULONG           nx_dhcp_router_ip_address;      /* The router IP Address for DHCP client configuration  */
     UINT            nx_dhcp_address_list_size;      /* Actual number of assignable addresses for this interface. */
+    ULONG           nx_dhcp_ip_address_free_map[NX_DHCP_IP_ADDRESS_MAP_SIZE];
+                                                    /* Bitmap of addresses in the list not assigned to any host. */
 
 } NX_DHCP_INTERFACE_TABLE;
 
@@ -504,6 +539,14 @@ typedef struct NX_DHCP_SERVER_STRUCT
     TX_EVENT_FLAGS_GROUP nx_dhcp_server_events;     /* DHCP Server events. */
     UINT            nx_dhcp_number_clients;         /* Number of clients currently assigned IP address by this server. */
     NX_DHCP_CLIENT  client_records[NX_DHCP_CLIENT_RECORD_TABLE_SIZE];   /* Table of DHCP clients.*/
+    NX_DHCP_CLIENT *nx_dhcp_client_hash[NX_DHCP_CLIENT_HASH_SIZE];  
+                                                    /* Client records hashed by hardware address. */
+    ULONG           nx_dhcp_client_record_free_map[NX_DHCP_CLIENT_RECORD_MAP_SIZE];
+                                                    /* Bitmap of empty slots in the client record table. */
+    NX_DHCP_INTERFACE_IP_ADDRESS 
+                   *nx_dhcp_lease_wheel[NX_DHCP_LEASE_WHEEL_SIZE];
+                                                    /* Assigned addresses hashed by lease expiration tick. */
+    ULONG           nx_dhcp_lease_tick;             /* Number of slow periodic intervals elapsed. */
                                                     /* List of IP addresses server can assign to DHCP Clients */
     NX_UDP_SOCKET   nx_dhcp_socket;                 /* DHCP server socket to receive DHCP messages on its interfaces. */
     UINT            nx_dhcp_server_options[NX_DHCP_SERVER_OPTION_LIST_SIZE]; 
@@ -43,6 +43,14 @@
 #define NX_DNS_RR_AUTHORITY_SECTION     2
 #define NX_DNS_RR_ADDITIONAL_SECTION    3
 
+#ifdef NX_DNS_CACHE_ENABLE
+/* Define the class of the cached negative answer, the name or the type does not exist.  */
+#define NX_DNS_RR_CLASS_NEGATIVE        0xFFFF
+
+/* Define the IP version marking a name of the host list known not to exist.  */
+#define NX_DNS_HOST_LIST_NEGATIVE       0xFFFFFFFF
+#endif /* NX_DNS_CACHE_ENABLE  */
+
 /* Internal DNS functions. */  
 static UINT        _nx_dns_header_create(UCHAR *buffer_ptr, USHORT id, USHORT flags);
 static UINT        _nx_dns_new_packet_create(NX_DNS *dns_ptr, NX_PACKET *packet_ptr, UCHAR *name, USHORT type);
@@ -62,6 +70,8 @@ static UINT        _nx_dns_number_to_ascii_convert(UINT number, CHAR *buffstring
 #endif /* NX_DISABLE_IPV4 */
 static UINT        _nx_dns_host_resource_data_by_name_get(NX_DNS *dns_ptr, UCHAR *host_name, UCHAR *record_buffer, UINT buffer_size, 
                                                           UINT *record_count, UINT lookup_type, ULONG wait_option);
+static UINT        _nx_dns_host_resource_data_query(NX_DNS *dns_ptr, UCHAR *host_name, UCHAR *record_buffer, UINT buffer_size, 
+                                                    UINT *record_count, UINT lookup_type, ULONG wait_option);
 static UINT        _nx_dns_response_receive(NX_DNS *dns_ptr, NX_PACKET **packet_ptr, ULONG wait_option);
 static UINT        _nx_dns_response_process(NX_DNS *dns_ptr, UCHAR *host_name, NX_PACKET *packet_ptr, UCHAR *record_buffer, UINT buffer_size, UINT *record_count);
 static UINT        _nx_dns_process_a_type(NX_DNS *dns_ptr, NX_PACKET *packet_ptr, UCHAR *data_ptr, UCHAR **buffer_prepend_ptr, UCHAR **buffer_append_ptr, UINT *record_count, UINT rr_location);
@@ -86,6 +96,8 @@ static UINT        _nx_dns_cache_delete_rr_string(NX_DNS *dns_ptr, VOID *cache_p
 static UINT        _nx_dns_cache_add_string(NX_DNS *dns_ptr, VOID *cache_ptr, UINT cache_size, VOID *string_ptr, UINT string_size, VOID **insert_ptr);
 static UINT        _nx_dns_cache_delete_string(NX_DNS *dns_ptr, VOID *cache_ptr, UINT cache_size, VOID *string_ptr, UINT string_len);  
 static UINT        _nx_dns_resource_time_to_live_get(UCHAR *resource, NX_PACKET *packet_ptr, ULONG *rr_ttl);
+static UINT        _nx_dns_cache_hash_index(UCHAR *name, USHORT type);
+static VOID        _nx_dns_cache_negative_add(NX_DNS *dns_ptr, UCHAR *host_name, NX_PACKET *packet_ptr);
 #endif /* NX_DNS_CACHE_ENABLE  */
 
 #ifdef FEATURE_NX_IPV6
@@ -114,6 +126,7 @@ UCHAR lookup_end[] =  "IN-ADDR.ARPA";
 
 #ifdef NX_DNS_CACHE_ENABLE  
 static NX_DNS_RR   temp_rr;
+static UCHAR       prefetch_name_buffer[NX_DNS_NAME_MAX + 1];
 #endif /* NX_DNS_CACHE_ENABLE  */
 
 static UCHAR       temp_string_buffer[NX_DNS_NAME_MAX + 1];
@@ -2554,6 +2567,446 @@ UINT        record_count = 0;
     /* Return status.  */
     return(status);
 }     
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxde_dns_host_by_name_list_get                     PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the DNS get host list by name    */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    dns_ptr                               Pointer to DNS instance       */
+/*    host_name_list                        List of host names to resolve */
+/*    host_address_list                     List of destination of host   */
+/*                                            IP addresses                */
+/*    host_count                            Number of host names          */
+/*    wait_option                           Timeout value                 */
+/*    lookup_type                           Lookup for which IP version   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_dns_host_by_name_list_get        Actual DNS get host list by   */
+/*                                            name function               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxde_dns_host_by_name_list_get(NX_DNS *dns_ptr, UCHAR **host_name_list, NXD_ADDRESS *host_address_list,
+                                      UINT host_count, ULONG wait_option, UINT lookup_type)
+{
+
+UINT    status;
+UINT    i;
+
+
+    /* Check for invalid pointer input.  */
+    if ((dns_ptr == NX_NULL) || (host_name_list == NX_NULL) || (host_address_list == NX_NULL))
+        return(NX_PTR_ERROR);
+
+    /* Check each host name.  */
+    for (i = 0; i < host_count; i++)
+    {
+        if (host_name_list[i] == NX_NULL)
+            return(NX_PTR_ERROR);
+    }
+
+    /* Check for invalid non pointer input. */
+    if ((dns_ptr -> nx_dns_id != NX_DNS_ID) || (lookup_type == 0) || (host_count == 0))
+    {
+        return NX_DNS_PARAM_ERROR;
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual DNS get host list by name service.  */
+    status =  _nxd_dns_host_by_name_list_get(dns_ptr, host_name_list, host_address_list, host_count, wait_option, lookup_type);
+
+    /* Return status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_dns_host_by_name_list_get                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resolves a list of host names to IPv4 or IPv6         */
+/*    addresses. Answers in the cache are used first. The other names are */
+/*    queried on one socket, keeping up to NX_DNS_MAX_OUTSTANDING_QUERIES */
+/*    queries in flight and matching the responses by transmit ID. Names  */
+/*    left without answer are queried again on the next server, and on    */
+/*    each retry with the timeout doubled. The wait option is the time to */
+/*    wait for the next response. Addresses of the names not resolved are */
+/*    cleared.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    dns_ptr                               Pointer to DNS instance       */
+/*    host_name_list                        List of host names to resolve */
+/*    host_address_list                     List of destination of host   */
+/*                                            IP addresses                */
+/*    host_count                            Number of host names          */
+/*    wait_option                           Timeout value                 */
+/*    lookup_type                           Lookup for which IP version   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dns_cache_find_answer             Find the answer in the cache  */
+/*    _nx_dns_new_packet_create             Create new DNS packet         */
+/*    _nx_dns_response_process              Process the DNS response      */
+/*    _nx_dns_network_to_short_convert      Convert to unsigned short     */
+/*    tx_mutex_get                          Get DNS protection mutex      */
+/*    tx_mutex_put                          Release DNS protection mutex  */
+/*    nx_packet_allocate                    Allocate a new packet         */
+/*    nx_packet_release                     Release the packet            */
+/*    nx_udp_socket_bind                    Bind DNS UDP socket to port   */
+/*    nx_udp_socket_unbind                  Unbind DNS UDP socket         */
+/*    nxd_udp_socket_send                   Send the DNS query            */
+/*    nx_udp_socket_receive                 Receive DNS response          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxd_dns_host_by_name_list_get(NX_DNS *dns_ptr, UCHAR **host_name_list, NXD_ADDRESS *host_address_list,
+                                     UINT host_count, ULONG wait_option, UINT lookup_type)
+{
+
+UINT        status;
+UINT        record_type;
+UINT        record_size;
+UINT        record_count;
+UINT        retries;
+UINT        server_index;
+UINT        next_host;
+UINT        outstanding;
+UINT        done_count = 0;
+UINT        resolved_count = 0;
+UINT        i;
+USHORT      query_id[NX_DNS_MAX_OUTSTANDING_QUERIES];
+UINT        query_host[NX_DNS_MAX_OUTSTANDING_QUERIES];
+NX_PACKET   *packet_ptr;
+ULONG       start_time;
+ULONG       elapsed_time;
+ULONG       time_remaining;
+USHORT      response_id;
+
+
+    /* Get the record type and size for the IP version. If no type is specified default to AAAA type. */
+    if ((lookup_type == NX_IP_VERSION_V6) || (lookup_type == 0))
+    {
+
+#ifdef FEATURE_NX_IPV6
+        record_type = NX_DNS_RR_TYPE_AAAA;
+        record_size = 16;
+        lookup_type = NX_IP_VERSION_V6;
+#else
+        return NX_DNS_IPV6_NOT_SUPPORTED;
+#endif
+    }
+    else if (lookup_type == NX_IP_VERSION_V4)
+    {
+
+#ifndef NX_DISABLE_IPV4
+        record_type = NX_DNS_RR_TYPE_A;
+        record_size = sizeof(ULONG);
+#else
+        return NX_DNS_BAD_ADDRESS_ERROR;
+#endif
+    }
+    else
+    {
+        return NX_DNS_BAD_ADDRESS_ERROR;
+    }
+
+    /* Get the protection mutex to make sure no other thread interferes.  */
+    status =  tx_mutex_get(&(dns_ptr -> nx_dns_mutex), wait_option);
+
+    /* Check status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        /* The mutex was not granted in the time specified.  Return the threadx error.  */
+        return(status);
+    }
+
+    /* Clear the addresses, and get the answers already in the cache.  */
+    for (i = 0; i < host_count; i++)
+    {
+
+        memset(&host_address_list[i], 0, sizeof(NXD_ADDRESS));
+
+#ifdef NX_DNS_CACHE_ENABLE
+        record_count = 0;
+        status = _nx_dns_cache_find_answer(dns_ptr, dns_ptr -> nx_dns_cache, host_name_list[i], (USHORT)record_type,
+                                           (UCHAR *)&(host_address_list[i].nxd_ip_address), record_size, &record_count);
+        if ((status == NX_DNS_SUCCESS) && record_count)
+        {
+
+            /* Have recorded the address, set the IP version.  */
+            host_address_list[i].nxd_ip_version = lookup_type;
+            resolved_count++;
+            done_count++;
+        }
+        else if (status == NX_DNS_QUERY_FAILED)
+        {
+
+            /* The name is known not to exist, do not query it.  */
+            host_address_list[i].nxd_ip_version = NX_DNS_HOST_LIST_NEGATIVE;
+            done_count++;
+        }
+#endif /* NX_DNS_CACHE_ENABLE  */
+    }
+
+    if (done_count < host_count)
+    {
+
+        /* Determine if there is at least one DNS server. Is there anything in the first slot? */
+        if (dns_ptr -> nx_dns_server_ip_array[0].nxd_ip_version == 0)
+        {
+
+            /* No, this means the list is empty. Release the DNS Client lock. */
+            tx_mutex_put(&dns_ptr -> nx_dns_mutex);
+
+            /* At least one DNS server is required - return an error.  */
+            return(NX_DNS_NO_SERVER);
+        }
+
+        /* Bind the UDP socket to random port, all the queries of the list share it.  */
+        status =  nx_udp_socket_bind(&(dns_ptr -> nx_dns_socket), NX_ANY_PORT, TX_WAIT_FOREVER);
+
+        /* Check status.  */
+        if (status != TX_SUCCESS)
+        {
+
+            /* Release the DNS Client lock.  */
+            tx_mutex_put(&dns_ptr -> nx_dns_mutex);
+            return(status);
+        }
+
+        /* Limit the timeout to NX_DNS_MAX_RETRANS_TIMEOUT.  */
+        if (wait_option > NX_DNS_MAX_RETRANS_TIMEOUT)
+        {
+            wait_option = NX_DNS_MAX_RETRANS_TIMEOUT;
+        }
+
+        /* Keep sending the unanswered queries to all DNS Servers till the retry count expires.  */
+        for (retries = 0; (retries < dns_ptr -> nx_dns_retries) && (done_count < host_count); retries++)
+        {
+
+            for (server_index = 0; (server_index < NX_DNS_MAX_SERVERS) && (done_count < host_count) &&
+                 (dns_ptr -> nx_dns_server_ip_array[server_index].nxd_ip_version != 0); server_index++)
+            {
+
+                /* Start from the first host name.  */
+                next_host = 0;
+                outstanding = 0;
+                time_remaining = wait_option;
+
+                for (;;)
+                {
+
+                    /* Keep up to NX_DNS_MAX_OUTSTANDING_QUERIES queries in flight.  */
+                    while ((outstanding < NX_DNS_MAX_OUTSTANDING_QUERIES) && (next_host < host_count))
+                    {
+
+                        /* Skip the names already answered.  */
+                        if (host_address_list[next_host].nxd_ip_version != 0)
+                        {
+                            next_host++;
+                            continue;
+                        }
+
+                        /* Allocate a packet.  */
+                        status =  nx_packet_allocate(dns_ptr -> nx_dns_packet_pool_ptr, &packet_ptr, NX_UDP_PACKET, NX_DNS_PACKET_ALLOCATE_TIMEOUT);
+
+                        /* Check the allocate status.  */
+                        if (status != NX_SUCCESS)
+                        {
+
+                            /* Wait for the outstanding queries to free packets.  */
+                            break;
+                        }
+
+                        /* Create a request, and send it out.  */
+                        status =  _nx_dns_new_packet_create(dns_ptr, packet_ptr, host_name_list[next_host], (USHORT)record_type);
+                        if (status == NX_SUCCESS)
+                        {
+                            status =  nxd_udp_socket_send(&dns_ptr -> nx_dns_socket, packet_ptr, &dns_ptr -> nx_dns_server_ip_array[server_index], NX_DNS_PORT);
+                        }
+
+                        /* Check the completion of the send.  */
+                        if (status != NX_SUCCESS)
+                        {
+
+                            /* Unsuccessful, release the packet and try the next name.  */
+                            nx_packet_release(packet_ptr);
+                            next_host++;
+                            continue;
+                        }
+
+                        /* Record the outstanding query.  */
+                        query_id[outstanding] = dns_ptr -> nx_dns_transmit_id;
+                        query_host[outstanding] = next_host;
+                        outstanding++;
+                        next_host++;
+                    }
+
+                    /* Check whether any query is still waiting for the response.  */
+                    if ((outstanding == 0) || (time_remaining == 0))
+                    {
+                        break;
+                    }
+
+                    /* Receive udp packet. */
+                    start_time = tx_time_get();
+                    status = nx_udp_socket_receive(&(dns_ptr -> nx_dns_socket), &packet_ptr, time_remaining);
+                    elapsed_time = tx_time_get() - start_time;
+
+                    /* Check status.  */
+                    if (status != NX_SUCCESS)
+                    {
+
+                        /* Timed out, move on to the next server.  */
+                        break;
+                    }
+
+                    /* Find the outstanding query this response is for.  */
+                    i = outstanding;
+                    if (packet_ptr -> nx_packet_length >= sizeof(USHORT))
+                    {
+                        response_id = _nx_dns_network_to_short_convert(packet_ptr -> nx_packet_prepend_ptr + NX_DNS_ID_OFFSET);
+                        for (i = 0; i < outstanding; i++)
+                        {
+                            if (query_id[i] == response_id)
+                                break;
+                        }
+                    }
+
+                    if (i == outstanding)
+                    {
+
+                        /* Not for us. Discard the packet and keep waiting for the time remaining.  */
+                        nx_packet_release(packet_ptr);
+                        if (time_remaining > elapsed_time)
+                            time_remaining -= elapsed_time;
+                        else
+                            time_remaining = 0;
+                        continue;
+                    }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+                    if (packet_ptr -> nx_packet_next)
+                    {
+
+                        /* Chained packet is not supported. */
+                        nx_packet_release(packet_ptr);
+                        status = NX_INVALID_PACKET;
+                    }
+                    else
+#endif /* NX_DISABLE_PACKET_CHAIN */
+                    {
+
+                        /* Process the response as the answer of this query.  */
+                        dns_ptr -> nx_dns_transmit_id = query_id[i];
+                        dns_ptr -> nx_dns_lookup_type = (USHORT)record_type;
+                        record_count = 0;
+                        status = _nx_dns_response_process(dns_ptr, host_name_list[query_host[i]], packet_ptr,
+                                                          (UCHAR *)&(host_address_list[query_host[i]].nxd_ip_address), record_size, &record_count);
+                    }
+
+                    /* Record_count being set indicates the query gets a valid answer. */
+                    if ((status == NX_SUCCESS) && record_count)
+                    {
+
+                        /* Have recorded the address, set the IP version.  */
+                        host_address_list[query_host[i]].nxd_ip_version = lookup_type;
+                        resolved_count++;
+                        done_count++;
+                    }
+
+                    /* The query is complete. A name without answer is queried again on the next server.  */
+                    outstanding--;
+                    query_id[i] = query_id[outstanding];
+                    query_host[i] = query_host[outstanding];
+
+                    /* Restart the timeout for the queries still outstanding.  */
+                    time_remaining = wait_option;
+                }
+            }
+
+            /* Timed out for querying all DNS servers in this cycle, double the timeout, limited to NX_DNS_MAX_RETRANS_TIMEOUT.  */
+            if (wait_option <= (NX_DNS_MAX_RETRANS_TIMEOUT >> 1))
+                wait_option =  (wait_option << 1);
+            else
+                wait_option =  NX_DNS_MAX_RETRANS_TIMEOUT;
+        }
+
+        /* Unbind the socket.  */
+        nx_udp_socket_unbind(&(dns_ptr -> nx_dns_socket));
+    }
+
+    /* Clear the addresses of the names not resolved.  */
+    for (i = 0; i < host_count; i++)
+    {
+        if (host_address_list[i].nxd_ip_version != lookup_type)
+        {
+            memset(&host_address_list[i], 0, sizeof(NXD_ADDRESS));
+        }
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&dns_ptr -> nx_dns_mutex);
+
+    /* Check whether all the names are resolved.  */
+    if (resolved_count == host_count)
+        return(NX_SUCCESS);
+    else
+        return(NX_DNS_QUERY_FAILED);
+}
                                             
                      
 #ifdef NX_DNS_ENABLE_EXTENDED_RR_TYPES 
@@ -3879,8 +4332,8 @@ UINT        record_count = 0;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dns_host_resource_data_by_name_get               PORTABLE C     */ 
-/*                                                           6.1.5        */
+/*    _nx_dns_host_resource_data_by_name_get               PORTABLE C     */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3909,13 +4362,11 @@ UINT        record_count = 0;
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    _nx_dns_send_query_get_rdata_by_name                                */
-/*                                          Creates and transmits a DNS   */ 
-/*                                            query on supplied host name */
+/*    _nx_dns_cache_find_answer             Find the answer in the cache  */
+/*    _nx_dns_host_resource_data_query      Send the query to the DNS     */
+/*                                            servers                     */
 /*    tx_mutex_get                          Get DNS protection mutex      */ 
 /*    tx_mutex_put                          Release DNS protection mutex  */ 
-/*    nx_udp_socket_bind                    Bind DNS UDP socket to port   */ 
-/*    nx_udp_socket_unbind                  Unbind DNS UDP socket         */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -3935,6 +4386,10 @@ UINT        record_count = 0;
 /*                                            improved the logic of       */
 /*                                            receiving dns response,     */
 /*                                            resulting in version 6.1.5  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            negative cache check, moved */
+/*                                            server queries to a helper, */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_dns_host_resource_data_by_name_get(NX_DNS *dns_ptr, UCHAR *host_name, 
@@ -3943,8 +4398,6 @@ static UINT  _nx_dns_host_resource_data_by_name_get(NX_DNS *dns_ptr, UCHAR *host
 {
 
 UINT        status;
-UINT        retries;
-UINT        i;
 
 
     /* Get the protection mutex to make sure no other thread interferes.  */
@@ -3968,23 +4421,104 @@ UINT        i;
 #ifdef NX_DNS_CACHE_ENABLE
 
     /* Find the answer in local cache.  */
-    if(_nx_dns_cache_find_answer(dns_ptr, dns_ptr -> nx_dns_cache, host_name, (USHORT)lookup_type, buffer, buffer_size, record_count) == NX_DNS_SUCCESS)
+    status = _nx_dns_cache_find_answer(dns_ptr, dns_ptr -> nx_dns_cache, host_name, (USHORT)lookup_type, buffer, buffer_size, record_count);
+
+    /* Check whether the cache has the answer, or knows the name or the type does not exist.  */
+    if ((status == NX_DNS_SUCCESS) || (status == NX_DNS_QUERY_FAILED))
     {           
 
         /* Put the DNS mutex.  */
         tx_mutex_put(&dns_ptr -> nx_dns_mutex);
 
-        return (NX_DNS_SUCCESS);
+        return(status);
     }
 #endif /*NX_DNS_CACHE_ENABLE.  */
 
-    /* Determine if there is at least one DNS server. Is there anything in the first slot? */
-    if (dns_ptr -> nx_dns_server_ip_array[0].nxd_ip_version == 0)
+    /* Send the query to the DNS servers.  */
+    status = _nx_dns_host_resource_data_query(dns_ptr, host_name, buffer, buffer_size, record_count, lookup_type, wait_option);
+
+    /* No need to release mutex for non-blocking query in progress since
+       _nx_dns_response_get will receive the response and release the resource.  */
+    if ((wait_option != NX_NO_WAIT) || (status != NX_IN_PROGRESS))
     {
 
-        /* No, this means the list is empty. Release the DNS Client lock. */
+        /* Release protection.  */
         tx_mutex_put(&dns_ptr -> nx_dns_mutex);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dns_host_resource_data_query                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends the query of the host name to the DNS servers   */
+/*    in the client list. If a DNS server responds but does not have the  */
+/*    answer, this function skips to the next server. Otherwise it will   */
+/*    resend the same query up to the DNS client's max retry times before */
+/*    skipping to the next server. The caller holds the DNS mutex.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    dns_ptr                               Pointer to DNS instance       */
+/*    host_name                             Name of host to resolve       */
+/*    record_buffer                         Buffer for resource data      */
+/*    buffer_size                           Buffer size for resource data */
+/*    record_count                          The count of resource data    */
+/*    lookup_type                           The DNS query type            */
+/*    wait_option                           Timeout value                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dns_send_query_get_rdata_by_name                                */
+/*                                          Creates and transmits a DNS   */
+/*                                            query on supplied host name */
+/*    nx_udp_socket_bind                    Bind DNS UDP socket to port   */
+/*    nx_udp_socket_unbind                  Unbind DNS UDP socket         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_dns_host_resource_data_by_name_get                              */
+/*                                          Get resource data by name     */
+/*    _nx_dns_cache_prefetch                Prefetch the cache            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT  _nx_dns_host_resource_data_query(NX_DNS *dns_ptr, UCHAR *host_name, 
+                                              UCHAR *buffer, UINT buffer_size, 
+                                              UINT *record_count, UINT lookup_type, ULONG wait_option)
+{
+
+UINT        status;
+UINT        retries;
+UINT        i;
+
 
+    /* Determine if there is at least one DNS server. Is there anything in the first slot? */
+    if (dns_ptr -> nx_dns_server_ip_array[0].nxd_ip_version == 0)
+    {
+
+        /* No, this means the list is empty.  */
         /* At least one DNS server is required - return an error.  */
         return(NX_DNS_NO_SERVER);
     }        
@@ -3995,9 +4529,6 @@ UINT        i;
     /* Check status.  */
     if (status != TX_SUCCESS)
     {
-
-        /* Release the DNS Client lock.  */
-        tx_mutex_put(&dns_ptr -> nx_dns_mutex);
         return(status);
     }
 
@@ -4028,9 +4559,6 @@ UINT        i;
                 /* Unbind the socket.  */
                 nx_udp_socket_unbind(&(dns_ptr -> nx_dns_socket));
 
-                /* Release the mutex */
-                tx_mutex_put(&dns_ptr -> nx_dns_mutex);
-
                 /* Yes, have done, just return success.  */
                 return NX_SUCCESS;
             }  
@@ -4045,7 +4573,7 @@ UINT        i;
                     if (status == NX_IN_PROGRESS)
                     {
 
-                        /* No need to release mutex and unbind the socket for non-blocking since
+                        /* No need to unbind the socket for non-blocking since
                            _nx_dns_response_get will receive the response and release the resource.  */
                         return(status);
                     }
@@ -4055,9 +4583,6 @@ UINT        i;
                         /* Unbind the socket.  */
                         nx_udp_socket_unbind(&(dns_ptr -> nx_dns_socket));
 
-                        /* Release the mutex */
-                        tx_mutex_put(&dns_ptr -> nx_dns_mutex);
-
                         return(status);
                     }
                 }
@@ -4074,9 +4599,6 @@ UINT        i;
     /* Unbind the socket.  */
     nx_udp_socket_unbind(&(dns_ptr -> nx_dns_socket));
 
-    /* Release protection.  */
-    tx_mutex_put(&dns_ptr -> nx_dns_mutex);
-
     /* Failed on all servers, return DNS lookup failed status.  */
     return(NX_DNS_QUERY_FAILED);
 }
@@ -4855,7 +5377,7 @@ ULONG               time_remaining;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _nx_dns_response_process                             PORTABLE C     */
-/*                                                           6.1.5        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -4913,6 +5435,9 @@ ULONG               time_remaining;
 /*                                            improved the logic of       */
 /*                                            receiving dns response,     */
 /*                                            resulting in version 6.1.5  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            negative caching,           */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_dns_response_process(NX_DNS *dns_ptr, UCHAR *host_name, NX_PACKET *packet_ptr, 
@@ -4934,6 +5459,9 @@ UINT                answer_found = NX_FALSE;
 UINT                resource_size;
 UINT                name_size;
 UINT                host_name_size;
+#ifdef NX_DNS_CACHE_ENABLE
+UINT                rcode;
+#endif /* NX_DNS_CACHE_ENABLE  */
 
     /* Set the buffer pointer.  */
     buffer_prepend_ptr = record_buffer;
@@ -4969,12 +5497,27 @@ UINT                host_name_size;
     if ((status & NX_DNS_ERROR_MASK) == NX_DNS_ERROR_MASK)
     {
 
+#ifdef NX_DNS_CACHE_ENABLE
+
+        /* Cache the negative answer if the name does not exist (NXDOMAIN).  */
+        if (((status & NX_DNS_RCODE_MASK) == NX_DNS_RCODE_NAME_ERR) && (NX_DNS_CACHE_NEGATIVE_TTL_MAX > 0))
+        {
+            _nx_dns_cache_negative_add(dns_ptr, host_name, packet_ptr);
+        }
+#endif /* NX_DNS_CACHE_ENABLE  */
+
         /* Release the source packet.  */
         nx_packet_release(packet_ptr);
 
         return NX_DNS_SERVER_AUTH_ERROR;
     }
 
+#ifdef NX_DNS_CACHE_ENABLE
+
+    /* Remember the response code for negative caching.  */
+    rcode = status & NX_DNS_RCODE_MASK;
+#endif /* NX_DNS_CACHE_ENABLE  */
+
     /* Determine if we have any 'answers' to our DNS query. */
     answerRRCount = _nx_dns_network_to_short_convert(packet_ptr -> nx_packet_prepend_ptr + NX_DNS_ANCOUNT_OFFSET);
     answerCount = answerRRCount;
@@ -5188,6 +5731,17 @@ UINT                host_name_size;
             data_ptr += resource_size;
         }  
     }
+
+#ifdef NX_DNS_CACHE_ENABLE
+
+    /* Cache the negative answer only if the complete response has no record of the type (NODATA).
+       A response that failed to process is not a negative answer.  */
+    if ((answer_found == NX_FALSE) && (NX_DNS_CACHE_NEGATIVE_TTL_MAX > 0) &&
+        (rcode == NX_DNS_RCODE_SUCCESS) && (status == NX_SUCCESS))
+    {
+        _nx_dns_cache_negative_add(dns_ptr, host_name, packet_ptr);
+    }
+#endif /* NX_DNS_CACHE_ENABLE  */
     
     /* Release the packet.  */ 
     nx_packet_release(packet_ptr);
@@ -9415,8 +9969,8 @@ UINT    status;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dns_cache_initialize                           PORTABLE C       */ 
-/*                                                           6.1          */
+/*    _nx_dns_cache_initialize                           PORTABLE C       */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -9451,6 +10005,9 @@ UINT    status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            hash index,                 */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_dns_cache_initialize(NX_DNS *dns_ptr, VOID *cache_ptr, UINT cache_size)
@@ -9466,6 +10023,9 @@ ALIGN_TYPE *tail;
     /* Zero out the cache. */
     memset(cache_ptr, 0, cache_size);
 
+    /* Clear the hash index.  */
+    memset(dns_ptr -> nx_dns_cache_hash, 0, sizeof(dns_ptr -> nx_dns_cache_hash));
+
     /* Set the head. */
     head = (ALIGN_TYPE*)cache_ptr;
     *head = (ALIGN_TYPE)((ALIGN_TYPE*)cache_ptr + 1);
@@ -9744,13 +10304,202 @@ UINT _nx_dns_cache_notify_clear(NX_DNS *dns_ptr)
 #endif /* NX_DNS_CACHE_ENABLE  */
 
 
+#ifdef NX_DNS_CACHE_ENABLE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_dns_cache_prefetch                             PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the DNS cache prefetch function  */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    dns_ptr                           Pointer to DNS instance           */
+/*    wait_option                       Timeout value                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dns_cache_prefetch            Actual cache prefetch function    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_dns_cache_prefetch(NX_DNS *dns_ptr, ULONG wait_option)
+{
+
+UINT    status;
+
+
+    /* Check for invalid input pointers.  */
+    if (!dns_ptr)
+    {    
+        return(NX_PTR_ERROR);
+    }
+        
+    /* Check for invalid non pointer input. The queries are blocking.  */
+    if ((dns_ptr -> nx_dns_id != NX_DNS_ID) || (wait_option == NX_NO_WAIT))
+    {
+        return(NX_DNS_PARAM_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual DNS cache prefetch function.  */
+    status =  _nx_dns_cache_prefetch(dns_ptr, wait_option);
+
+    /* Return status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dns_cache_prefetch                              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function queries again the address records in the cache that   */
+/*    have been used since they were cached and will expire within        */
+/*    NX_DNS_CACHE_PREFETCH_TIME seconds, so popular names stay in the    */
+/*    cache. The application calls it periodically.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    dns_ptr                           Pointer to DNS instance           */
+/*    wait_option                       Timeout value                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dns_host_resource_data_query  Query the DNS servers             */
+/*    _nx_utility_string_length_check   Check string length               */
+/*    tx_mutex_get                      Get the DNS mutex                 */
+/*    tx_mutex_put                      Put the DNS mutex                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_dns_cache_prefetch(NX_DNS *dns_ptr, ULONG wait_option)
+{
+
+ALIGN_TYPE  *head;
+NX_DNS_RR   *p;
+ULONG       elapsed_ttl;
+UINT        name_length;
+UINT        record_count;
+USHORT      record_type;
+ULONG       record_buffer[16];
+UINT        status;
+
+
+    /* Get the DNS mutex.  */
+    status = tx_mutex_get(&(dns_ptr -> nx_dns_mutex), wait_option);
+
+    /* Check status.  */
+    if (status != TX_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Check the cache.  */
+    if (dns_ptr -> nx_dns_cache == NX_NULL)
+    {
+
+        /* Release the DNS mutex.  */
+        tx_mutex_put(&(dns_ptr -> nx_dns_mutex));
+        return(NX_DNS_CACHE_ERROR);
+    }
+
+    /* Lookup the cache for the address records about to expire.  */
+    for(p = (NX_DNS_RR*)(dns_ptr -> nx_dns_cache + sizeof(ALIGN_TYPE)); ; p++)
+    {
+
+        /* Get head, the queries may move it.  */
+        head = (ALIGN_TYPE*)(dns_ptr -> nx_dns_cache);
+        head = (ALIGN_TYPE*)(*head);
+        if ((ALIGN_TYPE*)p >= head)
+            break;
+
+        /* Only refresh the address records that have been used since they were cached.  */
+        if ((p -> nx_dns_rr_name == NX_NULL) || (p -> nx_dns_rr_hit_count == 0) ||
+            (p -> nx_dns_rr_class == NX_DNS_RR_CLASS_NEGATIVE) ||
+            ((p -> nx_dns_rr_type != NX_DNS_RR_TYPE_A) && (p -> nx_dns_rr_type != NX_DNS_RR_TYPE_AAAA)))
+            continue;
+
+        /* Calculate the remaining time to live. Expired records are left to the next lookup.  */
+        elapsed_ttl = (tx_time_get() - p -> nx_dns_rr_last_used_time) / NX_IP_PERIODIC_RATE;
+        if ((elapsed_ttl >= p -> nx_dns_rr_ttl) ||
+            ((p -> nx_dns_rr_ttl - elapsed_ttl) > NX_DNS_CACHE_PREFETCH_TIME))
+            continue;
+
+        /* Copy the name, since the record may be replaced by the answers.  */
+        if (_nx_utility_string_length_check((CHAR *)(p -> nx_dns_rr_name), &name_length, NX_DNS_NAME_MAX))
+            continue;
+        memcpy(prefetch_name_buffer, p -> nx_dns_rr_name, name_length + 1); /* Use case of memcpy is verified. */
+        record_type = p -> nx_dns_rr_type;
+
+        /* Clear the hit count, the record is prefetched again only if it is used again.  */
+        p -> nx_dns_rr_hit_count = 0;
+
+        /* Query the DNS servers. The answers refresh the time to live of the cached records.  */
+        record_count = 0;
+        _nx_dns_host_resource_data_query(dns_ptr, prefetch_name_buffer, (UCHAR *)record_buffer, sizeof(record_buffer),
+                                         &record_count, record_type, wait_option);
+    }
+
+    /* Release the DNS mutex.  */
+    tx_mutex_put(&(dns_ptr -> nx_dns_mutex));
+
+    return(NX_DNS_SUCCESS);
+}
+#endif /* NX_DNS_CACHE_ENABLE  */
+
+
 #ifdef NX_DNS_CACHE_ENABLE
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dns_cache_add_rr                                PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dns_cache_add_rr                                PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -9780,6 +10529,10 @@ UINT _nx_dns_cache_notify_clear(NX_DNS *dns_ptr)
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            hash index and refresh of   */
+/*                                            duplicate records,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_dns_cache_add_rr(NX_DNS *dns_ptr, VOID *cache_ptr, UINT cache_size, NX_DNS_RR *record_ptr, NX_DNS_RR **insert_ptr)
@@ -9789,9 +10542,13 @@ ALIGN_TYPE  *tail;
 ALIGN_TYPE  *head;
 NX_DNS_RR   *p;
 NX_DNS_RR   *rr;       
+NX_DNS_RR   *next_ptr;
+NX_DNS_RR   **bucket_ptr;
 ULONG       elapsed_time;
 ULONG       current_time;
 ULONG       max_elapsed_time;
+UINT        index;
+UINT        same_rdata;
                             
                                    
     /* Check the cache.  */
@@ -9802,6 +10559,50 @@ ULONG       max_elapsed_time;
     max_elapsed_time = 0;
     current_time = tx_time_get();
 
+    /* Get the hash bucket of the record.  */
+    index = _nx_dns_cache_hash_index(record_ptr -> nx_dns_rr_name, record_ptr -> nx_dns_rr_type);
+
+    /* Look for the cached records of the same name and type. The same names share one string.  */
+    for (p = dns_ptr -> nx_dns_cache_hash[index]; p != NX_NULL; p = next_ptr)
+    {
+
+        /* Get the next record first, since this one may be deleted.  */
+        next_ptr = p -> nx_dns_rr_hash_next;
+
+        if ((p -> nx_dns_rr_name != record_ptr -> nx_dns_rr_name) ||
+            (p -> nx_dns_rr_type != record_ptr -> nx_dns_rr_type))
+            continue;
+
+        /* A positive answer replaces a negative one, and the other way round.  */
+        if (p -> nx_dns_rr_class != record_ptr -> nx_dns_rr_class)
+        {
+            _nx_dns_cache_delete_rr(dns_ptr, cache_ptr, cache_size, p);
+            continue;
+        }
+
+        /* Compare the resource data. IPv6 addresses are strings in the cache, compare the address.  */
+        if ((p -> nx_dns_rr_class != NX_DNS_RR_CLASS_NEGATIVE) && (p -> nx_dns_rr_type == NX_DNS_RR_TYPE_AAAA))
+            same_rdata = (memcmp(p -> nx_dns_rr_rdata.nx_dns_rr_rdata_aaaa.nx_dns_rr_aaaa_address,
+                                 record_ptr -> nx_dns_rr_rdata.nx_dns_rr_rdata_aaaa.nx_dns_rr_aaaa_address, 16) == 0);
+        else
+            same_rdata = (memcmp(&(p -> nx_dns_rr_rdata), &(record_ptr -> nx_dns_rr_rdata), sizeof(p -> nx_dns_rr_rdata)) == 0);
+
+        if (same_rdata)
+        {
+
+            /* The record is cached already. Refresh its time to live, and delete the strings added for the new one.  */
+            p -> nx_dns_rr_ttl = record_ptr -> nx_dns_rr_ttl;
+            p -> nx_dns_rr_last_used_time = current_time;
+            _nx_dns_cache_delete_rr_string(dns_ptr, cache_ptr, cache_size, record_ptr);
+
+            /* Set the insert ptr.  */
+            if(insert_ptr != NX_NULL)
+                *insert_ptr = p;
+
+            return(NX_DNS_SUCCESS);
+        }
+    }
+
     /* Get head and tail. */
     tail = (ALIGN_TYPE*)((UCHAR*)cache_ptr + cache_size) - 1;
     tail = (ALIGN_TYPE*)(*tail);
@@ -9886,6 +10687,16 @@ ULONG       max_elapsed_time;
     /* Get the current time to set the elapsed time.  */
     rr -> nx_dns_rr_last_used_time = current_time;
 
+    /* Link the record at the end of its hash bucket, keeping the order of the answers.  */
+    rr -> nx_dns_rr_hash_next = NX_NULL;
+    rr -> nx_dns_rr_hit_count = 0;
+    bucket_ptr = &(dns_ptr -> nx_dns_cache_hash[index]);
+    while (*bucket_ptr)
+    {
+        bucket_ptr = &((*bucket_ptr) -> nx_dns_rr_hash_next);
+    }
+    *bucket_ptr = rr;
+
     /* Set the insert ptr.  */
     if(insert_ptr != NX_NULL)
         *insert_ptr = rr;
@@ -9908,8 +10719,8 @@ ULONG       max_elapsed_time;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dns_cache_find_answer                           PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dns_cache_find_answer                           PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -9947,13 +10758,17 @@ ULONG       max_elapsed_time;
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            hash index, negative answers*/
+/*                                            and hit count,              */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_dns_cache_find_answer(NX_DNS *dns_ptr, VOID *cache_ptr, UCHAR *query_name, USHORT query_type, UCHAR *buffer, UINT buffer_size, UINT *record_count)
 {
 
-ALIGN_TYPE          *head;
 NX_DNS_RR           *p;      
+NX_DNS_RR           *next_ptr;
 ULONG               current_time;   
 ULONG               elasped_ttl;    
 UINT                old_count;
@@ -9999,17 +10814,12 @@ UINT                 mname_string_length;
     /* Get the current time.  */
     current_time = tx_time_get();
 
-    /* Get head. */
-    head = (ALIGN_TYPE*)cache_ptr;
-    head = (ALIGN_TYPE*)(*head);
-
-    /* Lookup the cache to delete the expired resource record and find the answer.  */ 
-    for(p = (NX_DNS_RR*)((UCHAR*)cache_ptr + sizeof(ALIGN_TYPE)); (ALIGN_TYPE*)p < head; p++)
+    /* Lookup the hash bucket of the query to delete the expired resource record and find the answer.  */ 
+    for(p = dns_ptr -> nx_dns_cache_hash[_nx_dns_cache_hash_index(query_name, query_type)]; p != NX_NULL; p = next_ptr)
     {
 
-        /* Check whether the resource record is valid. */
-        if (!p -> nx_dns_rr_name)
-            continue;  
+        /* Get the next record first, since this one may be deleted.  */
+        next_ptr = p -> nx_dns_rr_hash_next;
 
         /* Calucate the elapsed time.  */
         elasped_ttl = (current_time - p -> nx_dns_rr_last_used_time) / NX_IP_PERIODIC_RATE;
@@ -10034,6 +10844,13 @@ UINT                 mname_string_length;
         /* Update the elasped time and ttl.  */
         p -> nx_dns_rr_last_used_time = current_time;
         p -> nx_dns_rr_ttl -= elasped_ttl;
+
+        /* Count the use of the record for prefetching.  */
+        p -> nx_dns_rr_hit_count++;
+
+        /* Check whether the name or the type is known not to exist.  */
+        if (p -> nx_dns_rr_class == NX_DNS_RR_CLASS_NEGATIVE)
+            return(NX_DNS_QUERY_FAILED);
         
         /* Yes, get the answer.  */
         
@@ -10303,8 +11120,8 @@ UINT                 mname_string_length;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dns_cache_delete_rr                             PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dns_cache_delete_rr                             PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -10333,18 +11150,37 @@ UINT                 mname_string_length;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            hash index,                 */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_dns_cache_delete_rr(NX_DNS *dns_ptr, VOID *cache_ptr, UINT cache_size, NX_DNS_RR *record_ptr)
 {
 
 ALIGN_TYPE  *head;
+NX_DNS_RR   **bucket_ptr;
 
 
     /* Check the cache.  */
     if (cache_ptr == NX_NULL)
         return(NX_DNS_CACHE_ERROR);
 
+    /* Unlink the record from its hash bucket.  */
+    if (record_ptr -> nx_dns_rr_name)
+    {
+        bucket_ptr = &(dns_ptr -> nx_dns_cache_hash[_nx_dns_cache_hash_index(record_ptr -> nx_dns_rr_name, record_ptr -> nx_dns_rr_type)]);
+        while (*bucket_ptr)
+        {
+            if (*bucket_ptr == record_ptr)
+            {
+                *bucket_ptr = record_ptr -> nx_dns_rr_hash_next;
+                break;
+            }
+            bucket_ptr = &((*bucket_ptr) -> nx_dns_rr_hash_next);
+        }
+    }
+
     /* Delete the resource record strings. */
     _nx_dns_cache_delete_rr_string(dns_ptr, cache_ptr,cache_size, record_ptr);
     
@@ -10831,8 +11667,8 @@ USHORT      cnt;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_dns_name_match                                  PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_dns_name_match                                  PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -10865,6 +11701,9 @@ USHORT      cnt;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            source name end check,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_dns_name_match(UCHAR *src, UCHAR *dst, UINT length)
@@ -10894,8 +11733,8 @@ UINT    index = 0;
         index ++;
     }
 
-    /* Check the scan length.  */
-    if (index != length)
+    /* Check the scan length and the end of the source name.  */
+    if ((index != length) || (*src != '\0'))
     {
         return (NX_DNS_NAME_MISMATCH);
     }
@@ -10903,4 +11742,235 @@ UINT    index = 0;
     /* Return success.  */
     return(NX_DNS_SUCCESS);
 }
-#endif /* NX_DNS_CACHE_ENABLE  */       
+#endif /* NX_DNS_CACHE_ENABLE  */
+
+
+#ifdef NX_DNS_CACHE_ENABLE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dns_cache_hash_index                            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the hash bucket of the cached resource       */
+/*    records from the name, case-insensitively, and the type.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    name                              Name string                       */
+/*    type                              Resource record type              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                             Hash bucket index                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_dns_cache_add_rr              Add the resource record           */
+/*    _nx_dns_cache_find_answer         Find the answer in the cache      */
+/*    _nx_dns_cache_delete_rr           Delete the resource record        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT  _nx_dns_cache_hash_index(UCHAR *name, USHORT type)
+{
+
+UINT    hash = type;
+UCHAR   value;
+
+
+    /* Hash the name. The letters are folded to lowercase, since names match case-insensitively.  */
+    while (*name != '\0')
+    {
+        value = *name;
+        if ((value >= 'A') && (value <= 'Z'))
+            value = (UCHAR)(value | 0x20);
+        hash = (hash * 31) + value;
+        name ++;
+    }
+
+    /* Return the bucket.  */
+    return(hash & (NX_DNS_CACHE_HASH_SIZE - 1));
+}
+#endif /* NX_DNS_CACHE_ENABLE  */
+
+
+#ifdef NX_DNS_CACHE_ENABLE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dns_cache_negative_add                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function caches a response telling the queried name does not   */
+/*    exist (NXDOMAIN), or that it has no record of the queried type      */
+/*    (NODATA, a successful response without an answer of the type),      */
+/*    RFC 2308. The time to live is taken from the SOA record of the      */
+/*    authority section and limited to NX_DNS_CACHE_NEGATIVE_TTL_MAX.     */
+/*    Responses without SOA record are not cached.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    dns_ptr                           Pointer to DNS instance           */
+/*    host_name                         Name of host queried              */
+/*    packet_ptr                        Pointer to received packet        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dns_name_string_unencode      Unencode the name                 */
+/*    _nx_dns_name_size_calculate       Calculate size of name field      */
+/*    _nx_dns_resource_type_get         Get resource type                 */
+/*    _nx_dns_resource_size_get         Get resource size                 */
+/*    _nx_dns_resource_time_to_live_get Get resource TTL                  */
+/*    _nx_dns_resource_data_address_get Get resource data address         */
+/*    _nx_dns_resource_data_length_get  Get resource data length          */
+/*    _nx_dns_cache_add_string          Add the name string               */
+/*    _nx_dns_cache_add_rr              Add the resource record           */
+/*    _nx_dns_cache_delete_rr_string    Delete the name string            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_dns_response_process          Process the DNS response          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_dns_cache_negative_add(NX_DNS *dns_ptr, UCHAR *host_name, NX_PACKET *packet_ptr)
+{
+
+UINT        flags;
+UINT        answer_count;
+UINT        authority_count;
+UINT        name_size;
+UINT        host_name_size;
+UINT        resource_type;
+UINT        resource_size;
+UINT        data_length;
+UINT        i;
+ULONG       rr_ttl;
+ULONG       minimum_ttl;
+UCHAR       *data_ptr;
+UCHAR       *rdata_ptr;
+
+
+    /* Check the cache.  */
+    if ((dns_ptr -> nx_dns_cache == NX_NULL) || (packet_ptr -> nx_packet_length <= NX_DNS_QDSECT_OFFSET))
+        return;
+
+    /* Only a complete response with no such name, or with no record of the type, is a negative answer.  */
+    flags = _nx_dns_network_to_short_convert(packet_ptr -> nx_packet_prepend_ptr + NX_DNS_FLAGS_OFFSET);
+    if (((flags & NX_DNS_QUERY_MASK) != NX_DNS_RESPONSE_FLAG) || (flags & NX_DNS_TC_FLAG) ||
+        (((flags & NX_DNS_RCODE_MASK) != NX_DNS_RCODE_SUCCESS) && ((flags & NX_DNS_RCODE_MASK) != NX_DNS_RCODE_NAME_ERR)))
+        return;
+
+    /* The question must be the one sent out.  */
+    if (_nx_dns_network_to_short_convert(packet_ptr -> nx_packet_prepend_ptr + NX_DNS_QDCOUNT_OFFSET) != 1)
+        return;
+    data_ptr =  packet_ptr -> nx_packet_prepend_ptr + NX_DNS_QDSECT_OFFSET;
+    name_size = _nx_dns_name_string_unencode(packet_ptr, data_ptr, temp_string_buffer, NX_DNS_NAME_MAX);
+    if ((name_size == 0) ||
+        _nx_utility_string_length_check((CHAR *)host_name, &host_name_size, name_size) ||
+        (name_size != host_name_size) ||
+        (memcmp(host_name, temp_string_buffer, name_size) != 0))
+        return;
+    name_size = _nx_dns_name_size_calculate(data_ptr, packet_ptr);
+    if ((name_size == 0) || (data_ptr + name_size + 4 > packet_ptr -> nx_packet_append_ptr) ||
+        (_nx_dns_network_to_short_convert(data_ptr + name_size) != dns_ptr -> nx_dns_lookup_type) || 
+        (_nx_dns_network_to_short_convert(data_ptr + name_size + 2) != NX_DNS_RR_CLASS_IN))
+        return;
+    data_ptr +=  name_size + 4;
+
+    /* Skip the answer section, e.g. the CNAME records of an alias without the type.
+       A response with a record of the queried type is not a negative answer.  */
+    answer_count = _nx_dns_network_to_short_convert(packet_ptr -> nx_packet_prepend_ptr + NX_DNS_ANCOUNT_OFFSET);
+    for (i = 0; i < answer_count; i++)
+    {
+        if ((data_ptr >= packet_ptr -> nx_packet_append_ptr) ||
+            _nx_dns_resource_type_get(data_ptr, packet_ptr, &resource_type) ||
+            (resource_type == dns_ptr -> nx_dns_lookup_type) ||
+            _nx_dns_resource_size_get(data_ptr, packet_ptr, &resource_size))
+            return;
+        data_ptr += resource_size;
+    }
+
+    /* Find the SOA record in the authority section. Without it, the negative answer must not be cached (RFC 2308, section 5).  */
+    authority_count = _nx_dns_network_to_short_convert(packet_ptr -> nx_packet_prepend_ptr + NX_DNS_NSCOUNT_OFFSET);
+    for (i = 0; i < authority_count; i++)
+    {
+        if ((data_ptr >= packet_ptr -> nx_packet_append_ptr) ||
+            _nx_dns_resource_type_get(data_ptr, packet_ptr, &resource_type))
+            return;
+
+        if (resource_type == NX_DNS_RR_TYPE_SOA)
+            break;
+
+        if (_nx_dns_resource_size_get(data_ptr, packet_ptr, &resource_size))
+            return;
+        data_ptr += resource_size;
+    }
+    if (i == authority_count)
+        return;
+
+    /* The negative answer lives for the smaller of the SOA time to live and the SOA MINIMUM field, which ends the RDATA.  */
+    if (_nx_dns_resource_time_to_live_get(data_ptr, packet_ptr, &rr_ttl) ||
+        _nx_dns_resource_data_length_get(data_ptr, packet_ptr, &data_length))
+        return;
+    rdata_ptr = _nx_dns_resource_data_address_get(data_ptr, packet_ptr);
+    if ((rdata_ptr == NX_NULL) || (data_length < 22) || (rdata_ptr + data_length > packet_ptr -> nx_packet_append_ptr))
+        return;
+    minimum_ttl = _nx_dns_network_to_long_convert(rdata_ptr + data_length - 4);
+    if (minimum_ttl < rr_ttl)
+        rr_ttl = minimum_ttl;
+    if (rr_ttl > NX_DNS_CACHE_NEGATIVE_TTL_MAX)
+        rr_ttl = NX_DNS_CACHE_NEGATIVE_TTL_MAX;
+    if (rr_ttl == 0)
+        return;
+
+    /* Set the negative record.  */
+    memset(&temp_rr, 0, sizeof (NX_DNS_RR));
+    temp_rr.nx_dns_rr_type = dns_ptr -> nx_dns_lookup_type;
+    temp_rr.nx_dns_rr_class = NX_DNS_RR_CLASS_NEGATIVE;
+    temp_rr.nx_dns_rr_ttl = rr_ttl;
+
+    /* Add the name string.  */
+    if (_nx_dns_cache_add_string(dns_ptr, dns_ptr -> nx_dns_cache, dns_ptr -> nx_dns_cache_size, host_name, host_name_size, (VOID **)(&(temp_rr.nx_dns_rr_name))))
+        return;
+
+    /* Add the resource record.  */
+    if (_nx_dns_cache_add_rr(dns_ptr, dns_ptr -> nx_dns_cache, dns_ptr -> nx_dns_cache_size, &temp_rr,  NX_NULL))
+    {
+
+        /* Delete the name string.  */
+        _nx_dns_cache_delete_rr_string(dns_ptr, dns_ptr -> nx_dns_cache, dns_ptr -> nx_dns_cache_size, &temp_rr);
+    }
+}
+#endif /* NX_DNS_CACHE_ENABLE  */
@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */ 
 /*                                                                        */  
 /*    nxd_dns.h                                           PORTABLE C      */
-/*                                                           6.1.5        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -53,6 +53,11 @@
 /*                                            improved the logic of       */
 /*                                            receiving dns response,     */
 /*                                            resulting in version 6.1.5  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            cache index, negative       */
+/*                                            caching, prefetch and       */
+/*                                            query list service,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
           
@@ -233,6 +238,25 @@ extern   "C" {
 #define NX_DNS_CACHE_ENABLE
 */
 
+/* Define the number of hash buckets used to look up the cached resource records by name and
+   type. The value must be a power of 2.  */
+#ifndef NX_DNS_CACHE_HASH_SIZE
+#define NX_DNS_CACHE_HASH_SIZE                  32
+#endif
+
+/* Define the maximum time in seconds to cache a negative answer (name or record type does not
+   exist). The time is taken from the SOA record of the response (RFC 2308) and limited to this
+   value. Defining it as 0 disables negative caching.  */
+#ifndef NX_DNS_CACHE_NEGATIVE_TTL_MAX
+#define NX_DNS_CACHE_NEGATIVE_TTL_MAX           300
+#endif
+
+/* Define the remaining time to live in seconds below which nx_dns_cache_prefetch queries again
+   the address records that have been used since they were cached.  */
+#ifndef NX_DNS_CACHE_PREFETCH_TIME
+#define NX_DNS_CACHE_PREFETCH_TIME              30
+#endif
+
 /* Define UDP socket create options.  */
 
 #ifndef NX_DNS_TYPE_OF_SERVICE
@@ -253,6 +277,13 @@ extern   "C" {
 #define NX_DNS_QUEUE_DEPTH                      5
 #endif
 
+/* Define the maximum number of queries outstanding at the same time in nxd_dns_host_by_name_list_get.
+   It should not exceed the queue depth of the socket, otherwise responses may be dropped. */
+
+#ifndef NX_DNS_MAX_OUTSTANDING_QUERIES
+#define NX_DNS_MAX_OUTSTANDING_QUERIES          NX_DNS_QUEUE_DEPTH
+#endif
+
 /* Define the maximum size of DNS message. 512 is the maximum size defined in RFC 1035 section 2.3.4. */
 
 #ifndef NX_DNS_MESSAGE_MAX              
@@ -333,6 +364,8 @@ typedef struct NX_IP_DNS_STRUCT
     ULONG           nx_dns_string_count;                            /* The number of strings in the cache.                      */         
     ULONG           nx_dns_string_bytes;                            /* The number of total bytes in string table in the cache.  */ 
     VOID            (*nx_dns_cache_full_notify)(struct NX_IP_DNS_STRUCT *);
+    struct NX_DNS_RR_STRUCT
+                    *nx_dns_cache_hash[NX_DNS_CACHE_HASH_SIZE];     /* Resource records hashed by name and type.                */
 #endif /* NX_DNS_CACHE_ENABLE  */
 } NX_DNS;
 
@@ -804,6 +837,13 @@ typedef struct NX_DNS_RR_STRUCT
                                      
     ULONG   nx_dns_rr_last_used_time;           /* Define the last used time for the peer RR.               */
 
+#ifdef NX_DNS_CACHE_ENABLE
+    struct NX_DNS_RR_STRUCT
+           *nx_dns_rr_hash_next;                /* Next RR in the same hash bucket of the cache.            */
+
+    ULONG   nx_dns_rr_hit_count;                /* Number of answers given from the cache since refreshed.  */
+#endif /* NX_DNS_CACHE_ENABLE  */
+
     /* Union that holds resource record data. */
     union   nx_dns_rr_rdata_union
     {
@@ -860,6 +900,7 @@ typedef struct NX_DNS_RR_STRUCT
 #define nxd_dns_ipv6_address_by_name_get            _nxd_dns_ipv6_address_by_name_get
 #define nxd_dns_host_by_address_get                 _nxd_dns_host_by_address_get
 #define nxd_dns_host_by_name_get                    _nxd_dns_host_by_name_get
+#define nxd_dns_host_by_name_list_get               _nxd_dns_host_by_name_list_get
 #define nxd_dns_server_add                          _nxd_dns_server_add
 #define nxd_dns_server_remove                       _nxd_dns_server_remove
 #define nxd_dns_server_get                          _nxd_dns_server_get
@@ -868,6 +909,7 @@ typedef struct NX_DNS_RR_STRUCT
 #define nx_dns_cache_initialize                     _nx_dns_cache_initialize   
 #define nx_dns_cache_notify_set                     _nx_dns_cache_notify_set
 #define nx_dns_cache_notify_clear                   _nx_dns_cache_notify_clear
+#define nx_dns_cache_prefetch                       _nx_dns_cache_prefetch
 #endif /* NX_DNS_CACHE_ENABLE  */
 
 #else
@@ -900,6 +942,7 @@ typedef struct NX_DNS_RR_STRUCT
 #define nxd_dns_ipv6_address_by_name_get            _nxde_dns_ipv6_address_by_name_get
 #define nxd_dns_host_by_address_get                 _nxde_dns_host_by_address_get
 #define nxd_dns_host_by_name_get                    _nxde_dns_host_by_name_get
+#define nxd_dns_host_by_name_list_get               _nxde_dns_host_by_name_list_get
 #define nxd_dns_server_add                          _nxde_dns_server_add
 #define nxd_dns_server_remove                       _nxde_dns_server_remove
 #define nxd_dns_server_get                          _nxde_dns_server_get
@@ -908,6 +951,7 @@ typedef struct NX_DNS_RR_STRUCT
 #define nx_dns_cache_initialize                     _nxe_dns_cache_initialize   
 #define nx_dns_cache_notify_set                     _nxe_dns_cache_notify_set
 #define nx_dns_cache_notify_clear                   _nxe_dns_cache_notify_clear
+#define nx_dns_cache_prefetch                       _nxe_dns_cache_prefetch
 #endif /* NX_DNS_CACHE_ENABLE  */
 
 #endif
@@ -939,6 +983,7 @@ UINT        nx_dns_info_by_name_get(NX_DNS *dns_ptr, UCHAR *host_name, ULONG *ho
 UINT        nxd_dns_ipv6_address_by_name_get(NX_DNS *dns_ptr, UCHAR *host_name, VOID *record_buffer, UINT buffer_size, UINT *record_count, ULONG wait_option);
 UINT        nxd_dns_host_by_address_get(NX_DNS *dns_ptr, NXD_ADDRESS *ip_address, UCHAR *host_name_ptr, UINT host_name_buffer_size, ULONG wait_option);
 UINT        nxd_dns_host_by_name_get(NX_DNS *dns_ptr, UCHAR *host_name, NXD_ADDRESS *host_address_ptr, ULONG wait_option, UINT lookup_type);
+UINT        nxd_dns_host_by_name_list_get(NX_DNS *dns_ptr, UCHAR **host_name_list, NXD_ADDRESS *host_address_list, UINT host_count, ULONG wait_option, UINT lookup_type);
 UINT        nxd_dns_server_add(NX_DNS *dns_ptr, NXD_ADDRESS *dns_server_address);
 UINT        nxd_dns_server_remove(NX_DNS *dns_ptr, NXD_ADDRESS *server_address);
 UINT        nxd_dns_server_get(NX_DNS *dns_ptr, UINT index, NXD_ADDRESS *dns_server_address);
@@ -947,6 +992,7 @@ UINT        nxd_dns_server_get(NX_DNS *dns_ptr, UINT index, NXD_ADDRESS *dns_ser
 UINT        nx_dns_cache_initialize(NX_DNS *dns_ptr, VOID *cache_ptr, UINT cache_size); 
 UINT        nx_dns_cache_notify_set(NX_DNS *dns_ptr, VOID (*cache_full_notify_cb)(NX_DNS *dns_ptr));
 UINT        nx_dns_cache_notify_clear(NX_DNS *dns_ptr);    
+UINT        nx_dns_cache_prefetch(NX_DNS *dns_ptr, ULONG wait_option);
 #endif /* NX_DNS_CACHE_ENABLE  */
 
 #else
@@ -999,6 +1045,8 @@ UINT        _nxde_dns_host_by_address_get(NX_DNS *dns_ptr, NXD_ADDRESS *host_add
 UINT        _nxd_dns_host_by_address_get(NX_DNS *dns_ptr, NXD_ADDRESS *host_address_ptr, UCHAR *host_name_ptr, UINT host_name_buffer_size, ULONG wait_option);
 UINT        _nxde_dns_host_by_name_get(NX_DNS *dns_ptr, UCHAR *host_name, NXD_ADDRESS *host_address_ptr, ULONG wait_option, UINT lookup_type);
 UINT        _nxd_dns_host_by_name_get(NX_DNS *dns_ptr, UCHAR *host_name, NXD_ADDRESS *host_address_ptr, ULONG wait_option, UINT lookup_type);
+UINT        _nxde_dns_host_by_name_list_get(NX_DNS *dns_ptr, UCHAR **host_name_list, NXD_ADDRESS *host_address_list, UINT host_count, ULONG wait_option, UINT lookup_type);
+UINT        _nxd_dns_host_by_name_list_get(NX_DNS *dns_ptr, UCHAR **host_name_list, NXD_ADDRESS *host_address_list, UINT host_count, ULONG wait_option, UINT lookup_type);
 UINT        _nxde_dns_server_add(NX_DNS *dns_ptr, NXD_ADDRESS *server_address);
 UINT        _nxd_dns_server_add(NX_DNS *dns_ptr, NXD_ADDRESS *server_address);
 UINT        _nxde_dns_server_remove(NX_DNS *dns_ptr, NXD_ADDRESS *server_address);
@@ -1013,6 +1061,8 @@ UINT        _nxe_dns_cache_notify_set(NX_DNS *dns_ptr, VOID (*cache_full_notify_
 UINT        _nx_dns_cache_notify_set(NX_DNS *dns_ptr, VOID (*cache_full_notify_cb)(NX_DNS *dns_ptr)); 
 UINT        _nxe_dns_cache_notify_clear(NX_DNS *dns_ptr);     
 UINT        _nx_dns_cache_notify_clear(NX_DNS *dns_ptr);    
+UINT        _nxe_dns_cache_prefetch(NX_DNS *dns_ptr, ULONG wait_option);
+UINT        _nx_dns_cache_prefetch(NX_DNS *dns_ptr, ULONG wait_option);
 #endif /* NX_DNS_CACHE_ENABLE  */
 
 #endif
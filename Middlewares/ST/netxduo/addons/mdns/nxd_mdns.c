@@ -142,6 +142,9 @@ UINT         _nx_mdns_cache_find_resource_record(NX_MDNS *mdns_ptr, UINT cache_t
 UINT         _nx_mdns_cache_add_string(NX_MDNS *mdns_ptr, UINT cache_type, VOID *string_ptr, UINT string_len, VOID **insert_ptr, UCHAR find_string, UCHAR add_name);
 UINT         _nx_mdns_cache_delete_string(NX_MDNS *mdns_ptr, UINT cache_type, VOID *string_ptr, UINT string_len);
 VOID         _nx_mdns_cache_delete_rr_string(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS_RR *record_rr);
+static UINT         _nx_mdns_cache_rr_hash_index(UCHAR *name);
+static VOID         _nx_mdns_cache_rr_hash_link(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS_RR *record_ptr);
+static VOID         _nx_mdns_cache_rr_hash_unlink(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS_RR *record_ptr);
 
 
 /* Define the mDNS STRUCT.  */
@@ -7790,8 +7793,8 @@ UINT             interface_index;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_mdns_packet_process                             PORTABLE C      */ 
-/*                                                           6.1.4        */
+/*    _nx_mdns_packet_process                             PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -7840,6 +7843,9 @@ UINT             interface_index;
 /*  02-02-2021     Yuxin Zhou               Modified comment(s), improved */
 /*                                            packet length verification, */
 /*                                            resulting in version 6.1.4  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            lookup by record name index,*/
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_mdns_packet_process(NX_MDNS *mdns_ptr, NX_PACKET *packet_ptr, UINT interface_index)
@@ -7855,7 +7861,6 @@ NX_MDNS_RR         *rr_search;
 NX_MDNS_RR          temp_resource_record;
 
 #ifndef NX_MDNS_DISABLE_SERVER
-ULONG              *head;
 NX_MDNS_RR         *p;
 #ifdef NX_MDNS_ENABLE_SERVER_NEGATIVE_RESPONSES
 ULONG               match_count;
@@ -7982,12 +7987,9 @@ NX_MDNS_RR         *nsec_rr;
                 nsec_rr = NX_NULL;
 #endif /* NX_MDNS_ENABLE_SERVER_NEGATIVE_RESPONSES  */
 
-                /* Get head. */
-                head = (ULONG*)mdns_ptr -> nx_mdns_local_service_cache;
-                head = (ULONG*)(*head);
-
-                /* Find the same record.  */
-                for(p = (NX_MDNS_RR*)((UCHAR*)mdns_ptr -> nx_mdns_local_service_cache + sizeof(ULONG)); (ULONG*)p < head; p++)
+                /* Find the same record, only the records with the same name index are checked.  */
+                for(p = mdns_ptr -> nx_mdns_local_rr_hash[_nx_mdns_cache_rr_hash_index(temp_resource_record.nx_mdns_rr_name)];
+                    p; p = p -> nx_mdns_rr_hash_next)
                 {
 
                     /* Check the interface index.  */
@@ -10732,8 +10734,8 @@ UINT        i;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_mdns_conflict_process                           PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_mdns_conflict_process                           PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -10771,6 +10773,9 @@ UINT        i;
 /*                                            buffer length verification, */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            record name index,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_mdns_conflict_process(NX_MDNS *mdns_ptr, NX_MDNS_RR *record_rr)
@@ -10918,11 +10923,17 @@ UINT        rr_name_length;
         return(NX_MDNS_DATA_SIZE_ERROR);
     }
 
+    /* Unlink the record from the name index before it is renamed.  */
+    _nx_mdns_cache_rr_hash_unlink(mdns_ptr, NX_MDNS_CACHE_TYPE_LOCAL, record_rr);
+
     /* Add the new resource records. */
     status = _nx_mdns_cache_add_string(mdns_ptr, NX_MDNS_CACHE_TYPE_LOCAL,
                                        &temp_string_buffer[0], temp_string_length,
                                        (VOID **)(&record_rr -> nx_mdns_rr_name), NX_FALSE, NX_TRUE);
 
+    /* Link the record into the name index with its current name.  */
+    _nx_mdns_cache_rr_hash_link(mdns_ptr, NX_MDNS_CACHE_TYPE_LOCAL, record_rr);
+
     if (status )
     {
 
@@ -11344,8 +11355,8 @@ UINT        temp_length;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_mdns_cache_initialize                         PORTABLE C       */ 
-/*                                                           6.1          */
+/*    _nx_mdns_cache_initialize                         PORTABLE C       */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -11384,6 +11395,9 @@ UINT        temp_length;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            record name index reset,    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_mdns_cache_initialize(NX_MDNS *mdns_ptr, VOID *local_cache_ptr, UINT local_cache_size, 
@@ -11418,6 +11432,9 @@ ULONG *tail;
         mdns_ptr -> nx_mdns_local_rr_count = 0;    
         mdns_ptr -> nx_mdns_local_string_count = 0;
         mdns_ptr -> nx_mdns_local_string_bytes = 0;
+
+        /* Clear the name index.  */
+        memset(mdns_ptr -> nx_mdns_local_rr_hash, 0, sizeof(mdns_ptr -> nx_mdns_local_rr_hash));
     }
 #else
     NX_PARAMETER_NOT_USED(local_cache_ptr);
@@ -11448,6 +11465,9 @@ ULONG *tail;
         mdns_ptr -> nx_mdns_peer_rr_count = 0;    
         mdns_ptr -> nx_mdns_peer_string_count = 0;
         mdns_ptr -> nx_mdns_peer_string_bytes = 0;
+
+        /* Clear the name index.  */
+        memset(mdns_ptr -> nx_mdns_peer_rr_hash, 0, sizeof(mdns_ptr -> nx_mdns_peer_rr_hash));
     }
 #else
     NX_PARAMETER_NOT_USED(peer_cache_ptr);
@@ -11458,12 +11478,231 @@ ULONG *tail;
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_mdns_cache_rr_hash_index                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the name index bucket of the resource record */
+/*    name. Letters are folded to lowercase, so that the names matching   */
+/*    case-insensitively share the same bucket in both caches.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    name                                  Pointer to the name string    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                                 Bucket index                  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_mdns_cache_rr_hash_link           Link record into name index   */
+/*    _nx_mdns_cache_rr_hash_unlink         Unlink record from name index */
+/*    _nx_mdns_cache_find_resource_record   Find the resource record      */
+/*    _nx_mdns_packet_process               Process mDNS packet           */
+/*    _nx_mdns_additional_resource_record_find                            */
+/*                                          Find additional record        */
+/*    _nx_mdns_additional_a_aaaa_find       Find additional A/AAAA record */
+/*    _nx_mdns_known_answer_find            Find the known answer         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_mdns_cache_rr_hash_index(UCHAR *name)
+{
+
+ULONG   hash = 0;
+UCHAR   value;
+
+
+    /* Hash the name, the letters are folded to lowercase since
+       the names are matched case-insensitively.  */
+    while (*name != '\0')
+    {
+        value = *name++;
+        if ((value >= 'A') && (value <= 'Z'))
+        {
+            value = (UCHAR)(value | 0x20);
+        }
+        hash = (hash << 5) + hash + value;
+    }
+
+    return((UINT)(hash & (NX_MDNS_RR_HASH_SIZE - 1)));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_mdns_cache_rr_hash_link                         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function links the resource record into the name index of the  */
+/*    cache, so that the records with the same name can be found without  */
+/*    scanning the whole cache.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    mdns_ptr                              Pointer to mDNS instance      */
+/*    cache_type                            Cache type: local or peer     */
+/*    record_ptr                            Pointer to record instance    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_mdns_cache_rr_hash_index          Compute the name index        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_mdns_cache_add_resource_record    Add the resource record       */
+/*    _nx_mdns_conflict_process             Process the conflict          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_mdns_cache_rr_hash_link(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS_RR *record_ptr)
+{
+
+NX_MDNS_RR  **bucket;
+
+
+    /* Check the name.  */
+    if (record_ptr -> nx_mdns_rr_name == NX_NULL)
+    {
+        record_ptr -> nx_mdns_rr_hash_next = NX_NULL;
+        return;
+    }
+
+    /* Get the bucket of the name.  */
+    if (cache_type == NX_MDNS_CACHE_TYPE_LOCAL)
+    {
+        bucket = &mdns_ptr -> nx_mdns_local_rr_hash[_nx_mdns_cache_rr_hash_index(record_ptr -> nx_mdns_rr_name)];
+    }
+    else
+    {
+        bucket = &mdns_ptr -> nx_mdns_peer_rr_hash[_nx_mdns_cache_rr_hash_index(record_ptr -> nx_mdns_rr_name)];
+    }
+
+    /* Insert the record at the front of the bucket.  */
+    record_ptr -> nx_mdns_rr_hash_next = *bucket;
+    *bucket = record_ptr;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_mdns_cache_rr_hash_unlink                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function unlinks the resource record from the name index of    */
+/*    the cache. It must be called before the record name is changed or   */
+/*    the record is deleted.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    mdns_ptr                              Pointer to mDNS instance      */
+/*    cache_type                            Cache type: local or peer     */
+/*    record_ptr                            Pointer to record instance    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_mdns_cache_rr_hash_index          Compute the name index        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_mdns_cache_delete_resource_record Delete the resource record    */
+/*    _nx_mdns_conflict_process             Process the conflict          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_mdns_cache_rr_hash_unlink(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS_RR *record_ptr)
+{
+
+NX_MDNS_RR  **bucket;
+
+
+    /* Check the name.  */
+    if (record_ptr -> nx_mdns_rr_name == NX_NULL)
+    {
+        return;
+    }
+
+    /* Get the bucket of the name.  */
+    if (cache_type == NX_MDNS_CACHE_TYPE_LOCAL)
+    {
+        bucket = &mdns_ptr -> nx_mdns_local_rr_hash[_nx_mdns_cache_rr_hash_index(record_ptr -> nx_mdns_rr_name)];
+    }
+    else
+    {
+        bucket = &mdns_ptr -> nx_mdns_peer_rr_hash[_nx_mdns_cache_rr_hash_index(record_ptr -> nx_mdns_rr_name)];
+    }
+
+    /* Find the record and remove it from the bucket.  */
+    while (*bucket)
+    {
+        if (*bucket == record_ptr)
+        {
+            *bucket = record_ptr -> nx_mdns_rr_hash_next;
+            break;
+        }
+        bucket = &((*bucket) -> nx_mdns_rr_hash_next);
+    }
+
+    record_ptr -> nx_mdns_rr_hash_next = NX_NULL;
+}
+
+
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_mdns_cache_add_resource_record                  PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_mdns_cache_add_resource_record                  PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -11507,6 +11746,9 @@ ULONG *tail;
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            record name index,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_mdns_cache_add_resource_record(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS_RR *record_ptr, NX_MDNS_RR **insert_ptr, UCHAR *is_present)
@@ -11547,8 +11789,14 @@ ULONG       min_elapsed_time;
             return(NX_MDNS_DATA_SIZE_ERROR);
         }
 
+        /* Save the name index link, the name is the same.  */
+        p = rr -> nx_mdns_rr_hash_next;
+
         /* Copy other informations of record_ptr into insert_rr resource record.  */
         memcpy(rr, record_ptr, sizeof(NX_MDNS_RR)); /* Use case of memcpy is verified. */
+
+        /* Restore the name index link.  */
+        rr -> nx_mdns_rr_hash_next = p;
         
         /* Special process for _services._dns-sd._udp.local which pointer to same service type.  */
         if ((rr -> nx_mdns_rr_type == NX_MDNS_RR_TYPE_PTR) &&
@@ -11666,6 +11914,9 @@ ULONG       min_elapsed_time;
     /* Just copy it to cache_ptr. */
     memcpy(rr, record_ptr, sizeof(NX_MDNS_RR)); /* Use case of memcpy is verified. */
 
+    /* Link the record into the name index.  */
+    _nx_mdns_cache_rr_hash_link(mdns_ptr, cache_type, rr);
+
     /* Check the type.  */
     if (cache_type == NX_MDNS_CACHE_TYPE_LOCAL)
     {
@@ -11710,8 +11961,8 @@ ULONG       min_elapsed_time;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_mdns_cache_delete_resource_record               PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_mdns_cache_delete_resource_record               PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -11749,6 +12000,9 @@ ULONG       min_elapsed_time;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            record name index,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_mdns_cache_delete_resource_record(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS_RR *record_ptr)
@@ -11758,6 +12012,9 @@ UCHAR       *cache_ptr;
 ULONG       *head;
 
 
+    /* Unlink the record from the name index.  */
+    _nx_mdns_cache_rr_hash_unlink(mdns_ptr, cache_type, record_ptr);
+
     /* Delete the resource record strings. */
     _nx_mdns_cache_delete_rr_string(mdns_ptr, cache_type, record_ptr);
     
@@ -11813,8 +12070,8 @@ ULONG       *head;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_mdns_cache_find_resource_record                 PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_mdns_cache_find_resource_record                 PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -11851,33 +12108,30 @@ ULONG       *head;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            lookup by record name index,*/
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_mdns_cache_find_resource_record(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS_RR *record_ptr, UINT match_type, NX_MDNS_RR **search_rr)
 {
 
-UCHAR       *cache_ptr;
-ULONG       *head;
 NX_MDNS_RR  *p;
 UINT        same_rdata;
 
 
-    /* Check the cache type.  */
+    /* Check the cache type, get the records with the same name from the name index.  */
     if (cache_type == NX_MDNS_CACHE_TYPE_LOCAL)
     {
-        cache_ptr = mdns_ptr -> nx_mdns_local_service_cache;
+        p = mdns_ptr -> nx_mdns_local_rr_hash[_nx_mdns_cache_rr_hash_index(record_ptr -> nx_mdns_rr_name)];
     }
     else
     {
-        cache_ptr = mdns_ptr -> nx_mdns_peer_service_cache;
+        p = mdns_ptr -> nx_mdns_peer_rr_hash[_nx_mdns_cache_rr_hash_index(record_ptr -> nx_mdns_rr_name)];
     }
 
-    /* Get head. */
-    head = (ULONG*)cache_ptr;
-    head = (ULONG*)(*head);
-
     /* Find the same record.  */
-    for(p = (NX_MDNS_RR*)((UCHAR*)cache_ptr + sizeof(ULONG)); (ULONG*)p < head; p++)
+    for(; p; p = p -> nx_mdns_rr_hash_next)
     {
 
         /* Check the interface index.  */
@@ -12540,8 +12794,8 @@ VOID _nx_mdns_cache_delete_rr_string(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_mdns_additional_resource_record_find            PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_mdns_additional_resource_record_find            PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -12574,17 +12828,16 @@ VOID _nx_mdns_cache_delete_rr_string(NX_MDNS *mdns_ptr, UINT cache_type, NX_MDNS
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            lookup by record name index,*/
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_mdns_additional_resource_record_find(NX_MDNS *mdns_ptr, NX_MDNS_RR *record_ptr)
 {
     
-ULONG           *head;
 NX_MDNS_RR      *p;
 
-    head = (ULONG*)mdns_ptr -> nx_mdns_local_service_cache;
-    head = (ULONG*)(*head);
-
     /* Find the additional resource records according to the type.  */
     switch (record_ptr -> nx_mdns_rr_type )
     {   
@@ -12603,8 +12856,9 @@ NX_MDNS_RR      *p;
         case NX_MDNS_RR_TYPE_PTR:
         {
 
-            /* Find the additional resource record.  */
-            for (p = (NX_MDNS_RR*)((UCHAR*)mdns_ptr -> nx_mdns_local_service_cache + sizeof(ULONG)); (ULONG*)p < head; p++)
+            /* Find the additional resource record named in the PTR rdata.  */
+            for (p = mdns_ptr -> nx_mdns_local_rr_hash[_nx_mdns_cache_rr_hash_index(record_ptr -> nx_mdns_rr_rdata.nx_mdns_rr_rdata_ptr.nx_mdns_rr_ptr_name)];
+                 p; p = p -> nx_mdns_rr_hash_next)
             {   
 
                 /* Check the interface.  */
@@ -12654,8 +12908,9 @@ NX_MDNS_RR      *p;
         {
                     
 #ifdef NX_MDNS_ENABLE_SERVER_NEGATIVE_RESPONSES
-            /* Find the additional resource record.  */
-            for (p = (NX_MDNS_RR*)((UCHAR*)mdns_ptr -> nx_mdns_local_service_cache + sizeof(ULONG)); (ULONG*)p < head; p++)
+            /* Find the additional resource record named same as SRV/TXT name.  */
+            for (p = mdns_ptr -> nx_mdns_local_rr_hash[_nx_mdns_cache_rr_hash_index(record_ptr -> nx_mdns_rr_name)];
+                 p; p = p -> nx_mdns_rr_hash_next)
             {
 
                 /* Check the interface.  */
@@ -12692,8 +12947,8 @@ NX_MDNS_RR      *p;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_mdns_additional_a_aaaa_find                     PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_mdns_additional_a_aaaa_find                     PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -12727,20 +12982,19 @@ NX_MDNS_RR      *p;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            lookup by record name index,*/
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID _nx_mdns_additional_a_aaaa_find(NX_MDNS *mdns_ptr, UCHAR *name, UINT interface_index)
 {
     
-ULONG           *head;
 NX_MDNS_RR      *p;
 
-    head = (ULONG*)mdns_ptr -> nx_mdns_local_service_cache;
-    head = (ULONG*)(*head);
-
     /* Recommends AAAA records in the additional section when responding
        to rrtype "A" queries, and vice versa. RFC6762, Section19, Page51.  */
-    for (p = (NX_MDNS_RR*)((UCHAR*)mdns_ptr -> nx_mdns_local_service_cache + sizeof(ULONG)); (ULONG*)p < head; p++)
+    for (p = mdns_ptr -> nx_mdns_local_rr_hash[_nx_mdns_cache_rr_hash_index(name)]; p; p = p -> nx_mdns_rr_hash_next)
     {
 
         /* Check the interface index.  */
@@ -12771,8 +13025,8 @@ NX_MDNS_RR      *p;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_mdns_known_answer_find                          PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_mdns_known_answer_find                          PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -12806,16 +13060,19 @@ NX_MDNS_RR      *p;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            lookup by record name index,*/
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_mdns_known_answer_find(NX_MDNS *mdns_ptr, NX_MDNS_RR *record_ptr)
 {
    
 UINT            status = NX_MDNS_NO_KNOWN_ANSWER;
-ULONG           *head, *tail;
 NX_MDNS_RR      *p;
 UINT            i;
 UINT            name_length;
+UINT            index;
 #ifndef NX_MDNS_DISABLE_SERVER
 UINT            cache_count = 2;
 #else
@@ -12828,6 +13085,9 @@ UINT            cache_count = 1;
         return(NX_MDNS_DATA_SIZE_ERROR);
     }
 
+    /* Get the name index, it is the same in both caches.  */
+    index = _nx_mdns_cache_rr_hash_index(record_ptr -> nx_mdns_rr_name);
+
     /* Loop to find the known answer in cache.  */
     for (i = 0; i < cache_count; i++)
     {
@@ -12835,18 +13095,17 @@ UINT            cache_count = 1;
         /* Set the pointer. */
         if (i == 0)
         {
-            head = (ULONG*)mdns_ptr -> nx_mdns_peer_service_cache;
+            p = mdns_ptr -> nx_mdns_peer_rr_hash[index];
         }
 #ifndef NX_MDNS_DISABLE_SERVER
         else
         {
-            head = (ULONG*)mdns_ptr -> nx_mdns_local_service_cache;
+            p = mdns_ptr -> nx_mdns_local_rr_hash[index];
         }
 #endif /* NX_MDNS_DISABLE_SERVER  */
-        tail = (ULONG*)(*head);
 
         /* Whether this mDNS message response to query. */
-        for(p = (NX_MDNS_RR*)(head + 1); (ULONG*)p < tail; p++)
+        for(; p; p = p -> nx_mdns_rr_hash_next)
         {
 
             /* Check the state.  */
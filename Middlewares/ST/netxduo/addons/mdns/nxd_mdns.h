@@ -25,7 +25,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nxd_mdns.h                                          PORTABLE C      */
-/*                                                           6.1.3        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -49,6 +49,9 @@
 /*                                            prevented infinite loop in  */
 /*                                            name compression,           */
 /*                                            resulting in version 6.1.3  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            record name index,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -387,6 +390,13 @@ extern   "C" {
 #define NX_MDNS_MAX_COMPRESSION_POINTERS        16
 #endif /* NX_MDNS_MAX_COMPRESSION_POINTERS  */
 
+/* Define the number of buckets in the record name index of each cache.
+   Records are indexed by name so that a question or a known answer only
+   checks the records with the same name. Must be a power of 2.  */
+#ifndef NX_MDNS_RR_HASH_SIZE
+#define NX_MDNS_RR_HASH_SIZE                    32
+#endif /* NX_MDNS_RR_HASH_SIZE  */
+
 
 /* Define the default mDNS's announcing value.  */
 #define NX_MDNS_ANNOUNCING_PERIOD               NX_IP_PERIODIC_RATE
@@ -1009,6 +1019,8 @@ typedef struct NX_MDNS_RR_STRUCT
  
     UCHAR   nx_mdns_rr_send_flag;               /* The flag for seding resource record.                                 */
 
+    struct NX_MDNS_RR_STRUCT *nx_mdns_rr_hash_next;  /* Next record in the same bucket of the record name index.       */
+
     USHORT  nx_mdns_rr_word;                    
 
     /* Define the state, owner, flag, set of the resource records. This word contains
@@ -1144,6 +1156,10 @@ typedef struct NX_MDNS_STRUCT
     
     UINT                    nx_mdns_peer_service_cache_size;    /* The size of cache.                       */ 
 
+    NX_MDNS_RR*             nx_mdns_local_rr_hash[NX_MDNS_RR_HASH_SIZE];    /* The name index of local records.     */
+
+    NX_MDNS_RR*             nx_mdns_peer_rr_hash[NX_MDNS_RR_HASH_SIZE];     /* The name index of peer records.      */
+
     ULONG                   nx_mdns_service_ignore_mask;        /* The mask specifying services types to be ignored.                        */
 
     ULONG                   nx_mdns_service_notify_mask;        /* The service mask for listen the service and notify the applicaiton.      */
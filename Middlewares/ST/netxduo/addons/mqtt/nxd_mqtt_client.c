@@ -48,17 +48,45 @@
 #define MQTT_NETWORK_DISCONNECT_EVENT ((ULONG)0x00000020)
 #define MQTT_TCP_ESTABLISH_EVENT      ((ULONG)0x00000040)
 
+/* Define the bookkeeping stored in front of the data of a packet on the transmit queue.
+   The packet ID must stay the first member, it is read directly from nx_packet_data_start.  */
+typedef struct NXD_MQTT_TRANSMIT_INFO_STRUCT
+{
+    USHORT     nxd_mqtt_transmit_packet_id;
+#ifdef NXD_MQTT_ZERO_COPY_PUBLISH
+    USHORT     nxd_mqtt_transmit_header_only;               /* Only the fixed header is saved.        */
+#endif /* NXD_MQTT_ZERO_COPY_PUBLISH */
+    NX_PACKET *nxd_mqtt_transmit_previous;                  /* Previous packet on the transmit queue. */
+    NX_PACKET *nxd_mqtt_transmit_index_next;                /* Next packet in the packet ID index.    */
+} NXD_MQTT_TRANSMIT_INFO;
+
 static UINT _nxd_mqtt_client_create_internal(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name,
                                              CHAR *client_id, UINT client_id_length,
                                              NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr,
                                              VOID *stack_ptr, ULONG stack_size, UINT mqtt_thread_priority);
 static UINT _nxd_mqtt_packet_allocate(NXD_MQTT_CLIENT *client_ptr, NX_PACKET **packet_ptr);
+#ifdef NX_SECURE_ENABLE
+static UINT _nxd_mqtt_client_secure_send(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, ULONG wait_option);
+#endif /* NX_SECURE_ENABLE */
 static UINT _nxd_mqtt_copy_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
                                            USHORT packet_id, UCHAR set_duplicate_flag, UINT wait_option);
-static VOID _nxd_mqtt_release_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, NX_PACKET *previous_packet_ptr);
+#ifdef NXD_MQTT_ZERO_COPY_PUBLISH
+static UINT _nxd_mqtt_save_transmit_header(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
+                                           USHORT packet_id, UINT wait_option);
+#endif /* NXD_MQTT_ZERO_COPY_PUBLISH */
+static VOID _nxd_mqtt_enqueue_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr);
+static VOID _nxd_mqtt_release_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr);
 static VOID _nxd_mqtt_release_receive_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, NX_PACKET *previous_packet_ptr);
 static UINT _nxd_mqtt_client_retransmit_message(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option);
 static UINT _nxd_mqtt_client_connect_packet_send(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option);
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
+static UINT _nxd_mqtt_topic_level_hash(UINT parent_index, UCHAR *level, UINT level_length);
+static NXD_MQTT_TOPIC_NODE *_nxd_mqtt_topic_node_find(NXD_MQTT_CLIENT *client_ptr, NXD_MQTT_TOPIC_NODE *parent_ptr,
+                                                      UCHAR *level, UINT level_length);
+static VOID _nxd_mqtt_topic_node_release(NXD_MQTT_CLIENT *client_ptr, NXD_MQTT_TOPIC_NODE *node_ptr);
+static UINT _nxd_mqtt_topic_filter_check(UCHAR *topic_filter, UINT topic_filter_length);
+static UINT _nxd_mqtt_topic_dispatch(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr);
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 
 /**************************************************************************/
 /*                                                                        */
@@ -246,7 +274,7 @@ ULONG  bytes_copied;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nxd_mqtt_client_sub_unsub                          PORTABLE C      */
-/*                                                           6.1.2        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -283,7 +311,7 @@ ULONG  bytes_copied;
 /*    _nxd_mqtt_client_append_message                                     */
 /*    tx_mutex_put                                                        */
 /*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_secure_send                                        */
 /*    nx_packet_release                                                   */
 /*    _nxd_mqtt_copy_transmit_packet                                      */
 /*                                                                        */
@@ -302,6 +330,9 @@ ULONG  bytes_copied;
 /*  11-09-2020     Yuxin Zhou               Modified comment(s), and      */
 /*                                            added packet id parameter,  */
 /*                                            resulting in version 6.1.2  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            packet ID index,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nxd_mqtt_client_sub_unsub(NXD_MQTT_CLIENT *client_ptr, UINT op,
@@ -438,15 +469,8 @@ UCHAR               temp_data[2];
         return(NXD_MQTT_PACKET_POOL_FAILURE);
     }
 
-    if (client_ptr -> message_transmit_queue_head == NX_NULL)
-    {
-        client_ptr -> message_transmit_queue_head = transmit_packet_ptr;
-    }
-    else
-    {
-        client_ptr -> message_transmit_queue_tail -> nx_packet_queue_next = transmit_packet_ptr;
-    }
-    client_ptr -> message_transmit_queue_tail = transmit_packet_ptr;
+    /* Queue the packet until it is acknowledged. */
+    _nxd_mqtt_enqueue_transmit_packet(client_ptr, transmit_packet_ptr);
 
     client_ptr -> nxd_mqtt_client_packet_identifier = (client_ptr -> nxd_mqtt_client_packet_identifier + 1) & 0xFFFF;
 
@@ -464,7 +488,7 @@ UCHAR               temp_data[2];
 #ifdef NX_SECURE_ENABLE
     if (client_ptr -> nxd_mqtt_client_use_tls)
     {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, NX_WAIT_FOREVER);
+        status = _nxd_mqtt_client_secure_send(client_ptr, packet_ptr, NX_WAIT_FOREVER);
     }
     else
     {
@@ -528,6 +552,7 @@ UCHAR               temp_data[2];
 /*    _nxd_mqtt_process_publish                                           */
 /*    _nxd_mqtt_client_connect                                            */
 /*    _nxd_mqtt_client_publish                                            */
+/*    _nxd_mqtt_client_publish_packet_allocate                            */
 /*    _nxd_mqtt_client_subscribe                                          */
 /*    _nxd_mqtt_client_unsubscribe                                        */
 /*    _nxd_mqtt_client_send_simple_message                                */
@@ -578,6 +603,75 @@ UINT status = NXD_MQTT_SUCCESS;
     return(NXD_MQTT_SUCCESS);
 }
 
+#ifdef NX_SECURE_ENABLE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_secure_send                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function sends one MQTT control packet over the TLS   */
+/*    session and then flushes the session, so a message is not held back */
+/*    by TLS record coalescing while the MQTT thread polls for the reply. */
+/*                                                                        */
+/*    A failed flush is not returned. TLS already owns the packet at that */
+/*    point and has reset the session, so the error is reported by the    */
+/*    next send or receive instead.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    packet_ptr                            Packet to send                */
+/*    wait_option                           Timeout value                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_tls_session_send            Send data over TLS session    */
+/*    nx_secure_tls_session_flush           Send coalesced TLS data       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_sub_unsub                                          */
+/*    _nxd_mqtt_process_publish                                           */
+/*    _nxd_mqtt_process_publish_response                                  */
+/*    _nxd_mqtt_client_retransmit_message                                 */
+/*    _nxd_mqtt_client_connect_packet_send                                */
+/*    _nxd_mqtt_client_publish_packet_send                                */
+/*    _nxd_mqtt_send_simple_message                                       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nxd_mqtt_client_secure_send(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, ULONG wait_option)
+{
+UINT status;
+
+    status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, wait_option);
+    if (status == NX_SUCCESS)
+    {
+
+        /* Send the record now if the application enabled coalescing on the session. */
+        nx_secure_tls_session_flush(&(client_ptr -> nxd_mqtt_tls_session), wait_option);
+    }
+
+    return(status);
+}
+#endif /* NX_SECURE_ENABLE */
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -768,6 +862,12 @@ UINT status;
     /* Save packet_id at the beginning of packet. */
     *((USHORT *)(*new_packet_ptr) -> nx_packet_data_start) = packet_id;
 
+#ifdef NXD_MQTT_ZERO_COPY_PUBLISH
+    /* The whole message is saved. */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    ((NXD_MQTT_TRANSMIT_INFO *)(*new_packet_ptr) -> nx_packet_data_start) -> nxd_mqtt_transmit_header_only = NX_FALSE;
+#endif /* NXD_MQTT_ZERO_COPY_PUBLISH */
+
     if (set_duplicate_flag)
     {
         
@@ -778,12 +878,165 @@ UINT status;
     return(NXD_MQTT_SUCCESS);
 }
 
+#ifdef NXD_MQTT_ZERO_COPY_PUBLISH
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_save_transmit_header                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function saves only the fixed header of a QoS 1       */
+/*    PUBLISH message. With a clean session, the message is never         */
+/*    retransmitted, so the stored packet is only used to match the       */
+/*    PUBACK, and the message itself is not copied. The packet is marked  */
+/*    as header only, so a later reconnect without a clean session drops  */
+/*    it instead of sending it.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                        Pointer to MQTT Client            */
+/*    packet_ptr                        Pointer to the MQTT message       */
+/*                                        packet to be saved              */
+/*    new_packet_ptr                    Return a saved packet             */
+/*    packet_id                         Current packet ID                 */
+/*    wait_option                       Timeout value                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                                              */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_allocate                                                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_publish_packet_send                                */
+/*                                                                        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nxd_mqtt_save_transmit_header(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, NX_PACKET **new_packet_ptr,
+                                           USHORT packet_id, UINT wait_option)
+{
+UINT status;
+
+    /* Allocate a packet with the same headroom as the message packet. */
+    status = nx_packet_allocate(client_ptr -> nxd_mqtt_client_packet_pool_ptr, new_packet_ptr,
+                                (ULONG)(packet_ptr -> nx_packet_prepend_ptr - packet_ptr -> nx_packet_data_start), wait_option);
+    if (status)
+    {
+
+        /* No available packet to be stored. */
+        return(NXD_MQTT_PACKET_POOL_FAILURE);
+    }
+
+    /* Save packet_id at the beginning of packet. */
+    *((USHORT *)(*new_packet_ptr) -> nx_packet_data_start) = packet_id;
+
+    /* Mark the packet so it is never retransmitted. */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    ((NXD_MQTT_TRANSMIT_INFO *)(*new_packet_ptr) -> nx_packet_data_start) -> nxd_mqtt_transmit_header_only = NX_TRUE;
+
+    /* Save the fixed header with the duplicate flag set. */
+    *((*new_packet_ptr) -> nx_packet_prepend_ptr) = (*(packet_ptr -> nx_packet_prepend_ptr)) | MQTT_PUBLISH_DUP_FLAG;
+    (*new_packet_ptr) -> nx_packet_append_ptr = (*new_packet_ptr) -> nx_packet_prepend_ptr + 1;
+    (*new_packet_ptr) -> nx_packet_length = 1;
+
+    return(NXD_MQTT_SUCCESS);
+}
+#endif /* NXD_MQTT_ZERO_COPY_PUBLISH */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_enqueue_transmit_packet                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function appends a stored transmit packet to the      */
+/*    transmit queue and adds it to the packet ID index, so that the      */
+/*    acknowledgement of the packet is matched without walking the queue. */
+/*    The queue and index links are kept in front of the packet data,     */
+/*    next to the packet ID. Stored packets are never sent themselves.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                        Pointer to MQTT Client            */
+/*    packet_ptr                        Pointer to the MQTT message       */
+/*                                        packet to be queued             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_sub_unsub                                          */
+/*    _nxd_mqtt_process_publish                                           */
+/*    _nxd_mqtt_client_publish_packet_send                                */
+/*                                                                        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nxd_mqtt_enqueue_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr)
+{
+NXD_MQTT_TRANSMIT_INFO *info_ptr;
+NX_PACKET             **index_ptr;
+
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    info_ptr = (NXD_MQTT_TRANSMIT_INFO *)packet_ptr -> nx_packet_data_start;
+
+    /* Append the packet to the transmit queue. */
+    info_ptr -> nxd_mqtt_transmit_previous = client_ptr -> message_transmit_queue_tail;
+    packet_ptr -> nx_packet_queue_next = NX_NULL;
+    if (client_ptr -> message_transmit_queue_head == NX_NULL)
+    {
+        client_ptr -> message_transmit_queue_head = packet_ptr;
+    }
+    else
+    {
+        client_ptr -> message_transmit_queue_tail -> nx_packet_queue_next = packet_ptr;
+    }
+    client_ptr -> message_transmit_queue_tail = packet_ptr;
+
+    /* Add the packet to the packet ID index. */
+    index_ptr = &(client_ptr -> message_transmit_index[info_ptr -> nxd_mqtt_transmit_packet_id & (NXD_MQTT_TRANSMIT_INDEX_SIZE - 1)]);
+    info_ptr -> nxd_mqtt_transmit_index_next = *index_ptr;
+    *index_ptr = packet_ptr;
+}
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nxd_mqtt_release_transmit_packet                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -801,8 +1054,6 @@ UINT status;
 /*    client_ptr                            Pointer to MQTT Client        */
 /*    packet_ptr                            Pointer to the MQTT message   */
 /*                                            packet to be removed        */
-/*    previous_packet_ptr                   Pointer to the previous packet*/
-/*                                            or NULL if none exists      */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -810,7 +1061,7 @@ UINT status;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    nx_packet_release                     Release packet                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -824,10 +1075,20 @@ UINT status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            packet ID index,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nxd_mqtt_release_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, NX_PACKET *previous_packet_ptr)
+static VOID _nxd_mqtt_release_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr)
 {
+NXD_MQTT_TRANSMIT_INFO *info_ptr;
+NX_PACKET             **index_ptr;
+NX_PACKET              *previous_packet_ptr;
+
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    info_ptr = (NXD_MQTT_TRANSMIT_INFO *)packet_ptr -> nx_packet_data_start;
+    previous_packet_ptr = info_ptr -> nxd_mqtt_transmit_previous;
 
     if (previous_packet_ptr)
     {
@@ -842,6 +1103,24 @@ static VOID _nxd_mqtt_release_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PA
     {
         client_ptr -> message_transmit_queue_tail = previous_packet_ptr;
     }
+    else
+    {
+
+        /* Link the next packet back to the previous one. */
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ((NXD_MQTT_TRANSMIT_INFO *)packet_ptr -> nx_packet_queue_next -> nx_packet_data_start) -> nxd_mqtt_transmit_previous = previous_packet_ptr;
+    }
+
+    /* Remove the packet from the packet ID index. */
+    index_ptr = &(client_ptr -> message_transmit_index[info_ptr -> nxd_mqtt_transmit_packet_id & (NXD_MQTT_TRANSMIT_INDEX_SIZE - 1)]);
+    while (*index_ptr != packet_ptr)
+    {
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        index_ptr = &(((NXD_MQTT_TRANSMIT_INFO *)(*index_ptr) -> nx_packet_data_start) -> nxd_mqtt_transmit_index_next);
+    }
+    *index_ptr = info_ptr -> nxd_mqtt_transmit_index_next;
+
+    packet_ptr -> nx_packet_queue_next = NX_NULL;
     nx_packet_release(packet_ptr);
 }
 
@@ -1163,481 +1442,544 @@ ULONG  bytes_copied;
     /* Return */
     return(NXD_MQTT_SUCCESS);
 }
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_process_publish                           PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_topic_level_hash                          PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function process a publish message from the broker.   */
+/*    This internal function computes the hash bucket of one topic level. */
+/*    The level is hashed together with the node number of its parent, so */
+/*    the same level string under different parents falls into different  */
+/*    buckets.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    parent_index                          Node number of the parent     */
+/*    level                                 Pointer to the level string   */
+/*    level_length                          Length of the level           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    hash                                  Hash value of the level       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_topic_node_find                                           */
+/*    _nxd_mqtt_topic_node_release                                        */
 /*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nxd_mqtt_topic_level_hash(UINT parent_index, UCHAR *level, UINT level_length)
+{
+UINT hash;
+UINT i;
+
+    /* FNV-1a over the parent node number and the level string. */
+    hash = 2166136261u ^ parent_index;
+    for (i = 0; i < level_length; i++)
+    {
+        hash = (hash ^ level[i]) * 16777619u;
+    }
+
+    return(hash ^ (hash >> 16));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_topic_node_find                           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function finds the child of a topic filter trie node  */
+/*    for one level. The '+' and '#' levels are kept in dedicated links of*/
+/*    the parent; all other levels are looked up in the level hash table. */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    packet_ptr                            Pointer to the packet         */
+/*    parent_ptr                            Pointer to the parent node    */
+/*    level                                 Pointer to the level string   */
+/*    level_length                          Length of the level           */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    NX_TRUE - packet is consumed                                        */
-/*    NX_FALSE - packet is not consumed                                   */
+/*    node_ptr                              Pointer to the child node, or */
+/*                                            NX_NULL if not found        */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    [receive_notify]                      User supplied receive         */
-/*                                            callback function           */
-/*    _nxd_mqtt_packet_allocate                                           */
-/*    nx_tcp_socket_send                                                  */
-/*    nx_packet_release                                                   */
-/*    nx_secure_tls_session_send                                          */
-/*    _nxd_mqtt_process_publish_packet                                    */
-/*    _nxd_mqtt_copy_transmit_packet                                      */
-/*                                                                        */
+/*    _nxd_mqtt_topic_level_hash                                          */
+/*    NXD_MQTT_SECURE_MEMCMP                                              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nxd_mqtt_packet_receive_process                                    */
+/*    _nxd_mqtt_topic_dispatch                                            */
+/*    _nxd_mqtt_client_topic_filter_add                                   */
+/*    _nxd_mqtt_client_topic_filter_remove                                */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-static UINT _nxd_mqtt_process_publish(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr)
+static NXD_MQTT_TOPIC_NODE *_nxd_mqtt_topic_node_find(NXD_MQTT_CLIENT *client_ptr, NXD_MQTT_TOPIC_NODE *parent_ptr,
+                                                      UCHAR *level, UINT level_length)
 {
-MQTT_PACKET_PUBLISH_RESPONSE *pubresp_ptr;
-UINT                          status;
-USHORT                        packet_id = 0;
-UCHAR                         QoS;
-UINT                          enqueue_message = 0;
-NX_PACKET                    *transmit_packet_ptr;
-UINT                          remaining_length = 0;
-UINT                          packet_consumed = NX_FALSE;
-UCHAR                         fixed_header;
-USHORT                        transmit_packet_id;
-UINT                          topic_length;
-ULONG                         offset;
-UCHAR                         bytes[2];
-ULONG                         bytes_copied;
-
-    QoS = (UCHAR)((*(packet_ptr -> nx_packet_prepend_ptr) & MQTT_PUBLISH_QOS_LEVEL_FIELD) >> 1);
+NXD_MQTT_TOPIC_NODE *node_ptr;
+UINT                 hash;
 
-    if (_nxd_mqtt_read_remaining_length(packet_ptr, &remaining_length, &offset))
+    if (level_length == 1)
     {
-        return(NX_FALSE);
+        if (*level == '+')
+        {
+            return(parent_ptr -> nxd_mqtt_topic_node_single_level);
+        }
+        else if (*level == '#')
+        {
+            return(parent_ptr -> nxd_mqtt_topic_node_multi_level);
+        }
     }
 
-    if (remaining_length < 2)
+    hash = _nxd_mqtt_topic_level_hash(parent_ptr -> nxd_mqtt_topic_node_index, level, level_length);
+    node_ptr = client_ptr -> nxd_mqtt_topic_hash[hash & (client_ptr -> nxd_mqtt_topic_hash_size - 1)];
+
+    while (node_ptr)
     {
-        return(NXD_MQTT_INVALID_PACKET);
+        if ((node_ptr -> nxd_mqtt_topic_node_parent == parent_ptr) &&
+            (node_ptr -> nxd_mqtt_topic_node_level_length == level_length) &&
+            (NXD_MQTT_SECURE_MEMCMP(node_ptr -> nxd_mqtt_topic_node_level, level, level_length) == 0))
+        {
+            break;
+        }
+        node_ptr = node_ptr -> nxd_mqtt_topic_node_hash_next;
     }
 
-    /* Get topic length fields. */
-    if (nx_packet_data_extract_offset(packet_ptr, offset, &bytes, sizeof(bytes), &bytes_copied) ||
-        (bytes_copied != sizeof(bytes)))
-    {
-        return(NXD_MQTT_INVALID_PACKET);
-    }
+    return(node_ptr);
+}
 
-    topic_length = (UINT)(*(bytes) << 8) | (*(bytes + 1));
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_topic_node_release                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function drops one filter reference from a node and   */
+/*    all its ancestors. Nodes no longer used by any filter are unlinked  */
+/*    from the trie and returned to the free list.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    node_ptr                              Pointer to the last node of   */
+/*                                            the topic filter            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_mqtt_topic_level_hash                                          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_topic_filter_add                                   */
+/*    _nxd_mqtt_client_topic_filter_remove                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nxd_mqtt_topic_node_release(NXD_MQTT_CLIENT *client_ptr, NXD_MQTT_TOPIC_NODE *node_ptr)
+{
+NXD_MQTT_TOPIC_NODE  *parent_ptr;
+NXD_MQTT_TOPIC_NODE **link_ptr;
+UINT                  hash;
 
-    if (topic_length > remaining_length - 2u)
+    while (node_ptr != &(client_ptr -> nxd_mqtt_topic_root))
     {
-        return(NXD_MQTT_INVALID_PACKET);
-    }
+        parent_ptr = node_ptr -> nxd_mqtt_topic_node_parent;
 
-    if (QoS == 0)
-    {
-        enqueue_message = 1;
-    }
-    else
-    {
-        /* QoS 1 or QoS 2 messages. */
-        /* Get packet id fields. */
-        if (nx_packet_data_extract_offset(packet_ptr, offset + 2 + topic_length, &bytes, sizeof(bytes), &bytes_copied))
+        node_ptr -> nxd_mqtt_topic_node_reference--;
+        if (node_ptr -> nxd_mqtt_topic_node_reference == 0)
         {
-            return(NXD_MQTT_INVALID_PACKET);
-        }
-
-        packet_id = (USHORT)(((*bytes) << 8) | (*(bytes + 1)));
 
-        /* Look for an existing transmit packets with the same packet id */
-        transmit_packet_ptr = client_ptr -> message_transmit_queue_head;
-
-        while (transmit_packet_ptr)
-        {
-            fixed_header = *(transmit_packet_ptr -> nx_packet_prepend_ptr);
-            transmit_packet_id = *((USHORT *)transmit_packet_ptr -> nx_packet_data_start);
-            if ((transmit_packet_id == packet_id) &&
-                ((fixed_header & 0xF0) == (MQTT_CONTROL_PACKET_TYPE_PUBREC << 4)))
+            /* Unlink the node from its parent. */
+            if (parent_ptr -> nxd_mqtt_topic_node_single_level == node_ptr)
             {
-
-                /* Found a packet containing the packet_id */
-                break;
+                parent_ptr -> nxd_mqtt_topic_node_single_level = NX_NULL;
             }
-            transmit_packet_ptr = transmit_packet_ptr -> nx_packet_queue_next;
-        }
-
-        if (transmit_packet_ptr)
-        {
-            /* This published data is already in our system.  No need to deliver this message to the application. */
-            enqueue_message = 0;
-        }
-        else
-        {
-            enqueue_message = 1;
-        }
-    }
-
-    if (enqueue_message)
-    {
-        if (packet_ptr -> nx_packet_length > (offset + remaining_length))
-        {
-
-            /* This packet contains multiple messages. */
-            if (nx_packet_copy(packet_ptr, &packet_ptr, client_ptr -> nxd_mqtt_client_packet_pool_ptr, NX_NO_WAIT))
+            else if (parent_ptr -> nxd_mqtt_topic_node_multi_level == node_ptr)
             {
-
-                /* No packet is available. */
-                return(NX_FALSE);
+                parent_ptr -> nxd_mqtt_topic_node_multi_level = NX_NULL;
+            }
+            else
+            {
+                hash = _nxd_mqtt_topic_level_hash(parent_ptr -> nxd_mqtt_topic_node_index,
+                                                  node_ptr -> nxd_mqtt_topic_node_level,
+                                                  node_ptr -> nxd_mqtt_topic_node_level_length);
+                link_ptr = &(client_ptr -> nxd_mqtt_topic_hash[hash & (client_ptr -> nxd_mqtt_topic_hash_size - 1)]);
+                while (*link_ptr != node_ptr)
+                {
+                    link_ptr = &((*link_ptr) -> nxd_mqtt_topic_node_hash_next);
+                }
+                *link_ptr = node_ptr -> nxd_mqtt_topic_node_hash_next;
             }
-        }
-        else
-        {
-            packet_consumed = NX_TRUE;
-        }
-
-        /* Increment the queue depth counter. */
-        client_ptr -> message_receive_queue_depth++;
-
-        if (client_ptr -> message_receive_queue_head == NX_NULL)
-        {
-            client_ptr -> message_receive_queue_head = packet_ptr;
-        }
-        else
-        {
-            client_ptr -> message_receive_queue_tail -> nx_packet_queue_next = packet_ptr;
-        }
-        client_ptr -> message_receive_queue_tail = packet_ptr;
 
-        /* Invoke the user-defined receive notify function if it is set. */
-        if (client_ptr -> nxd_mqtt_client_receive_notify)
-        {
-            (*(client_ptr -> nxd_mqtt_client_receive_notify))(client_ptr, client_ptr -> message_receive_queue_depth);
+            /* Return the node to the free list. */
+            node_ptr -> nxd_mqtt_topic_node_notify = NX_NULL;
+            node_ptr -> nxd_mqtt_topic_node_hash_next = client_ptr -> nxd_mqtt_topic_free_list;
+            client_ptr -> nxd_mqtt_topic_free_list = node_ptr;
         }
-    }
-
-    /* If the message QoS level is 0, we are done. */
-    if (QoS == 0)
-    {
-        /* Return */
-        return(packet_consumed);
-    }
 
-    /* Send out proper ACKs for QoS 1 and 2 messages. */
-    /* Allocate a new packet so we can send out a response. */
-    status = _nxd_mqtt_packet_allocate(client_ptr, &packet_ptr);
-    if (status)
-    {
-        /* Packet allocation fails. */
-        return(packet_consumed);
+        node_ptr = parent_ptr;
     }
+}
 
-    /* Fill in the packet ID */
-    pubresp_ptr = (MQTT_PACKET_PUBLISH_RESPONSE *)(packet_ptr -> nx_packet_prepend_ptr);
-    pubresp_ptr -> mqtt_publish_response_packet_remaining_length = 2;
-    pubresp_ptr -> mqtt_publish_response_packet_packet_identifier_msb = (UCHAR)(packet_id >> 8);
-    pubresp_ptr -> mqtt_publish_response_packet_packet_identifier_lsb = (UCHAR)(packet_id & 0xFF);
-
-    if (QoS == 1)
-    {
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_topic_filter_check                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function validates a topic filter. Wildcards must take*/
+/*    a whole level, '#' must be the last level, and no level may be      */
+/*    longer than NXD_MQTT_TOPIC_LEVEL_SIZE.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    topic_filter                          Pointer to the topic filter   */
+/*    topic_filter_length                   Length of the topic filter    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_topic_filter_add                                   */
+/*    _nxd_mqtt_client_topic_filter_remove                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nxd_mqtt_topic_filter_check(UCHAR *topic_filter, UINT topic_filter_length)
+{
+UINT level_length = 0;
+UINT i;
 
-        pubresp_ptr -> mqtt_publish_response_packet_header = MQTT_CONTROL_PACKET_TYPE_PUBACK << 4;
-    }
-    else
+    if (topic_filter_length == 0)
     {
-        pubresp_ptr -> mqtt_publish_response_packet_header = MQTT_CONTROL_PACKET_TYPE_PUBREC << 4;
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + sizeof(MQTT_PACKET_PUBLISH_RESPONSE);
-    packet_ptr -> nx_packet_length = sizeof(MQTT_PACKET_PUBLISH_RESPONSE);
-
-    if (QoS == 2)
+    for (i = 0; i < topic_filter_length; i++)
     {
-
-        /* Copy packet for checking duplicate publish packet. */
-        if (_nxd_mqtt_copy_transmit_packet(client_ptr, packet_ptr, &transmit_packet_ptr,
-                                           packet_id, NX_FALSE, NX_WAIT_FOREVER))
-        {
-
-            /* Release the packet. */
-            nx_packet_release(packet_ptr);
-            return(packet_consumed);
-        }
-        if (client_ptr -> message_transmit_queue_head == NX_NULL)
+        if (topic_filter[i] == '/')
         {
-            client_ptr -> message_transmit_queue_head = transmit_packet_ptr;
+            level_length = 0;
+            continue;
         }
-        else
+
+        level_length++;
+        if (level_length > NXD_MQTT_TOPIC_LEVEL_SIZE)
         {
-            client_ptr -> message_transmit_queue_tail -> nx_packet_queue_next = transmit_packet_ptr;
+            return(NXD_MQTT_INVALID_PARAMETER);
         }
-        client_ptr -> message_transmit_queue_tail = transmit_packet_ptr;
-    }
-
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-#ifdef NX_SECURE_ENABLE
-    if (client_ptr -> nxd_mqtt_client_use_tls)
-    {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, NX_WAIT_FOREVER);
-    }
-    else
-    {
-        status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, NX_WAIT_FOREVER);
-    }
-#else
-    status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, NX_WAIT_FOREVER);
 
-#endif /* NX_SECURE_ENABLE */
+        if ((topic_filter[i] == '+') || (topic_filter[i] == '#'))
+        {
 
-    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
-    if (status)
-    {
+            /* The wildcard must take the whole level. */
+            if ((level_length != 1) ||
+                ((i + 1 < topic_filter_length) && (topic_filter[i + 1] != '/')))
+            {
+                return(NXD_MQTT_INVALID_PARAMETER);
+            }
 
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-    }
-    else
-    {
-        /* Update the timeout value. */
-        client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
+            /* The multi-level wildcard must be the last level. */
+            if ((topic_filter[i] == '#') && (i + 1 != topic_filter_length))
+            {
+                return(NXD_MQTT_INVALID_PARAMETER);
+            }
+        }
     }
 
-    /* Return */
-    return(packet_consumed);
+    return(NXD_MQTT_SUCCESS);
 }
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_process_publish_response                  PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_topic_dispatch                            PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function process a publish response messages.         */
-/*    Publish Response messages are: PUBACK, PUBREC, PUBREL               */
+/*    This internal function matches the topic of a received PUBLISH      */
+/*    message against the topic filter trie, and invokes the callback of  */
+/*    every matching filter. Each topic level is matched against the      */
+/*    exact, '+' and '#' children of the nodes matched so far, so the cost*/
+/*    grows with the topic depth, not with the number of filters.         */
+/*                                                                        */
+/*    The message is not dispatched, and is left to the receive queue, if */
+/*    the topic spans more than one packet or matches more than           */
+/*    NXD_MQTT_TOPIC_MATCH_SIZE nodes on one level.                       */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    packet_ptr                            Pointer to the packet         */
+/*    packet_ptr                            Pointer to the PUBLISH packet */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    Status                                                              */
+/*    NX_TRUE - message is dispatched                                     */
+/*    NX_FALSE - message is not dispatched                                */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    [nxd_mqtt_client_receive_notify]      User supplied publish         */
+/*    _nxd_mqtt_process_publish_packet                                    */
+/*    _nxd_mqtt_topic_node_find                                           */
+/*    [nxd_mqtt_topic_node_notify]          User supplied topic filter    */
 /*                                            callback function           */
-/*    _nxd_mqtt_release_transmit_packet                                   */
-/*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
-/*                                                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nxd_mqtt_packet_receive_process                                    */
+/*    _nxd_mqtt_process_publish                                           */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            added ack receive notify,   */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-static UINT _nxd_mqtt_process_publish_response(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr)
+static UINT _nxd_mqtt_topic_dispatch(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr)
 {
-MQTT_PACKET_PUBLISH_RESPONSE *response_ptr;
-USHORT                        packet_id;
-NX_PACKET                    *previous_packet_ptr;
-NX_PACKET                    *transmit_packet_ptr;
-NX_PACKET                    *response_packet;
-UINT                          ret;
-UCHAR                         fixed_header;
-USHORT                        transmit_packet_id;
-
-    response_ptr = (MQTT_PACKET_PUBLISH_RESPONSE *)(packet_ptr -> nx_packet_prepend_ptr);
+NXD_MQTT_TOPIC_NODE *current_nodes[NXD_MQTT_TOPIC_MATCH_SIZE];
+NXD_MQTT_TOPIC_NODE *next_nodes[NXD_MQTT_TOPIC_MATCH_SIZE];
+NXD_MQTT_TOPIC_NODE *matched_nodes[NXD_MQTT_TOPIC_MATCH_SIZE];
+NXD_MQTT_TOPIC_NODE *node_ptr;
+NXD_MQTT_TOPIC_NODE *child_ptr;
+UINT                 current_count;
+UINT                 next_count;
+UINT                 matched_count = 0;
+UINT                 i;
+ULONG                topic_offset;
+USHORT               topic_length;
+ULONG                message_offset;
+ULONG                message_length;
+UCHAR               *topic;
+UCHAR               *topic_end;
+UCHAR               *level;
+UINT                 level_length;
+
+    /* Check if topic filters are in use. */
+    if ((client_ptr -> nxd_mqtt_topic_hash == NX_NULL) ||
+        (client_ptr -> nxd_mqtt_topic_root.nxd_mqtt_topic_node_reference == 0))
+    {
+        return(NX_FALSE);
+    }
 
-    /* Validate the packet. */
-    if (response_ptr -> mqtt_publish_response_packet_remaining_length != 2)
+    if (_nxd_mqtt_process_publish_packet(packet_ptr, &topic_offset, &topic_length, &message_offset, &message_length))
     {
-        /* Invalid remaining_length value. Return 1 so the caller can release
-           the packet. */
+        return(NX_FALSE);
+    }
 
-        return(1);
+    /* The topic must be contiguous in the first packet. */
+    if ((ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr) < (topic_offset + topic_length))
+    {
+        return(NX_FALSE);
     }
 
-    packet_id = (USHORT)((response_ptr -> mqtt_publish_response_packet_packet_identifier_msb << 8) |
-                         (response_ptr -> mqtt_publish_response_packet_packet_identifier_lsb));
+    topic = packet_ptr -> nx_packet_prepend_ptr + topic_offset;
+    topic_end = topic + topic_length;
+    level = topic;
+    current_nodes[0] = &(client_ptr -> nxd_mqtt_topic_root);
+    current_count = 1;
 
-    /* Search all the outstanding transmitted packets for a match. */
-    previous_packet_ptr = NX_NULL;
-    transmit_packet_ptr = client_ptr -> message_transmit_queue_head;
-    while (transmit_packet_ptr)
+    for (;;)
     {
-        fixed_header = *(transmit_packet_ptr -> nx_packet_prepend_ptr);
-        transmit_packet_id = *((USHORT *)transmit_packet_ptr -> nx_packet_data_start);
-        if (transmit_packet_id == packet_id)
+
+        /* Find the end of this level. */
+        level_length = 0;
+        while (((level + level_length) < topic_end) && (level[level_length] != '/'))
         {
+            level_length++;
+        }
 
-            /* Found the matching packet id */
-            if (((response_ptr -> mqtt_publish_response_packet_header) >> 4) == MQTT_CONTROL_PACKET_TYPE_PUBACK)
+        next_count = 0;
+        for (i = 0; i < current_count; i++)
+        {
+            node_ptr = current_nodes[i];
+
+            /* Topics starting with '$' are not matched by wildcards on the first level. */
+            if ((level != topic) || (topic_length == 0) || (*topic != '$'))
             {
 
-                /* PUBACK is the response to a PUBLISH packet with QoS Level 1*/
-                /* Therefore we verify that packet contains PUBLISH packet with QoS level 1*/
-                if ((fixed_header & 0xF6) == ((MQTT_CONTROL_PACKET_TYPE_PUBLISH << 4) | MQTT_PUBLISH_QOS_LEVEL_1))
+                /* '#' matches this level and everything below it. */
+                child_ptr = node_ptr -> nxd_mqtt_topic_node_multi_level;
+                if (child_ptr && child_ptr -> nxd_mqtt_topic_node_notify)
                 {
-
-                    /* Check ack notify function.  */
-                    if (client_ptr -> nxd_mqtt_ack_receive_notify)
+                    if (matched_count == NXD_MQTT_TOPIC_MATCH_SIZE)
                     {
-
-                        /* Call notify function. Note: user routine should not release the packet.  */
-                        client_ptr -> nxd_mqtt_ack_receive_notify(client_ptr, MQTT_CONTROL_PACKET_TYPE_PUBACK, packet_id, transmit_packet_ptr, client_ptr -> nxd_mqtt_ack_receive_context);
+                        return(NX_FALSE);
                     }
-
-                    /* QoS Level1 message receives an ACK. */
-                    /* This message can be released. */
-                    _nxd_mqtt_release_transmit_packet(client_ptr, transmit_packet_ptr, previous_packet_ptr);
-
-                    /* Return with value 1, so the caller will release packet_ptr */
-                    return(1);
+                    matched_nodes[matched_count++] = child_ptr;
                 }
-            }
-            else if (((response_ptr -> mqtt_publish_response_packet_header) >> 4) == MQTT_CONTROL_PACKET_TYPE_PUBREL)
-            {
 
-                /* QoS 2 publish Release received, part 2. */
-                /* Therefore we verify that packet contains PUBLISH packet with QoS level 2*/
-                if ((fixed_header & 0xF6) == (MQTT_CONTROL_PACKET_TYPE_PUBREC << 4))
+                /* '+' matches this level. */
+                child_ptr = node_ptr -> nxd_mqtt_topic_node_single_level;
+                if (child_ptr)
                 {
-
-                    /* QoS Level2 message receives an ACK. */
-                    /* This message can be released. */
-                    /* Send PUBCOMP */
-
-                    /* Allocate a packet to send the response. */
-                    ret = _nxd_mqtt_packet_allocate(client_ptr, &response_packet);
-                    if (ret)
-                    {
-                        return(1);
-                    }
-
-                    if (4u > ((ULONG)(response_packet -> nx_packet_data_end) - (ULONG)(response_packet -> nx_packet_append_ptr)))
+                    if (next_count == NXD_MQTT_TOPIC_MATCH_SIZE)
                     {
-                        nx_packet_release(response_packet);
-
-                        /* Packet buffer is too small to hold the message. */
-                        return(NX_SIZE_ERROR);
+                        return(NX_FALSE);
                     }
+                    next_nodes[next_count++] = child_ptr;
+                }
+            }
 
-                    response_ptr = (MQTT_PACKET_PUBLISH_RESPONSE *)response_packet -> nx_packet_prepend_ptr;
-
-                    response_ptr ->  mqtt_publish_response_packet_header = MQTT_CONTROL_PACKET_TYPE_PUBCOMP << 4;
-                    response_ptr ->  mqtt_publish_response_packet_remaining_length = 2;
-
-                    /* Fill in packet ID */
-                    response_packet -> nx_packet_prepend_ptr[3] = packet_ptr -> nx_packet_prepend_ptr[3];
-                    response_packet -> nx_packet_prepend_ptr[4] = packet_ptr -> nx_packet_prepend_ptr[4];
-                    response_packet -> nx_packet_append_ptr = response_packet -> nx_packet_prepend_ptr + 4;
-                    response_packet -> nx_packet_length = 4;
-
-                    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-
-#ifdef NX_SECURE_ENABLE
-                    if (client_ptr -> nxd_mqtt_client_use_tls)
-                    {
-                        ret = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), response_packet, NX_WAIT_FOREVER);
-                    }
-                    else
-                    {
-                        ret = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, response_packet, NX_WAIT_FOREVER);
-                    }
-#else
-                    ret = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, response_packet, NX_WAIT_FOREVER);
+            child_ptr = _nxd_mqtt_topic_node_find(client_ptr, node_ptr, level, level_length);
+            if (child_ptr)
+            {
+                if (next_count == NXD_MQTT_TOPIC_MATCH_SIZE)
+                {
+                    return(NX_FALSE);
+                }
+                next_nodes[next_count++] = child_ptr;
+            }
+        }
 
-#endif /* NX_SECURE_ENABLE */
+        if (next_count == 0)
+        {
+            break;
+        }
 
-                    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
+        for (i = 0; i < next_count; i++)
+        {
+            current_nodes[i] = next_nodes[i];
+        }
+        current_count = next_count;
 
-                    /* Update the timeout value. */
-                    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
+        level += level_length;
+        if (level == topic_end)
+        {
 
-                    if (ret)
+            /* This is the last level. Filters ending here match, and so does a '#' below them,
+               since '#' also matches its parent level. */
+            for (i = 0; i < current_count; i++)
+            {
+                node_ptr = current_nodes[i];
+                if (node_ptr -> nxd_mqtt_topic_node_notify)
+                {
+                    if (matched_count == NXD_MQTT_TOPIC_MATCH_SIZE)
                     {
-                        nx_packet_release(response_packet);
+                        return(NX_FALSE);
                     }
+                    matched_nodes[matched_count++] = node_ptr;
+                }
 
-                    /* Check ack notify function.  */
-                    if (client_ptr -> nxd_mqtt_ack_receive_notify)
+                child_ptr = node_ptr -> nxd_mqtt_topic_node_multi_level;
+                if (child_ptr && child_ptr -> nxd_mqtt_topic_node_notify)
+                {
+                    if (matched_count == NXD_MQTT_TOPIC_MATCH_SIZE)
                     {
-
-                        /* Call notify function. Note: user routine should not release the packet.  */
-                        client_ptr -> nxd_mqtt_ack_receive_notify(client_ptr, MQTT_CONTROL_PACKET_TYPE_PUBREL, packet_id, transmit_packet_ptr, client_ptr -> nxd_mqtt_ack_receive_context);
+                        return(NX_FALSE);
                     }
-
-                    /* This packet can be released. */
-                    _nxd_mqtt_release_transmit_packet(client_ptr, transmit_packet_ptr, previous_packet_ptr);
-
-                    /* Return with value 1, so the caller will release packet_ptr */
-                    return(1);
+                    matched_nodes[matched_count++] = child_ptr;
                 }
             }
+            break;
         }
 
-        /* Move on to the next packet */
-        previous_packet_ptr = transmit_packet_ptr;
-        transmit_packet_ptr = transmit_packet_ptr -> nx_packet_queue_next;
+        /* Skip the level separator. */
+        level++;
     }
 
-    /* nothing is found.  Return 1 to release the packet.*/
-    return(1);
+    if (matched_count == 0)
+    {
+        return(NX_FALSE);
+    }
+
+    for (i = 0; i < matched_count; i++)
+    {
+        node_ptr = matched_nodes[i];
+        (node_ptr -> nxd_mqtt_topic_node_notify)(client_ptr, packet_ptr, topic_offset, topic_length,
+                                                 message_offset, message_length,
+                                                 node_ptr -> nxd_mqtt_topic_node_context);
+    }
+
+    return(NX_TRUE);
 }
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_process_sub_unsub_ack                     PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_process_publish                           PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function process an ACK message for subscribe         */
-/*    or unsubscribe request.                                             */
+/*    This internal function process a publish message from the broker.   */
+/*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -1646,16 +1988,21 @@ USHORT                        transmit_packet_id;
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    Status                                                              */
+/*    NX_TRUE - packet is consumed                                        */
+/*    NX_FALSE - packet is not consumed                                   */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    [nxd_mqtt_client_receive_notify]      User supplied publish         */
+/*    [receive_notify]                      User supplied receive         */
 /*                                            callback function           */
-/*    _nxd_mqtt_release_transmit_packet                                   */
-/*                                          Release the memory block      */
-/*    _nxd_mqtt_read_remaining_length       Skip the remaining length     */
-/*                                            field                       */
+/*    _nxd_mqtt_packet_allocate                                           */
+/*    nx_tcp_socket_send                                                  */
+/*    nx_packet_release                                                   */
+/*    _nxd_mqtt_client_secure_send                                        */
+/*    _nxd_mqtt_process_publish_packet                                    */
+/*    _nxd_mqtt_copy_transmit_packet                                      */
+/*    _nxd_mqtt_topic_dispatch                                            */
+/*                                                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1666,182 +2013,246 @@ USHORT                        transmit_packet_id;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            added ack receive notify,   */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            packet ID index lookup and  */
+/*                                            topic filter dispatch,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static UINT _nxd_mqtt_process_sub_unsub_ack(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr)
+static UINT _nxd_mqtt_process_publish(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr)
 {
+MQTT_PACKET_PUBLISH_RESPONSE *pubresp_ptr;
+UINT                          status;
+USHORT                        packet_id = 0;
+UCHAR                         QoS;
+UINT                          enqueue_message = 0;
+NX_PACKET                    *transmit_packet_ptr;
+UINT                          remaining_length = 0;
+UINT                          packet_consumed = NX_FALSE;
+UCHAR                         fixed_header;
+USHORT                        transmit_packet_id;
+UINT                          topic_length;
+ULONG                         offset;
+UCHAR                         bytes[2];
+ULONG                         bytes_copied;
 
-USHORT     packet_id;
-NX_PACKET *previous_packet_ptr;
-NX_PACKET *transmit_packet_ptr;
-UCHAR      response_header;
-UCHAR      fixed_header;
-USHORT     transmit_packet_id;
-UINT       remaining_length;
-ULONG      offset;
-UCHAR      bytes[2];
-ULONG      bytes_copied;
-
-
-    response_header = *(packet_ptr -> nx_packet_prepend_ptr);
+    QoS = (UCHAR)((*(packet_ptr -> nx_packet_prepend_ptr) & MQTT_PUBLISH_QOS_LEVEL_FIELD) >> 1);
 
     if (_nxd_mqtt_read_remaining_length(packet_ptr, &remaining_length, &offset))
     {
+        return(NX_FALSE);
+    }
 
-        /* Unable to process the sub/unsub ack.  Simply return and release the packet. */
+    if (remaining_length < 2)
+    {
         return(NXD_MQTT_INVALID_PACKET);
     }
 
-    /* Get packet id fields. */
+    /* Get topic length fields. */
     if (nx_packet_data_extract_offset(packet_ptr, offset, &bytes, sizeof(bytes), &bytes_copied) ||
         (bytes_copied != sizeof(bytes)))
     {
         return(NXD_MQTT_INVALID_PACKET);
     }
 
-    packet_id = (USHORT)(((*bytes) << 8) | (*(bytes + 1)));
+    topic_length = (UINT)(*(bytes) << 8) | (*(bytes + 1));
 
-    /* Search all the outstanding transmitted packets for a match. */
-    previous_packet_ptr = NX_NULL;
-    transmit_packet_ptr = client_ptr -> message_transmit_queue_head;
-    while (transmit_packet_ptr)
+    if (topic_length > remaining_length - 2u)
     {
-        fixed_header = *(transmit_packet_ptr -> nx_packet_prepend_ptr);
-        transmit_packet_id = *((USHORT *)transmit_packet_ptr -> nx_packet_data_start);
-        if (transmit_packet_id == packet_id)
-        {
+        return(NXD_MQTT_INVALID_PACKET);
+    }
 
-            /* Found the matching packet id */
-            if (((response_header >> 4) == MQTT_CONTROL_PACKET_TYPE_SUBACK) &&
-                ((fixed_header >> 4) == MQTT_CONTROL_PACKET_TYPE_SUBSCRIBE))
-            {
-                /* Validate the packet. */
-                if (remaining_length != 3)
-                {
-                    /* Invalid remaining_length value. */
-                    return(1);
-                }
+    if (QoS == 0)
+    {
+        enqueue_message = 1;
+    }
+    else
+    {
+        /* QoS 1 or QoS 2 messages. */
+        /* Get packet id fields. */
+        if (nx_packet_data_extract_offset(packet_ptr, offset + 2 + topic_length, &bytes, sizeof(bytes), &bytes_copied))
+        {
+            return(NXD_MQTT_INVALID_PACKET);
+        }
 
-                /* Check ack notify function.  */
-                if (client_ptr -> nxd_mqtt_ack_receive_notify)
-                {
+        packet_id = (USHORT)(((*bytes) << 8) | (*(bytes + 1)));
 
-                    /* Call notify function. Note: user routine should not release the packet.  */
-                    client_ptr -> nxd_mqtt_ack_receive_notify(client_ptr, MQTT_CONTROL_PACKET_TYPE_SUBACK, packet_id, transmit_packet_ptr, client_ptr -> nxd_mqtt_ack_receive_context);
-                }
+        /* Look for an existing transmit packets with the same packet id */
+        transmit_packet_ptr = client_ptr -> message_transmit_index[packet_id & (NXD_MQTT_TRANSMIT_INDEX_SIZE - 1)];
 
-                /* Release the transmit packet. */
-                _nxd_mqtt_release_transmit_packet(client_ptr, transmit_packet_ptr, previous_packet_ptr);
+        while (transmit_packet_ptr)
+        {
+            fixed_header = *(transmit_packet_ptr -> nx_packet_prepend_ptr);
+            transmit_packet_id = *((USHORT *)transmit_packet_ptr -> nx_packet_data_start);
+            if ((transmit_packet_id == packet_id) &&
+                ((fixed_header & 0xF0) == (MQTT_CONTROL_PACKET_TYPE_PUBREC << 4)))
+            {
 
-                return(1);
+                /* Found a packet containing the packet_id */
+                break;
             }
-            else if (((response_header >> 4) == MQTT_CONTROL_PACKET_TYPE_UNSUBACK) &&
-                     ((fixed_header >> 4) == MQTT_CONTROL_PACKET_TYPE_UNSUBSCRIBE))
-            {
-                /* Validate the packet. */
-                if (remaining_length != 2)
-                {
-                    /* Invalid remaining_length value. */
-                    return(1);
-                }
 
-                /* Check ack notify function.  */
-                if (client_ptr -> nxd_mqtt_ack_receive_notify)
-                {
+            /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+            transmit_packet_ptr = ((NXD_MQTT_TRANSMIT_INFO *)transmit_packet_ptr -> nx_packet_data_start) -> nxd_mqtt_transmit_index_next;
+        }
 
-                    /* Call notify function. Note: user routine should not release the packet.  */
-                    client_ptr -> nxd_mqtt_ack_receive_notify(client_ptr, MQTT_CONTROL_PACKET_TYPE_UNSUBACK, packet_id, transmit_packet_ptr, client_ptr -> nxd_mqtt_ack_receive_context);
-                }
+        if (transmit_packet_ptr)
+        {
+            /* This published data is already in our system.  No need to deliver this message to the application. */
+            enqueue_message = 0;
+        }
+        else
+        {
+            enqueue_message = 1;
+        }
+    }
 
-                /* Unsubscribe succeeded. */
-                /* Release the transmit packet. */
-                _nxd_mqtt_release_transmit_packet(client_ptr, transmit_packet_ptr, previous_packet_ptr);
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
+    /* Deliver the message to the callbacks of the matching topic filters. The message is
+       queued only if no filter matches. */
+    if (enqueue_message && _nxd_mqtt_topic_dispatch(client_ptr, packet_ptr))
+    {
+        enqueue_message = 0;
+    }
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 
-                return(1);
+    if (enqueue_message)
+    {
+        if (packet_ptr -> nx_packet_length > (offset + remaining_length))
+        {
+
+            /* This packet contains multiple messages. */
+            if (nx_packet_copy(packet_ptr, &packet_ptr, client_ptr -> nxd_mqtt_client_packet_pool_ptr, NX_NO_WAIT))
+            {
+
+                /* No packet is available. */
+                return(NX_FALSE);
             }
         }
+        else
+        {
+            packet_consumed = NX_TRUE;
+        }
 
-        /* Move on to the next packet */
-        previous_packet_ptr = transmit_packet_ptr;
-        transmit_packet_ptr = transmit_packet_ptr -> nx_packet_queue_next;
+        /* Increment the queue depth counter. */
+        client_ptr -> message_receive_queue_depth++;
+
+        if (client_ptr -> message_receive_queue_head == NX_NULL)
+        {
+            client_ptr -> message_receive_queue_head = packet_ptr;
+        }
+        else
+        {
+            client_ptr -> message_receive_queue_tail -> nx_packet_queue_next = packet_ptr;
+        }
+        client_ptr -> message_receive_queue_tail = packet_ptr;
+
+        /* Invoke the user-defined receive notify function if it is set. */
+        if (client_ptr -> nxd_mqtt_client_receive_notify)
+        {
+            (*(client_ptr -> nxd_mqtt_client_receive_notify))(client_ptr, client_ptr -> message_receive_queue_depth);
+        }
     }
-    return(1);
-}
 
+    /* If the message QoS level is 0, we are done. */
+    if (QoS == 0)
+    {
+        /* Return */
+        return(packet_consumed);
+    }
 
-/**************************************************************************/
-/*                                                                        */
-/*  FUNCTION                                               RELEASE        */
-/*                                                                        */
-/*    _nxd_mqtt_process_pingresp                          PORTABLE C      */
-/*                                                           6.1          */
-/*  AUTHOR                                                                */
-/*                                                                        */
-/*    Yuxin Zhou, Microsoft Corporation                                   */
-/*                                                                        */
-/*  DESCRIPTION                                                           */
-/*                                                                        */
-/*    This internal function process a PINGRESP message.                  */
-/*                                                                        */
-/*  INPUT                                                                 */
-/*                                                                        */
-/*    client_ptr                            Pointer to MQTT Client        */
-/*    packet_ptr                            Pointer to the packet         */
-/*                                                                        */
-/*  OUTPUT                                                                */
-/*                                                                        */
-/*    Status                                                              */
-/*                                                                        */
-/*  CALLS                                                                 */
-/*                                                                        */
-/*    None                                                                */
-/*                                            callback function           */
-/*                                                                        */
-/*  CALLED BY                                                             */
-/*                                                                        */
-/*    _nxd_mqtt_packet_receive_process                                    */
-/*                                                                        */
-/*  RELEASE HISTORY                                                       */
-/*                                                                        */
-/*    DATE              NAME                      DESCRIPTION             */
-/*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
-/*                                                                        */
-/**************************************************************************/
-static VOID _nxd_mqtt_process_pingresp(NXD_MQTT_CLIENT *client_ptr)
-{
+    /* Send out proper ACKs for QoS 1 and 2 messages. */
+    /* Allocate a new packet so we can send out a response. */
+    status = _nxd_mqtt_packet_allocate(client_ptr, &packet_ptr);
+    if (status)
+    {
+        /* Packet allocation fails. */
+        return(packet_consumed);
+    }
 
+    /* Fill in the packet ID */
+    pubresp_ptr = (MQTT_PACKET_PUBLISH_RESPONSE *)(packet_ptr -> nx_packet_prepend_ptr);
+    pubresp_ptr -> mqtt_publish_response_packet_remaining_length = 2;
+    pubresp_ptr -> mqtt_publish_response_packet_packet_identifier_msb = (UCHAR)(packet_id >> 8);
+    pubresp_ptr -> mqtt_publish_response_packet_packet_identifier_lsb = (UCHAR)(packet_id & 0xFF);
 
-    /* If there is an outstanding ping, mark it as responded. */
-    if (client_ptr -> nxd_mqtt_ping_not_responded == NX_TRUE)
+    if (QoS == 1)
     {
-        client_ptr -> nxd_mqtt_ping_not_responded = NX_FALSE;
 
-        client_ptr -> nxd_mqtt_ping_sent_time = 0;
+        pubresp_ptr -> mqtt_publish_response_packet_header = MQTT_CONTROL_PACKET_TYPE_PUBACK << 4;
+    }
+    else
+    {
+        pubresp_ptr -> mqtt_publish_response_packet_header = MQTT_CONTROL_PACKET_TYPE_PUBREC << 4;
     }
 
-    return;
-}
+    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + sizeof(MQTT_PACKET_PUBLISH_RESPONSE);
+    packet_ptr -> nx_packet_length = sizeof(MQTT_PACKET_PUBLISH_RESPONSE);
+
+    if (QoS == 2)
+    {
+
+        /* Copy packet for checking duplicate publish packet. */
+        if (_nxd_mqtt_copy_transmit_packet(client_ptr, packet_ptr, &transmit_packet_ptr,
+                                           packet_id, NX_FALSE, NX_WAIT_FOREVER))
+        {
+
+            /* Release the packet. */
+            nx_packet_release(packet_ptr);
+            return(packet_consumed);
+        }
+        /* Queue the packet until it is acknowledged. */
+        _nxd_mqtt_enqueue_transmit_packet(client_ptr, transmit_packet_ptr);
+    }
+
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+#ifdef NX_SECURE_ENABLE
+    if (client_ptr -> nxd_mqtt_client_use_tls)
+    {
+        status = _nxd_mqtt_client_secure_send(client_ptr, packet_ptr, NX_WAIT_FOREVER);
+    }
+    else
+    {
+        status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, NX_WAIT_FOREVER);
+    }
+#else
+    status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, NX_WAIT_FOREVER);
+
+#endif /* NX_SECURE_ENABLE */
+
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
+    if (status)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
+    }
+    else
+    {
+        /* Update the timeout value. */
+        client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
+    }
 
+    /* Return */
+    return(packet_consumed);
+}
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_process_disconnect                        PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_process_publish_response                  PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function process a DISCONNECT message.                */
+/*    This internal function process a publish response messages.         */
+/*    Publish Response messages are: PUBACK, PUBREC, PUBREL               */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -1850,408 +2261,328 @@ static VOID _nxd_mqtt_process_pingresp(NXD_MQTT_CLIENT *client_ptr)
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    None                                                                */
+/*    Status                                                              */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*   nx_secure_tls_session_send                                           */
-/*   nx_tcp_socket_disconnect                                             */
-/*   nx_tcp_client_socket_unbind                                          */
-/*   _nxd_mqtt_release_transmit_packet                                    */
-/*   _nxd_mqtt_release_receive_packet                                     */
-/*   _nxd_mqtt_client_connection_end                                      */
+/*    [nxd_mqtt_client_receive_notify]      User supplied publish         */
+/*                                            callback function           */
+/*    _nxd_mqtt_release_transmit_packet                                   */
+/*    nx_tcp_socket_send                                                  */
+/*    _nxd_mqtt_client_secure_send                                        */
+/*                                                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*   _nxd_mqtt_packet_receive_process                                     */
+/*    _nxd_mqtt_packet_receive_process                                    */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            added ack receive notify,   */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            packet ID index lookup,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nxd_mqtt_process_disconnect(NXD_MQTT_CLIENT *client_ptr)
+static UINT _nxd_mqtt_process_publish_response(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr)
 {
-NX_PACKET  *previous = NX_NULL;
-NX_PACKET  *current;
-NX_PACKET  *next;
-UINT        disconnect_callback = NX_FALSE;
-UINT        status;
-UCHAR       fixed_header;
+MQTT_PACKET_PUBLISH_RESPONSE *response_ptr;
+USHORT                        packet_id;
+NX_PACKET                    *transmit_packet_ptr;
+NX_PACKET                    *response_packet;
+UINT                          ret;
+UCHAR                         fixed_header;
+USHORT                        transmit_packet_id;
 
-    if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTED)
-    {
-        /* State changes from CONNECTED TO IDLE.  Call disconnect notify callback
-           if the function is set. */
-        disconnect_callback = NX_TRUE;
-    }
-    else if (client_ptr -> nxd_mqtt_client_state != NXD_MQTT_CLIENT_STATE_CONNECTING)
+    response_ptr = (MQTT_PACKET_PUBLISH_RESPONSE *)(packet_ptr -> nx_packet_prepend_ptr);
+
+    /* Validate the packet. */
+    if (response_ptr -> mqtt_publish_response_packet_remaining_length != 2)
     {
+        /* Invalid remaining_length value. Return 1 so the caller can release
+           the packet. */
 
-        /* If state isn't CONNECTED or CONNECTING, just return. */
-        return;
+        return(1);
     }
 
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-
-    /* End connection. */
-    _nxd_mqtt_client_connection_end(client_ptr, NXD_MQTT_SOCKET_TIMEOUT);
-
-    status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
-
-    /* Free up sub/unsub packets on the transmit queue. */
-    current = client_ptr -> message_transmit_queue_head;
+    packet_id = (USHORT)((response_ptr -> mqtt_publish_response_packet_packet_identifier_msb << 8) |
+                         (response_ptr -> mqtt_publish_response_packet_packet_identifier_lsb));
 
-    while (current)
+    /* Search the outstanding transmitted packets with the same packet ID index for a match. */
+    transmit_packet_ptr = client_ptr -> message_transmit_index[packet_id & (NXD_MQTT_TRANSMIT_INDEX_SIZE - 1)];
+    while (transmit_packet_ptr)
     {
-        next = current -> nx_packet_queue_next;
-        fixed_header = *(current -> nx_packet_prepend_ptr);
+        fixed_header = *(transmit_packet_ptr -> nx_packet_prepend_ptr);
+        transmit_packet_id = *((USHORT *)transmit_packet_ptr -> nx_packet_data_start);
+        if (transmit_packet_id == packet_id)
+        {
 
-        if (((fixed_header & 0xF0) == (MQTT_CONTROL_PACKET_TYPE_SUBSCRIBE << 4)) ||
-            ((fixed_header & 0xF0) == (MQTT_CONTROL_PACKET_TYPE_UNSUBSCRIBE << 4)))
-        {
-            _nxd_mqtt_release_transmit_packet(client_ptr, current, previous);
-        }
-        else
-        {
-            previous = current;
-        }
-        current = next;
-    }
+            /* Found the matching packet id */
+            if (((response_ptr -> mqtt_publish_response_packet_header) >> 4) == MQTT_CONTROL_PACKET_TYPE_PUBACK)
+            {
 
-    /* If a callback notification is defined, call it now. */
-    if ((disconnect_callback == NX_TRUE) && (client_ptr -> nxd_mqtt_disconnect_notify))
-    {
-        client_ptr -> nxd_mqtt_disconnect_notify(client_ptr);
-    }
+                /* PUBACK is the response to a PUBLISH packet with QoS Level 1*/
+                /* Therefore we verify that packet contains PUBLISH packet with QoS level 1*/
+                if ((fixed_header & 0xF6) == ((MQTT_CONTROL_PACKET_TYPE_PUBLISH << 4) | MQTT_PUBLISH_QOS_LEVEL_1))
+                {
 
-    /* If a connect callback notification is defined and is still in connecting stage, call it now. */
-    if ((disconnect_callback == NX_FALSE) && (client_ptr -> nxd_mqtt_connect_notify))
-    {
-        client_ptr -> nxd_mqtt_connect_notify(client_ptr, NXD_MQTT_CONNECT_FAILURE, client_ptr -> nxd_mqtt_connect_context);
-    }
+                    /* Check ack notify function.  */
+                    if (client_ptr -> nxd_mqtt_ack_receive_notify)
+                    {
 
-    if (status == TX_SUCCESS)
-    {
-        /* Remove all the packets in the receive queue. */
-        while (client_ptr -> message_receive_queue_head)
-        {
-            _nxd_mqtt_release_receive_packet(client_ptr, client_ptr -> message_receive_queue_head, NX_NULL);
-        }
-        client_ptr -> message_receive_queue_depth = 0;
+                        /* Call notify function. Note: user routine should not release the packet.  */
+                        client_ptr -> nxd_mqtt_ack_receive_notify(client_ptr, MQTT_CONTROL_PACKET_TYPE_PUBACK, packet_id, transmit_packet_ptr, client_ptr -> nxd_mqtt_ack_receive_context);
+                    }
 
-        /* Clear the MQTT_PACKET_RECEIVE_EVENT */
-#ifndef NXD_MQTT_CLOUD_ENABLE
-        tx_event_flags_set(&client_ptr -> nxd_mqtt_events, ~MQTT_PACKET_RECEIVE_EVENT, TX_AND);
+                    /* QoS Level1 message receives an ACK. */
+                    /* This message can be released. */
+                    _nxd_mqtt_release_transmit_packet(client_ptr, transmit_packet_ptr);
+
+                    /* Return with value 1, so the caller will release packet_ptr */
+                    return(1);
+                }
+            }
+            else if (((response_ptr -> mqtt_publish_response_packet_header) >> 4) == MQTT_CONTROL_PACKET_TYPE_PUBREL)
+            {
+
+                /* QoS 2 publish Release received, part 2. */
+                /* Therefore we verify that packet contains PUBLISH packet with QoS level 2*/
+                if ((fixed_header & 0xF6) == (MQTT_CONTROL_PACKET_TYPE_PUBREC << 4))
+                {
+
+                    /* QoS Level2 message receives an ACK. */
+                    /* This message can be released. */
+                    /* Send PUBCOMP */
+
+                    /* Allocate a packet to send the response. */
+                    ret = _nxd_mqtt_packet_allocate(client_ptr, &response_packet);
+                    if (ret)
+                    {
+                        return(1);
+                    }
+
+                    if (4u > ((ULONG)(response_packet -> nx_packet_data_end) - (ULONG)(response_packet -> nx_packet_append_ptr)))
+                    {
+                        nx_packet_release(response_packet);
+
+                        /* Packet buffer is too small to hold the message. */
+                        return(NX_SIZE_ERROR);
+                    }
+
+                    response_ptr = (MQTT_PACKET_PUBLISH_RESPONSE *)response_packet -> nx_packet_prepend_ptr;
+
+                    response_ptr ->  mqtt_publish_response_packet_header = MQTT_CONTROL_PACKET_TYPE_PUBCOMP << 4;
+                    response_ptr ->  mqtt_publish_response_packet_remaining_length = 2;
+
+                    /* Fill in packet ID */
+                    response_packet -> nx_packet_prepend_ptr[3] = packet_ptr -> nx_packet_prepend_ptr[3];
+                    response_packet -> nx_packet_prepend_ptr[4] = packet_ptr -> nx_packet_prepend_ptr[4];
+                    response_packet -> nx_packet_append_ptr = response_packet -> nx_packet_prepend_ptr + 4;
+                    response_packet -> nx_packet_length = 4;
+
+                    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+#ifdef NX_SECURE_ENABLE
+                    if (client_ptr -> nxd_mqtt_client_use_tls)
+                    {
+                        ret = _nxd_mqtt_client_secure_send(client_ptr, response_packet, NX_WAIT_FOREVER);
+                    }
+                    else
+                    {
+                        ret = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, response_packet, NX_WAIT_FOREVER);
+                    }
 #else
-        nx_cloud_module_event_clear(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_PACKET_RECEIVE_EVENT);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
-    }
+                    ret = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, response_packet, NX_WAIT_FOREVER);
 
-    /* Clear flags if keep alive is enabled. */
-    if (client_ptr -> nxd_mqtt_keepalive)
-    {
-        client_ptr -> nxd_mqtt_ping_not_responded = 0;
-        client_ptr -> nxd_mqtt_ping_sent_time = 0;
-    }
+#endif /* NX_SECURE_ENABLE */
 
-    /* Clean up the information when disconnecting. */
-    client_ptr -> nxd_mqtt_client_username = NX_NULL;
-    client_ptr -> nxd_mqtt_client_password = NX_NULL;
-    client_ptr -> nxd_mqtt_client_will_topic = NX_NULL;
-    client_ptr -> nxd_mqtt_client_will_message = NX_NULL;
-    client_ptr -> nxd_mqtt_client_will_qos_retain = 0;
+                    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
 
-    /* Release current processing packet. */
-    if (client_ptr -> nxd_mqtt_client_processing_packet)
-    {
-        nx_packet_release(client_ptr -> nxd_mqtt_client_processing_packet);
-        client_ptr -> nxd_mqtt_client_processing_packet = NX_NULL;
+                    /* Update the timeout value. */
+                    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
+
+                    if (ret)
+                    {
+                        nx_packet_release(response_packet);
+                    }
+
+                    /* Check ack notify function.  */
+                    if (client_ptr -> nxd_mqtt_ack_receive_notify)
+                    {
+
+                        /* Call notify function. Note: user routine should not release the packet.  */
+                        client_ptr -> nxd_mqtt_ack_receive_notify(client_ptr, MQTT_CONTROL_PACKET_TYPE_PUBREL, packet_id, transmit_packet_ptr, client_ptr -> nxd_mqtt_ack_receive_context);
+                    }
+
+                    /* This packet can be released. */
+                    _nxd_mqtt_release_transmit_packet(client_ptr, transmit_packet_ptr);
+
+                    /* Return with value 1, so the caller will release packet_ptr */
+                    return(1);
+                }
+            }
+        }
+
+        /* Move on to the next packet */
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        transmit_packet_ptr = ((NXD_MQTT_TRANSMIT_INFO *)transmit_packet_ptr -> nx_packet_data_start) -> nxd_mqtt_transmit_index_next;
     }
 
-    return;
+    /* nothing is found.  Return 1 to release the packet.*/
+    return(1);
 }
 
-
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_packet_receive_process                    PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_process_sub_unsub_ack                     PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function process MQTT message.                        */
-/*    NOTE: MQTT Mutex is NOT obtained on entering this function.         */
-/*    Therefore it shouldn't hold the mutex when it exists this function. */
+/*    This internal function process an ACK message for subscribe         */
+/*    or unsubscribe request.                                             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
+/*    packet_ptr                            Pointer to the packet         */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    None                                                                */
+/*    Status                                                              */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    nx_secure_tls_session_receive                                       */
-/*    nx_tcp_socket_receive                                               */
-/*    _nxd_mqtt_process_publish                                           */
-/*    _nxd_mqtt_process_publish_response                                  */
-/*    _nxd_mqtt_process_sub_unsub_ack                                     */
-/*    _nxd_mqtt_process_pingresp                                          */
-/*    _nxd_mqtt_process_disconnect                                        */
-/*    nx_packet_release                                                   */
+/*    [nxd_mqtt_client_receive_notify]      User supplied publish         */
+/*                                            callback function           */
+/*    _nxd_mqtt_release_transmit_packet                                   */
+/*                                          Release the memory block      */
+/*    _nxd_mqtt_read_remaining_length       Skip the remaining length     */
+/*                                            field                       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nxd_mqtt_client_event_process                                      */
+/*    _nxd_mqtt_packet_receive_process                                    */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            added ack receive notify,   */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            packet ID index lookup,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nxd_mqtt_packet_receive_process(NXD_MQTT_CLIENT *client_ptr)
+static UINT _nxd_mqtt_process_sub_unsub_ack(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr)
 {
-NX_PACKET *packet_ptr;
-NX_PACKET *previous_packet_ptr;
-UINT       status;
-UCHAR      packet_type;
+
+USHORT     packet_id;
+NX_PACKET *transmit_packet_ptr;
+UCHAR      response_header;
+UCHAR      fixed_header;
+USHORT     transmit_packet_id;
 UINT       remaining_length;
-UINT       packet_consumed;
 ULONG      offset;
+UCHAR      bytes[2];
 ULONG      bytes_copied;
-ULONG      packet_length;
-
-    for (;;)
-    {
 
-        /* Release the mutex. */
-        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
 
-        /* Make a receive call. */
-#ifdef NX_SECURE_ENABLE
-        if (client_ptr -> nxd_mqtt_client_use_tls)
-        {
-            status = nx_secure_tls_session_receive(&(client_ptr -> nxd_mqtt_tls_session), &packet_ptr, NX_NO_WAIT);
-        }
-        else
-        {
-            status = nx_tcp_socket_receive(&client_ptr -> nxd_mqtt_client_socket, &packet_ptr, NX_NO_WAIT);
-        }
-#else
-        status = nx_tcp_socket_receive(&client_ptr -> nxd_mqtt_client_socket, &packet_ptr, NX_NO_WAIT);
-#endif /* NX_SECURE_ENABLE */
+    response_header = *(packet_ptr -> nx_packet_prepend_ptr);
 
-        if (status != NX_SUCCESS)
-        {
-            if (status != NX_NO_PACKET)
-            {
+    if (_nxd_mqtt_read_remaining_length(packet_ptr, &remaining_length, &offset))
+    {
 
-                /* Network issue. Close the MQTT session. */
-#ifndef NXD_MQTT_CLOUD_ENABLE
-                tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_NETWORK_DISCONNECT_EVENT, TX_OR);
-#else
-                nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_NETWORK_DISCONNECT_EVENT);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
-            }
+        /* Unable to process the sub/unsub ack.  Simply return and release the packet. */
+        return(NXD_MQTT_INVALID_PACKET);
+    }
 
-            break;
-        }
+    /* Get packet id fields. */
+    if (nx_packet_data_extract_offset(packet_ptr, offset, &bytes, sizeof(bytes), &bytes_copied) ||
+        (bytes_copied != sizeof(bytes)))
+    {
+        return(NXD_MQTT_INVALID_PACKET);
+    }
 
-        /* Obtain the mutex. */
-        tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+    packet_id = (USHORT)(((*bytes) << 8) | (*(bytes + 1)));
 
-        /* Is there a packet waiting for processing? */
-        if (client_ptr -> nxd_mqtt_client_processing_packet)
+    /* Search the outstanding transmitted packets with the same packet ID index for a match. */
+    transmit_packet_ptr = client_ptr -> message_transmit_index[packet_id & (NXD_MQTT_TRANSMIT_INDEX_SIZE - 1)];
+    while (transmit_packet_ptr)
+    {
+        fixed_header = *(transmit_packet_ptr -> nx_packet_prepend_ptr);
+        transmit_packet_id = *((USHORT *)transmit_packet_ptr -> nx_packet_data_start);
+        if (transmit_packet_id == packet_id)
         {
 
-            /* Yes. Link received packet to existing one. */
-            if (client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_last)
-            {
-                client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_last -> nx_packet_next = packet_ptr;
-            }
-            else
+            /* Found the matching packet id */
+            if (((response_header >> 4) == MQTT_CONTROL_PACKET_TYPE_SUBACK) &&
+                ((fixed_header >> 4) == MQTT_CONTROL_PACKET_TYPE_SUBSCRIBE))
             {
-                client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_next = packet_ptr;
-            }
-            if (packet_ptr -> nx_packet_last)
-            {
-                client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_last = packet_ptr -> nx_packet_last;
-            }
-            else
-            {
-                client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_last = packet_ptr;
-            }
-            client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_length += packet_ptr -> nx_packet_length;
-
-            /* Start to process existing packet. */
-            packet_ptr = client_ptr -> nxd_mqtt_client_processing_packet;
-            client_ptr -> nxd_mqtt_client_processing_packet = NX_NULL;
-        }
-
-        /* Check notify function.  */
-        if (client_ptr -> nxd_mqtt_packet_receive_notify)
-        {
-
-            /* Call notify function. Return NX_TRUE if the packet has been consumed.  */
-            if (client_ptr -> nxd_mqtt_packet_receive_notify(client_ptr, packet_ptr, client_ptr -> nxd_mqtt_packet_receive_context) == NX_TRUE)
-            {
-                continue;
-            }
-        }
-
-        packet_consumed = NX_FALSE;
-        while (packet_ptr)
-        {
-            /* Parse the incoming packet. */
-            status = _nxd_mqtt_read_remaining_length(packet_ptr, &remaining_length, &offset);
-            if (status == NXD_MQTT_PARTIAL_PACKET)
-            {
-
-                /* We only have partial MQTT message. 
-                 * Put it to waiting list for more packets. */
-                client_ptr -> nxd_mqtt_client_processing_packet = packet_ptr;
-                packet_consumed = NX_TRUE;
-                break;
-            }
-            else if (status)
-            {
-                
-                /* Invalid packet. */
-                break;
-            }
-
-            /* Get packet type. */
-            if (nx_packet_data_extract_offset(packet_ptr, 0, &packet_type, 1, &bytes_copied))
-            {
-
-                /* Unable to read packet type. */
-                break;
-            }
-
-            /* Right shift 4 bits to get the packet type. */
-            packet_type = packet_type >> 4;
-
-            /* Process based on packet type. */
-            switch (packet_type)
-            {
-            case MQTT_CONTROL_PACKET_TYPE_CONNECT:
-                /* Client does not accept connections.  Nothing needs to be done. */
-                break;
-            case MQTT_CONTROL_PACKET_TYPE_CONNACK:
-                _nxd_mqtt_process_connack(client_ptr, packet_ptr, NX_NO_WAIT);
-                break;
-
-            case MQTT_CONTROL_PACKET_TYPE_PUBLISH:
-                packet_consumed = _nxd_mqtt_process_publish(client_ptr, packet_ptr);
-                break;
-
-            case MQTT_CONTROL_PACKET_TYPE_PUBACK:
-            case MQTT_CONTROL_PACKET_TYPE_PUBREL:
-                _nxd_mqtt_process_publish_response(client_ptr, packet_ptr);
-                break;
-
-            case MQTT_CONTROL_PACKET_TYPE_SUBSCRIBE:
-            case MQTT_CONTROL_PACKET_TYPE_UNSUBSCRIBE:
-                /* Client should not process subscribe or unsubscribe message. */
-                break;
-
-            case MQTT_CONTROL_PACKET_TYPE_SUBACK:
-            case MQTT_CONTROL_PACKET_TYPE_UNSUBACK:
-                _nxd_mqtt_process_sub_unsub_ack(client_ptr, packet_ptr);
-                break;
-
-
-            case MQTT_CONTROL_PACKET_TYPE_PINGREQ:
-                /* Client is not supposed to receive ping req.  Ignore it. */
-                break;
+                /* Validate the packet. */
+                if (remaining_length != 3)
+                {
+                    /* Invalid remaining_length value. */
+                    return(1);
+                }
 
-            case MQTT_CONTROL_PACKET_TYPE_PINGRESP:
-                _nxd_mqtt_process_pingresp(client_ptr);
-                break;
+                /* Check ack notify function.  */
+                if (client_ptr -> nxd_mqtt_ack_receive_notify)
+                {
 
-            case MQTT_CONTROL_PACKET_TYPE_DISCONNECT:
-                _nxd_mqtt_process_disconnect(client_ptr);
-                break;
+                    /* Call notify function. Note: user routine should not release the packet.  */
+                    client_ptr -> nxd_mqtt_ack_receive_notify(client_ptr, MQTT_CONTROL_PACKET_TYPE_SUBACK, packet_id, transmit_packet_ptr, client_ptr -> nxd_mqtt_ack_receive_context);
+                }
 
-            /* Publisher sender message type for QoS 2. Not supported. */
-            case MQTT_CONTROL_PACKET_TYPE_PUBREC:
-            case MQTT_CONTROL_PACKET_TYPE_PUBCOMP:
-            default:
-                /* Unknown type. */
-                break;
-            }
+                /* Release the transmit packet. */
+                _nxd_mqtt_release_transmit_packet(client_ptr, transmit_packet_ptr);
 
-            if (packet_consumed)
-            {
-                break;
+                return(1);
             }
-
-            /* Trim current packet. */
-            offset += remaining_length;
-            packet_length = packet_ptr -> nx_packet_length;
-            if (packet_length > offset)
+            else if (((response_header >> 4) == MQTT_CONTROL_PACKET_TYPE_UNSUBACK) &&
+                     ((fixed_header >> 4) == MQTT_CONTROL_PACKET_TYPE_UNSUBSCRIBE))
             {
-
-                /* Multiple MQTT message in one packet. */
-                packet_length = packet_ptr -> nx_packet_length - offset;
-                while ((ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr) <= offset)
+                /* Validate the packet. */
+                if (remaining_length != 2)
                 {
-                    offset -= (ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr);
-
-                    /* Current packet can be released. */
-                    previous_packet_ptr = packet_ptr;
-                    packet_ptr = packet_ptr -> nx_packet_next;
-                    previous_packet_ptr -> nx_packet_next = NX_NULL;
-                    nx_packet_release(previous_packet_ptr);
-                    if (packet_ptr == NX_NULL)
-                    {
-
-                        /* Invalid packet. */
-                        break;
-                    }
+                    /* Invalid remaining_length value. */
+                    return(1);
                 }
 
-                if (packet_ptr)
+                /* Check ack notify function.  */
+                if (client_ptr -> nxd_mqtt_ack_receive_notify)
                 {
 
-                    /* Adjust current packet. */
-                    packet_ptr -> nx_packet_prepend_ptr = packet_ptr -> nx_packet_prepend_ptr + offset;
-                    packet_ptr -> nx_packet_length = packet_length;
+                    /* Call notify function. Note: user routine should not release the packet.  */
+                    client_ptr -> nxd_mqtt_ack_receive_notify(client_ptr, MQTT_CONTROL_PACKET_TYPE_UNSUBACK, packet_id, transmit_packet_ptr, client_ptr -> nxd_mqtt_ack_receive_context);
                 }
-            }
-            else
-            {
 
-                /* All messages in current packet is processed. */
-                break;
+                /* Unsubscribe succeeded. */
+                /* Release the transmit packet. */
+                _nxd_mqtt_release_transmit_packet(client_ptr, transmit_packet_ptr);
+
+                return(1);
             }
         }
 
-        if (!packet_consumed)
-        {
-            nx_packet_release(packet_ptr);
-        }
+        /* Move on to the next packet */
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        transmit_packet_ptr = ((NXD_MQTT_TRANSMIT_INFO *)transmit_packet_ptr -> nx_packet_data_start) -> nxd_mqtt_transmit_index_next;
     }
-
-    /* No more data in the receive queue.  Return. */
-
-    return;
+    return(1);
 }
 
 
@@ -2259,7 +2590,7 @@ ULONG      packet_length;
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_tcp_establish_process                     PORTABLE C      */
+/*    _nxd_mqtt_process_pingresp                          PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -2267,25 +2598,25 @@ ULONG      packet_length;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function processes MQTT TCP connection establish event.        */
+/*    This internal function process a PINGRESP message.                  */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
+/*    packet_ptr                            Pointer to the packet         */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    None                                                                */
+/*    Status                                                              */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    nx_secure_tls_session_start                                         */
-/*    _nxd_mqtt_client_connection_end                                     */
-/*    _nxd_mqtt_client_connect_packet_send                                */
+/*    None                                                                */
+/*                                            callback function           */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nxd_mqtt_client_event_process                                      */
+/*    _nxd_mqtt_packet_receive_process                                    */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -2296,78 +2627,40 @@ ULONG      packet_length;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nxd_mqtt_tcp_establish_process(NXD_MQTT_CLIENT *client_ptr)
+static VOID _nxd_mqtt_process_pingresp(NXD_MQTT_CLIENT *client_ptr)
 {
-UINT       status;
-
 
-    /* TCP connection is established.  */
 
-    /* If TLS is enabled, start TLS */
-#ifdef NX_SECURE_ENABLE
-    if (client_ptr -> nxd_mqtt_client_use_tls)
+    /* If there is an outstanding ping, mark it as responded. */
+    if (client_ptr -> nxd_mqtt_ping_not_responded == NX_TRUE)
     {
-        status = nx_secure_tls_session_start(&(client_ptr -> nxd_mqtt_tls_session), &(client_ptr -> nxd_mqtt_client_socket), NX_NO_WAIT);
-
-        if (status != NX_CONTINUE)
-        {
-
-            /* End connection. */
-            _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
-
-            /* Check callback function.  */
-            if (client_ptr -> nxd_mqtt_connect_notify)
-            {
-                client_ptr -> nxd_mqtt_connect_notify(client_ptr, status, client_ptr -> nxd_mqtt_connect_context);
-            }
-
-            return;
-        }
-
-        /* TLS in progress.  */
-        client_ptr -> nxd_mqtt_tls_in_progress = NX_TRUE;
+        client_ptr -> nxd_mqtt_ping_not_responded = NX_FALSE;
 
-        return;
+        client_ptr -> nxd_mqtt_ping_sent_time = 0;
     }
-#endif /* NX_SECURE_ENABLE */
-
-    /* Start to send MQTT connect packet.  */
-    status = _nxd_mqtt_client_connect_packet_send(client_ptr, NX_NO_WAIT);
-
-    /* Check status.  */
-    if (status)
-    {
 
-        /* End connection. */
-        _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
-
-        /* Check callback function.  */
-        if (client_ptr -> nxd_mqtt_connect_notify)
-        {
-            client_ptr -> nxd_mqtt_connect_notify(client_ptr, status, client_ptr -> nxd_mqtt_connect_context);
-        }
-    }
+    return;
 }
 
 
-#ifdef NX_SECURE_ENABLE
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_tls_establish_process                     PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_process_disconnect                        PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function processes TLS connection establish event.             */
+/*    This internal function process a DISCONNECT message.                */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
+/*    packet_ptr                            Pointer to the packet         */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -2375,13 +2668,16 @@ UINT       status;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_secure_tls_handshake_process                                    */
-/*    _nxd_mqtt_client_connect_packet_send                                */
-/*    _nxd_mqtt_client_connection_end                                     */
-/*                                                                        */
-/*  CALLED BY                                                             */
-/*                                                                        */
-/*    _nxd_mqtt_client_event_process                                      */
+/*   nx_secure_tls_session_send                                           */
+/*   nx_tcp_socket_disconnect                                             */
+/*   nx_tcp_client_socket_unbind                                          */
+/*   _nxd_mqtt_release_transmit_packet                                    */
+/*   _nxd_mqtt_release_receive_packet                                     */
+/*   _nxd_mqtt_client_connection_end                                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*   _nxd_mqtt_packet_receive_process                                     */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -2390,127 +2686,106 @@ UINT       status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            packet ID index,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nxd_mqtt_tls_establish_process(NXD_MQTT_CLIENT *client_ptr)
+static VOID _nxd_mqtt_process_disconnect(NXD_MQTT_CLIENT *client_ptr)
 {
-UINT       status;
-
+NX_PACKET  *current;
+NX_PACKET  *next;
+UINT        disconnect_callback = NX_FALSE;
+UINT        status;
+UCHAR       fixed_header;
 
-    /* Directly call handshake process for async mode. */
-    status = _nx_secure_tls_handshake_process(&(client_ptr -> nxd_mqtt_tls_session), NX_NO_WAIT);
-    if (status == NX_SUCCESS)
+    if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTED)
+    {
+        /* State changes from CONNECTED TO IDLE.  Call disconnect notify callback
+           if the function is set. */
+        disconnect_callback = NX_TRUE;
+    }
+    else if (client_ptr -> nxd_mqtt_client_state != NXD_MQTT_CLIENT_STATE_CONNECTING)
     {
 
-        /* TLS session established.   */
-        client_ptr -> nxd_mqtt_tls_in_progress= NX_FALSE;
-
-        /* Start to send MQTT connect packet.  */
-        status = _nxd_mqtt_client_connect_packet_send(client_ptr, NX_NO_WAIT);
+        /* If state isn't CONNECTED or CONNECTING, just return. */
+        return;
+    }
 
-        /* Check status.  */
-        if (status)
-        {
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
 
-            /* End connection. */
-            _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
+    /* End connection. */
+    _nxd_mqtt_client_connection_end(client_ptr, NXD_MQTT_SOCKET_TIMEOUT);
 
-            /* Check callback function.  */
-            if (client_ptr -> nxd_mqtt_connect_notify)
-            {
-                client_ptr -> nxd_mqtt_connect_notify(client_ptr, status, client_ptr -> nxd_mqtt_connect_context);
-            }
-        }
-    }
-    else if (status != NX_CONTINUE)
-    {
+    status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
 
-        /* Error.  */
+    /* Free up sub/unsub packets on the transmit queue. */
+    current = client_ptr -> message_transmit_queue_head;
 
-        /* End connection. */
-        _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
+    while (current)
+    {
+        next = current -> nx_packet_queue_next;
+        fixed_header = *(current -> nx_packet_prepend_ptr);
 
-        /* Check callback function.  */
-        if (client_ptr -> nxd_mqtt_connect_notify)
+        if (((fixed_header & 0xF0) == (MQTT_CONTROL_PACKET_TYPE_SUBSCRIBE << 4)) ||
+            ((fixed_header & 0xF0) == (MQTT_CONTROL_PACKET_TYPE_UNSUBSCRIBE << 4)))
         {
-            client_ptr -> nxd_mqtt_connect_notify(client_ptr, status, client_ptr -> nxd_mqtt_connect_context);
+            _nxd_mqtt_release_transmit_packet(client_ptr, current);
         }
+        current = next;
     }
 
-    return;
-}
-#endif /* NX_SECURE_ENABLE */
+    /* If a callback notification is defined, call it now. */
+    if ((disconnect_callback == NX_TRUE) && (client_ptr -> nxd_mqtt_disconnect_notify))
+    {
+        client_ptr -> nxd_mqtt_disconnect_notify(client_ptr);
+    }
 
-/**************************************************************************/
-/*                                                                        */
-/*  FUNCTION                                               RELEASE        */
-/*                                                                        */
-/*    _nxd_mqtt_client_append_message                     PORTABLE C      */
-/*                                                           6.1          */
-/*  AUTHOR                                                                */
-/*                                                                        */
-/*    Yuxin Zhou, Microsoft Corporation                                   */
-/*                                                                        */
-/*  DESCRIPTION                                                           */
-/*                                                                        */
-/*    This function writes the message length and message in the outgoing */
-/*    MQTT packet.                                                        */
-/*                                                                        */
-/*  INPUT                                                                 */
-/*                                                                        */
-/*    client_ptr                            Pointer to MQTT Client        */
-/*    packet_ptr                            Outgoing MQTT packet          */
-/*    message                               Pointer to the message        */
-/*    length                                Length of the message         */
-/*    wait_option                           Wait option                   */
-/*                                                                        */
-/*  OUTPUT                                                                */
-/*                                                                        */
-/*    status                                                              */
-/*                                                                        */
-/*  CALLS                                                                 */
-/*                                                                        */
-/*    nx_packet_data_append                 Append packet data            */
-/*                                                                        */
-/*  CALLED BY                                                             */
-/*                                                                        */
-/*    _nxd_mqtt_client_sub_unsub                                          */
-/*    _nxd_mqtt_client_connect                                            */
-/*    _nxd_mqtt_client_publish                                            */
-/*                                                                        */
-/*  RELEASE HISTORY                                                       */
-/*                                                                        */
-/*    DATE              NAME                      DESCRIPTION             */
-/*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
-/*                                                                        */
-/**************************************************************************/
-UINT _nxd_mqtt_client_append_message(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, CHAR *message, UINT length, ULONG wait_option)
-{
-UINT ret = 0;
-UCHAR len[2];
+    /* If a connect callback notification is defined and is still in connecting stage, call it now. */
+    if ((disconnect_callback == NX_FALSE) && (client_ptr -> nxd_mqtt_connect_notify))
+    {
+        client_ptr -> nxd_mqtt_connect_notify(client_ptr, NXD_MQTT_CONNECT_FAILURE, client_ptr -> nxd_mqtt_connect_context);
+    }
 
-    len[0] = (length >> 8) & 0xFF;
-    len[1] = length  & 0xFF;
+    if (status == TX_SUCCESS)
+    {
+        /* Remove all the packets in the receive queue. */
+        while (client_ptr -> message_receive_queue_head)
+        {
+            _nxd_mqtt_release_receive_packet(client_ptr, client_ptr -> message_receive_queue_head, NX_NULL);
+        }
+        client_ptr -> message_receive_queue_depth = 0;
 
-    /* Append message length field. */
-    ret = nx_packet_data_append(packet_ptr, len, 2, client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
+        /* Clear the MQTT_PACKET_RECEIVE_EVENT */
+#ifndef NXD_MQTT_CLOUD_ENABLE
+        tx_event_flags_set(&client_ptr -> nxd_mqtt_events, ~MQTT_PACKET_RECEIVE_EVENT, TX_AND);
+#else
+        nx_cloud_module_event_clear(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_PACKET_RECEIVE_EVENT);
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+    }
 
-    if (ret)
+    /* Clear flags if keep alive is enabled. */
+    if (client_ptr -> nxd_mqtt_keepalive)
     {
-        return(ret);
+        client_ptr -> nxd_mqtt_ping_not_responded = 0;
+        client_ptr -> nxd_mqtt_ping_sent_time = 0;
     }
 
-    if (length)
+    /* Clean up the information when disconnecting. */
+    client_ptr -> nxd_mqtt_client_username = NX_NULL;
+    client_ptr -> nxd_mqtt_client_password = NX_NULL;
+    client_ptr -> nxd_mqtt_client_will_topic = NX_NULL;
+    client_ptr -> nxd_mqtt_client_will_message = NX_NULL;
+    client_ptr -> nxd_mqtt_client_will_qos_retain = 0;
+
+    /* Release current processing packet. */
+    if (client_ptr -> nxd_mqtt_client_processing_packet)
     {
-        /* Copy the string into the packet. */
-        ret = nx_packet_data_append(packet_ptr, message, length, 
-                                    client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
+        nx_packet_release(client_ptr -> nxd_mqtt_client_processing_packet);
+        client_ptr -> nxd_mqtt_client_processing_packet = NX_NULL;
     }
 
-    return(ret);
+    return;
 }
 
 
@@ -2518,7 +2793,7 @@ UCHAR len[2];
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_connection_end                     PORTABLE C      */
+/*    _nxd_mqtt_packet_receive_process                    PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -2526,12 +2801,13 @@ UCHAR len[2];
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function is used to end the MQTT connection.                   */
+/*    This internal function process MQTT message.                        */
+/*    NOTE: MQTT Mutex is NOT obtained on entering this function.         */
+/*    Therefore it shouldn't hold the mutex when it exists this function. */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    wait_option                           Wait option                   */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -2539,16 +2815,18 @@ UCHAR len[2];
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    nx_secure_tls_session_end             End TLS session               */
-/*    nx_secure_tls_session_delete          Delete TLS session            */
-/*    nx_tcp_socket_disconnect              Close TCP connection          */
-/*    nx_tcp_client_socket_unbind           Unbind TCP socket             */
-/*    tx_timer_delete                       Delete timer                  */
+/*    nx_secure_tls_session_receive                                       */
+/*    nx_tcp_socket_receive                                               */
+/*    _nxd_mqtt_process_publish                                           */
+/*    _nxd_mqtt_process_publish_response                                  */
+/*    _nxd_mqtt_process_sub_unsub_ack                                     */
+/*    _nxd_mqtt_process_pingresp                                          */
+/*    _nxd_mqtt_process_disconnect                                        */
+/*    nx_packet_release                                                   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nxd_mqtt_client_connect                                            */
-/*    _nxd_mqtt_process_disconnect                                        */
+/*    _nxd_mqtt_client_event_process                                      */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -2559,46 +2837,241 @@ UCHAR len[2];
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-VOID _nxd_mqtt_client_connection_end(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option)
+static VOID _nxd_mqtt_packet_receive_process(NXD_MQTT_CLIENT *client_ptr)
 {
+NX_PACKET *packet_ptr;
+NX_PACKET *previous_packet_ptr;
+UINT       status;
+UCHAR      packet_type;
+UINT       remaining_length;
+UINT       packet_consumed;
+ULONG      offset;
+ULONG      bytes_copied;
+ULONG      packet_length;
 
-    /* Obtain the mutex. */
-    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
-
-    /* Mark the session as terminated. */
-    client_ptr -> nxd_mqtt_client_state = NXD_MQTT_CLIENT_STATE_IDLE;
-
-    /* Release the mutex. */
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-
-#ifdef NX_SECURE_ENABLE
-    if (client_ptr -> nxd_mqtt_client_use_tls)
-    {
-        nx_secure_tls_session_end(&(client_ptr -> nxd_mqtt_tls_session), wait_option);
-        nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
-    }
-#endif
-    nx_tcp_socket_disconnect(&(client_ptr -> nxd_mqtt_client_socket), wait_option);
-    nx_tcp_client_socket_unbind(&(client_ptr -> nxd_mqtt_client_socket));
-
-    /* Disable timer if timer has been started. */
-    if (client_ptr -> nxd_mqtt_keepalive)
+    for (;;)
     {
-         tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
-    }
-}
 
+        /* Release the mutex. */
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
 
-static UINT _nxd_mqtt_send_simple_message(NXD_MQTT_CLIENT *client_ptr, UCHAR header_value);
-
+        /* Make a receive call. */
+#ifdef NX_SECURE_ENABLE
+        if (client_ptr -> nxd_mqtt_client_use_tls)
+        {
+            status = nx_secure_tls_session_receive(&(client_ptr -> nxd_mqtt_tls_session), &packet_ptr, NX_NO_WAIT);
+        }
+        else
+        {
+            status = nx_tcp_socket_receive(&client_ptr -> nxd_mqtt_client_socket, &packet_ptr, NX_NO_WAIT);
+        }
+#else
+        status = nx_tcp_socket_receive(&client_ptr -> nxd_mqtt_client_socket, &packet_ptr, NX_NO_WAIT);
+#endif /* NX_SECURE_ENABLE */
+
+        if (status != NX_SUCCESS)
+        {
+            if (status != NX_NO_PACKET)
+            {
+
+                /* Network issue. Close the MQTT session. */
+#ifndef NXD_MQTT_CLOUD_ENABLE
+                tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_NETWORK_DISCONNECT_EVENT, TX_OR);
+#else
+                nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_NETWORK_DISCONNECT_EVENT);
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+            }
+
+            break;
+        }
+
+        /* Obtain the mutex. */
+        tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+        /* Is there a packet waiting for processing? */
+        if (client_ptr -> nxd_mqtt_client_processing_packet)
+        {
+
+            /* Yes. Link received packet to existing one. */
+            if (client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_last)
+            {
+                client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_last -> nx_packet_next = packet_ptr;
+            }
+            else
+            {
+                client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_next = packet_ptr;
+            }
+            if (packet_ptr -> nx_packet_last)
+            {
+                client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_last = packet_ptr -> nx_packet_last;
+            }
+            else
+            {
+                client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_last = packet_ptr;
+            }
+            client_ptr -> nxd_mqtt_client_processing_packet -> nx_packet_length += packet_ptr -> nx_packet_length;
+
+            /* Start to process existing packet. */
+            packet_ptr = client_ptr -> nxd_mqtt_client_processing_packet;
+            client_ptr -> nxd_mqtt_client_processing_packet = NX_NULL;
+        }
+
+        /* Check notify function.  */
+        if (client_ptr -> nxd_mqtt_packet_receive_notify)
+        {
+
+            /* Call notify function. Return NX_TRUE if the packet has been consumed.  */
+            if (client_ptr -> nxd_mqtt_packet_receive_notify(client_ptr, packet_ptr, client_ptr -> nxd_mqtt_packet_receive_context) == NX_TRUE)
+            {
+                continue;
+            }
+        }
+
+        packet_consumed = NX_FALSE;
+        while (packet_ptr)
+        {
+            /* Parse the incoming packet. */
+            status = _nxd_mqtt_read_remaining_length(packet_ptr, &remaining_length, &offset);
+            if (status == NXD_MQTT_PARTIAL_PACKET)
+            {
+
+                /* We only have partial MQTT message. 
+                 * Put it to waiting list for more packets. */
+                client_ptr -> nxd_mqtt_client_processing_packet = packet_ptr;
+                packet_consumed = NX_TRUE;
+                break;
+            }
+            else if (status)
+            {
+                
+                /* Invalid packet. */
+                break;
+            }
+
+            /* Get packet type. */
+            if (nx_packet_data_extract_offset(packet_ptr, 0, &packet_type, 1, &bytes_copied))
+            {
+
+                /* Unable to read packet type. */
+                break;
+            }
+
+            /* Right shift 4 bits to get the packet type. */
+            packet_type = packet_type >> 4;
+
+            /* Process based on packet type. */
+            switch (packet_type)
+            {
+            case MQTT_CONTROL_PACKET_TYPE_CONNECT:
+                /* Client does not accept connections.  Nothing needs to be done. */
+                break;
+            case MQTT_CONTROL_PACKET_TYPE_CONNACK:
+                _nxd_mqtt_process_connack(client_ptr, packet_ptr, NX_NO_WAIT);
+                break;
+
+            case MQTT_CONTROL_PACKET_TYPE_PUBLISH:
+                packet_consumed = _nxd_mqtt_process_publish(client_ptr, packet_ptr);
+                break;
+
+            case MQTT_CONTROL_PACKET_TYPE_PUBACK:
+            case MQTT_CONTROL_PACKET_TYPE_PUBREL:
+                _nxd_mqtt_process_publish_response(client_ptr, packet_ptr);
+                break;
+
+            case MQTT_CONTROL_PACKET_TYPE_SUBSCRIBE:
+            case MQTT_CONTROL_PACKET_TYPE_UNSUBSCRIBE:
+                /* Client should not process subscribe or unsubscribe message. */
+                break;
+
+            case MQTT_CONTROL_PACKET_TYPE_SUBACK:
+            case MQTT_CONTROL_PACKET_TYPE_UNSUBACK:
+                _nxd_mqtt_process_sub_unsub_ack(client_ptr, packet_ptr);
+                break;
+
+
+            case MQTT_CONTROL_PACKET_TYPE_PINGREQ:
+                /* Client is not supposed to receive ping req.  Ignore it. */
+                break;
+
+            case MQTT_CONTROL_PACKET_TYPE_PINGRESP:
+                _nxd_mqtt_process_pingresp(client_ptr);
+                break;
+
+            case MQTT_CONTROL_PACKET_TYPE_DISCONNECT:
+                _nxd_mqtt_process_disconnect(client_ptr);
+                break;
+
+            /* Publisher sender message type for QoS 2. Not supported. */
+            case MQTT_CONTROL_PACKET_TYPE_PUBREC:
+            case MQTT_CONTROL_PACKET_TYPE_PUBCOMP:
+            default:
+                /* Unknown type. */
+                break;
+            }
+
+            if (packet_consumed)
+            {
+                break;
+            }
+
+            /* Trim current packet. */
+            offset += remaining_length;
+            packet_length = packet_ptr -> nx_packet_length;
+            if (packet_length > offset)
+            {
+
+                /* Multiple MQTT message in one packet. */
+                packet_length = packet_ptr -> nx_packet_length - offset;
+                while ((ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr) <= offset)
+                {
+                    offset -= (ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr);
+
+                    /* Current packet can be released. */
+                    previous_packet_ptr = packet_ptr;
+                    packet_ptr = packet_ptr -> nx_packet_next;
+                    previous_packet_ptr -> nx_packet_next = NX_NULL;
+                    nx_packet_release(previous_packet_ptr);
+                    if (packet_ptr == NX_NULL)
+                    {
+
+                        /* Invalid packet. */
+                        break;
+                    }
+                }
+
+                if (packet_ptr)
+                {
+
+                    /* Adjust current packet. */
+                    packet_ptr -> nx_packet_prepend_ptr = packet_ptr -> nx_packet_prepend_ptr + offset;
+                    packet_ptr -> nx_packet_length = packet_length;
+                }
+            }
+            else
+            {
+
+                /* All messages in current packet is processed. */
+                break;
+            }
+        }
+
+        if (!packet_consumed)
+        {
+            nx_packet_release(packet_ptr);
+        }
+    }
+
+    /* No more data in the receive queue.  Return. */
+
+    return;
+}
 
-/* MQTT internal function */
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_periodic_timer_entry                      PORTABLE C      */
+/*    _nxd_mqtt_tcp_establish_process                     PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -2606,15 +3079,11 @@ static UINT _nxd_mqtt_send_simple_message(NXD_MQTT_CLIENT *client_ptr, UCHAR hea
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function is passed to MQTT client socket create call. */
-/*    This callback function notifies MQTT client thread when the TCP     */
-/*    connection is lost.                                                 */
-/*                                                                        */
+/*    This function processes MQTT TCP connection establish event.        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    socket_ptr                            Pointer to TCP socket that    */
-/*                                            disconnected.               */
+/*    client_ptr                            Pointer to MQTT Client        */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -2622,11 +3091,13 @@ static UINT _nxd_mqtt_send_simple_message(NXD_MQTT_CLIENT *client_ptr, UCHAR hea
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    nx_secure_tls_session_start                                         */
+/*    _nxd_mqtt_client_connection_end                                     */
+/*    _nxd_mqtt_client_connect_packet_send                                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    TCP socket disconnect callback                                      */
+/*    _nxd_mqtt_client_event_process                                      */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -2637,51 +3108,66 @@ static UINT _nxd_mqtt_send_simple_message(NXD_MQTT_CLIENT *client_ptr, UCHAR hea
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nxd_mqtt_periodic_timer_entry(ULONG client)
+static VOID _nxd_mqtt_tcp_establish_process(NXD_MQTT_CLIENT *client_ptr)
 {
-/* Check if it is time to send out a ping message. */
-NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)client;
+UINT       status;
 
-    /* If an outstanding ping response has not been received, and the client exceeds the time waiting for ping response,
-       the client shall disconnect from the server. */
-    if (client_ptr -> nxd_mqtt_ping_not_responded)
+
+    /* TCP connection is established.  */
+
+    /* If TLS is enabled, start TLS */
+#ifdef NX_SECURE_ENABLE
+    if (client_ptr -> nxd_mqtt_client_use_tls)
     {
-        /* If current time is greater than the ping timeout */
-        if ((tx_time_get() - client_ptr -> nxd_mqtt_ping_sent_time) >= client_ptr -> nxd_mqtt_ping_timeout)
+        status = nx_secure_tls_session_start(&(client_ptr -> nxd_mqtt_tls_session), &(client_ptr -> nxd_mqtt_client_socket), NX_NO_WAIT);
+
+        if (status != NX_CONTINUE)
         {
-            /* Ping timed out.  Need to terminate the connection. */
-#ifndef NXD_MQTT_CLOUD_ENABLE
-            tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_PING_TIMEOUT_EVENT, TX_OR);
-#else
-            nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_PING_TIMEOUT_EVENT);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
+
+            /* End connection. */
+            _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
+
+            /* Check callback function.  */
+            if (client_ptr -> nxd_mqtt_connect_notify)
+            {
+                client_ptr -> nxd_mqtt_connect_notify(client_ptr, status, client_ptr -> nxd_mqtt_connect_context);
+            }
 
             return;
         }
+
+        /* TLS in progress.  */
+        client_ptr -> nxd_mqtt_tls_in_progress = NX_TRUE;
+
+        return;
     }
+#endif /* NX_SECURE_ENABLE */
 
-    /* About to timeout? */
-    if ((client_ptr -> nxd_mqtt_timeout - tx_time_get()) <= client_ptr -> nxd_mqtt_timer_value)
+    /* Start to send MQTT connect packet.  */
+    status = _nxd_mqtt_client_connect_packet_send(client_ptr, NX_NO_WAIT);
+
+    /* Check status.  */
+    if (status)
     {
-        /* Set the flag so the MQTT thread can send the ping. */
-#ifndef NXD_MQTT_CLOUD_ENABLE
-        tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_TIMEOUT_EVENT, TX_OR);
-#else
-        nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_TIMEOUT_EVENT);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
-    }
 
-    /* If keepalive is not enabled, just return. */
-    return;
-}
+        /* End connection. */
+        _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
 
+        /* Check callback function.  */
+        if (client_ptr -> nxd_mqtt_connect_notify)
+        {
+            client_ptr -> nxd_mqtt_connect_notify(client_ptr, status, client_ptr -> nxd_mqtt_connect_context);
+        }
+    }
+}
 
 
+#ifdef NX_SECURE_ENABLE
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_event_process                      PORTABLE C      */
+/*    _nxd_mqtt_tls_establish_process                     PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -2689,12 +3175,11 @@ NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)client;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function serves as the entry point for the MQTT       */
-/*    client thread.                                                      */
+/*    This function processes TLS connection establish event.             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    mqtt_client                           Pointer to MQTT Client        */
+/*    client_ptr                            Pointer to MQTT Client        */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -2702,139 +3187,77 @@ NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)client;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_release_transmit_packet                                   */
-/*    _nxd_mqtt_release_receive_packet                                    */
-/*    _nxd_mqtt_send_simple_message                                       */
-/*    _nxd_mqtt_process_disconnect                                        */
-/*    _nxd_mqtt_packet_receive_process                                    */
-/*    tx_timer_delete                                                     */
-/*    tx_event_flags_delete                                               */
-/*    nx_tcp_socket_delete                                                */
-/*    tx_timer_delete                                                     */
-/*    tx_mutex_delete                                                     */
+/*    _nx_secure_tls_handshake_process                                    */
+/*    _nxd_mqtt_client_connect_packet_send                                */
+/*    _nxd_mqtt_client_connection_end                                     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*   _nxd_mqtt_client_create                                              */
+/*    _nxd_mqtt_client_event_process                                      */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            corrected mqtt client state,*/
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nxd_mqtt_client_event_process(VOID *mqtt_client, ULONG common_events, ULONG module_own_events)
+static VOID _nxd_mqtt_tls_establish_process(NXD_MQTT_CLIENT *client_ptr)
 {
-NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)mqtt_client;
-
-
-    /* Obtain the mutex. */
-    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
+UINT       status;
 
-    /* Process common events.  */
-    NX_PARAMETER_NOT_USED(common_events);
 
-    if (module_own_events & MQTT_TIMEOUT_EVENT)
+    /* Directly call handshake process for async mode. */
+    status = _nx_secure_tls_handshake_process(&(client_ptr -> nxd_mqtt_tls_session), NX_NO_WAIT);
+    if (status == NX_SUCCESS)
     {
-        /* Send out PING only if the client is connected. */
-        if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTED)
-        {
-            _nxd_mqtt_send_simple_message(client_ptr, MQTT_CONTROL_PACKET_TYPE_PINGREQ);
-        }
-    }
 
-    if (module_own_events & MQTT_TCP_ESTABLISH_EVENT)
-    {
-        _nxd_mqtt_tcp_establish_process(client_ptr);
-    }
+        /* TLS session established.   */
+        client_ptr -> nxd_mqtt_tls_in_progress= NX_FALSE;
 
-    if (module_own_events & MQTT_PACKET_RECEIVE_EVENT)
-    {
-#ifdef NX_SECURE_ENABLE
-        /* TLS in progress on async mode.  */
-        if (client_ptr -> nxd_mqtt_tls_in_progress)
+        /* Start to send MQTT connect packet.  */
+        status = _nxd_mqtt_client_connect_packet_send(client_ptr, NX_NO_WAIT);
+
+        /* Check status.  */
+        if (status)
         {
-            _nxd_mqtt_tls_establish_process(client_ptr);
-        }
-        else
-#endif /* NX_SECURE_ENABLE */
 
-        _nxd_mqtt_packet_receive_process(client_ptr);
-    }
+            /* End connection. */
+            _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
 
-    if (module_own_events & MQTT_PING_TIMEOUT_EVENT)
-    {
-        /* The server/broker didn't respond to our ping request message. Disconnect from the server. */
-        _nxd_mqtt_process_disconnect(client_ptr);
-    }
-    if (module_own_events & MQTT_NETWORK_DISCONNECT_EVENT)
-    {
-        /* The server closed TCP socket. We shall go through the disconnect code path. */
-        _nxd_mqtt_process_disconnect(client_ptr);
+            /* Check callback function.  */
+            if (client_ptr -> nxd_mqtt_connect_notify)
+            {
+                client_ptr -> nxd_mqtt_connect_notify(client_ptr, status, client_ptr -> nxd_mqtt_connect_context);
+            }
+        }
     }
-
-    if (module_own_events & MQTT_DELETE_EVENT)
+    else if (status != NX_CONTINUE)
     {
 
-        /* Stop the client and disconnect from the server. */
-        if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTED)
-        {
-            _nxd_mqtt_process_disconnect(client_ptr);
-        }
-
-        /* Delete the timer. Check first if it is already deleted. */
-        if ((client_ptr -> nxd_mqtt_timer).tx_timer_id != 0)
-            tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
-
-#ifndef NXD_MQTT_CLOUD_ENABLE
-        /* Delete the event flag. Check first if it is already deleted. */
-        if ((client_ptr -> nxd_mqtt_events).tx_event_flags_group_id != 0)
-            tx_event_flags_delete(&client_ptr -> nxd_mqtt_events);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
+        /* Error.  */
 
-        /* Release all the messages on the receive queue. */
-        while (client_ptr -> message_receive_queue_head)
-        {
-            _nxd_mqtt_release_receive_packet(client_ptr, client_ptr -> message_receive_queue_head, NX_NULL);
-        }
-        client_ptr -> message_receive_queue_depth = 0;
+        /* End connection. */
+        _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
 
-        /* Delete all the messages sitting in the receive and transmit queue. */
-        while (client_ptr -> message_transmit_queue_head)
+        /* Check callback function.  */
+        if (client_ptr -> nxd_mqtt_connect_notify)
         {
-            _nxd_mqtt_release_transmit_packet(client_ptr, client_ptr -> message_transmit_queue_head, NX_NULL);
+            client_ptr -> nxd_mqtt_connect_notify(client_ptr, status, client_ptr -> nxd_mqtt_connect_context);
         }
-
-        /* Release mutex */
-        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-        
-#ifndef NXD_MQTT_CLOUD_ENABLE
-        /* Delete the mutex. */
-        tx_mutex_delete(&client_ptr -> nxd_mqtt_protection);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
-
-        /* Deleting the socket, (the socket ID is cleared); this signals it is ok to delete this thread. */
-        nx_tcp_socket_delete(&client_ptr -> nxd_mqtt_client_socket);
     }
-    else
-    {
 
-        /* Release mutex */
-        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-    }
+    return;
 }
+#endif /* NX_SECURE_ENABLE */
 
-
-#ifndef NXD_MQTT_CLOUD_ENABLE
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_thread_entry                              PORTABLE C      */
+/*    _nxd_mqtt_client_append_message                     PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -2842,25 +3265,30 @@ NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)mqtt_client;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function serves as the entry point for the MQTT       */
-/*    client thread.                                                      */
+/*    This function writes the message length and message in the outgoing */
+/*    MQTT packet.                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    mqtt_client                           Pointer to MQTT Client        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    packet_ptr                            Outgoing MQTT packet          */
+/*    message                               Pointer to the message        */
+/*    length                                Length of the message         */
+/*    wait_option                           Wait option                   */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    None                                                                */
+/*    status                                                              */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    tx_event_flags_get                                                  */
-/*    _nxd_mqtt_client_event_process                                      */
+/*    nx_packet_data_append                 Append packet data            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*   _nxd_mqtt_client_create                                              */
+/*    _nxd_mqtt_client_sub_unsub                                          */
+/*    _nxd_mqtt_client_connect                                            */
+/*    _nxd_mqtt_client_publish                                            */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -2871,36 +3299,38 @@ NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)mqtt_client;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nxd_mqtt_thread_entry(ULONG mqtt_client)
+UINT _nxd_mqtt_client_append_message(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, CHAR *message, UINT length, ULONG wait_option)
 {
-NXD_MQTT_CLIENT *client_ptr;
-ULONG            events;
-
-    client_ptr = (NXD_MQTT_CLIENT *)mqtt_client;
+UINT ret = 0;
+UCHAR len[2];
 
-    /* Loop to process events on the MQTT client */
-    for (;;)
-    {
+    len[0] = (length >> 8) & 0xFF;
+    len[1] = length  & 0xFF;
 
-        tx_event_flags_get(&client_ptr -> nxd_mqtt_events, MQTT_ALL_EVENTS, TX_OR_CLEAR, &events, TX_WAIT_FOREVER);
+    /* Append message length field. */
+    ret = nx_packet_data_append(packet_ptr, len, 2, client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
 
-        /* Call the event processing routine.  */
-        _nxd_mqtt_client_event_process(client_ptr, NX_NULL, events);
+    if (ret)
+    {
+        return(ret);
+    }
 
-        if (events & MQTT_DELETE_EVENT)
-        {
-            break;
-        }
+    if (length)
+    {
+        /* Copy the string into the packet. */
+        ret = nx_packet_data_append(packet_ptr, message, length, 
+                                    client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
     }
+
+    return(ret);
 }
-#endif /* NXD_MQTT_CLOUD_ENABLE */
 
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _mqtt_client_disconnect_callback                    PORTABLE C      */
+/*    _nxd_mqtt_client_connection_end                     PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -2908,15 +3338,12 @@ ULONG            events;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function is passed to MQTT client socket create call. */
-/*    This callback function notifies MQTT client thread when the TCP     */
-/*    connection is lost.                                                 */
-/*                                                                        */
+/*    This function is used to end the MQTT connection.                   */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    socket_ptr                            Pointer to TCP socket that    */
-/*                                            disconnected.               */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    wait_option                           Wait option                   */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -2924,11 +3351,16 @@ ULONG            events;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    nx_secure_tls_session_end             End TLS session               */
+/*    nx_secure_tls_session_delete          Delete TLS session            */
+/*    nx_tcp_socket_disconnect              Close TCP connection          */
+/*    nx_tcp_client_socket_unbind           Unbind TCP socket             */
+/*    tx_timer_delete                       Delete timer                  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    TCP socket disconnect callback                                      */
+/*    _nxd_mqtt_client_connect                                            */
+/*    _nxd_mqtt_process_disconnect                                        */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -2939,192 +3371,163 @@ ULONG            events;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-static VOID _mqtt_client_disconnect_callback(NX_TCP_SOCKET *socket_ptr)
+VOID _nxd_mqtt_client_connection_end(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option)
 {
-NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)(socket_ptr -> nx_tcp_socket_reserved_ptr);
 
-    /* Set the MQTT_NETWORK_DISCONNECT  event.  This event indicates
-       that the disconnect is initiated from the network. */
-#ifndef NXD_MQTT_CLOUD_ENABLE
-    tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_NETWORK_DISCONNECT_EVENT, TX_OR);
-#else
-    nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_NETWORK_DISCONNECT_EVENT);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
+    /* Obtain the mutex. */
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
 
-    return;
-}
+    /* Mark the session as terminated. */
+    client_ptr -> nxd_mqtt_client_state = NXD_MQTT_CLIENT_STATE_IDLE;
 
+    /* Release the mutex. */
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
 
-/**************************************************************************/
-/*                                                                        */
-/*  FUNCTION                                               RELEASE        */
-/*                                                                        */
-/*    _nxd_mqtt_client_create                             PORTABLE C      */
-/*                                                           6.1          */
-/*  AUTHOR                                                                */
+#ifdef NX_SECURE_ENABLE
+    if (client_ptr -> nxd_mqtt_client_use_tls)
+    {
+        nx_secure_tls_session_end(&(client_ptr -> nxd_mqtt_tls_session), wait_option);
+        nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
+    }
+#endif
+    nx_tcp_socket_disconnect(&(client_ptr -> nxd_mqtt_client_socket), wait_option);
+    nx_tcp_client_socket_unbind(&(client_ptr -> nxd_mqtt_client_socket));
+
+    /* Disable timer if timer has been started. */
+    if (client_ptr -> nxd_mqtt_keepalive)
+    {
+         tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
+    }
+}
+
+
+static UINT _nxd_mqtt_send_simple_message(NXD_MQTT_CLIENT *client_ptr, UCHAR header_value);
+
+
+/* MQTT internal function */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_periodic_timer_entry                      PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function creates an instance for MQTT Client.  It initializes  */
-/*    MQTT Client control block, creates a thread, mutex and event queue  */
-/*    for MQTT Client, and creates the TCP socket for MQTT messaging.     */
+/*    This internal function is passed to MQTT client socket create call. */
+/*    This callback function notifies MQTT client thread when the TCP     */
+/*    connection is lost.                                                 */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    client_ptr                            Pointer to MQTT Client        */
-/*    client_id                             Client ID for this instance   */
-/*    client_id_length                      Length of Client ID, in bytes */
-/*    ip_ptr                                Pointer to IP instance        */
-/*    pool_ptr                              Pointer to packet pool        */
-/*    stack_ptr                             Client thread's stack pointer */
-/*    stack_size                            Client thread's stack size    */
-/*    mqtt_thread_priority                  Priority for MQTT thread      */
-/*    memory_ptr                            Deprecated and not used       */
-/*    memory_size                           Deprecated and not used       */
+/*    socket_ptr                            Pointer to TCP socket that    */
+/*                                            disconnected.               */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    status                                Completion status             */
+/*    None                                                                */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_create_internal      Create mqtt client            */
+/*    None                                                                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    Application Code                                                    */
+/*    TCP socket disconnect callback                                      */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            corrected mqtt client state,*/
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name,
-                             CHAR *client_id, UINT client_id_length,
-                             NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr,
-                             VOID *stack_ptr, ULONG stack_size, UINT mqtt_thread_priority,
-                             VOID *memory_ptr, ULONG memory_size)
+static VOID _nxd_mqtt_periodic_timer_entry(ULONG client)
 {
+/* Check if it is time to send out a ping message. */
+NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)client;
 
-UINT    status;
-
-
-    NX_PARAMETER_NOT_USED(memory_ptr);
-    NX_PARAMETER_NOT_USED(memory_size);
-
-    /* Create MQTT client.  */
-    status = _nxd_mqtt_client_create_internal(client_ptr, client_name, client_id, client_id_length, ip_ptr,
-                                              pool_ptr, stack_ptr, stack_size, mqtt_thread_priority);
-
-    /* Check status.  */
-    if (status)
-    {
-        return(status);
-    }
-
-#ifdef NXD_MQTT_CLOUD_ENABLE
-
-    /* Create cloud helper.  */
-    status = nx_cloud_create(&(client_ptr -> nxd_mqtt_client_cloud), "Cloud Helper", stack_ptr, stack_size, mqtt_thread_priority);
-
-    /* Determine if an error occurred.  */
-    if (status != NX_SUCCESS)
+    /* If an outstanding ping response has not been received, and the client exceeds the time waiting for ping response,
+       the client shall disconnect from the server. */
+    if (client_ptr -> nxd_mqtt_ping_not_responded)
     {
+        /* If current time is greater than the ping timeout */
+        if ((tx_time_get() - client_ptr -> nxd_mqtt_ping_sent_time) >= client_ptr -> nxd_mqtt_ping_timeout)
+        {
+            /* Ping timed out.  Need to terminate the connection. */
+#ifndef NXD_MQTT_CLOUD_ENABLE
+            tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_PING_TIMEOUT_EVENT, TX_OR);
+#else
+            nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_PING_TIMEOUT_EVENT);
+#endif /* NXD_MQTT_CLOUD_ENABLE */
 
-        /* Delete internal resource created in _nxd_mqtt_client_create_internal().  */
-
-        /* Delete socket.  */
-        nx_tcp_socket_delete(&(client_ptr -> nxd_mqtt_client_socket));
-
-        return(NXD_MQTT_INTERNAL_ERROR);
+            return;
+        }
     }
 
-    /* Save the cloud pointer.  */
-    client_ptr -> nxd_mqtt_client_cloud_ptr = &(client_ptr -> nxd_mqtt_client_cloud);
-
-    /* Save the mutex pointer.  */
-    client_ptr -> nxd_mqtt_client_mutex_ptr = &(client_ptr -> nxd_mqtt_client_cloud.nx_cloud_mutex);
-
-    /* Register MQTT on cloud helper.  */
-    status = nx_cloud_module_register(client_ptr -> nxd_mqtt_client_cloud_ptr, &(client_ptr -> nxd_mqtt_client_cloud_module), client_name, NX_CLOUD_MODULE_MQTT_EVENT,
-                                      _nxd_mqtt_client_event_process, client_ptr);
-
-    /* Determine if an error occurred.  */
-    if (status != NX_SUCCESS)
+    /* About to timeout? */
+    if ((client_ptr -> nxd_mqtt_timeout - tx_time_get()) <= client_ptr -> nxd_mqtt_timer_value)
     {
-
-        /* Delete own created cloud.  */
-        nx_cloud_delete(&(client_ptr -> nxd_mqtt_client_cloud));
-
-        /* Delete internal resource created in _nxd_mqtt_client_create_internal().  */
-
-        /* Delete socket.  */
-        nx_tcp_socket_delete(&(client_ptr -> nxd_mqtt_client_socket));
-
-        return(NXD_MQTT_INTERNAL_ERROR);
-    }
-
+        /* Set the flag so the MQTT thread can send the ping. */
+#ifndef NXD_MQTT_CLOUD_ENABLE
+        tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_TIMEOUT_EVENT, TX_OR);
+#else
+        nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_TIMEOUT_EVENT);
 #endif /* NXD_MQTT_CLOUD_ENABLE */
+    }
 
-    /* Update state.  */
-    client_ptr -> nxd_mqtt_client_state = NXD_MQTT_CLIENT_STATE_IDLE;
-
-    /* Return.  */
-    return(NXD_MQTT_SUCCESS);
+    /* If keepalive is not enabled, just return. */
+    return;
 }
 
 
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_create_internal                    PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_client_event_process                      PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function creates an instance for MQTT Client.  It initializes  */
-/*    MQTT Client control block, creates a thread, mutex and event queue  */
-/*    for MQTT Client, and creates the TCP socket for MQTT messaging.     */
-/*                                                                        */
+/*    This internal function serves as the entry point for the MQTT       */
+/*    client thread.                                                      */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    client_ptr                            Pointer to MQTT Client        */
-/*    client_id                             Client ID for this instance   */
-/*    client_id_length                      Length of Client ID, in bytes */
-/*    ip_ptr                                Pointer to IP instance        */
-/*    pool_ptr                              Pointer to packet pool        */
-/*    stack_ptr                             Client thread's stack pointer */
-/*    stack_size                            Client thread's stack size    */
-/*    mqtt_thread_priority                  Priority for MQTT thread      */
+/*    mqtt_client                           Pointer to MQTT Client        */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    status                                Completion status             */
+/*    None                                                                */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    tx_thread_create                      Create a thread               */
-/*    tx_mutex_create                       Create mutex                  */
-/*    tx_mutex_get                                                        */
-/*    tx_mutex_put                                                        */
-/*    tx_event_flag_create                  Create event flag             */
+/*    _nxd_mqtt_release_transmit_packet                                   */
+/*    _nxd_mqtt_release_receive_packet                                    */
+/*    _nxd_mqtt_send_simple_message                                       */
+/*    _nxd_mqtt_process_disconnect                                        */
+/*    _nxd_mqtt_packet_receive_process                                    */
+/*    tx_timer_delete                                                     */
+/*    tx_event_flags_delete                                               */
+/*    nx_tcp_socket_delete                                                */
+/*    tx_timer_delete                                                     */
+/*    tx_mutex_delete                                                     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    Application Code                                                    */
+/*   _nxd_mqtt_client_create                                              */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -3134,112 +3537,119 @@ UINT    status;
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
 /*                                            corrected mqtt client state,*/
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            packet ID index,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static UINT _nxd_mqtt_client_create_internal(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name,
-                                             CHAR *client_id, UINT client_id_length,
-                                             NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr,
-                                             VOID *stack_ptr, ULONG stack_size, UINT mqtt_thread_priority)
+static VOID _nxd_mqtt_client_event_process(VOID *mqtt_client, ULONG common_events, ULONG module_own_events)
 {
-UINT                status;
-
-#ifdef NXD_MQTT_CLOUD_ENABLE
-    NX_PARAMETER_NOT_USED(stack_ptr);
-    NX_PARAMETER_NOT_USED(stack_size);
-    NX_PARAMETER_NOT_USED(mqtt_thread_priority);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
+NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)mqtt_client;
 
-    /* Clear the MQTT Client control block. */
-    NXD_MQTT_SECURE_MEMSET((void *)client_ptr, 0, sizeof(NXD_MQTT_CLIENT));
 
-#ifndef NXD_MQTT_CLOUD_ENABLE
+    /* Obtain the mutex. */
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
 
-    /* Create MQTT mutex.  */
-    status = tx_mutex_create(&client_ptr -> nxd_mqtt_protection, client_name, TX_NO_INHERIT);
+    /* Process common events.  */
+    NX_PARAMETER_NOT_USED(common_events);
 
-    /* Determine if an error occurred. */
-    if (status != TX_SUCCESS)
+    if (module_own_events & MQTT_TIMEOUT_EVENT)
     {
-
-        return(NXD_MQTT_INTERNAL_ERROR);
+        /* Send out PING only if the client is connected. */
+        if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTED)
+        {
+            _nxd_mqtt_send_simple_message(client_ptr, MQTT_CONTROL_PACKET_TYPE_PINGREQ);
+        }
     }
-    client_ptr -> nxd_mqtt_client_mutex_ptr = &(client_ptr -> nxd_mqtt_protection);
-
-    /* Now create MQTT client thread */
-    status = tx_thread_create(&(client_ptr -> nxd_mqtt_thread), client_name, _nxd_mqtt_thread_entry,
-                              (ULONG)client_ptr, stack_ptr, stack_size, mqtt_thread_priority, mqtt_thread_priority,
-                              NXD_MQTT_CLIENT_THREAD_TIME_SLICE, TX_DONT_START);
 
-    /* Determine if an error occurred. */
-    if (status != TX_SUCCESS)
+    if (module_own_events & MQTT_TCP_ESTABLISH_EVENT)
     {
-        /* Delete the mutex. */
-        tx_mutex_delete(&client_ptr -> nxd_mqtt_protection);
-
-        /* Return error code. */
-        return(NXD_MQTT_INTERNAL_ERROR);
+        _nxd_mqtt_tcp_establish_process(client_ptr);
     }
 
-    status = tx_event_flags_create(&(client_ptr -> nxd_mqtt_events), client_name);
-
-    if (status != TX_SUCCESS)
+    if (module_own_events & MQTT_PACKET_RECEIVE_EVENT)
     {
-        /* Delete the mutex. */
-        tx_mutex_delete(&client_ptr -> nxd_mqtt_protection);
+#ifdef NX_SECURE_ENABLE
+        /* TLS in progress on async mode.  */
+        if (client_ptr -> nxd_mqtt_tls_in_progress)
+        {
+            _nxd_mqtt_tls_establish_process(client_ptr);
+        }
+        else
+#endif /* NX_SECURE_ENABLE */
 
-        /* Delete the thread. */
-        tx_thread_delete(&(client_ptr -> nxd_mqtt_thread));
-        
-        /* Return error code. */
-        return(NXD_MQTT_INTERNAL_ERROR);
+        _nxd_mqtt_packet_receive_process(client_ptr);
     }
-#endif /* NXD_MQTT_CLOUD_ENABLE */
 
-    /* Record the client ID information. */
-    client_ptr -> nxd_mqtt_client_id = client_id;
-    client_ptr -> nxd_mqtt_client_id_length = client_id_length;
-    client_ptr -> nxd_mqtt_client_ip_ptr = ip_ptr;
-    client_ptr -> nxd_mqtt_client_packet_pool_ptr = pool_ptr;
-    client_ptr -> nxd_mqtt_client_name = client_name;
-
-    /* Create the socket. */
-    status = nx_tcp_socket_create(client_ptr -> nxd_mqtt_client_ip_ptr, &(client_ptr -> nxd_mqtt_client_socket), client_ptr -> nxd_mqtt_client_name,
-                                  NX_IP_NORMAL, NX_DONT_FRAGMENT, 0x80, NXD_MQTT_CLIENT_SOCKET_WINDOW_SIZE,
-                                  NX_NULL, _mqtt_client_disconnect_callback);
+    if (module_own_events & MQTT_PING_TIMEOUT_EVENT)
+    {
+        /* The server/broker didn't respond to our ping request message. Disconnect from the server. */
+        _nxd_mqtt_process_disconnect(client_ptr);
+    }
+    if (module_own_events & MQTT_NETWORK_DISCONNECT_EVENT)
+    {
+        /* The server closed TCP socket. We shall go through the disconnect code path. */
+        _nxd_mqtt_process_disconnect(client_ptr);
+    }
 
-    /* Determine if an error occurred. */
-    if (status != NX_SUCCESS)
+    if (module_own_events & MQTT_DELETE_EVENT)
     {
-#ifndef NXD_MQTT_CLOUD_ENABLE
-        /* Delete the mutex. */
-        tx_mutex_delete(&client_ptr -> nxd_mqtt_protection);
 
-        /* Delete the event flags. */
-        tx_event_flags_delete(&(client_ptr -> nxd_mqtt_events));
+        /* Stop the client and disconnect from the server. */
+        if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTED)
+        {
+            _nxd_mqtt_process_disconnect(client_ptr);
+        }
 
-        /* Delete the thread. */
-        tx_thread_delete(&(client_ptr -> nxd_mqtt_thread));
+        /* Delete the timer. Check first if it is already deleted. */
+        if ((client_ptr -> nxd_mqtt_timer).tx_timer_id != 0)
+            tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
+
+#ifndef NXD_MQTT_CLOUD_ENABLE
+        /* Delete the event flag. Check first if it is already deleted. */
+        if ((client_ptr -> nxd_mqtt_events).tx_event_flags_group_id != 0)
+            tx_event_flags_delete(&client_ptr -> nxd_mqtt_events);
 #endif /* NXD_MQTT_CLOUD_ENABLE */
 
-        return(NXD_MQTT_INTERNAL_ERROR);
-    }
+        /* Release all the messages on the receive queue. */
+        while (client_ptr -> message_receive_queue_head)
+        {
+            _nxd_mqtt_release_receive_packet(client_ptr, client_ptr -> message_receive_queue_head, NX_NULL);
+        }
+        client_ptr -> message_receive_queue_depth = 0;
 
-    /* Record the client_ptr in the socket structure. */
-    client_ptr -> nxd_mqtt_client_socket.nx_tcp_socket_reserved_ptr = (VOID *)client_ptr;
+        /* Delete all the messages sitting in the receive and transmit queue. */
+        while (client_ptr -> message_transmit_queue_head)
+        {
+            _nxd_mqtt_release_transmit_packet(client_ptr, client_ptr -> message_transmit_queue_head);
+        }
 
+        /* Release mutex */
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+        
 #ifndef NXD_MQTT_CLOUD_ENABLE
-    /* Start MQTT thread. */
-    tx_thread_resume(&(client_ptr -> nxd_mqtt_thread));
+        /* Delete the mutex. */
+        tx_mutex_delete(&client_ptr -> nxd_mqtt_protection);
 #endif /* NXD_MQTT_CLOUD_ENABLE */
-    return(NXD_MQTT_SUCCESS);
+
+        /* Deleting the socket, (the socket ID is cleared); this signals it is ok to delete this thread. */
+        nx_tcp_socket_delete(&client_ptr -> nxd_mqtt_client_socket);
+    }
+    else
+    {
+
+        /* Release mutex */
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+    }
 }
 
 
+#ifndef NXD_MQTT_CLOUD_ENABLE
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_login_set                          PORTABLE C      */
+/*    _nxd_mqtt_thread_entry                              PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -3247,35 +3657,25 @@ UINT                status;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function sets optional MQTT username and password.  Note       */
-/*    if the broker requires username and password, this information      */
-/*    must be set prior to calling nxd_mqtt_client_connect or             */
-/*    nxd_mqtt_client_secure_connect.                                     */
-/*                                                                        */
+/*    This internal function serves as the entry point for the MQTT       */
+/*    client thread.                                                      */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    client_ptr                            Pointer to MQTT Client        */
-/*    username                              User name, or NULL if user    */
-/*                                            name is not required        */
-/*    username_length                       Length of the user name, or   */
-/*                                            0 if user name is NULL      */
-/*    password                              Password string, or NULL if   */
-/*                                            password is not required    */
-/*    password_length                       Length of the password, or    */
-/*                                            0 if password is NULL       */
+/*    mqtt_client                           Pointer to MQTT Client        */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    status                                Completion status             */
+/*    None                                                                */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    tx_mutex_get                                                        */
+/*    tx_event_flags_get                                                  */
+/*    _nxd_mqtt_client_event_process                                      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    Application Code                                                    */
+/*   _nxd_mqtt_client_create                                              */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -3286,33 +3686,36 @@ UINT                status;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
-                                CHAR *username, UINT username_length, CHAR *password, UINT password_length)
+static VOID _nxd_mqtt_thread_entry(ULONG mqtt_client)
 {
-UINT status;
+NXD_MQTT_CLIENT *client_ptr;
+ULONG            events;
 
-    /* Obtain the mutex. */
-    status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+    client_ptr = (NXD_MQTT_CLIENT *)mqtt_client;
 
-    if (status != TX_SUCCESS)
+    /* Loop to process events on the MQTT client */
+    for (;;)
     {
-        return(NXD_MQTT_MUTEX_FAILURE);
-    }
-    client_ptr -> nxd_mqtt_client_username = username;
-    client_ptr -> nxd_mqtt_client_username_length = (USHORT)username_length;
-    client_ptr -> nxd_mqtt_client_password = password;
-    client_ptr -> nxd_mqtt_client_password_length = (USHORT)password_length;
 
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+        tx_event_flags_get(&client_ptr -> nxd_mqtt_events, MQTT_ALL_EVENTS, TX_OR_CLEAR, &events, TX_WAIT_FOREVER);
 
-    return(NX_SUCCESS);
+        /* Call the event processing routine.  */
+        _nxd_mqtt_client_event_process(client_ptr, NX_NULL, events);
+
+        if (events & MQTT_DELETE_EVENT)
+        {
+            break;
+        }
+    }
 }
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_will_message_set                   PORTABLE C      */
+/*    _mqtt_client_disconnect_callback                    PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -3320,39 +3723,27 @@ UINT status;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function sets optional MQTT will topic and will message.       */
-/*    Note that if will message is needed, application must set will      */
-/*    message prior to calling nxd_mqtt_client_connect or                 */
-/*    nxd_mqtt_client_secure_connect.                                     */
+/*    This internal function is passed to MQTT client socket create call. */
+/*    This callback function notifies MQTT client thread when the TCP     */
+/*    connection is lost.                                                 */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    client_ptr                            Pointer to MQTT Client        */
-/*    will_topic                            Will topic string.            */
-/*    will_topic_length                     Length of the will topic.     */
-/*    will_message                          Will message string.          */
-/*    will_message_length                   Length of the will message.   */
-/*    will_retain_flag                      Whether or not the will       */
-/*                                            message is to be retained   */
-/*                                            when it is published.       */
-/*                                            Valid values are NX_TRUE    */
-/*                                            NX_FALSE                    */
-/*    will_QoS                              QoS level to be used when     */
-/*                                            publishing will message.    */
-/*                                            Valid values are 0, 1, 2    */
+/*    socket_ptr                            Pointer to TCP socket that    */
+/*                                            disconnected.               */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    status                                Completion status             */
+/*    None                                                                */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    tx_mutex_get                                                        */
+/*    None                                                                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    Application Code                                                    */
+/*    TCP socket disconnect callback                                      */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -3363,39 +3754,19 @@ UINT status;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_will_message_set(NXD_MQTT_CLIENT *client_ptr,
-                                       const UCHAR *will_topic, UINT will_topic_length, const UCHAR *will_message,
-                                       UINT will_message_length, UINT will_retain_flag, UINT will_QoS)
+static VOID _mqtt_client_disconnect_callback(NX_TCP_SOCKET *socket_ptr)
 {
-UINT status;
-
-    if (will_QoS == 2)
-    {
-        return(NXD_MQTT_QOS2_NOT_SUPPORTED);
-    }
-
-    /* Obtain the mutex. */
-    status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
-
-    if (status != TX_SUCCESS)
-    {
-        return(NXD_MQTT_MUTEX_FAILURE);
-    }
-
-    client_ptr -> nxd_mqtt_client_will_topic = will_topic;
-    client_ptr -> nxd_mqtt_client_will_topic_length = will_topic_length;
-    client_ptr -> nxd_mqtt_client_will_message = will_message;
-    client_ptr -> nxd_mqtt_client_will_message_length = will_message_length;
-
-    if (will_retain_flag == NX_TRUE)
-    {
-        client_ptr -> nxd_mqtt_client_will_qos_retain = 0x80;
-    }
-    client_ptr -> nxd_mqtt_client_will_qos_retain = (UCHAR)(client_ptr -> nxd_mqtt_client_will_qos_retain | will_QoS);
+NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)(socket_ptr -> nx_tcp_socket_reserved_ptr);
 
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+    /* Set the MQTT_NETWORK_DISCONNECT  event.  This event indicates
+       that the disconnect is initiated from the network. */
+#ifndef NXD_MQTT_CLOUD_ENABLE
+    tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_NETWORK_DISCONNECT_EVENT, TX_OR);
+#else
+    nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_NETWORK_DISCONNECT_EVENT);
+#endif /* NXD_MQTT_CLOUD_ENABLE */
 
-    return(NX_SUCCESS);
+    return;
 }
 
 
@@ -3403,7 +3774,7 @@ UINT status;
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_will_message_set                  PORTABLE C      */
+/*    _nxd_mqtt_client_create                             PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -3411,25 +3782,23 @@ UINT status;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in the                              */
-/*    nxd_mqtt_client_will_message_set call.                              */
+/*    This function creates an instance for MQTT Client.  It initializes  */
+/*    MQTT Client control block, creates a thread, mutex and event queue  */
+/*    for MQTT Client, and creates the TCP socket for MQTT messaging.     */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    will_topic                            Will topic string.            */
-/*    will_topic_length                     Length of the will topic.     */
-/*    will_message                          Will message string.          */
-/*    will_message_length                   Length of the will message.   */
-/*    will_retain_flag                      Whether or not the will       */
-/*                                            message is to be retained   */
-/*                                            when it is published.       */
-/*                                            Valid values are NX_TRUE    */
-/*                                            NX_FALSE                    */
-/*    will_QoS                              QoS level to be used when     */
-/*                                            publishing will message.    */
-/*                                            Valid values are 0, 1, 2    */
+/*    client_id                             Client ID for this instance   */
+/*    client_id_length                      Length of Client ID, in bytes */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    stack_ptr                             Client thread's stack pointer */
+/*    stack_size                            Client thread's stack size    */
+/*    mqtt_thread_priority                  Priority for MQTT thread      */
+/*    memory_ptr                            Deprecated and not used       */
+/*    memory_size                           Deprecated and not used       */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -3437,7 +3806,7 @@ UINT status;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_will_message_set                                   */
+/*    _nxd_mqtt_client_create_internal      Create mqtt client            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -3448,45 +3817,91 @@ UINT status;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            corrected mqtt client state,*/
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_will_message_set(NXD_MQTT_CLIENT *client_ptr,
-                                        const UCHAR *will_topic, UINT will_topic_length, const UCHAR *will_message,
-                                        UINT will_message_length, UINT will_retain_flag, UINT will_QoS)
+UINT _nxd_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name,
+                             CHAR *client_id, UINT client_id_length,
+                             NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr,
+                             VOID *stack_ptr, ULONG stack_size, UINT mqtt_thread_priority,
+                             VOID *memory_ptr, ULONG memory_size)
 {
 
-    if (client_ptr == NX_NULL)
-    {
-        return(NXD_MQTT_INVALID_PARAMETER);
-    }
+UINT    status;
 
-    /* Valid will_topic string.  The will topic string cannot be NULL. */
-    if ((will_topic == NX_NULL) || (will_topic_length  == 0))
-    {
-        return(NXD_MQTT_INVALID_PARAMETER);
-    }
 
-    if ((will_retain_flag != NX_TRUE) && (will_retain_flag != NX_FALSE))
-    {
-        return(NXD_MQTT_INVALID_PARAMETER);
-    }
+    NX_PARAMETER_NOT_USED(memory_ptr);
+    NX_PARAMETER_NOT_USED(memory_size);
 
-    if (will_QoS > 2)
+    /* Create MQTT client.  */
+    status = _nxd_mqtt_client_create_internal(client_ptr, client_name, client_id, client_id_length, ip_ptr,
+                                              pool_ptr, stack_ptr, stack_size, mqtt_thread_priority);
+
+    /* Check status.  */
+    if (status)
     {
-        return(NXD_MQTT_INVALID_PARAMETER);
+        return(status);
     }
 
-    return(_nxd_mqtt_client_will_message_set(client_ptr, will_topic, will_topic_length, will_message,
-                                             will_message_length, will_retain_flag, will_QoS));
+#ifdef NXD_MQTT_CLOUD_ENABLE
+
+    /* Create cloud helper.  */
+    status = nx_cloud_create(&(client_ptr -> nxd_mqtt_client_cloud), "Cloud Helper", stack_ptr, stack_size, mqtt_thread_priority);
+
+    /* Determine if an error occurred.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Delete internal resource created in _nxd_mqtt_client_create_internal().  */
+
+        /* Delete socket.  */
+        nx_tcp_socket_delete(&(client_ptr -> nxd_mqtt_client_socket));
+
+        return(NXD_MQTT_INTERNAL_ERROR);
+    }
+
+    /* Save the cloud pointer.  */
+    client_ptr -> nxd_mqtt_client_cloud_ptr = &(client_ptr -> nxd_mqtt_client_cloud);
+
+    /* Save the mutex pointer.  */
+    client_ptr -> nxd_mqtt_client_mutex_ptr = &(client_ptr -> nxd_mqtt_client_cloud.nx_cloud_mutex);
+
+    /* Register MQTT on cloud helper.  */
+    status = nx_cloud_module_register(client_ptr -> nxd_mqtt_client_cloud_ptr, &(client_ptr -> nxd_mqtt_client_cloud_module), client_name, NX_CLOUD_MODULE_MQTT_EVENT,
+                                      _nxd_mqtt_client_event_process, client_ptr);
+
+    /* Determine if an error occurred.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Delete own created cloud.  */
+        nx_cloud_delete(&(client_ptr -> nxd_mqtt_client_cloud));
+
+        /* Delete internal resource created in _nxd_mqtt_client_create_internal().  */
+
+        /* Delete socket.  */
+        nx_tcp_socket_delete(&(client_ptr -> nxd_mqtt_client_socket));
+
+        return(NXD_MQTT_INTERNAL_ERROR);
+    }
+
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+
+    /* Update state.  */
+    client_ptr -> nxd_mqtt_client_state = NXD_MQTT_CLIENT_STATE_IDLE;
+
+    /* Return.  */
+    return(NXD_MQTT_SUCCESS);
 }
 
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_login_set                         PORTABLE C      */
+/*    _nxd_mqtt_client_create_internal                    PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -3494,20 +3909,21 @@ UINT _nxde_mqtt_client_will_message_set(NXD_MQTT_CLIENT *client_ptr,
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in the nxd_mqtt_client_login call.  */
+/*    This function creates an instance for MQTT Client.  It initializes  */
+/*    MQTT Client control block, creates a thread, mutex and event queue  */
+/*    for MQTT Client, and creates the TCP socket for MQTT messaging.     */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    username                              User name, or NULL if user    */
-/*                                            name is not required        */
-/*    username_length                       Length of the user name, or   */
-/*                                            0 if user name is NULL      */
-/*    password                              Password string, or NULL if   */
-/*                                            password is not required    */
-/*    password_length                       Length of the password, or    */
-/*                                            0 if password is NULL       */
+/*    client_id                             Client ID for this instance   */
+/*    client_id_length                      Length of Client ID, in bytes */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    stack_ptr                             Client thread's stack pointer */
+/*    stack_size                            Client thread's stack size    */
+/*    mqtt_thread_priority                  Priority for MQTT thread      */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -3515,7 +3931,11 @@ UINT _nxde_mqtt_client_will_message_set(NXD_MQTT_CLIENT *client_ptr,
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_login_set                                          */
+/*    tx_thread_create                      Create a thread               */
+/*    tx_mutex_create                       Create mutex                  */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
+/*    tx_event_flag_create                  Create event flag             */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -3526,27 +3946,107 @@ UINT _nxde_mqtt_client_will_message_set(NXD_MQTT_CLIENT *client_ptr,
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            corrected mqtt client state,*/
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
-                                 CHAR *username, UINT username_length, CHAR *password, UINT password_length)
+static UINT _nxd_mqtt_client_create_internal(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name,
+                                             CHAR *client_id, UINT client_id_length,
+                                             NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr,
+                                             VOID *stack_ptr, ULONG stack_size, UINT mqtt_thread_priority)
 {
-    if (client_ptr == NX_NULL)
+UINT                status;
+
+#ifdef NXD_MQTT_CLOUD_ENABLE
+    NX_PARAMETER_NOT_USED(stack_ptr);
+    NX_PARAMETER_NOT_USED(stack_size);
+    NX_PARAMETER_NOT_USED(mqtt_thread_priority);
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+
+    /* Clear the MQTT Client control block. */
+    NXD_MQTT_SECURE_MEMSET((void *)client_ptr, 0, sizeof(NXD_MQTT_CLIENT));
+
+#ifndef NXD_MQTT_CLOUD_ENABLE
+
+    /* Create MQTT mutex.  */
+    status = tx_mutex_create(&client_ptr -> nxd_mqtt_protection, client_name, TX_NO_INHERIT);
+
+    /* Determine if an error occurred. */
+    if (status != TX_SUCCESS)
     {
-        return(NXD_MQTT_INVALID_PARAMETER);
+
+        return(NXD_MQTT_INTERNAL_ERROR);
     }
+    client_ptr -> nxd_mqtt_client_mutex_ptr = &(client_ptr -> nxd_mqtt_protection);
 
-    /* Username and username length don't match,
-       or password and password length don't match. */
-    if (((username == NX_NULL) && (username_length != 0)) ||
-        ((password == NX_NULL) && (password_length != 0)))
+    /* Now create MQTT client thread */
+    status = tx_thread_create(&(client_ptr -> nxd_mqtt_thread), client_name, _nxd_mqtt_thread_entry,
+                              (ULONG)client_ptr, stack_ptr, stack_size, mqtt_thread_priority, mqtt_thread_priority,
+                              NXD_MQTT_CLIENT_THREAD_TIME_SLICE, TX_DONT_START);
+
+    /* Determine if an error occurred. */
+    if (status != TX_SUCCESS)
     {
-        return(NXD_MQTT_INVALID_PARAMETER);
+        /* Delete the mutex. */
+        tx_mutex_delete(&client_ptr -> nxd_mqtt_protection);
+
+        /* Return error code. */
+        return(NXD_MQTT_INTERNAL_ERROR);
     }
 
-    return(_nxd_mqtt_client_login_set(client_ptr, username, username_length, password, password_length));
+    status = tx_event_flags_create(&(client_ptr -> nxd_mqtt_events), client_name);
+
+    if (status != TX_SUCCESS)
+    {
+        /* Delete the mutex. */
+        tx_mutex_delete(&client_ptr -> nxd_mqtt_protection);
+
+        /* Delete the thread. */
+        tx_thread_delete(&(client_ptr -> nxd_mqtt_thread));
+        
+        /* Return error code. */
+        return(NXD_MQTT_INTERNAL_ERROR);
+    }
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+
+    /* Record the client ID information. */
+    client_ptr -> nxd_mqtt_client_id = client_id;
+    client_ptr -> nxd_mqtt_client_id_length = client_id_length;
+    client_ptr -> nxd_mqtt_client_ip_ptr = ip_ptr;
+    client_ptr -> nxd_mqtt_client_packet_pool_ptr = pool_ptr;
+    client_ptr -> nxd_mqtt_client_name = client_name;
+
+    /* Create the socket. */
+    status = nx_tcp_socket_create(client_ptr -> nxd_mqtt_client_ip_ptr, &(client_ptr -> nxd_mqtt_client_socket), client_ptr -> nxd_mqtt_client_name,
+                                  NX_IP_NORMAL, NX_DONT_FRAGMENT, 0x80, NXD_MQTT_CLIENT_SOCKET_WINDOW_SIZE,
+                                  NX_NULL, _mqtt_client_disconnect_callback);
+
+    /* Determine if an error occurred. */
+    if (status != NX_SUCCESS)
+    {
+#ifndef NXD_MQTT_CLOUD_ENABLE
+        /* Delete the mutex. */
+        tx_mutex_delete(&client_ptr -> nxd_mqtt_protection);
+
+        /* Delete the event flags. */
+        tx_event_flags_delete(&(client_ptr -> nxd_mqtt_events));
+
+        /* Delete the thread. */
+        tx_thread_delete(&(client_ptr -> nxd_mqtt_thread));
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+
+        return(NXD_MQTT_INTERNAL_ERROR);
+    }
+
+    /* Record the client_ptr in the socket structure. */
+    client_ptr -> nxd_mqtt_client_socket.nx_tcp_socket_reserved_ptr = (VOID *)client_ptr;
+
+#ifndef NXD_MQTT_CLOUD_ENABLE
+    /* Start MQTT thread. */
+    tx_thread_resume(&(client_ptr -> nxd_mqtt_thread));
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+    return(NXD_MQTT_SUCCESS);
 }
 
 
@@ -3554,7 +4054,7 @@ UINT _nxde_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_retransmit_message                 PORTABLE C      */
+/*    _nxd_mqtt_client_login_set                          PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -3562,14 +4062,23 @@ UINT _nxde_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function retransmit QoS1 messages upon reconnection, if the    */
-/*    connection is not set CLEAN_SESSION.                                */
+/*    This function sets optional MQTT username and password.  Note       */
+/*    if the broker requires username and password, this information      */
+/*    must be set prior to calling nxd_mqtt_client_connect or             */
+/*    nxd_mqtt_client_secure_connect.                                     */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    wait_option                           Timeout value                 */
+/*    username                              User name, or NULL if user    */
+/*                                            name is not required        */
+/*    username_length                       Length of the user name, or   */
+/*                                            0 if user name is NULL      */
+/*    password                              Password string, or NULL if   */
+/*                                            password is not required    */
+/*    password_length                       Length of the password, or    */
+/*                                            0 if password is NULL       */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -3578,12 +4087,6 @@ UINT _nxde_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    tx_mutex_get                                                        */
-/*    tx_mutex_put                                                        */
-/*    nx_secure_tls_session_send                                          */
-/*    nx_tcp_socket_send                                                  */
-/*    nx_packet_release                                                   */
-/*    tx_time_get                                                         */
-/*    nx_packet_copy                                                      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -3598,83 +4101,33 @@ UINT _nxde_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-static UINT _nxd_mqtt_client_retransmit_message(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option)
+UINT _nxd_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
+                                CHAR *username, UINT username_length, CHAR *password, UINT password_length)
 {
-NX_PACKET          *transmit_packet_ptr;
-NX_PACKET          *packet_ptr;
-UINT                status = NXD_MQTT_SUCCESS;
-UINT                mutex_status;
-UCHAR               fixed_header;
+UINT status;
 
-    transmit_packet_ptr = client_ptr -> message_transmit_queue_head;
+    /* Obtain the mutex. */
+    status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
 
-    while (transmit_packet_ptr)
+    if (status != TX_SUCCESS)
     {
-        fixed_header = *(transmit_packet_ptr -> nx_packet_prepend_ptr);
-
-        if ((fixed_header & 0xF0) == (MQTT_CONTROL_PACKET_TYPE_PUBLISH << 4))
-        {
-
-            /* Retransmit publish packet only. */
-            /* Obtain a NetX Packet. */
-            status = nx_packet_copy(transmit_packet_ptr, &packet_ptr, client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
+        return(NXD_MQTT_MUTEX_FAILURE);
+    }
+    client_ptr -> nxd_mqtt_client_username = username;
+    client_ptr -> nxd_mqtt_client_username_length = (USHORT)username_length;
+    client_ptr -> nxd_mqtt_client_password = password;
+    client_ptr -> nxd_mqtt_client_password_length = (USHORT)password_length;
 
-            if (status != NXD_MQTT_SUCCESS)
-            {
-                return(NXD_MQTT_PACKET_POOL_FAILURE);
-            }
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
 
-            /* Release the mutex. */
-            tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-
-            /* Send the packet. */
-#ifdef NX_SECURE_ENABLE
-            if (client_ptr -> nxd_mqtt_client_use_tls)
-            {
-                status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, wait_option);
-            }
-            else
-            {
-                status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
-            }
-#else
-            status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
-
-#endif /* NX_SECURE_ENABLE */
-
-            if (status)
-            {
-                /* Release the packet. */
-                nx_packet_release(packet_ptr);
-
-                status = NXD_MQTT_COMMUNICATION_FAILURE;
-            }
-            /* Obtain the mutex. */
-            mutex_status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, wait_option);
-
-            if (mutex_status != TX_SUCCESS)
-            {
-                return(NXD_MQTT_MUTEX_FAILURE);
-            }
-            if (status)
-            {
-                return(status);
-            }
-        }
-        transmit_packet_ptr = transmit_packet_ptr -> nx_packet_queue_next;
-    }
-
-    /* Update the timeout value. */
-    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
-
-    return(status);
-}
+    return(NX_SUCCESS);
+}
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_connect                            PORTABLE C      */
+/*    _nxd_mqtt_client_will_message_set                   PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -3682,19 +4135,27 @@ UCHAR               fixed_header;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function makes an initial connection to the MQTT server.       */
+/*    This function sets optional MQTT will topic and will message.       */
+/*    Note that if will message is needed, application must set will      */
+/*    message prior to calling nxd_mqtt_client_connect or                 */
+/*    nxd_mqtt_client_secure_connect.                                     */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    server_ip                             Server IP address structure   */
-/*    server_port                           Server port number, in host   */
-/*                                            byte order                  */
-/*    keepalive                             Keepalive flag                */
-/*    clean_session                         Clean session flag            */
-/*    wait_option                           Timeout value                 */
-/*                                                                        */
+/*    will_topic                            Will topic string.            */
+/*    will_topic_length                     Length of the will topic.     */
+/*    will_message                          Will message string.          */
+/*    will_message_length                   Length of the will message.   */
+/*    will_retain_flag                      Whether or not the will       */
+/*                                            message is to be retained   */
+/*                                            when it is published.       */
+/*                                            Valid values are NX_TRUE    */
+/*                                            NX_FALSE                    */
+/*    will_QoS                              QoS level to be used when     */
+/*                                            publishing will message.    */
+/*                                            Valid values are 0, 1, 2    */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -3703,26 +4164,6 @@ UCHAR               fixed_header;
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    tx_mutex_get                                                        */
-/*    nx_tcp_socket_create                  Create TCP socket             */
-/*    nx_tcp_socket_receive_notify                                        */
-/*    nx_tcp_client_socket_bind                                           */
-/*    nxd_tcp_client_socket_connect                                       */
-/*    nx_tcp_client_socket_unbind                                         */
-/*    tx_mutex_put                                                        */
-/*    nx_secure_tls_session_start                                         */
-/*    nx_secure_tls_session_send                                          */
-/*    nx_secure_tls_session_receive                                       */
-/*    _nxd_mqtt_packet_allocate                                           */
-/*    _nxd_mqtt_client_set_fixed_header                                   */
-/*    _nxd_mqtt_client_append_message                                     */
-/*    nx_tcp_socket_send                                                  */
-/*    nx_packet_release                                                   */
-/*    nx_tcp_socket_receive                                               */
-/*    tx_event_flag_set                                                   */
-/*    _nxd_mqtt_release_transmit_packet                                   */
-/*    tx_timer_create                                                     */
-/*    nx_secure_tls_session_receive                                       */
-/*    _nxd_mqtt_client_connection_end                                     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -3733,287 +4174,1976 @@ UCHAR               fixed_header;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            fixed return value when it  */
-/*                                            is set in CONNACK, corrected*/
-/*                                            mqtt client state,          */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_connect(NXD_MQTT_CLIENT *client_ptr, NXD_ADDRESS *server_ip, UINT server_port,
-                              UINT keepalive, UINT clean_session, ULONG wait_option)
+UINT _nxd_mqtt_client_will_message_set(NXD_MQTT_CLIENT *client_ptr,
+                                       const UCHAR *will_topic, UINT will_topic_length, const UCHAR *will_message,
+                                       UINT will_message_length, UINT will_retain_flag, UINT will_QoS)
 {
-NX_PACKET           *packet_ptr;
-UINT                 status;
-TX_THREAD           *thread_ptr;
-UINT                 new_priority;
-UINT                 old_priority;
+UINT status;
 
+    if (will_QoS == 2)
+    {
+        return(NXD_MQTT_QOS2_NOT_SUPPORTED);
+    }
 
     /* Obtain the mutex. */
     status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
 
     if (status != TX_SUCCESS)
     {
-#ifdef NX_SECURE_ENABLE
-        if (client_ptr -> nxd_mqtt_client_use_tls)
-        {
-            nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
-        }
-#endif /* NX_SECURE_ENABLE */
-
         return(NXD_MQTT_MUTEX_FAILURE);
     }
 
-    /* Do nothing if the client is already connected. */
-    if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTED)
-    {
-        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-        return(NXD_MQTT_ALREADY_CONNECTED);
-    }
+    client_ptr -> nxd_mqtt_client_will_topic = will_topic;
+    client_ptr -> nxd_mqtt_client_will_topic_length = will_topic_length;
+    client_ptr -> nxd_mqtt_client_will_message = will_message;
+    client_ptr -> nxd_mqtt_client_will_message_length = will_message_length;
 
-    /* Check if client is connecting. */
-    if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTING)
+    if (will_retain_flag == NX_TRUE)
     {
-        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-        return(NXD_MQTT_CONNECTING);
+        client_ptr -> nxd_mqtt_client_will_qos_retain = 0x80;
     }
+    client_ptr -> nxd_mqtt_client_will_qos_retain = (UCHAR)(client_ptr -> nxd_mqtt_client_will_qos_retain | will_QoS);
 
-    /* Client state must be in IDLE.  */
-    if (client_ptr -> nxd_mqtt_client_state != NXD_MQTT_CLIENT_STATE_IDLE)
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+    return(NX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxde_mqtt_client_will_message_set                  PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the                              */
+/*    nxd_mqtt_client_will_message_set call.                              */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    will_topic                            Will topic string.            */
+/*    will_topic_length                     Length of the will topic.     */
+/*    will_message                          Will message string.          */
+/*    will_message_length                   Length of the will message.   */
+/*    will_retain_flag                      Whether or not the will       */
+/*                                            message is to be retained   */
+/*                                            when it is published.       */
+/*                                            Valid values are NX_TRUE    */
+/*                                            NX_FALSE                    */
+/*    will_QoS                              QoS level to be used when     */
+/*                                            publishing will message.    */
+/*                                            Valid values are 0, 1, 2    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_mqtt_client_will_message_set                                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxde_mqtt_client_will_message_set(NXD_MQTT_CLIENT *client_ptr,
+                                        const UCHAR *will_topic, UINT will_topic_length, const UCHAR *will_message,
+                                        UINT will_message_length, UINT will_retain_flag, UINT will_QoS)
+{
+
+    if (client_ptr == NX_NULL)
     {
-#ifdef NX_SECURE_ENABLE
-        if (client_ptr -> nxd_mqtt_client_use_tls)
-        {
-            nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
-        }
-#endif /* NX_SECURE_ENABLE */
-        return(NXD_MQTT_INVALID_STATE);
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-#if defined(NX_SECURE_ENABLE) && defined(NXD_MQTT_REQUIRE_TLS)
-    if (!client_ptr -> nxd_mqtt_client_use_tls)
+    /* Valid will_topic string.  The will topic string cannot be NULL. */
+    if ((will_topic == NX_NULL) || (will_topic_length  == 0))
     {
-
-        /* NXD_MQTT_REQUIRE_TLS is defined but the application does not use TLS.
-           This is security violation.  Return with failure code. */
-        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-        return(NXD_MQTT_CONNECT_FAILURE);
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
-#endif /* NX_SECURE_ENABLE && NXD_MQTT_REQUIRE_TLS*/
 
-    /* Record the keepalive value, converted to TX timer ticks. */
-    client_ptr -> nxd_mqtt_keepalive = keepalive * NX_IP_PERIODIC_RATE;
-    if (keepalive)
+    if ((will_retain_flag != NX_TRUE) && (will_retain_flag != NX_FALSE))
     {
-        client_ptr -> nxd_mqtt_timer_value = NXD_MQTT_KEEPALIVE_TIMER_RATE;
-        client_ptr -> nxd_mqtt_ping_timeout = NXD_MQTT_PING_TIMEOUT_DELAY;
-
-        /* Create timer */
-        status = tx_timer_create(&(client_ptr -> nxd_mqtt_timer), "MQTT Timer", _nxd_mqtt_periodic_timer_entry, (ULONG)client_ptr,
-                                 client_ptr -> nxd_mqtt_timer_value, client_ptr -> nxd_mqtt_timer_value, TX_AUTO_ACTIVATE);
-        if (status)
-        {
-#ifdef NX_SECURE_ENABLE
-            if (client_ptr -> nxd_mqtt_client_use_tls)
-            {
-                nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
-            }
-#endif /* NX_SECURE_ENABLE */
-
-            tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-            return(NXD_MQTT_INTERNAL_ERROR);
-        }
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
-    else
+
+    if (will_QoS > 2)
     {
-        client_ptr -> nxd_mqtt_timer_value = 0;
-        client_ptr -> nxd_mqtt_ping_timeout = 0;
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-    /* Record the clean session flag.  */
-    client_ptr -> nxd_mqtt_clean_session = clean_session;
-
-    /* Set TCP connection establish notify for non-blocking mode.  */
-    if (wait_option == 0)
-    {
-        status = nx_tcp_socket_establish_notify(&client_ptr -> nxd_mqtt_client_socket, _nxd_mqtt_tcp_establish_notify);
+    return(_nxd_mqtt_client_will_message_set(client_ptr, will_topic, will_topic_length, will_message,
+                                             will_message_length, will_retain_flag, will_QoS));
+}
 
-        /* Check status.  */
-        if (status != NX_SUCCESS)
-        {
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxde_mqtt_client_login_set                         PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the nxd_mqtt_client_login call.  */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    username                              User name, or NULL if user    */
+/*                                            name is not required        */
+/*    username_length                       Length of the user name, or   */
+/*                                            0 if user name is NULL      */
+/*    password                              Password string, or NULL if   */
+/*                                            password is not required    */
+/*    password_length                       Length of the password, or    */
+/*                                            0 if password is NULL       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_mqtt_client_login_set                                          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxde_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
+                                 CHAR *username, UINT username_length, CHAR *password, UINT password_length)
+{
+    if (client_ptr == NX_NULL)
+    {
+        return(NXD_MQTT_INVALID_PARAMETER);
+    }
+
+    /* Username and username length don't match,
+       or password and password length don't match. */
+    if (((username == NX_NULL) && (username_length != 0)) ||
+        ((password == NX_NULL) && (password_length != 0)))
+    {
+        return(NXD_MQTT_INVALID_PARAMETER);
+    }
+
+    return(_nxd_mqtt_client_login_set(client_ptr, username, username_length, password, password_length));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_retransmit_message                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retransmit QoS1 messages upon reconnection, if the    */
+/*    connection is not set CLEAN_SESSION.                                */
+/*                                                                        */
+/*    If NXD_MQTT_ZERO_COPY_PUBLISH is defined, messages of which only    */
+/*    the fixed header was saved are dropped instead of being resent.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    wait_option                           Timeout value                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
+/*    _nxd_mqtt_client_secure_send                                        */
+/*    nx_tcp_socket_send                                                  */
+/*    nx_packet_release                                                   */
+/*    tx_time_get                                                         */
+/*    nx_packet_copy                                                      */
+/*    _nxd_mqtt_release_transmit_packet                                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), dropped  */
+/*                                            header only messages,       */
+/*                                            resulting in version 6.1.8  */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nxd_mqtt_client_retransmit_message(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option)
+{
+NX_PACKET          *transmit_packet_ptr;
+NX_PACKET          *packet_ptr;
+UINT                status = NXD_MQTT_SUCCESS;
+UINT                mutex_status;
+UCHAR               fixed_header;
+#ifdef NXD_MQTT_ZERO_COPY_PUBLISH
+NX_PACKET          *next_packet_ptr;
+#endif /* NXD_MQTT_ZERO_COPY_PUBLISH */
+
+    transmit_packet_ptr = client_ptr -> message_transmit_queue_head;
+
+    while (transmit_packet_ptr)
+    {
+#ifdef NXD_MQTT_ZERO_COPY_PUBLISH
+
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        if (((NXD_MQTT_TRANSMIT_INFO *)transmit_packet_ptr -> nx_packet_data_start) -> nxd_mqtt_transmit_header_only)
+        {
+
+            /* Only the fixed header of this message is saved, it cannot be retransmitted. Drop it. */
+            next_packet_ptr = transmit_packet_ptr -> nx_packet_queue_next;
+            _nxd_mqtt_release_transmit_packet(client_ptr, transmit_packet_ptr);
+            transmit_packet_ptr = next_packet_ptr;
+            continue;
+        }
+#endif /* NXD_MQTT_ZERO_COPY_PUBLISH */
+
+        fixed_header = *(transmit_packet_ptr -> nx_packet_prepend_ptr);
+
+        if ((fixed_header & 0xF0) == (MQTT_CONTROL_PACKET_TYPE_PUBLISH << 4))
+        {
+
+            /* Retransmit publish packet only. */
+            /* Obtain a NetX Packet. */
+            status = nx_packet_copy(transmit_packet_ptr, &packet_ptr, client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
+
+            if (status != NXD_MQTT_SUCCESS)
+            {
+                return(NXD_MQTT_PACKET_POOL_FAILURE);
+            }
+
+            /* Release the mutex. */
+            tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+            /* Send the packet. */
 #ifdef NX_SECURE_ENABLE
             if (client_ptr -> nxd_mqtt_client_use_tls)
             {
-                nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
+                status = _nxd_mqtt_client_secure_send(client_ptr, packet_ptr, wait_option);
+            }
+            else
+            {
+                status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
             }
+#else
+            status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
+
 #endif /* NX_SECURE_ENABLE */
-            tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
-            tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-            return(status);
-        }
 
-        /* Set the receive callback. */
-        nx_tcp_socket_receive_notify(&client_ptr -> nxd_mqtt_client_socket, _nxd_mqtt_receive_callback);
-    }
-    else
-    {
+            if (status)
+            {
+                /* Release the packet. */
+                nx_packet_release(packet_ptr);
 
-        /* Clean receive callback.  */
-        client_ptr -> nxd_mqtt_client_socket.nx_tcp_receive_callback = NX_NULL;
+                status = NXD_MQTT_COMMUNICATION_FAILURE;
+            }
+            /* Obtain the mutex. */
+            mutex_status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, wait_option);
+
+            if (mutex_status != TX_SUCCESS)
+            {
+                return(NXD_MQTT_MUTEX_FAILURE);
+            }
+            if (status)
+            {
+                return(status);
+            }
+        }
+        transmit_packet_ptr = transmit_packet_ptr -> nx_packet_queue_next;
     }
 
-    /* Release mutex */
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+    /* Update the timeout value. */
+    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
 
-    /* First attempt to bind the client socket. */
-    status = nx_tcp_client_socket_bind(&(client_ptr -> nxd_mqtt_client_socket), NX_ANY_PORT, wait_option);
+    return(status);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_connect                            PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function makes an initial connection to the MQTT server.       */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    server_ip                             Server IP address structure   */
+/*    server_port                           Server port number, in host   */
+/*                                            byte order                  */
+/*    keepalive                             Keepalive flag                */
+/*    clean_session                         Clean session flag            */
+/*    wait_option                           Timeout value                 */
+/*                                                                        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    nx_tcp_socket_create                  Create TCP socket             */
+/*    nx_tcp_socket_receive_notify                                        */
+/*    nx_tcp_client_socket_bind                                           */
+/*    nxd_tcp_client_socket_connect                                       */
+/*    nx_tcp_client_socket_unbind                                         */
+/*    tx_mutex_put                                                        */
+/*    nx_secure_tls_session_start                                         */
+/*    nx_secure_tls_session_send                                          */
+/*    nx_secure_tls_session_receive                                       */
+/*    _nxd_mqtt_packet_allocate                                           */
+/*    _nxd_mqtt_client_set_fixed_header                                   */
+/*    _nxd_mqtt_client_append_message                                     */
+/*    nx_tcp_socket_send                                                  */
+/*    nx_packet_release                                                   */
+/*    nx_tcp_socket_receive                                               */
+/*    tx_event_flag_set                                                   */
+/*    _nxd_mqtt_release_transmit_packet                                   */
+/*    tx_timer_create                                                     */
+/*    nx_secure_tls_session_receive                                       */
+/*    _nxd_mqtt_client_connection_end                                     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            fixed return value when it  */
+/*                                            is set in CONNACK, corrected*/
+/*                                            mqtt client state,          */
+/*                                            resulting in version 6.1    */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_connect(NXD_MQTT_CLIENT *client_ptr, NXD_ADDRESS *server_ip, UINT server_port,
+                              UINT keepalive, UINT clean_session, ULONG wait_option)
+{
+NX_PACKET           *packet_ptr;
+UINT                 status;
+TX_THREAD           *thread_ptr;
+UINT                 new_priority;
+UINT                 old_priority;
+
+
+    /* Obtain the mutex. */
+    status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+    if (status != TX_SUCCESS)
+    {
+#ifdef NX_SECURE_ENABLE
+        if (client_ptr -> nxd_mqtt_client_use_tls)
+        {
+            nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
+        }
+#endif /* NX_SECURE_ENABLE */
+
+        return(NXD_MQTT_MUTEX_FAILURE);
+    }
+
+    /* Do nothing if the client is already connected. */
+    if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTED)
+    {
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+        return(NXD_MQTT_ALREADY_CONNECTED);
+    }
+
+    /* Check if client is connecting. */
+    if (client_ptr -> nxd_mqtt_client_state == NXD_MQTT_CLIENT_STATE_CONNECTING)
+    {
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+        return(NXD_MQTT_CONNECTING);
+    }
+
+    /* Client state must be in IDLE.  */
+    if (client_ptr -> nxd_mqtt_client_state != NXD_MQTT_CLIENT_STATE_IDLE)
+    {
+#ifdef NX_SECURE_ENABLE
+        if (client_ptr -> nxd_mqtt_client_use_tls)
+        {
+            nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
+        }
+#endif /* NX_SECURE_ENABLE */
+        return(NXD_MQTT_INVALID_STATE);
+    }
+
+#if defined(NX_SECURE_ENABLE) && defined(NXD_MQTT_REQUIRE_TLS)
+    if (!client_ptr -> nxd_mqtt_client_use_tls)
+    {
+
+        /* NXD_MQTT_REQUIRE_TLS is defined but the application does not use TLS.
+           This is security violation.  Return with failure code. */
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+        return(NXD_MQTT_CONNECT_FAILURE);
+    }
+#endif /* NX_SECURE_ENABLE && NXD_MQTT_REQUIRE_TLS*/
+
+    /* Record the keepalive value, converted to TX timer ticks. */
+    client_ptr -> nxd_mqtt_keepalive = keepalive * NX_IP_PERIODIC_RATE;
+    if (keepalive)
+    {
+        client_ptr -> nxd_mqtt_timer_value = NXD_MQTT_KEEPALIVE_TIMER_RATE;
+        client_ptr -> nxd_mqtt_ping_timeout = NXD_MQTT_PING_TIMEOUT_DELAY;
+
+        /* Create timer */
+        status = tx_timer_create(&(client_ptr -> nxd_mqtt_timer), "MQTT Timer", _nxd_mqtt_periodic_timer_entry, (ULONG)client_ptr,
+                                 client_ptr -> nxd_mqtt_timer_value, client_ptr -> nxd_mqtt_timer_value, TX_AUTO_ACTIVATE);
+        if (status)
+        {
+#ifdef NX_SECURE_ENABLE
+            if (client_ptr -> nxd_mqtt_client_use_tls)
+            {
+                nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
+            }
+#endif /* NX_SECURE_ENABLE */
+
+            tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+            return(NXD_MQTT_INTERNAL_ERROR);
+        }
+    }
+    else
+    {
+        client_ptr -> nxd_mqtt_timer_value = 0;
+        client_ptr -> nxd_mqtt_ping_timeout = 0;
+    }
+
+    /* Record the clean session flag.  */
+    client_ptr -> nxd_mqtt_clean_session = clean_session;
+
+    /* Set TCP connection establish notify for non-blocking mode.  */
+    if (wait_option == 0)
+    {
+        status = nx_tcp_socket_establish_notify(&client_ptr -> nxd_mqtt_client_socket, _nxd_mqtt_tcp_establish_notify);
+
+        /* Check status.  */
+        if (status != NX_SUCCESS)
+        {
+#ifdef NX_SECURE_ENABLE
+            if (client_ptr -> nxd_mqtt_client_use_tls)
+            {
+                nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
+            }
+#endif /* NX_SECURE_ENABLE */
+            tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
+            tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+            return(status);
+        }
+
+        /* Set the receive callback. */
+        nx_tcp_socket_receive_notify(&client_ptr -> nxd_mqtt_client_socket, _nxd_mqtt_receive_callback);
+    }
+    else
+    {
+
+        /* Clean receive callback.  */
+        client_ptr -> nxd_mqtt_client_socket.nx_tcp_receive_callback = NX_NULL;
+    }
+
+    /* Release mutex */
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+    /* First attempt to bind the client socket. */
+    status = nx_tcp_client_socket_bind(&(client_ptr -> nxd_mqtt_client_socket), NX_ANY_PORT, wait_option);
+
+    if (status != NX_SUCCESS)
+    {
+#ifdef NX_SECURE_ENABLE
+        if (client_ptr -> nxd_mqtt_client_use_tls)
+        {
+            nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
+        }
+#endif /* NX_SECURE_ENABLE */
+        tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
+        return(NXD_MQTT_INTERNAL_ERROR);
+    }
+
+    /* Obtain the mutex. */
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+    /* Make state as NXD_MQTT_CLIENT_STATE_CONNECTING. */
+    client_ptr -> nxd_mqtt_client_state = NXD_MQTT_CLIENT_STATE_CONNECTING;
+
+    /* Release mutex. */
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+    /* Connect to the MQTT server */
+    status = nxd_tcp_client_socket_connect(&(client_ptr -> nxd_mqtt_client_socket), server_ip, server_port, wait_option);
+    if ((status != NX_SUCCESS) && (status != NX_IN_PROGRESS))
+    {
+
+        /* Obtain the mutex. */
+        tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+        /* Make state as NXD_MQTT_CLIENT_STATE_IDLE. */
+        client_ptr -> nxd_mqtt_client_state = NXD_MQTT_CLIENT_STATE_IDLE;
+
+        /* Release mutex. */
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+#ifdef NX_SECURE_ENABLE
+        if (client_ptr -> nxd_mqtt_client_use_tls)
+        {
+            nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
+        }
+#endif /* NX_SECURE_ENABLE */
+        nx_tcp_client_socket_unbind(&(client_ptr -> nxd_mqtt_client_socket));
+        tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
+        return(NXD_MQTT_CONNECT_FAILURE);
+    }
+
+    /* Just return for non-blocking mode.  */
+    if (status == NX_IN_PROGRESS)
+    {
+        return(NX_IN_PROGRESS);
+    }
+
+    /* Increase priority to the same of internal thread to avoid out of order packet process. */
+#ifndef NXD_MQTT_CLOUD_ENABLE
+    thread_ptr = &(client_ptr -> nxd_mqtt_thread);
+#else
+    thread_ptr = &(client_ptr -> nxd_mqtt_client_cloud_ptr -> nx_cloud_thread);
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+    tx_thread_info_get(thread_ptr, NX_NULL, NX_NULL, NX_NULL, 
+                       &new_priority, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+    tx_thread_priority_change(tx_thread_identify(), new_priority, &old_priority);
+
+    /* If TLS is enabled, start TLS */
+#ifdef NX_SECURE_ENABLE
+    if (client_ptr -> nxd_mqtt_client_use_tls)
+    {
+
+        status = nx_secure_tls_session_start(&(client_ptr -> nxd_mqtt_tls_session), &(client_ptr -> nxd_mqtt_client_socket), wait_option);
+
+        if (status != NX_SUCCESS)
+        {
+
+            /* Revert thread priority. */
+            tx_thread_priority_change(tx_thread_identify(), old_priority, &old_priority);
+
+            /* End connection. */
+            _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
+
+            return(NXD_MQTT_CONNECT_FAILURE);
+        }
+    }
+#endif /* NX_SECURE_ENABLE */
+
+    /* Start to send connect packet.  */
+    status = _nxd_mqtt_client_connect_packet_send(client_ptr, wait_option);
+
+    if (status != NX_SUCCESS)
+    {
+
+        /* Revert thread priority. */
+        tx_thread_priority_change(tx_thread_identify(), old_priority, &old_priority);
+
+        /* End connection. */
+        _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
+
+        return(NXD_MQTT_CONNECT_FAILURE);
+    }
+
+#ifdef NX_SECURE_ENABLE
+    if (client_ptr -> nxd_mqtt_client_use_tls)
+    {
+        status = nx_secure_tls_session_receive(&(client_ptr -> nxd_mqtt_tls_session), &packet_ptr, wait_option);
+    }
+    else
+    {
+        status = nx_tcp_socket_receive(&client_ptr -> nxd_mqtt_client_socket, &packet_ptr, wait_option);
+    }
+#else
+    status = nx_tcp_socket_receive(&client_ptr -> nxd_mqtt_client_socket, &packet_ptr, wait_option);
+#endif /* NX_SECURE_ENABLE */
+
+    /* Revert thread priority. */
+    tx_thread_priority_change(tx_thread_identify(), old_priority, &old_priority);
+
+    /* Check status.  */
+    if (status)
+    {
+
+        /* End connection. */
+        _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
+        return(NXD_MQTT_COMMUNICATION_FAILURE);
+    }
+
+    /* Process CONNACK message.  */
+    status = _nxd_mqtt_process_connack(client_ptr, packet_ptr, wait_option);
+
+    /* Release the packet.  */
+    nx_packet_release(packet_ptr);
+
+    /* Check status.  */
+    if (status == NX_SUCCESS)
+    {
+
+        /* Set the receive callback. */
+        nx_tcp_socket_receive_notify(&client_ptr -> nxd_mqtt_client_socket, _nxd_mqtt_receive_callback);
+    }
+
+    return(status);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_connect_packet_send                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends CONNECT packet to MQTT server.                  */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    keepalive                             Keepalive flag                */
+/*    clean_session                         Clean session flag            */
+/*    wait_option                           Timeout value                 */
+/*                                                                        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_release                                                   */
+/*    nx_tcp_socket_send                                                  */
+/*    _nxd_mqtt_client_secure_send                                        */
+/*    _nxd_mqtt_packet_allocate                                           */
+/*    _nxd_mqtt_release_transmit_packet                                   */
+/*    _nxd_mqtt_client_connection_end                                     */
+/*    _nxd_mqtt_client_set_fixed_header                                   */
+/*    _nxd_mqtt_client_append_message                                     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_connect                                            */
+/*    _nxd_mqtt_tcp_establish_process                                     */
+/*    _nxd_mqtt_tls_establish_process                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            packet ID index,            */
+/*                                            resulting in version 6.1.8  */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_connect_packet_send(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option)
+{
+NX_PACKET           *packet_ptr;
+UINT                 status;
+UINT                 length = 0;
+UCHAR                connection_flags = 0;
+UINT                 ret = NXD_MQTT_SUCCESS;
+UCHAR                temp_data[4];
+UINT                 keepalive = (client_ptr -> nxd_mqtt_keepalive/NX_IP_PERIODIC_RATE);
+
+
+    /* Construct connect flags by taking the connect flag user supplies, or'ing the username and
+       password bits, if they are supplied. */
+    if (client_ptr -> nxd_mqtt_client_username)
+    {
+        connection_flags |= MQTT_CONNECT_FLAGS_USERNAME;
+
+        /* Add the password flag only if username is supplied. */
+        if (client_ptr -> nxd_mqtt_client_password)
+        {
+            connection_flags |= MQTT_CONNECT_FLAGS_PASSWORD;
+        }
+    }
+
+    if (client_ptr -> nxd_mqtt_client_will_topic)
+    {
+        connection_flags = connection_flags | MQTT_CONNECT_FLAGS_WILL_FLAG;
+
+
+        if (client_ptr -> nxd_mqtt_client_will_qos_retain & 0x80)
+        {
+            connection_flags = connection_flags | MQTT_CONNECT_FLAGS_WILL_RETAIN;
+        }
+
+        connection_flags = (UCHAR)(connection_flags | ((client_ptr -> nxd_mqtt_client_will_qos_retain & 0x3) << 3));
+    }
+
+    if (client_ptr -> nxd_mqtt_clean_session == NX_TRUE)
+    {
+        connection_flags = connection_flags | MQTT_CONNECT_FLAGS_CLEAN_SESSION;
+
+        /* Clear any transmit blocks from the previous session. */
+        while (client_ptr -> message_transmit_queue_head)
+        {
+            _nxd_mqtt_release_transmit_packet(client_ptr, client_ptr -> message_transmit_queue_head);
+        }
+    }
+
+    /* Set the length of the packet. */
+    length = 10;
+
+    /* Add the size of the client Identifier. */
+    length += (client_ptr -> nxd_mqtt_client_id_length + 2);
+
+    /* Add the will topic, if present. */
+    if (connection_flags & MQTT_CONNECT_FLAGS_WILL_FLAG)
+    {
+        length += (client_ptr -> nxd_mqtt_client_will_topic_length + 2);
+        length += (client_ptr -> nxd_mqtt_client_will_message_length + 2);
+    }
+    if (connection_flags & MQTT_CONNECT_FLAGS_USERNAME)
+    {
+        length += (UINT)(client_ptr -> nxd_mqtt_client_username_length + 2);
+    }
+    if (connection_flags & MQTT_CONNECT_FLAGS_PASSWORD)
+    {
+        length += (UINT)(client_ptr -> nxd_mqtt_client_password_length + 2);
+    }
+
+    /* Check for invalid length. */
+    if (length > (127 * 127 * 127 * 127))
+    {
+        return(NXD_MQTT_INTERNAL_ERROR);
+    }
+
+    status = _nxd_mqtt_packet_allocate(client_ptr, &packet_ptr);
+    if (status)
+    {
+
+        return(status);
+    }
+
+    /* Construct MQTT CONNECT message. */
+    temp_data[0] = ((MQTT_CONTROL_PACKET_TYPE_CONNECT << 4) & 0xF0);
+
+    /* Fill in fixed header. */
+    ret = _nxd_mqtt_client_set_fixed_header(client_ptr, packet_ptr, temp_data[0], length, wait_option);
+
+    if (ret)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
+
+        return(NXD_MQTT_PACKET_POOL_FAILURE);
+    }
+
+    ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, "MQTT", 4, wait_option);
+
+    if (ret)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
+
+        return(NXD_MQTT_PACKET_POOL_FAILURE);
+    }
+
+    /* Fill in protocol level, */
+    temp_data[0] = MQTT_PROTOCOL_LEVEL;
+
+    /* Fill in byte 8: connect flags */
+    temp_data[1] = connection_flags;
+
+    /* Fill in byte 9 and 10: keep alive */
+    temp_data[2] = (keepalive >> 8) & 0xFF;
+    temp_data[3] = (keepalive & 0xFF);
+
+    ret = nx_packet_data_append(packet_ptr, temp_data, 4, client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
+
+    if (ret)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
+
+        return(NXD_MQTT_PACKET_POOL_FAILURE);
+    }
+
+    /* Fill in payload area, in the order of: client identifier, will topic, will message,
+       user name, and password. */
+    ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, client_ptr -> nxd_mqtt_client_id, 
+                                          client_ptr -> nxd_mqtt_client_id_length, wait_option);
+
+    /* Next fill will topic and will message if the will flag is set. */
+    if (!ret && (connection_flags & MQTT_CONNECT_FLAGS_WILL_FLAG))
+    {
+        ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, (CHAR *)client_ptr -> nxd_mqtt_client_will_topic,
+                                              client_ptr -> nxd_mqtt_client_will_topic_length, wait_option);
+
+        if (!ret)
+        {
+            ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, (CHAR *)client_ptr -> nxd_mqtt_client_will_message,
+                                                  client_ptr -> nxd_mqtt_client_will_message_length, wait_option);
+        }
+    }
+
+    /* Fill username if username flag is set */
+    if (!ret && (connection_flags & MQTT_CONNECT_FLAGS_USERNAME))
+    {
+        ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, client_ptr -> nxd_mqtt_client_username, 
+                                              client_ptr -> nxd_mqtt_client_username_length, wait_option);
+    }
+
+    /* Fill password if password flag is set */
+    if (!ret && (connection_flags & MQTT_CONNECT_FLAGS_PASSWORD))
+    {
+        ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, client_ptr -> nxd_mqtt_client_password, 
+                                              client_ptr -> nxd_mqtt_client_password_length, wait_option);
+    }
+
+    if (ret)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
+
+        return(NXD_MQTT_PACKET_POOL_FAILURE);
+    }
+
+    /* Ready to send the connect message to the server. */
+#ifdef NX_SECURE_ENABLE
+    if (client_ptr -> nxd_mqtt_client_use_tls)
+    {
+        status = _nxd_mqtt_client_secure_send(client_ptr, packet_ptr, wait_option);
+    }
+    else
+    {
+        status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
+    }
+#else
+    status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
+
+#endif /* NX_SECURE_ENABLE */
+
+    if (status)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
+    }
+
+    /* Update the timeout value. */
+    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
+
+    return(status);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_secure_connect                     PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function makes an initial secure (TLS) connection to           */
+/*    the MQTT server.                                                    */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    server_ip                             Server IP address structure   */
+/*    server_port                           Server port number, in host   */
+/*                                            byte order                  */
+/*    tls_setup                             User-supplied callback        */
+/*                                            function to set up TLS      */
+/*                                            parameters.                 */
+/*    username                              User name, or NULL if user    */
+/*                                            name is not required        */
+/*    username_length                       Length of the user name, or   */
+/*                                            0 if user name is NULL      */
+/*    password                              Password string, or NULL if   */
+/*                                            password is not required    */
+/*    password_length                       Length of the password, or    */
+/*                                            0 if password is NULL       */
+/*    connection_flag                       Flag passed to the server     */
+/*    timeout                               Timeout value                 */
+/*                                                                        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_mqtt_client_connect              Actual MQTT Client connect    */
+/*                                            call                        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_ENABLE
+UINT _nxd_mqtt_client_secure_connect(NXD_MQTT_CLIENT *client_ptr, NXD_ADDRESS *server_ip, UINT server_port,
+                                     UINT (*tls_setup)(NXD_MQTT_CLIENT *client_ptr, NX_SECURE_TLS_SESSION *,
+                                                       NX_SECURE_X509_CERT *, NX_SECURE_X509_CERT *),
+                                     UINT keepalive, UINT clean_session, ULONG wait_option)
+{
+UINT ret;
+
+    /* Set up TLS session information. */
+    ret = (*tls_setup)(client_ptr, &client_ptr -> nxd_mqtt_tls_session,
+                       &client_ptr -> nxd_mqtt_tls_certificate,
+                       &client_ptr -> nxd_mqtt_tls_trusted_certificate);
+
+    if (ret)
+    {
+        return(ret);
+    }
+
+    /* Mark the connection as secure. */
+    client_ptr -> nxd_mqtt_client_use_tls = 1;
+
+    ret = _nxd_mqtt_client_connect(client_ptr, server_ip, server_port, keepalive, clean_session, wait_option);
+
+    return(ret);
+}
+
+#endif /* NX_SECURE_ENABLE */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_delete                             PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes a previously created MQTT client instance.    */
+/*    If the NXD_MQTT_SOCKET_TIMEOUT is set to NX_WAIT_FOREVER, this may  */
+/*    suspend infinitely. This is because the MQTT Client must            */
+/*    disconnect with the server, and if the network link is disabled or  */
+/*    the server is not responding, this will blocks this function from   */
+/*    completing.                                                         */ 
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_event_flags_set                                                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr)
+{
+
+
+    /* Set the event flag for DELETE. Next time when the MQTT client thread
+       wakes up, it will perform the deletion process. */
+#ifndef NXD_MQTT_CLOUD_ENABLE
+    tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_DELETE_EVENT, TX_OR);
+#else
+    nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_DELETE_EVENT);
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+
+    /* Check if the MQTT client thread has completed. */
+    while((client_ptr -> nxd_mqtt_client_socket).nx_tcp_socket_id != 0) 
+    {
+        tx_thread_sleep(NX_IP_PERIODIC_RATE);
+    }
+
+#ifndef NXD_MQTT_CLOUD_ENABLE
+    /* Now we can delete the Client instance. */
+    tx_thread_delete(&(client_ptr -> nxd_mqtt_thread));
+#else
+    /* Deregister mqtt module from cloud helper.  */
+    nx_cloud_module_deregister(client_ptr -> nxd_mqtt_client_cloud_ptr, &(client_ptr -> nxd_mqtt_client_cloud_module));
+
+    /* Delete own created cloud.  */
+    if (client_ptr -> nxd_mqtt_client_cloud.nx_cloud_id == NX_CLOUD_ID)
+        nx_cloud_delete(&(client_ptr -> nxd_mqtt_client_cloud));
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+
+    return(NXD_MQTT_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_publish_packet_send                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends a publish packet to the connected broker.       */
+/*                                                                        */
+/*    If NXD_MQTT_ZERO_COPY_PUBLISH is defined and the client uses a      */
+/*    clean session, only the fixed header of a QoS 1 message is saved    */
+/*    to match the PUBACK, since the message is never retransmitted.      */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    packet_ptr                            Pointer to publish packet     */
+/*    packet_id                             Current packet ID             */
+/*    QoS                                   Quality of service            */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
+/*    nx_tcp_socket_send                                                  */
+/*    _nxd_mqtt_client_secure_send                                        */
+/*    nx_packet_release                                                   */
+/*    _nxd_mqtt_copy_transmit_packet                                      */
+/*    _nxd_mqtt_save_transmit_header                                      */
+/*    _nxd_mqtt_enqueue_transmit_packet                                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_publish                                            */
+/*    _nxd_mqtt_client_publish_packet                                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            zero copy publish option,   */
+/*                                            resulting in version 6.1.8  */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_publish_packet_send(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr,
+                                          USHORT packet_id, UINT QoS, ULONG wait_option)
+{
+
+UINT       status;
+UINT       ret = NXD_MQTT_SUCCESS;
+
+    if (QoS != 0)
+    {
+    /* This packet needs to be stored locally for possible retransmission. */
+    NX_PACKET *transmit_packet_ptr;
+
+#ifdef NXD_MQTT_ZERO_COPY_PUBLISH
+        if (client_ptr -> nxd_mqtt_clean_session == NX_TRUE)
+        {
+
+            /* Save the fixed header only, the message is not retransmitted in a clean session. */
+            status = _nxd_mqtt_save_transmit_header(client_ptr, packet_ptr, &transmit_packet_ptr,
+                                                    packet_id, wait_option);
+        }
+        else
+#endif /* NXD_MQTT_ZERO_COPY_PUBLISH */
+        {
+
+            /* Copy packet for retransmission. */
+            status = _nxd_mqtt_copy_transmit_packet(client_ptr, packet_ptr, &transmit_packet_ptr,
+                                                    packet_id, NX_TRUE, wait_option);
+        }
+
+        if (status)
+        {
+            return(NXD_MQTT_PACKET_POOL_FAILURE);
+        }
+
+        /* Obtain the mutex. */
+        status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+        if (status != TX_SUCCESS)
+        {
+            nx_packet_release(transmit_packet_ptr);
+            return(NXD_MQTT_MUTEX_FAILURE);
+        }
+
+        /* Queue the packet until it is acknowledged. */
+        _nxd_mqtt_enqueue_transmit_packet(client_ptr, transmit_packet_ptr);
+    }
+    else
+    {
+
+        /* Obtain the mutex. */
+        status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+        if (status != TX_SUCCESS)
+        {
+            return(NXD_MQTT_MUTEX_FAILURE);
+        }
+    }
+
+    /* Update the timeout value. */
+    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
+
+
+    /* Release the mutex. */
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+    /* Ready to send the connect message to the server. */
+#ifdef NX_SECURE_ENABLE
+    if (client_ptr -> nxd_mqtt_client_use_tls)
+    {
+        status = _nxd_mqtt_client_secure_send(client_ptr, packet_ptr, wait_option);
+    }
+    else
+    {
+        status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
+    }
+#else
+    status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
+
+#endif /* NX_SECURE_ENABLE */
+
+    if (status)
+    {
+        ret = NXD_MQTT_COMMUNICATION_FAILURE;
+    }
+
+    return(ret);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_publish                            PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function publishes a message to the connected broker.          */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    topic_name                            Name of the topic             */
+/*    topic_name_length                     Length of the topic name      */
+/*    message                               Message string                */
+/*    message_length                        Length of the message,        */
+/*                                            in bytes                    */
+/*    retain                                The retain flag, whether      */
+/*                                            or not the broker should    */
+/*                                            store this message          */
+/*    QoS                                   Expected QoS level            */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    _nxd_mqtt_packet_allocate                                           */
+/*    _nxd_mqtt_client_set_fixed_header                                   */
+/*    _nxd_mqtt_client_append_message                                     */
+/*    tx_mutex_put                                                        */
+/*    nx_packet_release                                                   */
+/*    _nxd_mqtt_client_publish_packet_send                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
+                              CHAR *message, UINT message_length, UINT retain, UINT QoS, ULONG wait_option)
+{
+
+NX_PACKET *packet_ptr;
+UINT       status;
+UINT       length = 0;
+UCHAR      flags;
+USHORT     packet_id = 0;
+UINT       ret = NXD_MQTT_SUCCESS;
+
+    if (QoS == 2)
+    {
+        return(NXD_MQTT_QOS2_NOT_SUPPORTED);
+    }
+
+
+    /* Do nothing if the client is already connected. */
+    if (client_ptr -> nxd_mqtt_client_state != NXD_MQTT_CLIENT_STATE_CONNECTED)
+    {
+        return(NXD_MQTT_NOT_CONNECTED);
+    }
+
+    status = _nxd_mqtt_packet_allocate(client_ptr, &packet_ptr);
+
+    if (status != NXD_MQTT_SUCCESS)
+    {
+        return(NXD_MQTT_PACKET_POOL_FAILURE);
+    }
+
+    flags = (UCHAR)((MQTT_CONTROL_PACKET_TYPE_PUBLISH << 4) | (QoS << 1));
+
+    if (retain)
+    {
+        flags = flags | MQTT_PUBLISH_RETAIN;
+    }
+
+
+    /* Compute the remaining length. */
+
+    /* Topic Name. */
+    /* Compute Topic Name length. */
+    length = topic_name_length + 2;
+
+    /* Count packet ID for QoS 1 or QoS 2 message. */
+    if ((QoS == 1) || (QoS == 2))
+    {
+        length += 2;
+    }
+
+    /* Count message. */
+    if ((message != NX_NULL) && (message_length != 0))
+    {
+        length += message_length;
+    }
+
+    /* Write out the control header and remaining length field. */
+    ret = _nxd_mqtt_client_set_fixed_header(client_ptr, packet_ptr, flags, length, wait_option);
+
+    if (ret)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
+
+        return(NXD_MQTT_INTERNAL_ERROR);
+    }
+
+
+    /* Write out topic */
+    ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, topic_name, topic_name_length, wait_option);
+
+    if (ret)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
+
+        return(NXD_MQTT_INTERNAL_ERROR);
+    }
+
+    /* Append Packet Identifier for QoS level 1 or 2  MQTT 3.3.2.2 */
+    if ((QoS == 1) || (QoS == 2))
+    {
+    UCHAR identifier[2];
+
+        /* Obtain the mutex. */
+        status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+        if (status != TX_SUCCESS)
+        {
+            return(NXD_MQTT_MUTEX_FAILURE);
+        }
+
+        packet_id = (USHORT)client_ptr -> nxd_mqtt_client_packet_identifier;
+        identifier[0] = (UCHAR)(client_ptr -> nxd_mqtt_client_packet_identifier >> 8);
+        identifier[1] = (client_ptr -> nxd_mqtt_client_packet_identifier & 0xFF);
+
+        /* Update packet id. */
+        client_ptr -> nxd_mqtt_client_packet_identifier = (client_ptr -> nxd_mqtt_client_packet_identifier + 1) & 0xFFFF;
+
+        /* Prevent packet identifier from being zero. MQTT-2.3.1-1 */
+        if(client_ptr -> nxd_mqtt_client_packet_identifier == 0)
+            client_ptr -> nxd_mqtt_client_packet_identifier = 1;
+
+        /* Release the mutex. */
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+        ret = nx_packet_data_append(packet_ptr, identifier, 2, 
+                                    client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
+
+        if (ret)
+        {
+
+            /* Release the packet. */
+            nx_packet_release(packet_ptr);
+
+            return(NXD_MQTT_INTERNAL_ERROR);
+        }
+    }
+
+    /* Append message. */
+    if ((message != NX_NULL) && (message_length) != 0)
+    {
+        
+        /* Use nx_packet_data_append to move user-supplied message data into the packet.
+           nx_packet_data_append uses chained packet if the additional storage space is 
+           needed. */
+        ret = nx_packet_data_append(packet_ptr, message, message_length, 
+                                       client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
+        if(ret)
+        {
+            /* Unable to obtain a new packet to store the message. */
+
+            /* Release the packet. */
+            nx_packet_release(packet_ptr);
+
+            return(NXD_MQTT_INTERNAL_ERROR);
+        }
+    }
+
+    /* Send publish packet. */
+    ret = _nxd_mqtt_client_publish_packet_send(client_ptr, packet_ptr, packet_id, QoS, wait_option);
+
+    if (ret)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
+    }
+    return(ret);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_publish_packet_allocate            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a packet for the application to write the   */
+/*    message of a PUBLISH into. Room for the IP, TCP and TLS headers     */
+/*    and for the PUBLISH fixed header, topic name and packet identifier  */
+/*    is reserved in front of the packet data, so the message can be      */
+/*    sent with _nxd_mqtt_client_publish_packet without being copied.     */
+/*    The application appends the message with nx_packet_data_append.     */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    packet_ptr                            Allocated packet to be        */
+/*                                            returned to the caller      */
+/*    topic_name_length                     Length of the topic name      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_mqtt_packet_allocate                                           */
+/*    nx_packet_release                                                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_publish_packet_allocate(NXD_MQTT_CLIENT *client_ptr, NX_PACKET **packet_ptr, UINT topic_name_length)
+{
+
+UINT  status;
+ULONG header_size;
+
+    /* The packet headers depend on the connection. */
+    if (client_ptr -> nxd_mqtt_client_state != NXD_MQTT_CLIENT_STATE_CONNECTED)
+    {
+        return(NXD_MQTT_NOT_CONNECTED);
+    }
+
+    status = _nxd_mqtt_packet_allocate(client_ptr, packet_ptr);
+
+    if (status != NXD_MQTT_SUCCESS)
+    {
+        return(NXD_MQTT_PACKET_POOL_FAILURE);
+    }
+
+    /* Reserve the largest fixed header, the topic name and the packet identifier. */
+    header_size = 5 + 2 + (ULONG)topic_name_length + 2;
+
+    if ((ULONG)((*packet_ptr) -> nx_packet_data_end - (*packet_ptr) -> nx_packet_prepend_ptr) < header_size)
+    {
+
+        /* Release the packet. */
+        nx_packet_release(*packet_ptr);
+
+        return(NXD_MQTT_INSUFFICIENT_BUFFER_SPACE);
+    }
+
+    (*packet_ptr) -> nx_packet_prepend_ptr += header_size;
+    (*packet_ptr) -> nx_packet_append_ptr = (*packet_ptr) -> nx_packet_prepend_ptr;
+
+    return(NXD_MQTT_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_publish_packet                     PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function publishes a message held in a packet owned by the     */
+/*    application. The PUBLISH fixed header, topic name and packet        */
+/*    identifier are written into the space in front of the message, and  */
+/*    the packet itself is sent, so the message is not copied. The packet */
+/*    is normally allocated with                                          */
+/*    _nxd_mqtt_client_publish_packet_allocate.                           */
+/*                                                                        */
+/*    On success the packet belongs to the client. If an error is         */
+/*    returned, the application still owns the packet and must release    */
+/*    it. A QoS 1 message is copied for retransmission unless             */
+/*    NXD_MQTT_ZERO_COPY_PUBLISH is defined and the client uses a clean   */
+/*    session.                                                            */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    topic_name                            Name of the topic             */
+/*    topic_name_length                     Length of the topic name      */
+/*    packet_ptr                            Packet holding the message    */
+/*    retain                                The retain flag, whether      */
+/*                                            or not the broker should    */
+/*                                            store this message          */
+/*    QoS                                   Expected QoS level            */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
+/*    _nxd_mqtt_client_publish_packet_send                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_publish_packet(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
+                                     NX_PACKET *packet_ptr, UINT retain, UINT QoS, ULONG wait_option)
+{
+
+UCHAR     *header_ptr;
+UINT       status;
+ULONG      length;
+ULONG      remaining_length;
+ULONG      header_size;
+UCHAR      flags;
+USHORT     packet_id = 0;
+
+    if (QoS == 2)
+    {
+        return(NXD_MQTT_QOS2_NOT_SUPPORTED);
+    }
+
+    /* Do nothing if the client is not connected. */
+    if (client_ptr -> nxd_mqtt_client_state != NXD_MQTT_CLIENT_STATE_CONNECTED)
+    {
+        return(NXD_MQTT_NOT_CONNECTED);
+    }
+
+    flags = (UCHAR)((MQTT_CONTROL_PACKET_TYPE_PUBLISH << 4) | (QoS << 1));
+
+    if (retain)
+    {
+        flags = flags | MQTT_PUBLISH_RETAIN;
+    }
+
+    /* Compute the size of the topic name and packet identifier. */
+    header_size = (ULONG)topic_name_length + 2;
+
+    if (QoS == 1)
+    {
+        header_size += 2;
+    }
+
+    /* Compute the remaining length, which must fit in four bytes. MQTT 2.2.3 */
+    length = header_size + packet_ptr -> nx_packet_length;
+
+    if (length > 0x0FFFFFFF)
+    {
+        return(NXD_MQTT_INVALID_PARAMETER);
+    }
+
+    /* Count the control header and the remaining length field. */
+    remaining_length = length;
+    header_size++;
+
+    do
+    {
+        header_size++;
+        remaining_length = remaining_length >> 7;
+    } while (remaining_length != 0);
+
+    /* The header is written in front of the message. */
+    if ((ULONG)(packet_ptr -> nx_packet_prepend_ptr - packet_ptr -> nx_packet_data_start) < header_size)
+    {
+        return(NXD_MQTT_INSUFFICIENT_BUFFER_SPACE);
+    }
+
+    /* Obtain a packet identifier for QoS level 1 message. MQTT 3.3.2.2 */
+    if (QoS == 1)
+    {
+
+        /* Obtain the mutex. */
+        status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+        if (status != TX_SUCCESS)
+        {
+            return(NXD_MQTT_MUTEX_FAILURE);
+        }
+
+        packet_id = (USHORT)client_ptr -> nxd_mqtt_client_packet_identifier;
+
+        /* Update packet id. */
+        client_ptr -> nxd_mqtt_client_packet_identifier = (client_ptr -> nxd_mqtt_client_packet_identifier + 1) & 0xFFFF;
+
+        /* Prevent packet identifier from being zero. MQTT-2.3.1-1 */
+        if(client_ptr -> nxd_mqtt_client_packet_identifier == 0)
+            client_ptr -> nxd_mqtt_client_packet_identifier = 1;
+
+        /* Release the mutex. */
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+    }
+
+    /* Write out the control header and remaining length field. */
+    header_ptr = packet_ptr -> nx_packet_prepend_ptr - header_size;
+    *header_ptr++ = flags;
+
+    do
+    {
+        if (length & 0xFFFFFF80)
+        {
+            *header_ptr++ = (UCHAR)((length & 0x7F) | 0x80);
+        }
+        else
+        {
+            *header_ptr++ = (UCHAR)(length & 0x7F);
+        }
+        length = length >> 7;
+    } while (length != 0);
+
+    /* Write out topic. */
+    *header_ptr++ = (UCHAR)((topic_name_length >> 8) & 0xFF);
+    *header_ptr++ = (UCHAR)(topic_name_length & 0xFF);
+    NXD_MQTT_SECURE_MEMCPY(header_ptr, topic_name, topic_name_length); /* Use case of memcpy is verified. */
+    header_ptr += topic_name_length;
+
+    /* Write out the packet identifier. */
+    if (QoS == 1)
+    {
+        *header_ptr++ = (UCHAR)(packet_id >> 8);
+        *header_ptr = (UCHAR)(packet_id & 0xFF);
+    }
+
+    packet_ptr -> nx_packet_prepend_ptr -= header_size;
+    packet_ptr -> nx_packet_length += header_size;
+
+    /* Send publish packet. */
+    return(_nxd_mqtt_client_publish_packet_send(client_ptr, packet_ptr, packet_id, QoS, wait_option));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_subscribe                          PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends a subscribe message to the broker.              */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    topic_name                            Pointer to the topic string   */
+/*                                            to subscribe to             */
+/*    topic_name_length                     Length of the topic string    */
+/*                                            in bytes                    */
+/*    QoS                                   Expected QoS level            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_mqtt_client_sub_unsub            The actual routine that       */
+/*                                            performs the sub/unsub      */
+/*                                            action.                     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*  11-09-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            added packet id parameter,  */
+/*                                            resulting in version 6.1.2  */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_subscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length, UINT QoS)
+{
 
-    if (status != NX_SUCCESS)
+    if (QoS == 2)
     {
-#ifdef NX_SECURE_ENABLE
-        if (client_ptr -> nxd_mqtt_client_use_tls)
-        {
-            nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
-        }
-#endif /* NX_SECURE_ENABLE */
-        tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
-        return(NXD_MQTT_INTERNAL_ERROR);
+        return(NXD_MQTT_QOS2_NOT_SUPPORTED);
     }
 
-    /* Obtain the mutex. */
-    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
-
-    /* Make state as NXD_MQTT_CLIENT_STATE_CONNECTING. */
-    client_ptr -> nxd_mqtt_client_state = NXD_MQTT_CLIENT_STATE_CONNECTING;
+    return(_nxd_mqtt_client_sub_unsub(client_ptr, (MQTT_CONTROL_PACKET_TYPE_SUBSCRIBE << 4) | 0x02,
+                                      topic_name, topic_name_length, NX_NULL, QoS));
+}
 
-    /* Release mutex. */
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
 
-    /* Connect to the MQTT server */
-    status = nxd_tcp_client_socket_connect(&(client_ptr -> nxd_mqtt_client_socket), server_ip, server_port, wait_option);
-    if ((status != NX_SUCCESS) && (status != NX_IN_PROGRESS))
-    {
 
-        /* Obtain the mutex. */
-        tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
 
-        /* Make state as NXD_MQTT_CLIENT_STATE_IDLE. */
-        client_ptr -> nxd_mqtt_client_state = NXD_MQTT_CLIENT_STATE_IDLE;
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_unsubscribe                        PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function unsubscribes a topic from the broker.                 */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    topic_name                            Pointer to the topic string   */
+/*                                            to subscribe to             */
+/*    topic_name_length                     Length of the topic string    */
+/*                                            in bytes                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_mqtt_client_sub_unsub                                          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*  11-09-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            added packet id parameter,  */
+/*                                            resulting in version 6.1.2  */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length)
+{
+    return(_nxd_mqtt_client_sub_unsub(client_ptr, (MQTT_CONTROL_PACKET_TYPE_UNSUBSCRIBE << 4) | 0x02,
+                                      topic_name, topic_name_length, NX_NULL, 0));
+}
 
-        /* Release mutex. */
-        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_send_simple_message                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function handles the transmission of PINGREQ or       */
+/*    DISCONNECT message.                                                 */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    header_value                          Value to be programmed into   */
+/*                                            MQTT header.                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    _nxd_mqtt_packet_allocate                                           */
+/*    tx_mutex_put                                                        */
+/*    nx_tcp_socket_send                                                  */
+/*    _nxd_mqtt_client_secure_send                                        */
+/*    nx_packet_release                                                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_ping                                               */
+/*    _nxd_mqtt_client_disconnect                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), flushed  */
+/*                                            coalesced TLS records,      */
+/*                                            resulting in version 6.1.8  */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nxd_mqtt_send_simple_message(NXD_MQTT_CLIENT *client_ptr, UCHAR header_value)
+{
 
-#ifdef NX_SECURE_ENABLE
-        if (client_ptr -> nxd_mqtt_client_use_tls)
-        {
-            nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
-        }
-#endif /* NX_SECURE_ENABLE */
-        nx_tcp_client_socket_unbind(&(client_ptr -> nxd_mqtt_client_socket));
-        tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
-        return(NXD_MQTT_CONNECT_FAILURE);
-    }
+NX_PACKET *packet_ptr;
+UINT       status;
+UINT       status_mutex;
+UCHAR     *byte;
 
-    /* Just return for non-blocking mode.  */
-    if (status == NX_IN_PROGRESS)
+    status = _nxd_mqtt_packet_allocate(client_ptr, &packet_ptr);
+    if (status)
     {
-        return(NX_IN_PROGRESS);
+        return(NXD_MQTT_INTERNAL_ERROR);
     }
 
-    /* Increase priority to the same of internal thread to avoid out of order packet process. */
-#ifndef NXD_MQTT_CLOUD_ENABLE
-    thread_ptr = &(client_ptr -> nxd_mqtt_thread);
-#else
-    thread_ptr = &(client_ptr -> nxd_mqtt_client_cloud_ptr -> nx_cloud_thread);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
-    tx_thread_info_get(thread_ptr, NX_NULL, NX_NULL, NX_NULL, 
-                       &new_priority, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
-    tx_thread_priority_change(tx_thread_identify(), new_priority, &old_priority);
-
-    /* If TLS is enabled, start TLS */
-#ifdef NX_SECURE_ENABLE
-    if (client_ptr -> nxd_mqtt_client_use_tls)
+    if (2u > ((ULONG)(packet_ptr -> nx_packet_data_end) - (ULONG)(packet_ptr -> nx_packet_append_ptr)))
     {
+        nx_packet_release(packet_ptr);
 
-        status = nx_secure_tls_session_start(&(client_ptr -> nxd_mqtt_tls_session), &(client_ptr -> nxd_mqtt_client_socket), wait_option);
-
-        if (status != NX_SUCCESS)
-        {
-
-            /* Revert thread priority. */
-            tx_thread_priority_change(tx_thread_identify(), old_priority, &old_priority);
-
-            /* End connection. */
-            _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
-
-            return(NXD_MQTT_CONNECT_FAILURE);
-        }
+        /* Packet buffer is too small to hold the message. */
+        return(NX_SIZE_ERROR);
     }
-#endif /* NX_SECURE_ENABLE */
 
-    /* Start to send connect packet.  */
-    status = _nxd_mqtt_client_connect_packet_send(client_ptr, wait_option);
-
-    if (status != NX_SUCCESS)
-    {
+    byte = packet_ptr -> nx_packet_prepend_ptr;
 
-        /* Revert thread priority. */
-        tx_thread_priority_change(tx_thread_identify(), old_priority, &old_priority);
+    *byte = (UCHAR)(header_value << 4);
+    *(byte + 1) = 0;
 
-        /* End connection. */
-        _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
+    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + 2;
+    packet_ptr -> nx_packet_length = 2;
 
-        return(NXD_MQTT_CONNECT_FAILURE);
-    }
 
+    /* Release MQTT protection before making NetX/TLS calls. */
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
 #ifdef NX_SECURE_ENABLE
     if (client_ptr -> nxd_mqtt_client_use_tls)
     {
-        status = nx_secure_tls_session_receive(&(client_ptr -> nxd_mqtt_tls_session), &packet_ptr, wait_option);
+        status = _nxd_mqtt_client_secure_send(client_ptr, packet_ptr, NX_WAIT_FOREVER);
     }
     else
     {
-        status = nx_tcp_socket_receive(&client_ptr -> nxd_mqtt_client_socket, &packet_ptr, wait_option);
+        status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, NX_WAIT_FOREVER);
     }
 #else
-    status = nx_tcp_socket_receive(&client_ptr -> nxd_mqtt_client_socket, &packet_ptr, wait_option);
-#endif /* NX_SECURE_ENABLE */
 
-    /* Revert thread priority. */
-    tx_thread_priority_change(tx_thread_identify(), old_priority, &old_priority);
+    status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, NX_WAIT_FOREVER);
 
-    /* Check status.  */
+#endif /* NX_SECURE_ENABLE */
+
+    status_mutex = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
     if (status)
     {
 
-        /* End connection. */
-        _nxd_mqtt_client_connection_end(client_ptr, NX_NO_WAIT);
-        return(NXD_MQTT_COMMUNICATION_FAILURE);
-    }
-
-    /* Process CONNACK message.  */
-    status = _nxd_mqtt_process_connack(client_ptr, packet_ptr, wait_option);
-
-    /* Release the packet.  */
-    nx_packet_release(packet_ptr);
+        /* Release the packet. */
+        nx_packet_release(packet_ptr);
 
-    /* Check status.  */
-    if (status == NX_SUCCESS)
+        status = NXD_MQTT_COMMUNICATION_FAILURE;
+    }
+    if (status_mutex)
     {
+        return(NXD_MQTT_MUTEX_FAILURE);
+    }
 
-        /* Set the receive callback. */
-        nx_tcp_socket_receive_notify(&client_ptr -> nxd_mqtt_client_socket, _nxd_mqtt_receive_callback);
+    if (header_value == MQTT_CONTROL_PACKET_TYPE_PINGREQ)
+    {
+        /* Do not update the ping sent time if the outstanding ping has not been responded yet */
+        if (client_ptr -> nxd_mqtt_ping_not_responded != 1)
+        {
+            /* Record the time we send out the PINGREG */
+            client_ptr -> nxd_mqtt_ping_sent_time = tx_time_get();
+            client_ptr -> nxd_mqtt_ping_not_responded = 1;
+        }
     }
 
+    /* Update the timeout value. */
+    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
+
     return(status);
 }
 
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_connect_packet_send                PORTABLE C      */
+/*    _nxd_mqtt_client_disconnect                         PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -4021,16 +6151,12 @@ UINT                 old_priority;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function sends CONNECT packet to MQTT server.                  */
+/*    This function disconnects the MQTT client from a server.            */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    keepalive                             Keepalive flag                */
-/*    clean_session                         Clean session flag            */
-/*    wait_option                           Timeout value                 */
-/*                                                                        */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -4038,20 +6164,12 @@ UINT                 old_priority;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    nx_packet_release                                                   */
-/*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
-/*    _nxd_mqtt_packet_allocate                                           */
-/*    _nxd_mqtt_release_transmit_packet                                   */
-/*    _nxd_mqtt_client_connection_end                                     */
-/*    _nxd_mqtt_client_set_fixed_header                                   */
-/*    _nxd_mqtt_client_append_message                                     */
+/*    _nxd_mqtt_send_simple_message                                       */
+/*    _nxd_mqtt_process_disconnect                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nxd_mqtt_client_connect                                            */
-/*    _nxd_mqtt_tcp_establish_process                                     */
-/*    _nxd_mqtt_tls_establish_process                                     */
+/*    Application Code                                                    */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -4062,200 +6180,33 @@ UINT                 old_priority;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_connect_packet_send(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option)
+UINT _nxd_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr)
 {
-NX_PACKET           *packet_ptr;
-UINT                 status;
-UINT                 length = 0;
-UCHAR                connection_flags = 0;
-UINT                 ret = NXD_MQTT_SUCCESS;
-UCHAR                temp_data[4];
-UINT                 keepalive = (client_ptr -> nxd_mqtt_keepalive/NX_IP_PERIODIC_RATE);
-
-
-    /* Construct connect flags by taking the connect flag user supplies, or'ing the username and
-       password bits, if they are supplied. */
-    if (client_ptr -> nxd_mqtt_client_username)
-    {
-        connection_flags |= MQTT_CONNECT_FLAGS_USERNAME;
-
-        /* Add the password flag only if username is supplied. */
-        if (client_ptr -> nxd_mqtt_client_password)
-        {
-            connection_flags |= MQTT_CONNECT_FLAGS_PASSWORD;
-        }
-    }
-
-    if (client_ptr -> nxd_mqtt_client_will_topic)
-    {
-        connection_flags = connection_flags | MQTT_CONNECT_FLAGS_WILL_FLAG;
-
-
-        if (client_ptr -> nxd_mqtt_client_will_qos_retain & 0x80)
-        {
-            connection_flags = connection_flags | MQTT_CONNECT_FLAGS_WILL_RETAIN;
-        }
-
-        connection_flags = (UCHAR)(connection_flags | ((client_ptr -> nxd_mqtt_client_will_qos_retain & 0x3) << 3));
-    }
-
-    if (client_ptr -> nxd_mqtt_clean_session == NX_TRUE)
-    {
-        connection_flags = connection_flags | MQTT_CONNECT_FLAGS_CLEAN_SESSION;
-
-        /* Clear any transmit blocks from the previous session. */
-        while (client_ptr -> message_transmit_queue_head)
-        {
-            _nxd_mqtt_release_transmit_packet(client_ptr, client_ptr -> message_transmit_queue_head, NX_NULL);
-        }
-    }
-
-    /* Set the length of the packet. */
-    length = 10;
-
-    /* Add the size of the client Identifier. */
-    length += (client_ptr -> nxd_mqtt_client_id_length + 2);
-
-    /* Add the will topic, if present. */
-    if (connection_flags & MQTT_CONNECT_FLAGS_WILL_FLAG)
-    {
-        length += (client_ptr -> nxd_mqtt_client_will_topic_length + 2);
-        length += (client_ptr -> nxd_mqtt_client_will_message_length + 2);
-    }
-    if (connection_flags & MQTT_CONNECT_FLAGS_USERNAME)
-    {
-        length += (UINT)(client_ptr -> nxd_mqtt_client_username_length + 2);
-    }
-    if (connection_flags & MQTT_CONNECT_FLAGS_PASSWORD)
-    {
-        length += (UINT)(client_ptr -> nxd_mqtt_client_password_length + 2);
-    }
-
-    /* Check for invalid length. */
-    if (length > (127 * 127 * 127 * 127))
-    {
-        return(NXD_MQTT_INTERNAL_ERROR);
-    }
-
-    status = _nxd_mqtt_packet_allocate(client_ptr, &packet_ptr);
-    if (status)
-    {
-
-        return(status);
-    }
-
-    /* Construct MQTT CONNECT message. */
-    temp_data[0] = ((MQTT_CONTROL_PACKET_TYPE_CONNECT << 4) & 0xF0);
-
-    /* Fill in fixed header. */
-    ret = _nxd_mqtt_client_set_fixed_header(client_ptr, packet_ptr, temp_data[0], length, wait_option);
-
-    if (ret)
-    {
-
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-
-        return(NXD_MQTT_PACKET_POOL_FAILURE);
-    }
-
-    ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, "MQTT", 4, wait_option);
-
-    if (ret)
-    {
-
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-
-        return(NXD_MQTT_PACKET_POOL_FAILURE);
-    }
-
-    /* Fill in protocol level, */
-    temp_data[0] = MQTT_PROTOCOL_LEVEL;
-
-    /* Fill in byte 8: connect flags */
-    temp_data[1] = connection_flags;
-
-    /* Fill in byte 9 and 10: keep alive */
-    temp_data[2] = (keepalive >> 8) & 0xFF;
-    temp_data[3] = (keepalive & 0xFF);
-
-    ret = nx_packet_data_append(packet_ptr, temp_data, 4, client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
-
-    if (ret)
-    {
-
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-
-        return(NXD_MQTT_PACKET_POOL_FAILURE);
-    }
-
-    /* Fill in payload area, in the order of: client identifier, will topic, will message,
-       user name, and password. */
-    ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, client_ptr -> nxd_mqtt_client_id, 
-                                          client_ptr -> nxd_mqtt_client_id_length, wait_option);
+UINT status;
 
-    /* Next fill will topic and will message if the will flag is set. */
-    if (!ret && (connection_flags & MQTT_CONNECT_FLAGS_WILL_FLAG))
+    /* Obtain the mutex. */
+    status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
+    if (status != TX_SUCCESS)
     {
-        ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, (CHAR *)client_ptr -> nxd_mqtt_client_will_topic,
-                                              client_ptr -> nxd_mqtt_client_will_topic_length, wait_option);
-
-        if (!ret)
+        /* Disable timer if timer has been started. */
+        if (client_ptr -> nxd_mqtt_keepalive)
         {
-            ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, (CHAR *)client_ptr -> nxd_mqtt_client_will_message,
-                                                  client_ptr -> nxd_mqtt_client_will_message_length, wait_option);
+            tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
         }
-    }
-
-    /* Fill username if username flag is set */
-    if (!ret && (connection_flags & MQTT_CONNECT_FLAGS_USERNAME))
-    {
-        ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, client_ptr -> nxd_mqtt_client_username, 
-                                              client_ptr -> nxd_mqtt_client_username_length, wait_option);
-    }
-
-    /* Fill password if password flag is set */
-    if (!ret && (connection_flags & MQTT_CONNECT_FLAGS_PASSWORD))
-    {
-        ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, client_ptr -> nxd_mqtt_client_password, 
-                                              client_ptr -> nxd_mqtt_client_password_length, wait_option);
-    }
-
-    if (ret)
-    {
-
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-
-        return(NXD_MQTT_PACKET_POOL_FAILURE);
-    }
 
-    /* Ready to send the connect message to the server. */
-#ifdef NX_SECURE_ENABLE
-    if (client_ptr -> nxd_mqtt_client_use_tls)
-    {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, wait_option);
-    }
-    else
-    {
-        status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
+        return(NXD_MQTT_MUTEX_FAILURE);
     }
-#else
-    status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
 
-#endif /* NX_SECURE_ENABLE */
-
-    if (status)
-    {
+    /* Let the server know we are ending the MQTT session. */
+    _nxd_mqtt_send_simple_message(client_ptr, MQTT_CONTROL_PACKET_TYPE_DISCONNECT);
 
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-    }
+    /* Call the disconnect routine to disconnect the socket,
+       release transmit packets, release received packets,
+       and delete the client timer. */
+    _nxd_mqtt_process_disconnect(client_ptr);
 
-    /* Update the timeout value. */
-    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
+    /* Release the mutex. */
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
 
     return(status);
 }
@@ -4264,7 +6215,7 @@ UINT                 keepalive = (client_ptr -> nxd_mqtt_keepalive/NX_IP_PERIODI
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_secure_connect                     PORTABLE C      */
+/*    _nxd_mqtt_client_receive_notify_set                 PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -4272,30 +6223,17 @@ UINT                 keepalive = (client_ptr -> nxd_mqtt_keepalive/NX_IP_PERIODI
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function makes an initial secure (TLS) connection to           */
-/*    the MQTT server.                                                    */
+/*    This function installs the MQTT client publish notify callback      */
+/*    function.                                                           */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    server_ip                             Server IP address structure   */
-/*    server_port                           Server port number, in host   */
-/*                                            byte order                  */
-/*    tls_setup                             User-supplied callback        */
-/*                                            function to set up TLS      */
-/*                                            parameters.                 */
-/*    username                              User name, or NULL if user    */
-/*                                            name is not required        */
-/*    username_length                       Length of the user name, or   */
-/*                                            0 if user name is NULL      */
-/*    password                              Password string, or NULL if   */
-/*                                            password is not required    */
-/*    password_length                       Length of the password, or    */
-/*                                            0 if password is NULL       */
-/*    connection_flag                       Flag passed to the server     */
-/*    timeout                               Timeout value                 */
-/*                                                                        */
+/*    mqtt_client_receive_notify            User-supplied callback        */
+/*                                            function, which is invoked  */
+/*                                            upon receiving a publish    */
+/*                                            message.                    */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -4303,8 +6241,8 @@ UINT                 keepalive = (client_ptr -> nxd_mqtt_keepalive/NX_IP_PERIODI
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_connect              Actual MQTT Client connect    */
-/*                                            call                        */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -4319,40 +6257,24 @@ UINT                 keepalive = (client_ptr -> nxd_mqtt_keepalive/NX_IP_PERIODI
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-#ifdef NX_SECURE_ENABLE
-UINT _nxd_mqtt_client_secure_connect(NXD_MQTT_CLIENT *client_ptr, NXD_ADDRESS *server_ip, UINT server_port,
-                                     UINT (*tls_setup)(NXD_MQTT_CLIENT *client_ptr, NX_SECURE_TLS_SESSION *,
-                                                       NX_SECURE_X509_CERT *, NX_SECURE_X509_CERT *),
-                                     UINT keepalive, UINT clean_session, ULONG wait_option)
+UINT _nxd_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
+                                         VOID (*receive_notify)(NXD_MQTT_CLIENT *client_ptr, UINT message_count))
 {
-UINT ret;
 
-    /* Set up TLS session information. */
-    ret = (*tls_setup)(client_ptr, &client_ptr -> nxd_mqtt_tls_session,
-                       &client_ptr -> nxd_mqtt_tls_certificate,
-                       &client_ptr -> nxd_mqtt_tls_trusted_certificate);
-
-    if (ret)
-    {
-        return(ret);
-    }
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
 
-    /* Mark the connection as secure. */
-    client_ptr -> nxd_mqtt_client_use_tls = 1;
+    client_ptr -> nxd_mqtt_client_receive_notify = receive_notify;
 
-    ret = _nxd_mqtt_client_connect(client_ptr, server_ip, server_port, keepalive, clean_session, wait_option);
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
 
-    return(ret);
+    return(NXD_MQTT_SUCCESS);
 }
 
-#endif /* NX_SECURE_ENABLE */
-
-
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_delete                             PORTABLE C      */
+/*    _nxd_mqtt_client_message_get                        PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -4360,16 +6282,22 @@ UINT ret;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function deletes a previously created MQTT client instance.    */
-/*    If the NXD_MQTT_SOCKET_TIMEOUT is set to NX_WAIT_FOREVER, this may  */
-/*    suspend infinitely. This is because the MQTT Client must            */
-/*    disconnect with the server, and if the network link is disabled or  */
-/*    the server is not responding, this will blocks this function from   */
-/*    completing.                                                         */ 
+/*    This function retrieves a published MQTT message.                   */
+/*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
+/*    topic_buffer                          Pointer to the topic buffer   */
+/*                                            where topic is copied to    */
+/*    topic_buffer_size                     Size of the topic buffer.     */
+/*    actual_topic_length                   Number of bytes copied into   */
+/*                                            topic_buffer                */
+/*    message_buffer                        Pointer to the buffer where   */
+/*                                            message is copied to        */
+/*    message_buffer_size                   Size of the message_buffer    */
+/*    actual_message_length                 Number of bytes copied into   */
+/*                                            the message buffer.         */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -4377,7 +6305,12 @@ UINT ret;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    tx_event_flags_set                                                  */
+/*    _nxd_mqtt_client_disconnect           Actual MQTT Client disconnect */
+/*                                            call                        */
+/*    _nxd_mqtt_read_remaining_length       Skip the remaining length     */
+/*                                            field                       */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -4388,48 +6321,70 @@ UINT ret;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            fixed uninitialized value,  */
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr)
+UINT _nxd_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buffer, UINT topic_buffer_size, UINT *actual_topic_length,
+                                  UCHAR *message_buffer, UINT message_buffer_size, UINT *actual_message_length)
 {
 
+UINT                status;
+NX_PACKET          *packet_ptr;
+ULONG               topic_offset;
+USHORT              topic_length;
+ULONG               message_offset;
+ULONG               message_length;
 
-    /* Set the event flag for DELETE. Next time when the MQTT client thread
-       wakes up, it will perform the deletion process. */
-#ifndef NXD_MQTT_CLOUD_ENABLE
-    tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_DELETE_EVENT, TX_OR);
-#else
-    nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_DELETE_EVENT);
-#endif /* NXD_MQTT_CLOUD_ENABLE */
-
-    /* Check if the MQTT client thread has completed. */
-    while((client_ptr -> nxd_mqtt_client_socket).nx_tcp_socket_id != 0) 
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+    while (client_ptr -> message_receive_queue_depth)
     {
-        tx_thread_sleep(NX_IP_PERIODIC_RATE);
-    }
+        packet_ptr = client_ptr -> message_receive_queue_head;
+        status = _nxd_mqtt_process_publish_packet(packet_ptr, &topic_offset, &topic_length, &message_offset, &message_length);
+        if (status == NXD_MQTT_SUCCESS)
+        {
+            if ((topic_buffer_size < topic_length) ||
+                (message_buffer_size < message_length))
+            {
+                tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+                return(NXD_MQTT_INSUFFICIENT_BUFFER_SPACE);
+            }
+        }
 
-#ifndef NXD_MQTT_CLOUD_ENABLE
-    /* Now we can delete the Client instance. */
-    tx_thread_delete(&(client_ptr -> nxd_mqtt_thread));
-#else
-    /* Deregister mqtt module from cloud helper.  */
-    nx_cloud_module_deregister(client_ptr -> nxd_mqtt_client_cloud_ptr, &(client_ptr -> nxd_mqtt_client_cloud_module));
+        client_ptr -> message_receive_queue_head = packet_ptr -> nx_packet_queue_next;
+        if (client_ptr -> message_receive_queue_tail == packet_ptr)
+        {
+            client_ptr -> message_receive_queue_tail = NX_NULL;
+        }
+        client_ptr -> message_receive_queue_depth--;
 
-    /* Delete own created cloud.  */
-    if (client_ptr -> nxd_mqtt_client_cloud.nx_cloud_id == NX_CLOUD_ID)
-        nx_cloud_delete(&(client_ptr -> nxd_mqtt_client_cloud));
-#endif /* NXD_MQTT_CLOUD_ENABLE */
+        if (status == NXD_MQTT_SUCCESS)
+        {
 
-    return(NXD_MQTT_SUCCESS);
+            /* Set topic and message lengths to avoid uninitialized value. */
+            *actual_topic_length = 0;
+            *actual_message_length = 0;
+            nx_packet_data_extract_offset(packet_ptr, topic_offset, topic_buffer,
+                                          topic_length, (ULONG *)actual_topic_length);
+            nx_packet_data_extract_offset(packet_ptr, message_offset, message_buffer,
+                                          message_length, (ULONG *)actual_message_length);
+            nx_packet_release(packet_ptr);
+
+            tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+            return(NXD_MQTT_SUCCESS);
+        }
+        nx_packet_release(packet_ptr);
+    }
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+    return(NXD_MQTT_NO_MESSAGE);
 }
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_publish_packet_send                PORTABLE C      */
+/*    _nxde_mqtt_client_create                            PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -4437,16 +6392,23 @@ UINT _nxd_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr)
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function sends a publish packet to the connected broker.       */
+/*    This function checks for errors in nxd_mqt_client_create call.      */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    packet_ptr                            Pointer to publish packet     */
-/*    packet_id                             Current packet ID             */
-/*    QoS                                   Quality of service            */
-/*    wait_option                           Suspension option             */
+/*    client_name                           Name string used in by the    */
+/*                                            client                      */
+/*    client_id                             Client ID used by the client  */
+/*    client_id_length                      Length of Client ID, in bytes */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    stack_ptr                             Client thread's stack pointer */
+/*    stack_size                            Client thread's stack size    */
+/*    mqtt_thread_priority                  Priority for MQTT thread      */
+/*    memory_ptr                            Deprecated and not used       */
+/*    memory_size                           Deprecated and not used       */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -4454,16 +6416,11 @@ UINT _nxd_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr)
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    tx_mutex_get                                                        */
-/*    tx_mutex_put                                                        */
-/*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
-/*    nx_packet_release                                                   */
-/*    _nxd_mqtt_copy_transmit_packet                                      */
+/*    _nxd_mqtt_client_create               Actual client create call     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nxd_mqtt_client_publish                                            */
+/*    Application Code                                                    */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -4474,91 +6431,31 @@ UINT _nxd_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr)
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_publish_packet_send(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr,
-                                          USHORT packet_id, UINT QoS, ULONG wait_option)
+UINT _nxde_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name, CHAR *client_id, UINT client_id_length,
+                              NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr,
+                              VOID *stack_ptr, ULONG stack_size, UINT mqtt_thread_priority,
+                              VOID *memory_ptr, ULONG memory_size)
 {
 
-UINT       status;
-UINT       ret = NXD_MQTT_SUCCESS;
-
-    if (QoS != 0)
-    {
-    /* This packet needs to be stored locally for possible retransmission. */
-    NX_PACKET *transmit_packet_ptr;
-
-        /* Copy packet for retransmission. */
-        if (_nxd_mqtt_copy_transmit_packet(client_ptr, packet_ptr, &transmit_packet_ptr,
-                                           packet_id, NX_TRUE, wait_option))
-        {
-            return(NXD_MQTT_PACKET_POOL_FAILURE);
-        }
-
-        /* Obtain the mutex. */
-        status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
-
-        if (status != TX_SUCCESS)
-        {
-            nx_packet_release(transmit_packet_ptr);
-            return(NXD_MQTT_MUTEX_FAILURE);
-        }
-
-        if (client_ptr -> message_transmit_queue_head == NX_NULL)
-        {
-            client_ptr -> message_transmit_queue_head = transmit_packet_ptr;
-        }
-        else
-        {
-            client_ptr -> message_transmit_queue_tail -> nx_packet_queue_next = transmit_packet_ptr;
-        }
-        client_ptr -> message_transmit_queue_tail = transmit_packet_ptr;
-    }
-    else
-    {
-
-        /* Obtain the mutex. */
-        status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
-
-        if (status != TX_SUCCESS)
-        {
-            return(NXD_MQTT_MUTEX_FAILURE);
-        }
-    }
-
-    /* Update the timeout value. */
-    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
-
-
-    /* Release the mutex. */
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-
-    /* Ready to send the connect message to the server. */
-#ifdef NX_SECURE_ENABLE
-    if (client_ptr -> nxd_mqtt_client_use_tls)
-    {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, wait_option);
-    }
-    else
-    {
-        status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
-    }
-#else
-    status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, wait_option);
-
-#endif /* NX_SECURE_ENABLE */
 
-    if (status)
+    /* Check for invalid input pointers.  */
+    if ((client_ptr == NX_NULL) || (ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID) ||
+        (stack_ptr == NX_NULL) || (stack_size == 0) || (pool_ptr == NX_NULL))
     {
-        ret = NXD_MQTT_COMMUNICATION_FAILURE;
+        return(NX_PTR_ERROR);
     }
-
-    return(ret);
+    
+    return(_nxd_mqtt_client_create(client_ptr, client_name, client_id, client_id_length, ip_ptr,
+                                   pool_ptr, stack_ptr, stack_size, mqtt_thread_priority,
+                                   memory_ptr, memory_size));
 }
 
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_publish                            PORTABLE C      */
+/*    _nxde_mqtt_client_connect                           PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -4566,36 +6463,28 @@ UINT       ret = NXD_MQTT_SUCCESS;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function publishes a message to the connected broker.          */
+/*    This function checks for errors in MQTT client stop call.           */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    client_ptr                            Pointer to MQTT Client        */
-/*    topic_name                            Name of the topic             */
-/*    topic_name_length                     Length of the topic name      */
-/*    message                               Message string                */
-/*    message_length                        Length of the message,        */
-/*                                            in bytes                    */
-/*    retain                                The retain flag, whether      */
-/*                                            or not the broker should    */
-/*                                            store this message          */
-/*    QoS                                   Expected QoS level            */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    server_ip                             Server IP address structure   */
+/*    server_port                           Server port number, in host   */
+/*                                            byte order                  */
+/*    keepalive                             The MQTT keepalive timer      */
+/*    clean_session                         Clean session flag            */
 /*    wait_option                           Suspension option             */
 /*                                                                        */
+/*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
 /*    status                                Completion status             */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    tx_mutex_get                                                        */
-/*    _nxd_mqtt_packet_allocate                                           */
-/*    _nxd_mqtt_client_set_fixed_header                                   */
-/*    _nxd_mqtt_client_append_message                                     */
-/*    tx_mutex_put                                                        */
-/*    nx_packet_release                                                   */
-/*    _nxd_mqtt_client_publish_packet_send                                */
+/*    _nxd_mqtt_client_connect              Actual MQTT Client connect    */
+/*                                            call                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -4606,186 +6495,70 @@ UINT       ret = NXD_MQTT_SUCCESS;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            corrected mqtt client state,*/
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
-                              CHAR *message, UINT message_length, UINT retain, UINT QoS, ULONG wait_option)
+UINT _nxde_mqtt_client_connect(NXD_MQTT_CLIENT *client_ptr, NXD_ADDRESS *server_ip, UINT server_port,
+                               UINT keepalive, UINT clean_session, ULONG wait_option)
 {
 
-NX_PACKET *packet_ptr;
-UINT       status;
-UINT       length = 0;
-UCHAR      flags;
-USHORT     packet_id = 0;
-UINT       ret = NXD_MQTT_SUCCESS;
-
-    if (QoS == 2)
-    {
-        return(NXD_MQTT_QOS2_NOT_SUPPORTED);
-    }
-
-
-    /* Do nothing if the client is already connected. */
-    if (client_ptr -> nxd_mqtt_client_state != NXD_MQTT_CLIENT_STATE_CONNECTED)
-    {
-        return(NXD_MQTT_NOT_CONNECTED);
-    }
-
-    status = _nxd_mqtt_packet_allocate(client_ptr, &packet_ptr);
-
-    if (status != NXD_MQTT_SUCCESS)
-    {
-        return(NXD_MQTT_PACKET_POOL_FAILURE);
-    }
-
-    flags = (UCHAR)((MQTT_CONTROL_PACKET_TYPE_PUBLISH << 4) | (QoS << 1));
-
-    if (retain)
-    {
-        flags = flags | MQTT_PUBLISH_RETAIN;
-    }
-
-
-    /* Compute the remaining length. */
-
-    /* Topic Name. */
-    /* Compute Topic Name length. */
-    length = topic_name_length + 2;
-
-    /* Count packet ID for QoS 1 or QoS 2 message. */
-    if ((QoS == 1) || (QoS == 2))
-    {
-        length += 2;
-    }
-
-    /* Count message. */
-    if ((message != NX_NULL) && (message_length != 0))
-    {
-        length += message_length;
-    }
-
-    /* Write out the control header and remaining length field. */
-    ret = _nxd_mqtt_client_set_fixed_header(client_ptr, packet_ptr, flags, length, wait_option);
+UINT status;
 
-    if (ret)
+    if (client_ptr == NX_NULL)
     {
-
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-
-        return(NXD_MQTT_INTERNAL_ERROR);
+        return(NX_PTR_ERROR);
     }
 
-
-    /* Write out topic */
-    ret = _nxd_mqtt_client_append_message(client_ptr, packet_ptr, topic_name, topic_name_length, wait_option);
-
-    if (ret)
+    if (server_ip == NX_NULL)
     {
-
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-
-        return(NXD_MQTT_INTERNAL_ERROR);
+        return(NX_PTR_ERROR);
     }
 
-    /* Append Packet Identifier for QoS level 1 or 2  MQTT 3.3.2.2 */
-    if ((QoS == 1) || (QoS == 2))
+    /* Test for IP version flag. */
+    if ((server_ip -> nxd_ip_version != 4) && (server_ip -> nxd_ip_version != 6))
     {
-    UCHAR identifier[2];
-
-        /* Obtain the mutex. */
-        status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
-
-        if (status != TX_SUCCESS)
-        {
-            return(NXD_MQTT_MUTEX_FAILURE);
-        }
-
-        packet_id = (USHORT)client_ptr -> nxd_mqtt_client_packet_identifier;
-        identifier[0] = (UCHAR)(client_ptr -> nxd_mqtt_client_packet_identifier >> 8);
-        identifier[1] = (client_ptr -> nxd_mqtt_client_packet_identifier & 0xFF);
-
-        /* Update packet id. */
-        client_ptr -> nxd_mqtt_client_packet_identifier = (client_ptr -> nxd_mqtt_client_packet_identifier + 1) & 0xFFFF;
-
-        /* Prevent packet identifier from being zero. MQTT-2.3.1-1 */
-        if(client_ptr -> nxd_mqtt_client_packet_identifier == 0)
-            client_ptr -> nxd_mqtt_client_packet_identifier = 1;
-
-        /* Release the mutex. */
-        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-
-        ret = nx_packet_data_append(packet_ptr, identifier, 2, 
-                                    client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
-
-        if (ret)
-        {
-
-            /* Release the packet. */
-            nx_packet_release(packet_ptr);
-
-            return(NXD_MQTT_INTERNAL_ERROR);
-        }
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-    /* Append message. */
-    if ((message != NX_NULL) && (message_length) != 0)
+    if (server_port == 0)
     {
-        
-        /* Use nx_packet_data_append to move user-supplied message data into the packet.
-           nx_packet_data_append uses chained packet if the additional storage space is 
-           needed. */
-        ret = nx_packet_data_append(packet_ptr, message, message_length, 
-                                       client_ptr -> nxd_mqtt_client_packet_pool_ptr, wait_option);
-        if(ret)
-        {
-            /* Unable to obtain a new packet to store the message. */
-
-            /* Release the packet. */
-            nx_packet_release(packet_ptr);
-
-            return(NXD_MQTT_INTERNAL_ERROR);
-        }
+        return(NX_INVALID_PORT);
     }
 
-    /* Send publish packet. */
-    ret = _nxd_mqtt_client_publish_packet_send(client_ptr, packet_ptr, packet_id, QoS, wait_option);
-
-    if (ret)
-    {
+    status = _nxd_mqtt_client_connect(client_ptr, server_ip, server_port, keepalive, clean_session, wait_option);
 
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-    }
-    return(ret);
+    return(status);
 }
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_subscribe                          PORTABLE C      */
-/*                                                           6.1.2        */
+/*    _nxde_mqtt_client_secure_connect                    PORTABLE C      */
+/*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function sends a subscribe message to the broker.              */
+/*    This function checks for errors in MQTT client TLS secure connect.  */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    topic_name                            Pointer to the topic string   */
-/*                                            to subscribe to             */
-/*    topic_name_length                     Length of the topic string    */
-/*                                            in bytes                    */
-/*    QoS                                   Expected QoS level            */
+/*    server_ip                             Server IP address structure   */
+/*    server_port                           Server port number, in host   */
+/*                                            byte order                  */
+/*    tls_setup                             User-supplied callback        */
+/*                                            function to set up TLS      */
+/*                                            parameters.                 */
+/*    keepalive                             The MQTT keepalive timer      */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -4793,9 +6566,8 @@ UINT       ret = NXD_MQTT_SUCCESS;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_sub_unsub            The actual routine that       */
-/*                                            performs the sub/unsub      */
-/*                                            action.                     */
+/*    _nxd_mqtt_client_connect              Actual MQTT Client connect    */
+/*                                            call                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -4806,50 +6578,62 @@ UINT       ret = NXD_MQTT_SUCCESS;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
+/*                                            corrected mqtt client state,*/
 /*                                            resulting in version 6.1    */
-/*  11-09-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            added packet id parameter,  */
-/*                                            resulting in version 6.1.2  */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_subscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length, UINT QoS)
+#ifdef NX_SECURE_ENABLE
+
+UINT _nxde_mqtt_client_secure_connect(NXD_MQTT_CLIENT *client_ptr, NXD_ADDRESS *server_ip, UINT server_port,
+                                      UINT (*tls_setup)(NXD_MQTT_CLIENT *client_ptr, NX_SECURE_TLS_SESSION *,
+                                                        NX_SECURE_X509_CERT *, NX_SECURE_X509_CERT *),
+                                      UINT keepalive, UINT clean_session, ULONG wait_option)
 {
 
-    if (QoS == 2)
+UINT status;
+
+    if (client_ptr == NX_NULL)
     {
-        return(NXD_MQTT_QOS2_NOT_SUPPORTED);
+        return(NX_PTR_ERROR);
     }
 
-    return(_nxd_mqtt_client_sub_unsub(client_ptr, (MQTT_CONTROL_PACKET_TYPE_SUBSCRIBE << 4) | 0x02,
-                                      topic_name, topic_name_length, NX_NULL, QoS));
-}
+    if (server_ip == NX_NULL)
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    if (server_port == 0)
+    {
+        return(NX_INVALID_PORT);
+    }
 
+    status = _nxd_mqtt_client_secure_connect(client_ptr, server_ip, server_port, tls_setup,
+                                             keepalive, clean_session, wait_option);
 
+    return(status);
+}
+#endif /* NX_SECURE_ENABLE */
 
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_unsubscribe                        PORTABLE C      */
-/*                                                           6.1.2        */
+/*    _nxde_mqtt_client_delete                            PORTABLE C      */
+/*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function unsubscribes a topic from the broker.                 */
+/*    This function checks for errors in MQTT client delete call.         */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    topic_name                            Pointer to the topic string   */
-/*                                            to subscribe to             */
-/*    topic_name_length                     Length of the topic string    */
-/*                                            in bytes                    */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -4857,7 +6641,8 @@ UINT _nxd_mqtt_client_subscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, U
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_sub_unsub                                          */
+/*    _nxd_mqtt_client_delete               Actual MQTT Client delete     */
+/*                                            call.                       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -4870,22 +6655,30 @@ UINT _nxd_mqtt_client_subscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, U
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
-/*  11-09-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            added packet id parameter,  */
-/*                                            resulting in version 6.1.2  */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length)
+UINT _nxde_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr)
 {
-    return(_nxd_mqtt_client_sub_unsub(client_ptr, (MQTT_CONTROL_PACKET_TYPE_UNSUBSCRIBE << 4) | 0x02,
-                                      topic_name, topic_name_length, NX_NULL, 0));
+
+UINT status;
+
+    if (client_ptr == NX_NULL)
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    status = _nxd_mqtt_client_delete(client_ptr);
+
+    return(status);
 }
 
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_send_simple_message                       PORTABLE C      */
+/*    _nxde_mqtt_client_publish                           PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -4893,15 +6686,22 @@ UINT _nxd_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name,
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This internal function handles the transmission of PINGREQ or       */
-/*    DISCONNECT message.                                                 */
+/*    This function performs error checking to the publish service.       */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    header_value                          Value to be programmed into   */
-/*                                            MQTT header.                */
+/*    topic_name                            Name of the topic             */
+/*    topic_name_length                     Length of the topic name      */
+/*    message                               Message string                */
+/*    message_length                        Length of the message,        */
+/*                                            in bytes                    */
+/*    retain                                The retain flag, whether      */
+/*                                            or not the broker should    */
+/*                                            store this message          */
+/*    QoS                                   Expected QoS level            */
+/*    wait_option                           Suspension option             */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -4909,17 +6709,10 @@ UINT _nxd_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name,
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    tx_mutex_get                                                        */
-/*    _nxd_mqtt_packet_allocate                                           */
-/*    tx_mutex_put                                                        */
-/*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
-/*    nx_packet_release                                                   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nxd_mqtt_client_ping                                               */
-/*    _nxd_mqtt_client_disconnect                                         */
+/*    Application Code                                                    */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -4930,83 +6723,34 @@ UINT _nxd_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name,
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-static UINT _nxd_mqtt_send_simple_message(NXD_MQTT_CLIENT *client_ptr, UCHAR header_value)
+UINT _nxde_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
+                               CHAR *message, UINT message_length, UINT retain, UINT QoS, ULONG wait_option)
 {
-
-NX_PACKET *packet_ptr;
-UINT       status;
-UINT       status_mutex;
-UCHAR     *byte;
-
-    status = _nxd_mqtt_packet_allocate(client_ptr, &packet_ptr);
-    if (status)
-    {
-        return(NXD_MQTT_INTERNAL_ERROR);
-    }
-
-    if (2u > ((ULONG)(packet_ptr -> nx_packet_data_end) - (ULONG)(packet_ptr -> nx_packet_append_ptr)))
+    /* Validate client_ptr */
+    if (client_ptr == NX_NULL)
     {
-        nx_packet_release(packet_ptr);
-
-        /* Packet buffer is too small to hold the message. */
-        return(NX_SIZE_ERROR);
+        return(NX_PTR_ERROR);
     }
 
-    byte = packet_ptr -> nx_packet_prepend_ptr;
-
-    *byte = (UCHAR)(header_value << 4);
-    *(byte + 1) = 0;
-
-    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + 2;
-    packet_ptr -> nx_packet_length = 2;
-
-
-    /* Release MQTT protection before making NetX/TLS calls. */
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-#ifdef NX_SECURE_ENABLE
-    if (client_ptr -> nxd_mqtt_client_use_tls)
-    {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, NX_WAIT_FOREVER);
-    }
-    else
+    /* Validate topic_name */
+    if ((topic_name == NX_NULL) || (topic_name_length == 0))
     {
-        status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, NX_WAIT_FOREVER);
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
-#else
-
-    status = nx_tcp_socket_send(&client_ptr -> nxd_mqtt_client_socket, packet_ptr, NX_WAIT_FOREVER);
-
-#endif /* NX_SECURE_ENABLE */
 
-    status_mutex = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
-    if (status)
-    {
-
-        /* Release the packet. */
-        nx_packet_release(packet_ptr);
-
-        status = NXD_MQTT_COMMUNICATION_FAILURE;
-    }
-    if (status_mutex)
+    /* Validate message length. */
+    if (message && (message_length == 0))
     {
-        return(NXD_MQTT_MUTEX_FAILURE);
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-    if (header_value == MQTT_CONTROL_PACKET_TYPE_PINGREQ)
+    /* Validate QoS value. */
+    if (QoS > 3)
     {
-        /* Do not update the ping sent time if the outstanding ping has not been responded yet */
-        if (client_ptr -> nxd_mqtt_ping_not_responded != 1)
-        {
-            /* Record the time we send out the PINGREG */
-            client_ptr -> nxd_mqtt_ping_sent_time = tx_time_get();
-            client_ptr -> nxd_mqtt_ping_not_responded = 1;
-        }
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-    /* Update the timeout value. */
-    client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
-
-    return(status);
+    return(_nxd_mqtt_client_publish(client_ptr, topic_name, topic_name_length, message, message_length, retain, QoS, wait_option));
 }
 
 
@@ -5014,20 +6758,24 @@ UCHAR     *byte;
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_disconnect                         PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxde_mqtt_client_publish_packet_allocate           PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function disconnects the MQTT client from a server.            */
+/*    This function performs error checking to the publish packet         */
+/*    allocate service.                                                   */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
+/*    packet_ptr                            Allocated packet to be        */
+/*                                            returned to the caller      */
+/*    topic_name_length                     Length of the topic name      */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5035,8 +6783,7 @@ UCHAR     *byte;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_send_simple_message                                       */
-/*    _nxd_mqtt_process_disconnect                                        */
+/*    _nxd_mqtt_client_publish_packet_allocate                            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5046,65 +6793,54 @@ UCHAR     *byte;
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr)
+UINT _nxde_mqtt_client_publish_packet_allocate(NXD_MQTT_CLIENT *client_ptr, NX_PACKET **packet_ptr, UINT topic_name_length)
 {
-UINT status;
-
-    /* Obtain the mutex. */
-    status = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
-    if (status != TX_SUCCESS)
+    /* Validate client_ptr and packet_ptr. */
+    if ((client_ptr == NX_NULL) || (packet_ptr == NX_NULL))
     {
-        /* Disable timer if timer has been started. */
-        if (client_ptr -> nxd_mqtt_keepalive)
-        {
-            tx_timer_delete(&(client_ptr -> nxd_mqtt_timer));
-        }
-
-        return(NXD_MQTT_MUTEX_FAILURE);
+        return(NX_PTR_ERROR);
     }
 
-    /* Let the server know we are ending the MQTT session. */
-    _nxd_mqtt_send_simple_message(client_ptr, MQTT_CONTROL_PACKET_TYPE_DISCONNECT);
-
-    /* Call the disconnect routine to disconnect the socket,
-       release transmit packets, release received packets,
-       and delete the client timer. */
-    _nxd_mqtt_process_disconnect(client_ptr);
-
-    /* Release the mutex. */
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+    /* Validate topic name length. */
+    if ((topic_name_length == 0) || (topic_name_length > 0xFFFF))
+    {
+        return(NXD_MQTT_INVALID_PARAMETER);
+    }
 
-    return(status);
+    return(_nxd_mqtt_client_publish_packet_allocate(client_ptr, packet_ptr, topic_name_length));
 }
 
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_receive_notify_set                 PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxde_mqtt_client_publish_packet                    PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function installs the MQTT client publish notify callback      */
-/*    function.                                                           */
+/*    This function performs error checking to the publish packet         */
+/*    service.                                                            */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    mqtt_client_receive_notify            User-supplied callback        */
-/*                                            function, which is invoked  */
-/*                                            upon receiving a publish    */
-/*                                            message.                    */
+/*    topic_name                            Name of the topic             */
+/*    topic_name_length                     Length of the topic name      */
+/*    packet_ptr                            Packet holding the message    */
+/*    retain                                The retain flag, whether      */
+/*                                            or not the broker should    */
+/*                                            store this message          */
+/*    QoS                                   Expected QoS level            */
+/*    wait_option                           Suspension option             */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5112,8 +6848,7 @@ UINT status;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    tx_mutex_get                                                        */
-/*    tx_mutex_put                                                        */
+/*    _nxd_mqtt_client_publish_packet                                     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5123,29 +6858,39 @@ UINT status;
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
-                                         VOID (*receive_notify)(NXD_MQTT_CLIENT *client_ptr, UINT message_count))
+UINT _nxde_mqtt_client_publish_packet(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
+                                      NX_PACKET *packet_ptr, UINT retain, UINT QoS, ULONG wait_option)
 {
+    /* Validate client_ptr and packet_ptr. */
+    if ((client_ptr == NX_NULL) || (packet_ptr == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
 
-    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
-
-    client_ptr -> nxd_mqtt_client_receive_notify = receive_notify;
+    /* Validate topic_name */
+    if ((topic_name == NX_NULL) || (topic_name_length == 0) || (topic_name_length > 0xFFFF))
+    {
+        return(NXD_MQTT_INVALID_PARAMETER);
+    }
 
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+    /* Validate QoS value. */
+    if (QoS > 3)
+    {
+        return(NXD_MQTT_INVALID_PARAMETER);
+    }
 
-    return(NXD_MQTT_SUCCESS);
+    return(_nxd_mqtt_client_publish_packet(client_ptr, topic_name, topic_name_length, packet_ptr, retain, QoS, wait_option));
 }
 
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_message_get                        PORTABLE C      */
+/*    _nxde_mqtt_client_subscribe                         PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -5153,35 +6898,29 @@ UINT _nxd_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function retrieves a published MQTT message.                   */
+/*    This function performs error checking to the subscribe service.     */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    topic_buffer                          Pointer to the topic buffer   */
-/*                                            where topic is copied to    */
-/*    topic_buffer_size                     Size of the topic buffer.     */
-/*    actual_topic_length                   Number of bytes copied into   */
-/*                                            topic_buffer                */
-/*    message_buffer                        Pointer to the buffer where   */
-/*                                            message is copied to        */
-/*    message_buffer_size                   Size of the message_buffer    */
-/*    actual_message_length                 Number of bytes copied into   */
-/*                                            the message buffer.         */
+/*    topic_name                            Pointer to the topic string   */
+/*                                            to subscribe to             */
+/*    topic_name_length                     Length of the topic string    */
+/*                                            in bytes                    */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    status                                Completion status             */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    topic_name                            Pointer to the topic string   */
+/*                                            to subscribe to             */
+/*    topic_name_length                     Length of the topic string    */
+/*                                            in bytes                    */
+/*    QoS                                   Expected QoS level            */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_disconnect           Actual MQTT Client disconnect */
-/*                                            call                        */
-/*    _nxd_mqtt_read_remaining_length       Skip the remaining length     */
-/*                                            field                       */
-/*    tx_mutex_get                                                        */
-/*    tx_mutex_put                                                        */
+/*    _nxd_mqtt_client_subscribe                                          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5192,70 +6931,43 @@ UINT _nxd_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            fixed uninitialized value,  */
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buffer, UINT topic_buffer_size, UINT *actual_topic_length,
-                                  UCHAR *message_buffer, UINT message_buffer_size, UINT *actual_message_length)
-{
-
-UINT                status;
-NX_PACKET          *packet_ptr;
-ULONG               topic_offset;
-USHORT              topic_length;
-ULONG               message_offset;
-ULONG               message_length;
-
-    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
-    while (client_ptr -> message_receive_queue_depth)
-    {
-        packet_ptr = client_ptr -> message_receive_queue_head;
-        status = _nxd_mqtt_process_publish_packet(packet_ptr, &topic_offset, &topic_length, &message_offset, &message_length);
-        if (status == NXD_MQTT_SUCCESS)
-        {
-            if ((topic_buffer_size < topic_length) ||
-                (message_buffer_size < message_length))
-            {
-                tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-                return(NXD_MQTT_INSUFFICIENT_BUFFER_SPACE);
-            }
-        }
-
-        client_ptr -> message_receive_queue_head = packet_ptr -> nx_packet_queue_next;
-        if (client_ptr -> message_receive_queue_tail == packet_ptr)
-        {
-            client_ptr -> message_receive_queue_tail = NX_NULL;
-        }
-        client_ptr -> message_receive_queue_depth--;
+UINT _nxde_mqtt_client_subscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length, UINT QoS)
+{
 
-        if (status == NXD_MQTT_SUCCESS)
-        {
 
-            /* Set topic and message lengths to avoid uninitialized value. */
-            *actual_topic_length = 0;
-            *actual_message_length = 0;
-            nx_packet_data_extract_offset(packet_ptr, topic_offset, topic_buffer,
-                                          topic_length, (ULONG *)actual_topic_length);
-            nx_packet_data_extract_offset(packet_ptr, message_offset, message_buffer,
-                                          message_length, (ULONG *)actual_message_length);
-            nx_packet_release(packet_ptr);
+    /* Validate client_ptr */
+    if (client_ptr == NX_NULL)
+    {
+        return(NX_PTR_ERROR);
+    }
 
-            tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-            return(NXD_MQTT_SUCCESS);
-        }
-        nx_packet_release(packet_ptr);
+    /* Validate topic_name */
+    if ((topic_name == NX_NULL) || (topic_name_length == 0))
+    {
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
-    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
-    return(NXD_MQTT_NO_MESSAGE);
+
+    /* Validate QoS value. */
+    if (QoS > 2)
+    {
+        return(NXD_MQTT_INVALID_PARAMETER);
+    }
+
+    return(_nxd_mqtt_client_subscribe(client_ptr, topic_name, topic_name_length, QoS));
 }
 
+
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_create                            PORTABLE C      */
+/*    _nxde_mqtt_client_unsubscribe                       PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -5263,23 +6975,16 @@ ULONG               message_length;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in nxd_mqt_client_create call.      */
+/*    This function performs error checking to the unsubscribe service.   */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    client_name                           Name string used in by the    */
-/*                                            client                      */
-/*    client_id                             Client ID used by the client  */
-/*    client_id_length                      Length of Client ID, in bytes */
-/*    ip_ptr                                Pointer to IP instance        */
-/*    pool_ptr                              Pointer to packet pool        */
-/*    stack_ptr                             Client thread's stack pointer */
-/*    stack_size                            Client thread's stack size    */
-/*    mqtt_thread_priority                  Priority for MQTT thread      */
-/*    memory_ptr                            Deprecated and not used       */
-/*    memory_size                           Deprecated and not used       */
+/*    topic_name                            Pointer to the topic string   */
+/*                                            to unsubscribe              */
+/*    topic_name_length                     Length of the topic string    */
+/*                                            in bytes                    */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5287,7 +6992,6 @@ ULONG               message_length;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_create               Actual client create call     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5302,23 +7006,21 @@ ULONG               message_length;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name, CHAR *client_id, UINT client_id_length,
-                              NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr,
-                              VOID *stack_ptr, ULONG stack_size, UINT mqtt_thread_priority,
-                              VOID *memory_ptr, ULONG memory_size)
+UINT _nxde_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length)
 {
-
-
-    /* Check for invalid input pointers.  */
-    if ((client_ptr == NX_NULL) || (ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID) ||
-        (stack_ptr == NX_NULL) || (stack_size == 0) || (pool_ptr == NX_NULL))
+    /* Validate client_ptr */
+    if (client_ptr == NX_NULL)
     {
         return(NX_PTR_ERROR);
     }
-    
-    return(_nxd_mqtt_client_create(client_ptr, client_name, client_id, client_id_length, ip_ptr,
-                                   pool_ptr, stack_ptr, stack_size, mqtt_thread_priority,
-                                   memory_ptr, memory_size));
+
+    /* Validate topic_name */
+    if ((topic_name == NX_NULL) || (topic_name_length == 0))
+    {
+        return(NXD_MQTT_INVALID_PARAMETER);
+    }
+
+    return(_nxd_mqtt_client_unsubscribe(client_ptr, topic_name, topic_name_length));
 }
 
 
@@ -5326,7 +7028,7 @@ UINT _nxde_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name, CH
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_connect                           PORTABLE C      */
+/*    _nxde_mqtt_client_disconnect                        PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -5334,19 +7036,12 @@ UINT _nxde_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name, CH
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in MQTT client stop call.           */
+/*    This function checks for errors in MQTT client disconnect call.     */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    server_ip                             Server IP address structure   */
-/*    server_port                           Server port number, in host   */
-/*                                            byte order                  */
-/*    keepalive                             The MQTT keepalive timer      */
-/*    clean_session                         Clean session flag            */
-/*    wait_option                           Suspension option             */
-/*                                                                        */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5354,7 +7049,7 @@ UINT _nxde_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name, CH
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_connect              Actual MQTT Client connect    */
+/*    _nxd_mqtt_client_disconnect           Actual MQTT Client disconnect */
 /*                                            call                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -5366,48 +7061,27 @@ UINT _nxde_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name, CH
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            corrected mqtt client state,*/
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_connect(NXD_MQTT_CLIENT *client_ptr, NXD_ADDRESS *server_ip, UINT server_port,
-                               UINT keepalive, UINT clean_session, ULONG wait_option)
+UINT _nxde_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr)
 {
-
-UINT status;
-
+    /* Validate client_ptr */
     if (client_ptr == NX_NULL)
     {
         return(NX_PTR_ERROR);
     }
 
-    if (server_ip == NX_NULL)
-    {
-        return(NX_PTR_ERROR);
-    }
-
-    /* Test for IP version flag. */
-    if ((server_ip -> nxd_ip_version != 4) && (server_ip -> nxd_ip_version != 6))
-    {
-        return(NXD_MQTT_INVALID_PARAMETER);
-    }
-
-    if (server_port == 0)
-    {
-        return(NX_INVALID_PORT);
-    }
-
-    status = _nxd_mqtt_client_connect(client_ptr, server_ip, server_port, keepalive, clean_session, wait_option);
-
-    return(status);
+    return(_nxd_mqtt_client_disconnect(client_ptr));
 }
 
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_secure_connect                    PORTABLE C      */
+/*    _nxde_mqtt_client_message_get                       PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -5415,21 +7089,22 @@ UINT status;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in MQTT client TLS secure connect.  */
+/*    This function checks for errors in MQTT client message get call.    */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    server_ip                             Server IP address structure   */
-/*    server_port                           Server port number, in host   */
-/*                                            byte order                  */
-/*    tls_setup                             User-supplied callback        */
-/*                                            function to set up TLS      */
-/*                                            parameters.                 */
-/*    keepalive                             The MQTT keepalive timer      */
-/*    wait_option                           Suspension option             */
-/*                                                                        */
+/*    topic_buffer                          Pointer to the topic buffer   */
+/*                                            where topic is copied to    */
+/*    topic_buffer_size                     Size of the topic buffer.     */
+/*    actual_topic_length                   Number of bytes copied into   */
+/*                                            topic_buffer                */
+/*    message_buffer                        Pointer to the buffer where   */
+/*                                            message is copied to        */
+/*    message_buffer_size                   Size of the message_buffer    */
+/*    actual_message_length                 Number of bytes copied into   */
+/*                                            the message buffer.         */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5437,8 +7112,8 @@ UINT status;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_connect              Actual MQTT Client connect    */
-/*                                            call                        */
+/*    _nxd_mqtt_client_message_get                                        */
+/*                                                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5449,49 +7124,39 @@ UINT status;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
-/*                                            corrected mqtt client state,*/
+/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-#ifdef NX_SECURE_ENABLE
-
-UINT _nxde_mqtt_client_secure_connect(NXD_MQTT_CLIENT *client_ptr, NXD_ADDRESS *server_ip, UINT server_port,
-                                      UINT (*tls_setup)(NXD_MQTT_CLIENT *client_ptr, NX_SECURE_TLS_SESSION *,
-                                                        NX_SECURE_X509_CERT *, NX_SECURE_X509_CERT *),
-                                      UINT keepalive, UINT clean_session, ULONG wait_option)
+UINT _nxde_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buffer, UINT topic_buffer_size, UINT *actual_topic_length,
+                                   UCHAR *message_buffer, UINT message_buffer_size, UINT *actual_message_length)
 {
 
-UINT status;
-
+    /* Validate client_ptr */
     if (client_ptr == NX_NULL)
     {
         return(NX_PTR_ERROR);
     }
 
-    if (server_ip == NX_NULL)
-    {
-        return(NX_PTR_ERROR);
-    }
+    /* Topic and topic_length can be NULL if caller does not care the topic string. */
 
-    if (server_port == 0)
+    /* Validate message.  Message_length can be NULL if caller does not care message length. */
+    if ((message_buffer == NX_NULL) || (topic_buffer == NX_NULL))
     {
-        return(NX_INVALID_PORT);
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-    status = _nxd_mqtt_client_secure_connect(client_ptr, server_ip, server_port, tls_setup,
-                                             keepalive, clean_session, wait_option);
 
-    return(status);
+    return(_nxd_mqtt_client_message_get(client_ptr, topic_buffer, topic_buffer_size, actual_topic_length,
+                                        message_buffer, message_buffer_size, actual_message_length));
 }
-#endif /* NX_SECURE_ENABLE */
 
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_delete                            PORTABLE C      */
+/*    _nxde_mqtt_client_receive_notify_set                PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -5499,12 +7164,16 @@ UINT status;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in MQTT client delete call.         */
+/*    This function checks for errors in MQTT client publish notify call. */
 /*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
+/*    receive_notify                        User-supplied callback        */
+/*                                            function, which is invoked  */
+/*                                            upon receiving a publish    */
+/*                                            message.                    */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5512,8 +7181,8 @@ UINT status;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_delete               Actual MQTT Client delete     */
-/*                                            call.                       */
+/*    _nxd_mqtt_client_receive_notify_set                                 */
+/*                                                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5528,19 +7197,21 @@ UINT status;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr)
+UINT _nxde_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
+                                          VOID (*receive_notify)(NXD_MQTT_CLIENT *client_ptr, UINT message_count))
 {
-
-UINT status;
-
+    /* Validate client_ptr */
     if (client_ptr == NX_NULL)
     {
         return(NX_PTR_ERROR);
     }
 
-    status = _nxd_mqtt_client_delete(client_ptr);
+    if (receive_notify == NX_NULL)
+    {
+        return(NX_PTR_ERROR);
+    }
 
-    return(status);
+    return(_nxd_mqtt_client_receive_notify_set(client_ptr, receive_notify));
 }
 
 
@@ -5549,7 +7220,7 @@ UINT status;
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_publish                           PORTABLE C      */
+/*    _nxd_mqtt_client_disconnect_notify_set              PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -5557,22 +7228,15 @@ UINT status;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs error checking to the publish service.       */
-/*                                                                        */
+/*    This function sets the notify function for the disconnect event.    */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    topic_name                            Name of the topic             */
-/*    topic_name_length                     Length of the topic name      */
-/*    message                               Message string                */
-/*    message_length                        Length of the message,        */
-/*                                            in bytes                    */
-/*    retain                                The retain flag, whether      */
-/*                                            or not the broker should    */
-/*                                            store this message          */
-/*    QoS                                   Expected QoS level            */
-/*    wait_option                           Suspension option             */
+/*    disconnect_notify                     The notify function to be     */
+/*                                            used when the client is     */
+/*                                            disconnected from the       */
+/*                                            server.                     */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5580,6 +7244,7 @@ UINT status;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    None                                                                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5594,34 +7259,12 @@ UINT status;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
-                               CHAR *message, UINT message_length, UINT retain, UINT QoS, ULONG wait_option)
+UINT _nxd_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*disconnect_notify)(NXD_MQTT_CLIENT *))
 {
-    /* Validate client_ptr */
-    if (client_ptr == NX_NULL)
-    {
-        return(NX_PTR_ERROR);
-    }
-
-    /* Validate topic_name */
-    if ((topic_name == NX_NULL) || (topic_name_length == 0))
-    {
-        return(NXD_MQTT_INVALID_PARAMETER);
-    }
-
-    /* Validate message length. */
-    if (message && (message_length == 0))
-    {
-        return(NXD_MQTT_INVALID_PARAMETER);
-    }
 
-    /* Validate QoS value. */
-    if (QoS > 3)
-    {
-        return(NXD_MQTT_INVALID_PARAMETER);
-    }
+    client_ptr -> nxd_mqtt_disconnect_notify = disconnect_notify;
 
-    return(_nxd_mqtt_client_publish(client_ptr, topic_name, topic_name_length, message, message_length, retain, QoS, wait_option));
+    return(NXD_MQTT_SUCCESS);
 }
 
 
@@ -5629,7 +7272,7 @@ UINT _nxde_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UI
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_subscribe                         PORTABLE C      */
+/*    _nxde_mqtt_client_disconnect_notify_set             PORTABLE C      */
 /*                                                           6.1          */
 /*  AUTHOR                                                                */
 /*                                                                        */
@@ -5637,29 +7280,23 @@ UINT _nxde_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UI
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs error checking to the subscribe service.     */
-/*                                                                        */
+/*    This function checks for errors in setting MQTT client disconnect   */
+/*    callback function.                                                  */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    topic_name                            Pointer to the topic string   */
-/*                                            to subscribe to             */
-/*    topic_name_length                     Length of the topic string    */
-/*                                            in bytes                    */
+/*    disconnect_callback                   The callback function to be   */
+/*                                            used when an on-going       */
+/*                                            connection is disconnected. */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
-/*    client_ptr                            Pointer to MQTT Client        */
-/*    topic_name                            Pointer to the topic string   */
-/*                                            to subscribe to             */
-/*    topic_name_length                     Length of the topic string    */
-/*                                            in bytes                    */
-/*    QoS                                   Expected QoS level            */
+/*    status                                Completion status             */
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_subscribe                                          */
+/*    _nxd_mqtt_client_disconnect_notify_set                              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5674,56 +7311,39 @@ UINT _nxde_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UI
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_subscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length, UINT QoS)
+UINT _nxde_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*disconnect_notify)(NXD_MQTT_CLIENT *))
 {
 
-
     /* Validate client_ptr */
     if (client_ptr == NX_NULL)
     {
         return(NX_PTR_ERROR);
     }
-
-    /* Validate topic_name */
-    if ((topic_name == NX_NULL) || (topic_name_length == 0))
-    {
-        return(NXD_MQTT_INVALID_PARAMETER);
-    }
-
-    /* Validate QoS value. */
-    if (QoS > 2)
-    {
-        return(NXD_MQTT_INVALID_PARAMETER);
-    }
-
-    return(_nxd_mqtt_client_subscribe(client_ptr, topic_name, topic_name_length, QoS));
+    return(_nxd_mqtt_client_disconnect_notify_set(client_ptr, disconnect_notify));
 }
 
-
-
-
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_unsubscribe                       PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_client_topic_filter_memory_set            PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs error checking to the unsubscribe service.   */
-/*                                                                        */
+/*    This function hands the memory used for the topic filter trie to the*/
+/*    MQTT client. The memory is split into the level hash table and the  */
+/*    pool of trie nodes. Filters added before are discarded.             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    topic_name                            Pointer to the topic string   */
-/*                                            to unsubscribe              */
-/*    topic_name_length                     Length of the topic string    */
-/*                                            in bytes                    */
+/*    memory_ptr                            Pointer to the memory area    */
+/*    memory_size                           Size of the memory area       */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5731,6 +7351,9 @@ UINT _nxde_mqtt_client_subscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name,
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
+/*    NXD_MQTT_SECURE_MEMSET                                              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5740,26 +7363,55 @@ UINT _nxde_mqtt_client_subscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name,
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length)
+UINT _nxd_mqtt_client_topic_filter_memory_set(NXD_MQTT_CLIENT *client_ptr, VOID *memory_ptr, ULONG memory_size)
 {
-    /* Validate client_ptr */
-    if (client_ptr == NX_NULL)
+NXD_MQTT_TOPIC_NODE *node_ptr;
+UINT                 node_count;
+UINT                 hash_size = 1;
+UINT                 i;
+
+    /* Size the hash table to the largest power of 2 not above the node count. */
+    node_count = (UINT)(memory_size / (sizeof(NXD_MQTT_TOPIC_NODE) + sizeof(NXD_MQTT_TOPIC_NODE *)));
+    if (node_count == 0)
     {
-        return(NX_PTR_ERROR);
+        return(NXD_MQTT_INSUFFICIENT_BUFFER_SPACE);
     }
 
-    /* Validate topic_name */
-    if ((topic_name == NX_NULL) || (topic_name_length == 0))
+    while ((hash_size << 1) <= node_count)
     {
-        return(NXD_MQTT_INVALID_PARAMETER);
+        hash_size <<= 1;
     }
 
-    return(_nxd_mqtt_client_unsubscribe(client_ptr, topic_name, topic_name_length));
+    /* Use the rest of the memory for nodes. */
+    node_count = (UINT)((memory_size - (hash_size * sizeof(NXD_MQTT_TOPIC_NODE *))) / sizeof(NXD_MQTT_TOPIC_NODE));
+
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+    NXD_MQTT_SECURE_MEMSET(memory_ptr, 0, memory_size);
+    NXD_MQTT_SECURE_MEMSET(&(client_ptr -> nxd_mqtt_topic_root), 0, sizeof(NXD_MQTT_TOPIC_NODE));
+
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    client_ptr -> nxd_mqtt_topic_hash = (NXD_MQTT_TOPIC_NODE **)memory_ptr;
+    client_ptr -> nxd_mqtt_topic_hash_size = hash_size;
+
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    node_ptr = (NXD_MQTT_TOPIC_NODE *)(client_ptr -> nxd_mqtt_topic_hash + hash_size);
+
+    /* Build the free list. Node number 0 is the root. */
+    client_ptr -> nxd_mqtt_topic_free_list = NX_NULL;
+    for (i = node_count; i > 0; i--)
+    {
+        node_ptr[i - 1].nxd_mqtt_topic_node_index = i;
+        node_ptr[i - 1].nxd_mqtt_topic_node_hash_next = client_ptr -> nxd_mqtt_topic_free_list;
+        client_ptr -> nxd_mqtt_topic_free_list = &node_ptr[i - 1];
+    }
+
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+    return(NXD_MQTT_SUCCESS);
 }
 
 
@@ -5767,20 +7419,31 @@ UINT _nxde_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_disconnect                        PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_client_topic_filter_add                   PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in MQTT client disconnect call.     */
-/*                                                                        */
+/*    This function registers a callback for a topic filter. PUBLISH      */
+/*    messages whose topic matches the filter are passed to the callback  */
+/*    instead of the receive queue. The packet is released when the       */
+/*    callback returns. Registering the same filter again replaces its    */
+/*    callback. The filter is not subscribed on the broker; use           */
+/*    nxd_mqtt_client_subscribe for that.                                 */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
+/*    topic_filter                          Pointer to the topic filter   */
+/*    topic_filter_length                   Length of the topic filter    */
+/*    message_notify                        User-supplied callback        */
+/*                                            function, which is invoked  */
+/*                                            upon receiving a matching   */
+/*                                            publish message.            */
+/*    context                               Context passed to the callback*/
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5788,8 +7451,13 @@ UINT _nxde_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_disconnect           Actual MQTT Client disconnect */
-/*                                            call                        */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
+/*    _nxd_mqtt_topic_filter_check                                        */
+/*    _nxd_mqtt_topic_node_find                                           */
+/*    _nxd_mqtt_topic_node_release                                        */
+/*    _nxd_mqtt_topic_level_hash                                          */
+/*    NXD_MQTT_SECURE_MEMCPY                                              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5799,20 +7467,119 @@ UINT _nxde_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr)
+UINT _nxd_mqtt_client_topic_filter_add(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length,
+                                       VOID (*message_notify)(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr,
+                                                              ULONG topic_offset, UINT topic_length,
+                                                              ULONG message_offset, ULONG message_length, VOID *context),
+                                       VOID *context)
 {
-    /* Validate client_ptr */
-    if (client_ptr == NX_NULL)
+NXD_MQTT_TOPIC_NODE *parent_ptr;
+NXD_MQTT_TOPIC_NODE *node_ptr;
+UCHAR               *level = (UCHAR *)topic_filter;
+UCHAR               *filter_end = (UCHAR *)topic_filter + topic_filter_length;
+UINT                 level_length;
+UINT                 hash;
+
+    if (_nxd_mqtt_topic_filter_check(level, topic_filter_length))
     {
-        return(NX_PTR_ERROR);
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-    return(_nxd_mqtt_client_disconnect(client_ptr));
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
+
+    if (client_ptr -> nxd_mqtt_topic_hash == NX_NULL)
+    {
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+        return(NXD_MQTT_INVALID_STATE);
+    }
+
+    /* Walk down the trie, adding the missing levels. */
+    parent_ptr = &(client_ptr -> nxd_mqtt_topic_root);
+    for (;;)
+    {
+        level_length = 0;
+        while (((level + level_length) < filter_end) && (level[level_length] != '/'))
+        {
+            level_length++;
+        }
+
+        node_ptr = _nxd_mqtt_topic_node_find(client_ptr, parent_ptr, level, level_length);
+        if (node_ptr == NX_NULL)
+        {
+            node_ptr = client_ptr -> nxd_mqtt_topic_free_list;
+            if (node_ptr == NX_NULL)
+            {
+
+                /* Out of nodes. Drop the references taken on the levels added so far. */
+                _nxd_mqtt_topic_node_release(client_ptr, parent_ptr);
+                tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+                return(NXD_MQTT_INSUFFICIENT_BUFFER_SPACE);
+            }
+            client_ptr -> nxd_mqtt_topic_free_list = node_ptr -> nxd_mqtt_topic_node_hash_next;
+
+            node_ptr -> nxd_mqtt_topic_node_parent = parent_ptr;
+            node_ptr -> nxd_mqtt_topic_node_hash_next = NX_NULL;
+            node_ptr -> nxd_mqtt_topic_node_single_level = NX_NULL;
+            node_ptr -> nxd_mqtt_topic_node_multi_level = NX_NULL;
+            node_ptr -> nxd_mqtt_topic_node_notify = NX_NULL;
+            node_ptr -> nxd_mqtt_topic_node_context = NX_NULL;
+            node_ptr -> nxd_mqtt_topic_node_reference = 0;
+            node_ptr -> nxd_mqtt_topic_node_level_length = level_length;
+            NXD_MQTT_SECURE_MEMCPY(node_ptr -> nxd_mqtt_topic_node_level, level, level_length); /* Use case of memcpy is verified. */
+
+            /* Link the node to its parent. */
+            if ((level_length == 1) && (*level == '+'))
+            {
+                parent_ptr -> nxd_mqtt_topic_node_single_level = node_ptr;
+            }
+            else if ((level_length == 1) && (*level == '#'))
+            {
+                parent_ptr -> nxd_mqtt_topic_node_multi_level = node_ptr;
+            }
+            else
+            {
+                hash = _nxd_mqtt_topic_level_hash(parent_ptr -> nxd_mqtt_topic_node_index, level, level_length);
+                hash &= (client_ptr -> nxd_mqtt_topic_hash_size - 1);
+                node_ptr -> nxd_mqtt_topic_node_hash_next = client_ptr -> nxd_mqtt_topic_hash[hash];
+                client_ptr -> nxd_mqtt_topic_hash[hash] = node_ptr;
+            }
+        }
+
+        node_ptr -> nxd_mqtt_topic_node_reference++;
+        parent_ptr = node_ptr;
+
+        level += level_length;
+        if (level == filter_end)
+        {
+            break;
+        }
+
+        /* Skip the level separator. */
+        level++;
+    }
+
+    if (node_ptr -> nxd_mqtt_topic_node_notify)
+    {
+
+        /* The filter is already registered. Keep one reference for it. */
+        _nxd_mqtt_topic_node_release(client_ptr, node_ptr);
+    }
+    else
+    {
+
+        /* The root counts the registered filters. */
+        client_ptr -> nxd_mqtt_topic_root.nxd_mqtt_topic_node_reference++;
+    }
+
+    node_ptr -> nxd_mqtt_topic_node_notify = message_notify;
+    node_ptr -> nxd_mqtt_topic_node_context = context;
+
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+    return(NXD_MQTT_SUCCESS);
 }
 
 
@@ -5820,30 +7587,22 @@ UINT _nxde_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr)
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_message_get                       PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxd_mqtt_client_topic_filter_remove                PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in MQTT client message get call.    */
-/*                                                                        */
+/*    This function removes the callback of a topic filter. Levels of the */
+/*    trie not used by other filters are freed.                           */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    topic_buffer                          Pointer to the topic buffer   */
-/*                                            where topic is copied to    */
-/*    topic_buffer_size                     Size of the topic buffer.     */
-/*    actual_topic_length                   Number of bytes copied into   */
-/*                                            topic_buffer                */
-/*    message_buffer                        Pointer to the buffer where   */
-/*                                            message is copied to        */
-/*    message_buffer_size                   Size of the message_buffer    */
-/*    actual_message_length                 Number of bytes copied into   */
-/*                                            the message buffer.         */
+/*    topic_filter                          Pointer to the topic filter   */
+/*    topic_filter_length                   Length of the topic filter    */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5851,8 +7610,11 @@ UINT _nxde_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr)
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_message_get                                        */
-/*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
+/*    _nxd_mqtt_topic_filter_check                                        */
+/*    _nxd_mqtt_topic_node_find                                           */
+/*    _nxd_mqtt_topic_node_release                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5862,32 +7624,70 @@ UINT _nxde_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr)
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buffer, UINT topic_buffer_size, UINT *actual_topic_length,
-                                   UCHAR *message_buffer, UINT message_buffer_size, UINT *actual_message_length)
+UINT _nxd_mqtt_client_topic_filter_remove(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length)
 {
+NXD_MQTT_TOPIC_NODE *node_ptr;
+UCHAR               *level = (UCHAR *)topic_filter;
+UCHAR               *filter_end = (UCHAR *)topic_filter + topic_filter_length;
+UINT                 level_length;
 
-    /* Validate client_ptr */
-    if (client_ptr == NX_NULL)
+    if (_nxd_mqtt_topic_filter_check(level, topic_filter_length))
     {
-        return(NX_PTR_ERROR);
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-    /* Topic and topic_length can be NULL if caller does not care the topic string. */
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
 
-    /* Validate message.  Message_length can be NULL if caller does not care message length. */
-    if ((message_buffer == NX_NULL) || (topic_buffer == NX_NULL))
+    if (client_ptr -> nxd_mqtt_topic_hash == NX_NULL)
+    {
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+        return(NXD_MQTT_INVALID_STATE);
+    }
+
+    node_ptr = &(client_ptr -> nxd_mqtt_topic_root);
+    for (;;)
+    {
+        level_length = 0;
+        while (((level + level_length) < filter_end) && (level[level_length] != '/'))
+        {
+            level_length++;
+        }
+
+        node_ptr = _nxd_mqtt_topic_node_find(client_ptr, node_ptr, level, level_length);
+        if (node_ptr == NX_NULL)
+        {
+            break;
+        }
+
+        level += level_length;
+        if (level == filter_end)
+        {
+            break;
+        }
+
+        /* Skip the level separator. */
+        level++;
+    }
+
+    if ((node_ptr == NX_NULL) || (node_ptr -> nxd_mqtt_topic_node_notify == NX_NULL))
     {
+
+        /* The filter is not registered. */
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
         return(NXD_MQTT_INVALID_PARAMETER);
     }
 
+    node_ptr -> nxd_mqtt_topic_node_notify = NX_NULL;
+    node_ptr -> nxd_mqtt_topic_node_context = NX_NULL;
+    client_ptr -> nxd_mqtt_topic_root.nxd_mqtt_topic_node_reference--;
+    _nxd_mqtt_topic_node_release(client_ptr, node_ptr);
 
-    return(_nxd_mqtt_client_message_get(client_ptr, topic_buffer, topic_buffer_size, actual_topic_length,
-                                        message_buffer, message_buffer_size, actual_message_length));
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+    return(NXD_MQTT_SUCCESS);
 }
 
 
@@ -5895,24 +7695,21 @@ UINT _nxde_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buf
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_receive_notify_set                PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxde_mqtt_client_topic_filter_memory_set           PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in MQTT client publish notify call. */
-/*                                                                        */
+/*    This function checks for errors in the topic filter memory set call.*/
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    receive_notify                        User-supplied callback        */
-/*                                            function, which is invoked  */
-/*                                            upon receiving a publish    */
-/*                                            message.                    */
+/*    memory_ptr                            Pointer to the memory area    */
+/*    memory_size                           Size of the memory area       */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5920,7 +7717,7 @@ UINT _nxde_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buf
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_receive_notify_set                                 */
+/*    _nxd_mqtt_client_topic_filter_memory_set                            */
 /*                                                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -5931,51 +7728,49 @@ UINT _nxde_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buf
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
-                                          VOID (*receive_notify)(NXD_MQTT_CLIENT *client_ptr, UINT message_count))
+UINT _nxde_mqtt_client_topic_filter_memory_set(NXD_MQTT_CLIENT *client_ptr, VOID *memory_ptr, ULONG memory_size)
 {
-    /* Validate client_ptr */
-    if (client_ptr == NX_NULL)
+
+    /* Validate client_ptr and memory_ptr. The memory must be aligned for pointer access. */
+    if ((client_ptr == NX_NULL) || (memory_ptr == NX_NULL))
     {
         return(NX_PTR_ERROR);
     }
 
-    if (receive_notify == NX_NULL)
+    if (((ALIGN_TYPE)memory_ptr) & (sizeof(ALIGN_TYPE) - 1))
     {
-        return(NX_PTR_ERROR);
+        return(NXD_MQTT_INVALID_PARAMETER);
     }
 
-    return(_nxd_mqtt_client_receive_notify_set(client_ptr, receive_notify));
+    return(_nxd_mqtt_client_topic_filter_memory_set(client_ptr, memory_ptr, memory_size));
 }
 
 
-
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxd_mqtt_client_disconnect_notify_set              PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxde_mqtt_client_topic_filter_add                  PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function sets the notify function for the disconnect event.    */
+/*    This function checks for errors in the topic filter add call.       */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    disconnect_notify                     The notify function to be     */
-/*                                            used when the client is     */
-/*                                            disconnected from the       */
-/*                                            server.                     */
+/*    topic_filter                          Pointer to the topic filter   */
+/*    topic_filter_length                   Length of the topic filter    */
+/*    message_notify                        User-supplied callback        */
+/*                                            function                    */
+/*    context                               Context passed to the callback*/
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -5983,7 +7778,7 @@ UINT _nxde_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _nxd_mqtt_client_topic_filter_add                                   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -5993,17 +7788,23 @@ UINT _nxde_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxd_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*disconnect_notify)(NXD_MQTT_CLIENT *))
+UINT _nxde_mqtt_client_topic_filter_add(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length,
+                                        VOID (*message_notify)(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr,
+                                                               ULONG topic_offset, UINT topic_length,
+                                                               ULONG message_offset, ULONG message_length, VOID *context),
+                                        VOID *context)
 {
 
-    client_ptr -> nxd_mqtt_disconnect_notify = disconnect_notify;
+    /* Validate client_ptr, topic_filter and message_notify. */
+    if ((client_ptr == NX_NULL) || (topic_filter == NX_NULL) || (message_notify == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
 
-    return(NXD_MQTT_SUCCESS);
+    return(_nxd_mqtt_client_topic_filter_add(client_ptr, topic_filter, topic_filter_length, message_notify, context));
 }
 
 
@@ -6011,23 +7812,21 @@ UINT _nxd_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
-/*    _nxde_mqtt_client_disconnect_notify_set             PORTABLE C      */
-/*                                                           6.1          */
+/*    _nxde_mqtt_client_topic_filter_remove               PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function checks for errors in setting MQTT client disconnect   */
-/*    callback function.                                                  */
+/*    This function checks for errors in the topic filter remove call.    */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    client_ptr                            Pointer to MQTT Client        */
-/*    disconnect_callback                   The callback function to be   */
-/*                                            used when an on-going       */
-/*                                            connection is disconnected. */
+/*    topic_filter                          Pointer to the topic filter   */
+/*    topic_filter_length                   Length of the topic filter    */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -6035,7 +7834,7 @@ UINT _nxd_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nxd_mqtt_client_disconnect_notify_set                              */
+/*    _nxd_mqtt_client_topic_filter_remove                                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -6045,21 +7844,21 @@ UINT _nxd_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
-/*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
-/*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
-/*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
 /*                                                                        */
 /**************************************************************************/
-UINT _nxde_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*disconnect_notify)(NXD_MQTT_CLIENT *))
+UINT _nxde_mqtt_client_topic_filter_remove(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length)
 {
 
-    /* Validate client_ptr */
-    if (client_ptr == NX_NULL)
+    /* Validate client_ptr and topic_filter. */
+    if ((client_ptr == NX_NULL) || (topic_filter == NX_NULL))
     {
         return(NX_PTR_ERROR);
     }
-    return(_nxd_mqtt_client_disconnect_notify_set(client_ptr, disconnect_notify));
+
+    return(_nxd_mqtt_client_topic_filter_remove(client_ptr, topic_filter, topic_filter_length));
 }
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 
 
 #ifdef NXD_MQTT_CLOUD_ENABLE
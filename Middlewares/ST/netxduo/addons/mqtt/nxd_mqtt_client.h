@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nxd_mqtt_client.h                                   PORTABLE C      */
-/*                                                           6.1.2        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -48,6 +48,12 @@
 /*  11-09-2020     Yuxin Zhou               Modified comment(s), and      */
 /*                                            added packet id parameter,  */
 /*                                            resulting in version 6.1.2  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            packet ID index, publish of */
+/*                                            application packets, clean  */
+/*                                            session header-only store   */
+/*                                            and topic filter dispatch,  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -137,6 +143,40 @@ extern   "C" {
 #define NXD_MQTT_INITIAL_PACKET_ID_VALUE                               1
 #endif
 
+/* Define the number of buckets of the packet ID index used to match acknowledgements with
+   the transmit queue. The value must be a power of 2. */
+#ifndef NXD_MQTT_TRANSMIT_INDEX_SIZE
+#define NXD_MQTT_TRANSMIT_INDEX_SIZE                                   16
+#endif
+
+/* Define this option to avoid keeping a copy of QoS 1 PUBLISH messages for retransmission when
+   the client uses a clean session. Such messages are never retransmitted, so only the fixed
+   header is kept to match the PUBACK, and the packet passed to the ack receive notify holds only
+   that byte. Together with nxd_mqtt_client_publish_packet, which sends a message written by the
+   application into a packet from nxd_mqtt_client_publish_packet_allocate, a QoS 0 or QoS 1
+   message is then never copied by the client. QoS 2 publish is not supported.
+#define NXD_MQTT_ZERO_COPY_PUBLISH
+*/
+
+/* Define this option to deliver received PUBLISH messages to callbacks registered per topic
+   filter. Filters, including the '+' and '#' wildcards, are kept in a trie whose levels are
+   found through a hash table, so matching a topic costs one lookup per topic level no matter
+   how many filters are registered. Messages that match no filter are queued for
+   nxd_mqtt_client_message_get as before.
+#define NXD_MQTT_TOPIC_FILTER_ENABLE
+*/
+
+/* Define the maximum length of one level of a topic filter. */
+#ifndef NXD_MQTT_TOPIC_LEVEL_SIZE
+#define NXD_MQTT_TOPIC_LEVEL_SIZE                                      40
+#endif
+
+/* Define the maximum number of topic filters that may match one received topic. Messages
+   matching more filters are queued for nxd_mqtt_client_message_get instead. */
+#ifndef NXD_MQTT_TOPIC_MATCH_SIZE
+#define NXD_MQTT_TOPIC_MATCH_SIZE                                      8
+#endif
+
 /* Set a timeout for socket operations (send, receive, disconnect). */
 #ifndef NXD_MQTT_SOCKET_TIMEOUT
 #define NXD_MQTT_SOCKET_TIMEOUT                                         NX_WAIT_FOREVER
@@ -289,6 +329,28 @@ typedef struct MQTT_PACKET_DISCONNECT_STRUCT
 #define NXD_MQTT_ERROR_NOT_AUTHORIZED        0x10085
 
 
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
+struct NXD_MQTT_CLIENT_STRUCT;
+
+/* Define the topic filter trie node. Each level of a topic filter uses one node, and filters
+   with the same leading levels share nodes. */
+typedef struct NXD_MQTT_TOPIC_NODE_STRUCT
+{
+    struct NXD_MQTT_TOPIC_NODE_STRUCT *nxd_mqtt_topic_node_parent;
+    struct NXD_MQTT_TOPIC_NODE_STRUCT *nxd_mqtt_topic_node_hash_next;      /* Next node in hash bucket or free list */
+    struct NXD_MQTT_TOPIC_NODE_STRUCT *nxd_mqtt_topic_node_single_level;   /* Child for the '+' wildcard            */
+    struct NXD_MQTT_TOPIC_NODE_STRUCT *nxd_mqtt_topic_node_multi_level;    /* Child for the '#' wildcard            */
+    VOID                             (*nxd_mqtt_topic_node_notify)(struct NXD_MQTT_CLIENT_STRUCT *client_ptr, NX_PACKET *packet_ptr,
+                                                                   ULONG topic_offset, UINT topic_length,
+                                                                   ULONG message_offset, ULONG message_length, VOID *context);
+    VOID                              *nxd_mqtt_topic_node_context;
+    UINT                               nxd_mqtt_topic_node_index;          /* Node number used by the level hash    */
+    UINT                               nxd_mqtt_topic_node_reference;      /* Number of filters using the node      */
+    UINT                               nxd_mqtt_topic_node_level_length;
+    UCHAR                              nxd_mqtt_topic_node_level[NXD_MQTT_TOPIC_LEVEL_SIZE];
+} NXD_MQTT_TOPIC_NODE;
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
+
 /* Define the basic MQTT Client control block. */
 typedef struct NXD_MQTT_CLIENT_STRUCT
 {
@@ -331,6 +393,7 @@ typedef struct NXD_MQTT_CLIENT_STRUCT
     NX_PACKET                     *nxd_mqtt_client_processing_packet;
     NX_PACKET                     *message_transmit_queue_head;
     NX_PACKET                     *message_transmit_queue_tail;
+    NX_PACKET                     *message_transmit_index[NXD_MQTT_TRANSMIT_INDEX_SIZE];
     NX_PACKET                     *message_receive_queue_head;
     NX_PACKET                     *message_receive_queue_tail;
     UINT                           message_receive_queue_depth;
@@ -342,6 +405,12 @@ typedef struct NXD_MQTT_CLIENT_STRUCT
     VOID                          *nxd_mqtt_packet_receive_context;
     VOID                         (*nxd_mqtt_ack_receive_notify)(struct NXD_MQTT_CLIENT_STRUCT *client_ptr, UINT type, USHORT packet_id, NX_PACKET *transmit_packet_ptr, VOID *context);
     VOID                          *nxd_mqtt_ack_receive_context;
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
+    NXD_MQTT_TOPIC_NODE            nxd_mqtt_topic_root;                             /* Root of the topic filter trie. */
+    NXD_MQTT_TOPIC_NODE          **nxd_mqtt_topic_hash;                             /* Hash table of topic levels. */
+    UINT                           nxd_mqtt_topic_hash_size;
+    NXD_MQTT_TOPIC_NODE           *nxd_mqtt_topic_free_list;
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 #ifdef NX_SECURE_ENABLE
     UINT                           nxd_mqtt_client_use_tls;
     UINT                         (*nxd_mqtt_tls_setup)(struct NXD_MQTT_CLIENT_STRUCT *, NX_SECURE_TLS_SESSION *,
@@ -373,12 +442,19 @@ typedef struct NXD_MQTT_CLIENT_STRUCT
 #define nxd_mqtt_client_connect               _nxd_mqtt_client_connect
 #define nxd_mqtt_client_secure_connect        _nxd_mqtt_client_secure_connect
 #define nxd_mqtt_client_publish               _nxd_mqtt_client_publish
+#define nxd_mqtt_client_publish_packet_allocate _nxd_mqtt_client_publish_packet_allocate
+#define nxd_mqtt_client_publish_packet        _nxd_mqtt_client_publish_packet
 #define nxd_mqtt_client_subscribe             _nxd_mqtt_client_subscribe
 #define nxd_mqtt_client_unsubscribe           _nxd_mqtt_client_unsubscribe
 #define nxd_mqtt_client_disconnect            _nxd_mqtt_client_disconnect
 #define nxd_mqtt_client_receive_notify_set    _nxd_mqtt_client_receive_notify_set
 #define nxd_mqtt_client_message_get           _nxd_mqtt_client_message_get
 #define nxd_mqtt_client_disconnect_notify_set _nxd_mqtt_client_disconnect_notify_set
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
+#define nxd_mqtt_client_topic_filter_memory_set _nxd_mqtt_client_topic_filter_memory_set
+#define nxd_mqtt_client_topic_filter_add        _nxd_mqtt_client_topic_filter_add
+#define nxd_mqtt_client_topic_filter_remove     _nxd_mqtt_client_topic_filter_remove
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 #else /* if !NXD_MQTT_CLIENT_SOURCE_CODE */
 
 #define nxd_mqtt_client_create                _nxde_mqtt_client_create
@@ -388,12 +464,19 @@ typedef struct NXD_MQTT_CLIENT_STRUCT
 #define nxd_mqtt_client_connect               _nxde_mqtt_client_connect
 #define nxd_mqtt_client_secure_connect        _nxde_mqtt_client_secure_connect
 #define nxd_mqtt_client_publish               _nxde_mqtt_client_publish
+#define nxd_mqtt_client_publish_packet_allocate _nxde_mqtt_client_publish_packet_allocate
+#define nxd_mqtt_client_publish_packet        _nxde_mqtt_client_publish_packet
 #define nxd_mqtt_client_subscribe             _nxde_mqtt_client_subscribe
 #define nxd_mqtt_client_unsubscribe           _nxde_mqtt_client_unsubscribe
 #define nxd_mqtt_client_disconnect            _nxde_mqtt_client_disconnect
 #define nxd_mqtt_client_receive_notify_set    _nxde_mqtt_client_receive_notify_set
 #define nxd_mqtt_client_message_get           _nxde_mqtt_client_message_get
 #define nxd_mqtt_client_disconnect_notify_set _nxde_mqtt_client_disconnect_notify_set
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
+#define nxd_mqtt_client_topic_filter_memory_set _nxde_mqtt_client_topic_filter_memory_set
+#define nxd_mqtt_client_topic_filter_add        _nxde_mqtt_client_topic_filter_add
+#define nxd_mqtt_client_topic_filter_remove     _nxde_mqtt_client_topic_filter_remove
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 #endif /* NX_DISABLE_ERROR_CHECKING */
 
 
@@ -417,6 +500,9 @@ UINT nxd_mqtt_client_secure_connect(NXD_MQTT_CLIENT *client_ptr, NXD_ADDRESS *se
 #endif /* NX_SECURE_ENABLE */
 UINT nxd_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length, CHAR *message, UINT message_length,
                              UINT retain, UINT QoS, ULONG timeout);
+UINT nxd_mqtt_client_publish_packet_allocate(NXD_MQTT_CLIENT *client_ptr, NX_PACKET **packet_ptr, UINT topic_name_length);
+UINT nxd_mqtt_client_publish_packet(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length, NX_PACKET *packet_ptr,
+                                    UINT retain, UINT QoS, ULONG timeout);
 UINT nxd_mqtt_client_subscribe(NXD_MQTT_CLIENT *mqtt_client_pr, CHAR *topic_name, UINT topic_name_length, UINT QoS);
 UINT nxd_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *mqtt_client_pr, CHAR *topic_name, UINT topic_name_length);
 UINT nxd_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
@@ -427,6 +513,15 @@ UINT nxd_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr);
 
 UINT nxd_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr);
 UINT nxd_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*disconnect_notify)(NXD_MQTT_CLIENT *));
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
+UINT nxd_mqtt_client_topic_filter_memory_set(NXD_MQTT_CLIENT *client_ptr, VOID *memory_ptr, ULONG memory_size);
+UINT nxd_mqtt_client_topic_filter_add(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length,
+                                      VOID (*message_notify)(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr,
+                                                             ULONG topic_offset, UINT topic_length,
+                                                             ULONG message_offset, ULONG message_length, VOID *context),
+                                      VOID *context);
+UINT nxd_mqtt_client_topic_filter_remove(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length);
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 
 #else /* ifdef NXD_MQTT_CLIENT_SOURCE_CODE */
 
@@ -440,6 +535,15 @@ UINT _nxd_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name,
 UINT _nxd_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr);
 UINT _nxd_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr);
 UINT _nxd_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*disconnect_notify)(NXD_MQTT_CLIENT *));
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
+UINT _nxd_mqtt_client_topic_filter_memory_set(NXD_MQTT_CLIENT *client_ptr, VOID *memory_ptr, ULONG memory_size);
+UINT _nxd_mqtt_client_topic_filter_add(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length,
+                                       VOID (*message_notify)(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr,
+                                                              ULONG topic_offset, UINT topic_length,
+                                                              ULONG message_offset, ULONG message_length, VOID *context),
+                                       VOID *context);
+UINT _nxd_mqtt_client_topic_filter_remove(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length);
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 UINT _nxd_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
                                 CHAR *username, UINT username_length, CHAR *password, UINT password_length);
 UINT _nxd_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buffer, UINT topic_buffer_size, UINT *actual_topic_length,
@@ -448,6 +552,9 @@ UINT _nxd_mqtt_client_publish_packet_send(NXD_MQTT_CLIENT *client_ptr, NX_PACKET
                                           USHORT packet_id, UINT QoS, ULONG wait_option);
 UINT _nxd_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
                               CHAR *message, UINT message_length, UINT retain, UINT QoS, ULONG timeout);
+UINT _nxd_mqtt_client_publish_packet_allocate(NXD_MQTT_CLIENT *client_ptr, NX_PACKET **packet_ptr, UINT topic_name_length);
+UINT _nxd_mqtt_client_publish_packet(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
+                                     NX_PACKET *packet_ptr, UINT retain, UINT QoS, ULONG wait_option);
 UINT _nxd_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
                                          VOID (*receive_notify)(NXD_MQTT_CLIENT *client_ptr, UINT message_count));
 UINT _nxd_mqtt_client_release_callback_set(NXD_MQTT_CLIENT *client_ptr, VOID (*memory_release_function)(CHAR *, UINT));
@@ -473,6 +580,15 @@ UINT _nxde_mqtt_client_create(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name, CH
                               VOID *memory_ptr, ULONG memory_size);
 UINT _nxde_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr);
 UINT _nxde_mqtt_client_disconnect_notify_set(NXD_MQTT_CLIENT *client_ptr, VOID (*disconnect_notify)(NXD_MQTT_CLIENT *));
+#ifdef NXD_MQTT_TOPIC_FILTER_ENABLE
+UINT _nxde_mqtt_client_topic_filter_memory_set(NXD_MQTT_CLIENT *client_ptr, VOID *memory_ptr, ULONG memory_size);
+UINT _nxde_mqtt_client_topic_filter_add(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length,
+                                        VOID (*message_notify)(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr,
+                                                               ULONG topic_offset, UINT topic_length,
+                                                               ULONG message_offset, ULONG message_length, VOID *context),
+                                        VOID *context);
+UINT _nxde_mqtt_client_topic_filter_remove(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_filter, UINT topic_filter_length);
+#endif /* NXD_MQTT_TOPIC_FILTER_ENABLE */
 UINT _nxde_mqtt_client_disconnect(NXD_MQTT_CLIENT *client_ptr);
 UINT _nxde_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
                                  CHAR *username, UINT username_length, CHAR *password, UINT password_length);
@@ -480,6 +596,9 @@ UINT _nxde_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buf
                                    UCHAR *message_buffer, UINT message_buffer_size, UINT *actual_message_length);
 UINT _nxde_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
                                CHAR *message, UINT message_length, UINT retain, UINT QoS, ULONG timeout);
+UINT _nxde_mqtt_client_publish_packet_allocate(NXD_MQTT_CLIENT *client_ptr, NX_PACKET **packet_ptr, UINT topic_name_length);
+UINT _nxde_mqtt_client_publish_packet(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
+                                      NX_PACKET *packet_ptr, UINT retain, UINT QoS, ULONG wait_option);
 UINT _nxde_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
                                           VOID (*receive_notify)(NXD_MQTT_CLIENT *client_ptr, UINT message_count));
 UINT _nxde_mqtt_client_release_callback_set(NXD_MQTT_CLIENT *client_ptr, VOID (*release_callback)(CHAR *, UINT));
@@ -69,6 +69,11 @@ static UINT    _nx_nat_entry_create(NX_NAT_DEVICE *nat_ptr, UCHAR protocol, ULON
 static UINT    _nx_nat_entry_add(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr);  
 static VOID    _nx_nat_entry_find(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_to_match, NX_NAT_TRANSLATION_ENTRY **match_entry_ptr, UCHAR direction, UINT skip_static_entries); 
 static VOID    _nx_nat_entry_timeout_check(NX_NAT_DEVICE *nat_ptr);
+static UINT    _nx_nat_entry_hash(ULONG address, USHORT port, USHORT peer_port, UCHAR protocol);
+static VOID    _nx_nat_entry_hash_insert(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr);
+static VOID    _nx_nat_entry_hash_remove(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr);
+static VOID    _nx_nat_entry_port_insert(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr);
+static VOID    _nx_nat_entry_timer_insert(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr);
 static UINT    _nx_nat_packet_is_icmp_error_message(NX_PACKET *packet_ptr, UINT *is_icmp_error_msg);
 static UINT    _nx_nat_find_available_port(NX_NAT_DEVICE *nat_ptr, UCHAR protocol, USHORT *port); 
 static UINT    _nx_nat_entry_port_verify(NX_IP *ip_ptr, UINT protocol, UINT port);    
@@ -183,7 +188,7 @@ UINT status;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _nx_nat_create                                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -210,6 +215,7 @@ UINT status;
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    tx_mutex_create                    Create NAT flag group mutex      */
+/*    tx_time_get                        Get the system time              */
 /*    memset                             Clear specified area of memory   */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -223,6 +229,9 @@ UINT status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            timer wheel initialization, */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_nat_create(NX_NAT_DEVICE *nat_ptr, NX_IP *ip_ptr, UINT global_interface_index, VOID *dynamic_cache_memory, UINT dynamic_cache_size)  
@@ -257,12 +266,16 @@ NX_NAT_TRANSLATION_ENTRY      *entry_ptr;
         entry_ptr ++;
     }
 
-    /* Setup the head pointers of the available and dynamic (active) lists in the NAT Device.  */    
+    /* Setup the head pointers of the available and static (active) lists in the NAT Device.  */    
     nat_ptr -> nx_nat_dynamic_available_entry_head = (NX_NAT_TRANSLATION_ENTRY *) dynamic_cache_memory; 
     nat_ptr -> nx_nat_dynamic_active_entry_head = NX_NULL;
     nat_ptr -> nx_nat_dynamic_available_entries = dynamic_entries;
     nat_ptr -> nx_nat_dynamic_active_entries = 0;
     nat_ptr -> nx_nat_static_active_entries = 0;       
+
+    /* Start the timer wheel at the current time. The hash tables and wheel slots were cleared above.  */
+    nat_ptr -> nx_nat_timer_wheel_tick = tx_time_get();
+    nat_ptr -> nx_nat_timer_wheel_slot = 0;
                 
     /* Load the NAT ID field in the NAT control block.  */
     nat_ptr -> nx_nat_id =  NX_NAT_ID;
@@ -1009,7 +1022,7 @@ UINT status;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _nx_nat_inbound_entry_delete                        PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -1043,6 +1056,9 @@ UINT status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            static entry list,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_nat_inbound_entry_delete(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *delete_entry_ptr)
@@ -1056,7 +1072,7 @@ NX_NAT_TRANSLATION_ENTRY *next_entry_ptr;
     /* Get the IP mutex.  */
     tx_mutex_get(&(nat_ptr -> nx_nat_ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);                 
 
-    /* Get a pointer to the start of the entries in the translation table. */
+    /* Get a pointer to the start of the static entries. */
     entry_ptr = nat_ptr -> nx_nat_dynamic_active_entry_head;
 
     /* Initialize the previous pointer.  */
@@ -1085,7 +1101,7 @@ NX_NAT_TRANSLATION_ENTRY *next_entry_ptr;
             else 
             {
 
-                /* It is the first entry, so set the next pointer as the starting translation table entry. */
+                /* It is the first entry, so set the next pointer as the starting static entry. */
                 nat_ptr -> nx_nat_dynamic_active_entry_head = next_entry_ptr;
             }           
 
@@ -3063,7 +3079,7 @@ NX_NAT_TRANSLATION_ENTRY       *record_entry;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _nx_nat_outbound_entry_find                         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3093,6 +3109,7 @@ NX_NAT_TRANSLATION_ENTRY       *record_entry;
 /*    _nx_nat_entry_create              Create entry for packet in NAT    */ 
 /*                                          translation table             */
 /*    _nx_nat_entry_find                Find the entry                    */
+/*    _nx_nat_entry_port_insert         Index entry by external port      */
 /*    _nx_ip_route_find                 Find the suitable interface       */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -3108,6 +3125,9 @@ NX_NAT_TRANSLATION_ENTRY       *record_entry;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            external port index,        */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_nat_outbound_entry_find(NX_NAT_DEVICE *nat_ptr, NX_PACKET *packet_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr, 
@@ -3181,6 +3201,9 @@ NX_NAT_TRANSLATION_ENTRY   *record_entry;
             /* Return error status. */
             return status;
         }
+
+        /* Index the entry by the port allocated to it.  */
+        _nx_nat_entry_port_insert(nat_ptr, record_entry);
     }           
 
     /* Set the packet interface as global interface.  */
@@ -3209,7 +3232,7 @@ NX_NAT_TRANSLATION_ENTRY   *record_entry;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _nx_nat_entry_create                                PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3241,6 +3264,7 @@ NX_NAT_TRANSLATION_ENTRY   *record_entry;
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    _nx_nat_entry_add                Add entry to linked list of entries*/
+/*    _nx_nat_entry_hash_remove        Remove entry from hash tables      */
 /*    memset                           Clear specified area of memory     */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -3255,6 +3279,9 @@ NX_NAT_TRANSLATION_ENTRY   *record_entry;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            timer wheel replacement,    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_nat_entry_create(NX_NAT_DEVICE *nat_ptr, UCHAR protocol, 
@@ -3266,6 +3293,8 @@ static UINT  _nx_nat_entry_create(NX_NAT_DEVICE *nat_ptr, UCHAR protocol,
 NX_NAT_TRANSLATION_ENTRY *insert_entry_ptr = NX_NULL;
 
 #ifdef NX_NAT_ENABLE_REPLACEMENT
+UINT                      index;
+UINT                      insert_index = 0;
 NX_NAT_TRANSLATION_ENTRY *insert_previous_ptr = NX_NULL;
 NX_NAT_TRANSLATION_ENTRY *entry_ptr = NX_NULL;
 NX_NAT_TRANSLATION_ENTRY *previous_ptr = NX_NULL;
@@ -3299,47 +3328,36 @@ NX_NAT_TRANSLATION_ENTRY *previous_ptr = NX_NULL;
     {
 #ifdef NX_NAT_ENABLE_REPLACEMENT
 
-        /* Get a pointer to the start of the entries in the translation table. */
-        entry_ptr = nat_ptr -> nx_nat_dynamic_active_entry_head;
-
-        /* Search the whole entry list to find the oldest non-TCP entry.  */
-        while (entry_ptr)
+        /* Search every timer wheel slot to find the oldest non-TCP entry.  */
+        for (index = 0; index < NX_NAT_TIMER_WHEEL_SIZE; index++)
         {
 
-            /* Check the entry type and protocol.  */
-            if ((entry_ptr -> translation_type == NX_NAT_STATIC_ENTRY) || (entry_ptr -> protocol == NX_PROTOCOL_TCP))
-            {
+            /* Initialize the previous pointer.  */
+            previous_ptr = NX_NULL;
 
-                /* Ingore this entry, Get the next entry in the table. */
-                previous_ptr = entry_ptr;
-                entry_ptr = entry_ptr -> next_entry_ptr;
-                continue;
-            }
-            else
-            {
+            /* Get a pointer to the start of the entries in this slot. */
+            entry_ptr = nat_ptr -> nx_nat_timer_wheel[index];
 
-                /* Check if set the insert_entry_ptr(oldest entry).  */
-                if (insert_entry_ptr == NX_NULL)
-                {
+            while (entry_ptr)
+            {
 
-                    /* Assume the first entry is the oldest entry.  */
-                    insert_entry_ptr = entry_ptr;
-                    insert_previous_ptr = previous_ptr;
-                }
-                else
+                /* Check the protocol.  */
+                if (entry_ptr -> protocol != NX_PROTOCOL_TCP)
                 {
 
-                    /* Compare the timestamp.  */
-                    if (((INT)insert_entry_ptr -> response_timestamp - (INT)entry_ptr -> response_timestamp) > 0)
+                    /* Check if set the insert_entry_ptr(oldest entry) or compare the timestamp.  */
+                    if ((insert_entry_ptr == NX_NULL) ||
+                        (((INT)insert_entry_ptr -> response_timestamp - (INT)entry_ptr -> response_timestamp) > 0))
                     {
 
                         /* entry_ptr is an older entry, so update the insert_entry_ptr.  */
                         insert_entry_ptr = entry_ptr;
                         insert_previous_ptr = previous_ptr;
+                        insert_index = index;
                     }
                 }
 
-                /* Get the next entry in the table. */
+                /* Get the next entry in the slot. */
                 previous_ptr = entry_ptr;
                 entry_ptr = entry_ptr -> next_entry_ptr;
             }
@@ -3349,7 +3367,7 @@ NX_NAT_TRANSLATION_ENTRY *previous_ptr = NX_NULL;
         if (insert_entry_ptr)
         {
 
-            /* Yes, found it. Check if this is the first entry in the list. */
+            /* Yes, found it. Check if this is the first entry in the slot. */
             if (insert_previous_ptr)
             {
 
@@ -3359,10 +3377,13 @@ NX_NAT_TRANSLATION_ENTRY *previous_ptr = NX_NULL;
             else 
             {
 
-                /* It is the first entry, so set the next pointer as the starting translation table entry. */
-                nat_ptr -> nx_nat_dynamic_active_entry_head = insert_entry_ptr -> next_entry_ptr;
+                /* It is the first entry, so set the next pointer as the start of the slot. */
+                nat_ptr -> nx_nat_timer_wheel[insert_index] = insert_entry_ptr -> next_entry_ptr;
             }
 
+            /* Remove the entry from the hash tables.  */
+            _nx_nat_entry_hash_remove(nat_ptr, insert_entry_ptr);
+
             /* Update the entry count.  */
             nat_ptr -> nx_nat_dynamic_active_entries --;
             nat_ptr -> nx_nat_dynamic_available_entries ++;
@@ -3422,14 +3443,15 @@ NX_NAT_TRANSLATION_ENTRY *previous_ptr = NX_NULL;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _nx_nat_entry_add                                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */ 
 /*                                                                        */ 
-/*   This function adds a NAT translation entry to the NAT entry list     */
+/*   This function adds a static NAT translation entry to the static      */
+/*   entry list, or a dynamic entry to the hash tables and timer wheel.   */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */       
@@ -3442,7 +3464,8 @@ NX_NAT_TRANSLATION_ENTRY *previous_ptr = NX_NULL;
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    None                                                                */ 
+/*    _nx_nat_entry_hash_insert        Add entry to hash tables           */ 
+/*    _nx_nat_entry_timer_insert       Schedule entry expiration          */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -3458,26 +3481,39 @@ NX_NAT_TRANSLATION_ENTRY *previous_ptr = NX_NULL;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            hash tables and timer wheel,*/
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_nat_entry_add(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr)
 {
 
 
-    /* Add this entry onto the table entry list.  */
-    entry_ptr -> next_entry_ptr = nat_ptr -> nx_nat_dynamic_active_entry_head;
-    nat_ptr -> nx_nat_dynamic_active_entry_head = entry_ptr;                                                                  
-
-    /* Update the entry count.  */
+    /* Check the entry type.  */
     if (entry_ptr -> translation_type == NX_NAT_DYNAMIC_ENTRY)
     {
 
+        /* Add this entry onto the inbound and outbound hash tables.  */
+        _nx_nat_entry_hash_insert(nat_ptr, entry_ptr);
+
+        /* Schedule the expiration of this entry.  */
+        _nx_nat_entry_timer_insert(nat_ptr, entry_ptr);
+
         /* Update the entry count.  */
         nat_ptr -> nx_nat_dynamic_active_entries ++;
         nat_ptr -> nx_nat_dynamic_available_entries --;
     }
-    else                                                    
+    else
+    {
+
+        /* Add this entry onto the static entry list.  */
+        entry_ptr -> next_entry_ptr = nat_ptr -> nx_nat_dynamic_active_entry_head;
+        nat_ptr -> nx_nat_dynamic_active_entry_head = entry_ptr;                                                                  
+
+        /* Update the entry count.  */
         nat_ptr -> nx_nat_static_active_entries ++;
+    }
    
     /* Return success status. */
     return(NX_SUCCESS);
@@ -3488,8 +3524,8 @@ static UINT  _nx_nat_entry_add(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_nat_entry_find                                  PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_nat_entry_find                                  PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3498,9 +3534,10 @@ static UINT  _nx_nat_entry_add(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY
 /*                                                                        */ 
 /*    This function attempts to find an entry in the NAT translation list */ 
 /*    that matches the entry submitted by the caller.  If none is found it*/
-/*    returns a null pointer. There is an option to skip entries          */
-/*    designated for local hosts accepting packets from external hosts    */
-/*    (e.g. servers).                                                     */
+/*    returns a null pointer. Dynamic entries are looked up in the hash   */
+/*    table of the direction; otherwise the static entries designated for */
+/*    local hosts accepting packets from external hosts (e.g. servers)    */
+/*    are searched.                                                       */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -3508,8 +3545,8 @@ static UINT  _nx_nat_entry_add(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY
 /*    entry_to_match              Pointer to entry to match in the list   */ 
 /*    match_entry_ptr             Pointer to matching entry in the list   */ 
 /*    direction                   Forward direction(inbound/outbound)     */
-/*    skip_inbound_init_entries   Skip entries for local hosts allowing   */ 
-/*                                   initial packet from external source  */
+/*    skip_static_entries         Search dynamic entries if NX_TRUE,      */ 
+/*                                   static entries otherwise             */
 /*                                                                        */ 
 /*  OUTPUT                                                                */ 
 /*                                                                        */ 
@@ -3518,6 +3555,7 @@ static UINT  _nx_nat_entry_add(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _nx_nat_entry_hash               Compute entry hash index           */
 /*    tx_time_get                      Get the system time                */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -3532,6 +3570,9 @@ static UINT  _nx_nat_entry_add(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            hashed dynamic entry lookup,*/
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID  _nx_nat_entry_find(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_to_match, NX_NAT_TRANSLATION_ENTRY **match_entry_ptr, 
@@ -3563,29 +3604,90 @@ NX_NAT_TRANSLATION_ENTRY    *previous_ptr;
         return ;
     }                                   
                             
+    /* Check whether to search the dynamic entries.  */
+    if (skip_static_entries == NX_TRUE)
+    {
+
+        /* Dynamic entries always specify every field, so only the hash bucket of the entry to match is searched. */
+        if (direction == NX_NAT_INBOUND_PACKET)
+        {
+
+            /* Get a pointer to the start of the inbound hash bucket. */
+            entry_ptr = nat_ptr -> nx_nat_inbound_hash_table[_nx_nat_entry_hash(entry_to_match -> peer_ip_address,
+                                                                                entry_to_match -> external_port,
+                                                                                entry_to_match -> peer_port,
+                                                                                entry_to_match -> protocol)];
+
+            /* Search the bucket until a match is found. */
+            while (entry_ptr)
+            {
+
+                /* Do protocol, external IP address and ports match? */
+                if ((entry_ptr -> protocol == entry_to_match -> protocol) &&
+                    (entry_ptr -> peer_ip_address == entry_to_match -> peer_ip_address) &&
+                    (entry_ptr -> peer_port == entry_to_match -> peer_port) &&
+                    (entry_ptr -> external_port == entry_to_match -> external_port))
+                {
+                    break;
+                }
+
+                /* Get the next entry in the bucket. */
+                entry_ptr = entry_ptr -> inbound_hash_next_ptr;
+            }
+        }
+        else
+        {
+
+            /* Get a pointer to the start of the outbound hash bucket. */
+            entry_ptr = nat_ptr -> nx_nat_outbound_hash_table[_nx_nat_entry_hash(entry_to_match -> local_ip_address ^ entry_to_match -> peer_ip_address,
+                                                                                 entry_to_match -> local_port,
+                                                                                 entry_to_match -> peer_port,
+                                                                                 entry_to_match -> protocol)];
+
+            /* Search the bucket until a match is found. */
+            while (entry_ptr)
+            {
+
+                /* Do protocol, private and external IP addresses and ports match? */
+                if ((entry_ptr -> protocol == entry_to_match -> protocol) &&
+                    (entry_ptr -> local_ip_address == entry_to_match -> local_ip_address) &&
+                    (entry_ptr -> peer_ip_address == entry_to_match -> peer_ip_address) &&
+                    (entry_ptr -> local_port == entry_to_match -> local_port) &&
+                    (entry_ptr -> peer_port == entry_to_match -> peer_port))
+                {
+                    break;
+                }
+
+                /* Get the next entry in the bucket. */
+                entry_ptr = entry_ptr -> outbound_hash_next_ptr;
+            }
+        }
+
+        /* Check if found the entry.  */
+        if (entry_ptr)
+        {
+
+            /* Set a pointer to this entry in the table. */
+            *match_entry_ptr = entry_ptr;
+
+            /* The entry is active, reset the timeout to the present. The timer wheel picks up the new
+               timestamp when the slot of this entry is processed.  */
+            entry_ptr -> response_timestamp = tx_time_get(); 
+        }
+
+        return;
+    }
+
     /* Initialize the previous pointer.  */
     previous_ptr = NX_NULL;
 
-    /* Get a pointer to the start of the entries in the translation table. */
+    /* Get a pointer to the start of the static entries. */
     entry_ptr = nat_ptr -> nx_nat_dynamic_active_entry_head;     
                                                                  
-    /* Search the whole table until a match is found. */
+    /* Search the whole list until a match is found. */
     while (entry_ptr) 
     {          
 
-        /* Check the entry type, (e.g. accepts packets from external hosts) ?*/
-        if ((entry_ptr -> translation_type == NX_NAT_STATIC_ENTRY) && (skip_static_entries == NX_TRUE))
-        {
-                        
-            /* Set the previous entry pointer.  */
-            previous_ptr = entry_ptr;
-
-            /* Ingore the static entry, get the next entry in the table. */
-            entry_ptr = entry_ptr -> next_entry_ptr;
-
-            continue;
-        }                
-
         /* Do sender and entry protocols match? */
         if (entry_ptr -> protocol != entry_to_match -> protocol)
         {
@@ -3705,8 +3807,8 @@ NX_NAT_TRANSLATION_ENTRY    *previous_ptr;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_nat_entry_timeout_check                         PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_nat_entry_timeout_check                         PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3714,7 +3816,8 @@ NX_NAT_TRANSLATION_ENTRY    *previous_ptr;
 /*  DESCRIPTION                                                           */ 
 /*                                                                        */ 
 /*    This function attempts to check the entry's timeout, and remove the */ 
-/*    expiration entries from dynamic active translation list.            */
+/*    expiration entries from dynamic active translation list. Only the   */
+/*    timer wheel slots elapsed since the last check are processed.       */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -3726,6 +3829,8 @@ NX_NAT_TRANSLATION_ENTRY    *previous_ptr;
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _nx_nat_entry_hash_remove        Remove entry from hash tables      */
+/*    _nx_nat_entry_timer_insert       Schedule entry expiration          */
 /*    tx_time_get                      Get the system time                */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -3740,6 +3845,9 @@ NX_NAT_TRANSLATION_ENTRY    *previous_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            timer wheel expiration,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID  _nx_nat_entry_timeout_check(NX_NAT_DEVICE *nat_ptr)
@@ -3747,30 +3855,46 @@ static VOID  _nx_nat_entry_timeout_check(NX_NAT_DEVICE *nat_ptr)
                                     
 ULONG                       current_time; 
 ULONG                       elapsed_time;
+ULONG                       slots;
 NX_NAT_TRANSLATION_ENTRY    *entry_ptr;  
-NX_NAT_TRANSLATION_ENTRY    *previous_ptr;   
 NX_NAT_TRANSLATION_ENTRY    *next_entry_ptr;
 
                                                                           
     /* Get the current time.  */
     current_time = tx_time_get();
 
-    /* Get a pointer to the start of the entries in the translation table. */
-    entry_ptr = nat_ptr -> nx_nat_dynamic_active_entry_head;     
+    /* Calculate the number of slots elapsed since the timer wheel was last advanced.  */
+    slots = (current_time - nat_ptr -> nx_nat_timer_wheel_tick) / NX_NAT_TIMER_WHEEL_GRANULARITY;
 
-    /* Initialize the previous pointer.  */
-    previous_ptr = NX_NULL;
+    /* Processing every slot once is enough to expire or reschedule all entries.  */
+    if (slots > NX_NAT_TIMER_WHEEL_SIZE)
+    {
 
-    /* Search thru the whole entry list. */
-    while (entry_ptr) 
+        /* Skip the revolutions in between.  */
+        nat_ptr -> nx_nat_timer_wheel_tick += (slots - NX_NAT_TIMER_WHEEL_SIZE) * NX_NAT_TIMER_WHEEL_GRANULARITY;
+        nat_ptr -> nx_nat_timer_wheel_slot = (nat_ptr -> nx_nat_timer_wheel_slot + (UINT)(slots - NX_NAT_TIMER_WHEEL_SIZE)) & NX_NAT_TIMER_WHEEL_MASK;
+        slots = NX_NAT_TIMER_WHEEL_SIZE;
+    }
+
+    /* Process the elapsed slots.  */
+    while (slots)
     {
-                                 
-        /* Set a pointer to the next entry in the table. */
-        next_entry_ptr = entry_ptr -> next_entry_ptr;
 
-        /* Check the entry type and update the time.  */
-        if (entry_ptr -> translation_type == NX_NAT_DYNAMIC_ENTRY)
-        {        
+        /* Advance the timer wheel by one slot.  */
+        nat_ptr -> nx_nat_timer_wheel_tick += NX_NAT_TIMER_WHEEL_GRANULARITY;
+        nat_ptr -> nx_nat_timer_wheel_slot = (nat_ptr -> nx_nat_timer_wheel_slot + 1) & NX_NAT_TIMER_WHEEL_MASK;
+        slots--;
+
+        /* Detach the entries of this slot.  */
+        entry_ptr = nat_ptr -> nx_nat_timer_wheel[nat_ptr -> nx_nat_timer_wheel_slot];
+        nat_ptr -> nx_nat_timer_wheel[nat_ptr -> nx_nat_timer_wheel_slot] = NX_NULL;
+
+        /* Search thru the entries of this slot. */
+        while (entry_ptr) 
+        {
+                                 
+            /* Set a pointer to the next entry in the slot. */
+            next_entry_ptr = entry_ptr -> next_entry_ptr;
 
             /* Calculate the elapsed time.  */
             elapsed_time = current_time - entry_ptr -> response_timestamp;
@@ -3779,21 +3903,8 @@ NX_NAT_TRANSLATION_ENTRY    *next_entry_ptr;
             if (elapsed_time >= entry_ptr -> response_timeout)
             {
 
-                /* Delete this entry from active entry list.  */
-
-                /* Check if this is the first entry in the list). */
-                if (previous_ptr)
-                {
-
-                    /* It is not, so link the previous entry around the entry we are deleting. */
-                    previous_ptr -> next_entry_ptr = next_entry_ptr;
-                }
-                else 
-                {
-
-                    /* It is the first entry, so set the next pointer as the starting translation table entry. */
-                    nat_ptr -> nx_nat_dynamic_active_entry_head = next_entry_ptr;
-                } 
+                /* Delete this entry from the hash tables.  */
+                _nx_nat_entry_hash_remove(nat_ptr, entry_ptr);
                        
                 /* Add the entry onto available entry list.  */ 
                 entry_ptr -> next_entry_ptr = nat_ptr -> nx_nat_dynamic_available_entry_head;
@@ -3806,23 +3917,361 @@ NX_NAT_TRANSLATION_ENTRY    *next_entry_ptr;
             else
             {    
 
-                /* Set the previous entry. */
-                previous_ptr = entry_ptr;  
+                /* The entry was active since it was scheduled, or expires in a later revolution. Reschedule it.  */
+                _nx_nat_entry_timer_insert(nat_ptr, entry_ptr);
             }
-        }         
-        else
-        {    
-
-            /* Set the previous entry. */
-            previous_ptr = entry_ptr;  
-        }            
             
-        /* Get the next entry in the table. */
-        entry_ptr = next_entry_ptr;              
-    } 
+            /* Get the next entry in the slot. */
+            entry_ptr = next_entry_ptr;              
+        } 
+    }
 
     return;
 }      
+      
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_nat_entry_hash                                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the hash table index of a translation entry  */
+/*    from its IP address, ports and protocol.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    address                           IP address(es) of the entry       */
+/*    port                              Private or global port            */
+/*    peer_port                         External host port                */
+/*    protocol                          Network protocol(TCP, UDP, ICMP)  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    index                             Hash table index                  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_nat_entry_find                Find the entry                    */
+/*    _nx_nat_entry_hash_insert         Add entry to hash tables          */
+/*    _nx_nat_entry_hash_remove         Remove entry from hash tables     */
+/*    _nx_nat_entry_port_insert         Index entry by external port      */
+/*    _nx_nat_entry_port_verify         Verify port used by entries       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT  _nx_nat_entry_hash(ULONG address, USHORT port, USHORT peer_port, UCHAR protocol)
+{
+
+ULONG   hash;
+
+
+    /* Combine the fields.  */
+    hash = address ^ (((ULONG)port << 16) | peer_port) ^ protocol;
+
+    /* Mix the bits so the low order bits depend on all fields.  */
+    hash ^= hash >> 16;
+    hash *= 0x45D9F3B;
+    hash ^= hash >> 16;
+
+    /* Return the index.  */
+    return((UINT)(hash & NX_NAT_HASH_TABLE_MASK));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_nat_entry_hash_insert                           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a dynamic translation entry to the inbound and   */
+/*    outbound hash tables.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    nat_ptr                           Pointer to NAT instance           */
+/*    entry_ptr                         Pointer to NAT translation entry  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_nat_entry_hash                Compute entry hash index          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_nat_entry_add                 Add entry to NAT table            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID  _nx_nat_entry_hash_insert(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr)
+{
+
+UINT    index;
+
+
+    /* Add the entry onto the inbound hash table, keyed by the fields of an inbound packet.  */
+    index = _nx_nat_entry_hash(entry_ptr -> peer_ip_address, entry_ptr -> external_port, entry_ptr -> peer_port, entry_ptr -> protocol);
+    entry_ptr -> inbound_hash_next_ptr = nat_ptr -> nx_nat_inbound_hash_table[index];
+    nat_ptr -> nx_nat_inbound_hash_table[index] = entry_ptr;
+
+    /* Add the entry onto the outbound hash table, keyed by the fields of an outbound packet.  */
+    index = _nx_nat_entry_hash(entry_ptr -> local_ip_address ^ entry_ptr -> peer_ip_address, entry_ptr -> local_port, entry_ptr -> peer_port, entry_ptr -> protocol);
+    entry_ptr -> outbound_hash_next_ptr = nat_ptr -> nx_nat_outbound_hash_table[index];
+    nat_ptr -> nx_nat_outbound_hash_table[index] = entry_ptr;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_nat_entry_hash_remove                           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a dynamic translation entry from the inbound, */
+/*    outbound and external port hash tables.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    nat_ptr                           Pointer to NAT instance           */
+/*    entry_ptr                         Pointer to NAT translation entry  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_nat_entry_hash                Compute entry hash index          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_nat_entry_create              Create entry in NAT table         */
+/*    _nx_nat_entry_timeout_check       Check entry timeout               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID  _nx_nat_entry_hash_remove(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr)
+{
+
+NX_NAT_TRANSLATION_ENTRY **link_ptr;
+
+
+    /* Find the link to this entry in the inbound hash bucket.  */
+    link_ptr = &(nat_ptr -> nx_nat_inbound_hash_table[_nx_nat_entry_hash(entry_ptr -> peer_ip_address, entry_ptr -> external_port, 
+                                                                         entry_ptr -> peer_port, entry_ptr -> protocol)]);
+    while ((*link_ptr) && (*link_ptr != entry_ptr))
+    {
+        link_ptr = &((*link_ptr) -> inbound_hash_next_ptr);
+    }
+
+    /* Link the previous entry around this entry.  */
+    if (*link_ptr)
+    {
+        *link_ptr = entry_ptr -> inbound_hash_next_ptr;
+    }
+
+    /* Find the link to this entry in the outbound hash bucket.  */
+    link_ptr = &(nat_ptr -> nx_nat_outbound_hash_table[_nx_nat_entry_hash(entry_ptr -> local_ip_address ^ entry_ptr -> peer_ip_address, entry_ptr -> local_port, 
+                                                                          entry_ptr -> peer_port, entry_ptr -> protocol)]);
+    while ((*link_ptr) && (*link_ptr != entry_ptr))
+    {
+        link_ptr = &((*link_ptr) -> outbound_hash_next_ptr);
+    }
+
+    /* Link the previous entry around this entry.  */
+    if (*link_ptr)
+    {
+        *link_ptr = entry_ptr -> outbound_hash_next_ptr;
+    }
+
+    /* Find the link to this entry in the external port hash bucket. Only entries for outbound sessions are there.  */
+    link_ptr = &(nat_ptr -> nx_nat_port_hash_table[_nx_nat_entry_hash(0, entry_ptr -> external_port, 0, entry_ptr -> protocol)]);
+    while ((*link_ptr) && (*link_ptr != entry_ptr))
+    {
+        link_ptr = &((*link_ptr) -> port_hash_next_ptr);
+    }
+
+    /* Link the previous entry around this entry.  */
+    if (*link_ptr)
+    {
+        *link_ptr = entry_ptr -> port_hash_next_ptr;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_nat_entry_port_insert                           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a dynamic translation entry to the external port */
+/*    hash table, so the port NAT allocated to the entry is not allocated */
+/*    again while the entry is active.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    nat_ptr                           Pointer to NAT instance           */
+/*    entry_ptr                         Pointer to NAT translation entry  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_nat_entry_hash                Compute entry hash index          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_nat_outbound_entry_find       Find outbound entry in entry list */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID  _nx_nat_entry_port_insert(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr)
+{
+
+UINT    index;
+
+
+    /* Add the entry onto the external port hash table.  */
+    index = _nx_nat_entry_hash(0, entry_ptr -> external_port, 0, entry_ptr -> protocol);
+    entry_ptr -> port_hash_next_ptr = nat_ptr -> nx_nat_port_hash_table[index];
+    nat_ptr -> nx_nat_port_hash_table[index] = entry_ptr;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_nat_entry_timer_insert                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a dynamic translation entry to the timer wheel   */
+/*    slot in which it expires. Entries expiring beyond one revolution of */
+/*    the wheel are rescheduled when their slot is processed.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    nat_ptr                           Pointer to NAT instance           */
+/*    entry_ptr                         Pointer to NAT translation entry  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_nat_entry_add                 Add entry to NAT table            */
+/*    _nx_nat_entry_timeout_check       Check entry timeout               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID  _nx_nat_entry_timer_insert(NX_NAT_DEVICE *nat_ptr, NX_NAT_TRANSLATION_ENTRY *entry_ptr)
+{
+
+LONG    remaining_time;
+ULONG   slots;
+UINT    index;
+
+
+    /* Calculate the time from the current slot until the entry expires.  */
+    remaining_time = (LONG)(entry_ptr -> response_timestamp + entry_ptr -> response_timeout - nat_ptr -> nx_nat_timer_wheel_tick);
+
+    /* Check if the entry already expired.  */
+    if (remaining_time <= 0)
+    {
+
+        /* Process it in the next slot.  */
+        slots = 1;
+    }
+    else
+    {
+
+        /* Round up so the entry is not processed before it expires.  */
+        slots = ((ULONG)remaining_time + NX_NAT_TIMER_WHEEL_GRANULARITY - 1) / NX_NAT_TIMER_WHEEL_GRANULARITY;
+
+        /* Limit to one revolution of the wheel.  */
+        if (slots >= NX_NAT_TIMER_WHEEL_SIZE)
+        {
+            slots = NX_NAT_TIMER_WHEEL_SIZE - 1;
+        }
+    }
+
+    /* Add the entry onto the slot.  */
+    index = (nat_ptr -> nx_nat_timer_wheel_slot + (UINT)slots) & NX_NAT_TIMER_WHEEL_MASK;
+    entry_ptr -> next_entry_ptr = nat_ptr -> nx_nat_timer_wheel[index];
+    nat_ptr -> nx_nat_timer_wheel[index] = entry_ptr;
+}
+
 
 
 /**************************************************************************/ 
@@ -4043,7 +4492,7 @@ UINT                    is_icmp_error_msg;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _nx_nat_find_available_port                         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -4069,7 +4518,8 @@ UINT                    is_icmp_error_msg;
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    None                                                                */ 
+/*    _nx_nat_entry_port_verify        Verify port used by entries        */ 
+/*    _nx_nat_socket_port_verify       Verify port used by sockets        */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -4082,70 +4532,59 @@ UINT                    is_icmp_error_msg;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            rotating port allocation,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_nat_find_available_port(NX_NAT_DEVICE *nat_ptr, UCHAR protocol, USHORT *port)
 {
 
 UINT                     bound;
+UINT                     count;
 USHORT                   start_port;
 USHORT                   end_port;
-NX_NAT_TRANSLATION_ENTRY *entry_ptr;  
+USHORT                  *next_port_ptr;
 
 
-    /* Start at the lowest of number for translated query ID/port for NAT. */
+    /* Get the range of translated query ID/port for NAT. */
     if (protocol == NX_PROTOCOL_TCP)
     {
         start_port = NX_NAT_START_TCP_PORT;
         end_port = NX_NAT_END_TCP_PORT;
+        next_port_ptr = &(nat_ptr -> nx_nat_next_tcp_port);
     }
     else if(protocol == NX_PROTOCOL_UDP)
     {      
         start_port = NX_NAT_START_UDP_PORT;
         end_port = NX_NAT_END_UDP_PORT;
+        next_port_ptr = &(nat_ptr -> nx_nat_next_udp_port);
     }
     else
     {           
         start_port = NX_NAT_START_ICMP_QUERY_ID;
         end_port = NX_NAT_END_ICMP_QUERY_ID;
+        next_port_ptr = &(nat_ptr -> nx_nat_next_icmp_query_id);
     }
 
-    /* Set the start port.  */
-    *port = start_port;
-
-    /* Search for a Query ID not found in the translation table. */
-    while(*port < end_port)
+    /* Search each port of the range at most once, starting after the port allocated last time.  */
+    for (count = (UINT)(end_port - start_port); count > 0; count--)
     {             
 
-        /* Initialize the bound flag. */
-        bound = NX_FALSE;
-
-        /* Serach dynamic entries.  */   
-        entry_ptr = nat_ptr -> nx_nat_dynamic_active_entry_head;
-
-        /* Loop through the whole translation table. */
-        while(entry_ptr)
+        /* Pick up the next port, wrapping to the start of the range.  */
+        *port = *next_port_ptr;
+        if ((*port < start_port) || (*port >= end_port))
         {
+            *port = start_port;
+        }
 
-            /* Check the protocol.  */
-            if (entry_ptr -> protocol == protocol)
-            {
-
-                /* Does this entry have a matching port ID. */
-                if (entry_ptr -> external_port == *port)
-                {
-
-                    /* Set the flag so we can abort the current search. */
-                    bound = NX_TRUE;
-                    break;
-                }
-            }
+        /* Bump the next port up one. */
+        *next_port_ptr = (USHORT)(*port + 1);
 
-            /* Get the next entry in the table. */
-            entry_ptr = entry_ptr -> next_entry_ptr;
-        }
+        /* Check whether this port has been used by NAT entry.  */
+        bound = _nx_nat_entry_port_verify(nat_ptr -> nx_nat_ip_ptr, protocol, *port);
                           
-        /* Check if we got through the entire table with no bound port. */
+        /* Check if no entry uses this port. */
         if ((bound == NX_FALSE) && 
             ((protocol == NX_PROTOCOL_TCP) || (protocol == NX_PROTOCOL_UDP)))
         {       
@@ -4163,22 +4602,20 @@ NX_NAT_TRANSLATION_ENTRY *entry_ptr;
         }
 
         /* Found a match. This port is not available.  */
-
-        /* Bump the port up one. */
-        (*port)++;
     }
 
     /* If we got here we could not find a free port. */
     return (NX_NAT_NO_FREE_PORT_AVAILABLE);
-}                                                             
+}
+                                                             
              
 
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_nat_entry_port_verify                           PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_nat_entry_port_verify                           PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -4186,8 +4623,8 @@ NX_NAT_TRANSLATION_ENTRY *entry_ptr;
 /*  DESCRIPTION                                                           */ 
 /*                                                                        */ 
 /*    This function verifies whether the supplied port is bound. lookup   */ 
-/*    all NAT translation entries, If same ports are found, return        */ 
-/*    NX_TRUE, else return NX_FALSE.                                      */
+/*    the static entries and the external port hash table, If same ports  */ 
+/*    are found, return NX_TRUE, else return NX_FALSE.                    */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*                                                                        */ 
@@ -4203,7 +4640,7 @@ NX_NAT_TRANSLATION_ENTRY *entry_ptr;
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
-/*    none                                                                */ 
+/*    _nx_nat_entry_hash                    Compute entry hash index      */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -4216,47 +4653,60 @@ NX_NAT_TRANSLATION_ENTRY *entry_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            external port hash lookup,  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT  _nx_nat_entry_port_verify(NX_IP *ip_ptr, UINT protocol, UINT port)
 {
 
-UINT                bound;  
 NX_NAT_TRANSLATION_ENTRY *entry_ptr;
 
     NX_PARAMETER_NOT_USED(ip_ptr);
 
-    /* Initialize the return value.  */
-    bound = NX_FALSE;
-
-    /* Serach dynamic entries.  */   
+    /* Search static entries.  */   
     entry_ptr = nat_server_ptr -> nx_nat_dynamic_active_entry_head;
 
-    /* Loop through the whole translation table. */
+    /* Loop through the static entries. */
     while(entry_ptr)
     {
 
-        /* Check the protocol.  */
-        if (entry_ptr -> protocol == protocol)
+        /* Does this entry have a matching protocol and port ID. */
+        if ((entry_ptr -> protocol == protocol) && (entry_ptr -> external_port == port))
         {
 
-            /* Does this entry have a matching port ID. */
-            if (entry_ptr -> external_port == port)
-            {
-
-                /* Set the flag so we can abort the current search. */
-                bound = NX_TRUE;
-                break;
-            }
+            /* The port is bound.  */
+            return(NX_TRUE);
         }
 
-        /* Get the next entry in the table. */
+        /* Get the next entry in the list. */
         entry_ptr = entry_ptr -> next_entry_ptr;
     }         
 
+    /* Search dynamic entries allocated this port. Entries created for static entries use the port of the static entry.  */   
+    entry_ptr = nat_server_ptr -> nx_nat_port_hash_table[_nx_nat_entry_hash(0, (USHORT)port, 0, (UCHAR)protocol)];
+
+    /* Loop through the hash bucket. */
+    while(entry_ptr)
+    {
+
+        /* Does this entry have a matching protocol and port ID. */
+        if ((entry_ptr -> protocol == protocol) && (entry_ptr -> external_port == port))
+        {
+
+            /* The port is bound.  */
+            return(NX_TRUE);
+        }
+
+        /* Get the next entry in the bucket. */
+        entry_ptr = entry_ptr -> port_hash_next_ptr;
+    }         
+
     /* Return status to the caller.  */
-    return(bound);
+    return(NX_FALSE);
 }
+
      
 
 /**************************************************************************/ 
@@ -4485,7 +4935,7 @@ NX_ICMP_HEADER  *icmp_header_ptr;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _nx_nat_checksum_adjust                             PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -4495,7 +4945,7 @@ NX_ICMP_HEADER  *icmp_header_ptr;
 /*   This function is an optimization for recomputing a checksum by just  */
 /*   computing the difference where a small amount of data has changed.   */
 /*   NAT uses this optimization when, for example, it is only changing an */
-/*   IP address or port.                                                  */
+/*   IP address or port. The data is processed in 16-bit words.           */
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
 /*    old_checksum                       Pointer to the old checksum      */
@@ -4529,12 +4979,15 @@ NX_ICMP_HEADER  *icmp_header_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            RFC 1624 word arithmetic,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID  _nx_nat_checksum_adjust(UCHAR *checksum, UCHAR *old_data, INT old_data_length, UCHAR *new_data, INT new_data_length)
 {
 
-LONG    x, old_value, new_value;
+ULONG   sum;
 INT     i,j;     
 
 #ifdef NX_LITTLE_ENDIAN
@@ -4545,72 +4998,41 @@ INT     i,j;
     j = 1;
 #endif
 
-    /* Checksum Adjustment, RFC 3022, Section 4.2, Page 9.  */
+    /* Checksum Adjustment, RFC 1624, Section 3, Eqn. 3: HC' = ~(~HC + ~m + m').
+       The checksum and data are 16-bit words in host byte order. The carries are
+       accumulated and folded once at the end.  */
 
-    /* Get the old checksum.  */
-    x = checksum[i] * 256 + checksum[j];
-    x = ~x & 0xFFFF;
+    /* Get the one's complement of the old checksum.  */
+    sum = ~((ULONG)checksum[i] << 8 | checksum[j]) & NX_LOWER_16_MASK;
 
-    /* Update the checksum for old data.  */
-    while (old_data_length)
+    /* Add the one's complement of the old data.  */
+    while (old_data_length > 0)
     {
-
-        /* Get the old data.  */
-        old_value = old_data[i] * 256 + old_data[j];
-
-        /* Update the old data pointer.  */
+        sum += ~((ULONG)old_data[i] << 8 | old_data[j]) & NX_LOWER_16_MASK;
         old_data += 2;
-
-        /* Update the checksum.  */
-        x -= old_value & 0xFFFF;
-
-        /* Check the value.  */
-        if (x <= 0)
-        {
-
-            /* Update the value.  */
-            x --;
-            x &= 0xFFFF;
-        }
-
-        /* Update the old data length.  */
         old_data_length -= 2;
     }
 
-    /* Update the checksum for new data.  */
-    while (new_data_length)
+    /* Add the new data.  */
+    while (new_data_length > 0)
     {
-
-        /* Get the new data.  */
-        new_value = new_data[i] * 256 + new_data[j];
-
-        /* Update the new data pointer.  */
+        sum += (ULONG)new_data[i] << 8 | new_data[j];
         new_data += 2;
-
-        /* Update the checksum.  */
-        x += new_value & 0xFFFF;
-
-        /* Check the value.  */
-        if (x & 0x10000)
-        {
-
-            /* Update the value.  */
-            x ++;
-            x &= 0xFFFF;
-        }
-
-        /* Update the new data length.  */
         new_data_length -= 2;
     }
 
-    /* Update the value.  */
-    x = ~x & 0xFFFF;
+    /* Fold the carries back into the low 16 bits.  */
+    sum = (sum & NX_LOWER_16_MASK) + (sum >> 16);
+    sum = (sum & NX_LOWER_16_MASK) + (sum >> 16);
 
     /* Update the checksum.  */
-    checksum[i] = (UCHAR)(x /256);
-    checksum[j] = (UCHAR)(x & 0xFF);       
+    sum = ~sum & NX_LOWER_16_MASK;
+    checksum[i] = (UCHAR)(sum >> 8);
+    checksum[j] = (UCHAR)(sum & 0xFF);       
 
     /* Return.  */
     return;
 }
+
+
 #endif
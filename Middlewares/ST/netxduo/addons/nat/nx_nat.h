@@ -25,7 +25,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_nat.h                                            PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -44,6 +44,10 @@
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            hashed entry lookup and     */
+/*                                            timer wheel expiration,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -125,6 +129,30 @@ extern   "C" {
 #define NX_NAT_NON_TCP_SESSION_TIMEOUT              (240 * NX_IP_PERIODIC_RATE)
 #endif /* NX_NAT_NON_TCP_SESSION_TIMEOUT  */
 
+/* Define the number of buckets of the inbound, outbound and external port hash tables used to
+   look up translation entries. The value must be a power of two.  */
+
+#ifndef NX_NAT_HASH_TABLE_SIZE
+#define NX_NAT_HASH_TABLE_SIZE                      64
+#endif /* NX_NAT_HASH_TABLE_SIZE  */
+
+#define NX_NAT_HASH_TABLE_MASK                      (NX_NAT_HASH_TABLE_SIZE - 1)
+
+
+/* Define the number of slots and the slot granularity (ticks) of the timer wheel used to expire
+   dynamic entries. The number of slots must be a power of two. Entries expire at most one slot
+   after their timeout.  */
+
+#ifndef NX_NAT_TIMER_WHEEL_SIZE
+#define NX_NAT_TIMER_WHEEL_SIZE                     32
+#endif /* NX_NAT_TIMER_WHEEL_SIZE  */
+
+#define NX_NAT_TIMER_WHEEL_MASK                     (NX_NAT_TIMER_WHEEL_SIZE - 1)
+
+#ifndef NX_NAT_TIMER_WHEEL_GRANULARITY
+#define NX_NAT_TIMER_WHEEL_GRANULARITY              NX_IP_PERIODIC_RATE
+#endif /* NX_NAT_TIMER_WHEEL_GRANULARITY  */
+
 /* Defined, this option enables automatic replacement when NAT cache is full.
    Notice: only replace the oldest non-TCP session.  */
 /*
@@ -190,7 +218,10 @@ typedef struct NX_NAT_TRANSLATION_ENTRY_STRUCT
                       |                |
                       |----------------|
     */
-    struct NX_NAT_TRANSLATION_ENTRY_STRUCT  *next_entry_ptr;                /* Pointer to the next translation entry in table */
+    struct NX_NAT_TRANSLATION_ENTRY_STRUCT  *next_entry_ptr;                /* Pointer to the next entry in the static list, available list or timer wheel slot */
+    struct NX_NAT_TRANSLATION_ENTRY_STRUCT  *inbound_hash_next_ptr;         /* Pointer to the next entry in the inbound hash bucket */
+    struct NX_NAT_TRANSLATION_ENTRY_STRUCT  *outbound_hash_next_ptr;        /* Pointer to the next entry in the outbound hash bucket */
+    struct NX_NAT_TRANSLATION_ENTRY_STRUCT  *port_hash_next_ptr;            /* Pointer to the next entry in the external port hash bucket */
     ULONG                                   peer_ip_address;                /* IP address of an external host sending/receiving packets through NAT. */
     ULONG                                   local_ip_address;               /* IP address of the local (private) host. */ 
     USHORT                                  peer_port;                      /* Source port of an external host sending/receiving packets through NAT. */ 
@@ -217,7 +248,20 @@ typedef struct NX_NAT_DEVICE_STRUCT
     ULONG                                  forwarded_packets_sent;              /* Total number of packets sent by NAT. */        
 #endif                                                                                                                                           
     NX_NAT_TRANSLATION_ENTRY               *nx_nat_dynamic_available_entry_head;/* Define the head pointer of available dynamic entries list.   */
-    NX_NAT_TRANSLATION_ENTRY               *nx_nat_dynamic_active_entry_head;   /* Define the head pointer of active dynamic entries list.      */ 
+    NX_NAT_TRANSLATION_ENTRY               *nx_nat_dynamic_active_entry_head;   /* Define the head pointer of active static entries list. The name is kept for compatibility; active dynamic entries are on the timer wheel. */ 
+    NX_NAT_TRANSLATION_ENTRY               *nx_nat_inbound_hash_table[NX_NAT_HASH_TABLE_SIZE];
+                                                                                /* Dynamic entries hashed by peer address, peer and external port.  */
+    NX_NAT_TRANSLATION_ENTRY               *nx_nat_outbound_hash_table[NX_NAT_HASH_TABLE_SIZE];
+                                                                                /* Dynamic entries hashed by local and peer address and port.       */
+    NX_NAT_TRANSLATION_ENTRY               *nx_nat_port_hash_table[NX_NAT_HASH_TABLE_SIZE];
+                                                                                /* Dynamic entries hashed by the external port NAT allocated.       */
+    NX_NAT_TRANSLATION_ENTRY               *nx_nat_timer_wheel[NX_NAT_TIMER_WHEEL_SIZE];
+                                                                                /* Active dynamic entries, by expiration slot.                      */
+    ULONG                                  nx_nat_timer_wheel_tick;             /* Time of the last processed timer wheel slot.                 */
+    UINT                                   nx_nat_timer_wheel_slot;             /* Index of the last processed timer wheel slot.                */
+    USHORT                                 nx_nat_next_tcp_port;                /* Next TCP port to try for outbound packets.                   */
+    USHORT                                 nx_nat_next_udp_port;                /* Next UDP port to try for outbound packets.                   */
+    USHORT                                 nx_nat_next_icmp_query_id;           /* Next ICMP query identifier to try for outbound packets.      */
     UINT                                   nx_nat_dynamic_available_entries;    /* Define the number of available dynamic entries.              */  
     UINT                                   nx_nat_dynamic_active_entries;       /* Define the number of active dynamic entries.                 */        
     UINT                                   nx_nat_static_active_entries;        /* Define the number of active static entries.                  */                        
@@ -25,8 +25,8 @@
 /*                                                                        */ 
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */ 
 /*                                                                        */ 
-/*    nx_ppp.h                                            PORTABLE C      */  
-/*                                                           6.1.2        */
+/*    nx_ppp.h                                            PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -49,6 +49,10 @@
 /*                                            improved packet length      */
 /*                                            verification,               */
 /*                                            resulting in version 6.1.2  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            slice-by-4 FCS and bulk     */
+/*                                            serial buffer copy,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -96,6 +100,11 @@ extern   "C" {
 #define NX_PPP_DISABLE_PAP
 */
 
+/* If defined, the FCS is computed one byte at a time with a single 512 byte lookup table
+   instead of four bytes at a time with four tables (2KB of constant data).
+#define NX_PPP_DISABLE_FCS_SLICE_BY_4
+*/
+
 /* If defined, the primary DNS address request option is not set in NAKed list. 
 #define NX_PPP_DNS_OPTION_DISABLE
 */
@@ -813,6 +822,8 @@ void    _nx_ppp_ipcp_terminate_ack_send(NX_PPP *ppp_ptr);
 void    _nx_ppp_packet_transmit(NX_PPP *ppp_ptr, NX_PACKET *packet_ptr);
 UINT    _nx_ppp_check_crc(NX_PACKET *packet_ptr);
 UINT    _nx_ppp_crc_append(NX_PACKET *packet_ptr, UCHAR crc[2]);
+USHORT  _nx_ppp_fcs_update(USHORT fcs, UCHAR *data_ptr, ULONG length);
+ULONG   _nx_ppp_serial_buffer_run_copy(NX_PPP *ppp_ptr, UCHAR *destination_ptr, ULONG max_length);
 void    _nx_ppp_debug_log_capture(NX_PPP *ppp_ptr, UCHAR packet_type, NX_PACKET *packet_ptr);
 void    _nx_ppp_debug_log_capture_protocol(NX_PPP *ppp_ptr);
 void    _nx_ppp_hash_generator(unsigned char *hvalue,  unsigned char id, unsigned char *secret,  unsigned char *rand_value, UINT length);
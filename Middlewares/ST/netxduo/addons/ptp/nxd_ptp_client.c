@@ -411,6 +411,66 @@ static VOID _nx_ptp_msg_parse_announce(UCHAR *ptr, NX_PTP_CLIENT_MASTER *master)
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ptp_msg_parse_correction                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function gets the correction field of a PTP message header in  */
+/*    nanoseconds. Corrections of one second or more are ignored.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hdr                                   Pointer to PTP message header */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    correction                            Correction in nanoseconds     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ptp_client_process_event_packet   Process PTP event packet      */
+/*    _nx_ptp_client_process_general_packet Process PTP general packet    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static LONG _nx_ptp_msg_parse_correction(NX_PTP_MSG_HEADER *hdr)
+{
+LONG correction;
+
+    /* the correction field is a signed number of nanoseconds multiplied by 2^16,
+       ignore values that do not fit in the nanosecond range */
+    if (((LONG)hdr -> cFieldHigh >= 0x4000) || ((LONG)hdr -> cFieldHigh < -0x4000))
+    {
+        return(0);
+    }
+
+    correction = (LONG)((hdr -> cFieldHigh << 16) | (hdr -> cFieldLow >> 16));
+    if ((correction >= NX_PTP_NANOSECONDS_PER_SEC) || (correction <= -NX_PTP_NANOSECONDS_PER_SEC))
+    {
+        return(0);
+    }
+
+    return(correction);
+}
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -587,7 +647,7 @@ NX_PTP_CLIENT *client_ptr = (NX_PTP_CLIENT *)(socket_ptr -> nx_udp_socket_reserv
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_ptp_client_clock_adjust                         PORTABLE C      */
-/*                                                           6.1.3        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -616,12 +676,16 @@ NX_PTP_CLIENT *client_ptr = (NX_PTP_CLIENT *)(socket_ptr -> nx_udp_socket_reserv
 /*  CALLED BY                                                             */
 /*                                                                        */
 /*    _nx_ptp_client_delay_resp_received    Process delay response        */
+/*    _nx_ptp_client_clock_servo            Run the clock servo           */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  12-31-2020     Yuxin Zhou               Initial Version 6.1.3         */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            clock servo,                */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID _nx_ptp_client_clock_adjust(NX_PTP_CLIENT *client_ptr, NX_PTP_TIME *offset_ptr)
@@ -674,6 +738,196 @@ NX_PTP_TIME current;
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ptp_client_time_correct                         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a correction in nanoseconds to a PTP timestamp.  */
+/*    It is used to apply the residence time of transparent clocks.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    time_ptr                              Pointer to PTP time           */
+/*    correction                            Correction in nanoseconds     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ptp_client_utility_inc64          Increment a 64-bit number     */
+/*    _nx_ptp_client_utility_dec64          Decrement a 64-bit number     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ptp_client_sync_received          Process Sync message          */
+/*    _nx_ptp_client_delay_resp_received    Process delay response        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_ptp_client_time_correct(NX_PTP_TIME *time_ptr, LONG correction)
+{
+
+    /* add the correction to the nanoseconds */
+    time_ptr -> nanosecond += correction;
+
+    /* ensure nanosecond field is in range 0-999999999 */
+    while (time_ptr -> nanosecond < 0)
+    {
+        time_ptr -> nanosecond += NX_PTP_NANOSECONDS_PER_SEC;
+        _nx_ptp_client_utility_dec64(&time_ptr -> second_high, &time_ptr -> second_low);
+    }
+    while (time_ptr -> nanosecond >= NX_PTP_NANOSECONDS_PER_SEC)
+    {
+        time_ptr -> nanosecond -= NX_PTP_NANOSECONDS_PER_SEC;
+        _nx_ptp_client_utility_inc64(&time_ptr -> second_high, &time_ptr -> second_low);
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ptp_client_clock_servo                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function implements the clock servo. The first measurement     */
+/*    from a master steps the clock. A following measurement whose path   */
+/*    delay is well above the filtered path delay is rejected, and only   */
+/*    the estimated drift is compensated. Otherwise the clock is adjusted */
+/*    by a proportional part of the offset plus an integral term that     */
+/*    estimates the clock drift over one measurement interval. Offsets    */
+/*    above the step threshold step the clock and restart the drift       */
+/*    estimation.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to PTP client         */
+/*    offset                                Offset to master, in ns       */
+/*    delay                                 Mean path delay, in ns        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ptp_client_clock_adjust           Adjust PTP clock              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ptp_client_delay_resp_received    Process delay response        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_ptp_client_clock_servo(NX_PTP_CLIENT *client_ptr, LONG offset, LONG delay)
+{
+NX_PTP_TIME adjust;
+LONG        drift;
+
+    adjust.second_high = 0;
+    adjust.second_low = 0;
+
+    if (client_ptr -> nx_ptp_client_servo_state == NX_PTP_CLIENT_SERVO_UNLOCKED)
+    {
+
+        /* first measurement from this master, step the clock to the master time
+           and start the path delay filter from this measurement */
+        client_ptr -> nx_ptp_client_servo_delay = delay;
+        client_ptr -> nx_ptp_client_servo_drift = 0;
+        client_ptr -> nx_ptp_client_servo_outliers = 0;
+        client_ptr -> nx_ptp_client_servo_state = NX_PTP_CLIENT_SERVO_LOCKED;
+        adjust.nanosecond = offset;
+    }
+    else
+    {
+
+        /* reject the measurement if its path delay is well above the filtered delay,
+           the timestamps were likely taken after queuing in the network or the stack */
+        if ((delay - client_ptr -> nx_ptp_client_servo_delay) > NX_PTP_CLIENT_SERVO_OUTLIER_THRESHOLD)
+        {
+            if (client_ptr -> nx_ptp_client_servo_outliers < NX_PTP_CLIENT_SERVO_OUTLIER_LIMIT)
+            {
+                client_ptr -> nx_ptp_client_servo_outliers++;
+                NX_PTP_DEBUG_PRINTF(("PTP: reject delay %d ns\r\n", (INT)delay));
+
+                /* keep compensating the estimated drift until the next measurement */
+                if (client_ptr -> nx_ptp_client_servo_drift != 0)
+                {
+                    adjust.nanosecond = client_ptr -> nx_ptp_client_servo_drift;
+                    _nx_ptp_client_clock_adjust(client_ptr, &adjust);
+                }
+                return(NX_NOT_SUCCESSFUL);
+            }
+
+            /* persistent change of the path delay, restart the filter */
+            client_ptr -> nx_ptp_client_servo_delay = delay;
+        }
+        client_ptr -> nx_ptp_client_servo_outliers = 0;
+
+        /* update the filtered path delay */
+        client_ptr -> nx_ptp_client_servo_delay +=
+            (delay - client_ptr -> nx_ptp_client_servo_delay) / NX_PTP_CLIENT_SERVO_DELAY_FILTER;
+
+        if ((offset > NX_PTP_CLIENT_SERVO_STEP_THRESHOLD) || (offset < -NX_PTP_CLIENT_SERVO_STEP_THRESHOLD))
+        {
+
+            /* offset too large for the servo, step the clock and restart the drift estimation */
+            client_ptr -> nx_ptp_client_servo_drift = 0;
+            adjust.nanosecond = offset;
+        }
+        else
+        {
+
+            /* integral term, the drift of the clock over one measurement interval */
+            drift = client_ptr -> nx_ptp_client_servo_drift + offset / NX_PTP_CLIENT_SERVO_KI_DIVISOR;
+            if (drift > NX_PTP_CLIENT_SERVO_MAX_DRIFT)
+            {
+                drift = NX_PTP_CLIENT_SERVO_MAX_DRIFT;
+            }
+            else if (drift < -NX_PTP_CLIENT_SERVO_MAX_DRIFT)
+            {
+                drift = -NX_PTP_CLIENT_SERVO_MAX_DRIFT;
+            }
+            client_ptr -> nx_ptp_client_servo_drift = drift;
+
+            /* proportional term plus the drift compensation */
+            adjust.nanosecond = (offset / NX_PTP_CLIENT_SERVO_KP_DIVISOR) + drift;
+        }
+    }
+
+    /* adjust the client clock */
+    _nx_ptp_client_clock_adjust(client_ptr, &adjust);
+
+    return(NX_SUCCESS);
+}
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -836,7 +1090,7 @@ NX_INTERFACE     *if_ptr;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_ptp_client_sync_received                        PORTABLE C      */
-/*                                                           6.1.3        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -850,6 +1104,7 @@ NX_INTERFACE     *if_ptr;
 /*    client_ptr                            Pointer to PTP client         */
 /*    ts_ptr                                Pointer to the timestamp      */
 /*                                           delivered by the Sync message*/
+/*    correction                            Correction of the Sync message*/
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -858,6 +1113,7 @@ NX_INTERFACE     *if_ptr;
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_ptp_msg_parse_timestamp           Parse timestamp field         */
+/*    _nx_ptp_client_time_correct           Apply correction to timestamp */
 /*    _nx_ptp_client_send_delay_req         Send delay request            */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -870,15 +1126,22 @@ NX_INTERFACE     *if_ptr;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  12-31-2020     Yuxin Zhou               Initial Version 6.1.3         */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            transparent clock           */
+/*                                            correction,                 */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nx_ptp_client_sync_received(NX_PTP_CLIENT *client_ptr, VOID *ts_ptr)
+static VOID _nx_ptp_client_sync_received(NX_PTP_CLIENT *client_ptr, VOID *ts_ptr, LONG correction)
 {
     NX_PTP_DEBUG_PRINTF(("PTP: rcv SYNC\r\n"));
 
     /* store Sync master timestamp */
     _nx_ptp_msg_parse_timestamp(ts_ptr, &client_ptr -> nx_ptp_client_sync);
 
+    /* add the residence time of the Sync message in transparent clocks */
+    _nx_ptp_client_time_correct(&client_ptr -> nx_ptp_client_sync, correction);
+
     /* delay and offset determination */
     if (client_ptr -> nx_ptp_client_delay_req_flag)
     {
@@ -898,7 +1161,7 @@ static VOID _nx_ptp_client_sync_received(NX_PTP_CLIENT *client_ptr, VOID *ts_ptr
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_ptp_client_delay_resp_received                  PORTABLE C      */
-/*                                                           6.1.5        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -913,6 +1176,8 @@ static VOID _nx_ptp_client_sync_received(NX_PTP_CLIENT *client_ptr, VOID *ts_ptr
 /*    ts_ptr                                Pointer to the timestamp      */
 /*                                           delivered by the Delay Resp  */
 /*                                           message                      */
+/*    correction                            Correction of the Delay Resp  */
+/*                                           message                      */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -921,6 +1186,8 @@ static VOID _nx_ptp_client_sync_received(NX_PTP_CLIENT *client_ptr, VOID *ts_ptr
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_ptp_client_clock_adjust           Adjust PTP clock              */
+/*    _nx_ptp_client_clock_servo            Run the clock servo           */
+/*    _nx_ptp_client_time_correct           Apply correction to timestamp */
 /*    _nx_ptp_msg_parse_timestamp           Parse timestamp field         */
 /*    _nx_ptp_client_utility_time_diff      Diff two PTP times            */
 /*    _nx_ptp_client_utility_time_div_by_2  Divide a PTP time by 2        */
@@ -937,12 +1204,18 @@ static VOID _nx_ptp_client_sync_received(NX_PTP_CLIENT *client_ptr, VOID *ts_ptr
 /*  03-02-2021     Yuxin Zhou               Modified comment(s), and      */
 /*                                            fixed compiler warnings,    */
 /*                                            resulting in version 6.1.5  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            clock servo and transparent */
+/*                                            clock correction,           */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-static VOID _nx_ptp_client_delay_resp_received(NX_PTP_CLIENT *client_ptr, VOID *ts_ptr)
+static VOID _nx_ptp_client_delay_resp_received(NX_PTP_CLIENT *client_ptr, VOID *ts_ptr, LONG correction)
 {
 NX_PTP_TIME t4, a, b;
 NX_PTP_CLIENT_SYNC sync;
+LONG delay = 0;
+UINT delay_valid = NX_FALSE;
 
     NX_PTP_DEBUG_PRINTF(("PTP: rcv DELAY_RESP\r\n"));
 
@@ -959,6 +1232,8 @@ NX_PTP_CLIENT_SYNC sync;
      *
      * delay  = (A + B) / 2
      * offset = (B - A) / 2
+     *
+     * t1 and t4 include the correction of the Sync and Delay_Req messages
      */
 
     /* check for valid timestamp t1 */
@@ -971,12 +1246,23 @@ NX_PTP_CLIENT_SYNC sync;
     /* get master clock timestamp */
     _nx_ptp_msg_parse_timestamp(ts_ptr, &t4);
 
+    /* remove the residence time of the Delay_Req message in transparent clocks */
+    _nx_ptp_client_time_correct(&t4, -correction);
+
     /* compute A = t2 - t1 */
     _nx_ptp_client_utility_time_diff(&client_ptr -> nx_ptp_client_sync_ts, &client_ptr -> nx_ptp_client_sync, &a);
 
     /* compute B = t4 - t3 */
     _nx_ptp_client_utility_time_diff(&t4, &client_ptr -> nx_ptp_client_delay_ts, &b);
 
+    /* compute delay = (A + B) / 2 when both are less than 1s */
+    if ((a.second_low == 0) && (a.second_high == 0) &&
+        (b.second_low == 0) && (b.second_high == 0))
+    {
+        delay = (a.nanosecond / 2) + (b.nanosecond / 2);
+        delay_valid = NX_TRUE;
+    }
+
     /* compute offset = (B - A) / 2 */
     _nx_ptp_client_utility_time_diff(&b, &a, &a);
     _nx_ptp_client_utility_time_div_by_2(&a);
@@ -1004,7 +1290,25 @@ NX_PTP_CLIENT_SYNC sync;
 #endif
 
     /* add the time offset the client clock */
-    _nx_ptp_client_clock_adjust(client_ptr, &a);
+    if (delay_valid && (a.second_low == 0) && (a.second_high == 0))
+    {
+
+        /* offset less than 1s, run the clock servo */
+        if (_nx_ptp_client_clock_servo(client_ptr, a.nanosecond, delay) != NX_SUCCESS)
+        {
+
+            /* measurement rejected, wait for next one */
+            client_ptr -> nx_ptp_client_delay_state = NX_PTP_CLIENT_DELAY_IDLE;
+            return;
+        }
+    }
+    else
+    {
+
+        /* offset greater than 1s, set the clock and restart the servo */
+        client_ptr -> nx_ptp_client_servo_state = NX_PTP_CLIENT_SERVO_UNLOCKED;
+        _nx_ptp_client_clock_adjust(client_ptr, &a);
+    }
 
     /* set calibrated flag */
     if (!(client_ptr -> nx_ptp_client_sync_flags & NX_PTP_CLIENT_SYNC_CALIBRATED))
@@ -1032,7 +1336,7 @@ NX_PTP_CLIENT_SYNC sync;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_ptp_client_announce_received                    PORTABLE C      */
-/*                                                           6.1.3        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -1065,6 +1369,9 @@ NX_PTP_CLIENT_SYNC sync;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  12-31-2020     Yuxin Zhou               Initial Version 6.1.3         */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            clock servo restart,        */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID _nx_ptp_client_announce_received(NX_PTP_CLIENT *client_ptr,
@@ -1106,6 +1413,9 @@ NX_PTP_CLIENT_MASTER master;
         client_ptr -> nx_ptp_client_delay_req_timer = -1;
         client_ptr -> nx_ptp_client_delay_req_flag = 1;
 
+        /* restart the clock servo for the new master */
+        client_ptr -> nx_ptp_client_servo_state = NX_PTP_CLIENT_SERVO_UNLOCKED;
+
 
         /* call application callback */
         if (client_ptr -> nx_ptp_client_event_callback)
@@ -1152,7 +1462,7 @@ NX_PTP_CLIENT_MASTER master;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_ptp_client_process_event_packet                 PORTABLE C      */
-/*                                                           6.1.3        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -1174,6 +1484,7 @@ NX_PTP_CLIENT_MASTER master;
 /*                                                                        */
 /*    _nx_ptp_client_sync_received          Process Sync message          */
 /*    _nx_ptp_msg_parse_hdr                 Parse PTP header              */
+/*    _nx_ptp_msg_parse_correction          Parse correction field        */
 /*    memcmp                                Compare memory                */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -1185,6 +1496,10 @@ NX_PTP_CLIENT_MASTER master;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  12-31-2020     Yuxin Zhou               Initial Version 6.1.3         */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            transparent clock           */
+/*                                            correction,                 */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID _nx_ptp_client_process_event_packet(NX_PTP_CLIENT *client_ptr, NX_PACKET *packet_ptr)
@@ -1232,12 +1547,14 @@ NX_PTP_MSG_HEADER hdr;
         /* wait for follow up message */
         client_ptr -> nx_ptp_client_state = NX_PTP_CLIENT_STATE_WAIT_FOLLOW_UP;
         client_ptr -> nx_ptp_client_sync_id = hdr.sequenceId;
+        client_ptr -> nx_ptp_client_sync_correction = _nx_ptp_msg_parse_correction(&hdr);
     }
     else
     {
 
         /* process Sync event */
-        _nx_ptp_client_sync_received(client_ptr, packet_ptr -> nx_packet_prepend_ptr);
+        _nx_ptp_client_sync_received(client_ptr, packet_ptr -> nx_packet_prepend_ptr,
+                                     _nx_ptp_msg_parse_correction(&hdr));
     }
 }
 
@@ -1247,7 +1564,7 @@ NX_PTP_MSG_HEADER hdr;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_ptp_client_process_general_packet               PORTABLE C      */
-/*                                                           6.1.3        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -1269,6 +1586,7 @@ NX_PTP_MSG_HEADER hdr;
 /*                                                                        */
 /*    _nx_ptp_client_sync_received          Process Sync message          */
 /*    _nx_ptp_msg_parse_hdr                 Parse PTP header              */
+/*    _nx_ptp_msg_parse_correction          Parse correction field        */
 /*    _nx_ptp_client_delay_resp_received    Process delay response        */
 /*    _nx_ptp_client_announce_received      Process Announce message      */
 /*    memcmp                                Compare memory                */
@@ -1282,6 +1600,10 @@ NX_PTP_MSG_HEADER hdr;
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  12-31-2020     Yuxin Zhou               Initial Version 6.1.3         */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            transparent clock           */
+/*                                            correction,                 */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID _nx_ptp_client_process_general_packet(NX_PTP_CLIENT *client_ptr, NX_PACKET *packet_ptr)
@@ -1328,8 +1650,10 @@ NX_PTP_MSG_HEADER hdr;
             return;
         }
 
-        /* process Sync message */
-        _nx_ptp_client_sync_received(client_ptr, packet_ptr -> nx_packet_prepend_ptr);
+        /* process Sync message, the correction is the sum of Sync and Follow_Up corrections */
+        _nx_ptp_client_sync_received(client_ptr, packet_ptr -> nx_packet_prepend_ptr,
+                                     client_ptr -> nx_ptp_client_sync_correction +
+                                     _nx_ptp_msg_parse_correction(&hdr));
     }
     else if (hdr.messageType == NX_PTP_MSG_TYPE_DELAY_RESP)
     {
@@ -1346,7 +1670,8 @@ NX_PTP_MSG_HEADER hdr;
         }
 
         /* process delay response message */
-        _nx_ptp_client_delay_resp_received(client_ptr, packet_ptr -> nx_packet_prepend_ptr);
+        _nx_ptp_client_delay_resp_received(client_ptr, packet_ptr -> nx_packet_prepend_ptr,
+                                           _nx_ptp_msg_parse_correction(&hdr));
     }
 }
 
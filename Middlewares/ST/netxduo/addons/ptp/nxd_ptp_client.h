@@ -24,7 +24,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nxd_ptp_client.h                                    PORTABLE C      */
-/*                                                           6.1.3        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -39,6 +39,9 @@
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  12-31-2020     Yuxin Zhou               Initial Version 6.1.3         */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            clock servo,                */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -106,6 +109,56 @@ extern   "C" {
 #endif
 
 
+/* Define the clock servo gains. The clock is adjusted by the offset divided by
+   the proportional divisor plus the integral term, which accumulates the offset
+   divided by the integral divisor.  */
+
+#ifndef NX_PTP_CLIENT_SERVO_KP_DIVISOR
+#define NX_PTP_CLIENT_SERVO_KP_DIVISOR         2
+#endif
+
+#ifndef NX_PTP_CLIENT_SERVO_KI_DIVISOR
+#define NX_PTP_CLIENT_SERVO_KI_DIVISOR         8
+#endif
+
+
+/* Define the maximum clock drift compensated by the servo, in nanoseconds
+   per delay measurement.  */
+
+#ifndef NX_PTP_CLIENT_SERVO_MAX_DRIFT
+#define NX_PTP_CLIENT_SERVO_MAX_DRIFT          500000
+#endif
+
+
+/* Define the offset in nanoseconds above which the clock is stepped
+   instead of being adjusted by the servo.  */
+
+#ifndef NX_PTP_CLIENT_SERVO_STEP_THRESHOLD
+#define NX_PTP_CLIENT_SERVO_STEP_THRESHOLD     1000000
+#endif
+
+
+/* Define the outlier rejection of the servo. A measurement whose path delay
+   exceeds the filtered path delay by more than the threshold (in nanoseconds)
+   is discarded, up to the limit of consecutive discarded measurements.  */
+
+#ifndef NX_PTP_CLIENT_SERVO_OUTLIER_THRESHOLD
+#define NX_PTP_CLIENT_SERVO_OUTLIER_THRESHOLD  100000
+#endif
+
+#ifndef NX_PTP_CLIENT_SERVO_OUTLIER_LIMIT
+#define NX_PTP_CLIENT_SERVO_OUTLIER_LIMIT      3
+#endif
+
+
+/* Define the weight of the path delay filter, expressed as the inverse of the
+   weight given to a new measurement.  */
+
+#ifndef NX_PTP_CLIENT_SERVO_DELAY_FILTER
+#define NX_PTP_CLIENT_SERVO_DELAY_FILTER       8
+#endif
+
+
 /* Set maximum queue depth for client socket.*/
 
 #ifndef NX_PTP_CLIENT_MAX_QUEUE_DEPTH    
@@ -262,6 +315,12 @@ typedef struct NX_PTP_CLIENT_SYNC_STRUCT
 #define NX_PTP_CLIENT_DELAY_WAIT_RESP      2
 
 
+/* Define the state of the clock servo */
+
+#define NX_PTP_CLIENT_SERVO_UNLOCKED       0
+#define NX_PTP_CLIENT_SERVO_LOCKED         1
+
+
 /* Define the structure of a PTP Client */
 
 typedef struct NX_PTP_CLIENT_STRUCT
@@ -342,6 +401,9 @@ typedef struct NX_PTP_CLIENT_STRUCT
     /* The id of the sync message */
     USHORT                       nx_ptp_client_sync_id;
 
+    /* The correction field of a two-step sync message */
+    LONG                         nx_ptp_client_sync_correction;
+
     /* The id of the last delay_req message */
     USHORT                       nx_ptp_client_delay_req_id;
 
@@ -360,6 +422,18 @@ typedef struct NX_PTP_CLIENT_STRUCT
     /* The delay request packet pointer */
     NX_PACKET                   *nx_ptp_client_delay_req_packet_ptr;
 
+    /* The state of the clock servo */
+    UINT                         nx_ptp_client_servo_state;
+
+    /* The number of consecutive measurements rejected by the servo */
+    UINT                         nx_ptp_client_servo_outliers;
+
+    /* The filtered mean path delay, in nanoseconds */
+    LONG                         nx_ptp_client_servo_delay;
+
+    /* The estimated clock drift per delay measurement, in nanoseconds */
+    LONG                         nx_ptp_client_servo_drift;
+
     /* The PTP client timer */
     TX_TIMER                     nx_ptp_client_timer;
 
@@ -2659,6 +2659,986 @@ UINT        temp_password_length;
 #endif /* NX_SNMP_DISABLE_V3 */
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_snmp_agent_mib_table_set                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the SNMP agent MIB table set     */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    agent_ptr                             Pointer to SNMP agent         */
+/*    mib_table                             Pointer to MIB table          */
+/*    mib_entries                           Number of MIB table entries   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_table_set          Actual agent MIB table set    */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_snmp_agent_mib_table_set(NX_SNMP_AGENT *agent_ptr, NX_SNMP_MIB_ENTRY *mib_table, UINT mib_entries)
+{
+
+UINT    i;
+UINT    status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((agent_ptr == NX_NULL) || (agent_ptr -> nx_snmp_agent_id != NX_SNMP_ID) ||
+        ((mib_table == NX_NULL) && (mib_entries != 0)))
+        return(NX_PTR_ERROR);
+
+    /* Check that each entry has a valid object name.  */
+    for (i = 0; i < mib_entries; i++)
+    {
+
+        /* Check the object name.  */
+        if ((mib_table[i].nx_snmp_mib_entry_object_name == NX_NULL) ||
+            (_nx_utility_string_length_check((CHAR *)mib_table[i].nx_snmp_mib_entry_object_name, NX_NULL, NX_SNMP_MAX_OCTET_STRING)))
+            return(NX_SNMP_ERROR);
+    }
+
+    /* Call actual service.  */
+    status =  _nx_snmp_agent_mib_table_set(agent_ptr, mib_table, mib_entries);
+
+    /* Return status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_table_set                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function registers a MIB table with the SNMP agent.  The table */
+/*    is sorted in place by object ID, so GET, GETNEXT, GETBULK and SET   */
+/*    requests for its objects are resolved by the agent with a binary    */
+/*    search instead of by the application callbacks.  Objects not in the */
+/*    table are still passed to the application callbacks, and a GETNEXT  */
+/*    returns an application object that sorts before the next table      */
+/*    entry.                                                              */
+/*                                                                        */
+/*    Note: an entry may supply a cache buffer if its object value never  */
+/*    changes.  The agent then saves the encoded variable in the buffer   */
+/*    and copies it into later responses.  The table must not be modified */
+/*    while the agent is processing requests.  Set the number of entries  */
+/*    to zero to remove the table.                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    agent_ptr                             Pointer to SNMP agent         */
+/*    mib_table                             Pointer to MIB table          */
+/*    mib_entries                           Number of MIB table entries   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_object_compare     Compare object IDs            */
+/*    memcpy                                Copy MIB table entry          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_snmp_agent_mib_table_set(NX_SNMP_AGENT *agent_ptr, NX_SNMP_MIB_ENTRY *mib_table, UINT mib_entries)
+{
+
+UINT                i, j;
+NX_SNMP_MIB_ENTRY   temp_entry;
+
+
+    /* Sort the table by object ID.  An insertion sort is used since MIB tables are
+       normally defined in order, in which case no entry needs to be moved.  */
+    for (i = 1; i < mib_entries; i++)
+    {
+
+        /* Determine if this entry is already in order.  */
+        if (_nx_snmp_agent_mib_object_compare(mib_table[i - 1].nx_snmp_mib_entry_object_name,
+                                              mib_table[i].nx_snmp_mib_entry_object_name) <= 0)
+        {
+
+            /* Yes, move to the next entry.  */
+            continue;
+        }
+
+        /* Save this entry.  */
+        memcpy(&temp_entry, &mib_table[i], sizeof(NX_SNMP_MIB_ENTRY)); /* Use case of memcpy is verified. */
+
+        /* Move the larger entries up by one.  */
+        j =  i;
+        while ((j > 0) && (_nx_snmp_agent_mib_object_compare(mib_table[j - 1].nx_snmp_mib_entry_object_name,
+                                                             temp_entry.nx_snmp_mib_entry_object_name) > 0))
+        {
+            memcpy(&mib_table[j], &mib_table[j - 1], sizeof(NX_SNMP_MIB_ENTRY)); /* Use case of memcpy is verified. */
+            j--;
+        }
+
+        /* Place the saved entry in its position.  */
+        memcpy(&mib_table[j], &temp_entry, sizeof(NX_SNMP_MIB_ENTRY)); /* Use case of memcpy is verified. */
+    }
+
+    /* Invalidate any encoded variables cached by the entries.  */
+    for (i = 0; i < mib_entries; i++)
+    {
+        mib_table[i].nx_snmp_mib_entry_cache_object_length =  0;
+        mib_table[i].nx_snmp_mib_entry_cache_data_length =  0;
+    }
+
+    /* Save the table in the agent.  */
+    agent_ptr -> nx_snmp_agent_mib_table =    mib_table;
+    agent_ptr -> nx_snmp_agent_mib_entries =  mib_entries;
+    agent_ptr -> nx_snmp_agent_mib_cursor =   NX_NULL;
+    agent_ptr -> nx_snmp_agent_mib_current =  NX_NULL;
+    agent_ptr -> nx_snmp_agent_mib_callback_next_valid =  NX_FALSE;
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_object_compare                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function compares two object ID strings numerically, one       */
+/*    sub-identifier at a time, which gives the lexicographic order of    */
+/*    the object IDs used by GETNEXT requests.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    object1                               Pointer to first object ID    */
+/*    object2                               Pointer to second object ID   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    result                                Less than, equal to or        */
+/*                                            greater than zero           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_table_set          Set agent MIB table           */
+/*    _nx_snmp_agent_mib_find               Find MIB table entry          */
+/*    _nx_snmp_agent_mib_getnext            Agent MIB GETNEXT processing  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+INT  _nx_snmp_agent_mib_object_compare(UCHAR *object1, UCHAR *object2)
+{
+
+UINT    length1;
+UINT    length2;
+UINT    i;
+
+
+    /* Loop to compare the object IDs one sub-identifier at a time.  */
+    while (1)
+    {
+
+        /* Pickup the number of digits in each sub-identifier.  */
+        length1 =  0;
+        while ((object1[length1] >= '0') && (object1[length1] <= '9'))
+            length1++;
+        length2 =  0;
+        while ((object2[length2] >= '0') && (object2[length2] <= '9'))
+            length2++;
+
+        /* The sub-identifier with more digits has the larger value.  */
+        if (length1 != length2)
+            return((length1 < length2) ? -1 : 1);
+
+        /* Otherwise compare the digits, most significant first.  */
+        for (i = 0; i < length1; i++)
+        {
+            if (object1[i] != object2[i])
+                return((object1[i] < object2[i]) ? -1 : 1);
+        }
+
+        /* Move to the separators.  */
+        object1 =  object1 + length1;
+        object2 =  object2 + length2;
+
+        /* Determine if the separators differ.  An object ID that ends first
+           is a prefix of the other one and is ordered first.  */
+        if (*object1 != *object2)
+        {
+            if (*object1 == NX_NULL)
+                return(-1);
+            if (*object2 == NX_NULL)
+                return(1);
+            return((*object1 < *object2) ? -1 : 1);
+        }
+
+        /* Determine if both object IDs are complete.  */
+        if (*object1 == NX_NULL)
+            return(0);
+
+        /* Move past the separators.  */
+        object1++;
+        object2++;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_find                             PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function searches the MIB table of the agent for the first     */
+/*    entry whose object ID is not less than the requested object.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    agent_ptr                             Pointer to SNMP agent         */
+/*    object_requested                      Pointer to requested object   */
+/*    index                                 Pointer to the entry index    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_SUCCESS                            Entry matches the object      */
+/*    NX_SNMP_NEXT_ENTRY                    Entry follows the object      */
+/*    NX_SNMP_ENTRY_END                     No entry follows the object   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_object_compare     Compare object IDs            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_get                Agent MIB GET processing      */
+/*    _nx_snmp_agent_mib_getnext            Agent MIB GETNEXT processing  */
+/*    _nx_snmp_agent_mib_set                Agent MIB SET processing      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_snmp_agent_mib_find(NX_SNMP_AGENT *agent_ptr, UCHAR *object_requested, UINT *index)
+{
+
+NX_SNMP_MIB_ENTRY  *mib_table;
+UINT                low;
+UINT                high;
+UINT                middle;
+
+
+    /* Setup the search bounds.  */
+    mib_table =  agent_ptr -> nx_snmp_agent_mib_table;
+    low =  0;
+    high =  agent_ptr -> nx_snmp_agent_mib_entries;
+
+    /* Binary search for the first entry that is not less than the requested object.  */
+    while (low < high)
+    {
+
+        /* Compare with the middle entry.  */
+        middle =  low + ((high - low) >> 1);
+        if (_nx_snmp_agent_mib_object_compare(mib_table[middle].nx_snmp_mib_entry_object_name, object_requested) < 0)
+            low =  middle + 1;
+        else
+            high =  middle;
+    }
+
+    /* Return the entry index.  */
+    *index =  low;
+
+    /* Determine if all entries are less than the requested object.  */
+    if (low == agent_ptr -> nx_snmp_agent_mib_entries)
+        return(NX_SNMP_ENTRY_END);
+
+    /* Determine if the entry is the requested object.  */
+    if (_nx_snmp_agent_mib_object_compare(mib_table[low].nx_snmp_mib_entry_object_name, object_requested) == 0)
+        return(NX_SUCCESS);
+
+    /* The entry follows the requested object.  */
+    return(NX_SNMP_NEXT_ENTRY);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_entry_get                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function gets the value of a MIB table entry by calling the    */
+/*    get function of the entry.  If the encoded variable is cached,      */
+/*    only the object type is returned.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    agent_ptr                             Pointer to SNMP agent         */
+/*    entry_ptr                             Pointer to MIB table entry    */
+/*    object_data                           Pointer to object data        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_snmp_mib_entry_get_callback        Entry get function            */
+/*    nx_snmp_mib_entry_get_octet_callback  Entry get octet function      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_get                Agent MIB GET processing      */
+/*    _nx_snmp_agent_mib_getnext            Agent MIB GETNEXT processing  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_snmp_agent_mib_entry_get(NX_SNMP_AGENT *agent_ptr, NX_SNMP_MIB_ENTRY *entry_ptr, NX_SNMP_OBJECT_DATA *object_data)
+{
+
+UINT    status;
+
+
+    /* Remember the entry so its encoding can be cached or reused.  */
+    agent_ptr -> nx_snmp_agent_mib_current =  entry_ptr;
+
+    /* Determine if the variable encoding is cached.  */
+    if (entry_ptr -> nx_snmp_mib_entry_cache_data_length)
+    {
+
+        /* Yes, the value is not needed.  Just pickup the type for validation,
+           which is the first byte of the encoded value.  */
+        object_data -> nx_snmp_object_data_type =
+            entry_ptr -> nx_snmp_mib_entry_cache[entry_ptr -> nx_snmp_mib_entry_cache_object_length];
+
+        /* Return success.  */
+        return(NX_SUCCESS);
+    }
+
+    /* Determine if the entry has a get function.  */
+    if (entry_ptr -> nx_snmp_mib_entry_get_callback)
+    {
+
+        /* Yes, call the get function.  */
+        status =  (entry_ptr -> nx_snmp_mib_entry_get_callback)(entry_ptr -> nx_snmp_mib_entry_value_ptr, object_data);
+    }
+    else if (entry_ptr -> nx_snmp_mib_entry_get_octet_callback)
+    {
+
+        /* Yes, call the get octet function.  */
+        status =  (entry_ptr -> nx_snmp_mib_entry_get_octet_callback)(entry_ptr -> nx_snmp_mib_entry_value_ptr, object_data,
+                                                                      entry_ptr -> nx_snmp_mib_entry_length);
+    }
+    else
+    {
+
+        /* No get function, return no access.  */
+        status =  NX_SNMP_ERROR_NOACCESS;
+    }
+
+    /* Return status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_get                              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes a GET of a variable.  The variable is       */
+/*    looked up in the MIB table of the agent, otherwise the application  */
+/*    GET callback routine is called.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    agent_ptr                             Pointer to SNMP agent         */
+/*    object_requested                      Pointer to requested object   */
+/*    object_data                           Pointer to object data        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_find               Find MIB table entry          */
+/*    _nx_snmp_agent_mib_entry_get          Get MIB table entry value     */
+/*    nx_snmp_agent_get_process             Application GET routine       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_snmp_version_1_process            SNMP v1 message processing    */
+/*    _nx_snmp_version_2_process            SNMP v2 message processing    */
+/*    _nx_snmp_version_3_process            SNMP v3 message processing    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_snmp_agent_mib_get(NX_SNMP_AGENT *agent_ptr, UCHAR *object_requested, NX_SNMP_OBJECT_DATA *object_data)
+{
+
+UINT    index;
+
+
+    /* Clear the current entry.  */
+    agent_ptr -> nx_snmp_agent_mib_current =  NX_NULL;
+
+    /* Search the MIB table for the requested object.  */
+    if (_nx_snmp_agent_mib_find(agent_ptr, object_requested, &index) == NX_SUCCESS)
+    {
+
+        /* Found it, remember the entry for a subsequent GETNEXT.  */
+        agent_ptr -> nx_snmp_agent_mib_cursor =  &(agent_ptr -> nx_snmp_agent_mib_table[index]);
+        agent_ptr -> nx_snmp_agent_mib_callback_next_valid =  NX_FALSE;
+
+        /* Get the object.  */
+        return(_nx_snmp_agent_mib_entry_get(agent_ptr, &(agent_ptr -> nx_snmp_agent_mib_table[index]), object_data));
+    }
+
+    /* Not in the MIB table, call the application's GET routine.  */
+    return((agent_ptr -> nx_snmp_agent_get_process)(agent_ptr, object_requested, object_data));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_getnext                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes a GETNEXT of a variable, which is also      */
+/*    used for each variable of a GETBULK request.  If the requested      */
+/*    object is the entry returned last, the following entry is used      */
+/*    directly.  Otherwise the MIB table is searched.                     */
+/*                                                                        */
+/*    The application GETNEXT callback routine may serve objects that     */
+/*    sort between table entries, so the object it returns next is        */
+/*    compared with the table entry and the lower of the two is used.     */
+/*    The object the callback returns after a table entry is remembered   */
+/*    with the cursor, so a walk over the table does not call the         */
+/*    callback again until the walk passes that object.  After the last   */
+/*    entry of the table, the callback routine is called directly.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    agent_ptr                             Pointer to SNMP agent         */
+/*    object_requested                      Pointer to requested object   */
+/*    object_data                           Pointer to object data        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_object_compare     Compare object IDs            */
+/*    _nx_snmp_agent_mib_find               Find MIB table entry          */
+/*    _nx_snmp_agent_mib_entry_get          Get MIB table entry value     */
+/*    _nx_utility_string_length_check       Check string length           */
+/*    nx_snmp_agent_getnext_process         Application GETNEXT routine   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_snmp_version_1_process            SNMP v1 message processing    */
+/*    _nx_snmp_version_2_process            SNMP v2 message processing    */
+/*    _nx_snmp_version_3_process            SNMP v3 message processing    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_snmp_agent_mib_getnext(NX_SNMP_AGENT *agent_ptr, UCHAR *object_requested, NX_SNMP_OBJECT_DATA *object_data)
+{
+
+UINT                index;
+UINT                length;
+UINT                status;
+UINT                cursor_match;
+UCHAR              *callback_next;
+NX_SNMP_MIB_ENTRY  *entry_ptr;
+
+
+    /* Clear the current entry.  */
+    agent_ptr -> nx_snmp_agent_mib_current =  NX_NULL;
+
+    /* Pickup the entry returned last.  */
+    entry_ptr =  agent_ptr -> nx_snmp_agent_mib_cursor;
+
+    /* Determine if the requested object is the entry returned last.  This is
+       the case for each repetition of a GETBULK request and for a GETNEXT walk,
+       so the next entry is found without searching.  */
+    cursor_match =  NX_FALSE;
+    if ((entry_ptr != NX_NULL) &&
+        (_nx_snmp_agent_mib_object_compare(entry_ptr -> nx_snmp_mib_entry_object_name, object_requested) == 0))
+    {
+
+        /* Yes, use the entry that follows.  */
+        index =  (UINT)(entry_ptr - agent_ptr -> nx_snmp_agent_mib_table) + 1;
+        cursor_match =  NX_TRUE;
+    }
+    else
+    {
+
+        /* Search the MIB table for the first entry following the requested object.  */
+        if (_nx_snmp_agent_mib_find(agent_ptr, object_requested, &index) == NX_SUCCESS)
+            index++;
+    }
+
+    /* Determine if there is a next entry in the MIB table.  */
+    if (index >= agent_ptr -> nx_snmp_agent_mib_entries)
+    {
+
+        /* No, clear the cursor.  */
+        agent_ptr -> nx_snmp_agent_mib_cursor =  NX_NULL;
+        agent_ptr -> nx_snmp_agent_mib_callback_next_valid =  NX_FALSE;
+
+        /* Call the application's GETNEXT routine.  */
+        return((agent_ptr -> nx_snmp_agent_getnext_process)(agent_ptr, object_requested, object_data));
+    }
+
+    /* Pickup the next entry.  */
+    entry_ptr =  &(agent_ptr -> nx_snmp_agent_mib_table[index]);
+
+    /* Find the object the application's GETNEXT routine returns after the requested object, unless
+       it is already known from the previous step of the walk.  An empty name means there is none.  */
+    callback_next =  agent_ptr -> nx_snmp_agent_mib_callback_next;
+    if ((!cursor_match) || (!agent_ptr -> nx_snmp_agent_mib_callback_next_valid))
+    {
+
+        /* Check the object name length.  */
+        if (_nx_utility_string_length_check((CHAR *)object_requested, &length, NX_SNMP_MAX_OCTET_STRING))
+            return(NX_SNMP_ERROR_GENERAL);
+
+        /* Call the application's GETNEXT routine on a copy of the requested object.  */
+        memcpy(callback_next, object_requested, length + 1); /* Use case of memcpy is verified. */
+        status =  (agent_ptr -> nx_snmp_agent_getnext_process)(agent_ptr, callback_next, object_data);
+
+        /* Only an object that follows the requested one counts.  */
+        if ((status != NX_SUCCESS) || (object_data -> nx_snmp_object_data_type == NX_SNMP_END_OF_MIB_VIEW) ||
+            (_nx_snmp_agent_mib_object_compare(callback_next, object_requested) <= 0))
+        {
+            callback_next[0] =  NX_NULL;
+        }
+
+        /* Determine if the application object comes before the table entry.  */
+        if ((callback_next[0] != NX_NULL) &&
+            (_nx_snmp_agent_mib_object_compare(callback_next, entry_ptr -> nx_snmp_mib_entry_object_name) < 0))
+        {
+
+            /* Yes, return it.  The object data has already been filled in by the application.  */
+            if (_nx_utility_string_length_check((CHAR *)callback_next, &length, NX_SNMP_MAX_OCTET_STRING))
+                return(NX_SNMP_ERROR_GENERAL);
+            memcpy(object_requested, callback_next, length + 1); /* Use case of memcpy is verified. */
+            agent_ptr -> nx_snmp_agent_mib_cursor =  NX_NULL;
+            agent_ptr -> nx_snmp_agent_mib_callback_next_valid =  NX_FALSE;
+            return(NX_SUCCESS);
+        }
+    }
+    else if ((callback_next[0] != NX_NULL) &&
+             (_nx_snmp_agent_mib_object_compare(callback_next, entry_ptr -> nx_snmp_mib_entry_object_name) < 0))
+    {
+
+        /* The remembered application object comes before the table entry, get it from the application.  */
+        agent_ptr -> nx_snmp_agent_mib_cursor =  NX_NULL;
+        agent_ptr -> nx_snmp_agent_mib_callback_next_valid =  NX_FALSE;
+        return((agent_ptr -> nx_snmp_agent_getnext_process)(agent_ptr, object_requested, object_data));
+    }
+
+    /* The table entry comes first.  The application object found, if any, also follows the
+       table entry, so remember it for the next step of the walk.  */
+    agent_ptr -> nx_snmp_agent_mib_callback_next_valid =  NX_TRUE;
+
+    /* Check the object name length.  */
+    if (_nx_utility_string_length_check((CHAR *)entry_ptr -> nx_snmp_mib_entry_object_name, &length, NX_SNMP_MAX_OCTET_STRING))
+        return(NX_SNMP_ERROR_GENERAL);
+
+    /* Copy the name of the next object into the request.  */
+    memcpy(object_requested, entry_ptr -> nx_snmp_mib_entry_object_name, length + 1); /* Use case of memcpy is verified. */
+
+    /* Remember the entry for the next request.  */
+    agent_ptr -> nx_snmp_agent_mib_cursor =  entry_ptr;
+
+    /* Get the object.  */
+    status =  _nx_snmp_agent_mib_entry_get(agent_ptr, entry_ptr, object_data);
+
+    /* Determine if the object data indicates an end-of-mib condition.  */
+    if ((status == NX_SUCCESS) && (object_data -> nx_snmp_object_data_type == NX_SNMP_END_OF_MIB_VIEW) &&
+        (entry_ptr -> nx_snmp_mib_entry_value_ptr != NX_NULL))
+    {
+
+        /* Return the object name supplied in the entry value.  */
+        if (_nx_utility_string_length_check((CHAR *)entry_ptr -> nx_snmp_mib_entry_value_ptr, &length, NX_SNMP_MAX_OCTET_STRING))
+            return(NX_SNMP_ERROR_GENERAL);
+        memcpy(object_requested, entry_ptr -> nx_snmp_mib_entry_value_ptr, length + 1); /* Use case of memcpy is verified. */
+    }
+
+    /* Return status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_set                              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes a SET of a variable.  The variable is       */
+/*    looked up in the MIB table of the agent, otherwise the application  */
+/*    SET callback routine is called.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    agent_ptr                             Pointer to SNMP agent         */
+/*    object_requested                      Pointer to requested object   */
+/*    object_data                           Pointer to object data        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_find               Find MIB table entry          */
+/*    nx_snmp_mib_entry_set_callback        Entry set function            */
+/*    nx_snmp_agent_set_process             Application SET routine       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_snmp_version_1_process            SNMP v1 message processing    */
+/*    _nx_snmp_version_2_process            SNMP v2 message processing    */
+/*    _nx_snmp_version_3_process            SNMP v3 message processing    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_snmp_agent_mib_set(NX_SNMP_AGENT *agent_ptr, UCHAR *object_requested, NX_SNMP_OBJECT_DATA *object_data)
+{
+
+UINT                index;
+NX_SNMP_MIB_ENTRY  *entry_ptr;
+
+
+    /* Clear the current entry.  The response carries the value from the request.  */
+    agent_ptr -> nx_snmp_agent_mib_current =  NX_NULL;
+
+    /* Search the MIB table for the requested object.  */
+    if (_nx_snmp_agent_mib_find(agent_ptr, object_requested, &index) != NX_SUCCESS)
+    {
+
+        /* Not in the MIB table, call the application's SET routine.  */
+        return((agent_ptr -> nx_snmp_agent_set_process)(agent_ptr, object_requested, object_data));
+    }
+
+    /* Pickup the entry.  */
+    entry_ptr =  &(agent_ptr -> nx_snmp_agent_mib_table[index]);
+
+    /* Determine if the entry has a set function.  */
+    if (entry_ptr -> nx_snmp_mib_entry_set_callback == NX_NULL)
+    {
+
+        /* No set function, return no access.  */
+        return(NX_SNMP_ERROR_NOACCESS);
+    }
+
+    /* The value changes, invalidate the cached encoding.  */
+    entry_ptr -> nx_snmp_mib_entry_cache_object_length =  0;
+    entry_ptr -> nx_snmp_mib_entry_cache_data_length =  0;
+
+    /* Call the set function.  */
+    return((entry_ptr -> nx_snmp_mib_entry_set_callback)(entry_ptr -> nx_snmp_mib_entry_value_ptr, object_data));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_object_id_set                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places the object ID of the current variable into     */
+/*    the response buffer.  The encoding is copied from the cache of the  */
+/*    MIB table entry when present, and saved in it otherwise.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    agent_ptr                             Pointer to SNMP agent         */
+/*    buffer_ptr                            Pointer to response buffer    */
+/*    object_string                         Pointer to object ID string   */
+/*    buffer_end                            Pointer to end of buffer      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    size                                  Size of encoded object ID,    */
+/*                                            zero on error               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_snmp_utility_object_id_set        Encode object ID              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_snmp_version_1_process            SNMP v1 message processing    */
+/*    _nx_snmp_version_2_process            SNMP v2 message processing    */
+/*    _nx_snmp_version_3_process            SNMP v3 message processing    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_snmp_agent_mib_object_id_set(NX_SNMP_AGENT *agent_ptr, UCHAR *buffer_ptr, UCHAR *object_string, UCHAR *buffer_end)
+{
+
+UINT                length;
+NX_SNMP_MIB_ENTRY  *entry_ptr;
+
+
+    /* Pickup the MIB entry of the current variable.  */
+    entry_ptr =  agent_ptr -> nx_snmp_agent_mib_current;
+
+    /* Determine if the variable encoding is cached.  */
+    if ((entry_ptr != NX_NULL) && (entry_ptr -> nx_snmp_mib_entry_cache_data_length))
+    {
+
+        /* Yes, pickup the length of the encoded object ID.  */
+        length =  entry_ptr -> nx_snmp_mib_entry_cache_object_length;
+
+        /* Check for the end of the buffer.  */
+        if ((buffer_ptr + length) >= buffer_end)
+            return(0);
+
+        /* Copy the encoded object ID.  */
+        memcpy(buffer_ptr, entry_ptr -> nx_snmp_mib_entry_cache, length); /* Use case of memcpy is verified. */
+
+        /* Return the length.  */
+        return(length);
+    }
+
+    /* Encode the object ID.  */
+    length =  _nx_snmp_utility_object_id_set(buffer_ptr, object_string, buffer_end);
+
+    /* Determine if the encoding can be saved in the cache of the entry.  */
+    if ((entry_ptr != NX_NULL) && (entry_ptr -> nx_snmp_mib_entry_cache != NX_NULL) &&
+        (length) && (length < entry_ptr -> nx_snmp_mib_entry_cache_size))
+    {
+
+        /* Yes, save the encoded object ID.  */
+        memcpy(entry_ptr -> nx_snmp_mib_entry_cache, buffer_ptr, length); /* Use case of memcpy is verified. */
+        entry_ptr -> nx_snmp_mib_entry_cache_object_length =  length;
+    }
+
+    /* Return the length.  */
+    return(length);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_snmp_agent_mib_object_data_set                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places the value of the current variable into the     */
+/*    response buffer.  The encoding is copied from the cache of the MIB  */
+/*    table entry when present, and saved in it otherwise.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    agent_ptr                             Pointer to SNMP agent         */
+/*    buffer_ptr                            Pointer to response buffer    */
+/*    object_data                           Pointer to object data        */
+/*    buffer_end                            Pointer to end of buffer      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    size                                  Size of encoded value,        */
+/*                                            zero on error               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_snmp_utility_object_data_set      Encode object data            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_snmp_version_1_process            SNMP v1 message processing    */
+/*    _nx_snmp_version_2_process            SNMP v2 message processing    */
+/*    _nx_snmp_version_3_process            SNMP v3 message processing    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_snmp_agent_mib_object_data_set(NX_SNMP_AGENT *agent_ptr, UCHAR *buffer_ptr, NX_SNMP_OBJECT_DATA *object_data, UCHAR *buffer_end)
+{
+
+UINT                length;
+NX_SNMP_MIB_ENTRY  *entry_ptr;
+
+
+    /* Pickup the MIB entry of the current variable.  */
+    entry_ptr =  agent_ptr -> nx_snmp_agent_mib_current;
+
+    /* Determine if the variable encoding is cached.  */
+    if ((entry_ptr != NX_NULL) && (entry_ptr -> nx_snmp_mib_entry_cache_data_length))
+    {
+
+        /* Yes, pickup the length of the encoded value.  */
+        length =  entry_ptr -> nx_snmp_mib_entry_cache_data_length;
+
+        /* Check for the end of the buffer.  */
+        if ((buffer_ptr + length) >= buffer_end)
+            return(0);
+
+        /* Copy the encoded value.  */
+        memcpy(buffer_ptr, entry_ptr -> nx_snmp_mib_entry_cache + entry_ptr -> nx_snmp_mib_entry_cache_object_length, length); /* Use case of memcpy is verified. */
+
+        /* Return the length.  */
+        return(length);
+    }
+
+    /* Encode the value.  */
+    length =  _nx_snmp_utility_object_data_set(buffer_ptr, object_data, buffer_end);
+
+    /* Determine if the encoding can be saved after the object ID in the cache of the entry.
+       Exception values such as end-of-MIB-view are not cached.  */
+    if ((entry_ptr != NX_NULL) && (entry_ptr -> nx_snmp_mib_entry_cache_object_length) && (length) &&
+        (object_data -> nx_snmp_object_data_type < NX_SNMP_ANS1_NO_SUCH_OBJECT) &&
+        ((entry_ptr -> nx_snmp_mib_entry_cache_object_length + length) <= entry_ptr -> nx_snmp_mib_entry_cache_size))
+    {
+
+        /* Yes, save the encoded value.  The variable is now served from the cache.  */
+        memcpy(entry_ptr -> nx_snmp_mib_entry_cache + entry_ptr -> nx_snmp_mib_entry_cache_object_length, buffer_ptr, length); /* Use case of memcpy is verified. */
+        entry_ptr -> nx_snmp_mib_entry_cache_data_length =  length;
+    }
+
+    /* Return the length.  */
+    return(length);
+}
+
+
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
@@ -17186,8 +18166,8 @@ ULONG   temp;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_snmp_version_1_process                          PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_snmp_version_1_process                          PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -17208,6 +18188,11 @@ ULONG   temp;
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _nx_snmp_agent_mib_get                Agent MIB GET processing      */
+/*    _nx_snmp_agent_mib_getnext            Agent MIB GETNEXT processing  */
+/*    _nx_snmp_agent_mib_set                Agent MIB SET processing      */
+/*    _nx_snmp_agent_mib_object_data_set    Set the object data           */
+/*    _nx_snmp_agent_mib_object_id_set      Set the object ID             */
 /*    nx_packet_allocate                    Allocate response packet      */ 
 /*    nx_packet_release                     Release the packet            */ 
 /*    nx_udp_socket_send                    Send the UDP packet           */ 
@@ -17242,6 +18227,10 @@ ULONG   temp;
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), improved */
 /*                                            variable len verification,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            MIB table lookup and cached */
+/*                                            variable encoding,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_snmp_version_1_process(NX_SNMP_AGENT *agent_ptr, NX_PACKET *packet_ptr)
@@ -17882,9 +18871,9 @@ INT         buffer_length;
             /* Increment the total number of get variables.  */
             agent_ptr -> nx_snmp_agent_total_get_variables++;
 
-            /* Call the application's GET routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_get_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
-                                                               &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's GET routine.  */
+            status =  _nx_snmp_agent_mib_get(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
+                                             &(agent_ptr -> nx_snmp_agent_current_object_data));
         }
         else if (request_type == NX_SNMP_ANS1_GET_NEXT_REQUEST)
         {
@@ -17892,9 +18881,9 @@ INT         buffer_length;
             /* Increment the total number of get variables.  */
             agent_ptr -> nx_snmp_agent_total_get_variables++;
 
-            /* Call the application's GETNEXT routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_getnext_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
-                                                                   &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's GETNEXT routine.  */
+            status =  _nx_snmp_agent_mib_getnext(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
+                                                 &(agent_ptr -> nx_snmp_agent_current_object_data));
         }
         else if (request_type == NX_SNMP_ANS1_SET_REQUEST)
         {
@@ -17902,9 +18891,9 @@ INT         buffer_length;
             /* Increment the total number of set variables.  */
             agent_ptr -> nx_snmp_agent_total_set_variables++;
 
-            /* Call the application's SET routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_set_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
-                                                               &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's SET routine.  */
+            status =  _nx_snmp_agent_mib_set(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
+                                             &(agent_ptr -> nx_snmp_agent_current_object_data));
         }
         else
         {
@@ -18073,7 +19062,7 @@ INT         buffer_length;
         response_variable_list_length =  response_variable_list_length + response_length;
 
         /* Place the object into the response buffer.  */
-        response_length =  _nx_snmp_utility_object_id_set(response_buffer_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, response_packet_ptr -> nx_packet_data_end); 
+        response_length =  _nx_snmp_agent_mib_object_id_set(agent_ptr, response_buffer_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, response_packet_ptr -> nx_packet_data_end); 
 
         /* Check for a valid operation.  */
         if (response_length == 0)
@@ -18105,7 +19094,7 @@ INT         buffer_length;
         response_variable_length =  response_variable_length + response_length;
 
         /* Insert the object's data into the response buffer.  */
-        response_length =  _nx_snmp_utility_object_data_set(response_buffer_ptr, &(agent_ptr -> nx_snmp_agent_current_object_data), response_packet_ptr -> nx_packet_data_end);
+        response_length =  _nx_snmp_agent_mib_object_data_set(agent_ptr, response_buffer_ptr, &(agent_ptr -> nx_snmp_agent_current_object_data), response_packet_ptr -> nx_packet_data_end);
 
         /* Check for a valid operation.  */
         if (response_length == 0)
@@ -18201,8 +19190,8 @@ INT         buffer_length;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_snmp_version_2_process                          PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_snmp_version_2_process                          PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -18223,6 +19212,11 @@ INT         buffer_length;
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _nx_snmp_agent_mib_get                Agent MIB GET processing      */
+/*    _nx_snmp_agent_mib_getnext            Agent MIB GETNEXT processing  */
+/*    _nx_snmp_agent_mib_set                Agent MIB SET processing      */
+/*    _nx_snmp_agent_mib_object_data_set    Set the object data           */
+/*    _nx_snmp_agent_mib_object_id_set      Set the object ID             */
 /*    nx_packet_allocate                    Allocate response packet      */ 
 /*    nx_packet_release                     Release the packet            */ 
 /*    nx_udp_socket_send                    Send the UDP packet           */ 
@@ -18257,6 +19251,10 @@ INT         buffer_length;
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), improved */
 /*                                            variable len verification,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            MIB table lookup and cached */
+/*                                            variable encoding,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_snmp_version_2_process(NX_SNMP_AGENT *agent_ptr, NX_PACKET *packet_ptr)
@@ -18905,8 +19903,8 @@ INT         buffer_length;
             /* Increment the total number of get variables.  */
             agent_ptr -> nx_snmp_agent_total_get_variables++;
 
-            /* Call the application's GET routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_get_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's GET routine.  */
+            status =  _nx_snmp_agent_mib_get(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, &(agent_ptr -> nx_snmp_agent_current_object_data));
         }
         else if (request_type == NX_SNMP_ANS1_GET_NEXT_REQUEST)
         {
@@ -18914,8 +19912,8 @@ INT         buffer_length;
             /* Increment the total number of get variables.  */
             agent_ptr -> nx_snmp_agent_total_get_variables++;
 
-            /* Call the application's GETNEXT routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_getnext_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's GETNEXT routine.  */
+            status =  _nx_snmp_agent_mib_getnext(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, &(agent_ptr -> nx_snmp_agent_current_object_data));
         }
         else if (request_type == NX_SNMP_ANS1_GET_BULK_REQUEST)
         {
@@ -18926,8 +19924,8 @@ INT         buffer_length;
             /* Clear the next object flag.  */
             next_object =  NX_FALSE;
 
-            /* Call the application's GETNEXT routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_getnext_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's GETNEXT routine.  */
+            status =  _nx_snmp_agent_mib_getnext(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, &(agent_ptr -> nx_snmp_agent_current_object_data));
 
             /* Decrement the number of non-repeaters.  */
             if (non_repeaters)
@@ -18964,8 +19962,8 @@ INT         buffer_length;
             /* Increment the total number of set variables.  */
             agent_ptr -> nx_snmp_agent_total_set_variables++;
 
-            /* Call the application's SET routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_set_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's SET routine.  */
+            status =  _nx_snmp_agent_mib_set(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, &(agent_ptr -> nx_snmp_agent_current_object_data));
         }
         else
         {
@@ -19102,7 +20100,7 @@ INT         buffer_length;
         response_variable_list_length =  response_variable_list_length + response_length;
 
         /* Place the object into the response buffer.  */
-        response_length =  _nx_snmp_utility_object_id_set(response_buffer_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, response_packet_ptr -> nx_packet_data_end); 
+        response_length =  _nx_snmp_agent_mib_object_id_set(agent_ptr, response_buffer_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, response_packet_ptr -> nx_packet_data_end); 
 
         /* Check for a valid operation.  */
         if (response_length == 0)
@@ -19134,7 +20132,7 @@ INT         buffer_length;
         response_variable_length =  response_variable_length + response_length;
 
         /* Insert the object's data into the response buffer.  */
-        response_length =  _nx_snmp_utility_object_data_set(response_buffer_ptr, &(agent_ptr -> nx_snmp_agent_current_object_data), response_packet_ptr -> nx_packet_data_end);
+        response_length =  _nx_snmp_agent_mib_object_data_set(agent_ptr, response_buffer_ptr, &(agent_ptr -> nx_snmp_agent_current_object_data), response_packet_ptr -> nx_packet_data_end);
 
         /* Check for a valid operation.  */
         if (response_length == 0)
@@ -19235,8 +20233,8 @@ INT         buffer_length;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_snmp_version_3_process                          PORTABLE C      */ 
-/*                                                           6.1.6        */
+/*    _nx_snmp_version_3_process                          PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -19257,6 +20255,11 @@ INT         buffer_length;
 /*                                                                        */ 
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
+/*    _nx_snmp_agent_mib_get                Agent MIB GET processing      */
+/*    _nx_snmp_agent_mib_getnext            Agent MIB GETNEXT processing  */
+/*    _nx_snmp_agent_mib_set                Agent MIB SET processing      */
+/*    _nx_snmp_agent_mib_object_data_set    Set the object data           */
+/*    _nx_snmp_agent_mib_object_id_set      Set the object ID             */
 /*    _nx_des_encrypt                       Encrypt bytes                 */ 
 /*    _nx_des_decrypt                       Decrypt bytes                 */ 
 /*    _nx_des_key_set                       Set the DES key               */ 
@@ -19305,6 +20308,10 @@ INT         buffer_length;
 /*                                            improved boundary check,    */
 /*                                            checked NULL pointer,       */
 /*                                            resulting in version 6.1.6  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            MIB table lookup and cached */
+/*                                            variable encoding,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_snmp_version_3_process(NX_SNMP_AGENT *agent_ptr, NX_PACKET *packet_ptr)
@@ -21578,9 +22585,9 @@ INT         buffer_length;
             /* Increment the total number of get variables.  */
             agent_ptr -> nx_snmp_agent_total_get_variables++;
 
-            /* Call the application's GET routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_get_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
-                                                               &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's GET routine.  */
+            status =  _nx_snmp_agent_mib_get(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
+                                             &(agent_ptr -> nx_snmp_agent_current_object_data));
         }
         else if (request_type == NX_SNMP_ANS1_GET_NEXT_REQUEST)
         {
@@ -21588,9 +22595,9 @@ INT         buffer_length;
             /* Increment the total number of get variables.  */
             agent_ptr -> nx_snmp_agent_total_get_variables++;
 
-            /* Call the application's GETNEXT routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_getnext_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
-                                                                   &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's GETNEXT routine.  */
+            status =  _nx_snmp_agent_mib_getnext(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
+                                                 &(agent_ptr -> nx_snmp_agent_current_object_data));
         }
         else if (request_type == NX_SNMP_ANS1_GET_BULK_REQUEST)
         {
@@ -21601,9 +22608,9 @@ INT         buffer_length;
             /* Clear the next object flag.  */
             next_object =  NX_FALSE;
 
-            /* Call the application's GETNEXT routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_getnext_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
-                                                                   &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's GETNEXT routine.  */
+            status =  _nx_snmp_agent_mib_getnext(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
+                                                 &(agent_ptr -> nx_snmp_agent_current_object_data));
 
             /* Decrement the number of non-repeaters.  */
             if (non_repeaters)
@@ -21640,9 +22647,9 @@ INT         buffer_length;
             /* Increment the total number of set variables.  */
             agent_ptr -> nx_snmp_agent_total_set_variables++;
 
-            /* Call the application's SET routine.  */
-            status =  (agent_ptr -> nx_snmp_agent_set_process)(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
-                                                               &(agent_ptr -> nx_snmp_agent_current_object_data));
+            /* Call the agent MIB or the application's SET routine.  */
+            status =  _nx_snmp_agent_mib_set(agent_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, 
+                                             &(agent_ptr -> nx_snmp_agent_current_object_data));
         }
         else
         {
@@ -21794,7 +22801,7 @@ INT         buffer_length;
         response_variable_list_length =  response_variable_list_length + response_length;
 
         /* Place the object into the response buffer.  */
-        response_length =  _nx_snmp_utility_object_id_set(response_buffer_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, response_packet_ptr -> nx_packet_data_end); 
+        response_length =  _nx_snmp_agent_mib_object_id_set(agent_ptr, response_buffer_ptr, agent_ptr -> nx_snmp_agent_current_octet_string, response_packet_ptr -> nx_packet_data_end); 
 
         /* Check for a valid operation.  */
         if (response_length == 0)
@@ -21829,7 +22836,7 @@ INT         buffer_length;
         response_variable_length =  response_variable_length + response_length;
 
         /* Insert the object's data into the response buffer.  */
-        response_length =  _nx_snmp_utility_object_data_set(response_buffer_ptr, &(agent_ptr -> nx_snmp_agent_current_object_data), response_packet_ptr -> nx_packet_data_end);
+        response_length =  _nx_snmp_agent_mib_object_data_set(agent_ptr, response_buffer_ptr, &(agent_ptr -> nx_snmp_agent_current_object_data), response_packet_ptr -> nx_packet_data_end);
 
         /* Check for a valid operation.  */
         if (response_length == 0)
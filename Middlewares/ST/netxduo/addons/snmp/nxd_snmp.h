@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */ 
 /*                                                                        */ 
 /*    nxd_snmp.h                                          PORTABLE C      */ 
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -45,6 +45,9 @@
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            agent MIB table,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -382,6 +385,28 @@ typedef struct NX_SNMP_TRAP_OBJECT_STRUCT
 } NX_SNMP_TRAP_OBJECT;
 
 
+/* Define the SNMP Agent MIB table entry.  A table of these entries can be registered with the agent
+   so that requests for its objects are resolved by the agent instead of the application callbacks.  
+   The get and set functions are typically the nx_snmp_object_*_get and nx_snmp_object_*_set services.
+   An entry whose value never changes may supply a cache buffer for its encoded variable.  */
+
+typedef struct NX_SNMP_MIB_ENTRY_STRUCT
+{
+
+    UCHAR           *nx_snmp_mib_entry_object_name;                 /* Object ID string                     */
+    VOID            *nx_snmp_mib_entry_value_ptr;                   /* Pointer to object variable           */
+    UINT            (*nx_snmp_mib_entry_get_callback)(VOID *source_ptr, NX_SNMP_OBJECT_DATA *object_data);
+    UINT            (*nx_snmp_mib_entry_get_octet_callback)(VOID *source_ptr, NX_SNMP_OBJECT_DATA *object_data, UINT length);
+    UINT            (*nx_snmp_mib_entry_set_callback)(VOID *destination_ptr, NX_SNMP_OBJECT_DATA *object_data);
+    UINT            nx_snmp_mib_entry_length;                       /* Length for the get octet function    */
+    UCHAR           *nx_snmp_mib_entry_cache;                       /* Encoded variable cache, or NX_NULL   */
+    UINT            nx_snmp_mib_entry_cache_size;                   /* Size of encoded variable cache       */
+    UINT            nx_snmp_mib_entry_cache_object_length;          /* Length of cached object ID           */
+    UINT            nx_snmp_mib_entry_cache_data_length;            /* Length of cached object data         */
+
+} NX_SNMP_MIB_ENTRY;
+
+
 /* Define the SNMP Agent data structure.  */
 
 typedef struct NX_SNMP_AGENT_STRUCT 
@@ -475,6 +500,13 @@ typedef struct NX_SNMP_AGENT_STRUCT
     UINT (*nx_snmp_agent_getnext_process)(struct NX_SNMP_AGENT_STRUCT *agent_ptr, UCHAR *object_requested, NX_SNMP_OBJECT_DATA *object_data);
     UINT (*nx_snmp_agent_set_process)(struct NX_SNMP_AGENT_STRUCT *agent_ptr, UCHAR *object_requested, NX_SNMP_OBJECT_DATA *object_data);
     UINT (*nx_snmp_agent_username_process)(struct NX_SNMP_AGENT_STRUCT *agent_ptr, UCHAR *username);
+    NX_SNMP_MIB_ENTRY *nx_snmp_agent_mib_table;                     /* Pointer to sorted MIB table          */
+    UINT            nx_snmp_agent_mib_entries;                      /* Number of MIB table entries          */
+    NX_SNMP_MIB_ENTRY *nx_snmp_agent_mib_cursor;                    /* MIB table entry returned last        */
+    NX_SNMP_MIB_ENTRY *nx_snmp_agent_mib_current;                   /* MIB table entry of current variable  */
+    UINT            nx_snmp_agent_mib_callback_next_valid;          /* Callback next object is known        */
+    UCHAR           nx_snmp_agent_mib_callback_next[NX_SNMP_MAX_OCTET_STRING + 1];
+                                                                    /* Application object after the cursor  */
 
 } NX_SNMP_AGENT;
 
@@ -505,6 +537,7 @@ typedef struct NX_SNMP_AGENT_STRUCT
 #define nx_snmp_agent_current_version_get   _nx_snmp_agent_current_version_get
 #define nx_snmp_agent_version_set           _nx_snmp_agent_version_set
 #define nx_snmp_agent_set_interface         _nx_snmp_agent_set_interface
+#define nx_snmp_agent_mib_table_set         _nx_snmp_agent_mib_table_set
 #ifndef NX_SNMP_DISABLE_V3
 #define nx_snmp_agent_md5_key_create        _nx_snmp_agent_md5_key_create
 #define nx_snmp_agent_md5_key_create_extended _nx_snmp_agent_md5_key_create_extended
@@ -574,6 +607,7 @@ typedef struct NX_SNMP_AGENT_STRUCT
 #define nx_snmp_agent_current_version_get   _nxe_snmp_agent_current_version_get
 #define nx_snmp_agent_version_set           _nxe_snmp_agent_version_set
 #define nx_snmp_agent_set_interface         _nxe_snmp_agent_set_interface
+#define nx_snmp_agent_mib_table_set         _nxe_snmp_agent_mib_table_set
 #ifndef NX_SNMP_DISABLE_V3
 #define nx_snmp_agent_md5_key_create        _nxe_snmp_agent_md5_key_create
 #define nx_snmp_agent_md5_key_create_extended _nxe_snmp_agent_md5_key_create_extended
@@ -653,6 +687,7 @@ UINT    nx_snmp_agent_request_get_type_test(NX_SNMP_AGENT *agent_ptr, UINT *is_g
 UINT    nx_snmp_agent_current_version_get(NX_SNMP_AGENT *agent_ptr, UINT *version);
 UINT    nx_snmp_agent_version_set(NX_SNMP_AGENT *agent_ptr, UINT enabled_v1, UINT enable_v2, UINT enable_v3);
 UINT    nx_snmp_agent_set_interface(NX_SNMP_AGENT *agent_ptr, UINT if_index);
+UINT    nx_snmp_agent_mib_table_set(NX_SNMP_AGENT *agent_ptr, NX_SNMP_MIB_ENTRY *mib_table, UINT mib_entries);
 UINT    nx_snmp_agent_private_string_set(NX_SNMP_AGENT *agent_ptr, UCHAR *private_string);
 UINT    nx_snmp_agent_public_string_set(NX_SNMP_AGENT *agent_ptr, UCHAR *public_string);
 UINT    nx_snmp_agent_private_string_test(NX_SNMP_AGENT *agent_ptr, UCHAR *community_string, UINT *is_private);
@@ -755,6 +790,8 @@ UINT    _nx_snmp_agent_public_string_test(NX_SNMP_AGENT *agent_ptr, UCHAR *commu
 UINT    _nxe_snmp_agent_public_string_test(NX_SNMP_AGENT *agent_ptr, UCHAR *community_string, UINT *is_public);
 UINT    _nxe_snmp_agent_set_interface(NX_SNMP_AGENT *agent_ptr, UINT if_index);
 UINT    _nx_snmp_agent_set_interface(NX_SNMP_AGENT *agent_ptr, UINT if_index);
+UINT    _nx_snmp_agent_mib_table_set(NX_SNMP_AGENT *agent_ptr, NX_SNMP_MIB_ENTRY *mib_table, UINT mib_entries);
+UINT    _nxe_snmp_agent_mib_table_set(NX_SNMP_AGENT *agent_ptr, NX_SNMP_MIB_ENTRY *mib_table, UINT mib_entries);
 UINT    _nx_snmp_agent_private_string_set(NX_SNMP_AGENT *agent_ptr, UCHAR *private_string);
 UINT    _nxe_snmp_agent_private_string_set(NX_SNMP_AGENT *agent_ptr, UCHAR *private_string);
 UINT    _nx_snmp_agent_public_string_set(NX_SNMP_AGENT *agent_ptr, UCHAR *public_string);
@@ -844,6 +881,14 @@ UINT    _nxe_snmp_object_timetics_set(VOID *destination_ptr, NX_SNMP_OBJECT_DATA
 /* Define internal SNMP routines.  */
 
 VOID    _nx_snmp_agent_thread_entry(ULONG snmp_agent_address);
+INT     _nx_snmp_agent_mib_object_compare(UCHAR *object1, UCHAR *object2);
+UINT    _nx_snmp_agent_mib_find(NX_SNMP_AGENT *agent_ptr, UCHAR *object_requested, UINT *index);
+UINT    _nx_snmp_agent_mib_entry_get(NX_SNMP_AGENT *agent_ptr, NX_SNMP_MIB_ENTRY *entry_ptr, NX_SNMP_OBJECT_DATA *object_data);
+UINT    _nx_snmp_agent_mib_get(NX_SNMP_AGENT *agent_ptr, UCHAR *object_requested, NX_SNMP_OBJECT_DATA *object_data);
+UINT    _nx_snmp_agent_mib_getnext(NX_SNMP_AGENT *agent_ptr, UCHAR *object_requested, NX_SNMP_OBJECT_DATA *object_data);
+UINT    _nx_snmp_agent_mib_set(NX_SNMP_AGENT *agent_ptr, UCHAR *object_requested, NX_SNMP_OBJECT_DATA *object_data);
+UINT    _nx_snmp_agent_mib_object_id_set(NX_SNMP_AGENT *agent_ptr, UCHAR *buffer_ptr, UCHAR *object_string, UCHAR *buffer_end);
+UINT    _nx_snmp_agent_mib_object_data_set(NX_SNMP_AGENT *agent_ptr, UCHAR *buffer_ptr, NX_SNMP_OBJECT_DATA *object_data, UCHAR *buffer_end);
 UINT    _nx_snmp_utility_community_get(UCHAR *buffer_ptr, UCHAR *community_string, INT buffer_length);
 UINT    _nx_snmp_utility_community_set(UCHAR *buffer_ptr, UCHAR *community_string, UCHAR *buffer_end);
 UINT    _nx_snmp_utility_error_info_get(UCHAR *buffer_ptr, UINT *error_code, UINT *error_index, INT buffer_length);
@@ -474,6 +474,135 @@ UINT  _nxd_tftp_client_set_interface(NX_TFTP_CLIENT *tftp_client_ptr, UINT if_in
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxde_tftp_client_options_set                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the TFTP client options set      */
+/*    call.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tftp_client_ptr                       Pointer to TFTP client        */
+/*    block_size                            Block size to request         */
+/*    window_size                           Window size to request        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*    NX_PTR_ERROR                          Invalid pointer input         */
+/*    NX_INVALID_PARAMETERS                 Invalid block or window size  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_tftp_client_options_set          Actual options set call       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxde_tftp_client_options_set(NX_TFTP_CLIENT *tftp_client_ptr, UINT block_size, UINT window_size)
+{
+
+UINT    status;
+
+
+    /* Check for invalid input pointer input.  */
+    if ((tftp_client_ptr == NX_NULL) || (tftp_client_ptr -> nx_tftp_client_id != NXD_TFTP_CLIENT_ID))
+        return(NX_PTR_ERROR);
+
+    /* Check for an invalid block size or window size.  */
+    if (((block_size != 0) && ((block_size < NX_TFTP_MIN_BLOCK_SIZE) || (block_size > NX_TFTP_MAX_BLOCK_SIZE))) ||
+        (window_size > NX_TFTP_MAX_WINDOW_SIZE))
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual client options set function.  */
+    status =  _nxd_tftp_client_options_set(tftp_client_ptr, block_size, window_size);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_tftp_client_options_set                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the block size (RFC 2348) and window size        */
+/*    (RFC 7440) the TFTP client requests when it opens a file for        */
+/*    reading.  The server may reply with smaller values.  A block size   */
+/*    of 0 or 512, and a window size of 0 or 1, are not requested.        */
+/*                                                                        */
+/*    Each block is received in one packet of the IP default packet pool, */
+/*    and a window of blocks is queued on the client socket, so the       */
+/*    values requested should fit the pool and NX_TFTP_QUEUE_DEPTH.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tftp_client_ptr                       Pointer to TFTP client        */
+/*    block_size                            Block size to request         */
+/*    window_size                           Window size to request        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_SUCCESS                            Successful completion status  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxd_tftp_client_options_set(NX_TFTP_CLIENT *tftp_client_ptr, UINT block_size, UINT window_size)
+{
+
+
+    /* Save the block size and window size to request on the next open for read.  */
+    tftp_client_ptr -> nx_tftp_client_request_block_size =  block_size;
+    tftp_client_ptr -> nx_tftp_client_request_window_size = window_size;
+
+    /* Return success to the caller.  */
+    return(NX_SUCCESS);
+}
+
+
 
 /**************************************************************************/ 
 /*                                                                        */ 
@@ -1127,8 +1256,8 @@ UINT        status;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_tftp_client_file_open_internal                  PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_tftp_client_file_open_internal                  PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -1175,6 +1304,10 @@ UINT        status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            block size and window size  */
+/*                                            options,                    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_tftp_client_file_open_internal(NX_TFTP_CLIENT *tftp_client_ptr, CHAR *file_name, NXD_ADDRESS *server_ip_address, UINT open_type, ULONG wait_option, UINT  ip_type)
@@ -1183,6 +1316,10 @@ UINT  _nx_tftp_client_file_open_internal(NX_TFTP_CLIENT *tftp_client_ptr, CHAR *
 
 UINT        status;
 UINT        i;
+UINT        j;
+UINT        value;
+UINT        digits;
+CHAR        *option_name;
 NXD_ADDRESS ip_address;
 
 UINT        port;
@@ -1235,6 +1372,28 @@ UINT        matching = NX_FALSE;
     /* Specify that the first block.  */
     tftp_client_ptr -> nx_tftp_client_block_number =  1;
 
+    /* Default to the lock-step transfer of 512 byte blocks until options are acknowledged.  */
+    tftp_client_ptr -> nx_tftp_client_block_size =   NX_TFTP_FILE_TRANSFER_MAX;
+    tftp_client_ptr -> nx_tftp_client_window_size =  1;
+    tftp_client_ptr -> nx_tftp_client_window_count = 0;
+    tftp_client_ptr -> nx_tftp_client_options =      0;
+
+    /* Determine if the block size or window size options are requested on a read.  */
+    if (open_type == NX_TFTP_OPEN_FOR_READ)
+    {
+
+        if ((tftp_client_ptr -> nx_tftp_client_request_block_size != 0) && 
+            (tftp_client_ptr -> nx_tftp_client_request_block_size != NX_TFTP_FILE_TRANSFER_MAX))
+        {
+            tftp_client_ptr -> nx_tftp_client_options |=  NX_TFTP_OPTION_BLOCK_SIZE;
+        }
+
+        if (tftp_client_ptr -> nx_tftp_client_request_window_size > 1)
+        {
+            tftp_client_ptr -> nx_tftp_client_options |=  NX_TFTP_OPTION_WINDOW_SIZE;
+        }
+    }
+
     /* Allocate a packet for initial open request message. Determine whether we are sending
        IPv4 or IPv6 packets.   */
 
@@ -1301,6 +1460,59 @@ UINT        matching = NX_FALSE;
     /* Place a NULL after the mode.  */
     *buffer_ptr++ =  NX_NULL;
 
+    /* Don't request options if they do not fit, each value having up to five digits.  */
+    if (sizeof("blksize") + 6u + sizeof("windowsize") + 6u > (ULONG)(packet_ptr -> nx_packet_data_end - buffer_ptr))
+    {
+        tftp_client_ptr -> nx_tftp_client_options =  0;
+    }
+
+    /* Place each option requested with its value.  */
+    for (i = 0; i < 2; i++)
+    {
+
+        if (i == 0)
+        {
+            if ((tftp_client_ptr -> nx_tftp_client_options & NX_TFTP_OPTION_BLOCK_SIZE) == 0)
+            {
+                continue;
+            }
+
+            option_name =  "blksize";
+            value =  tftp_client_ptr -> nx_tftp_client_request_block_size;
+        }
+        else
+        {
+            if ((tftp_client_ptr -> nx_tftp_client_options & NX_TFTP_OPTION_WINDOW_SIZE) == 0)
+            {
+                continue;
+            }
+
+            option_name =  "windowsize";
+            value =  tftp_client_ptr -> nx_tftp_client_request_window_size;
+        }
+
+        /* Place the option name, followed by a NULL.  */
+        while (*option_name)
+        {
+            *buffer_ptr++ =  (UCHAR)*option_name++;
+        }
+        *buffer_ptr++ =  NX_NULL;
+
+        /* Place the option value in decimal, followed by a NULL.  */
+        digits =  1;
+        for (j = value; j >= 10; j = j / 10)
+        {
+            digits++;
+        }
+        for (j = digits; j > 0; j--)
+        {
+            buffer_ptr[j - 1] =  (UCHAR)('0' + (value % 10));
+            value =  value / 10;
+        }
+        buffer_ptr +=  digits;
+        *buffer_ptr++ =  NX_NULL;
+    }
+
     /* Adjust the packet length and the append pointer.  */
     packet_ptr -> nx_packet_append_ptr =  buffer_ptr;
     packet_ptr -> nx_packet_length =  (ULONG)(buffer_ptr - packet_ptr -> nx_packet_prepend_ptr);
@@ -1480,6 +1692,273 @@ UINT        matching = NX_FALSE;
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tftp_client_send_ack                            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends an ACK of the specified block number to the     */
+/*    TFTP server.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tftp_client_ptr                       Pointer to TFTP client        */
+/*    block_number                          Block number to acknowledge   */
+/*    wait_option                           Timeout for packet allocate   */
+/*    ip_type                               IP version of the server      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_allocate                    Allocate a new packet         */
+/*    nx_packet_release                     Release packet                */
+/*    nxd_udp_socket_send                   Send TFTP ACK packet          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_tftp_client_file_read            TFTP read file data           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tftp_client_send_ack(NX_TFTP_CLIENT *tftp_client_ptr, USHORT block_number, ULONG wait_option, UINT ip_type)
+{
+
+UINT        status;
+UCHAR       *buffer_ptr;
+NX_PACKET   *ack_packet;
+
+
+    /* Allocate a new packet for the ACK message.  Determine whether we are sending
+       IPv4 or IPv6 packets.   */
+    if (ip_type == NX_IP_VERSION_V4)
+    {
+
+        status =  nx_packet_allocate(tftp_client_ptr -> nx_tftp_client_packet_pool_ptr, &ack_packet, NX_IPv4_UDP_PACKET, wait_option);
+    }
+    else
+    {
+
+        status =  nx_packet_allocate(tftp_client_ptr -> nx_tftp_client_packet_pool_ptr, &ack_packet, NX_IPv6_UDP_PACKET, wait_option);
+    }
+
+    /* Determine if an error occurred trying to allocate a packet.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Enter error state.  */
+        tftp_client_ptr -> nx_tftp_client_state =  NX_TFTP_STATE_ERROR;
+
+        /* Return error condition.  */
+        return(status);
+    }
+
+    if (4u > ((ULONG)(ack_packet -> nx_packet_data_end) - (ULONG)(ack_packet -> nx_packet_append_ptr)))
+    {
+        nx_packet_release(ack_packet);
+        return(NX_SIZE_ERROR);
+    }
+
+    ack_packet -> nx_packet_append_ptr = ack_packet -> nx_packet_prepend_ptr;
+
+    /* Now build the TFTP ACK message.  */
+
+    /* Setup a pointer to the packet payload.  */
+    buffer_ptr =  ack_packet -> nx_packet_prepend_ptr;
+
+    /* Initial byte is always zero.  */
+    *buffer_ptr++ =  0;
+
+    /* Set the ACK code.  */
+    *buffer_ptr++ =  NX_TFTP_CODE_ACK;
+
+    /* Put the block number in.  */
+    *buffer_ptr++ =  (UCHAR) (block_number >> 8);
+    *buffer_ptr =    (UCHAR) (block_number & 0xFF);
+
+    /* Adjust the ACK packet pointers and length.  */
+    ack_packet -> nx_packet_length =  4;
+    ack_packet -> nx_packet_append_ptr =  ack_packet -> nx_packet_append_ptr + 4;
+
+    /* Send the ACK packet out.  */
+    status = nxd_udp_socket_send(&(tftp_client_ptr -> nx_tftp_client_socket), ack_packet, 
+                                 &tftp_client_ptr -> nx_tftp_client_server_ip, 
+                                 tftp_client_ptr -> nx_tftp_client_server_port);
+
+    /* Check error status. */
+    if (status != NX_SUCCESS)
+    {
+        nx_packet_release(ack_packet);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tftp_client_oack_process                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes the option acknowledgement (OACK) to the    */
+/*    block size and window size options requested, and saves the values  */
+/*    the server will use.  The server may only acknowledge the options   */
+/*    requested, with values no larger than requested.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tftp_client_ptr                       Pointer to TFTP client        */
+/*    packet_ptr                            Pointer to TFTP OACK packet   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_utility_string_to_uint            Convert option value          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_tftp_client_file_read            TFTP read file data           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tftp_client_oack_process(NX_TFTP_CLIENT *tftp_client_ptr, NX_PACKET *packet_ptr)
+{
+
+UCHAR   *buffer_ptr;
+UCHAR   *end_ptr;
+UCHAR   *name_ptr;
+UCHAR   *value_ptr;
+CHAR    *option_name;
+UINT    name_length;
+UINT    value_length;
+UINT    value;
+UINT    i;
+
+
+    /* Setup pointers to the options, after the OACK code.  */
+    buffer_ptr =  packet_ptr -> nx_packet_prepend_ptr + 2;
+    end_ptr =     packet_ptr -> nx_packet_append_ptr;
+
+    /* Check that the options end with NULL.  */
+    if ((buffer_ptr >= end_ptr) || (*(end_ptr - 1) != NX_NULL))
+    {
+        return(NX_TFTP_FAILED);
+    }
+
+    /* Loop through the option name and value pairs.  */
+    while (buffer_ptr < end_ptr)
+    {
+
+        /* Pickup the option name.  */
+        name_ptr =  buffer_ptr;
+        while (*buffer_ptr)
+        {
+            buffer_ptr++;
+        }
+        name_length =  (UINT)(buffer_ptr - name_ptr);
+        buffer_ptr++;
+
+        /* Pickup the option value.  */
+        if (buffer_ptr >= end_ptr)
+        {
+            return(NX_TFTP_FAILED);
+        }
+        value_ptr =  buffer_ptr;
+        while (*buffer_ptr)
+        {
+            buffer_ptr++;
+        }
+        value_length =  (UINT)(buffer_ptr - value_ptr);
+        buffer_ptr++;
+
+        /* Convert the option value.  */
+        if (_nx_utility_string_to_uint((CHAR *)value_ptr, value_length, &value) != NX_SUCCESS)
+        {
+            return(NX_TFTP_FAILED);
+        }
+
+        /* Determine which option this is.  The server may only acknowledge options requested.  */
+        if ((name_length == 7) && (tftp_client_ptr -> nx_tftp_client_options & NX_TFTP_OPTION_BLOCK_SIZE))
+        {
+            option_name =  "blksize";
+        }
+        else if ((name_length == 10) && (tftp_client_ptr -> nx_tftp_client_options & NX_TFTP_OPTION_WINDOW_SIZE))
+        {
+            option_name =  "windowsize";
+        }
+        else
+        {
+            return(NX_TFTP_FAILED);
+        }
+
+        /* Option names are case insensitive.  */
+        for (i = 0; i < name_length; i++)
+        {
+            if ((UCHAR)(name_ptr[i] | 0x20) != (UCHAR)option_name[i])
+            {
+                return(NX_TFTP_FAILED);
+            }
+        }
+
+        if (name_length == 7)
+        {
+
+            /* The server may reduce the block size, but not increase it.  */
+            if ((value < NX_TFTP_MIN_BLOCK_SIZE) || (value > tftp_client_ptr -> nx_tftp_client_request_block_size))
+            {
+                return(NX_TFTP_FAILED);
+            }
+
+            tftp_client_ptr -> nx_tftp_client_block_size =  value;
+        }
+        else
+        {
+
+            /* The server may reduce the window size, but not increase it.  */
+            if ((value == 0) || (value > tftp_client_ptr -> nx_tftp_client_request_window_size))
+            {
+                return(NX_TFTP_FAILED);
+            }
+
+            tftp_client_ptr -> nx_tftp_client_window_size =  value;
+        }
+    }
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+}
+
+
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
@@ -1557,8 +2036,8 @@ UINT    status;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nxd_tftp_client_file_read                          PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nxd_tftp_client_file_read                          PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -1606,6 +2085,10 @@ UINT    status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            OACK processing and windowed*/
+/*                                            receive,                    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nxd_tftp_client_file_read(NX_TFTP_CLIENT *tftp_client_ptr, NX_PACKET **packet_ptr, ULONG wait_option, UINT ip_type)
@@ -1618,9 +2101,9 @@ UINT        port;
 UINT        i;
 USHORT      block_number;
 UCHAR       code;
-NX_PACKET   *ack_packet;
 UINT         matching = NX_FALSE;
 UCHAR       resend_ACK_packet = NX_FALSE;
+UCHAR       send_ACK_packet = NX_TRUE;
 
 
     /* Determine if we are still in an open state.  */
@@ -1734,7 +2217,8 @@ UCHAR       resend_ACK_packet = NX_FALSE;
     if (code == NX_TFTP_CODE_DATA)
     {
 
-        /* Yes, a data packet is present.  */
+        /* Yes, a data packet is present.  If options were requested, the server ignored them.  */
+        tftp_client_ptr -> nx_tftp_client_options =  0;
 
         /* Pickup the block number.  */
         buffer_ptr++;
@@ -1742,13 +2226,39 @@ UCHAR       resend_ACK_packet = NX_FALSE;
         buffer_ptr++;
         block_number = (USHORT)(block_number | (*buffer_ptr));
 
-        /* Check if the server didn't receive last TFTP ACK. */
-        if ((USHORT)(tftp_client_ptr -> nx_tftp_client_block_number - 1) == block_number)
+        /* Check if the server didn't receive last TFTP ACK, and is sending the last window again. */
+        if ((USHORT)(tftp_client_ptr -> nx_tftp_client_block_number - block_number - 1) < tftp_client_ptr -> nx_tftp_client_window_size)
         {
 
             /*  The Server will resend previous packet till it times out.
                 set a flag to indicate we need to resend the ACK packet to 
-                prevent this. */
+                prevent this.  Only the last block we received is ACKed 
+                again, so a window sent again is ACKed once. */
+            if ((USHORT)(tftp_client_ptr -> nx_tftp_client_block_number - 1) != block_number)
+            {
+
+                /* Release the packet.  */
+                nx_packet_release(*packet_ptr);
+
+                /* Set packet pointer to NULL.  */
+                *packet_ptr =  NX_NULL; 
+
+                /* Do not handle as an error. Indicate the TFTP Client is still downloading a file. */
+                return(NX_TFTP_INVALID_BLOCK_NUMBER);
+            }
+
+            resend_ACK_packet = NX_TRUE;
+        }
+        /* Check if an earlier block of the window was lost.  */
+        else if ((tftp_client_ptr -> nx_tftp_client_block_number != block_number) &&
+                 ((USHORT)(block_number - tftp_client_ptr -> nx_tftp_client_block_number) < tftp_client_ptr -> nx_tftp_client_window_size) &&
+                 (tftp_client_ptr -> nx_tftp_client_window_count != 0))
+        {
+
+            /* ACK the last block received in order, once, so the Server sends the
+               window again from there (RFC 7440).  */
+            tftp_client_ptr -> nx_tftp_client_window_count =  0;
+            block_number =  (USHORT)(tftp_client_ptr -> nx_tftp_client_block_number - 1);
             resend_ACK_packet = NX_TRUE;
         }
         /* Is there a block number match (greater than 1) ?  */
@@ -1766,82 +2276,42 @@ UCHAR       resend_ACK_packet = NX_FALSE;
             /* Return error condition.  */
             return(NX_TFTP_INVALID_BLOCK_NUMBER);
         }
-
-        /* Valid block number, end ACK back to server.  */
-
-        /* Allocate a new packet for the ACK message.  Determine whether we are sending
-           IPv4 or IPv6 packets.   */
-
-        if (ip_type == NX_IP_VERSION_V4)
-        {
-
-            status =  nx_packet_allocate(tftp_client_ptr -> nx_tftp_client_packet_pool_ptr, &ack_packet, NX_IPv4_UDP_PACKET, wait_option);
-        }
         else
         {
 
-            status =  nx_packet_allocate(tftp_client_ptr -> nx_tftp_client_packet_pool_ptr, &ack_packet, NX_IPv6_UDP_PACKET, wait_option);
-        }
-
-        /* Determine if an error occurred trying to allocate a packet.  */
-        if (status != NX_SUCCESS)
-        {
-
-            /* Enter error state.  */
-            tftp_client_ptr -> nx_tftp_client_state =  NX_TFTP_STATE_ERROR;
-
-            /* Release the data packet.  */
-            nx_packet_release(*packet_ptr);
-
-            /* Set packet pointer to NULL.  */
-            *packet_ptr =  NX_NULL;
-
-            /* Return error condition.  */
-            return(status);
+            /* The expected block.  Hold the ACK until the window is complete, or the last
+               block is received.  */
+            tftp_client_ptr -> nx_tftp_client_window_count++;
+            if ((tftp_client_ptr -> nx_tftp_client_window_count < tftp_client_ptr -> nx_tftp_client_window_size) &&
+                (((*packet_ptr) -> nx_packet_length - 4) >= tftp_client_ptr -> nx_tftp_client_block_size))
+            {
+                send_ACK_packet = NX_FALSE;
+            }
+            else
+            {
+                tftp_client_ptr -> nx_tftp_client_window_count =  0;
+            }
         }
 
-        if (4u > ((ULONG)(ack_packet -> nx_packet_data_end) - (ULONG)(ack_packet -> nx_packet_append_ptr)))
+        /* Valid block number, send ACK back to server unless the window is not complete.  */
+        if (send_ACK_packet == NX_TRUE)
         {
-            nx_packet_release(*packet_ptr); 
 
-            nx_packet_release(ack_packet);
-            return(NX_SIZE_ERROR);
-        }
-
-        ack_packet -> nx_packet_append_ptr = ack_packet -> nx_packet_prepend_ptr;
-
-        /* Valid block number, we need to send an ACK back to server. So now 
-           build the TFTP ACK message.  */
-
-        /* Setup a pointer to the packet payload.  */
-        buffer_ptr =  ack_packet -> nx_packet_prepend_ptr;
-
-        /* Initial byte is always zero.  */
-        *buffer_ptr++ =  0;
-
-        /* Set the ACK code.  */
-        *buffer_ptr++ =  NX_TFTP_CODE_ACK;
-
-        /* Put the block number in.  */
-        *buffer_ptr++ =  (UCHAR) (block_number >> 8);
-        *buffer_ptr =    (UCHAR) (block_number & 0xFF);
+            status =  _nx_tftp_client_send_ack(tftp_client_ptr, block_number, wait_option, ip_type);
 
-        /* Adjust the ACK packet pointers and length.  */
-        ack_packet -> nx_packet_length =  4;
-        ack_packet -> nx_packet_append_ptr =  ack_packet -> nx_packet_append_ptr + 4;
+            /* Check error status. */
+            if (status != NX_SUCCESS)
+            {
 
-        /* Send the ACK packet out.  */
-        status = nxd_udp_socket_send(&(tftp_client_ptr -> nx_tftp_client_socket), ack_packet, 
-                                     &tftp_client_ptr -> nx_tftp_client_server_ip, 
-                                     tftp_client_ptr -> nx_tftp_client_server_port);
+                /* Release the data packet.  */
+                nx_packet_release(*packet_ptr);
 
-        /* Check error status. */
-        if (status != NX_SUCCESS)
-        {
-            nx_packet_release(*packet_ptr); 
+                /* Set packet pointer to NULL.  */
+                *packet_ptr =  NX_NULL;
 
-            nx_packet_release(ack_packet);
-            return status;
+                /* Return error condition.  */
+                return(status);
+            }
         }
 
         /* If we received a duplicate data packet, release it here. */
@@ -1862,8 +2332,8 @@ UCHAR       resend_ACK_packet = NX_FALSE;
         (*packet_ptr) -> nx_packet_length =       (*packet_ptr) -> nx_packet_length - 4;
         (*packet_ptr) -> nx_packet_prepend_ptr =  (*packet_ptr) -> nx_packet_prepend_ptr + 4;
 
-        /* Check for end of file condition. Anything less than 512 bytes signals an end of file.  */
-        if ((*packet_ptr) -> nx_packet_length < NX_TFTP_FILE_TRANSFER_MAX)
+        /* Check for end of file condition. Anything less than the block size signals an end of file.  */
+        if ((*packet_ptr) -> nx_packet_length < tftp_client_ptr -> nx_tftp_client_block_size)
         {
 
             /* End of file is present.  */
@@ -1918,6 +2388,71 @@ UCHAR       resend_ACK_packet = NX_FALSE;
         /* Return a failed status.  */
         return(NX_TFTP_CODE_ERROR);
     }
+    /* Is an option acknowledgement present before the first block?  */
+    else if ((code == NX_TFTP_CODE_OACK) && (tftp_client_ptr -> nx_tftp_client_block_number == 1))
+    {
+
+        /* Determine if the options requested are waiting for it.  */
+        if (tftp_client_ptr -> nx_tftp_client_options)
+        {
+
+            /* Yes, pickup the block size and window size the server will use.  */
+            status =  _nx_tftp_client_oack_process(tftp_client_ptr, *packet_ptr);
+            tftp_client_ptr -> nx_tftp_client_options =  0;
+
+            /* Check for invalid options.  */
+            if (status != NX_SUCCESS)
+            {
+
+                /* Change the state to error.  */
+                tftp_client_ptr -> nx_tftp_client_state =  NX_TFTP_STATE_ERROR;
+
+                /* Release the packet.  */
+                nx_packet_release(*packet_ptr);
+
+                /* Set packet pointer to NULL.  */
+                *packet_ptr =  NX_NULL;
+
+                /* Return a failed status.  */
+                return(status);
+            }
+
+            /* Release the packet.  */
+            nx_packet_release(*packet_ptr);
+
+            /* Set packet pointer to NULL.  */
+            *packet_ptr =  NX_NULL;
+
+            /* ACK block 0 so the server starts sending the file.  */
+            status =  _nx_tftp_client_send_ack(tftp_client_ptr, 0, wait_option, ip_type);
+
+            /* Check error status. */
+            if (status != NX_SUCCESS)
+            {
+                return(status);
+            }
+
+            /* Now read the first block of the file.  */
+            return(_nxd_tftp_client_file_read(tftp_client_ptr, packet_ptr, wait_option, ip_type));
+        }
+
+        /* The server did not receive our ACK of the OACK, send it again.  */
+        nx_packet_release(*packet_ptr);
+
+        /* Set packet pointer to NULL.  */
+        *packet_ptr =  NX_NULL;
+
+        status =  _nx_tftp_client_send_ack(tftp_client_ptr, 0, wait_option, ip_type);
+
+        /* Check error status. */
+        if (status != NX_SUCCESS)
+        {
+            return(status);
+        }
+
+        /* Do not handle as an error. Indicate the TFTP Client is still downloading a file. */
+        return(NX_TFTP_INVALID_BLOCK_NUMBER);
+    }
     /* This could be an ack from the previous file write. Just ignore it. */
     else if (code == NX_TFTP_CODE_ACK)
     {
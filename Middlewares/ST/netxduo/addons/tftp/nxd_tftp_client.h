@@ -26,8 +26,8 @@
 /*                                                                        */ 
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */ 
 /*                                                                        */ 
-/*    nxd_tftp_client.h                                   PORTABLE C      */ 
-/*                                                           6.1          */
+/*    nxd_tftp_client.h                                   PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -46,6 +46,10 @@
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            block size and window size  */
+/*                                            options,                    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -94,7 +98,12 @@ extern   "C" {
 #define NX_TFTP_SOURCE_PORT                NX_ANY_PORT
 #endif
 
+/* Define the depth of the TFTP Client socket receive queue.  A window of blocks (RFC 7440) is
+   queued on the socket, so the window size requested should not exceed this depth.  */
+
+#ifndef NX_TFTP_QUEUE_DEPTH
 #define NX_TFTP_QUEUE_DEPTH                 5
+#endif
         
 #define NX_TFTP_FILE_TRANSFER_MAX           512         /* 512 byte maximum file transfer                      */
 
@@ -112,6 +121,16 @@ extern   "C" {
 #define NX_TFTP_CODE_DATA                   0x03        /* TFTP data packet                                     */ 
 #define NX_TFTP_CODE_ACK                    0x04        /* TFTP command/data acknowledgement                    */ 
 #define NX_TFTP_CODE_ERROR                  0x05        /* TFTP error message                                   */ 
+#define NX_TFTP_CODE_OACK                   0x06        /* TFTP option acknowledgement                          */ 
+
+
+/* Define TFTP options (RFC 2347) and their limits.  */
+
+#define NX_TFTP_OPTION_BLOCK_SIZE           0x01        /* Block size option, RFC 2348                          */
+#define NX_TFTP_OPTION_WINDOW_SIZE          0x02        /* Window size option, RFC 7440                         */
+#define NX_TFTP_MIN_BLOCK_SIZE              8           /* Minimum block size                                   */
+#define NX_TFTP_MAX_BLOCK_SIZE              65464       /* Maximum block size                                   */
+#define NX_TFTP_MAX_WINDOW_SIZE             65535       /* Maximum window size                                  */
 
 
 /* Define TFTP error code constants.  */
@@ -183,6 +202,12 @@ typedef struct NX_TFTP_CLIENT_STRUCT
     USHORT          nx_tftp_client_block_number;                    /* Block number in file transfer        */ 
     USHORT          nx_tftp_client_reserved;                        /* Reserved for future use              */ 
     UINT            nx_tftp_client_error_code;                      /* Error code received                  */ 
+    UINT            nx_tftp_client_block_size;                      /* Block size of file transfer          */
+    UINT            nx_tftp_client_window_size;                     /* Window size of file transfer         */
+    UINT            nx_tftp_client_window_count;                    /* Blocks received since last ACK       */
+    UINT            nx_tftp_client_options;                         /* Options waiting for OACK             */
+    UINT            nx_tftp_client_request_block_size;              /* Block size to request on read        */
+    UINT            nx_tftp_client_request_window_size;             /* Window size to request on read       */
     CHAR            nx_tftp_client_error_string[NX_TFTP_ERROR_STRING_MAX + 1];
     NX_UDP_SOCKET   nx_tftp_client_socket;                          /* TFTP Socket                          */
 
@@ -215,6 +240,7 @@ typedef struct NX_TFTP_CLIENT_STRUCT
 #define nx_tftp_client_file_read(a,b,c)         _nxd_tftp_client_file_read(a,b,c,NX_IP_VERSION_V4)
 #define nx_tftp_client_file_write(a,b,c)        _nxd_tftp_client_file_write(a,b,c,NX_IP_VERSION_V4)
 #define nx_tftp_client_set_interface            _nxd_tftp_client_set_interface
+#define nx_tftp_client_options_set              _nxd_tftp_client_options_set
 
 /* NetX Duo TFTP (IPv4 and IPv6 supported) services. */
 #define nxd_tftp_client_create                  _nxd_tftp_client_create
@@ -226,6 +252,7 @@ typedef struct NX_TFTP_CLIENT_STRUCT
 #define nxd_tftp_client_file_write              _nxd_tftp_client_file_write
 #define nxd_tftp_client_packet_allocate         _nxd_tftp_client_packet_allocate
 #define nxd_tftp_client_set_interface           _nxd_tftp_client_set_interface
+#define nxd_tftp_client_options_set             _nxd_tftp_client_options_set
 
 #else
 
@@ -243,6 +270,7 @@ typedef struct NX_TFTP_CLIENT_STRUCT
 #define nx_tftp_client_file_read(a,b,c)         _nxde_tftp_client_file_read(a,b,c,NX_IP_VERSION_V4)
 #define nx_tftp_client_file_write(a,b,c)        _nxde_tftp_client_file_write(a,b,c,NX_IP_VERSION_V4)
 #define nx_tftp_client_set_interface            _nxde_tftp_client_set_interface
+#define nx_tftp_client_options_set              _nxde_tftp_client_options_set
 
 /* NetX Duo (IPv4 and IPv6 supported) services. */
 #define nxd_tftp_client_create                  _nxde_tftp_client_create
@@ -254,6 +282,7 @@ typedef struct NX_TFTP_CLIENT_STRUCT
 #define nxd_tftp_client_file_write              _nxde_tftp_client_file_write
 #define nxd_tftp_client_packet_allocate         _nxde_tftp_client_packet_allocate
 #define nxd_tftp_client_set_interface           _nxde_tftp_client_set_interface
+#define nxd_tftp_client_options_set             _nxde_tftp_client_options_set
 
 
 #endif  /* NX_DISABLE_ERROR_CHECKING */
@@ -271,6 +300,7 @@ UINT        nxd_tftp_client_file_read(NX_TFTP_CLIENT *tftp_client_ptr, NX_PACKET
 UINT        nxd_tftp_client_file_write(NX_TFTP_CLIENT *tftp_client_ptr, NX_PACKET *packet_ptr, ULONG wait_option, UINT ip_type);
 UINT        nxd_tftp_client_packet_allocate(NX_PACKET_POOL *pool_ptr, NX_PACKET **packet_ptr, ULONG wait_option, UINT ip_type);
 UINT        nxd_tftp_client_set_interface(NX_TFTP_CLIENT *tftpv6_client_ptr, UINT if_index);
+UINT        nxd_tftp_client_options_set(NX_TFTP_CLIENT *tftp_client_ptr, UINT block_size, UINT window_size);
 
 #else
 
@@ -297,6 +327,8 @@ UINT        _nxde_tftp_client_packet_allocate(NX_PACKET_POOL *pool_ptr, NX_PACKE
 UINT        _nxd_tftp_client_packet_allocate(NX_PACKET_POOL *pool_ptr, NX_PACKET **packet_ptr, ULONG wait_option, UINT ip_type);
 UINT        _nxde_tftp_client_set_interface(NX_TFTP_CLIENT *tftp_client_ptr, UINT if_index);
 UINT        _nxd_tftp_client_set_interface(NX_TFTP_CLIENT *tftp_client_ptr, UINT if_index);
+UINT        _nxde_tftp_client_options_set(NX_TFTP_CLIENT *tftp_client_ptr, UINT block_size, UINT window_size);
+UINT        _nxd_tftp_client_options_set(NX_TFTP_CLIENT *tftp_client_ptr, UINT block_size, UINT window_size);
 
 
 
@@ -304,6 +336,8 @@ UINT        _nxd_tftp_client_set_interface(NX_TFTP_CLIENT *tftp_client_ptr, UINT
                             
 /* Internal functions. */  
 UINT  _nx_tftp_client_file_open_internal(NX_TFTP_CLIENT *tftp_client_ptr, CHAR *file_name, NXD_ADDRESS *server_ip_address, UINT open_type, ULONG wait_option, UINT  ip_type);
+UINT  _nx_tftp_client_send_ack(NX_TFTP_CLIENT *tftp_client_ptr, USHORT block_number, ULONG wait_option, UINT ip_type);
+UINT  _nx_tftp_client_oack_process(NX_TFTP_CLIENT *tftp_client_ptr, NX_PACKET *packet_ptr);
 
 
 /* Determine if a C++ compiler is being used.  If so, complete the standard
@@ -858,8 +858,8 @@ NX_TFTP_SERVER   *server_ptr;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_tftp_server_timer_process                       PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_tftp_server_timer_process                       PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -898,6 +898,10 @@ NX_TFTP_SERVER   *server_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            OACK and window             */
+/*                                            retransmission,             */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_tftp_server_timer_process(NX_TFTP_SERVER *server_ptr)
@@ -944,7 +948,13 @@ NX_TFTP_CLIENT_REQUEST   *client_request_ptr;
                     client_request_ptr -> nx_tftp_client_retransmit_retries++;
 
                     /* Determine which type of request this is. */
-                    if (client_request_ptr -> nx_tftp_client_request_open_type == NX_TFTP_STATE_WRITE_OPEN)
+                    if (client_request_ptr -> nx_tftp_client_request_options)
+                    {
+
+                        /* The OACK has not been acknowledged, retransmit it. */
+                        _nx_tftp_server_send_oack(server_ptr, client_request_ptr);
+                    }
+                    else if (client_request_ptr -> nx_tftp_client_request_open_type == NX_TFTP_STATE_WRITE_OPEN)
                     {
 
                         /* Retransmit the ACK. */
@@ -953,8 +963,8 @@ NX_TFTP_CLIENT_REQUEST   *client_request_ptr;
                     else
                     {
 
-                        /* Retransmit the file data. */
-                        _nx_tftp_server_send_data(server_ptr, client_request_ptr, NX_TRUE);
+                        /* Retransmit the file data from the first block not acknowledged. */
+                        _nx_tftp_server_send_window(server_ptr, client_request_ptr);
                     }
                 }
                 else
@@ -1232,16 +1242,17 @@ UCHAR        request_code;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_tftp_server_open_for_read_process               PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_tftp_server_open_for_read_process               PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */ 
 /*                                                                        */ 
-/*    This function opens the specified file for reading, and returns     */ 
-/*    the first block of the file.                                        */ 
+/*    This function opens the specified file for reading, and returns     */
+/*    the first window of the file, or an OACK if the client requested    */
+/*    the block size or window size options.                              */
 /*                                                                        */ 
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
@@ -1258,12 +1269,12 @@ UCHAR        request_code;
 /*    fx_directory_information_get          Get information about file    */ 
 /*    fx_file_close                         Close file on EOF or error    */ 
 /*    fx_file_open                          Open file for reading         */ 
-/*    fx_file_read                          Read block from file          */ 
 /*    _nx_tftp_server_find_client_request   Find client entry             */ 
+/*    _nx_tftp_server_options_parse         Parse requested options       */
+/*    _nx_tftp_server_send_oack             Send option acknowledgement   */
+/*    _nx_tftp_server_send_window           Send first window of file     */
 /*    _nx_tftp_server_send_error            Send error message            */ 
-/*    nx_packet_allocate                    Allocate a new packet         */ 
 /*    nx_packet_release                     Release packet                */ 
-/*    nx_udp_socket_send                    Send TFTP data packet         */ 
 /*    nx_udp_source_extract                 Extract IP and port           */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -1277,17 +1288,19 @@ UCHAR        request_code;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            option negotiation and      */
+/*                                            windowed transfer,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 void  _nx_tftp_server_open_for_read_process(NX_TFTP_SERVER *server_ptr, NX_PACKET *packet_ptr)
 {
 NXD_ADDRESS              ip_address;
 ULONG                    file_size;
-ULONG                    actual_size;
 UINT                     port;
 UCHAR                    *buffer_ptr;
 NX_TFTP_CLIENT_REQUEST   *client_request_ptr;
-NX_PACKET                *new_packet = NX_NULL;
 UINT                     status;
 
 
@@ -1353,7 +1366,7 @@ UINT                     status;
 
     
     client_request_ptr -> nx_tftp_client_request_port =             port;
-    client_request_ptr -> nx_tftp_client_request_block_number =     1;
+    client_request_ptr -> nx_tftp_client_request_block_number =     0;
     client_request_ptr -> nx_tftp_client_request_open_type =        NX_TFTP_STATE_OPEN;
     client_request_ptr -> nx_tftp_client_request_exact_fit =        NX_FALSE;
 
@@ -1385,6 +1398,9 @@ UINT                     status;
         return;
     }
 
+    /* Pickup the block size and window size options, if any.  */
+    _nx_tftp_server_options_parse(server_ptr, client_request_ptr, packet_ptr);
+
     /* Pickup the file size.  */
     status =  fx_directory_information_get(server_ptr -> nx_tftp_server_media_ptr, (CHAR *) buffer_ptr, NX_NULL, &file_size, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
 
@@ -1415,111 +1431,41 @@ UINT                     status;
         return;
     }
 
-    /* The file has been opened successfully, now try to read up to 512 bytes.  */
+    /* The file has been opened successfully.  Setup the client request structure, nothing
+       has been sent or acknowledged yet.  */
+    client_request_ptr -> nx_tftp_client_file_size =                file_size;
+    client_request_ptr -> nx_tftp_client_request_remaining_bytes =  file_size;
+    client_request_ptr -> nx_tftp_client_request_window_block =     0;
+    client_request_ptr -> nx_tftp_client_request_window_offset =    0;
 
-   /* Allocate packet for the read packet. Determine whether we are sending IP packets.   */
-    if (ip_address.nxd_ip_version == NX_IP_VERSION_V4)
-    {
-        status =  nx_packet_allocate(server_ptr -> nx_tftp_server_packet_pool_ptr, &new_packet, NX_IPv4_UDP_PACKET, NX_WAIT_FOREVER);
-    }
-    else if (ip_address.nxd_ip_version == NX_IP_VERSION_V6)
+    /* Determine if the file size is evenly divisible by the block size.  */
+    if (file_size % client_request_ptr -> nx_tftp_client_request_block_size)
     {
-        status =  nx_packet_allocate(server_ptr -> nx_tftp_server_packet_pool_ptr, &new_packet, NX_IPv6_UDP_PACKET, NX_WAIT_FOREVER);
+
+        /* Not an exact fit, ensure the exact fit flag is clear.  */
+        client_request_ptr -> nx_tftp_client_request_exact_fit =  NX_FALSE;
     }
     else
-        status = NX_TFTP_INVALID_ADDRESS_TYPE;
-    /* Check for successful packet allocation.  */
-    if (status != NX_SUCCESS)
     {
 
-        /* Increment the number of server allocation errors.  */
-        server_ptr -> nx_tftp_server_allocation_errors++;
-
-        /* Unable to allocate net packet, release the original.  */
-        nx_packet_release(packet_ptr);
-        return;
-    }
-
-    if (4u + NX_TFTP_FILE_TRANSFER_MAX > ((ULONG)(new_packet -> nx_packet_data_end) - (ULONG)(new_packet -> nx_packet_append_ptr)))
-    {
-        /* Release the original packet.  */
-        nx_packet_release(packet_ptr);
-
-        nx_packet_release(new_packet);
-        return;
+        /* Yes, the file size happens to be evenly divisible by the block size (or the file is
+           empty).  In this case, we need to send a zero-length data packet at the end of file
+           to let the other side know we are at the end.  */
+        client_request_ptr -> nx_tftp_client_request_exact_fit =  NX_TRUE;
     }
 
-    client_request_ptr -> nx_tftp_client_file_size = file_size;  
-
-    /* Read data when length of file is larger then 0. */
-    if(file_size)
+    /* Determine if any options were accepted.  */
+    if (client_request_ptr -> nx_tftp_client_request_options)
     {
 
-        /* Attempt to read the requested file.  */
-        status =  fx_file_read(&(client_request_ptr ->nx_tftp_client_request_file), new_packet -> nx_packet_prepend_ptr+4, NX_TFTP_FILE_TRANSFER_MAX, &actual_size);
-
-        /* Check for successful file read.  */
-        if ((status != NX_SUCCESS) || 
-            ((file_size > NX_TFTP_FILE_TRANSFER_MAX) && (actual_size != NX_TFTP_FILE_TRANSFER_MAX)) || 
-            ((file_size < NX_TFTP_FILE_TRANSFER_MAX) && (actual_size != file_size)))
-        {
-
-            /* Send an error to the client.  */
-            _nx_tftp_server_send_error(server_ptr, &ip_address, port, NX_TFTP_ERROR_NOT_DEFINED, "NetX TFTP Server: File Read Error");
-
-            /* Unable to read the file, close it and release the packet.  */
-            fx_file_close(&(client_request_ptr ->nx_tftp_client_request_file));
-
-            nx_packet_release(packet_ptr);
-            return;
-        }
+        /* Yes, acknowledge them.  The client starts the transfer with an ACK of block 0.  */
+        _nx_tftp_server_send_oack(server_ptr, client_request_ptr);
     }
     else
     {
-    
-        actual_size = 0;
-    }
-
-    /* Increment the number of total bytes sent.  */
-    server_ptr -> nx_tftp_server_total_bytes_sent +=  actual_size;
-
-    /* Setup the client request structure.  */
-    client_request_ptr -> nx_tftp_client_request_remaining_bytes =  file_size - actual_size;
-
-    /* Determine if the file size is evenly divisible by our TFTP transfer size.  */
-    if (file_size % NX_TFTP_FILE_TRANSFER_MAX)
-    {
-
-        /* Not an exact fit, ensure the exact fit flag is clear.  */
-        client_request_ptr -> nx_tftp_client_request_exact_fit =  NX_FALSE;
-    }
-    else if (file_size > 0)
-    {
-
-        /* Yes, the file size happens to be evenly divisible by the TFTP transfer size.  In this
-           case, we need to send a zero-length data packet at the end of file to let the other side
-           know we are at the end.  */
-        client_request_ptr -> nx_tftp_client_request_exact_fit =  NX_TRUE;
-    }
-    
-    /* Move the TFTP data code and block number into the payload before sending it to the client.  */
-    buffer_ptr =  new_packet -> nx_packet_prepend_ptr;
-    *buffer_ptr++ =  0;
-    *buffer_ptr++ =  NX_TFTP_CODE_DATA;
-    *buffer_ptr++ =  0;
-    *buffer_ptr++ =  1;                                     /* First block number of file.  */
 
-    /* Setup the packet pointers appropriately.  */
-    new_packet -> nx_packet_length =  actual_size + 4;
-    new_packet -> nx_packet_append_ptr =  new_packet -> nx_packet_prepend_ptr + new_packet -> nx_packet_length;
-
-    /* Send the data packet out.  */
-    status = nxd_udp_socket_send(&(server_ptr -> nx_tftp_server_socket), new_packet, &ip_address, port);
-
-    /* Release packet if send fails. */
-    if (status)
-    {
-        nx_packet_release(new_packet);
+        /* No, send the first block of the file.  */
+        _nx_tftp_server_send_window(server_ptr, client_request_ptr);
     }
 
     /* Release the original packet.  */
@@ -1531,16 +1477,18 @@ UINT                     status;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_tftp_server_open_for_write_process              PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_tftp_server_open_for_write_process              PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */ 
 /*                                                                        */ 
-/*    This function opens the specified file for writing, and returns     */ 
-/*    an ACK for block 0 to let the client know everything is good.       */ 
+/*    This function opens the specified file for writing, and returns     */
+/*    an ACK for block 0 to let the client know everything is good.       */
+/*    If the client requested the block size or window size options,      */
+/*    an OACK is returned instead.                                        */
 /*                                                                        */ 
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
@@ -1559,6 +1507,8 @@ UINT                     status;
 /*    fx_file_open                          Open file for reading         */ 
 /*    fx_file_write                         Write block to file           */ 
 /*    _nx_tftp_server_find_client_request   Find client entry             */ 
+/*    _nx_tftp_server_options_parse         Parse requested options       */
+/*    _nx_tftp_server_send_oack             Send option acknowledgement   */
 /*    _nx_tftp_server_send_error            Send error message            */ 
 /*    nx_packet_allocate                    Allocate a new packet         */ 
 /*    nx_packet_release                     Release packet                */ 
@@ -1576,6 +1526,9 @@ UINT                     status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            option negotiation,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_tftp_server_open_for_write_process(NX_TFTP_SERVER *server_ptr, NX_PACKET *packet_ptr)
@@ -1640,6 +1593,9 @@ UINT                    status;
         return;
     }
 
+    /* Pickup the block size and window size options, if any.  */
+    _nx_tftp_server_options_parse(server_ptr, client_request_ptr, packet_ptr);
+
     /* Perform a file create. This will fail if the file is already present, which we don't care about at this point.  */
     fx_file_delete(server_ptr -> nx_tftp_server_media_ptr, (CHAR *) buffer_ptr);
     fx_file_create(server_ptr -> nx_tftp_server_media_ptr, (CHAR *) buffer_ptr);
@@ -1662,45 +1618,6 @@ UINT                    status;
         return;
     }
 
-    /* Now, attempt to build an ACK response to let the client know it can start writing.  */
-
-    /* Allocate packet for the ACK packet.  Determine whether we are sending IP packets.   */
-    if (ip_address.nxd_ip_version == NX_IP_VERSION_V4)
-    {
-        status =  nx_packet_allocate(server_ptr -> nx_tftp_server_packet_pool_ptr, &new_packet, NX_IPv4_UDP_PACKET, NX_WAIT_FOREVER);
-    }
-    else
-    {
-        status =  nx_packet_allocate(server_ptr -> nx_tftp_server_packet_pool_ptr, &new_packet, NX_IPv6_UDP_PACKET, NX_WAIT_FOREVER);
-    }
-
-    /* Check for successful packet allocation.  */
-    if (status != NX_SUCCESS)
-    {
-
-        /* Increment the number of server allocation errors.  */
-        server_ptr -> nx_tftp_server_allocation_errors++;
-
-        /* Close the file.  */
-        fx_file_close(&(client_request_ptr ->nx_tftp_client_request_file));
-
-        /* Unable to allocate net packet, release the original.  */
-        nx_packet_release(packet_ptr);
-        return;
-    }
-
-    if (4u > ((ULONG)(new_packet -> nx_packet_data_end) - (ULONG)(new_packet -> nx_packet_append_ptr)))
-    {
-        nx_packet_release(new_packet);
-
-        /* Release the original packet.  */
-        nx_packet_release(packet_ptr);
-
-        return;
-    }
-
-    new_packet -> nx_packet_append_ptr = new_packet -> nx_packet_prepend_ptr;
-
     /* Setup the client request structure.  */
 #ifndef NX_DISABLE_IPV4
     if (ip_address.nxd_ip_version == NX_IP_VERSION_V4)
@@ -1734,6 +1651,7 @@ UINT                    status;
     client_request_ptr -> nx_tftp_client_request_block_number =     1;
     client_request_ptr -> nx_tftp_client_request_open_type =        NX_TFTP_STATE_WRITE_OPEN;
     client_request_ptr -> nx_tftp_client_request_remaining_bytes =  0;
+    client_request_ptr -> nx_tftp_client_request_window_count =     0;
 
 #ifdef NX_TFTP_SERVER_RETRANSMIT_ENABLE
     /* Reset retransmission timeouts and retries on current client request.  */
@@ -1746,6 +1664,64 @@ UINT                    status;
     client_request_ptr -> nx_tftp_client_request_retransmits = 0;
 #endif
 
+    /* Determine if any options were accepted.  */
+    if (client_request_ptr -> nx_tftp_client_request_options)
+    {
+
+        /* Yes, acknowledge them instead of block 0.  The client starts writing with block 1.  */
+        _nx_tftp_server_send_oack(server_ptr, client_request_ptr);
+
+        /* Release the original packet.  */
+        nx_packet_release(packet_ptr);
+        return;
+    }
+
+    /* Now, attempt to build an ACK response to let the client know it can start writing.  */
+
+    /* Allocate packet for the ACK packet.  Determine whether we are sending IP packets.   */
+    if (ip_address.nxd_ip_version == NX_IP_VERSION_V4)
+    {
+        status =  nx_packet_allocate(server_ptr -> nx_tftp_server_packet_pool_ptr, &new_packet, NX_IPv4_UDP_PACKET, NX_WAIT_FOREVER);
+    }
+    else
+    {
+        status =  nx_packet_allocate(server_ptr -> nx_tftp_server_packet_pool_ptr, &new_packet, NX_IPv6_UDP_PACKET, NX_WAIT_FOREVER);
+    }
+
+    /* Check for successful packet allocation.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Increment the number of server allocation errors.  */
+        server_ptr -> nx_tftp_server_allocation_errors++;
+
+        /* Close the file and delete the client request.  */
+        fx_file_close(&(client_request_ptr ->nx_tftp_client_request_file));
+
+        memset(client_request_ptr, 0, sizeof(NX_TFTP_CLIENT_REQUEST));
+
+        /* Unable to allocate net packet, release the original.  */
+        nx_packet_release(packet_ptr);
+        return;
+    }
+
+    if (4u > ((ULONG)(new_packet -> nx_packet_data_end) - (ULONG)(new_packet -> nx_packet_append_ptr)))
+    {
+        nx_packet_release(new_packet);
+
+        /* Close the file and delete the client request.  */
+        fx_file_close(&(client_request_ptr ->nx_tftp_client_request_file));
+
+        memset(client_request_ptr, 0, sizeof(NX_TFTP_CLIENT_REQUEST));
+
+        /* Release the original packet.  */
+        nx_packet_release(packet_ptr);
+
+        return;
+    }
+
+    new_packet -> nx_packet_append_ptr = new_packet -> nx_packet_prepend_ptr;
+
     /* Create the ACK packet.  */
     buffer_ptr =  new_packet -> nx_packet_prepend_ptr;
     *buffer_ptr++ =  0;
@@ -1775,8 +1751,8 @@ UINT                    status;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_tftp_server_data_process                        PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_tftp_server_data_process                        PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -1819,6 +1795,9 @@ UINT                    status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            windowed receive,           */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_tftp_server_data_process(NX_TFTP_SERVER *server_ptr, NX_PACKET *packet_ptr)
@@ -1873,10 +1852,18 @@ UINT                    status;
 
         /* No, it does not. */
 
-        /* Check if it matches our previous ACK e.g. it could be a retransmit from the other side. */
-        if (client_request_ptr -> nx_tftp_client_request_block_number == (USHORT)(block_number + 1))
+        /* Check if it is a block of the last window e.g. it could be a retransmit from the other side. */
+        if ((USHORT)(client_request_ptr -> nx_tftp_client_request_block_number - block_number) <= client_request_ptr -> nx_tftp_client_request_window_size)
         {
 
+            /* Only the last block we received counts as a retransmit, so a window sent again
+               is counted once.  Drop the other blocks.  */
+            if (client_request_ptr -> nx_tftp_client_request_block_number != (USHORT)(block_number + 1))
+            {
+                nx_packet_release(packet_ptr);
+                return;
+            }
+
 #ifndef NX_TFTP_SERVER_RETRANSMIT_ENABLE
 
             /* It does. Update how many we have received. */
@@ -1898,6 +1885,22 @@ UINT                    status;
             /* (Let the retransmit timeout handler retransmit our ACK to the client.) */
             return;
 #endif
+        }
+
+        /* Check if an earlier block of the window was lost.  */
+        if ((USHORT)(block_number - client_request_ptr -> nx_tftp_client_request_block_number) < client_request_ptr -> nx_tftp_client_request_window_size)
+        {
+
+            /* Acknowledge the last block received in order, once, so the client sends the 
+               window again from there (RFC 7440).  */
+            if (client_request_ptr -> nx_tftp_client_request_window_count)
+            {
+                client_request_ptr -> nx_tftp_client_request_window_count =  0;
+                _nx_tftp_server_send_ack(server_ptr, client_request_ptr, NX_TRUE);
+            }
+
+            nx_packet_release(packet_ptr);
+            return;
         }
          
          /* Send an error to the client.  */
@@ -1914,7 +1917,15 @@ UINT                    status;
         return;
     }
 
-    /* At this point we have a valid packet. */
+    /* Data beyond the block size is not valid.  */
+    if ((packet_ptr -> nx_packet_length - 4) > client_request_ptr -> nx_tftp_client_request_block_size)
+    {
+        nx_packet_release(packet_ptr);
+        return;
+    }
+
+    /* At this point we have a valid packet, which also acknowledges any OACK sent. */
+    client_request_ptr -> nx_tftp_client_request_options =  0;
 
 #ifdef NX_TFTP_SERVER_RETRANSMIT_ENABLE
 
@@ -1990,12 +2001,26 @@ UINT                    status;
     }
 
     /* Check the last packet. */
-    if (packet_ptr -> nx_packet_length - 4 < NX_TFTP_FILE_TRANSFER_MAX)
+    if (packet_ptr -> nx_packet_length - 4 < client_request_ptr -> nx_tftp_client_request_block_size)
     {
         fx_file_close(&(client_request_ptr -> nx_tftp_client_request_file));
     }
 
-    status = _nx_tftp_server_send_ack(server_ptr, client_request_ptr, NX_FALSE);
+    /* Acknowledge the last packet, or the last block of the window.  */
+    client_request_ptr -> nx_tftp_client_request_window_count++;
+    if ((packet_ptr -> nx_packet_length - 4 < client_request_ptr -> nx_tftp_client_request_block_size) ||
+        (client_request_ptr -> nx_tftp_client_request_window_count >= client_request_ptr -> nx_tftp_client_request_window_size))
+    {
+        client_request_ptr -> nx_tftp_client_request_window_count =  0;
+        status = _nx_tftp_server_send_ack(server_ptr, client_request_ptr, NX_FALSE);
+    }
+    else
+    {
+
+        /* Not yet, just move on to the next block.  */
+        client_request_ptr -> nx_tftp_client_request_block_number++;
+        status =  NX_SUCCESS;
+    }
 
     if (status == NX_SUCCESS)
     {
@@ -2004,7 +2029,7 @@ UINT                    status;
         server_ptr -> nx_tftp_server_total_bytes_received +=  (packet_ptr -> nx_packet_length - 4);
 
         /* Determine if this was the last write.  */
-        if ((packet_ptr -> nx_packet_length - 4) < NX_TFTP_FILE_TRANSFER_MAX)
+        if ((packet_ptr -> nx_packet_length - 4) < client_request_ptr -> nx_tftp_client_request_block_size)
         {
 
             /* No, nothing left to write.  Close the file, release the packet and delete 
@@ -2025,16 +2050,16 @@ UINT                    status;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_tftp_server_ack_process                         PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_tftp_server_ack_process                         PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
 /*                                                                        */
 /*  DESCRIPTION                                                           */ 
 /*                                                                        */ 
-/*    This function processes an ACK to the previous file read            */ 
-/*    operation and prepares the next data packet to send if necessary.   */ 
+/*    This function processes an ACK to the previous file read            */
+/*    operation and sends the next window of data if necessary.           */
 /*                                                                        */ 
 /*                                                                        */ 
 /*  INPUT                                                                 */ 
@@ -2049,13 +2074,10 @@ UINT                    status;
 /*  CALLS                                                                 */ 
 /*                                                                        */ 
 /*    fx_file_close                         Close file on EOF or error    */ 
-/*    fx_file_read                          Read block from file          */ 
 /*    _nx_tftp_server_find_client_request   Find client entry             */ 
 /*    _nx_tftp_server_send_error            Send error message            */ 
-/*    nx_packet_allocate                    Allocate a new packet         */ 
-/*    nx_packet_copy                        Copy packet                   */ 
+/*    _nx_tftp_server_send_window           Send next window of file      */
 /*    nx_packet_release                     Release packet                */ 
-/*    nx_udp_socket_send                    Send TFTP data packet         */ 
 /*    nx_udp_source_extract                 Extract IP and port           */ 
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
@@ -2069,6 +2091,9 @@ UINT                    status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            windowed transmit,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_tftp_server_ack_process(NX_TFTP_SERVER *server_ptr, NX_PACKET *packet_ptr)
@@ -2077,6 +2102,8 @@ VOID  _nx_tftp_server_ack_process(NX_TFTP_SERVER *server_ptr, NX_PACKET *packet_
 NXD_ADDRESS             ip_address;
 UINT                    port;
 USHORT                  block_number;
+USHORT                  acked_blocks;
+USHORT                  sent_blocks;
 UCHAR                   *buffer_ptr;
 NX_TFTP_CLIENT_REQUEST  *client_request_ptr;
 
@@ -2116,13 +2143,19 @@ NX_TFTP_CLIENT_REQUEST  *client_request_ptr;
     block_number =  (USHORT)(*buffer_ptr++);
     block_number =  (USHORT)((block_number << 8) | (*buffer_ptr));
 
-    /* Determine if this block number matches the request.  */
-    if (client_request_ptr -> nx_tftp_client_request_block_number != block_number)
+    /* Determine how many blocks this ACK acknowledges, and how many blocks were sent.  */
+    acked_blocks =  (USHORT)(block_number - client_request_ptr -> nx_tftp_client_request_window_block);
+    sent_blocks =   (USHORT)(client_request_ptr -> nx_tftp_client_request_block_number - 
+                             client_request_ptr -> nx_tftp_client_request_window_block);
+
+    /* Determine if this block number is one of the blocks sent.  The last acknowledged block
+       is only valid again when nothing was sent, e.g. the ACK of block 0 after an OACK.  */
+    if ((acked_blocks > sent_blocks) || ((acked_blocks == 0) && (sent_blocks != 0)))
     {
 
         /* Check if this is a retransmitted ACK e.g. our previous data packet was dropped our
            delayed. */
-        if (client_request_ptr -> nx_tftp_client_request_block_number == (USHORT)(block_number + 1))
+        if (acked_blocks == 0)
         {
 
 #ifndef NX_TFTP_SERVER_RETRANSMIT_ENABLE
@@ -2162,8 +2195,19 @@ NX_TFTP_CLIENT_REQUEST  *client_request_ptr;
         return;
     }
 
-    /* The block number matches, see if there is anything left to send.  */
-    if ((client_request_ptr -> nx_tftp_client_request_remaining_bytes == 0) && 
+    /* The block number is valid, which also acknowledges any OACK sent.  Move the window past
+       the acknowledged blocks.  */
+    client_request_ptr -> nx_tftp_client_request_options =       0;
+    client_request_ptr -> nx_tftp_client_request_window_block =  block_number;
+    client_request_ptr -> nx_tftp_client_request_window_offset += (ULONG)acked_blocks * client_request_ptr -> nx_tftp_client_request_block_size;
+    if (client_request_ptr -> nx_tftp_client_request_window_offset > client_request_ptr -> nx_tftp_client_file_size)
+    {
+        client_request_ptr -> nx_tftp_client_request_window_offset =  client_request_ptr -> nx_tftp_client_file_size;
+    }
+
+    /* See if all blocks sent are acknowledged, and there is nothing left to send.  */
+    if ((acked_blocks == sent_blocks) &&
+        (client_request_ptr -> nx_tftp_client_request_remaining_bytes == 0) && 
         (client_request_ptr -> nx_tftp_client_request_exact_fit == NX_FALSE))
     {
 
@@ -2184,8 +2228,9 @@ NX_TFTP_CLIENT_REQUEST  *client_request_ptr;
     client_request_ptr -> nx_tftp_client_retransmit_timeout =  NX_TFTP_SERVER_RETRANSMIT_TIMEOUT;
 #endif
 
-    /* At this point, we need to send the next block of the file.  */
-    _nx_tftp_server_send_data(server_ptr, client_request_ptr, NX_FALSE);
+    /* At this point, we need to send the next window of the file.  If only part of the
+       window was acknowledged, this goes back to the first block not acknowledged.  */
+    _nx_tftp_server_send_window(server_ptr, client_request_ptr);
 
     /* Release the original packet.  */
     nx_packet_release(packet_ptr);
@@ -2198,8 +2243,8 @@ NX_TFTP_CLIENT_REQUEST  *client_request_ptr;
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
-/*    _nx_tftp_server_send_data                           PORTABLE C      */ 
-/*                                                           6.1          */
+/*    _nx_tftp_server_send_data                           PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -2233,8 +2278,7 @@ NX_TFTP_CLIENT_REQUEST  *client_request_ptr;
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
-/*    _nx_tftp_server_timer_process         TFTP timeout event            */ 
-/*    _nx_tftp_server_ack_process           Process a received ACK        */
+/*    _nx_tftp_server_send_window           Send window of file data      */
 /*                                                                        */ 
 /*  RELEASE HISTORY                                                       */ 
 /*                                                                        */ 
@@ -2243,6 +2287,9 @@ NX_TFTP_CLIENT_REQUEST  *client_request_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            negotiated block size,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_tftp_server_send_data(NX_TFTP_SERVER *server_ptr, NX_TFTP_CLIENT_REQUEST *client_request_ptr, UINT retransmit)
@@ -2280,7 +2327,7 @@ UCHAR       *buffer_ptr;
         return status;
     }
 
-    if (4u + NX_TFTP_FILE_TRANSFER_MAX > ((ULONG)(new_packet -> nx_packet_data_end) - (ULONG)(new_packet -> nx_packet_append_ptr)))
+    if (4u + client_request_ptr -> nx_tftp_client_request_block_size > ((ULONG)(new_packet -> nx_packet_data_end) - (ULONG)(new_packet -> nx_packet_append_ptr)))
     {
         nx_packet_release(new_packet);
         return(NX_SIZE_ERROR);
@@ -2313,12 +2360,12 @@ UCHAR       *buffer_ptr;
         
             /* Yes. Attempt to read the requested file.  */
             UINT status_read =  fx_file_read(&(client_request_ptr -> nx_tftp_client_request_file), new_packet -> nx_packet_prepend_ptr+4, 
-                                             NX_TFTP_FILE_TRANSFER_MAX, &actual_size);
+                                             client_request_ptr -> nx_tftp_client_request_block_size, &actual_size);
 
             /* Check for successful file read.  */
             if ((status_read != NX_SUCCESS) || 
-               ((client_request_ptr -> nx_tftp_client_request_remaining_bytes > NX_TFTP_FILE_TRANSFER_MAX) && (actual_size < NX_TFTP_FILE_TRANSFER_MAX)) ||
-               ((client_request_ptr -> nx_tftp_client_request_remaining_bytes < NX_TFTP_FILE_TRANSFER_MAX) && (actual_size != client_request_ptr -> nx_tftp_client_request_remaining_bytes)))
+               ((client_request_ptr -> nx_tftp_client_request_remaining_bytes > client_request_ptr -> nx_tftp_client_request_block_size) && (actual_size < client_request_ptr -> nx_tftp_client_request_block_size)) ||
+               ((client_request_ptr -> nx_tftp_client_request_remaining_bytes < client_request_ptr -> nx_tftp_client_request_block_size) && (actual_size != client_request_ptr -> nx_tftp_client_request_remaining_bytes)))
             {
 
                 /* Update our 'status' variable with the result from file read. */
@@ -2531,6 +2578,487 @@ NX_PACKET   *new_packet;
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tftp_server_options_parse                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function parses the block size (RFC 2348) and window size      */
+/*    (RFC 7440) options of a read or write request, and saves the values */
+/*    the server will use to the client request.  Unknown or invalid      */
+/*    options are ignored, and values larger than the server supports are */
+/*    reduced.  The caller has verified the request ends with NULL.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    server_ptr                            Pointer to TFTP server        */
+/*    client_request_ptr                    Pointer to Client request     */
+/*    packet_ptr                            Pointer to TFTP request packet*/
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    options                               Options to acknowledge        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_utility_string_to_uint            Convert option value          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tftp_server_open_for_read_process                               */
+/*                                          Process open for read request */
+/*    _nx_tftp_server_open_for_write_process                              */
+/*                                                                        */
+/*                                          Process open for write request*/
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tftp_server_options_parse(NX_TFTP_SERVER *server_ptr, NX_TFTP_CLIENT_REQUEST *client_request_ptr, NX_PACKET *packet_ptr)
+{
+
+UCHAR   *buffer_ptr;
+UCHAR   *end_ptr;
+UCHAR   *name_ptr;
+UCHAR   *value_ptr;
+CHAR    *option_name;
+UINT    name_length;
+UINT    value_length;
+UINT    value;
+UINT    option;
+UINT    options = 0;
+UINT    i;
+ULONG   header_size;
+ULONG   max_block_size;
+
+
+    /* Default to the lock-step transfer of 512 byte blocks.  */
+    client_request_ptr -> nx_tftp_client_request_block_size =  NX_TFTP_FILE_TRANSFER_MAX;
+    client_request_ptr -> nx_tftp_client_request_window_size = 1;
+    client_request_ptr -> nx_tftp_client_request_options =     0;
+
+    /* Limit the block size so each data packet fits in one packet of the server pool.  */
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
+    {
+        header_size =  NX_IPv4_UDP_PACKET + NX_TFTP_DATA_OFFSET + NX_PHYSICAL_TRAILER;
+    }
+    else
+    {
+        header_size =  NX_IPv6_UDP_PACKET + NX_TFTP_DATA_OFFSET + NX_PHYSICAL_TRAILER;
+    }
+
+    max_block_size =  NX_TFTP_SERVER_MAX_BLOCK_SIZE;
+    if ((server_ptr -> nx_tftp_server_packet_pool_ptr -> nx_packet_pool_payload_size) < (header_size + max_block_size))
+    {
+        max_block_size =  server_ptr -> nx_tftp_server_packet_pool_ptr -> nx_packet_pool_payload_size - header_size;
+    }
+
+    /* Setup pointers to the request.  The caller has verified it ends with NULL.  */
+    buffer_ptr =  packet_ptr -> nx_packet_prepend_ptr + NX_TFTP_FILENAME_OFFSET;
+    end_ptr =     packet_ptr -> nx_packet_append_ptr;
+
+    /* Skip the file name and the mode.  */
+    for (i = 0; i < 2; i++)
+    {
+        while ((buffer_ptr < end_ptr) && (*buffer_ptr))
+        {
+            buffer_ptr++;
+        }
+        buffer_ptr++;
+    }
+
+    /* Loop through the option name and value pairs that follow.  */
+    while (buffer_ptr < end_ptr)
+    {
+
+        /* Pickup the option name.  */
+        name_ptr =  buffer_ptr;
+        while ((buffer_ptr < end_ptr) && (*buffer_ptr))
+        {
+            buffer_ptr++;
+        }
+        name_length =  (UINT)(buffer_ptr - name_ptr);
+        buffer_ptr++;
+
+        /* Pickup the option value.  */
+        if (buffer_ptr >= end_ptr)
+        {
+            break;
+        }
+        value_ptr =  buffer_ptr;
+        while ((buffer_ptr < end_ptr) && (*buffer_ptr))
+        {
+            buffer_ptr++;
+        }
+        value_length =  (UINT)(buffer_ptr - value_ptr);
+        buffer_ptr++;
+
+        /* Determine which option this is.  */
+        if (name_length == 7)
+        {
+            option_name =  "blksize";
+            option =       NX_TFTP_OPTION_BLOCK_SIZE;
+        }
+        else if (name_length == 10)
+        {
+            option_name =  "windowsize";
+            option =       NX_TFTP_OPTION_WINDOW_SIZE;
+        }
+        else
+        {
+
+            /* Unknown options are ignored.  */
+            continue;
+        }
+
+        /* Option names are case insensitive.  */
+        for (i = 0; i < name_length; i++)
+        {
+            if ((UCHAR)(name_ptr[i] | 0x20) != (UCHAR)option_name[i])
+            {
+                break;
+            }
+        }
+
+        /* Ignore the option if the name does not match, or the value is invalid.  */
+        if ((i != name_length) || 
+            (_nx_utility_string_to_uint((CHAR *)value_ptr, value_length, &value) != NX_SUCCESS))
+        {
+            continue;
+        }
+
+        if (option == NX_TFTP_OPTION_BLOCK_SIZE)
+        {
+
+            /* Check the block size against the range of RFC 2348.  */
+            if ((value < NX_TFTP_MIN_BLOCK_SIZE) || (value > NX_TFTP_MAX_BLOCK_SIZE))
+            {
+                continue;
+            }
+
+            /* Reply with a smaller block size if that is all we can accommodate.  */
+            if (value > max_block_size)
+            {
+                value =  (UINT)max_block_size;
+            }
+
+            client_request_ptr -> nx_tftp_client_request_block_size =  value;
+        }
+        else
+        {
+
+            /* Check the window size against the range of RFC 7440.  */
+            if ((value == 0) || (value > NX_TFTP_MAX_WINDOW_SIZE))
+            {
+                continue;
+            }
+
+            /* Reply with a smaller window size if that is all we can accommodate.  */
+            if (value > NX_TFTP_SERVER_MAX_WINDOW_SIZE)
+            {
+                value =  NX_TFTP_SERVER_MAX_WINDOW_SIZE;
+            }
+
+            client_request_ptr -> nx_tftp_client_request_window_size =  value;
+        }
+
+        /* Remember the option so it is acknowledged.  */
+        options |=  option;
+    }
+
+    /* Save the options to acknowledge.  */
+    client_request_ptr -> nx_tftp_client_request_options =  options;
+
+    return(options);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tftp_server_send_oack                           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends an option acknowledgement (OACK) with the       */
+/*    options accepted from the client request.  On error it will close   */
+/*    the file and the client request.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    server_ptr                            Pointer to TFTP server        */
+/*    client_request_ptr                    Pointer to Client request     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    fx_file_close                         Close file on error           */
+/*    nx_packet_allocate                    Allocate a new packet         */
+/*    nx_packet_release                     Release packet                */
+/*    nxd_udp_socket_send                   Send TFTP OACK packet         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tftp_server_open_for_read_process                               */
+/*                                          Process open for read request */
+/*    _nx_tftp_server_open_for_write_process                              */
+/*                                                                        */
+/*                                          Process open for write request*/
+/*    _nx_tftp_server_timer_process         TFTP timeout event            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tftp_server_send_oack(NX_TFTP_SERVER *server_ptr, NX_TFTP_CLIENT_REQUEST *client_request_ptr)
+{
+
+UINT        status;
+UINT        i;
+UINT        j;
+UINT        value;
+UINT        digits;
+CHAR        *option_name;
+UCHAR       *buffer_ptr;
+NX_PACKET   *new_packet;
+
+
+   /* Allocate packet for the OACK.  Determine whether we are sending IP packets.   */
+    if (client_request_ptr -> nx_tftp_client_request_ip_address.nxd_ip_version == NX_IP_VERSION_V4)
+    {
+        status =  nx_packet_allocate(server_ptr -> nx_tftp_server_packet_pool_ptr, &new_packet, NX_IPv4_UDP_PACKET, NX_WAIT_FOREVER);
+    }
+    else
+    {
+        status =  nx_packet_allocate(server_ptr -> nx_tftp_server_packet_pool_ptr, &new_packet, NX_IPv6_UDP_PACKET, NX_WAIT_FOREVER);
+    }
+
+    /* Check for successful packet allocation.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Increment the number of server allocation errors.  */
+        server_ptr -> nx_tftp_server_allocation_errors++;
+
+        /* Unable to allocate net packet, release the original.  */
+        fx_file_close(&(client_request_ptr -> nx_tftp_client_request_file));
+
+        memset(client_request_ptr, 0, sizeof(NX_TFTP_CLIENT_REQUEST));
+
+        return status;
+    }
+
+    /* The OACK holds the code and at most two options, each value having up to five digits.  */
+    if (2u + sizeof("blksize") + 6u + sizeof("windowsize") + 6u > ((ULONG)(new_packet -> nx_packet_data_end) - (ULONG)(new_packet -> nx_packet_append_ptr)))
+    {
+        nx_packet_release(new_packet);
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Now build the OACK message to the client.  */
+    buffer_ptr =  new_packet -> nx_packet_prepend_ptr;
+    *buffer_ptr++ =  0;
+    *buffer_ptr++ =  NX_TFTP_CODE_OACK;
+
+    /* Place each accepted option with the value the server will use.  */
+    for (i = 0; i < 2; i++)
+    {
+
+        if (i == 0)
+        {
+            if ((client_request_ptr -> nx_tftp_client_request_options & NX_TFTP_OPTION_BLOCK_SIZE) == 0)
+            {
+                continue;
+            }
+
+            option_name =  "blksize";
+            value =  client_request_ptr -> nx_tftp_client_request_block_size;
+        }
+        else
+        {
+            if ((client_request_ptr -> nx_tftp_client_request_options & NX_TFTP_OPTION_WINDOW_SIZE) == 0)
+            {
+                continue;
+            }
+
+            option_name =  "windowsize";
+            value =  client_request_ptr -> nx_tftp_client_request_window_size;
+        }
+
+        /* Place the option name, followed by a NULL.  */
+        while (*option_name)
+        {
+            *buffer_ptr++ =  (UCHAR)*option_name++;
+        }
+        *buffer_ptr++ =  NX_NULL;
+
+        /* Place the option value in decimal, followed by a NULL.  */
+        digits =  1;
+        for (j = value; j >= 10; j = j / 10)
+        {
+            digits++;
+        }
+        for (j = digits; j > 0; j--)
+        {
+            buffer_ptr[j - 1] =  (UCHAR)('0' + (value % 10));
+            value =  value / 10;
+        }
+        buffer_ptr +=  digits;
+        *buffer_ptr++ =  NX_NULL;
+    }
+
+    /* Setup the packet pointers appropriately.  */
+    new_packet -> nx_packet_length =  (ULONG)(buffer_ptr - new_packet -> nx_packet_prepend_ptr);
+    new_packet -> nx_packet_append_ptr =  buffer_ptr;
+
+    /* Send the OACK packet out.  */
+    status = nxd_udp_socket_send(&(server_ptr -> nx_tftp_server_socket), new_packet, &client_request_ptr -> nx_tftp_client_request_ip_address, 
+                                 client_request_ptr -> nx_tftp_client_request_port);
+
+    /* Release packet if send fails. */
+    if (status)
+    {
+        nx_packet_release(new_packet);
+    }
+
+    return NX_SUCCESS;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tftp_server_send_window                         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends data packets until the window of blocks not     */
+/*    acknowledged is full, or the end of the file is sent.  If blocks    */
+/*    past the last acknowledged block have already been sent, it first   */
+/*    goes back to the first block not acknowledged so they are sent      */
+/*    again.  On error it will close the file and the client request.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    server_ptr                            Pointer to TFTP server        */
+/*    client_request_ptr                    Pointer to Client request     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    fx_file_close                         Close file on error           */
+/*    fx_file_seek                          Set location in file          */
+/*    _nx_tftp_server_send_data             Send TFTP data packet         */
+/*    _nx_tftp_server_send_error            Send error status to Client   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tftp_server_open_for_read_process                               */
+/*                                          Process open for read request */
+/*    _nx_tftp_server_ack_process           Process a received ACK        */
+/*    _nx_tftp_server_timer_process         TFTP timeout event            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tftp_server_send_window(NX_TFTP_SERVER *server_ptr, NX_TFTP_CLIENT_REQUEST *client_request_ptr)
+{
+
+UINT    status = NX_SUCCESS;
+
+
+    /* Determine if blocks past the last acknowledged block have been sent.  */
+    if (client_request_ptr -> nx_tftp_client_request_block_number != client_request_ptr -> nx_tftp_client_request_window_block)
+    {
+
+        /* Yes, they were lost or the client wants them again.  Go back to the first block
+           not acknowledged, and send the window from there.  */
+        status =  fx_file_seek(&(client_request_ptr -> nx_tftp_client_request_file), client_request_ptr -> nx_tftp_client_request_window_offset);
+
+        if (status != NX_SUCCESS)
+        {
+
+            /* Send an error back to the client.  */
+            _nx_tftp_server_send_error(server_ptr, &client_request_ptr -> nx_tftp_client_request_ip_address, 
+                                       client_request_ptr -> nx_tftp_client_request_port, 
+                                       NX_TFTP_ERROR_NOT_DEFINED, "NetX TFTP Server: File Read Error");
+
+            /* Unable to seek in the file, close it and delete the client request.  */
+            fx_file_close(&(client_request_ptr -> nx_tftp_client_request_file));
+
+            memset(client_request_ptr, 0, sizeof(NX_TFTP_CLIENT_REQUEST));
+
+            return status;
+        }
+
+        client_request_ptr -> nx_tftp_client_request_block_number =    client_request_ptr -> nx_tftp_client_request_window_block;
+        client_request_ptr -> nx_tftp_client_request_remaining_bytes = client_request_ptr -> nx_tftp_client_file_size - 
+                                                                       client_request_ptr -> nx_tftp_client_request_window_offset;
+
+        /* The zero-length data packet is needed again if the rest divides evenly into blocks.  */
+        if (client_request_ptr -> nx_tftp_client_request_remaining_bytes % client_request_ptr -> nx_tftp_client_request_block_size)
+        {
+            client_request_ptr -> nx_tftp_client_request_exact_fit =  NX_FALSE;
+        }
+        else
+        {
+            client_request_ptr -> nx_tftp_client_request_exact_fit =  NX_TRUE;
+        }
+    }
+
+    /* Send blocks until the window is full or the end of the file is sent.  */
+    while (((USHORT)(client_request_ptr -> nx_tftp_client_request_block_number - client_request_ptr -> nx_tftp_client_request_window_block) <
+            client_request_ptr -> nx_tftp_client_request_window_size) &&
+           (client_request_ptr -> nx_tftp_client_request_remaining_bytes || client_request_ptr -> nx_tftp_client_request_exact_fit))
+    {
+
+        status =  _nx_tftp_server_send_data(server_ptr, client_request_ptr, NX_FALSE);
+
+        /* Stop if the block could not be sent.  */
+        if (status != NX_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    return status;
+}
+
+
 /**************************************************************************/ 
 /*                                                                        */ 
 /*  FUNCTION                                               RELEASE        */ 
@@ -26,8 +26,8 @@
 /*                                                                        */ 
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */ 
 /*                                                                        */ 
-/*    nxd_tftp_server.h                                   PORTABLE C      */ 
-/*                                                           6.1          */
+/*    nxd_tftp_server.h                                   PORTABLE C      */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -46,6 +46,10 @@
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            block size and window size  */
+/*                                            option negotiation,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -152,11 +156,27 @@ extern   "C" {
 #endif /* NX_TFTP_SERVER_RETRANSMIT_ENABLE */
 
  
+#ifndef NX_TFTP_QUEUE_DEPTH
 #define NX_TFTP_QUEUE_DEPTH                 5
+#endif
         
 #define NX_TFTP_FILE_TRANSFER_MAX           512         /* 512 byte maximum file transfer                     */
 
 
+/* Define the largest block size (RFC 2348) and window size (RFC 7440) the TFTP Server accepts
+   when a client requests them.  The block size is further limited so that each data packet
+   fits in one packet of the server packet pool.  Received windows are queued on the server
+   socket, so a window size larger than NX_TFTP_QUEUE_DEPTH may cause drops and retransmits.  */
+
+#ifndef NX_TFTP_SERVER_MAX_BLOCK_SIZE
+#define NX_TFTP_SERVER_MAX_BLOCK_SIZE       1428
+#endif
+
+#ifndef NX_TFTP_SERVER_MAX_WINDOW_SIZE
+#define NX_TFTP_SERVER_MAX_WINDOW_SIZE      NX_TFTP_QUEUE_DEPTH
+#endif
+
+
 /* Derive the maximum TFTP packet size, including Ethernet, IP and UDP headers, and  
    accounting for potential physical driver needs at the end of the packet.  */
 
@@ -176,6 +196,16 @@ extern   "C" {
 #define NX_TFTP_CODE_DATA                   0x03        /* TFTP data packet                                     */ 
 #define NX_TFTP_CODE_ACK                    0x04        /* TFTP command/data acknowledgement                    */ 
 #define NX_TFTP_CODE_ERROR                  0x05        /* TFTP error message                                   */ 
+#define NX_TFTP_CODE_OACK                   0x06        /* TFTP option acknowledgement                          */ 
+
+
+/* Define TFTP options (RFC 2347) and their limits.  */
+
+#define NX_TFTP_OPTION_BLOCK_SIZE           0x01        /* Block size option, RFC 2348                          */
+#define NX_TFTP_OPTION_WINDOW_SIZE          0x02        /* Window size option, RFC 7440                         */
+#define NX_TFTP_MIN_BLOCK_SIZE              8           /* Minimum block size                                   */
+#define NX_TFTP_MAX_BLOCK_SIZE              65464       /* Maximum block size                                   */
+#define NX_TFTP_MAX_WINDOW_SIZE             65535       /* Maximum window size                                  */
 
 
 /* Define TFTP error code constants.  */
@@ -251,6 +281,12 @@ typedef struct NX_TFTP_CLIENT_REQUEST_STRUCT
     FX_FILE         nx_tftp_client_request_file;                    /* File control block                   */ 
     ULONG           nx_tftp_client_file_size;                       /* Size of file in bytes                */ 
     ULONG           nx_tftp_client_previous_write_size;             /* Size of data in last data packet     */ 
+    UINT            nx_tftp_client_request_block_size;              /* Negotiated block size                */
+    UINT            nx_tftp_client_request_window_size;             /* Negotiated window size               */
+    UINT            nx_tftp_client_request_options;                 /* Options acknowledged by OACK         */
+    USHORT          nx_tftp_client_request_window_block;            /* Last block acknowledged              */
+    USHORT          nx_tftp_client_request_window_count;            /* Blocks received since last ACK       */
+    ULONG           nx_tftp_client_request_window_offset;           /* File offset after last acknowledged  */
 #ifdef NX_TFTP_SERVER_RETRANSMIT_ENABLE
     UINT            nx_tftp_client_retransmit_timeout;              /* Time between retransmits from server */ 
     UINT            nx_tftp_client_retransmit_retries;              /* Number of retries on current data,ACK*/
@@ -373,6 +409,9 @@ VOID        _nx_tftp_server_data_present(NX_UDP_SOCKET *socket_ptr);
 VOID        _nx_tftp_server_process_received_data(NX_TFTP_SERVER *server_ptr);
 UINT        _nx_tftp_server_send_data(NX_TFTP_SERVER *server_ptr, NX_TFTP_CLIENT_REQUEST *client_request_ptr, UINT retransmit);
 UINT        _nx_tftp_server_send_ack(NX_TFTP_SERVER *server_ptr, NX_TFTP_CLIENT_REQUEST *client_request_ptr, UINT retransmit);
+UINT        _nx_tftp_server_send_oack(NX_TFTP_SERVER *server_ptr, NX_TFTP_CLIENT_REQUEST *client_request_ptr);
+UINT        _nx_tftp_server_send_window(NX_TFTP_SERVER *server_ptr, NX_TFTP_CLIENT_REQUEST *client_request_ptr);
+UINT        _nx_tftp_server_options_parse(NX_TFTP_SERVER *server_ptr, NX_TFTP_CLIENT_REQUEST *client_request_ptr, NX_PACKET *packet_ptr);
 #ifdef NX_TFTP_SERVER_RETRANSMIT_ENABLE
 VOID        _nx_tftp_server_timer_process(NX_TFTP_SERVER *server_ptr);
 VOID        _nx_tftp_server_timer_entry(ULONG tftp_server_address);
@@ -45,7 +45,7 @@ static VOID _nx_tcpserver_thread_entry(ULONG tcpserver_address);
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_tcpserver_session_allocate                       PORTABLE C     */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -82,6 +82,9 @@ static VOID _nx_tcpserver_thread_entry(ULONG tcpserver_address);
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
 /*                                            fixed packet leak issue,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            pending data reset,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_tcpserver_session_allocate(NX_TCPSERVER *server_ptr, NX_TCP_SESSION **session_pptr)
@@ -114,6 +117,9 @@ NX_TCP_SOCKET  *socket_ptr;
             /* Set connection flag to false. */
             server_ptr -> nx_tcpserver_sessions[i].nx_tcp_session_connected = NX_FALSE;
 
+            /* Clear data pending flag. */
+            server_ptr -> nx_tcpserver_sessions[i].nx_tcp_session_data_pending = NX_FALSE;
+
             /* Return the socket. */
             *session_pptr = &server_ptr -> nx_tcpserver_sessions[i];
             return NX_SUCCESS;
@@ -215,7 +221,7 @@ NX_TCP_SESSION *session_ptr;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    nx_tcpserver_create                                  PORTABLE C     */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -284,6 +290,9 @@ NX_TCP_SESSION *session_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            ready queue initialization, */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_tcpserver_create(NX_IP *ip_ptr, NX_TCPSERVER *server_ptr, CHAR *name, 
@@ -310,6 +319,8 @@ UINT            status;
     server_ptr -> nx_tcpserver_connection_timeout = connection_timeout;
     server_ptr -> nx_tcpserver_timeout = timeout;
     server_ptr -> nx_tcpserver_accept_wait_option = accept_wait_option;
+    server_ptr -> nx_tcpserver_ready_head = NX_NULL;
+    server_ptr -> nx_tcpserver_ready_tail = NX_NULL;
 
     /* Create the tcpserver thread. */
     status = tx_thread_create(&server_ptr -> nx_tcpserver_thread, "TCPSERVER Thread",
@@ -686,7 +697,7 @@ NX_TCPSERVER *server_ptr = socket_ptr -> nx_tcp_socket_reserved_ptr;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_tcpserver_data_present                           PORTABLE C     */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -695,7 +706,9 @@ NX_TCPSERVER *server_ptr = socket_ptr -> nx_tcp_socket_reserved_ptr;
 /*                                                                        */
 /*    This internal function is used for the TCP receive callback passed  */
 /*    into nx_tcp_socket_receive_notify and is used to determine when     */
-/*    data has been received and is ready for processing.                 */
+/*    data has been received and is ready for processing. The session of  */
+/*    the socket is appended to the queue of sessions with received data, */
+/*    so the server thread does not scan all sessions.                    */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -720,11 +733,38 @@ NX_TCPSERVER *server_ptr = socket_ptr -> nx_tcp_socket_reserved_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            queue of sessions with data,*/
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID _nx_tcpserver_data_present(NX_TCP_SOCKET *socket_ptr)
 {
-NX_TCPSERVER *server_ptr = socket_ptr -> nx_tcp_socket_reserved_ptr;
+NX_TCPSERVER   *server_ptr = socket_ptr -> nx_tcp_socket_reserved_ptr;
+NX_TCP_SESSION *session_ptr;
+TX_INTERRUPT_SAVE_AREA
+
+    /* The socket is the first member of the session. */
+    session_ptr = (NX_TCP_SESSION *)socket_ptr;
+
+    /* Disable interrupts. */
+    TX_DISABLE
+
+    /* Append the session to the ready queue if it is not queued yet. */
+    if(session_ptr -> nx_tcp_session_ready == NX_FALSE)
+    {
+        session_ptr -> nx_tcp_session_ready = NX_TRUE;
+        session_ptr -> nx_tcp_session_ready_next = NX_NULL;
+
+        if(server_ptr -> nx_tcpserver_ready_tail)
+            server_ptr -> nx_tcpserver_ready_tail -> nx_tcp_session_ready_next = session_ptr;
+        else
+            server_ptr -> nx_tcpserver_ready_head = session_ptr;
+        server_ptr -> nx_tcpserver_ready_tail = session_ptr;
+    }
+
+    /* Restore interrupts. */
+    TX_RESTORE
 
     /* Set the data event flag. */
     tx_event_flags_set(&server_ptr -> nx_tcpserver_event_flags, NX_TCPSERVER_DATA, TX_OR);
@@ -980,7 +1020,7 @@ NX_TCP_SESSION *session_ptr = NX_NULL;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_tcpserver_data_process                           PORTABLE C     */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -991,6 +1031,11 @@ NX_TCP_SESSION *session_ptr = NX_NULL;
 /*    data is received from the remote client. If the application passes  */
 /*    a receive callback to _nx_tcpserver_create, it will be invoked here.*/
 /*                                                                        */
+/*    Only sessions in the ready queue are processed, in the order data   */
+/*    arrived. A session whose callback left data pending, or consumed    */
+/*    only part of the data on its socket, is appended to the queue again */
+/*    so other sessions are served in between.                            */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    server_ptr                            Pointer to socket server      */
@@ -1002,6 +1047,9 @@ NX_TCP_SESSION *session_ptr = NX_NULL;
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    nx_tcpserver_receive_data             Callback to process data      */
+/*    _nx_tcpserver_relisten                Relisten on a free session    */
+/*    _nx_tcpserver_data_present            Queue session with data       */
+/*    tx_event_flags_set                    Set thread event flag         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1014,12 +1062,18 @@ NX_TCP_SESSION *session_ptr = NX_NULL;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            queue of sessions with data,*/
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID _nx_tcpserver_data_process(NX_TCPSERVER *server_ptr)
 {
 UINT            i;
+ULONG           receive_queue_count;
+NX_TCP_SESSION *session_ptr;
 NX_TCP_SOCKET  *socket_ptr;
+TX_INTERRUPT_SAVE_AREA
 
     /* Do nothing if callback is not set. */
     if(server_ptr -> nx_tcpserver_receive_data == NX_NULL)
@@ -1027,24 +1081,58 @@ NX_TCP_SOCKET  *socket_ptr;
         return;
     }
 
-    /* Initialize TCP sockets. */
+    /* Process at most one session per slot, so requeued sessions do not starve other events. */
     for(i = 0; i < server_ptr -> nx_tcpserver_sessions_count; i++)
     {
-        socket_ptr = &(server_ptr -> nx_tcpserver_sessions[i].nx_tcp_session_socket);
 
-        if(socket_ptr -> nx_tcp_socket_receive_queue_count)
+        /* Disable interrupts. */
+        TX_DISABLE
+
+        /* Remove the first session from the ready queue. */
+        session_ptr = server_ptr -> nx_tcpserver_ready_head;
+        if(session_ptr == NX_NULL)
+        {
+
+            /* Restore interrupts. */
+            TX_RESTORE
+            break;
+        }
+
+        server_ptr -> nx_tcpserver_ready_head = session_ptr -> nx_tcp_session_ready_next;
+        if(server_ptr -> nx_tcpserver_ready_head == NX_NULL)
+            server_ptr -> nx_tcpserver_ready_tail = NX_NULL;
+        session_ptr -> nx_tcp_session_ready = NX_FALSE;
+
+        /* Restore interrupts. */
+        TX_RESTORE
+
+        socket_ptr = &(session_ptr -> nx_tcp_session_socket);
+        receive_queue_count = socket_ptr -> nx_tcp_socket_receive_queue_count;
+
+        if(receive_queue_count || session_ptr -> nx_tcp_session_data_pending)
         {
 
             /* Reset default expiration. */
-            server_ptr -> nx_tcpserver_sessions[i].nx_tcp_session_expiration = server_ptr -> nx_tcpserver_timeout;
+            session_ptr -> nx_tcp_session_expiration = server_ptr -> nx_tcpserver_timeout;
 
             /* Invoke receive data callback. */
-            server_ptr -> nx_tcpserver_receive_data(server_ptr, &server_ptr -> nx_tcpserver_sessions[i]);
+            server_ptr -> nx_tcpserver_receive_data(server_ptr, session_ptr);
 
             /* Relisten */
             _nx_tcpserver_relisten(server_ptr);
+
+            /* Queue the session again if the callback left data to process, either kept in the session
+               or still on the socket after the callback consumed part of it. */
+            if(session_ptr -> nx_tcp_session_data_pending ||
+               (socket_ptr -> nx_tcp_socket_receive_queue_count &&
+                (socket_ptr -> nx_tcp_socket_receive_queue_count < receive_queue_count)))
+                _nx_tcpserver_data_present(socket_ptr);
         }
     }
+
+    /* Set the data event flag again if sessions are still queued. */
+    if(server_ptr -> nx_tcpserver_ready_head)
+        tx_event_flags_set(&server_ptr -> nx_tcpserver_event_flags, NX_TCPSERVER_DATA, TX_OR);
 }
 
 /**************************************************************************/
@@ -1143,6 +1231,10 @@ NX_TCP_SOCKET  *socket_ptr;
 /*    If the application passes  a disconnect callback to                 */
 /*    _nx_tcpserver_create, it will be invoked here.                      */
 /*                                                                        */
+/*    Sessions that still have data on their socket but are not in the    */
+/*    ready queue, because their callback left the data unread, are       */
+/*    queued again here so the data is not stuck until more arrives.      */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    server_ptr                            Pointer to socket server      */
@@ -1155,6 +1247,7 @@ NX_TCP_SOCKET  *socket_ptr;
 /*                                                                        */
 /*    nx_tcpserver_connection_timeout       Callback to process timeout   */
 /*    _nx_tcpserver_relisten                Re-listen on free sockets     */
+/*    _nx_tcpserver_data_present            Queue session with data       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1168,6 +1261,9 @@ NX_TCP_SOCKET  *socket_ptr;
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
 /*                                            fixed packet leak issue,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), queued   */
+/*                                            sessions with unread data,  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static VOID _nx_tcpserver_timeout_process(NX_TCPSERVER *server_ptr)
@@ -1175,6 +1271,23 @@ static VOID _nx_tcpserver_timeout_process(NX_TCPSERVER *server_ptr)
 UINT            i;
 NX_TCP_SESSION *session_ptr;
 
+    /* Rescan sessions that still have data received but are not queued. */
+    if(server_ptr -> nx_tcpserver_receive_data)
+    {
+        for(i = 0; i < server_ptr -> nx_tcpserver_sessions_count; i++)
+        {
+            session_ptr = &server_ptr -> nx_tcpserver_sessions[i];
+
+            if((session_ptr -> nx_tcp_session_ready == NX_FALSE) &&
+               (session_ptr -> nx_tcp_session_socket.nx_tcp_socket_receive_queue_count))
+            {
+
+                /* Queue the session for the data processing. */
+                _nx_tcpserver_data_present(&session_ptr -> nx_tcp_session_socket);
+            }
+        }
+    }
+
     /* Do nothing if callback is not set. */
     if(server_ptr -> nx_tcpserver_connection_timeout == NX_NULL)
     {
@@ -24,7 +24,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_tcpserver.h                                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -42,6 +42,10 @@
 /*  09-30-2020     Yuxin Zhou               Modified comment(s), and      */
 /*                                            fixed packet leak issue,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            queue of sessions with      */
+/*                                            received data,              */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -102,6 +106,17 @@ typedef struct NX_TCP_SESSION_STRUCT
     /* Reserved value for passing data to/from individual sessions. */
     ULONG                   nx_tcp_session_reserved;
 
+    /* Next session in the queue of sessions with received data. */
+    struct NX_TCP_SESSION_STRUCT
+                           *nx_tcp_session_ready_next;
+
+    /* Flag set to NX_TRUE while the session is in the queue. */
+    UINT                    nx_tcp_session_ready;
+
+    /* Flag set to NX_TRUE by the receive callback if it holds received data
+       that is not processed yet, so the session is processed again. */
+    UINT                    nx_tcp_session_data_pending;
+
 #ifdef NX_TCPSERVER_ENABLE_TLS
     /* Flag set to NX_TRUE if using TLS. */
     UINT                    nx_tcp_session_using_tls;
@@ -129,6 +144,8 @@ typedef struct NX_TCPSERVER_STRUCT
     VOID                  (*nx_tcpserver_receive_data)(struct NX_TCPSERVER_STRUCT *server_ptr, NX_TCP_SESSION *session_ptr);
     VOID                  (*nx_tcpserver_connection_end)(struct NX_TCPSERVER_STRUCT *server_ptr, NX_TCP_SESSION *session_ptr);
     VOID                  (*nx_tcpserver_connection_timeout)(struct NX_TCPSERVER_STRUCT *server_ptr, NX_TCP_SESSION *session_ptr);
+    NX_TCP_SESSION         *nx_tcpserver_ready_head;
+    NX_TCP_SESSION         *nx_tcpserver_ready_tail;
     ULONG                   nx_tcpserver_reserved;
 } NX_TCPSERVER;
 
@@ -2608,7 +2608,7 @@ UINT        status;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_web_http_client_request_packet_send             PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -2632,6 +2632,7 @@ UINT        status;
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_web_http_client_send              Send data to server           */
+/*    _nx_web_http_client_flush             Send coalesced TLS records    */
 /*    _nx_web_http_client_error_exit        Cleanup and shut down HTTPS   */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -2645,6 +2646,9 @@ UINT        status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), flushed  */
+/*                                            coalesced TLS records,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_web_http_client_request_packet_send(NX_WEB_HTTP_CLIENT *client_ptr, NX_PACKET *packet_ptr, UINT more_data, ULONG wait_option)
@@ -2700,6 +2704,21 @@ UINT        length = packet_ptr -> nx_packet_length;
     /* Update the transferred bytes.  */
     client_ptr -> nx_web_http_client_actual_bytes_transferred += length;
 
+    /* Send the request now if this is the last part of the content.  */
+    if (!more_data)
+    {
+        status = _nx_web_http_client_flush(client_ptr, wait_option);
+        if (status != NX_SUCCESS)
+        {
+
+            /* Disconnect and unbind the socket.  */
+            _nx_web_http_client_error_exit(client_ptr, wait_option);
+
+            /* Return an error.  */
+            return(status);
+        }
+    }
+
     return(NX_SUCCESS);
 }
 
@@ -5818,7 +5837,7 @@ UINT         header_size;
 /*  FUNCTION                                               RELEASE        */ 
 /*                                                                        */ 
 /*    _nx_web_http_client_put_packet                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -5845,6 +5864,7 @@ UINT         header_size;
 /*    nx_packet_release                     Release the packet            */
 /*    _nx_web_http_client_error_exit        Shutdown connection           */
 /*    _nx_web_http_client_send              Send data to server           */
+/*    _nx_web_http_client_flush             Send coalesced TLS records    */
 /*                                                                        */ 
 /*  CALLED BY                                                             */ 
 /*                                                                        */ 
@@ -5857,6 +5877,9 @@ UINT         header_size;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), flushed  */
+/*                                            coalesced TLS records,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_web_http_client_put_packet(NX_WEB_HTTP_CLIENT *client_ptr, NX_PACKET *packet_ptr, ULONG wait_option)
@@ -5954,6 +5977,24 @@ UINT        status;
     /* Otherwise, update the actual bytes transferred.  */
     client_ptr ->  nx_web_http_client_actual_bytes_transferred =  client_ptr ->  nx_web_http_client_actual_bytes_transferred + length;
 
+    /* Send the request now if all the content has been sent.  */
+    if (client_ptr -> nx_web_http_client_actual_bytes_transferred == client_ptr -> nx_web_http_client_total_transfer_bytes)
+    {
+        status = _nx_web_http_client_flush(client_ptr, wait_option);
+        if (status != NX_SUCCESS)
+        {
+
+            /* Disconnect and unbind the socket.  */
+            _nx_web_http_client_error_exit(client_ptr, wait_option);
+
+            /* Return to the READY state.  */
+            client_ptr -> nx_web_http_client_state =  NX_WEB_HTTP_CLIENT_STATE_READY;
+
+            /* Return an error.  */
+            return(status);
+        }
+    }
+
     /* Return status to caller.  */
     return(NX_SUCCESS);
 }
@@ -7862,7 +7903,7 @@ UINT        status;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_web_http_client_request_send                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -7888,6 +7929,7 @@ UINT        status;
 /*    nx_packet_data_append                 Append packet data            */
 /*    nx_packet_release                     release packet                */
 /*    _nx_web_http_client_error_exit        Cleanup and shut down HTTPS   */
+/*    _nx_web_http_client_flush             Send coalesced TLS records    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -7900,6 +7942,9 @@ UINT        status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), flushed  */
+/*                                            coalesced TLS records,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_web_http_client_request_send(NX_WEB_HTTP_CLIENT *client_ptr, ULONG wait_option)
@@ -7944,6 +7989,21 @@ CHAR        crlf[2] = {13,10};
         return(status);
     }
 
+    /* Send the request now if it has no content to follow.  */
+    if (client_ptr -> nx_web_http_client_total_transfer_bytes == client_ptr -> nx_web_http_client_actual_bytes_transferred)
+    {
+        status = _nx_web_http_client_flush(client_ptr, wait_option);
+        if (status != NX_SUCCESS)
+        {
+
+            /* Disconnect and unbind the socket.  */
+            _nx_web_http_client_error_exit(client_ptr, wait_option);
+
+            /* Return an error.  */
+            return(status);
+        }
+    }
+
     /* Set the appropriate state. */
     switch(client_ptr -> nx_web_http_client_method)
     {
@@ -8311,6 +8371,67 @@ UINT        status;
     return(status);
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_web_http_client_flush                           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends any request data held back by TLS record        */
+/*    coalescing once the request is complete, so the request is not      */
+/*    delayed while the client waits or polls for the response. It does   */
+/*    nothing for plain HTTP.                                             */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to HTTP client        */
+/*    wait_option                           Indicates behavior if data    */
+/*                                             cannot be sent.            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_tls_session_flush           Send coalesced TLS records    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_web_http_client_put_packet                                      */
+/*    _nx_web_http_client_request_send                                    */
+/*    _nx_web_http_client_request_packet_send                             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_web_http_client_flush(NX_WEB_HTTP_CLIENT *client_ptr, ULONG wait_option)
+{
+
+#ifdef NX_WEB_HTTPS_ENABLE
+    if(client_ptr -> nx_web_http_client_is_https)
+    {
+        return(nx_secure_tls_session_flush(&(client_ptr -> nx_web_http_client_tls_session), wait_option));
+    }
+#else
+    NX_PARAMETER_NOT_USED(client_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+#endif
+
+    return(NX_SUCCESS);
+}
+
 
 /**************************************************************************/
 /*                                                                        */
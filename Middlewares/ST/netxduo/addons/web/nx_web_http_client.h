@@ -641,6 +641,7 @@ UINT        _nx_web_http_client_content_length_header_add(NX_WEB_HTTP_CLIENT *cl
 VOID        _nx_web_http_client_error_exit(NX_WEB_HTTP_CLIENT *client_ptr, UINT wait_option);
 UINT        _nx_web_http_client_receive(NX_WEB_HTTP_CLIENT *client_ptr, NX_PACKET **packet_ptr, ULONG wait_option);
 UINT        _nx_web_http_client_send(NX_WEB_HTTP_CLIENT *client_ptr, NX_PACKET *packet_ptr, ULONG wait_option);
+UINT        _nx_web_http_client_flush(NX_WEB_HTTP_CLIENT *client_ptr, ULONG wait_option);
 UINT        _nx_web_http_client_get_server_response(NX_WEB_HTTP_CLIENT *client_ptr, NX_PACKET **packet_ptr, ULONG wait_option);
 VOID        _nx_web_http_client_cleanup(NX_WEB_HTTP_CLIENT *client_ptr);
 UINT        _nx_web_http_client_memicmp(UCHAR *src, ULONG src_length, UCHAR *dest, ULONG dest_length);
@@ -1448,7 +1448,7 @@ UINT    status;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_web_http_server_delete                          PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -1477,6 +1477,8 @@ UINT    status;
 /*    tx_thread_suspend                     Suspend the HTTP server thread*/
 /*    tx_thread_terminate                   Terminate the HTTP server     */
 /*                                            thread                      */
+/*    _nx_web_http_server_session_request_release                         */
+/*                                          Release kept request          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1489,12 +1491,24 @@ UINT    status;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            request state release,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_web_http_server_delete(NX_WEB_HTTP_SERVER *http_server_ptr)
 {
 UINT status;
 NX_TCPSERVER *tcpserver_ptr = &(http_server_ptr -> nx_web_http_server_tcpserver);
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+UINT j;
+
+    /* Release the requests kept in the sessions.  */
+    for(j = 0; j < tcpserver_ptr -> nx_tcpserver_sessions_count; j++)
+    {
+        _nx_web_http_server_session_request_release(http_server_ptr, &(tcpserver_ptr -> nx_tcpserver_sessions[j]));
+    }
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
 
 
 #ifdef NX_WEB_HTTPS_ENABLE
@@ -3001,7 +3015,7 @@ NX_WEB_HTTP_SERVER *server_ptr;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_web_http_server_connection_present              PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3036,6 +3050,7 @@ NX_WEB_HTTP_SERVER *server_ptr;
 /*    _nx_web_http_server_delete_process    Process DELETE request        */
 /*    _nx_web_http_server_response_packet_allocate                        */
 /*                                          Allocate a response packet    */
+/*    nx_secure_tls_session_flush           Send coalesced TLS records    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -3048,6 +3063,11 @@ NX_WEB_HTTP_SERVER *server_ptr;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            concurrent request support, */
+/*                                            flushed coalesced TLS       */
+/*                                            records after a response,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_web_http_server_receive_data(NX_TCPSERVER *tcpserver_ptr, NX_TCP_SESSION *session_ptr)
@@ -3069,6 +3089,17 @@ NX_PACKET               *response_pkt;
     /* Get the complete HTTP client request.  */
     status =  _nx_web_http_server_get_client_request(server_ptr, &packet_ptr);
 
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+
+    /* Check if the request header is not complete yet.  */
+    if (status == NX_IN_PROGRESS)
+    {
+
+        /* Return and wait for more data of this session.  */
+        return;
+    }
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
+
     /* Check if the HTTP request is valid.  */
     if (status == NX_SUCCESS)
     {
@@ -3261,6 +3292,23 @@ NX_PACKET               *response_pkt;
         server_ptr -> nx_web_http_server_response_chunked = NX_FALSE;
     }
 
+#ifdef NX_WEB_HTTPS_ENABLE
+
+    /* The response is complete. Send data held back by TLS record coalescing now,
+       the next receive on this session may not wait.  */
+    if (server_ptr -> nx_web_http_is_https_server)
+    {
+        status = nx_secure_tls_session_flush(&(session_ptr -> nx_tcp_session_tls_session), NX_WEB_HTTP_SERVER_TIMEOUT_SEND);
+        if (status)
+        {
+
+            /* Disconnect from the current connection.  */
+            _nx_web_http_server_connection_disconnect(server_ptr, session_ptr, NX_WEB_HTTP_SERVER_TIMEOUT_DISCONNECT);
+            return;
+        }
+    }
+#endif /* NX_WEB_HTTPS_ENABLE */
+
 #ifndef NX_WEB_HTTP_KEEPALIVE_DISABLE
     if(server_ptr -> nx_web_http_server_keepalive == NX_FALSE)
     {
@@ -3281,7 +3329,7 @@ NX_PACKET               *response_pkt;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_web_http_server_get_client_request              PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -3292,6 +3340,14 @@ NX_PACKET               *response_pkt;
 /*    packet.  Doing this makes the other parsing and searching           */
 /*    routines simple.                                                    */
 /*                                                                        */
+/*    If NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE is defined, the function    */
+/*    does not wait for data. An incomplete request header is kept in the */
+/*    session together with the scan position, and NX_IN_PROGRESS is      */
+/*    returned. The scan resumes where it stopped once more data arrives. */
+/*    The request is returned once its header is complete. The content    */
+/*    is read by the request handler as usual, and data following the     */
+/*    end of the content is kept in the session as the next request.      */
+/*                                                                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -3309,6 +3365,13 @@ NX_PACKET               *response_pkt;
 /*    nx_packet_data_append                 Move data into packet         */
 /*    nx_packet_release                     Release packet                */
 /*    nx_tcp_socket_receive                 Receive an HTTP request packet*/
+/*    _nx_web_http_server_content_length_get                              */
+/*                                          Get content length            */
+/*    _nx_web_http_server_chunked_check     Check if the packet is chunked*/
+/*    _nx_web_http_server_request_content_scan                            */
+/*                                          Find the end of the content   */
+/*    _nx_web_http_server_pipelined_request_save                          */
+/*                                          Keep pipelined request        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*    _nx_web_http_server_receive_data                                    */
@@ -3320,6 +3383,9 @@ NX_PACKET               *response_pkt;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            concurrent request state,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_web_http_server_get_client_request(NX_WEB_HTTP_SERVER *server_ptr, NX_PACKET **packet_ptr)
@@ -3332,11 +3398,71 @@ UINT        status;
 NX_PACKET   *work_ptr;
 UINT        crlf_found = 0;
 NX_PACKET   *tmp_ptr;
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+NX_TCP_SESSION                     *session_ptr;
+NX_WEB_HTTP_SERVER_SESSION_REQUEST *request_ptr;
+UCHAR                              *append_ptr;
+ULONG                               content_length;
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
 
 
     /* Default the return packet pointer to NULL.  */
     *packet_ptr =  NX_NULL;
 
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+
+    /* Get the request state of the current session.  */
+    session_ptr = server_ptr -> nx_web_http_server_current_session_ptr;
+    request_ptr = &(server_ptr -> nx_web_http_server_session_request[session_ptr - server_ptr -> nx_web_http_server_tcpserver.nx_tcpserver_sessions]);
+
+    /* Skip the content the previous request did not read.  */
+    while (request_ptr -> nx_web_http_server_session_request_content_state != NX_WEB_HTTP_SERVER_CONTENT_NONE)
+    {
+        status = _nx_web_http_server_receive(server_ptr, &head_packet_ptr, NX_NO_WAIT);
+        if (status == NX_NO_PACKET)
+        {
+            return(NX_IN_PROGRESS);
+        }
+        else if (status != NX_SUCCESS)
+        {
+            return(status);
+        }
+
+        /* Any data following the content is kept as the next request.  */
+        nx_packet_release(head_packet_ptr);
+    }
+    session_ptr -> nx_tcp_session_data_pending = NX_FALSE;
+
+    /* Check for a partial or pipelined request kept in the session.  */
+    head_packet_ptr = request_ptr -> nx_web_http_server_session_request_packet;
+    if (head_packet_ptr)
+    {
+
+        /* Take the request from the session.  */
+        request_ptr -> nx_web_http_server_session_request_packet = NX_NULL;
+    }
+    else
+    {
+
+        /* Get the request data received so far.  */
+        status = _nx_web_http_server_receive(server_ptr, &head_packet_ptr, NX_NO_WAIT);
+
+        /* Check the return status.  */
+        if (status != NX_SUCCESS)
+        {
+
+            /* Data may be an incomplete TLS record, wait for more.  */
+            if (status == NX_NO_PACKET)
+            {
+                return(NX_IN_PROGRESS);
+            }
+
+            /* Return an error condition.  */
+            return(status);
+        }
+    }
+#else
+
     /* Wait for a request on the HTTP TCP well known port 80, or if encryption is enabled 443.  */
     status = _nx_web_http_server_receive(server_ptr, &head_packet_ptr, NX_WEB_HTTP_SERVER_TIMEOUT_RECEIVE);
 
@@ -3349,6 +3475,7 @@ NX_PACKET   *tmp_ptr;
         /* Return an error condition.  */
         return(status);
     }
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
 
     /* Setup pointer to start of buffer.  */
     buffer_ptr =  (CHAR *) head_packet_ptr -> nx_packet_prepend_ptr;
@@ -3368,11 +3495,25 @@ NX_PACKET   *tmp_ptr;
         return(NX_WEB_HTTP_ERROR);
     }
 
-    crlf_found = 0;
-    work_ptr = head_packet_ptr;
-    
-    /* Build a pointer to the buffer area.  */
-    buffer_ptr =  (CHAR *) work_ptr -> nx_packet_prepend_ptr; 
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+
+    /* Resume the scan of a partial request where it stopped.  */
+    if (request_ptr -> nx_web_http_server_session_request_scan_packet)
+    {
+        crlf_found = request_ptr -> nx_web_http_server_session_request_crlf_found;
+        work_ptr = request_ptr -> nx_web_http_server_session_request_scan_packet;
+        buffer_ptr = request_ptr -> nx_web_http_server_session_request_scan_ptr;
+        request_ptr -> nx_web_http_server_session_request_scan_packet = NX_NULL;
+    }
+    else
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
+    {
+        crlf_found = 0;
+        work_ptr = head_packet_ptr;
+
+        /* Build a pointer to the buffer area.  */
+        buffer_ptr =  (CHAR *) work_ptr -> nx_packet_prepend_ptr; 
+    }
     
     do
     {
@@ -3404,6 +3545,44 @@ NX_PACKET   *tmp_ptr;
             {
     
                 /* Yes, we have found the end of the HTTP request header.  */
+
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+
+                /* Only check the header of this request for content.  */
+                append_ptr = work_ptr -> nx_packet_append_ptr;
+                work_ptr -> nx_packet_append_ptr = (UCHAR *)(buffer_ptr + 1);
+                _nx_web_http_server_content_length_get(head_packet_ptr, &content_length);
+                if (_nx_web_http_server_chunked_check(head_packet_ptr))
+                {
+                    request_ptr -> nx_web_http_server_session_request_content_state = NX_WEB_HTTP_SERVER_CONTENT_CHUNK_SIZE;
+                    request_ptr -> nx_web_http_server_session_request_content_remaining = 0;
+                }
+                else if (content_length)
+                {
+                    request_ptr -> nx_web_http_server_session_request_content_state = NX_WEB_HTTP_SERVER_CONTENT_LENGTH;
+                    request_ptr -> nx_web_http_server_session_request_content_remaining = content_length;
+                }
+                work_ptr -> nx_packet_append_ptr = append_ptr;
+
+                if (request_ptr -> nx_web_http_server_session_request_content_state != NX_WEB_HTTP_SERVER_CONTENT_NONE)
+                {
+
+                    /* Scan the content received with the header. The rest of the content is read
+                       by the request handler and scanned as it is received.  */
+                    status = _nx_web_http_server_request_content_scan(server_ptr, head_packet_ptr, work_ptr, buffer_ptr + 1);
+                    if (status != NX_SUCCESS)
+                    {
+                        nx_packet_release(head_packet_ptr);
+                        return(status);
+                    }
+                }
+                else
+                {
+
+                    /* Keep the data following a request without content as the next pipelined request.  */
+                    _nx_web_http_server_pipelined_request_save(server_ptr, head_packet_ptr, work_ptr, buffer_ptr + 1);
+                }
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
     
                 /* Set the return packet pointer.  */
                 *packet_ptr =  head_packet_ptr;
@@ -3430,8 +3609,28 @@ NX_PACKET   *tmp_ptr;
            
 #endif         
         {
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+
+            /* Get the data received so far.  */
+            status = _nx_web_http_server_receive(server_ptr, &new_packet_ptr, NX_NO_WAIT);
+
+            /* Check if the rest of the header has not arrived yet.  */
+            if (status == NX_NO_PACKET)
+            {
+
+                /* Keep the partial request and the scan position in the session.  */
+                request_ptr -> nx_web_http_server_session_request_packet = head_packet_ptr;
+                request_ptr -> nx_web_http_server_session_request_scan_packet = work_ptr;
+                request_ptr -> nx_web_http_server_session_request_scan_ptr = buffer_ptr;
+                request_ptr -> nx_web_http_server_session_request_crlf_found = crlf_found;
+
+                /* Process other sessions until more data arrives.  */
+                return(NX_IN_PROGRESS);
+            }
+#else
             /* Receive another packet from the HTTP server port.  */            
             status = _nx_web_http_server_receive(server_ptr, &new_packet_ptr, NX_WEB_HTTP_SERVER_TIMEOUT_RECEIVE);
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
             
             /* Check the return status.  */
             if (status != NX_SUCCESS)
@@ -3488,6 +3687,488 @@ NX_PACKET   *tmp_ptr;
 }
 
 
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_web_http_server_request_content_scan            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function scans request content as it is received, by its       */
+/*    length or by its chunks, to find the end of the request. The data   */
+/*    is not copied, and the scan state is kept in the session between    */
+/*    packets. Once the end is found, the data following it is kept as    */
+/*    the next pipelined request and removed from the packet.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    server_ptr                        HTTP Server pointer               */
+/*    packet_ptr                        Packet being scanned              */
+/*    work_ptr                          Packet the scan starts in         */
+/*    buffer_ptr                        Position the scan starts at       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_web_http_server_pipelined_request_save                          */
+/*                                      Keep pipelined request            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_web_http_server_get_client_request                              */
+/*                                      Get complete HTTP request         */
+/*    _nx_web_http_server_receive       Receive packet                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_web_http_server_request_content_scan(NX_WEB_HTTP_SERVER *server_ptr, NX_PACKET *packet_ptr, NX_PACKET *work_ptr, CHAR *buffer_ptr)
+{
+
+NX_WEB_HTTP_SERVER_SESSION_REQUEST *request_ptr;
+NX_TCP_SESSION                     *session_ptr;
+ULONG                               remaining;
+ULONG                               length;
+UINT                                state;
+UINT                                crlf_found;
+UINT                                status = NX_SUCCESS;
+CHAR                                ch;
+
+
+    /* Get the request state of the current session.  */
+    session_ptr = server_ptr -> nx_web_http_server_current_session_ptr;
+    request_ptr = &(server_ptr -> nx_web_http_server_session_request[session_ptr - server_ptr -> nx_web_http_server_tcpserver.nx_tcpserver_sessions]);
+    state = request_ptr -> nx_web_http_server_session_request_content_state;
+    remaining = request_ptr -> nx_web_http_server_session_request_content_remaining;
+    crlf_found = request_ptr -> nx_web_http_server_session_request_crlf_found;
+
+    while (state != NX_WEB_HTTP_SERVER_CONTENT_NONE)
+    {
+
+        /* Scan the data of the current packet.  */
+        while ((state != NX_WEB_HTTP_SERVER_CONTENT_NONE) && (buffer_ptr < (CHAR *) work_ptr -> nx_packet_append_ptr))
+        {
+
+            if ((state == NX_WEB_HTTP_SERVER_CONTENT_LENGTH) || (state == NX_WEB_HTTP_SERVER_CONTENT_CHUNK_DATA))
+            {
+
+                /* Skip the content data in this packet.  */
+                length = (ULONG)((CHAR *) work_ptr -> nx_packet_append_ptr - buffer_ptr);
+                if (length > remaining)
+                {
+                    length = remaining;
+                }
+                buffer_ptr += length;
+                remaining -= length;
+
+                if (remaining == 0)
+                {
+
+                    /* The content ends here, or the CR/LF following the chunk data is next.  */
+                    if (state == NX_WEB_HTTP_SERVER_CONTENT_LENGTH)
+                    {
+                        state = NX_WEB_HTTP_SERVER_CONTENT_NONE;
+                    }
+                    else
+                    {
+                        state = NX_WEB_HTTP_SERVER_CONTENT_CHUNK_DATA_CR;
+                    }
+                }
+                continue;
+            }
+
+            ch = *buffer_ptr++;
+
+            switch (state)
+            {
+
+            case NX_WEB_HTTP_SERVER_CONTENT_CHUNK_SIZE:
+
+                /* Calculate the chunk size.  */
+                if (ch == (CHAR)13)
+                {
+                    state = NX_WEB_HTTP_SERVER_CONTENT_CHUNK_SIZE_LF;
+                    break;
+                }
+                else if (ch == ';')
+                {
+                    state = NX_WEB_HTTP_SERVER_CONTENT_CHUNK_EXT;
+                    break;
+                }
+                else if ((ch >= '0') && (ch <= '9'))
+                {
+                    length = (ULONG)(ch - '0');
+                }
+                else if ((ch >= 'a') && (ch <= 'f'))
+                {
+                    length = (ULONG)(ch - 'a') + 10;
+                }
+                else if ((ch >= 'A') && (ch <= 'F'))
+                {
+                    length = (ULONG)(ch - 'A') + 10;
+                }
+                else
+                {
+                    status = NX_WEB_HTTP_ERROR;
+                    break;
+                }
+
+                /* Check for a chunk size that does not fit.  */
+                if (remaining > 0x0FFFFFFF)
+                {
+                    status = NX_WEB_HTTP_ERROR;
+                    break;
+                }
+                remaining = (remaining << 4) + length;
+                break;
+
+            case NX_WEB_HTTP_SERVER_CONTENT_CHUNK_EXT:
+
+                /* Skip the chunk extension.  */
+                if (ch == (CHAR)13)
+                {
+                    state = NX_WEB_HTTP_SERVER_CONTENT_CHUNK_SIZE_LF;
+                }
+                break;
+
+            case NX_WEB_HTTP_SERVER_CONTENT_CHUNK_SIZE_LF:
+
+                if (ch != (CHAR)10)
+                {
+                    status = NX_WEB_HTTP_ERROR;
+                }
+                else if (remaining)
+                {
+                    state = NX_WEB_HTTP_SERVER_CONTENT_CHUNK_DATA;
+                }
+                else
+                {
+
+                    /* The last chunk, the content ends with an empty line after the optional trailer.  */
+                    state = NX_WEB_HTTP_SERVER_CONTENT_TRAILER;
+                    crlf_found = 2;
+                }
+                break;
+
+            case NX_WEB_HTTP_SERVER_CONTENT_CHUNK_DATA_CR:
+
+                if (ch != (CHAR)13)
+                {
+                    status = NX_WEB_HTTP_ERROR;
+                }
+                else
+                {
+                    state = NX_WEB_HTTP_SERVER_CONTENT_CHUNK_DATA_LF;
+                }
+                break;
+
+            case NX_WEB_HTTP_SERVER_CONTENT_CHUNK_DATA_LF:
+
+                if (ch != (CHAR)10)
+                {
+                    status = NX_WEB_HTTP_ERROR;
+                }
+                else
+                {
+                    state = NX_WEB_HTTP_SERVER_CONTENT_CHUNK_SIZE;
+                }
+                break;
+
+            default:
+
+                /* Search the trailer for the empty line the same way as the header.  */
+                if (!(crlf_found & 1) && (ch == (CHAR)13))
+                {
+                    crlf_found++;
+                }
+                else if ((crlf_found & 1) && (ch == (CHAR)10))
+                {
+                    crlf_found++;
+                }
+                else
+                {
+                    crlf_found = 0;
+                }
+
+                if (crlf_found == 4)
+                {
+                    state = NX_WEB_HTTP_SERVER_CONTENT_NONE;
+                }
+                break;
+            }
+
+            /* Check for an invalid chunk.  */
+            if (status == NX_WEB_HTTP_ERROR)
+            {
+                request_ptr -> nx_web_http_server_session_request_content_state = NX_WEB_HTTP_SERVER_CONTENT_NONE;
+                return(NX_WEB_HTTP_ERROR);
+            }
+        }
+
+        /* Check if the end of the request is found.  */
+        if (state == NX_WEB_HTTP_SERVER_CONTENT_NONE)
+        {
+            break;
+        }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+
+        if (work_ptr -> nx_packet_next != NX_NULL)
+        {
+
+            /* Get the next packet in the chain. */
+            work_ptr  = work_ptr -> nx_packet_next;
+            buffer_ptr =  (CHAR *) work_ptr -> nx_packet_prepend_ptr;
+            continue;
+        }
+#endif
+
+        /* The rest of the content is in the packets to come, keep the scan state.  */
+        request_ptr -> nx_web_http_server_session_request_crlf_found = crlf_found;
+        request_ptr -> nx_web_http_server_session_request_content_state = state;
+        request_ptr -> nx_web_http_server_session_request_content_remaining = remaining;
+
+        return(NX_SUCCESS);
+    }
+
+    /* The request is complete.  */
+    request_ptr -> nx_web_http_server_session_request_content_state = NX_WEB_HTTP_SERVER_CONTENT_NONE;
+
+    /* Keep the data following the content as the next pipelined request.  */
+    _nx_web_http_server_pipelined_request_save(server_ptr, packet_ptr, work_ptr, buffer_ptr);
+
+    return(NX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_web_http_server_pipelined_request_save          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks the data following a complete request. The     */
+/*    data is the next pipelined request. It is moved to a new packet     */
+/*    that is kept in the session, and the session is marked so the TCP   */
+/*    server processes it again.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    server_ptr                        HTTP Server pointer               */
+/*    packet_ptr                        Request packet pointer            */
+/*    work_ptr                          Packet with the request end       */
+/*    request_end_ptr                   End of the request                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_allocate                Allocate a packet                 */
+/*    nx_packet_data_append             Move data into packet             */
+/*    nx_packet_release                 Release packet                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_web_http_server_get_client_request                              */
+/*                                      Get complete HTTP request         */
+/*    _nx_web_http_server_request_content_scan                            */
+/*                                      Find the end of the content       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_web_http_server_pipelined_request_save(NX_WEB_HTTP_SERVER *server_ptr, NX_PACKET *packet_ptr, NX_PACKET *work_ptr, CHAR *request_end_ptr)
+{
+
+NX_WEB_HTTP_SERVER_SESSION_REQUEST *request_ptr;
+NX_TCP_SESSION                     *session_ptr;
+NX_PACKET                          *next_packet_ptr = NX_NULL;
+NX_PACKET                          *new_packet_ptr;
+NX_PACKET                          *tmp_ptr;
+UCHAR                              *append_ptr;
+CHAR                               *data_ptr;
+ULONG                               length;
+UINT                                status;
+
+
+    /* Skip empty lines between requests.  */
+    data_ptr = request_end_ptr;
+    while ((data_ptr < (CHAR *)work_ptr -> nx_packet_append_ptr) && ((*data_ptr == (CHAR)13) || (*data_ptr == (CHAR)10)))
+    {
+        data_ptr++;
+    }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+    next_packet_ptr = work_ptr -> nx_packet_next;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+    /* Check if any data follows the request.  */
+    if ((data_ptr == (CHAR *)work_ptr -> nx_packet_append_ptr) && (next_packet_ptr == NX_NULL))
+    {
+        return;
+    }
+
+    /* Move the data of the next request to a new packet.  */
+    append_ptr = work_ptr -> nx_packet_append_ptr;
+    status = nx_packet_allocate(server_ptr -> nx_web_http_server_packet_pool_ptr, &new_packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    if (status != NX_SUCCESS)
+    {
+
+        /* The pipelined request is dropped.  */
+        server_ptr -> nx_web_http_server_allocation_errors++;
+        return;
+    }
+
+    status = nx_packet_data_append(new_packet_ptr, data_ptr, (ULONG)((CHAR *)append_ptr - data_ptr),
+                                   server_ptr -> nx_web_http_server_packet_pool_ptr, NX_NO_WAIT);
+
+    /* Remove the data following the request from the request packet.  */
+    length = (ULONG)(append_ptr - (UCHAR *)request_end_ptr);
+    work_ptr -> nx_packet_append_ptr = (UCHAR *)request_end_ptr;
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+    if (next_packet_ptr)
+    {
+
+        /* Move the data of the following packets as well.  */
+        for (tmp_ptr = next_packet_ptr; tmp_ptr != NX_NULL; tmp_ptr = tmp_ptr -> nx_packet_next)
+        {
+            if (status == NX_SUCCESS)
+            {
+                status = nx_packet_data_append(new_packet_ptr, tmp_ptr -> nx_packet_prepend_ptr,
+                                               (ULONG)(tmp_ptr -> nx_packet_append_ptr - tmp_ptr -> nx_packet_prepend_ptr),
+                                               server_ptr -> nx_web_http_server_packet_pool_ptr, NX_NO_WAIT);
+            }
+            length += (ULONG)(tmp_ptr -> nx_packet_append_ptr - tmp_ptr -> nx_packet_prepend_ptr);
+        }
+
+        /* Unlink and release the following packets.  */
+        work_ptr -> nx_packet_next = NX_NULL;
+        if (work_ptr == packet_ptr)
+        {
+            packet_ptr -> nx_packet_last = NX_NULL;
+        }
+        else
+        {
+            packet_ptr -> nx_packet_last = work_ptr;
+        }
+        nx_packet_release(next_packet_ptr);
+    }
+#else
+    NX_PARAMETER_NOT_USED(tmp_ptr);
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+    packet_ptr -> nx_packet_length -= length;
+
+    if (status != NX_SUCCESS)
+    {
+
+        /* The pipelined request is dropped.  */
+        server_ptr -> nx_web_http_server_allocation_errors++;
+        nx_packet_release(new_packet_ptr);
+        return;
+    }
+
+    /* Keep the next request in the session.  */
+    session_ptr = server_ptr -> nx_web_http_server_current_session_ptr;
+    request_ptr = &(server_ptr -> nx_web_http_server_session_request[session_ptr - server_ptr -> nx_web_http_server_tcpserver.nx_tcpserver_sessions]);
+    request_ptr -> nx_web_http_server_session_request_packet = new_packet_ptr;
+    request_ptr -> nx_web_http_server_session_request_scan_packet = NX_NULL;
+
+    /* Let the TCP server process the session again, the data is already received.  */
+    session_ptr -> nx_tcp_session_data_pending = NX_TRUE;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_web_http_server_session_request_release         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases the partial or pipelined request kept in the */
+/*    session when the connection is closed.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    server_ptr                        HTTP Server pointer               */
+/*    session_ptr                       Pointer to session                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_release                 Release packet                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_web_http_server_connection_disconnect                           */
+/*                                                                        */
+/*                                      Disconnect connection             */
+/*    _nx_web_http_server_delete        Delete the HTTP Server            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_web_http_server_session_request_release(NX_WEB_HTTP_SERVER *server_ptr, NX_TCP_SESSION *session_ptr)
+{
+
+NX_WEB_HTTP_SERVER_SESSION_REQUEST *request_ptr;
+
+
+    /* Get the request state of the session.  */
+    request_ptr = &(server_ptr -> nx_web_http_server_session_request[session_ptr - server_ptr -> nx_web_http_server_tcpserver.nx_tcpserver_sessions]);
+
+    /* Release the request kept in the session.  */
+    if (request_ptr -> nx_web_http_server_session_request_packet)
+    {
+        nx_packet_release(request_ptr -> nx_web_http_server_session_request_packet);
+        request_ptr -> nx_web_http_server_session_request_packet = NX_NULL;
+    }
+    request_ptr -> nx_web_http_server_session_request_scan_packet = NX_NULL;
+    request_ptr -> nx_web_http_server_session_request_content_state = NX_WEB_HTTP_SERVER_CONTENT_NONE;
+    session_ptr -> nx_tcp_session_data_pending = NX_FALSE;
+}
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -10585,7 +11266,7 @@ NX_SECURE_TLS_SESSION *tls_session;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_web_http_server_receive                         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -10595,6 +11276,9 @@ NX_SECURE_TLS_SESSION *tls_session;
 /*    This function receives data from the remote host using either the   */
 /*    TCP socket for plain HTTP or the TLS session for HTTPS.             */
 /*                                                                        */
+/*    If NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE is defined, request content */
+/*    is scanned as it is received, so data following the content is      */
+/*    kept as the next pipelined request instead of being returned.       */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -10611,6 +11295,8 @@ NX_SECURE_TLS_SESSION *tls_session;
 /*                                                                        */
 /*    nx_secure_tls_session_receive            Receive data using TLS     */
 /*    nx_secure_tcp_socket_receive             Receive data using TCP     */
+/*    _nx_web_http_server_request_content_scan                            */
+/*                                             Find the end of the content*/
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -10628,6 +11314,10 @@ NX_SECURE_TLS_SESSION *tls_session;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), scanned  */
+/*                                            request content in          */
+/*                                            concurrent mode,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_web_http_server_receive(NX_WEB_HTTP_SERVER *server_ptr, NX_PACKET **packet_ptr, ULONG wait_option)
@@ -10638,6 +11328,9 @@ NX_TCP_SOCKET *tcp_socket;
 #ifdef NX_WEB_HTTPS_ENABLE
 NX_SECURE_TLS_SESSION *tls_session;
 #endif
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+NX_WEB_HTTP_SERVER_SESSION_REQUEST *request_ptr;
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
 
     tcp_socket = &(server_ptr -> nx_web_http_server_current_session_ptr -> nx_tcp_session_socket);
 
@@ -10655,6 +11348,24 @@ NX_SECURE_TLS_SESSION *tls_session;
         status = nx_tcp_socket_receive(tcp_socket, packet_ptr, wait_option);
     }
 
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+
+    /* Check if the packet is part of the request content.  */
+    request_ptr = &(server_ptr -> nx_web_http_server_session_request[server_ptr -> nx_web_http_server_current_session_ptr -
+                                                                      server_ptr -> nx_web_http_server_tcpserver.nx_tcpserver_sessions]);
+    if ((status == NX_SUCCESS) &&
+        (request_ptr -> nx_web_http_server_session_request_content_state != NX_WEB_HTTP_SERVER_CONTENT_NONE))
+    {
+
+        /* Find the end of the content in the packet.  */
+        status = _nx_web_http_server_request_content_scan(server_ptr, *packet_ptr, *packet_ptr, (CHAR *)(*packet_ptr) -> nx_packet_prepend_ptr);
+        if (status != NX_SUCCESS)
+        {
+            nx_packet_release(*packet_ptr);
+        }
+    }
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
+
     /* Return status.  */
     return(status);
 }
@@ -10730,7 +11441,7 @@ NX_TCP_SOCKET *tcp_socket;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_web_http_server_connection_disconnect           PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -10755,6 +11466,8 @@ NX_TCP_SOCKET *tcp_socket;
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_secure_tls_session_end            End TLS session               */
+/*    _nx_web_http_server_session_request_release                         */
+/*                                          Release kept request          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -10767,6 +11480,9 @@ NX_TCP_SOCKET *tcp_socket;
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            request state release,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID _nx_web_http_server_connection_disconnect(NX_WEB_HTTP_SERVER *server_ptr, NX_TCP_SESSION *session_ptr, UINT wait_option)
@@ -10783,6 +11499,12 @@ NX_SECURE_TLS_SESSION *tls_session;
 
     tcp_socket = &(session_ptr -> nx_tcp_session_socket);
 
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+
+    /* Release the request kept in the session.  */
+    _nx_web_http_server_session_request_release(server_ptr, session_ptr);
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
+
 #ifdef NX_WEB_HTTPS_ENABLE
 
     tls_session = &(session_ptr -> nx_tcp_session_tls_session);
@@ -27,7 +27,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_web_http_server.h                                PORTABLE C      */
-/*                                                           6.1.6        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -50,6 +50,9 @@
 /*                                            improved the logic of       */
 /*                                            parsing base64,             */
 /*                                            resulting in version 6.1.6  */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            per-session request state,  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -97,6 +100,14 @@ extern   "C" {
 #define NX_WEB_HTTP_DIGEST_ENABLE
 */
 
+/* Enable concurrent request processing. A partially received request header is kept in its
+   session and the server thread serves other sessions instead of waiting for the rest of it.
+   Request content is not buffered; the request handler reads it as usual, waiting up to
+   NX_WEB_HTTP_SERVER_TIMEOUT_RECEIVE. Data following the end of the content is kept, so
+   pipelined requests with or without content are processed in order.
+#define NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+*/
+
 /* Define HTTP TCP socket create options.  */
 #ifndef NX_WEB_HTTP_SERVER_PRIORITY
 #define NX_WEB_HTTP_SERVER_PRIORITY             4
@@ -244,6 +255,34 @@ typedef struct NX_WEB_HTTP_SERVER_MULTIPART_STRUCT
 } NX_WEB_HTTP_SERVER_MULTIPART;
 
 
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+
+/* Define the request state kept for each session.  */
+
+typedef struct NX_WEB_HTTP_SERVER_SESSION_REQUEST_STRUCT
+{
+    NX_PACKET      *nx_web_http_server_session_request_packet;          /* Partial or pipelined request         */
+    NX_PACKET      *nx_web_http_server_session_request_scan_packet;     /* Packet the header scan stopped in    */
+    CHAR           *nx_web_http_server_session_request_scan_ptr;        /* Position the header scan stopped at  */
+    UINT            nx_web_http_server_session_request_crlf_found;      /* CR/LF count of the header scan       */
+    UINT            nx_web_http_server_session_request_content_state;   /* Scan state of the request content    */
+    ULONG           nx_web_http_server_session_request_content_remaining;
+                                                                        /* Content or chunk bytes left to scan  */
+} NX_WEB_HTTP_SERVER_SESSION_REQUEST;
+
+/* Define the scan states of the request content.  */
+
+#define NX_WEB_HTTP_SERVER_CONTENT_NONE            0
+#define NX_WEB_HTTP_SERVER_CONTENT_LENGTH          1
+#define NX_WEB_HTTP_SERVER_CONTENT_CHUNK_SIZE      2
+#define NX_WEB_HTTP_SERVER_CONTENT_CHUNK_EXT       3
+#define NX_WEB_HTTP_SERVER_CONTENT_CHUNK_SIZE_LF   4
+#define NX_WEB_HTTP_SERVER_CONTENT_CHUNK_DATA      5
+#define NX_WEB_HTTP_SERVER_CONTENT_CHUNK_DATA_CR   6
+#define NX_WEB_HTTP_SERVER_CONTENT_CHUNK_DATA_LF   7
+#define NX_WEB_HTTP_SERVER_CONTENT_TRAILER         8
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
+
 /* Define the HTTP Server data structure.  */
 
 typedef struct NX_WEB_HTTP_SERVER_STRUCT
@@ -271,6 +310,11 @@ typedef struct NX_WEB_HTTP_SERVER_STRUCT
     NX_TCP_SESSION *nx_web_http_server_current_session_ptr;             /* Current session in process           */
     UCHAR           nx_web_http_server_session_buffer[NX_WEB_HTTP_SERVER_SESSION_BUFFER_SIZE];
                                                                     /* Size of session buffer               */
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+    NX_WEB_HTTP_SERVER_SESSION_REQUEST
+                    nx_web_http_server_session_request[NX_WEB_HTTP_SERVER_SESSION_BUFFER_SIZE / sizeof(NX_TCP_SESSION)];
+                                                                        /* Request state of each session        */
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
 
     NX_TCP_SOCKET   nx_web_http_server_socket;                          /* HTTP Server TCP socket               */
     UINT            nx_web_http_server_listen_port;                     /* HTTP(S) listening port.              */
@@ -594,6 +638,12 @@ VOID        _nx_web_http_server_receive_data(NX_TCPSERVER *tcpserver_ptr, NX_TCP
 VOID        _nx_web_http_server_connection_end(NX_TCPSERVER *tcpserver_ptr, NX_TCP_SESSION *session_ptr);
 VOID        _nx_web_http_server_connection_timeout(NX_TCPSERVER *tcpserver_ptr, NX_TCP_SESSION *session_ptr);
 
+#ifdef NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE
+UINT        _nx_web_http_server_request_content_scan(NX_WEB_HTTP_SERVER *server_ptr, NX_PACKET *packet_ptr, NX_PACKET *work_ptr, CHAR *buffer_ptr);
+VOID        _nx_web_http_server_pipelined_request_save(NX_WEB_HTTP_SERVER *server_ptr, NX_PACKET *packet_ptr, NX_PACKET *work_ptr, CHAR *request_end_ptr);
+VOID        _nx_web_http_server_session_request_release(NX_WEB_HTTP_SERVER *server_ptr, NX_TCP_SESSION *session_ptr);
+#endif /* NX_WEB_HTTP_SERVER_CONCURRENT_ENABLE */
+
 
 #ifndef NX_WEB_HTTP_KEEPALIVE_DISABLE
 VOID        _nx_web_http_server_get_client_keepalive(NX_WEB_HTTP_SERVER *server_ptr, NX_PACKET *packet_ptr);
@@ -645,6 +645,13 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_IP_ROUTING_TABLE_SIZE    8
 #endif /* NX_IP_ROUTING_TABLE_SIZE */
 
+/* Define the maximum number of receive worker threads per IP instance.  */
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+#ifndef NX_IP_RECEIVE_WORKER_MAX
+#define NX_IP_RECEIVE_WORKER_MAX    4
+#endif /* NX_IP_RECEIVE_WORKER_MAX */
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+
 /* For backward compatibility, map the smbol NX_RAW_PACKET_FILTER_ENABLE to
    NX_ENABLE_IP_RAW_PACKET_FILTER. */
 #ifdef NX_RAW_PACKET_FILTER_ENABLE
@@ -1772,6 +1779,22 @@ typedef struct NX_UDP_SOCKET_STRUCT
 } NX_UDP_SOCKET;
 
 
+/* Define the UDP message structure used by the batched UDP socket send and
+   receive services.  Each entry carries one datagram and its peer.  */
+
+typedef struct NX_UDP_MESSAGE_STRUCT
+{
+
+    /* Define the datagram packet.  */
+    NX_PACKET   *nx_udp_message_packet_ptr;
+
+    /* Define the peer address and port.  For send, this is the destination;
+       for receive, it is filled in with the source of the datagram.  */
+    NXD_ADDRESS nx_udp_message_address;
+    UINT        nx_udp_message_port;
+} NX_UDP_MESSAGE;
+
+
 /* Determine if the TCP control block has an extension defined. If not, 
    define the extension to whitespace.  */
 
@@ -2303,6 +2326,33 @@ typedef struct NX_IPV6_MULTICAST_STRUCT
 #endif /* NX_ENABLE_IPV6_MULTICAST  */
 
 
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+/* Define the IP receive worker structure.  Deferred IP packets are steered to
+   a worker by flow hash so that packets of the same flow are always processed
+   in order by the same thread.  */
+
+typedef struct NX_IP_RECEIVE_WORKER_STRUCT
+{
+
+    /* Define the worker thread and the event flags used to wake it up.  */
+    TX_THREAD   nx_ip_receive_worker_thread;
+    TX_EVENT_FLAGS_GROUP
+                nx_ip_receive_worker_events;
+
+    /* Define the per-worker deferred receive packet queue.  */
+    NX_PACKET   *nx_ip_receive_worker_packet_head,
+                *nx_ip_receive_worker_packet_tail;
+
+    /* Define the number of packets processed by this worker.  */
+    ULONG       nx_ip_receive_worker_packets_processed;
+
+    /* Define the IP instance that owns this worker.  */
+    struct NX_IP_STRUCT
+                *nx_ip_receive_worker_ip_ptr;
+} NX_IP_RECEIVE_WORKER;
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+
+
 /* Determine if the IP control block has an extension defined. If not, 
    define the extension to whitespace.  */
 
@@ -2494,6 +2544,14 @@ typedef struct NX_IP_STRUCT
     NX_PACKET   *nx_ip_deferred_received_packet_head,
                 *nx_ip_deferred_received_packet_tail;
 
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+    /* Define the receive workers that share deferred packet processing with
+       the IP helper thread, along with the number of active workers.  */
+    NX_IP_RECEIVE_WORKER
+                nx_ip_receive_worker[NX_IP_RECEIVE_WORKER_MAX];
+    UINT        nx_ip_receive_worker_count;
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+
     /* Define the raw IP function pointer that also indicates whether or
        not raw IP packet sending and receiving is enabled.  */
     UINT        (*nx_ip_raw_ip_processing)(struct NX_IP_STRUCT *, ULONG, NX_PACKET *);
@@ -3047,6 +3105,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_ip_interface_status_check                    _nx_ip_interface_status_check
 #define nx_ip_link_status_change_notify_set             _nx_ip_link_status_change_notify_set
 #define nx_ip_max_payload_size_find                     _nx_ip_max_payload_size_find
+#define nx_ip_receive_workers_enable                    _nx_ip_receive_workers_enable
 #define nx_ip_status_check                              _nx_ip_status_check
 #define nx_ip_static_route_add                          _nx_ip_static_route_add
 #define nx_ip_static_route_delete                       _nx_ip_static_route_delete
@@ -3147,6 +3206,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_udp_free_port_find                           _nx_udp_free_port_find
 #define nx_udp_info_get                                 _nx_udp_info_get
 #define nx_udp_packet_info_extract                      _nx_udp_packet_info_extract
+#define nx_udp_socket_batch_receive                     _nx_udp_socket_batch_receive
 #define nx_udp_socket_bind                              _nx_udp_socket_bind
 #define nx_udp_socket_bytes_available                   _nx_udp_socket_bytes_available
 #define nx_udp_socket_checksum_disable                  _nx_udp_socket_checksum_disable
@@ -3162,6 +3222,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_udp_socket_unbind                            _nx_udp_socket_unbind
 #define nx_udp_source_extract                           _nx_udp_source_extract
 #define nxd_udp_packet_info_extract                     _nxd_udp_packet_info_extract
+#define nxd_udp_socket_batch_send                       _nxd_udp_socket_batch_send
 #define nxd_udp_socket_send                             _nxd_udp_socket_send
 #define nxd_udp_socket_source_send                      _nxd_udp_socket_source_send
 #define nxd_udp_source_extract                          _nxd_udp_source_extract
@@ -3235,6 +3296,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_ip_interface_status_check                    _nxe_ip_interface_status_check
 #define nx_ip_link_status_change_notify_set             _nxe_ip_link_status_change_notify_set
 #define nx_ip_max_payload_size_find                     _nxe_ip_max_payload_size_find
+#define nx_ip_receive_workers_enable                    _nxe_ip_receive_workers_enable
 #define nx_ip_status_check                              _nxe_ip_status_check
 #define nx_ip_static_route_add                          _nxe_ip_static_route_add
 #define nx_ip_static_route_delete                       _nxe_ip_static_route_delete
@@ -3334,6 +3396,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_udp_free_port_find                           _nxe_udp_free_port_find
 #define nx_udp_info_get                                 _nxe_udp_info_get
 #define nx_udp_packet_info_extract                      _nxe_udp_packet_info_extract
+#define nx_udp_socket_batch_receive                     _nxe_udp_socket_batch_receive
 #define nx_udp_socket_bind                              _nxe_udp_socket_bind
 #define nx_udp_socket_bytes_available                   _nxe_udp_socket_bytes_available
 #define nx_udp_socket_checksum_disable                  _nxe_udp_socket_checksum_disable
@@ -3349,6 +3412,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_udp_socket_unbind                            _nxe_udp_socket_unbind
 #define nx_udp_source_extract                           _nxe_udp_source_extract
 #define nxd_udp_packet_info_extract                     _nxde_udp_packet_info_extract
+#define nxd_udp_socket_batch_send                       _nxde_udp_socket_batch_send
 #define nxd_udp_socket_send(s, p, i, t)                 _nxde_udp_socket_send(s, &p, i, t)
 #define nxd_udp_socket_source_send                      _nxde_udp_socket_source_send
 #define nxd_udp_source_extract                          _nxde_udp_source_extract
@@ -3458,6 +3522,7 @@ UINT nx_ip_link_status_change_notify_set(NX_IP *ip_ptr,
 UINT nx_ip_max_payload_size_find(NX_IP *ip_ptr, NXD_ADDRESS *dest_address, UINT if_index,
                                  UINT src_port, UINT dest_port, ULONG protocol, ULONG *start_offset_ptr,
                                  ULONG *payload_length_ptr);
+UINT nx_ip_receive_workers_enable(NX_IP *ip_ptr, UINT worker_count, VOID *stack_ptr, ULONG stack_size, UINT priority);
 UINT nx_ip_status_check(NX_IP *ip_ptr, ULONG needed_status, ULONG *actual_status, ULONG wait_option);
 UINT nx_ip_static_route_add(NX_IP *ip_ptr, ULONG network_address, ULONG net_mask, ULONG next_hop);
 UINT nx_ip_static_route_delete(NX_IP *ip_ptr, ULONG network_address, ULONG net_mask);
@@ -3658,6 +3723,8 @@ UINT nx_udp_socket_info_get(NX_UDP_SOCKET *socket_ptr, ULONG *udp_packets_sent,
                             ULONG *udp_receive_packets_dropped, ULONG *udp_checksum_errors);
 UINT nx_udp_socket_port_get(NX_UDP_SOCKET *socket_ptr, UINT *port_ptr);
 UINT nx_udp_socket_receive(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, ULONG wait_option);
+UINT nx_udp_socket_batch_receive(NX_UDP_SOCKET *socket_ptr, NX_UDP_MESSAGE *message_array, UINT message_count,
+                                 UINT *messages_received, ULONG wait_option);
 UINT nx_udp_socket_receive_notify(NX_UDP_SOCKET *socket_ptr,
                                   VOID (*udp_receive_notify)(NX_UDP_SOCKET *));
 #ifndef NX_DISABLE_ERROR_CHECKING
@@ -3675,6 +3742,8 @@ UINT _nxd_udp_socket_source_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_pt
 UINT nx_udp_socket_unbind(NX_UDP_SOCKET *socket_ptr);
 UINT nx_udp_source_extract(NX_PACKET *packet_ptr, ULONG *ip_address, UINT *port);
 UINT nxd_udp_source_extract(NX_PACKET *packet_ptr, NXD_ADDRESS *ip_address, UINT *port);
+UINT nxd_udp_socket_batch_send(NX_UDP_SOCKET *socket_ptr, NX_UDP_MESSAGE *message_array, UINT message_count,
+                               UINT *messages_sent);
 #ifndef NX_DISABLE_ERROR_CHECKING
 UINT _nxe_udp_socket_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr_ptr,
                           ULONG ip_address, UINT port);
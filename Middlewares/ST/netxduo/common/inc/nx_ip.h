@@ -154,6 +154,9 @@ VOID _nx_ip_initialize(VOID);
 VOID _nx_ip_periodic_timer_entry(ULONG ip_address);
 VOID _nx_ip_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_ip_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+ULONG _nx_ip_packet_flow_hash(NX_PACKET *packet_ptr);
+UINT _nx_ip_receive_workers_enable(NX_IP *ip_ptr, UINT worker_count, VOID *stack_ptr, ULONG stack_size, UINT priority);
+VOID _nx_ip_receive_worker_entry(ULONG worker_ptr_value);
 UINT _nx_ip_status_check(NX_IP *ip_ptr, ULONG needed_status, ULONG *actual_status, ULONG wait_option);
 UINT _nx_ip_link_status_change_notify_set(NX_IP *ip_ptr,  VOID (*link_status_change_notify)(NX_IP *ip_ptr, UINT interface_index, UINT link_up));
 VOID _nx_ip_thread_entry(ULONG ip_ptr_value);
@@ -198,6 +201,7 @@ UINT _nxe_ip_interface_detach(NX_IP *ip_ptr, UINT index);
 UINT _nxe_ip_max_payload_size_find(NX_IP *ip_ptr, NXD_ADDRESS *dest_address, UINT if_index,
                                    UINT src_port, UINT dest_port, ULONG protocol, ULONG *start_offset_ptr,
                                    ULONG *payload_length_ptr);
+UINT _nxe_ip_receive_workers_enable(NX_IP *ip_ptr, UINT worker_count, VOID *stack_ptr, ULONG stack_size, UINT priority);
 UINT _nxe_ip_raw_packet_disable(NX_IP *ip_ptr);
 UINT _nxe_ip_raw_packet_enable(NX_IP *ip_ptr);
 UINT _nxe_ip_raw_packet_receive(NX_IP *ip_ptr, NX_PACKET **packet_ptr, ULONG wait_option);
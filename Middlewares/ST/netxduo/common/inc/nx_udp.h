@@ -92,10 +92,13 @@ UINT _nx_udp_info_get(NX_IP *ip_ptr, ULONG *udp_packets_sent, ULONG *udp_bytes_s
                       ULONG *udp_checksum_errors);
 VOID _nx_udp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_udp_receive_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
+UINT _nx_udp_socket_batch_receive(NX_UDP_SOCKET *socket_ptr, NX_UDP_MESSAGE *message_array, UINT message_count,
+                                  UINT *messages_received, ULONG wait_option);
 UINT _nx_udp_socket_bind(NX_UDP_SOCKET *socket_ptr, UINT  port, ULONG wait_option);
 UINT _nx_udp_socket_bytes_available(NX_UDP_SOCKET *socket_ptr, ULONG *bytes_available);
 UINT _nx_udp_socket_checksum_disable(NX_UDP_SOCKET *socket_ptr);
 UINT _nx_udp_socket_checksum_enable(NX_UDP_SOCKET *socket_ptr);
+UINT _nx_udp_socket_checksum_verify(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_ptr);
 UINT _nx_udp_socket_create(NX_IP *ip_ptr, NX_UDP_SOCKET *socket_ptr, CHAR *name,
                            ULONG type_of_service, ULONG fragment, UINT time_to_live, ULONG queue_maximum);
 UINT _nx_udp_socket_delete(NX_UDP_SOCKET *socket_ptr);
@@ -116,6 +119,8 @@ UINT _nx_udp_socket_unbind(NX_UDP_SOCKET *socket_ptr);
 UINT _nx_udp_source_extract(NX_PACKET *packet_ptr, ULONG *ip_address, UINT *port);
 UINT _nx_udp_packet_info_extract(NX_PACKET *packet_ptr, ULONG *ip_address, UINT *protocol, UINT *port, UINT *interface_index);
 UINT _nxd_udp_source_extract(NX_PACKET *packet_ptr, NXD_ADDRESS *ip_address, UINT *port);
+UINT _nxd_udp_socket_batch_send(NX_UDP_SOCKET *socket_ptr, NX_UDP_MESSAGE *message_array, UINT message_count,
+                                UINT *messages_sent);
 
 /* Define error checking shells for API services.  These are only referenced by the
    application.  */
@@ -126,6 +131,8 @@ UINT _nxe_udp_info_get(NX_IP *ip_ptr, ULONG *udp_packets_sent, ULONG *udp_bytes_
                        ULONG *udp_packets_received, ULONG *udp_bytes_received,
                        ULONG *udp_invalid_packets, ULONG *udp_receive_packets_dropped,
                        ULONG *udp_checksum_errors);
+UINT _nxe_udp_socket_batch_receive(NX_UDP_SOCKET *socket_ptr, NX_UDP_MESSAGE *message_array, UINT message_count,
+                                   UINT *messages_received, ULONG wait_option);
 UINT _nxe_udp_socket_bind(NX_UDP_SOCKET *socket_ptr, UINT  port, ULONG wait_option);
 UINT _nxe_udp_socket_bytes_available(NX_UDP_SOCKET *socket_ptr, ULONG *bytes_available);
 UINT _nxe_udp_socket_checksum_disable(NX_UDP_SOCKET *socket_ptr);
@@ -160,6 +167,8 @@ UINT _nxde_udp_packet_info_extract(NX_PACKET *packet_ptr, NXD_ADDRESS *ip_addres
                                    UINT *protocol, UINT *port, UINT *interface_index);
 UINT _nxe_udp_packet_info_extract(NX_PACKET *packet_ptr, ULONG *ip_address, UINT *protocol, UINT *port, UINT *interface_index);
 UINT _nxde_udp_socket_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, NXD_ADDRESS *ip_address, UINT port);
+UINT _nxde_udp_socket_batch_send(NX_UDP_SOCKET *socket_ptr, NX_UDP_MESSAGE *message_array, UINT message_count,
+                                 UINT *messages_sent);
 
 /* UDP component data declarations follow.  */
 
@@ -712,6 +712,20 @@
 #define NX_DRIVER_DEFERRED_PROCESSING
 */
 
+/* Defined, deferred IP receive processing can be spread over several receive worker threads
+   with nx_ip_receive_workers_enable.  Packets are steered to a worker by a hash of their addresses,
+   protocol and ports so that per-flow ordering is preserved.  IP header processing and UDP delivery
+   run on the workers; ICMP, IGMP and TCP packets and IP fragments are still processed by the IP
+   helper thread.  The default is disabled.  */
+/*
+#define NX_ENABLE_IP_RECEIVE_WORKERS
+*/
+
+/* Define the maximum number of receive worker threads per IP instance. The default value is 4.  */
+/*
+#define NX_IP_RECEIVE_WORKER_MAX                            4
+*/
+
 /* Defined, the source address of incoming packet is checked. The default is disabled. */
 /*
 #define NX_ENABLE_SOURCE_ADDRESS_CHECK
@@ -40,7 +40,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_ip_delete                                       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -70,6 +70,7 @@
 /*    tx_thread_terminate                   Terminate IP helper thread    */
 /*    tx_event_flags_delete                 Delete IP event flags         */
 /*    tx_thread_delete                      Delete IP helper thread       */
+/*                                            and receive worker threads  */
 /*    _tx_thread_system_preempt_check       Check for preemption          */
 /*    tx_timer_deactivate                   Deactivate IP-ARP timer       */
 /*    tx_timer_delete                       Delete IP-ARP timer           */
@@ -86,6 +87,9 @@
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), deleted  */
+/*                                            receive worker threads,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_ip_delete(NX_IP *ip_ptr)
@@ -104,6 +108,10 @@ NX_PACKET   *arp_queue_head;
 NX_PACKET   *rarp_queue_head;
 NX_PACKET   *igmp_queue_head;
 #endif /* !NX_DISABLE_IPV4  */
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+UINT         worker_count;
+NX_PACKET   *worker_queue_head[NX_IP_RECEIVE_WORKER_MAX];
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
 
     /* If trace is enabled, insert this event into the trace buffer.  */
     NX_TRACE_IN_LINE_INSERT(NX_TRACE_IP_DELETE, ip_ptr, 0, 0, 0, NX_TRACE_IP_EVENTS, 0, 0);
@@ -201,6 +209,18 @@ NX_PACKET   *igmp_queue_head;
     ip_ptr ->  nx_ip_deferred_received_packet_head =  NX_NULL;
     ip_ptr ->  nx_ip_deferred_received_packet_tail =  NX_NULL;
 
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+    /* Stop steering packets to the receive workers and release their queues.  */
+    worker_count =  ip_ptr -> nx_ip_receive_worker_count;
+    ip_ptr -> nx_ip_receive_worker_count =  0;
+    for (i = 0; i < worker_count; i++)
+    {
+        worker_queue_head[i] =  ip_ptr -> nx_ip_receive_worker[i].nx_ip_receive_worker_packet_head;
+        ip_ptr -> nx_ip_receive_worker[i].nx_ip_receive_worker_packet_head =  NX_NULL;
+        ip_ptr -> nx_ip_receive_worker[i].nx_ip_receive_worker_packet_tail =  NX_NULL;
+    }
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+
     /* Release all queued ICMP packets.  */
     icmp_queue_head =   ip_ptr ->  nx_ip_icmp_queue_head;
     ip_ptr ->  nx_ip_icmp_queue_head =  NX_NULL;
@@ -259,6 +279,22 @@ NX_PACKET   *igmp_queue_head;
        duties.  */
     tx_thread_delete(&(ip_ptr -> nx_ip_thread));
 
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+    /* Terminate and delete the receive workers.  */
+    for (i = 0; i < worker_count; i++)
+    {
+        tx_thread_terminate(&(ip_ptr -> nx_ip_receive_worker[i].nx_ip_receive_worker_thread));
+        tx_thread_delete(&(ip_ptr -> nx_ip_receive_worker[i].nx_ip_receive_worker_thread));
+        tx_event_flags_delete(&(ip_ptr -> nx_ip_receive_worker[i].nx_ip_receive_worker_events));
+
+        /* Release any packets queued to the worker.  */
+        if (worker_queue_head[i])
+        {
+            _nx_ip_delete_queue_clear(worker_queue_head[i]);
+        }
+    }
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+
     /* Release any raw packets queued up.  */
     if (raw_packet_head)
     {
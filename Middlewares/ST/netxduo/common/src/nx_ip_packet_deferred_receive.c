@@ -34,7 +34,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_ip_packet_deferred_receive                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -44,7 +44,9 @@
 /*    This function receives a packet from the link driver (usually the   */
 /*    link driver's input ISR) and places it in the deferred receive      */
 /*    packet queue.  This moves the minimal receive packet processing     */
-/*    from the ISR to the IP helper thread.                               */
+/*    from the ISR to the IP helper thread.  If receive workers are       */
+/*    enabled, the packet is instead queued to the worker selected by its */
+/*    flow hash.                                                          */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -58,6 +60,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    tx_event_flags_set                    Set events for IP thread      */
+/*    _nx_ip_packet_flow_hash               Compute packet flow hash      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -70,6 +73,9 @@
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), added    */
+/*                                            receive worker steering,    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_ip_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
@@ -77,6 +83,57 @@ VOID  _nx_ip_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
 
 TX_INTERRUPT_SAVE_AREA
 
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+NX_IP_RECEIVE_WORKER *worker_ptr;
+UINT                  worker_count;
+
+
+    /* Pickup the number of receive workers.  */
+    worker_count =  ip_ptr -> nx_ip_receive_worker_count;
+
+    /* Determine if receive workers are enabled.  */
+    if (worker_count)
+    {
+
+        /* Select the worker that owns this flow.  */
+        worker_ptr =  &(ip_ptr -> nx_ip_receive_worker[_nx_ip_packet_flow_hash(packet_ptr) % worker_count]);
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Add debug information. */
+        NX_PACKET_DEBUG(__FILE__, __LINE__, packet_ptr);
+
+        packet_ptr -> nx_packet_queue_next =  NX_NULL;
+
+        /* Check to see if the worker queue is empty.  */
+        if (worker_ptr -> nx_ip_receive_worker_packet_head)
+        {
+
+            /* Not empty, just place the packet at the end of the queue.  */
+            (worker_ptr -> nx_ip_receive_worker_packet_tail) -> nx_packet_queue_next =  packet_ptr;
+            worker_ptr -> nx_ip_receive_worker_packet_tail =  packet_ptr;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+        else
+        {
+
+            /* Empty queue.  Setup the head pointers and wakeup the worker.  */
+            worker_ptr -> nx_ip_receive_worker_packet_head =  packet_ptr;
+            worker_ptr -> nx_ip_receive_worker_packet_tail =  packet_ptr;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Wakeup the receive worker.  */
+            tx_event_flags_set(&(worker_ptr -> nx_ip_receive_worker_events), NX_IP_RECEIVE_EVENT, TX_OR);
+        }
+
+        return;
+    }
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
 
     /* Disable interrupts.  */
     TX_DISABLE
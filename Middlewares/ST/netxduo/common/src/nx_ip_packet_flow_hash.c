@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_packet_flow_hash                             PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes a flow hash over the source and destination  */
+/*    addresses, the protocol and, for unfragmented TCP and UDP packets,  */
+/*    the source and destination ports of a received IP packet.  The      */
+/*    hash is used to steer packets of the same flow to the same receive  */
+/*    worker.  The prepend pointer must point at the IP header.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to received packet    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    hash                                  Flow hash value               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_packet_deferred_receive        Deferred IP packet receive    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_ip_packet_flow_hash(NX_PACKET *packet_ptr)
+{
+
+UCHAR *header_ptr;
+ULONG  header_length;
+ULONG  available;
+ULONG  address_offset;
+ULONG  address_length;
+ULONG  protocol;
+ULONG  hash;
+ULONG  i;
+
+
+    /* Pickup the IP header and the number of contiguous bytes in the first packet.  */
+    header_ptr =  packet_ptr -> nx_packet_prepend_ptr;
+
+    /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+    available =  (ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr);
+
+    /* Every flow of a malformed packet maps to the same worker.  */
+    if (available < 1)
+    {
+        return(0);
+    }
+
+#ifndef NX_DISABLE_IPV4
+    if ((header_ptr[0] >> 4) == NX_IP_VERSION_V4)
+    {
+
+        /* Check for a complete IPv4 header.  */
+        header_length =  (ULONG)(header_ptr[0] & 0x0F) << 2;
+        if ((header_length < 20) || (available < header_length))
+        {
+            return(0);
+        }
+
+        /* Addresses start at byte 12, protocol is at byte 9.  */
+        address_offset =  12;
+        address_length =  8;
+        protocol =        header_ptr[9];
+
+        /* Non-first fragments carry no transport header, and all fragments must
+           be steered alike, so only hash the transport ports of unfragmented packets.  */
+        if ((((ULONG)header_ptr[6] << 8) | header_ptr[7]) & (NX_IP_MORE_FRAGMENT | NX_IP_OFFSET_MASK))
+        {
+            protocol =  0;
+        }
+    }
+    else
+#endif /* !NX_DISABLE_IPV4  */
+#ifdef FEATURE_NX_IPV6
+    if ((header_ptr[0] >> 4) == NX_IP_VERSION_V6)
+    {
+
+        /* Check for a complete IPv6 header.  */
+        header_length =  40;
+        if (available < header_length)
+        {
+            return(0);
+        }
+
+        /* Addresses start at byte 8, next header is at byte 6.  Extension headers
+           are not walked, so packets that carry them hash on addresses only.  */
+        address_offset =  8;
+        address_length =  32;
+        protocol =        header_ptr[6];
+    }
+    else
+#endif /* FEATURE_NX_IPV6 */
+    {
+        return(0);
+    }
+
+    /* FNV-1a over the source and destination addresses.  */
+    hash =  2166136261UL;
+    for (i = address_offset; i < address_offset + address_length; i++)
+    {
+        hash =  (hash ^ header_ptr[i]) * 16777619UL;
+    }
+
+    /* Mix in the protocol.  */
+    hash =  (hash ^ protocol) * 16777619UL;
+
+    /* Mix in the source and destination ports of TCP and UDP.  */
+    if (((protocol == NX_PROTOCOL_TCP) || (protocol == NX_PROTOCOL_UDP)) &&
+        (available >= header_length + 4))
+    {
+        for (i = header_length; i < header_length + 4; i++)
+        {
+            hash =  (hash ^ header_ptr[i]) * 16777619UL;
+        }
+    }
+
+    /* Fold the upper bits down so a modulo by a small worker count sees them.  */
+    hash ^=  hash >> 16;
+
+    return(hash);
+}
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+
@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_receive_worker_entry                         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the entry point for each IP receive worker thread. */
+/*    The worker drains its deferred receive queue and performs the IP    */
+/*    receive processing for each packet.  Like a driver that calls       */
+/*    _nx_ip_packet_receive directly, the worker does not hold the IP     */
+/*    protection mutex.  IP header processing and UDP delivery run on     */
+/*    the worker.  ICMP, IGMP and TCP packets and IP fragments are still  */
+/*    queued to the IP helper thread by the receive path.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    worker_ptr_value                      Pointer to worker structure   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_event_flags_get                    Suspend on worker events      */
+/*    _nx_ip_packet_receive                 IP receive packet processing  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX Scheduler                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_receive_worker_entry(ULONG worker_ptr_value)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_IP_RECEIVE_WORKER *worker_ptr;
+NX_IP                *ip_ptr;
+NX_PACKET            *packet_ptr;
+ULONG                 events;
+
+
+    /* Setup worker and IP pointers.  */
+    NX_THREAD_EXTENSION_PTR_GET(worker_ptr, NX_IP_RECEIVE_WORKER, worker_ptr_value)
+    ip_ptr =  worker_ptr -> nx_ip_receive_worker_ip_ptr;
+
+    /* Loop to process deferred packets.  */
+    for (;;)
+    {
+
+        /* Wait for packets to be steered to this worker.  */
+        tx_event_flags_get(&(worker_ptr -> nx_ip_receive_worker_events), NX_IP_RECEIVE_EVENT,
+                           TX_OR_CLEAR, &events, TX_WAIT_FOREVER);
+
+        /* Loop to process all queued packets.  */
+        while (worker_ptr -> nx_ip_receive_worker_packet_head)
+        {
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Pickup the first packet.  */
+            packet_ptr =  worker_ptr -> nx_ip_receive_worker_packet_head;
+
+            /* Move the head pointer to the next packet.  */
+            worker_ptr -> nx_ip_receive_worker_packet_head =  packet_ptr -> nx_packet_queue_next;
+
+            /* Check for end of the worker queue.  */
+            if (worker_ptr -> nx_ip_receive_worker_packet_head == NX_NULL)
+            {
+
+                /* Yes, the queue is empty.  Set the tail pointer to NULL.  */
+                worker_ptr -> nx_ip_receive_worker_packet_tail =  NX_NULL;
+            }
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Count the packet.  */
+            worker_ptr -> nx_ip_receive_worker_packets_processed++;
+
+            /* Call the actual IP packet receive function.  */
+            _nx_ip_packet_receive(ip_ptr, packet_ptr);
+        }
+    }
+}
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+
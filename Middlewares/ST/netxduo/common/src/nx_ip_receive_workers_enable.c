@@ -0,0 +1,163 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_receive_workers_enable                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates the receive worker threads of an IP           */
+/*    instance.  Once enabled, packets passed to                          */
+/*    _nx_ip_packet_deferred_receive are steered to a worker by flow hash */
+/*    instead of the IP helper thread, so UDP receive processing of       */
+/*    different flows can run concurrently while per-flow ordering is     */
+/*    preserved.  ICMP, IGMP and TCP packets and IP fragments are still   */
+/*    processed by the IP helper thread.  The supplied stack area is      */
+/*    divided evenly among the workers.  Note in order to utilize this    */
+/*    feature, the symbol NX_ENABLE_IP_RECEIVE_WORKERS must be defined    */
+/*    when building NetX Duo library.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*    worker_count                          Number of worker threads      */
+/*    stack_ptr                             Pointer to worker stack area  */
+/*    stack_size                            Size of worker stack area     */
+/*    priority                              Priority of worker threads    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_event_flags_create                 Create worker event flags     */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*    tx_thread_create                      Create worker thread          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application                                                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_ip_receive_workers_enable(NX_IP *ip_ptr, UINT worker_count, VOID *stack_ptr, ULONG stack_size, UINT priority)
+{
+
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+TX_INTERRUPT_SAVE_AREA
+
+NX_IP_RECEIVE_WORKER *worker_ptr;
+ULONG                 worker_stack_size;
+UINT                  i;
+
+
+    /* Obtain the IP internal mutex.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Workers can only be enabled once per IP instance.  */
+    if (ip_ptr -> nx_ip_receive_worker_count)
+    {
+
+        /* Release the IP internal mutex.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        return(NX_ALREADY_ENABLED);
+    }
+
+    /* Divide the stack area evenly, keeping each stack ULONG aligned.  */
+    worker_stack_size =  (stack_size / worker_count) & ~((ULONG)(sizeof(ULONG) - 1));
+
+    /* Create each worker.  */
+    for (i = 0; i < worker_count; i++)
+    {
+
+        worker_ptr =  &(ip_ptr -> nx_ip_receive_worker[i]);
+
+        /* Setup the worker.  */
+        worker_ptr -> nx_ip_receive_worker_packet_head =       NX_NULL;
+        worker_ptr -> nx_ip_receive_worker_packet_tail =       NX_NULL;
+        worker_ptr -> nx_ip_receive_worker_packets_processed = 0;
+        worker_ptr -> nx_ip_receive_worker_ip_ptr =            ip_ptr;
+
+        /* Create the worker event flags.  */
+        tx_event_flags_create(&(worker_ptr -> nx_ip_receive_worker_events), ip_ptr -> nx_ip_name);
+
+        /* Create the worker thread.  */
+        tx_thread_create(&(worker_ptr -> nx_ip_receive_worker_thread), ip_ptr -> nx_ip_name,
+                         _nx_ip_receive_worker_entry, (ULONG)(ALIGN_TYPE)(worker_ptr),
+                         ((UCHAR *)stack_ptr) + (i * worker_stack_size), worker_stack_size,
+                         priority, priority, 1, TX_AUTO_START);
+
+        NX_THREAD_EXTENSION_PTR_SET(&(worker_ptr -> nx_ip_receive_worker_thread), worker_ptr)
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Start steering deferred packets to the workers.  */
+    ip_ptr -> nx_ip_receive_worker_count =  worker_count;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Release the IP internal mutex.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return success to the caller.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_IP_RECEIVE_WORKERS */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(worker_count);
+    NX_PARAMETER_NOT_USED(stack_ptr);
+    NX_PARAMETER_NOT_USED(stack_size);
+    NX_PARAMETER_NOT_USED(priority);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+}
+
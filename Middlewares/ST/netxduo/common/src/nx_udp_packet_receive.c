@@ -44,7 +44,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_udp_packet_receive                              PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -54,6 +54,11 @@
 /*    This function receives a UDP packet from the IP receive processing  */
 /*    and places on the appropriate socket's input queue.                 */
 /*                                                                        */
+/*    If NX_ENABLE_IP_RECEIVE_WORKERS is defined, the port list is        */
+/*    searched with interrupts disabled instead of with the protection    */
+/*    mutex, so UDP packets of different flows are delivered by the       */
+/*    receive workers without serializing on the mutex.                   */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    ip_ptr                                Pointer to IP control block   */
@@ -82,6 +87,11 @@
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), searched */
+/*                                            the port list without the   */
+/*                                            protection mutex for        */
+/*                                            receive workers,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 VOID  _nx_udp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
@@ -164,6 +174,14 @@ NX_UDP_HEADER *udp_header_ptr;
     /* Calculate the hash index in the UDP port array of the associated IP instance.  */
     index =  (UINT)((port + (port >> 8)) & NX_UDP_PORT_TABLE_MASK);
 
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+
+    /* Bind and unbind only change the port list with interrupts disabled, so search it
+       with interrupts disabled.  Receive workers then do not serialize on the protection
+       mutex, which every socket service of this IP instance holds.  */
+    TX_DISABLE
+#else
+
     /* Determine if the caller is a thread. If so, we should use the protection mutex
        to avoid having the port list examined while we are traversing it. If this routine
        is called from an ISR nothing needs to be done since bind/unbind are not allowed
@@ -174,6 +192,7 @@ NX_UDP_HEADER *udp_header_ptr;
         /* Get mutex protection.  */
         tx_mutex_get(&(ip_ptr -> nx_ip_protection), NX_WAIT_FOREVER);
     }
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
 
     /* Search the bound sockets in this index for the particular port.  */
     socket_ptr =  ip_ptr -> nx_ip_udp_port_table[index];
@@ -182,6 +201,21 @@ NX_UDP_HEADER *udp_header_ptr;
     if (!socket_ptr)
     {
 
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+#else
+
+        /* Determine if the caller is a thread. If so, release the mutex protection previously setup.  */
+        if ((_tx_thread_current_ptr) && (TX_THREAD_GET_SYSTEM_STATE() == 0))
+        {
+
+            /* Release mutex protection.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+        }
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+
 #ifndef NX_DISABLE_IPV4
 #ifndef NX_DISABLE_ICMPV4_ERROR_MESSAGE
         /* If ICMPv4 is enabled, send Destination unreachable. */
@@ -232,14 +266,6 @@ NX_UDP_HEADER *udp_header_ptr;
         ip_ptr -> nx_ip_udp_receive_packets_dropped++;
 #endif
 
-        /* Determine if the caller is a thread. If so, release the mutex protection previously setup.  */
-        if ((_tx_thread_current_ptr) && (TX_THREAD_GET_SYSTEM_STATE() == 0))
-        {
-
-            /* Release mutex protection.  */
-            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
-        }
-
         /* Release the packet.  */
         _nx_packet_release(packet_ptr);
 
@@ -281,6 +307,12 @@ NX_UDP_HEADER *udp_header_ptr;
         }
     } while (socket_ptr != ip_ptr -> nx_ip_udp_port_table[index]);
 
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#else
+
     /* Determine if the caller is a thread. If so, release the mutex protection previously setup.  */
     if ((_tx_thread_current_ptr) && (TX_THREAD_GET_SYSTEM_STATE() == 0))
     {
@@ -288,6 +320,7 @@ NX_UDP_HEADER *udp_header_ptr;
         /* Release mutex protection.  */
         tx_mutex_put(&(ip_ptr -> nx_ip_protection));
     }
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
 
     /* Determine if a match was found.  */
     if (socket_ptr -> nx_udp_socket_port != port)
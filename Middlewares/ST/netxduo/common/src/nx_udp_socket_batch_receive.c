@@ -0,0 +1,183 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_udp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_batch_receive                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives up to message_count datagrams from the       */
+/*    specified socket.  It suspends for the wait option duration only    */
+/*    for the first datagram; any further datagrams already queued on the */
+/*    socket are detached from the receive queue in a single interrupt    */
+/*    lockout and returned in the same call.  The source address and port */
+/*    of each datagram are stored in its message entry.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    message_array                         Array of messages to fill     */
+/*    message_count                         Number of entries in array    */
+/*    messages_received                     Pointer to destination for    */
+/*                                            number of datagrams received*/
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_release                    Release data packet           */
+/*    _nx_udp_socket_checksum_verify        Verify UDP checksum           */
+/*    _nx_udp_socket_receive                Receive first UDP packet      */
+/*    _nxd_udp_source_extract               Extract source of datagram    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_udp_socket_batch_receive(NX_UDP_SOCKET *socket_ptr, NX_UDP_MESSAGE *message_array, UINT message_count,
+                                   UINT *messages_received, ULONG wait_option)
+{
+TX_INTERRUPT_SAVE_AREA
+
+NX_UDP_MESSAGE *message_ptr;
+NX_PACKET      *packet_ptr;
+NX_PACKET      *queue_head;
+NX_PACKET      *queue_last;
+UINT            detached;
+UINT            count;
+UINT            status;
+
+
+    /* Set the number of received datagrams to zero initially.  */
+    *messages_received =  0;
+
+    /* Receive the first datagram, suspending if necessary.  The receive records its own trace event.  */
+    status =  _nx_udp_socket_receive(socket_ptr, &packet_ptr, wait_option);
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Store the first datagram.  */
+    message_ptr =  &message_array[0];
+    message_ptr -> nx_udp_message_packet_ptr =  packet_ptr;
+    _nxd_udp_source_extract(packet_ptr, &(message_ptr -> nx_udp_message_address), &(message_ptr -> nx_udp_message_port));
+    count =  1;
+
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Detach as many of the remaining queued datagrams as fit in the array.  */
+    queue_head =  socket_ptr -> nx_udp_socket_receive_head;
+    detached =    0;
+    if ((queue_head) && (message_count > 1))
+    {
+
+        /* Walk to the last packet to detach.  */
+        queue_last =  queue_head;
+        detached =    1;
+        while ((detached < (message_count - 1)) && (queue_last -> nx_packet_queue_next))
+        {
+            queue_last =  queue_last -> nx_packet_queue_next;
+            detached++;
+        }
+
+        /* Unlink the detached packets from the socket receive queue.  */
+        socket_ptr -> nx_udp_socket_receive_head =  queue_last -> nx_packet_queue_next;
+        if (socket_ptr -> nx_udp_socket_receive_head == NX_NULL)
+        {
+            socket_ptr -> nx_udp_socket_receive_tail =  NX_NULL;
+        }
+        queue_last -> nx_packet_queue_next =  NX_NULL;
+
+        /* Decrease the queued packet count.  */
+        socket_ptr -> nx_udp_socket_receive_count -=  detached;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Process the detached datagrams outside of the interrupt lockout.  */
+    while (detached--)
+    {
+
+        /* Pickup the next packet.  */
+        packet_ptr =  queue_head;
+        queue_head =  queue_head -> nx_packet_queue_next;
+
+        /* Verify the UDP checksum.  */
+        if (_nx_udp_socket_checksum_verify(socket_ptr, packet_ptr) != NX_SUCCESS)
+        {
+
+            /* Bad UDP checksum.  Release the packet. */
+            _nx_packet_release(packet_ptr);
+            continue;
+        }
+
+        /* Remove the UDP header.  */
+        packet_ptr -> nx_packet_length =       packet_ptr -> nx_packet_length - (ULONG)sizeof(NX_UDP_HEADER);
+        packet_ptr -> nx_packet_prepend_ptr =  packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_UDP_HEADER);
+
+        /* If trace is enabled, insert this event into the trace buffer, as a single receive would.  */
+        NX_TRACE_IN_LINE_INSERT(NX_TRACE_UDP_SOCKET_RECEIVE, socket_ptr -> nx_udp_socket_ip_ptr, socket_ptr, packet_ptr, packet_ptr -> nx_packet_length, NX_TRACE_UDP_EVENTS, 0, 0);
+
+        /* Store the datagram.  */
+        message_ptr =  &message_array[count];
+        message_ptr -> nx_udp_message_packet_ptr =  packet_ptr;
+        _nxd_udp_source_extract(packet_ptr, &(message_ptr -> nx_udp_message_address), &(message_ptr -> nx_udp_message_port));
+        count++;
+    }
+
+    /* Return the number of datagrams received.  */
+    *messages_received =  count;
+
+    return(NX_SUCCESS);
+}
+
@@ -0,0 +1,244 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#ifdef FEATURE_NX_IPV6
+#include "nx_ipv6.h"
+#endif /* FEATURE_NX_IPV6 */
+#include "nx_packet.h"
+#include "nx_udp.h"
+#ifdef NX_IPSEC_ENABLE
+#include "nx_ipsec.h"
+#endif /* NX_IPSEC_ENABLE */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_checksum_verify                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function verifies the UDP checksum of a packet removed from    */
+/*    the socket receive queue.  The prepend pointer must still point at  */
+/*    the UDP header.  On a checksum error the statistics are updated and */
+/*    the caller is responsible for releasing the packet.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    packet_ptr                            Pointer to UDP packet         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_checksum_compute               Compute UDP checksum          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_udp_socket_receive                Receive UDP packet            */
+/*    _nx_udp_socket_batch_receive          Receive UDP packets in batch  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_udp_socket_checksum_verify(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_ptr)
+{
+#ifndef NX_DISABLE_UDP_INFO
+TX_INTERRUPT_SAVE_AREA
+#endif /* NX_DISABLE_UDP_INFO */
+
+ULONG                 *temp_ptr;
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+NX_INTERFACE          *interface_ptr = NX_NULL;
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+#if defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
+UINT                   compute_checksum = 1;
+#endif /* defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
+
+
+#ifdef NX_DISABLE_UDP_RX_CHECKSUM
+    compute_checksum = 0;
+#endif /* NX_DISABLE_UDP_RX_CHECKSUM */
+
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+    /* Get the packet interface. */
+#ifndef NX_DISABLE_IPV4
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
+    {
+        interface_ptr = packet_ptr -> nx_packet_address.nx_packet_interface_ptr;
+    }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+    if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6)
+    {
+        interface_ptr = packet_ptr -> nx_packet_address.nx_packet_ipv6_address_ptr -> nxd_ipv6_address_attached;
+    }
+#endif /* FEATURE_NX_IPV6 */
+
+    if (interface_ptr -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_UDP_RX_CHECKSUM)
+    {
+        compute_checksum = 0;
+    }
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+
+#ifdef NX_IPSEC_ENABLE
+    if ((packet_ptr -> nx_packet_ipsec_sa_ptr != NX_NULL) && (((NX_IPSEC_SA *)(packet_ptr -> nx_packet_ipsec_sa_ptr)) -> nx_ipsec_sa_encryption_method != NX_CRYPTO_NONE))
+    {
+        compute_checksum = 1;
+    }
+#endif /* NX_IPSEC_ENABLE */
+
+#if defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
+    if (compute_checksum)
+#endif /* defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
+    {
+
+        /* Determine if we need to compute the UDP checksum.  If it is disabled for this socket
+           or if the UDP packet has a zero in the checksum field (indicating it was not computed
+           by the sender, skip the checksum processing.  */
+        /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        temp_ptr =  (ULONG *)packet_ptr -> nx_packet_prepend_ptr;
+        if ((!socket_ptr -> nx_udp_socket_disable_checksum && (*(temp_ptr + 1) & NX_LOWER_16_MASK)) || /* per-socket checksum is not disabled, and the checksum field is not zero*/
+            (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6))                               /* It is IPv6 packet */
+        {
+        ULONG         *ip_src_addr = NX_NULL, *ip_dest_addr = NX_NULL;
+        ULONG          checksum;
+#ifdef NX_LITTLE_ENDIAN
+        NX_UDP_HEADER *udp_header_ptr;
+
+            /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+            udp_header_ptr = (NX_UDP_HEADER *)(packet_ptr -> nx_packet_prepend_ptr);
+#endif /* NX_LITTLE_ENDIAN */
+
+#ifndef NX_DISABLE_IPV4
+            if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
+            {
+            NX_IPV4_HEADER *ipv4_header;
+
+                /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+                ipv4_header = (NX_IPV4_HEADER *)(packet_ptr -> nx_packet_ip_header);
+                ip_src_addr = &(ipv4_header -> nx_ip_header_source_ip);
+                ip_dest_addr = &(ipv4_header -> nx_ip_header_destination_ip);
+            }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+            if (packet_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6) /*  IPv6 */
+            {
+            NX_IPV6_HEADER *ipv6_header;
+
+                /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+                ipv6_header = (NX_IPV6_HEADER *)(packet_ptr -> nx_packet_ip_header);
+                ip_src_addr = (&ipv6_header -> nx_ip_header_source_ip[0]);
+                ip_dest_addr = (&ipv6_header -> nx_ip_header_destination_ip[0]);
+            }
+
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_LITTLE_ENDIAN
+            /* Restore UDP header to network byte order */
+            NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_0);
+            NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
+#endif /* NX_LITTLE_ENDIAN */
+
+            /* nx_ip_checksum_compute takes care of both even number length and odd number length */
+            /* Compute the checksum of the first packet */
+            checksum = _nx_ip_checksum_compute(packet_ptr, NX_PROTOCOL_UDP,
+                                               (UINT)packet_ptr -> nx_packet_length,
+                                               /* IPv6 src/dest address */
+                                               ip_src_addr,
+                                               ip_dest_addr);
+
+#ifdef NX_LITTLE_ENDIAN
+            /* Convert UDP header to host byte order */
+            NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_0);
+            NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
+#endif /* NX_LITTLE_ENDIAN */
+
+            /* Perform the one's complement processing on the checksum.  */
+            checksum =  NX_LOWER_16_MASK & ~checksum;
+
+            /* Determine if it is valid.  */
+            if (checksum != 0)
+            {
+
+#ifndef NX_DISABLE_UDP_INFO
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+
+                /* Increment the UDP checksum error count.  */
+                (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_checksum_errors++;
+
+                /* Increment the UDP invalid packets error count.  */
+                (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_invalid_packets++;
+
+                /* Increment the UDP checksum error count for this socket.  */
+                socket_ptr -> nx_udp_socket_checksum_errors++;
+
+                /* Decrement the total UDP receive packets count.  */
+                (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_packets_received--;
+
+                /* Decrement the total UDP receive bytes.  */
+                (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_bytes_received -=  packet_ptr -> nx_packet_length - (ULONG)sizeof(NX_UDP_HEADER);
+
+                /* Decrement the total UDP receive packets count.  */
+                socket_ptr -> nx_udp_socket_packets_received--;
+
+                /* Decrement the total UDP receive bytes.  */
+                socket_ptr -> nx_udp_socket_bytes_received -=  packet_ptr -> nx_packet_length - (ULONG)sizeof(NX_UDP_HEADER);
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+#endif
+
+                /* Bad UDP checksum.  */
+                return(NX_INVALID_PACKET);
+            }
+        }
+    }
+
+    /* Checksum is valid, disabled for this socket, not calculated by the
+       sender or offloaded.  */
+    return(NX_SUCCESS);
+}
+
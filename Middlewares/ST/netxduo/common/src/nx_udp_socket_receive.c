@@ -43,7 +43,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_udp_socket_receive                              PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Yuxin Zhou, Microsoft Corporation                                   */
@@ -67,6 +67,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_packet_release                    Release data packet           */
+/*    _nx_udp_socket_checksum_verify        Verify UDP checksum           */
 /*    _tx_thread_system_suspend             Suspend thread                */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -80,19 +81,16 @@
 /*  05-19-2020     Yuxin Zhou               Initial Version 6.0           */
 /*  09-30-2020     Yuxin Zhou               Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Yuxin Zhou               Modified comment(s), moved    */
+/*                                            checksum verification into  */
+/*                                            a helper function,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_udp_socket_receive(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, ULONG wait_option)
 {
 TX_INTERRUPT_SAVE_AREA
 
-ULONG                 *temp_ptr;
-#ifdef NX_ENABLE_INTERFACE_CAPABILITY
-NX_INTERFACE          *interface_ptr = NX_NULL;
-#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
-#if defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
-UINT                   compute_checksum = 1;
-#endif /* defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
 TX_THREAD             *thread_ptr;
 #ifdef TX_ENABLE_EVENT_TRACE
 TX_TRACE_BUFFER_ENTRY *trace_event;
@@ -100,10 +98,6 @@ ULONG                  trace_timestamp;
 #endif
 
 
-#ifdef NX_DISABLE_UDP_RX_CHECKSUM
-    compute_checksum = 0;
-#endif /* NX_DISABLE_UDP_RX_CHECKSUM */
-
     /* If trace is enabled, insert this event into the trace buffer.  */
     NX_TRACE_IN_LINE_INSERT(NX_TRACE_UDP_SOCKET_RECEIVE, socket_ptr -> nx_udp_socket_ip_ptr, socket_ptr, 0, 0, NX_TRACE_UDP_EVENTS, &trace_event, &trace_timestamp);
 
@@ -240,166 +234,17 @@ ULONG                  trace_timestamp;
                 return(NX_NO_PACKET);
             }
         }
-#ifdef NX_ENABLE_INTERFACE_CAPABILITY
-        /* Get the packet interface. */
-#ifndef NX_DISABLE_IPV4
-        if ((*packet_ptr) -> nx_packet_ip_version == NX_IP_VERSION_V4)
-        {
-            interface_ptr = (*packet_ptr) -> nx_packet_address.nx_packet_interface_ptr;
-        }
-#endif /* !NX_DISABLE_IPV4  */
-
-#ifdef FEATURE_NX_IPV6
-        if ((*packet_ptr) -> nx_packet_ip_version == NX_IP_VERSION_V6)
-        {
-            interface_ptr = (*packet_ptr) -> nx_packet_address.nx_packet_ipv6_address_ptr -> nxd_ipv6_address_attached;
-        }
-#endif /* FEATURE_NX_IPV6 */
-
-        if (interface_ptr -> nx_interface_capability_flag & NX_INTERFACE_CAPABILITY_UDP_RX_CHECKSUM)
-        {
-            compute_checksum = 0;
-        }
-#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
-
-#ifdef NX_IPSEC_ENABLE
-        if (((*packet_ptr) -> nx_packet_ipsec_sa_ptr != NX_NULL) && (((NX_IPSEC_SA *)((*packet_ptr) -> nx_packet_ipsec_sa_ptr)) -> nx_ipsec_sa_encryption_method != NX_CRYPTO_NONE))
-        {
-            compute_checksum = 1;
-        }
-#endif /* NX_IPSEC_ENABLE */
-
-#if defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
-        if (compute_checksum)
-#endif /* defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
-        {
-
-            /* Determine if we need to compute the UDP checksum.  If it is disabled for this socket
-               or if the UDP packet has a zero in the checksum field (indicating it was not computed
-               by the sender, skip the checksum processing.  */
-            /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
-            temp_ptr =  (ULONG *)(*packet_ptr) -> nx_packet_prepend_ptr;
-            if ((!socket_ptr -> nx_udp_socket_disable_checksum && (*(temp_ptr + 1) & NX_LOWER_16_MASK)) || /* per-socket checksum is not disabled, and the checksum field is not zero*/
-                ((*packet_ptr) -> nx_packet_ip_version == NX_IP_VERSION_V6))                               /* It is IPv6 packet */
-            {
-            ULONG         *ip_src_addr = NX_NULL, *ip_dest_addr = NX_NULL;
-            ULONG          checksum;
-            NX_PACKET     *current_ptr = *packet_ptr;
-#ifdef NX_LITTLE_ENDIAN
-            NX_UDP_HEADER *udp_header_ptr;
-
-                /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
-                udp_header_ptr = (NX_UDP_HEADER *)(current_ptr -> nx_packet_prepend_ptr);
-#endif /* NX_LITTLE_ENDIAN */
-
-#ifndef NX_DISABLE_IPV4
-                if (current_ptr -> nx_packet_ip_version == NX_IP_VERSION_V4)
-                {
-                NX_IPV4_HEADER *ipv4_header;
-
-                    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
-                    ipv4_header = (NX_IPV4_HEADER *)(current_ptr -> nx_packet_ip_header);
-                    ip_src_addr = &(ipv4_header -> nx_ip_header_source_ip);
-                    ip_dest_addr = &(ipv4_header -> nx_ip_header_destination_ip);
-                }
-#endif /* !NX_DISABLE_IPV4  */
-
-#ifdef FEATURE_NX_IPV6
-                if (current_ptr -> nx_packet_ip_version == NX_IP_VERSION_V6) /*  IPv6 */
-                {
-                NX_IPV6_HEADER *ipv6_header;
-
-                    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
-                    ipv6_header = (NX_IPV6_HEADER *)(current_ptr -> nx_packet_ip_header);
-                    ip_src_addr = (&ipv6_header -> nx_ip_header_source_ip[0]);
-                    ip_dest_addr = (&ipv6_header -> nx_ip_header_destination_ip[0]);
-                }
 
-#endif /* FEATURE_NX_IPV6 */
-
-#ifdef NX_LITTLE_ENDIAN
-                /* Restore UDP header to network byte order */
-                NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_0);
-                NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
-#endif /* NX_LITTLE_ENDIAN */
-
-                /* nx_ip_checksum_compute takes care of both even number length and odd number length */
-                /* Compute the checksum of the first packet */
-                checksum = _nx_ip_checksum_compute(current_ptr, NX_PROTOCOL_UDP,
-                                                   (UINT)current_ptr -> nx_packet_length,
-                                                   /* IPv6 src/dest address */
-                                                   ip_src_addr,
-                                                   ip_dest_addr);
-
-#ifdef NX_LITTLE_ENDIAN
-                /* Convert UDP header to host byte order */
-                NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_0);
-                NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
-#endif /* NX_LITTLE_ENDIAN */
-
-                /* Perform the one's complement processing on the checksum.  */
-                checksum =  NX_LOWER_16_MASK & ~checksum;
-
-                /* Determine if it is valid.  */
-                if (checksum == 0)
-                {
-
-                    /* The checksum is okay, so get out of the loop. */
-                    break;
-                }
-                else
-                {
-
-#ifndef NX_DISABLE_UDP_INFO
-
-                    /* Disable interrupts.  */
-                    TX_DISABLE
-
-                    /* Increment the UDP checksum error count.  */
-                    (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_checksum_errors++;
-
-                    /* Increment the UDP invalid packets error count.  */
-                    (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_invalid_packets++;
-
-                    /* Increment the UDP checksum error count for this socket.  */
-                    socket_ptr -> nx_udp_socket_checksum_errors++;
-
-                    /* Decrement the total UDP receive packets count.  */
-                    (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_packets_received--;
-
-                    /* Decrement the total UDP receive bytes.  */
-                    (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_bytes_received -=  (*packet_ptr) -> nx_packet_length - (ULONG)sizeof(NX_UDP_HEADER);
-
-                    /* Decrement the total UDP receive packets count.  */
-                    socket_ptr -> nx_udp_socket_packets_received--;
-
-                    /* Decrement the total UDP receive bytes.  */
-                    socket_ptr -> nx_udp_socket_bytes_received -=  (*packet_ptr) -> nx_packet_length - (ULONG)sizeof(NX_UDP_HEADER);
-
-                    /* Restore interrupts.  */
-                    TX_RESTORE
-#endif
-
-                    /* Bad UDP checksum.  Release the packet. */
-                    _nx_packet_release(*packet_ptr);
-                }
-            }
-            else
-            {
-
-                /* Checksum logic is either disabled for this socket or the received
-                   UDP packet checksum was not calculated - get out of the loop.  */
-                break;
-            }
-        }
-#if defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE)
-        else
+        /* Verify the UDP checksum of the packet.  */
+        if (_nx_udp_socket_checksum_verify(socket_ptr, *packet_ptr) == NX_SUCCESS)
         {
 
-            /* Simply break - checksum logic is conditionally disabled.  */
+            /* The checksum is okay, so get out of the loop. */
             break;
         }
-#endif /* defined(NX_DISABLE_UDP_RX_CHECKSUM) || defined(NX_ENABLE_INTERFACE_CAPABILITY) || defined(NX_IPSEC_ENABLE) */
+
+        /* Bad UDP checksum.  Release the packet. */
+        _nx_packet_release(*packet_ptr);
     }
 
     /* At this point, we have a valid UDP packet for the caller.  */
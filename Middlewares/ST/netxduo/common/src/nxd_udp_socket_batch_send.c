@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_udp_socket_batch_send                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends up to message_count datagrams through the       */
+/*    specified socket.  The IP protection mutex is obtained once for the */
+/*    whole batch, so the per-datagram send only nests on a mutex that is */
+/*    already owned instead of contending for it.  Sending stops at the   */
+/*    first datagram that fails; the packets of that datagram and of any  */
+/*    following datagrams remain owned by the caller.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    message_array                         Array of messages to send     */
+/*    message_count                         Number of entries in array    */
+/*    messages_sent                         Pointer to destination for    */
+/*                                            number of datagrams sent    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_udp_socket_send                  Send one UDP datagram         */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxd_udp_socket_batch_send(NX_UDP_SOCKET *socket_ptr, NX_UDP_MESSAGE *message_array, UINT message_count,
+                                 UINT *messages_sent)
+{
+
+NX_IP          *ip_ptr;
+NX_UDP_MESSAGE *message_ptr;
+UINT            status =  NX_SUCCESS;
+UINT            i;
+
+
+    /* Set the number of sent datagrams to zero initially.  */
+    *messages_sent =  0;
+
+    /* Set up the pointer to the associated IP instance.  */
+    ip_ptr =  socket_ptr -> nx_udp_socket_ip_ptr;
+
+    /* Get mutex protection for the whole batch.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Loop to send each datagram.  */
+    for (i = 0; i < message_count; i++)
+    {
+
+        message_ptr =  &message_array[i];
+
+        /* Send the datagram.  */
+        status =  _nxd_udp_socket_send(socket_ptr, message_ptr -> nx_udp_message_packet_ptr,
+                                       &(message_ptr -> nx_udp_message_address),
+                                       message_ptr -> nx_udp_message_port);
+
+        /* Stop at the first failure.  */
+        if (status != NX_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    /* Release mutex protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return the number of datagrams sent.  */
+    *messages_sent =  i;
+
+    return(status);
+}
+
@@ -0,0 +1,202 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_udp.h"
+#include "nx_packet.h"
+#include "nx_ipv6.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxde_udp_socket_batch_send                         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the UDP socket batch send        */
+/*    function call.  Every message is validated before any datagram is   */
+/*    sent.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    message_array                         Array of messages to send     */
+/*    message_count                         Number of entries in array    */
+/*    messages_sent                         Pointer to destination for    */
+/*                                            number of datagrams sent    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_udp_socket_batch_send            Actual UDP socket batch send  */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxde_udp_socket_batch_send(NX_UDP_SOCKET *socket_ptr, NX_UDP_MESSAGE *message_array, UINT message_count,
+                                  UINT *messages_sent)
+{
+
+NX_UDP_MESSAGE *message_ptr;
+NX_PACKET      *packet_ptr;
+NXD_ADDRESS    *ip_address;
+UINT            ip_header_size;
+UINT            status;
+UINT            i;
+
+
+    /* Check for invalid input pointers.  */
+    if ((socket_ptr == NX_NULL) || (socket_ptr -> nx_udp_socket_id != NX_UDP_ID) ||
+        (message_array == NX_NULL) || (messages_sent == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an empty message array.  */
+    if (message_count == 0)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check if UDP is enabled.  */
+    if (!(socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_packet_receive)
+    {
+        return(NX_NOT_ENABLED);
+    }
+
+    /* Validate every message.  */
+    for (i = 0; i < message_count; i++)
+    {
+
+        message_ptr =  &message_array[i];
+        packet_ptr =   message_ptr -> nx_udp_message_packet_ptr;
+        ip_address =   &(message_ptr -> nx_udp_message_address);
+        ip_header_size =  0;
+
+        /* Check for invalid packet pointers and packets not marked for allocation. */
+        /*lint -e{923} suppress cast of ULONG to pointer.  */
+        if ((packet_ptr == NX_NULL) ||
+            (packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next != ((NX_PACKET *)NX_PACKET_ALLOCATED)))
+        {
+            return(NX_PTR_ERROR);
+        }
+
+#ifndef NX_DISABLE_IPV4
+        if (ip_address -> nxd_ip_version == NX_IP_VERSION_V4)
+        {
+            if (ip_address -> nxd_ip_address.v4 == 0)
+            {
+                return(NX_IP_ADDRESS_ERROR);
+            }
+
+            ip_header_size = (UINT)sizeof(NX_IPV4_HEADER);
+        }
+#endif /* !NX_DISABLE_IPV4  */
+
+#ifdef FEATURE_NX_IPV6
+        if (ip_address -> nxd_ip_version == NX_IP_VERSION_V6)
+        {
+
+            /* Check for invalid IP address.  */
+            if (CHECK_UNSPECIFIED_ADDRESS(&ip_address -> nxd_ip_address.v6[0]))
+            {
+                return(NX_IP_ADDRESS_ERROR);
+            }
+
+            ip_header_size = (UINT)sizeof(NX_IPV6_HEADER);
+        }
+#endif /* FEATURE_NX_IPV6 */
+
+        /* Check for an unsupported IP version.  */
+        if (ip_header_size == 0)
+        {
+            return(NX_IP_ADDRESS_ERROR);
+        }
+
+        /* Check for an invalid port.  */
+        if (((ULONG)message_ptr -> nx_udp_message_port) > (ULONG)NX_MAX_PORT)
+        {
+            return(NX_INVALID_PORT);
+        }
+
+        /* Check for an invalid packet prepend pointer.  */
+        /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+        if ((INT)(packet_ptr -> nx_packet_prepend_ptr - packet_ptr -> nx_packet_data_start) < (INT)(ip_header_size + sizeof(NX_UDP_HEADER)))
+        {
+            return(NX_UNDERFLOW);
+        }
+
+        /* Check for an invalid packet append pointer.  */
+        /*lint -e{946} suppress pointer subtraction, since it is necessary. */
+        if (packet_ptr -> nx_packet_append_ptr > packet_ptr -> nx_packet_data_end)
+        {
+            return(NX_OVERFLOW);
+        }
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual UDP socket batch send function.  */
+    status =  _nxd_udp_socket_batch_send(socket_ptr, message_array, message_count, messages_sent);
+
+    /* Clear the application's packet pointers of the datagrams that were sent
+       so they can't be accidentally used again by the application.  */
+    for (i = 0; i < *messages_sent; i++)
+    {
+        message_array[i].nx_udp_message_packet_ptr =  NX_NULL;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,132 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_ip_receive_workers_enable                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Yuxin Zhou, Microsoft Corporation                                   */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the IP receive workers enable    */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*    worker_count                          Number of worker threads      */
+/*    stack_ptr                             Pointer to worker stack area  */
+/*    stack_size                            Size of worker stack area     */
+/*    priority                              Priority of worker threads    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_receive_workers_enable         Actual receive workers enable */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Yuxin Zhou               Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_ip_receive_workers_enable(NX_IP *ip_ptr, UINT worker_count, VOID *stack_ptr, ULONG stack_size, UINT priority)
+{
+#ifdef NX_ENABLE_IP_RECEIVE_WORKERS
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID) || (stack_ptr == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid worker count.  */
+    if ((worker_count == 0) || (worker_count > NX_IP_RECEIVE_WORKER_MAX))
+    {
+        return(NX_OPTION_ERROR);
+    }
+
+    /* Check that each worker gets at least the minimum stack.  */
+    if ((stack_size / worker_count) < TX_MINIMUM_STACK)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check the priority specified.  */
+    if (priority >= TX_MAX_PRIORITIES)
+    {
+        return(NX_OPTION_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual receive workers enable function.  */
+    status =  _nx_ip_receive_workers_enable(ip_ptr, worker_count, stack_ptr, stack_size, priority);
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_IP_RECEIVE_WORKERS */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(worker_count);
+    NX_PARAMETER_NOT_USED(stack_ptr);
+    NX_PARAMETER_NOT_USED(stack_size);
+    NX_PARAMETER_NOT_USED(priority);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_IP_RECEIVE_WORKERS */
+}
+
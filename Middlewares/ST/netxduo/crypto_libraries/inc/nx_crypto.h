@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    nx_crypto.h                                         PORTABLE C      */
-/*                                                           6.1.7        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -49,6 +49,9 @@
 /*                                            Renamed FIPS symbol and     */
 /*                                            fips memory functions,      */
 /*                                            resulting in version 6.1.7  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            multi-block cipher calls,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -223,6 +226,13 @@ extern unsigned int _nx_crypto_library_state;
 #define NX_CRYPTO_PARAMETER_NOT_USED(p) ((void)(p))
 #endif /* NX_CRYPTO_PARAMETER_NOT_USED */
 
+/* Define the number of counter blocks the counter based modes (CTR, GCM and CCM) pass
+   to the block cipher function in one call. The cipher function is called with a length
+   that is a multiple of the block size and must encrypt every block in the buffer.  */
+#ifndef NX_CRYPTO_PARALLEL_BLOCKS
+#define NX_CRYPTO_PARALLEL_BLOCKS 4
+#endif /* NX_CRYPTO_PARALLEL_BLOCKS */
+
 /* Note that both input and output packets are prepared by the
    caller. For encryption/decryption operations, the callee shall
    use the output buffer for encrypted or decrypted data. For
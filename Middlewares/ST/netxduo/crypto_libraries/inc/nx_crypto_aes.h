@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_crypto_aes.h                                     PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -43,6 +43,9 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            multi-block encryption,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -109,6 +112,14 @@ extern   "C" {
 /* Define the control block structure for backward compatibility. */
 #define NX_AES                                   NX_CRYPTO_AES
 
+/* Define NX_CRYPTO_AES_ENABLE_CONSTANT_TIME to encrypt the blocks of the CTR, GCM and CCM
+   modes with a bitsliced AES that has no secret dependent table lookups, and to expand the
+   key without the S-box table. This is slower than the default table driven code and adds
+   480 bytes to each AES context. Decryption and the other modes keep using tables.  */
+/*
+#define NX_CRYPTO_AES_ENABLE_CONSTANT_TIME
+*/
+
 typedef struct NX_CRYPTO_AES_STRUCT
 {
     /* UINT nb; Number of bytes per column, equal to block length / 32  - ALWAYS == 4 */
@@ -128,6 +139,11 @@ typedef struct NX_CRYPTO_AES_STRUCT
     UINT nx_crypto_aes_key_schedule[NX_CRYPTO_AES_MAX_KEY_SIZE * 8];
     UINT nx_crypto_aes_decrypt_key_schedule[NX_CRYPTO_AES_MAX_KEY_SIZE * 8];
 
+#ifdef NX_CRYPTO_AES_ENABLE_CONSTANT_TIME
+    /* Round keys in bitsliced form, 8 words for each of up to 15 rounds keys. */
+    UINT nx_crypto_aes_bitsliced_key_schedule[(NX_CRYPTO_AES_MAX_KEY_SIZE + 7) * 8];
+#endif /* NX_CRYPTO_AES_ENABLE_CONSTANT_TIME */
+
     /* Metadata for each mode. */
     union
     {
@@ -139,6 +155,7 @@ typedef struct NX_CRYPTO_AES_STRUCT
 } NX_CRYPTO_AES;
 
 UINT _nx_crypto_aes_encrypt(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length);
+UINT _nx_crypto_aes_encrypt_blocks(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length);
 UINT _nx_crypto_aes_decrypt(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length);
 
 UINT _nx_crypto_aes_key_set(NX_CRYPTO_AES *aes_ptr, UCHAR *key, UINT key_size);
@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   ChaCha20-Poly1305 AEAD Cipher                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
+/*                                                                        */
+/*    nx_crypto_chacha20_poly1305.h                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the NetX ChaCha20-Poly1305 AEAD component         */
+/*    (RFC 8439).                                                         */
+/*                                                                        */
+/*    It is assumed that nx_api.h and nx_port.h have already been         */
+/*    included.                                                           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef NX_CRYPTO_CHACHA20_POLY1305_H
+#define NX_CRYPTO_CHACHA20_POLY1305_H
+
+/* Determine if a C++ compiler is being used.  If so, ensure that standard
+   C is used to process the API information.  */
+#ifdef __cplusplus
+
+/* Yes, C++ compiler is present.  Use standard C.  */
+extern   "C" {
+
+#endif
+
+#include "nx_crypto.h"
+
+#ifndef ULONG64
+#define ULONG64                                       unsigned long long
+#endif /* ULONG64 */
+
+#define NX_CRYPTO_CHACHA20_KEY_LEN_IN_BITS            256
+#define NX_CRYPTO_CHACHA20_NONCE_SIZE                 12
+#define NX_CRYPTO_CHACHA20_BLOCK_SIZE                 64
+
+/* Number of ChaCha20 blocks computed by one pass of the core. The lanes are
+   independent, so compilers can keep them in vector registers.  */
+#define NX_CRYPTO_CHACHA20_PARALLEL_BLOCKS            4
+#define NX_CRYPTO_CHACHA20_KEYSTREAM_SIZE             (NX_CRYPTO_CHACHA20_BLOCK_SIZE * NX_CRYPTO_CHACHA20_PARALLEL_BLOCKS)
+
+#define NX_CRYPTO_POLY1305_BLOCK_SIZE                 16
+#define NX_CRYPTO_POLY1305_TAG_SIZE                   16
+
+/* Poly1305 state. The accumulator and the clamped key r are stored in five
+   26-bit limbs so that every product fits a 64-bit accumulator.  */
+typedef struct NX_CRYPTO_POLY1305_STRUCT
+{
+    UINT  nx_crypto_poly1305_r[5];
+    UINT  nx_crypto_poly1305_h[5];
+    UINT  nx_crypto_poly1305_pad[4];
+    UCHAR nx_crypto_poly1305_buffer[NX_CRYPTO_POLY1305_BLOCK_SIZE];
+    UINT  nx_crypto_poly1305_buffer_length;
+} NX_CRYPTO_POLY1305;
+
+/* ChaCha20-Poly1305 context. */
+typedef struct NX_CRYPTO_CHACHA20_POLY1305_STRUCT
+{
+    /* ChaCha20 input block: constants, key, block counter and nonce. */
+    UINT  nx_crypto_chacha20_state[16];
+
+    /* Keystream of the last pass of the core and the offset of the first unused byte. */
+    UCHAR nx_crypto_chacha20_keystream[NX_CRYPTO_CHACHA20_KEYSTREAM_SIZE];
+    UINT  nx_crypto_chacha20_keystream_offset;
+
+    NX_CRYPTO_POLY1305 nx_crypto_chacha20_poly1305_mac;
+
+    /* Number of bytes of additional data and text authenticated. */
+    ULONG nx_crypto_chacha20_poly1305_aad_length;
+    ULONG nx_crypto_chacha20_poly1305_text_length;
+
+    /* Additional data for one-shot encrypt and decrypt operations. */
+    VOID *nx_crypto_chacha20_poly1305_additional_data;
+    UINT  nx_crypto_chacha20_poly1305_additional_data_len;
+} NX_CRYPTO_CHACHA20_POLY1305;
+
+
+UINT _nx_crypto_chacha20_poly1305_key_set(NX_CRYPTO_CHACHA20_POLY1305 *ctx, UCHAR *key);
+
+UINT _nx_crypto_chacha20_poly1305_init(NX_CRYPTO_CHACHA20_POLY1305 *ctx, UCHAR *nonce,
+                                       UCHAR *additional_data, UINT additional_len);
+
+UINT _nx_crypto_chacha20_poly1305_encrypt_update(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                 UCHAR *input, UCHAR *output, UINT length);
+
+UINT _nx_crypto_chacha20_poly1305_decrypt_update(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                 UCHAR *input, UCHAR *output, UINT length);
+
+UINT _nx_crypto_chacha20_poly1305_encrypt_calculate(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                    UCHAR *output, UINT icv_len);
+
+UINT _nx_crypto_chacha20_poly1305_decrypt_calculate(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                    UCHAR *input, UINT icv_len);
+
+UINT _nx_crypto_method_chacha20_poly1305_init(struct  NX_CRYPTO_METHOD_STRUCT *method,
+                                              UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                              VOID  **handle,
+                                              VOID  *crypto_metadata,
+                                              ULONG crypto_metadata_size);
+
+UINT _nx_crypto_method_chacha20_poly1305_cleanup(VOID *crypto_metadata);
+
+UINT _nx_crypto_method_chacha20_poly1305_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
+                                                   VOID *handle, /* Crypto handler */
+                                                   struct NX_CRYPTO_METHOD_STRUCT *method,
+                                                   UCHAR *key,
+                                                   NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                   UCHAR *input,
+                                                   ULONG input_length_in_byte,
+                                                   UCHAR *iv_ptr,
+                                                   UCHAR *output,
+                                                   ULONG output_length_in_byte,
+                                                   VOID *crypto_metadata,
+                                                   ULONG crypto_metadata_size,
+                                                   VOID *packet_ptr,
+                                                   VOID (*nx_crypto_hw_process_callback)(VOID *packet_ptr, UINT status));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NX_CRYPTO_CHACHA20_POLY1305_H */
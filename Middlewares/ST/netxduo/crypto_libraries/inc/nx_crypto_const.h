@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    nx_crypto_const.h                                  PORTABLE C       */
-/*                                                           6.1.7        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -47,6 +47,9 @@
 /*                                            renamed FIPS symbol to      */
 /*                                            self-test,                  */
 /*                                            resulting in version 6.1.7  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            X25519 and Ed25519,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -163,6 +166,7 @@ extern   "C" {
 #define NX_CRYPTO_DIGITAL_SIGNATURE_RSA          0x00050001
 #define NX_CRYPTO_DIGITAL_SIGNATURE_DSA          0x00050002
 #define NX_CRYPTO_DIGITAL_SIGNATURE_ECDSA        0x00050003
+#define NX_CRYPTO_DIGITAL_SIGNATURE_ED25519      0x00050004
 
 /*Define the elliptic curve algorithm */
 /* Values of 16 least significant bits are the same as named curve defined in RFC 4492, section 5.1.1 */
@@ -195,6 +199,7 @@ extern   "C" {
 #define NX_CRYPTO_EC_BRAINPOOLP256r1             0x0006001A
 #define NX_CRYPTO_EC_BRAINPOOLP384r1             0x0006001B
 #define NX_CRYPTO_EC_BRAINPOOLP512r1             0x0006001C
+#define NX_CRYPTO_EC_X25519                      0x0006001D
 #define NX_CRYPTO_EC_FFDHE2048                   0x00060100
 #define NX_CRYPTO_EC_FFDHE3072                   0x00060101
 #define NX_CRYPTO_EC_FFDHE4096                   0x00060102
@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Curve25519                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
+/*                                                                        */
+/*    nx_crypto_curve25519.h                              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the field arithmetic modulo 2^255 - 19 and the    */
+/*    twisted Edwards group operations shared by X25519 and Ed25519.      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef NX_CRYPTO_CURVE25519_H
+#define NX_CRYPTO_CURVE25519_H
+
+/* Determine if a C++ compiler is being used.  If so, ensure that standard
+   C is used to process the API information.  */
+#ifdef __cplusplus
+
+/* Yes, C++ compiler is present.  Use standard C.  */
+extern   "C" {
+
+#endif
+
+#include "nx_crypto.h"
+
+#ifndef ULONG64
+#define ULONG64                              unsigned long long
+#endif /* ULONG64 */
+
+#ifndef LONG64
+#define LONG64                               long long
+#endif /* LONG64 */
+
+/* Size of X25519 keys and shared secrets, and of Ed25519 keys. */
+#define NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES    32
+
+/* Field elements are stored in five 51-bit limbs (radix 2^51) on targets with a 64 x 64 bit
+   multiplier, and in ten limbs of alternating 26 and 25 bits (radix 2^25.5) otherwise.
+   Define NX_CRYPTO_CURVE25519_DISABLE_RADIX_51 to use the 32-bit limbs on 64-bit targets. */
+#if defined(__SIZEOF_INT128__) && !defined(NX_CRYPTO_CURVE25519_DISABLE_RADIX_51)
+#define NX_CRYPTO_CURVE25519_RADIX_51
+#define NX_CRYPTO_CURVE25519_LIMBS                5
+#define NX_CRYPTO_CURVE25519_UINT128              unsigned __int128
+typedef ULONG64 NX_CRYPTO_CURVE25519_LIMB;
+#else
+#define NX_CRYPTO_CURVE25519_LIMBS                10
+typedef INT NX_CRYPTO_CURVE25519_LIMB;
+#endif /* __SIZEOF_INT128__ && !NX_CRYPTO_CURVE25519_DISABLE_RADIX_51 */
+
+/* Define point of edwards25519 in extended coordinates (X / Z, Y / Z, T / Z with T = X * Y / Z). */
+typedef struct NX_CRYPTO_CURVE25519_POINT_STRUCT
+{
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_point_x[NX_CRYPTO_CURVE25519_LIMBS];
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_point_y[NX_CRYPTO_CURVE25519_LIMBS];
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_point_z[NX_CRYPTO_CURVE25519_LIMBS];
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_point_t[NX_CRYPTO_CURVE25519_LIMBS];
+} NX_CRYPTO_CURVE25519_POINT;
+
+VOID _nx_crypto_curve25519_fe_from_bytes(NX_CRYPTO_CURVE25519_LIMB *r, const UCHAR *bytes);
+VOID _nx_crypto_curve25519_fe_to_bytes(UCHAR *bytes, const NX_CRYPTO_CURVE25519_LIMB *a);
+VOID _nx_crypto_curve25519_fe_add(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                  const NX_CRYPTO_CURVE25519_LIMB *b);
+VOID _nx_crypto_curve25519_fe_sub(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                  const NX_CRYPTO_CURVE25519_LIMB *b);
+VOID _nx_crypto_curve25519_fe_mul(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                  const NX_CRYPTO_CURVE25519_LIMB *b);
+VOID _nx_crypto_curve25519_fe_sqr(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a);
+VOID _nx_crypto_curve25519_fe_inverse(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a);
+
+VOID _nx_crypto_curve25519_point_base_multiple(NX_CRYPTO_CURVE25519_POINT *r, const UCHAR *k);
+VOID _nx_crypto_curve25519_point_base_multiple_add(NX_CRYPTO_CURVE25519_POINT *r, const UCHAR *k1,
+                                                   const NX_CRYPTO_CURVE25519_POINT *q, const UCHAR *k2);
+VOID _nx_crypto_curve25519_point_encode(UCHAR *bytes, const NX_CRYPTO_CURVE25519_POINT *p);
+UINT _nx_crypto_curve25519_point_decode(NX_CRYPTO_CURVE25519_POINT *r, const UCHAR *bytes);
+VOID _nx_crypto_curve25519_point_negate(NX_CRYPTO_CURVE25519_POINT *p);
+
+VOID _nx_crypto_x25519_multiple(UCHAR *result, const UCHAR *k, const UCHAR *u);
+VOID _nx_crypto_x25519_base_multiple(UCHAR *result, const UCHAR *k);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NX_CRYPTO_CURVE25519_H */
@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_crypto_ec.h                                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -44,6 +44,10 @@
 /*  09-30-2020     Timothy Stapko           Modified comment(s), and      */
 /*                                            added public key validation,*/
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            dedicated secp256r1 backend,*/
+/*                                            added X25519 curve,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -144,6 +148,15 @@ typedef struct NX_CRYPTO_EC_STRUCT
     VOID (*nx_crypto_ec_reduce)(struct NX_CRYPTO_EC_STRUCT *curve,
                                 NX_CRYPTO_HUGE_NUMBER *value,
                                 HN_UBASE *scratch);
+
+    /* r = u1 * G + u2 * q, for public inputs only. NX_CRYPTO_NULL when the curve has no
+       dedicated implementation. */
+    VOID (*nx_crypto_ec_multiple_add)(struct NX_CRYPTO_EC_STRUCT *curve,
+                                      NX_CRYPTO_HUGE_NUMBER *u1,
+                                      NX_CRYPTO_EC_POINT *q,
+                                      NX_CRYPTO_HUGE_NUMBER *u2,
+                                      NX_CRYPTO_EC_POINT *r,
+                                      HN_UBASE *scratch);
 } NX_CRYPTO_EC;
 
 #define NX_CRYPTO_EC_POINT_INITIALIZE(p, type, buff, size)                              \
@@ -207,12 +220,14 @@ extern NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp224r1;
 extern NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp256r1;
 extern NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp384r1;
 extern NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp521r1;
+extern NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_x25519;
 
 #define NX_CRYPTO_EC_GET_SECP192R1(curve) curve = (NX_CRYPTO_EC *)&_nx_crypto_ec_secp192r1
 #define NX_CRYPTO_EC_GET_SECP224R1(curve) curve = (NX_CRYPTO_EC *)&_nx_crypto_ec_secp224r1
 #define NX_CRYPTO_EC_GET_SECP256R1(curve) curve = (NX_CRYPTO_EC *)&_nx_crypto_ec_secp256r1
 #define NX_CRYPTO_EC_GET_SECP384R1(curve) curve = (NX_CRYPTO_EC *)&_nx_crypto_ec_secp384r1
 #define NX_CRYPTO_EC_GET_SECP521R1(curve) curve = (NX_CRYPTO_EC *)&_nx_crypto_ec_secp521r1
+#define NX_CRYPTO_EC_GET_X25519(curve)    curve = (NX_CRYPTO_EC *)&_nx_crypto_ec_x25519
 
 UINT _nx_crypto_ec_point_is_infinite(NX_CRYPTO_EC_POINT *point);
 VOID _nx_crypto_ec_point_set_infinite(NX_CRYPTO_EC_POINT *point);
@@ -268,6 +283,22 @@ VOID _nx_crypto_ec_fp_fixed_multiple(NX_CRYPTO_EC *curve,
                                      NX_CRYPTO_EC_POINT *r,
                                      HN_UBASE *scratch);
 
+/* secp256r1 uses fixed width field arithmetic unless NX_CRYPTO_ECC_DISABLE_SECP256R1_BACKEND
+   is defined. It needs no scratch buffer and is constant time for secret factors. */
+#ifndef NX_CRYPTO_ECC_DISABLE_SECP256R1_BACKEND
+VOID _nx_crypto_ec_secp256r1_multiple(NX_CRYPTO_EC *curve,
+                                      NX_CRYPTO_EC_POINT *g,
+                                      NX_CRYPTO_HUGE_NUMBER *d,
+                                      NX_CRYPTO_EC_POINT *r,
+                                      HN_UBASE *scratch);
+VOID _nx_crypto_ec_secp256r1_multiple_add(NX_CRYPTO_EC *curve,
+                                          NX_CRYPTO_HUGE_NUMBER *u1,
+                                          NX_CRYPTO_EC_POINT *q,
+                                          NX_CRYPTO_HUGE_NUMBER *u2,
+                                          NX_CRYPTO_EC_POINT *r,
+                                          HN_UBASE *scratch);
+#endif /* NX_CRYPTO_ECC_DISABLE_SECP256R1_BACKEND */
+
 VOID _nx_crypto_ec_naf_compute(NX_CRYPTO_HUGE_NUMBER *d, HN_UBASE *naf_data, UINT *naf_size);
 VOID _nx_crypto_ec_add_digit_reduce(NX_CRYPTO_EC *curve,
                                     NX_CRYPTO_HUGE_NUMBER *value,
@@ -361,6 +392,16 @@ UINT _nx_crypto_method_ec_secp521r1_operation(UINT op,
                                               VOID *crypto_metadata, ULONG crypto_metadata_size,
                                               VOID *packet_ptr,
                                               VOID (*nx_crypto_hw_process_callback)(VOID *, UINT));
+UINT _nx_crypto_method_ec_x25519_operation(UINT op,
+                                           VOID *handle,
+                                           struct NX_CRYPTO_METHOD_STRUCT *method,
+                                           UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                           UCHAR *input, ULONG input_length_in_byte,
+                                           UCHAR *iv_ptr,
+                                           UCHAR *output, ULONG output_length_in_byte,
+                                           VOID *crypto_metadata, ULONG crypto_metadata_size,
+                                           VOID *packet_ptr,
+                                           VOID (*nx_crypto_hw_process_callback)(VOID *, UINT));
 #ifdef __cplusplus
 }
 #endif
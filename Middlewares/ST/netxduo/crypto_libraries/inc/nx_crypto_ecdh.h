@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_crypto_ecdh.h                                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -43,6 +43,9 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            added X25519 support,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -59,6 +62,7 @@ extern   "C" {
 #endif
 
 #include "nx_crypto_ec.h"
+#include "nx_crypto_curve25519.h"
 
 
 /* Max Elliptic-curve Diffie-Hellman key size. Buffer size for calculations is 4X the key size */
@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Ed25519 Digital Signature Algorithm                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    nx_crypto_ed25519.h                                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the basic Application Interface (API) to the      */
+/*    NetX Ed25519 module (RFC 8032, pure variant).                       */
+/*                                                                        */
+/*    It is assumed that nx_api.h and nx_port.h have already been         */
+/*    included.                                                           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef  NX_CRYPTO_ED25519_H
+#define  NX_CRYPTO_ED25519_H
+
+
+/* Determine if a C++ compiler is being used.  If so, ensure that standard
+   C is used to process the API information.  */
+#ifdef __cplusplus
+
+/* Yes, C++ compiler is present.  Use standard C.  */
+extern   "C" {
+
+#endif
+
+#include "nx_crypto.h"
+#include "nx_crypto_huge_number.h"
+#include "nx_crypto_sha5.h"
+#include "nx_crypto_curve25519.h"
+
+/* Private keys are 32-byte seeds, optionally followed by the 32-byte public key. */
+#define NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES         NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES
+#define NX_CRYPTO_ED25519_SIGNATURE_SIZE_IN_BYTES   64
+
+/* Ed25519 signature structure. */
+typedef struct NX_CRYPTO_ED25519
+{
+    NX_CRYPTO_SHA512 nx_crypto_ed25519_sha512;
+} NX_CRYPTO_ED25519;
+
+/* Define the function prototypes for Ed25519.  */
+
+UINT _nx_crypto_ed25519_public_key_generate(NX_CRYPTO_SHA512 *sha512,
+                                            UCHAR *private_key,
+                                            UCHAR *public_key);
+
+UINT _nx_crypto_ed25519_sign(NX_CRYPTO_SHA512 *sha512,
+                             UCHAR *message,
+                             UINT message_length,
+                             UCHAR *private_key,
+                             UINT private_key_length,
+                             UCHAR *signature,
+                             ULONG signature_length,
+                             ULONG *actual_signature_length);
+
+UINT _nx_crypto_ed25519_verify(NX_CRYPTO_SHA512 *sha512,
+                               UCHAR *message,
+                               UINT message_length,
+                               UCHAR *public_key,
+                               UINT public_key_length,
+                               UCHAR *signature,
+                               UINT signature_length);
+
+UINT _nx_crypto_method_ed25519_init(struct  NX_CRYPTO_METHOD_STRUCT *method,
+                                    UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                    VOID  **handle,
+                                    VOID  *crypto_metadata,
+                                    ULONG crypto_metadata_size);
+
+UINT _nx_crypto_method_ed25519_cleanup(VOID *crypto_metadata);
+
+UINT _nx_crypto_method_ed25519_operation(UINT op,
+                                         VOID *handle,
+                                         struct NX_CRYPTO_METHOD_STRUCT *method,
+                                         UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                         UCHAR *input, ULONG input_length_in_byte,
+                                         UCHAR *iv_ptr,
+                                         UCHAR *output, ULONG output_length_in_byte,
+                                         VOID *crypto_metadata, ULONG crypto_metadata_size,
+                                         VOID *packet_ptr,
+                                         VOID (*nx_crypto_hw_process_callback)(VOID *, UINT));
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_crypto_gcm.h                                     PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -43,6 +43,9 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            table-driven GHASH,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -68,6 +71,25 @@ extern   "C" {
 #define NX_CRYPTO_GCM_BLOCK_SIZE_INT 4
 #define NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT 4
 
+/* By default GHASH multiplies four bits at a time using a table of 16 precomputed multiples
+   of the hash key (256 bytes in each GCM context). Define NX_CRYPTO_GCM_GHASH_TABLE_8BIT to
+   multiply a byte at a time using a table of 256 multiples (4KB in each GCM context), or
+   NX_CRYPTO_GCM_GHASH_TABLE_DISABLE to use the bit-serial multiplication without a table.  */
+/*
+#define NX_CRYPTO_GCM_GHASH_TABLE_8BIT
+*/
+/*
+#define NX_CRYPTO_GCM_GHASH_TABLE_DISABLE
+*/
+#ifndef NX_CRYPTO_GCM_GHASH_TABLE_DISABLE
+#ifdef NX_CRYPTO_GCM_GHASH_TABLE_8BIT
+#define NX_CRYPTO_GCM_GHASH_TABLE_BITS 8
+#else
+#define NX_CRYPTO_GCM_GHASH_TABLE_BITS 4
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_8BIT */
+#define NX_CRYPTO_GCM_GHASH_TABLE_SIZE (1 << NX_CRYPTO_GCM_GHASH_TABLE_BITS)
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_DISABLE */
+
 typedef struct NX_CRYPTO_GCM_STRUCT
 {
 
@@ -85,6 +107,11 @@ typedef struct NX_CRYPTO_GCM_STRUCT
 
     /* Length of additional data. */
     UINT nx_crypto_gcm_additional_data_len;
+
+#ifndef NX_CRYPTO_GCM_GHASH_TABLE_DISABLE
+    /* Multiples of the hash key for table-driven GHASH, each as four big endian words. */
+    UINT nx_crypto_gcm_hkey_table[NX_CRYPTO_GCM_GHASH_TABLE_SIZE][NX_CRYPTO_GCM_BLOCK_SIZE_INT];
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_DISABLE */
 } NX_CRYPTO_GCM;
 
 NX_CRYPTO_KEEP UINT _nx_crypto_gcm_encrypt_init(VOID *crypto_metadata, NX_CRYPTO_GCM *gcm_metadata,
@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_crypto_hmac.h                                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -43,6 +43,10 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            keyed pad state cache and   */
+/*                                            multi-buffer HMAC,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -66,6 +70,17 @@ extern   "C" {
 #define NX_CRYPTO_HMAC_MAX_PAD_SIZE  (128)
 #endif
 
+/* Size of the hash state saved after the keyed ipad and opad blocks.
+   SHA-384/512 keep eight 64-bit words and a 128-bit bit count.  */
+#ifndef NX_CRYPTO_HMAC_MAX_STATE_SIZE
+#define NX_CRYPTO_HMAC_MAX_STATE_SIZE  (80)
+#endif
+
+/* Maximum number of messages authenticated together by _nx_crypto_hmac_multi.  */
+#ifndef NX_CRYPTO_HMAC_MULTI_BUFFER_LANES
+#define NX_CRYPTO_HMAC_MULTI_BUFFER_LANES  (4)
+#endif
+
 typedef struct NX_CRYPTO_HMAC_STRUCT
 {
     VOID  *context;
@@ -79,6 +94,16 @@ typedef struct NX_CRYPTO_HMAC_STRUCT
     UINT   (*crypto_digest_calculate)(VOID *, UCHAR *, UINT);
     NX_CRYPTO_METHOD *hash_method;
     VOID *hash_context;
+
+    /* Hash states after absorbing k_ipad and k_opad. They are valid while
+       state_algorithm matches the algorithm and the key is unchanged.  */
+    VOID  *state_context;
+    UINT   state_size;
+    UINT   state_algorithm;
+    UCHAR  ipad_state[NX_CRYPTO_HMAC_MAX_STATE_SIZE];
+    UCHAR  opad_state[NX_CRYPTO_HMAC_MAX_STATE_SIZE];
+    UINT   (*crypto_multi_update)(VOID **, UCHAR **, UINT, UINT);
+    UINT   (*crypto_multi_digest_calculate)(VOID **, UCHAR **, UINT, UINT);
 } NX_CRYPTO_HMAC;
 
 UINT _nx_crypto_hmac(NX_CRYPTO_HMAC *crypto_matadata,
@@ -99,6 +124,16 @@ VOID _nx_crypto_hmac_metadata_set(NX_CRYPTO_HMAC *hmac_metadata,
                                   UINT (*crypto_update)(VOID *, UCHAR *, UINT),
                                   UINT (*crypto_digest_calculate)(VOID *, UCHAR *, UINT));
 
+VOID _nx_crypto_hmac_state_cache_set(NX_CRYPTO_HMAC *hmac_metadata, VOID *state_context, UINT state_size);
+
+VOID _nx_crypto_hmac_multi_buffer_set(NX_CRYPTO_HMAC *hmac_metadata,
+                                      UINT (*crypto_multi_update)(VOID **, UCHAR **, UINT, UINT),
+                                      UINT (*crypto_multi_digest_calculate)(VOID **, UCHAR **, UINT, UINT));
+
+UINT _nx_crypto_hmac_multi(NX_CRYPTO_HMAC *hmac_metadata, VOID **context,
+                           UCHAR **input_ptr, UINT input_length,
+                           UCHAR **digest_ptr, UINT digest_length, UINT count);
+
 UINT _nx_crypto_hmac_hash_initialize(VOID *context, UINT algorithm);
 UINT   _nx_crypto_hmac_hash_update(VOID *context, UCHAR *input, UINT input_length);
 UINT   _nx_crypto_hmac_hash_digest_calculate(VOID *context, UCHAR *digest, UINT algorithm);
@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_crypto_huge_number.h                             PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -44,6 +44,9 @@
 /*  09-30-2020     Timothy Stapko           Modified comment(s), and      */
 /*                                            fixed number initialization,*/
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            sliding window exponent,    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -108,6 +111,22 @@ extern   "C" {
 #error "NX_CRYPTO_HUGE_NUMBER_BITS supports 16 and 32 only!"
 #endif
 
+/* Define the maximum window size in bits for Montgomery exponentiation.
+ * The window size actually used is chosen from the exponent length and
+ * is never larger than 6. Each extra bit doubles the number of odd powers
+ * precomputed in scratch, see _nx_crypto_huge_number_mont_power_modulus.
+ * Set it to 1 to fall back to plain square-and-multiply. */
+#ifndef NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS
+#define NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS 4
+#endif /* NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS */
+
+#if (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS < 1) || (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS > 6)
+#error "NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS supports 1 to 6 only!"
+#endif
+
+/* Number of precomputed odd powers for Montgomery exponentiation. */
+#define NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_SIZE (1 << (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS - 1))
+
 
 /* Huge number structure - contains data pointer and size. */
 typedef struct NX_CRYPTO_HUGE_NUMBER_STRUCT
@@ -136,6 +155,11 @@ typedef struct NX_CRYPTO_HUGE_NUMBER_STRUCT
     (hn) -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;    \
     (buff) = (buff) + (((size) + HN_SIZE_ROUND) >> HN_SIZE_SHIFT);
 
+/* Get bit b of the magnitude of huge number, bit 0 is the least significant. */
+#define NX_CRYPTO_HUGE_NUMBER_BIT(hn, b)                                                   \
+    (UINT)(((hn) -> nx_crypto_huge_number_data[(b) >> (HN_SIZE_SHIFT + 3)] >>              \
+            ((b) & (NX_CRYPTO_HUGE_NUMBER_BITS - 1))) & 1)
+
 /* Is it an even huge number? */
 #define NX_CRYPTO_HUGE_NUMBER_IS_EVEN(hn) \
     !((hn) -> nx_crypto_huge_number_data[0] & 1)
@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_crypto_rsa.h                                     PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -43,6 +43,9 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            scratch for window table,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -61,6 +64,7 @@ extern   "C" {
 /* Include the ThreadX and port-specific data type file.  */
 
 #include "nx_crypto.h"
+#include "nx_crypto_huge_number.h"
 
 /* Define the maximum size of an RSA modulus supported in bits. */
 #ifndef NX_CRYPTO_MAX_RSA_MODULUS_SIZE
@@ -68,10 +72,19 @@ extern   "C" {
 #endif
 
 
-/* Scratch buffer for RSA calculations.
-    Size must be no less than 10 * sizeof(modulus) + 24. 2584 bytes for 2048 bits cryption.
-    If CRT algorithm is not used, size must be no less than (7 * sizeof(modulus) + 8). 1800 bytes for 2048 bits cryption. */
-#define NX_CRYPTO_RSA_SCRATCH_BUFFER_SIZE (((10 * (NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 8)) + 24) / sizeof(USHORT))
+/* Scratch buffer for RSA calculations. W is NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_SIZE (8 by default).
+    Size must be no less than 8.5 * sizeof(modulus) + (W + 1) * (0.5 * sizeof(modulus) + 4) + 24.
+    3388 bytes for 2048 bits cryption with the default window.
+    If CRT algorithm is not used, size must be no less than (5 * sizeof(modulus) + (W + 1) * (sizeof(modulus) + 4)).
+    3620 bytes for 2048 bits cryption with the default window. */
+#define NX_CRYPTO_RSA_SCRATCH_CRT_SIZE     (((17 * (NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 8)) >> 1) + \
+                                            ((NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_SIZE + 1) *    \
+                                             ((NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 16) + 4)) + 24)
+#define NX_CRYPTO_RSA_SCRATCH_NON_CRT_SIZE ((5 * (NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 8)) +       \
+                                            ((NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_SIZE + 1) *    \
+                                             ((NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 8) + 4)))
+#define NX_CRYPTO_RSA_SCRATCH_BUFFER_SIZE  (((NX_CRYPTO_RSA_SCRATCH_CRT_SIZE > NX_CRYPTO_RSA_SCRATCH_NON_CRT_SIZE) ? \
+                                             NX_CRYPTO_RSA_SCRATCH_CRT_SIZE : NX_CRYPTO_RSA_SCRATCH_NON_CRT_SIZE) / sizeof(USHORT))
 
 /* Control block for RSA cryptographic operations. */
 typedef struct NX_CRYPTO_RSA_STRUCT
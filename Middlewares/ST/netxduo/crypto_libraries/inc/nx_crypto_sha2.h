@@ -25,7 +25,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    nx_crypto_sha2.h                                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -45,6 +45,9 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            multi-buffer functions,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -69,6 +72,11 @@ extern   "C" {
 #define NX_CRYPTO_SHA224_ICV_LEN_IN_BITS    224
 #define NX_CRYPTO_SHA256_ICV_LEN_IN_BITS    256
 
+/* Number of independent digests processed together by the multi-buffer functions. */
+#ifndef NX_CRYPTO_SHA256_MULTI_BUFFER_LANES
+#define NX_CRYPTO_SHA256_MULTI_BUFFER_LANES 4
+#endif /* NX_CRYPTO_SHA256_MULTI_BUFFER_LANES */
+
 /* Define the control block structure for backward compatibility. */
 #define NX_SHA256                               NX_CRYPTO_SHA256
 
@@ -94,6 +102,8 @@ UINT _nx_crypto_sha256_initialize(NX_CRYPTO_SHA256 *context, UINT algorithm);
 UINT _nx_crypto_sha256_update(NX_CRYPTO_SHA256 *context, UCHAR *input_ptr, UINT input_length);
 UINT _nx_crypto_sha256_digest_calculate(NX_CRYPTO_SHA256 *context, UCHAR *digest, UINT algorithm);
 VOID _nx_crypto_sha256_process_buffer(NX_CRYPTO_SHA256 * context, UCHAR buffer[64]);
+UINT _nx_crypto_sha256_multi_update(NX_CRYPTO_SHA256 **context, UCHAR **input_ptr, UINT input_length, UINT count);
+UINT _nx_crypto_sha256_multi_digest_calculate(NX_CRYPTO_SHA256 **context, UCHAR **digest, UINT count, UINT algorithm);
 
 UINT _nx_crypto_method_sha256_init(struct  NX_CRYPTO_METHOD_STRUCT *method,
                                    UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
@@ -396,6 +396,10 @@ static const UCHAR aes_rcon_array[] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40,
 
 #endif
 
+#ifdef NX_CRYPTO_AES_ENABLE_CONSTANT_TIME
+#define NX_CRYPTO_AES_ROTR16(val) (((val) << 16) | ((val) >> 16))
+#endif /* NX_CRYPTO_AES_ENABLE_CONSTANT_TIME */
+
 #ifdef NX_CRYPTO_SELF_TEST
 extern UINT _nx_crypto_library_state;
 #endif /* NX_CRYPTO_SELF_TEST */
@@ -1132,6 +1136,742 @@ UINT *buf;
 }
 
 
+#ifdef NX_CRYPTO_AES_ENABLE_CONSTANT_TIME
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_ortho                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function converts two blocks between the normal and the        */
+/*    bitsliced representation. In the bitsliced representation word i    */
+/*    holds bit i of all 32 bytes of the two blocks, so that the AES      */
+/*    rounds can be computed with logical operations only. The            */
+/*    conversion is its own inverse.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Pointer to eight state words  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_key_schedule  Convert the key schedule      */
+/*    _nx_crypto_aes_encrypt_blocks         Encrypt multiple blocks       */
+/*    _nx_crypto_aes_subword                Perform SubBytes on a word    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_ortho(UINT *q)
+{
+UINT i;
+UINT a, b;
+
+    /* Swap single bits, then bit pairs, then nibbles between the eight words. */
+    for (i = 0; i < 8; i += 2)
+    {
+        a = q[i];
+        b = q[i + 1];
+        q[i] = (a & 0x55555555) | ((b & 0x55555555) << 1);
+        q[i + 1] = ((a & 0xAAAAAAAA) >> 1) | (b & 0xAAAAAAAA);
+    }
+
+    for (i = 0; i < 8; i += 4)
+    {
+        a = q[i];
+        b = q[i + 2];
+        q[i] = (a & 0x33333333) | ((b & 0x33333333) << 2);
+        q[i + 2] = ((a & 0xCCCCCCCC) >> 2) | (b & 0xCCCCCCCC);
+        a = q[i + 1];
+        b = q[i + 3];
+        q[i + 1] = (a & 0x33333333) | ((b & 0x33333333) << 2);
+        q[i + 3] = ((a & 0xCCCCCCCC) >> 2) | (b & 0xCCCCCCCC);
+    }
+
+    for (i = 0; i < 4; i++)
+    {
+        a = q[i];
+        b = q[i + 4];
+        q[i] = (a & 0x0F0F0F0F) | ((b & 0x0F0F0F0F) << 4);
+        q[i + 4] = ((a & 0xF0F0F0F0) >> 4) | (b & 0xF0F0F0F0);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_sbox                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function applies the AES S-box to all 32 bytes of a bitsliced  */
+/*    state, using the circuit of Boyar and Peralta instead of a table    */
+/*    lookup so that the execution time does not depend on the data.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Pointer to bitsliced state    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_encrypt_blocks         Encrypt multiple blocks       */
+/*    _nx_crypto_aes_subword                Perform SubBytes on a word    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_sbox(UINT *q)
+{
+UINT x0, x1, x2, x3, x4, x5, x6, x7;
+UINT y1, y2, y3, y4, y5, y6, y7, y8, y9;
+UINT y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+UINT y20, y21;
+UINT z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+UINT z10, z11, z12, z13, z14, z15, z16, z17;
+UINT t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+UINT t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+UINT t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+UINT t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+UINT t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+UINT t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+UINT t60, t61, t62, t63, t64, t65, t66, t67;
+
+    /* x0 is the most significant bit of each byte. */
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* Top linear transformation. */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* Non-linear section: inversion in GF(2^8). */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* Bottom linear transformation. */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    q[7] = t59 ^ t63;
+    q[1] = t56 ^ ~t62;
+    q[0] = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    q[4] = t53 ^ t66;
+    q[3] = t51 ^ t66;
+    q[2] = t47 ^ t65;
+    q[6] = t64 ^ ~q[4];
+    q[5] = t55 ^ ~t67;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_shift_rows                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs ShiftRows(state) on a bitsliced state.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Pointer to bitsliced state    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_encrypt_blocks         Encrypt multiple blocks       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_shift_rows(UINT *q)
+{
+UINT i;
+UINT x;
+
+    /* Each word holds one bit of all 32 bytes of the two blocks, with the
+       two bits of a column pair per row.  Rotate row r of each block left by r. */
+    for (i = 0; i < 8; i++)
+    {
+        x = q[i];
+        q[i] = (x & 0x000000FF) |
+               ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6) |
+               ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4) |
+               ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_mix_columns                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs MixColumns(state) on a bitsliced state.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Pointer to bitsliced state    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_encrypt_blocks         Encrypt multiple blocks       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_mix_columns(UINT *q)
+{
+UINT q0, q1, q2, q3, q4, q5, q6, q7;
+UINT r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0];
+    q1 = q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = q[5];
+    q6 = q[6];
+    q7 = q[7];
+
+    /* r = the next row of the same column. */
+    r0 = (q0 >> 8) | (q0 << 24);
+    r1 = (q1 >> 8) | (q1 << 24);
+    r2 = (q2 >> 8) | (q2 << 24);
+    r3 = (q3 >> 8) | (q3 << 24);
+    r4 = (q4 >> 8) | (q4 << 24);
+    r5 = (q5 >> 8) | (q5 << 24);
+    r6 = (q6 >> 8) | (q6 << 24);
+    r7 = (q7 >> 8) | (q7 << 24);
+
+    /* {02}.a ^ {03}.b ^ c ^ d, where multiplication by {02} shifts the bit planes
+       and folds bit 7 back in with the AES polynomial. */
+    q[0] = q7 ^ r7 ^ r0 ^ NX_CRYPTO_AES_ROTR16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ NX_CRYPTO_AES_ROTR16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ NX_CRYPTO_AES_ROTR16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ NX_CRYPTO_AES_ROTR16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ NX_CRYPTO_AES_ROTR16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ NX_CRYPTO_AES_ROTR16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ NX_CRYPTO_AES_ROTR16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ NX_CRYPTO_AES_ROTR16(q7 ^ r7);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_key_schedule                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function converts the expanded encryption key schedule into    */
+/*    bitsliced round keys, with the same round key in both lanes.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    aes_ptr                               Pointer to AES control block  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_ortho         Convert to bitsliced form     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_key_set                Set the key for AES           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_key_schedule(NX_CRYPTO_AES *aes_ptr)
+{
+UCHAR *w = (UCHAR *)aes_ptr -> nx_crypto_aes_key_schedule;
+UINT  *sk = aes_ptr -> nx_crypto_aes_bitsliced_key_schedule;
+UINT   round;
+UINT   i;
+
+    for (round = 0; round <= aes_ptr -> nx_crypto_aes_rounds; round++)
+    {
+        for (i = 0; i < 4; i++)
+        {
+            sk[i << 1] = (UINT)w[0] | ((UINT)w[1] << 8) | ((UINT)w[2] << 16) | ((UINT)w[3] << 24);
+            sk[(i << 1) + 1] = sk[i << 1];
+            w += 4;
+        }
+
+        _nx_crypto_aes_bitslice_ortho(sk);
+        sk += 8;
+    }
+}
+#endif /* NX_CRYPTO_AES_ENABLE_CONSTANT_TIME */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_encrypt_blocks                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs AES encryption on each 16 byte block of the  */
+/*    message pointed to by "input", and stores the encrypted blocks in   */
+/*    the buffer pointed to by "output", which may be the same buffer.    */
+/*    The blocks are independent, as used by the counter based modes.     */
+/*                                                                        */
+/*    Two blocks are processed at a time with the rounds interleaved, so  */
+/*    that the table lookups of both blocks overlap. When                 */
+/*    NX_CRYPTO_AES_ENABLE_CONSTANT_TIME is defined the two blocks are    */
+/*    encrypted with the bitsliced implementation instead.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    aes_ptr                               Pointer to AES control block  */
+/*    input                                 Pointer to input blocks       */
+/*    output                                Pointer to output blocks      */
+/*    length                                Length of input, a multiple   */
+/*                                            of 16 bytes.                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_ortho         Convert to bitsliced form     */
+/*    _nx_crypto_aes_bitslice_sbox          Perform bitsliced SubBytes    */
+/*    _nx_crypto_aes_bitslice_shift_rows    Perform bitsliced ShiftRows   */
+/*    _nx_crypto_aes_bitslice_mix_columns   Perform bitsliced MixColumns  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ctr_encrypt                Perform CTR mode encryption   */
+/*    _nx_crypto_gcm_encrypt_update         Update data for GCM mode      */
+/*    _nx_crypto_gcm_decrypt_update         Update data for GCM mode      */
+/*    _nx_crypto_ccm_encrypt_update         Update data for CCM mode      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_aes_encrypt_blocks(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length)
+{
+#ifndef NX_CRYPTO_AES_ENABLE_CONSTANT_TIME
+UINT   num_rounds;
+UINT  *w;
+UINT  *round_key;
+UINT   state[8];
+UINT   temp[8];
+UCHAR *bytes = (UCHAR *)temp;
+UCHAR *second_input;
+UINT   blocks;
+UINT   round;
+UINT   i;
+
+
+    w = aes_ptr -> nx_crypto_aes_key_schedule;
+
+    num_rounds = aes_ptr -> nx_crypto_aes_rounds;
+
+    if (num_rounds < 10 || num_rounds > 14)
+    {
+        return(NX_CRYPTO_INVALID_PARAMETER);
+    }
+
+    while (length >= NX_CRYPTO_AES_BLOCK_SIZE)
+    {
+
+        /* Encrypt two blocks at a time. A single remaining block is run in both halves. */
+        if (length >= (NX_CRYPTO_AES_BLOCK_SIZE << 1))
+        {
+            second_input = input + NX_CRYPTO_AES_BLOCK_SIZE;
+            blocks = 2;
+        }
+        else
+        {
+            second_input = input;
+            blocks = 1;
+        }
+
+        for (i = 0; i < NX_CRYPTO_AES_BLOCK_SIZE; i++)
+        {
+            bytes[i] = input[i];
+            bytes[i + NX_CRYPTO_AES_BLOCK_SIZE] = second_input[i];
+        }
+
+        /* AddRoundKey with the first round key. */
+        for (i = 0; i < 8; i++)
+        {
+            state[i] = temp[i] ^ w[i & 3];
+        }
+
+        /* SubBytes, ShiftRows, MixColumns and AddRoundKey, see _nx_crypto_aes_encryption_round. */
+        for (round = 1; round < num_rounds; round++)
+        {
+            round_key = &w[round * 4];
+            for (i = 0; i < 8; i += 4)
+            {
+                temp[i] = aes_encryption_table[EXTRACT_MSB_BYTE(state[i])] ^
+                    (LEFT_ROTATE24(aes_encryption_table[EXTRACT_2ND_BYTE(state[i + 1])])) ^
+                    (LEFT_ROTATE16(aes_encryption_table[EXTRACT_3RD_BYTE(state[i + 2])])) ^
+                    (LEFT_ROTATE8(aes_encryption_table[EXTRACT_LSB_BYTE(state[i + 3])])) ^
+                    round_key[0];
+
+                temp[i + 1] = aes_encryption_table[EXTRACT_MSB_BYTE(state[i + 1])] ^
+                    (LEFT_ROTATE24(aes_encryption_table[EXTRACT_2ND_BYTE(state[i + 2])])) ^
+                    (LEFT_ROTATE16(aes_encryption_table[EXTRACT_3RD_BYTE(state[i + 3])])) ^
+                    (LEFT_ROTATE8(aes_encryption_table[EXTRACT_LSB_BYTE(state[i])])) ^
+                    round_key[1];
+
+                temp[i + 2] = aes_encryption_table[EXTRACT_MSB_BYTE(state[i + 2])] ^
+                    (LEFT_ROTATE24(aes_encryption_table[EXTRACT_2ND_BYTE(state[i + 3])])) ^
+                    (LEFT_ROTATE16(aes_encryption_table[EXTRACT_3RD_BYTE(state[i])])) ^
+                    (LEFT_ROTATE8(aes_encryption_table[EXTRACT_LSB_BYTE(state[i + 1])])) ^
+                    round_key[2];
+
+                temp[i + 3] = aes_encryption_table[EXTRACT_MSB_BYTE(state[i + 3])] ^
+                    (LEFT_ROTATE24(aes_encryption_table[EXTRACT_2ND_BYTE(state[i])])) ^
+                    (LEFT_ROTATE16(aes_encryption_table[EXTRACT_3RD_BYTE(state[i + 1])])) ^
+                    (LEFT_ROTATE8(aes_encryption_table[EXTRACT_LSB_BYTE(state[i + 2])])) ^
+                    round_key[3];
+            }
+
+            for (i = 0; i < 8; i++)
+            {
+                state[i] = temp[i];
+            }
+        }
+
+        /* The last round without MixColumns, see _nx_crypto_aes_sub_shift_roundkey. */
+        round_key = &w[num_rounds * 4];
+        for (i = 0; i < 8; i += 4)
+        {
+            temp[i] = ((SET_MSB_BYTE(sub_bytes_sbox[EXTRACT_MSB_BYTE(state[i])])) |
+                       (SET_2ND_BYTE(sub_bytes_sbox[EXTRACT_2ND_BYTE(state[i + 1])])) |
+                       (SET_3RD_BYTE(sub_bytes_sbox[EXTRACT_3RD_BYTE(state[i + 2])])) |
+                       (SET_LSB_BYTE(sub_bytes_sbox[EXTRACT_LSB_BYTE(state[i + 3])]))) ^ round_key[0];
+
+            temp[i + 1] = ((SET_MSB_BYTE(sub_bytes_sbox[EXTRACT_MSB_BYTE(state[i + 1])])) |
+                           (SET_2ND_BYTE(sub_bytes_sbox[EXTRACT_2ND_BYTE(state[i + 2])])) |
+                           (SET_3RD_BYTE(sub_bytes_sbox[EXTRACT_3RD_BYTE(state[i + 3])])) |
+                           (SET_LSB_BYTE(sub_bytes_sbox[EXTRACT_LSB_BYTE(state[i])]))) ^ round_key[1];
+
+            temp[i + 2] = ((SET_MSB_BYTE(sub_bytes_sbox[EXTRACT_MSB_BYTE(state[i + 2])])) |
+                           (SET_2ND_BYTE(sub_bytes_sbox[EXTRACT_2ND_BYTE(state[i + 3])])) |
+                           (SET_3RD_BYTE(sub_bytes_sbox[EXTRACT_3RD_BYTE(state[i])])) |
+                           (SET_LSB_BYTE(sub_bytes_sbox[EXTRACT_LSB_BYTE(state[i + 1])]))) ^ round_key[2];
+
+            temp[i + 3] = ((SET_MSB_BYTE(sub_bytes_sbox[EXTRACT_MSB_BYTE(state[i + 3])])) |
+                           (SET_2ND_BYTE(sub_bytes_sbox[EXTRACT_2ND_BYTE(state[i])])) |
+                           (SET_3RD_BYTE(sub_bytes_sbox[EXTRACT_3RD_BYTE(state[i + 1])])) |
+                           (SET_LSB_BYTE(sub_bytes_sbox[EXTRACT_LSB_BYTE(state[i + 2])]))) ^ round_key[3];
+        }
+
+        for (i = 0; i < (blocks << 4); i++)
+        {
+            output[i] = bytes[i];
+        }
+
+        input += blocks << 4;
+        output += blocks << 4;
+        length -= blocks << 4;
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(state, 0, sizeof(state));
+    NX_CRYPTO_MEMSET(temp, 0, sizeof(temp));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+#else
+UINT   num_rounds;
+UINT  *sk;
+UINT   q[8];
+UCHAR *second_input;
+UINT   blocks;
+UINT   round;
+UINT   word;
+UINT   i;
+
+
+    sk = aes_ptr -> nx_crypto_aes_bitsliced_key_schedule;
+
+    num_rounds = aes_ptr -> nx_crypto_aes_rounds;
+
+    if (num_rounds < 10 || num_rounds > 14)
+    {
+        return(NX_CRYPTO_INVALID_PARAMETER);
+    }
+
+    while (length >= NX_CRYPTO_AES_BLOCK_SIZE)
+    {
+
+        /* Encrypt two blocks at a time. A single remaining block is run in both halves. */
+        if (length >= (NX_CRYPTO_AES_BLOCK_SIZE << 1))
+        {
+            second_input = input + NX_CRYPTO_AES_BLOCK_SIZE;
+            blocks = 2;
+        }
+        else
+        {
+            second_input = input;
+            blocks = 1;
+        }
+
+        /* Interleave the words of the two blocks and convert them to bitsliced form. */
+        for (i = 0; i < 4; i++)
+        {
+            q[i << 1] = (UINT)input[0] | ((UINT)input[1] << 8) | ((UINT)input[2] << 16) | ((UINT)input[3] << 24);
+            q[(i << 1) + 1] = (UINT)second_input[0] | ((UINT)second_input[1] << 8) |
+                              ((UINT)second_input[2] << 16) | ((UINT)second_input[3] << 24);
+            input += 4;
+            second_input += 4;
+        }
+        _nx_crypto_aes_bitslice_ortho(q);
+
+        for (i = 0; i < 8; i++)
+        {
+            q[i] ^= sk[i];
+        }
+
+        for (round = 1; round < num_rounds; round++)
+        {
+            _nx_crypto_aes_bitslice_sbox(q);
+            _nx_crypto_aes_bitslice_shift_rows(q);
+            _nx_crypto_aes_bitslice_mix_columns(q);
+            for (i = 0; i < 8; i++)
+            {
+                q[i] ^= sk[(round << 3) + i];
+            }
+        }
+
+        _nx_crypto_aes_bitslice_sbox(q);
+        _nx_crypto_aes_bitslice_shift_rows(q);
+        for (i = 0; i < 8; i++)
+        {
+            q[i] ^= sk[(num_rounds << 3) + i];
+        }
+
+        _nx_crypto_aes_bitslice_ortho(q);
+
+        for (i = 0; i < (blocks << 2); i++)
+        {
+
+            /* Words of the first block are even, words of the second block are odd. */
+            word = q[((i & 3) << 1) + (i >> 2)];
+            output[0] = (UCHAR)word;
+            output[1] = (UCHAR)(word >> 8);
+            output[2] = (UCHAR)(word >> 16);
+            output[3] = (UCHAR)(word >> 24);
+            output += 4;
+        }
+
+        input += (blocks - 1) << 4;
+        length -= blocks << 4;
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+#endif /* NX_CRYPTO_AES_ENABLE_CONSTANT_TIME */
+}
+
+
 /**************************************************************************/
 /* Key expansion routines                                                 */
 /**************************************************************************/
@@ -1140,7 +1880,7 @@ UINT *buf;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_aes_subword                              PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -1161,7 +1901,8 @@ UINT *buf;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _nx_crypto_aes_bitslice_ortho         Convert to bitsliced form     */
+/*    _nx_crypto_aes_bitslice_sbox          Perform bitsliced SubBytes    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1174,16 +1915,35 @@ UINT *buf;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            constant time option,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP static UINT _nx_crypto_aes_subword(UINT word)
 {
 UINT result;
+#ifdef NX_CRYPTO_AES_ENABLE_CONSTANT_TIME
+UINT q[8];
+UINT i;
+
+    /* Substitute the bytes with the bitsliced S-box, the other lanes are unused. */
+    q[0] = word;
+    for (i = 1; i < 8; i++)
+    {
+        q[i] = 0;
+    }
+    _nx_crypto_aes_bitslice_ortho(q);
+    _nx_crypto_aes_bitslice_sbox(q);
+    _nx_crypto_aes_bitslice_ortho(q);
+    result = q[0];
+#else
 
     result = sub_bytes_sbox[word & 0xFF];
     result |= (UINT)((sub_bytes_sbox[(word & 0x0000FF00) >>  8]) <<  8);
     result |= (UINT)((sub_bytes_sbox[(word & 0x00FF0000) >> 16]) << 16);
     result |= (UINT)((sub_bytes_sbox[(word & 0xFF000000) >> 24]) << 24);
+#endif /* NX_CRYPTO_AES_ENABLE_CONSTANT_TIME */
     return result;
 }
 
@@ -1594,7 +2354,7 @@ UINT *buf;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_aes_key_set                              PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -1621,6 +2381,8 @@ UINT *buf;
 /*                                                                        */
 /*    _nx_crypto_aes_key_expansion          Key expansion for encryption  */
 /*    _nx_crypto_aes_key_expansion_inverse  Key expansion for decryption  */
+/*    _nx_crypto_aes_bitslice_key_schedule  Convert the key schedule to   */
+/*                                            bitsliced form              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1633,6 +2395,9 @@ UINT *buf;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            constant time option,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_aes_key_set(NX_CRYPTO_AES *aes_ptr, UCHAR *key, UINT key_size)
@@ -1671,6 +2436,10 @@ UINT   i;
 
     _nx_crypto_aes_key_expansion_inverse(aes_ptr);
 
+#ifdef NX_CRYPTO_AES_ENABLE_CONSTANT_TIME
+    _nx_crypto_aes_bitslice_key_schedule(aes_ptr);
+#endif /* NX_CRYPTO_AES_ENABLE_CONSTANT_TIME */
+
     return(NX_CRYPTO_SUCCESS);
 }
 
@@ -2144,7 +2913,7 @@ UINT    status;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_method_aes_ccm_operation                 PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -2192,6 +2961,9 @@ UINT    status;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            multi-block encryption,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT  _nx_crypto_method_aes_ccm_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
@@ -2263,7 +3035,7 @@ UINT    status;
             }
 
             status = _nx_crypto_ccm_decrypt_init(ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                  ctx -> nx_crypto_aes_mode_context.ccm.nx_crypto_ccm_additional_data,
                                                  ctx -> nx_crypto_aes_mode_context.ccm.nx_crypto_ccm_additional_data_len,
                                                  input_length_in_byte - (method -> nx_crypto_ICV_size_in_bits >> 3), iv_ptr, 
@@ -2277,7 +3049,7 @@ UINT    status;
 
             status = _nx_crypto_ccm_decrypt_update(NX_CRYPTO_DECRYPT_UPDATE,
                                                    ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte - (method -> nx_crypto_ICV_size_in_bits >> 3),
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
             if (status)
@@ -2286,7 +3058,7 @@ UINT    status;
             }
 
             status = _nx_crypto_ccm_decrypt_calculate(ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                       input + input_length_in_byte - (method -> nx_crypto_ICV_size_in_bits >> 3),
                                                       NX_CRYPTO_AES_BLOCK_SIZE);
             if (status)
@@ -2312,7 +3084,7 @@ UINT    status;
             }
 
             status = _nx_crypto_ccm_encrypt_init(ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                  ctx -> nx_crypto_aes_mode_context.ccm.nx_crypto_ccm_additional_data,
                                                  ctx -> nx_crypto_aes_mode_context.ccm.nx_crypto_ccm_additional_data_len,
                                                  input_length_in_byte, iv_ptr, 
@@ -2326,7 +3098,7 @@ UINT    status;
 
             status = _nx_crypto_ccm_encrypt_update(NX_CRYPTO_ENCRYPT_UPDATE,
                                                    ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
             if (status)
@@ -2335,7 +3107,7 @@ UINT    status;
             }
 
             status = _nx_crypto_ccm_encrypt_calculate(ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                       output + input_length_in_byte,
                                                       NX_CRYPTO_AES_BLOCK_SIZE);
             if (status)
@@ -2365,7 +3137,7 @@ UINT    status;
             }
 
             status = _nx_crypto_ccm_decrypt_init(ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                  input, /* pointers to AAD */
                                                  input_length_in_byte, /* length of AAD */
                                                  output_length_in_byte, /* total length of message */
@@ -2378,7 +3150,7 @@ UINT    status;
         {
             status = _nx_crypto_ccm_decrypt_update(NX_CRYPTO_DECRYPT_UPDATE,
                                                    ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
 
@@ -2387,7 +3159,7 @@ UINT    status;
         case NX_CRYPTO_DECRYPT_CALCULATE:
         {
             status = _nx_crypto_ccm_decrypt_calculate(ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                       input, NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
 
@@ -2400,7 +3172,7 @@ UINT    status;
             }
 
             status = _nx_crypto_ccm_encrypt_init(ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                  input, /* pointers to AAD */
                                                  input_length_in_byte, /* length of AAD */
                                                  output_length_in_byte, /* total length of message */
@@ -2414,7 +3186,7 @@ UINT    status;
 
             status = _nx_crypto_ccm_encrypt_update(NX_CRYPTO_ENCRYPT_UPDATE,
                                                    ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2423,7 +3195,7 @@ UINT    status;
         {
 
             status = _nx_crypto_ccm_encrypt_calculate(ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                       output, NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
 
@@ -2441,7 +3213,7 @@ UINT    status;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_method_aes_gcm_operation                 PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -2489,6 +3261,9 @@ UINT    status;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            multi-block encryption,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT  _nx_crypto_method_aes_gcm_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
@@ -2564,7 +3339,7 @@ UINT    status;
 
             message_len = input_length_in_byte - icv_len;
             status = _nx_crypto_gcm_decrypt_init(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                  ctx -> nx_crypto_aes_mode_context.gcm.nx_crypto_gcm_additional_data,
                                                  ctx -> nx_crypto_aes_mode_context.gcm.nx_crypto_gcm_additional_data_len,
                                                  iv_ptr, NX_CRYPTO_AES_BLOCK_SIZE);
@@ -2575,7 +3350,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_decrypt_update(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, message_len,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
 
@@ -2585,7 +3360,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_decrypt_calculate(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                       input + message_len, icv_len,
                                                       NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2609,7 +3384,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_encrypt_init(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                  ctx -> nx_crypto_aes_mode_context.gcm.nx_crypto_gcm_additional_data,
                                                  ctx -> nx_crypto_aes_mode_context.gcm.nx_crypto_gcm_additional_data_len,
                                                  iv_ptr, NX_CRYPTO_AES_BLOCK_SIZE);
@@ -2620,7 +3395,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_encrypt_update(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
 
@@ -2630,7 +3405,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_encrypt_calculate(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                       output + input_length_in_byte, icv_len,
                                                       NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2644,7 +3419,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_decrypt_init(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                  input, /* pointers to AAD */
                                                  input_length_in_byte, /* length of AAD */
                                                  iv_ptr, NX_CRYPTO_AES_BLOCK_SIZE);
@@ -2653,7 +3428,7 @@ UINT    status;
         case NX_CRYPTO_DECRYPT_UPDATE:
         {
             status = _nx_crypto_gcm_decrypt_update(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2668,7 +3443,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_decrypt_calculate(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                       input, icv_len,
                                                       NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2682,7 +3457,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_encrypt_init(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                  input, /* pointers to AAD */
                                                  input_length_in_byte, /* length of AAD */
                                                  iv_ptr, NX_CRYPTO_AES_BLOCK_SIZE);
@@ -2691,7 +3466,7 @@ UINT    status;
         case NX_CRYPTO_ENCRYPT_UPDATE:
         {
             status = _nx_crypto_gcm_encrypt_update(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2706,7 +3481,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_encrypt_calculate(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                      (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                       output, icv_len,
                                                       NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2737,7 +3512,7 @@ UINT    status;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_method_aes_ctr_operation                 PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -2784,6 +3559,9 @@ UINT    status;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            multi-block encryption,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT  _nx_crypto_method_aes_ctr_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
@@ -2840,7 +3618,7 @@ UINT                status;
             }
 
             status = _nx_crypto_ctr_encrypt(ctx, &(ctx -> nx_crypto_aes_mode_context.ctr),
-                                            (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                            (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                             input, output, input_length_in_byte,
                                             NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2859,7 +3637,7 @@ UINT                status;
         case NX_CRYPTO_DECRYPT_UPDATE:
         {
             status = _nx_crypto_ctr_encrypt(ctx, &(ctx -> nx_crypto_aes_mode_context.ctr),
-                                            (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                            (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                             input, output, input_length_in_byte,
                                             NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2978,7 +3756,7 @@ UINT            status;
     ctx = (NX_CRYPTO_AES *)crypto_metadata;
 
     status = _nx_crypto_xcbc_mac(ctx,
-                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                 (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_aes_key_set,
                                  key, key_size_in_bits,
                                  input, output, input_length_in_byte,
@@ -343,14 +343,16 @@ UCHAR *A = ccm_metadata -> nx_crypto_ccm_A;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_ccm_encrypt_update                       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function updates data for GCM encryption or decryption.        */
+/*    This function updates data for CCM encryption or decryption. Up to  */
+/*    NX_CRYPTO_PARALLEL_BLOCKS counter blocks are encrypted in each call */
+/*    to the crypto function.                                             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -381,6 +383,9 @@ UCHAR *A = ccm_metadata -> nx_crypto_ccm_A;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            multi-block encryption,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_ccm_encrypt_update(UINT op, VOID *crypto_metadata, NX_CRYPTO_CCM *ccm_metadata,
@@ -388,8 +393,8 @@ NX_CRYPTO_KEEP UINT _nx_crypto_ccm_encrypt_update(UINT op, VOID *crypto_metadata
                                                   UCHAR *input, UCHAR *output, UINT length, UINT block_size)
 {
 UCHAR *A = ccm_metadata -> nx_crypto_ccm_A;
-UCHAR  X[NX_CRYPTO_CCM_BLOCK_SIZE];
-UINT   i = 0, k = 0;
+UCHAR  X[NX_CRYPTO_CCM_BLOCK_SIZE * NX_CRYPTO_PARALLEL_BLOCKS];
+UINT   i = 0, j = 0, k = 0, n = 0;
 
     /* Check the block size.  */
     if (block_size != NX_CRYPTO_CCM_BLOCK_SIZE)
@@ -417,12 +422,24 @@ UINT   i = 0, k = 0;
 
         /* Parse the plain text as M(1)||M(2)||..., where the block M(i) is a 16-byte string.  */
         /* Cipher text block: C(i) = E(Key, A(i)) ^ M(i)   */
-        for (i = 0; i < length; i += block_size)
+        for (i = 0; i < length; i += n)
         {
-            A[15] = (UCHAR)(A[15] + 1);
-            crypto_function(crypto_metadata, A, X, block_size);
 
-            for (k = 0; (k < block_size) && ((i + k) < length); k++)
+            /* Encrypt up to NX_CRYPTO_PARALLEL_BLOCKS counter blocks A(i) in one call.  */
+            n = length - i;
+            if (n > sizeof(X))
+            {
+                n = sizeof(X);
+            }
+
+            for (j = 0; j < n; j += block_size)
+            {
+                A[15] = (UCHAR)(A[15] + 1);
+                NX_CRYPTO_MEMCPY(&X[j], A, block_size); /* Use case of memcpy is verified. */
+            }
+            crypto_function(crypto_metadata, X, X, j);
+
+            for (k = 0; k < n; k++)
             {
                 output[i + k] = X[k] ^ input[i + k];
             }
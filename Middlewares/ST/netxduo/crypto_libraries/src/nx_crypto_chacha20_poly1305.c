@@ -0,0 +1,1515 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   ChaCha20-Poly1305 AEAD Cipher                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#include "nx_crypto_chacha20_poly1305.h"
+
+#define NX_CRYPTO_CHACHA20_LOAD32(p)          ((UINT)(p)[0] | ((UINT)(p)[1] << 8) | \
+                                               ((UINT)(p)[2] << 16) | ((UINT)(p)[3] << 24))
+#define NX_CRYPTO_CHACHA20_STORE32(p, v)      ((p)[0] = (UCHAR)(v), (p)[1] = (UCHAR)((v) >> 8), \
+                                               (p)[2] = (UCHAR)((v) >> 16), (p)[3] = (UCHAR)((v) >> 24))
+#define NX_CRYPTO_CHACHA20_ROTL(v, n)         (((v) << (n)) | ((v) >> (32 - (n))))
+
+/* Apply the quarter round to words a, b, c and d of every lane. */
+#define NX_CRYPTO_CHACHA20_QUARTER_ROUND(x, a, b, c, d)                                   \
+    for (l = 0; l < NX_CRYPTO_CHACHA20_PARALLEL_BLOCKS; l++)                              \
+    {                                                                                     \
+        x[a][l] += x[b][l]; x[d][l] ^= x[a][l]; x[d][l] = NX_CRYPTO_CHACHA20_ROTL(x[d][l], 16); \
+        x[c][l] += x[d][l]; x[b][l] ^= x[c][l]; x[b][l] = NX_CRYPTO_CHACHA20_ROTL(x[b][l], 12); \
+        x[a][l] += x[b][l]; x[d][l] ^= x[a][l]; x[d][l] = NX_CRYPTO_CHACHA20_ROTL(x[d][l], 8);  \
+        x[c][l] += x[d][l]; x[b][l] ^= x[c][l]; x[b][l] = NX_CRYPTO_CHACHA20_ROTL(x[b][l], 7);  \
+    }
+
+#define NX_CRYPTO_POLY1305_MASK_26            0x3FFFFFF
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_blocks                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes NX_CRYPTO_CHACHA20_PARALLEL_BLOCKS           */
+/*    consecutive ChaCha20 blocks in one pass, interleaving the rounds of */
+/*    the blocks, and advances the block counter of the state.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    state                                 ChaCha20 input block          */
+/*    keystream                             Output keystream              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_init     Initialize ChaCha20-Poly1305  */
+/*    _nx_crypto_chacha20_poly1305_encrypt_update                         */
+/*                                          Encrypt data                  */
+/*    _nx_crypto_chacha20_poly1305_decrypt_update                         */
+/*                                          Decrypt data                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_chacha20_blocks(UINT *state, UCHAR *keystream)
+{
+UINT x[16][NX_CRYPTO_CHACHA20_PARALLEL_BLOCKS];
+UINT i;
+UINT l;
+UINT round;
+UINT word;
+
+    for (i = 0; i < 16; i++)
+    {
+        for (l = 0; l < NX_CRYPTO_CHACHA20_PARALLEL_BLOCKS; l++)
+        {
+            x[i][l] = state[i];
+        }
+    }
+
+    /* Each lane computes the next block. */
+    for (l = 0; l < NX_CRYPTO_CHACHA20_PARALLEL_BLOCKS; l++)
+    {
+        x[12][l] += l;
+    }
+
+    /* 20 rounds: 10 iterations of column round and diagonal round. */
+    for (round = 0; round < 10; round++)
+    {
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x, 0, 4,  8, 12);
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x, 1, 5,  9, 13);
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x, 2, 6, 10, 14);
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x, 3, 7, 11, 15);
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x, 0, 5, 10, 15);
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x, 1, 6, 11, 12);
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x, 2, 7,  8, 13);
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x, 3, 4,  9, 14);
+    }
+
+    /* Add the input block and serialize in little endian. */
+    for (l = 0; l < NX_CRYPTO_CHACHA20_PARALLEL_BLOCKS; l++)
+    {
+        for (i = 0; i < 16; i++)
+        {
+            word = x[i][l] + state[i];
+            if (i == 12)
+            {
+                word += l;
+            }
+            NX_CRYPTO_CHACHA20_STORE32(keystream + (l * NX_CRYPTO_CHACHA20_BLOCK_SIZE) + (i << 2), word);
+        }
+    }
+
+    state[12] += NX_CRYPTO_CHACHA20_PARALLEL_BLOCKS;
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(x, 0, sizeof(x));
+#endif /* NX_SECURE_KEY_CLEAR  */
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_poly1305_key_set                         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the one-time Poly1305 key. The clamped r is      */
+/*    split into 26-bit limbs and the accumulator is cleared.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    poly1305                              Poly1305 state                */
+/*    key                                   32-byte one-time key          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_init     Initialize ChaCha20-Poly1305  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_poly1305_key_set(NX_CRYPTO_POLY1305 *poly1305, UCHAR *key)
+{
+
+    /* r &= 0x0ffffffc0ffffffc0ffffffc0fffffff */
+    poly1305 -> nx_crypto_poly1305_r[0] = (NX_CRYPTO_CHACHA20_LOAD32(key)) & 0x3FFFFFF;
+    poly1305 -> nx_crypto_poly1305_r[1] = (NX_CRYPTO_CHACHA20_LOAD32(key + 3) >> 2) & 0x3FFFF03;
+    poly1305 -> nx_crypto_poly1305_r[2] = (NX_CRYPTO_CHACHA20_LOAD32(key + 6) >> 4) & 0x3FFC0FF;
+    poly1305 -> nx_crypto_poly1305_r[3] = (NX_CRYPTO_CHACHA20_LOAD32(key + 9) >> 6) & 0x3F03FFF;
+    poly1305 -> nx_crypto_poly1305_r[4] = (NX_CRYPTO_CHACHA20_LOAD32(key + 12) >> 8) & 0x00FFFFF;
+
+    poly1305 -> nx_crypto_poly1305_h[0] = 0;
+    poly1305 -> nx_crypto_poly1305_h[1] = 0;
+    poly1305 -> nx_crypto_poly1305_h[2] = 0;
+    poly1305 -> nx_crypto_poly1305_h[3] = 0;
+    poly1305 -> nx_crypto_poly1305_h[4] = 0;
+
+    poly1305 -> nx_crypto_poly1305_pad[0] = NX_CRYPTO_CHACHA20_LOAD32(key + 16);
+    poly1305 -> nx_crypto_poly1305_pad[1] = NX_CRYPTO_CHACHA20_LOAD32(key + 20);
+    poly1305 -> nx_crypto_poly1305_pad[2] = NX_CRYPTO_CHACHA20_LOAD32(key + 24);
+    poly1305 -> nx_crypto_poly1305_pad[3] = NX_CRYPTO_CHACHA20_LOAD32(key + 28);
+
+    poly1305 -> nx_crypto_poly1305_buffer_length = 0;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_poly1305_blocks                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function absorbs whole 16-byte blocks into the Poly1305        */
+/*    accumulator: h = (h + m) * r mod 2^130 - 5. The limbs of r are kept */
+/*    in registers across blocks and all products fit in 64 bits.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    poly1305                              Poly1305 state                */
+/*    input                                 Input blocks                  */
+/*    length                                Input length, multiple of 16  */
+/*    hibit                                 Bit 128 of each block in limb */
+/*                                            4, 1 << 24 or 0             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_poly1305_update            Update Poly1305               */
+/*    _nx_crypto_poly1305_pad               Pad Poly1305 input            */
+/*    _nx_crypto_poly1305_finish            Compute Poly1305 tag          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_poly1305_blocks(NX_CRYPTO_POLY1305 *poly1305, UCHAR *input,
+                                                      UINT length, UINT hibit)
+{
+UINT    r0, r1, r2, r3, r4;
+UINT    s1, s2, s3, s4;
+UINT    h0, h1, h2, h3, h4;
+ULONG64 d0, d1, d2, d3, d4;
+UINT    c;
+
+    r0 = poly1305 -> nx_crypto_poly1305_r[0];
+    r1 = poly1305 -> nx_crypto_poly1305_r[1];
+    r2 = poly1305 -> nx_crypto_poly1305_r[2];
+    r3 = poly1305 -> nx_crypto_poly1305_r[3];
+    r4 = poly1305 -> nx_crypto_poly1305_r[4];
+
+    /* 2^130 = 5 mod p, so the limbs that wrap around are multiplied by 5. */
+    s1 = r1 * 5;
+    s2 = r2 * 5;
+    s3 = r3 * 5;
+    s4 = r4 * 5;
+
+    h0 = poly1305 -> nx_crypto_poly1305_h[0];
+    h1 = poly1305 -> nx_crypto_poly1305_h[1];
+    h2 = poly1305 -> nx_crypto_poly1305_h[2];
+    h3 = poly1305 -> nx_crypto_poly1305_h[3];
+    h4 = poly1305 -> nx_crypto_poly1305_h[4];
+
+    while (length >= NX_CRYPTO_POLY1305_BLOCK_SIZE)
+    {
+
+        /* h += m */
+        h0 += (NX_CRYPTO_CHACHA20_LOAD32(input)) & NX_CRYPTO_POLY1305_MASK_26;
+        h1 += (NX_CRYPTO_CHACHA20_LOAD32(input + 3) >> 2) & NX_CRYPTO_POLY1305_MASK_26;
+        h2 += (NX_CRYPTO_CHACHA20_LOAD32(input + 6) >> 4) & NX_CRYPTO_POLY1305_MASK_26;
+        h3 += (NX_CRYPTO_CHACHA20_LOAD32(input + 9) >> 6) & NX_CRYPTO_POLY1305_MASK_26;
+        h4 += (NX_CRYPTO_CHACHA20_LOAD32(input + 12) >> 8) | hibit;
+
+        /* h *= r */
+        d0 = ((ULONG64)h0 * r0) + ((ULONG64)h1 * s4) + ((ULONG64)h2 * s3) + ((ULONG64)h3 * s2) + ((ULONG64)h4 * s1);
+        d1 = ((ULONG64)h0 * r1) + ((ULONG64)h1 * r0) + ((ULONG64)h2 * s4) + ((ULONG64)h3 * s3) + ((ULONG64)h4 * s2);
+        d2 = ((ULONG64)h0 * r2) + ((ULONG64)h1 * r1) + ((ULONG64)h2 * r0) + ((ULONG64)h3 * s4) + ((ULONG64)h4 * s3);
+        d3 = ((ULONG64)h0 * r3) + ((ULONG64)h1 * r2) + ((ULONG64)h2 * r1) + ((ULONG64)h3 * r0) + ((ULONG64)h4 * s4);
+        d4 = ((ULONG64)h0 * r4) + ((ULONG64)h1 * r3) + ((ULONG64)h2 * r2) + ((ULONG64)h3 * r1) + ((ULONG64)h4 * r0);
+
+        /* Partial reduction mod p. */
+        c = (UINT)(d0 >> 26);
+        h0 = (UINT)d0 & NX_CRYPTO_POLY1305_MASK_26;
+        d1 += c;
+        c = (UINT)(d1 >> 26);
+        h1 = (UINT)d1 & NX_CRYPTO_POLY1305_MASK_26;
+        d2 += c;
+        c = (UINT)(d2 >> 26);
+        h2 = (UINT)d2 & NX_CRYPTO_POLY1305_MASK_26;
+        d3 += c;
+        c = (UINT)(d3 >> 26);
+        h3 = (UINT)d3 & NX_CRYPTO_POLY1305_MASK_26;
+        d4 += c;
+        c = (UINT)(d4 >> 26);
+        h4 = (UINT)d4 & NX_CRYPTO_POLY1305_MASK_26;
+        h0 += c * 5;
+        c = h0 >> 26;
+        h0 &= NX_CRYPTO_POLY1305_MASK_26;
+        h1 += c;
+
+        input += NX_CRYPTO_POLY1305_BLOCK_SIZE;
+        length -= NX_CRYPTO_POLY1305_BLOCK_SIZE;
+    }
+
+    poly1305 -> nx_crypto_poly1305_h[0] = h0;
+    poly1305 -> nx_crypto_poly1305_h[1] = h1;
+    poly1305 -> nx_crypto_poly1305_h[2] = h2;
+    poly1305 -> nx_crypto_poly1305_h[3] = h3;
+    poly1305 -> nx_crypto_poly1305_h[4] = h4;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_poly1305_update                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function absorbs data of any length into Poly1305, buffering   */
+/*    an incomplete trailing block until more data arrives.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    poly1305                              Poly1305 state                */
+/*    input                                 Input data                    */
+/*    length                                Length of input data          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_poly1305_blocks            Absorb Poly1305 blocks        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_init     Initialize ChaCha20-Poly1305  */
+/*    _nx_crypto_chacha20_poly1305_encrypt_update                         */
+/*                                          Encrypt data                  */
+/*    _nx_crypto_chacha20_poly1305_decrypt_update                         */
+/*                                          Decrypt data                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_poly1305_update(NX_CRYPTO_POLY1305 *poly1305, UCHAR *input, UINT length)
+{
+UINT buffer_length = poly1305 -> nx_crypto_poly1305_buffer_length;
+UINT copy_length;
+
+    if (buffer_length)
+    {
+
+        /* Complete the buffered block first. */
+        copy_length = NX_CRYPTO_POLY1305_BLOCK_SIZE - buffer_length;
+        if (copy_length > length)
+        {
+            copy_length = length;
+        }
+
+        NX_CRYPTO_MEMCPY(&poly1305 -> nx_crypto_poly1305_buffer[buffer_length], input, copy_length); /* Use case of memcpy is verified. */
+        buffer_length += copy_length;
+        input += copy_length;
+        length -= copy_length;
+
+        if (buffer_length < NX_CRYPTO_POLY1305_BLOCK_SIZE)
+        {
+            poly1305 -> nx_crypto_poly1305_buffer_length = buffer_length;
+            return;
+        }
+
+        _nx_crypto_poly1305_blocks(poly1305, poly1305 -> nx_crypto_poly1305_buffer,
+                                   NX_CRYPTO_POLY1305_BLOCK_SIZE, 1 << 24);
+        buffer_length = 0;
+    }
+
+    /* Process whole blocks straight from the input. */
+    copy_length = length & ~(UINT)(NX_CRYPTO_POLY1305_BLOCK_SIZE - 1);
+    if (copy_length)
+    {
+        _nx_crypto_poly1305_blocks(poly1305, input, copy_length, 1 << 24);
+        input += copy_length;
+        length -= copy_length;
+    }
+
+    if (length)
+    {
+        NX_CRYPTO_MEMCPY(poly1305 -> nx_crypto_poly1305_buffer, input, length); /* Use case of memcpy is verified. */
+        buffer_length = length;
+    }
+
+    poly1305 -> nx_crypto_poly1305_buffer_length = buffer_length;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_poly1305_pad                             PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function pads the data absorbed so far with zeros to a         */
+/*    multiple of 16 bytes, as required between the additional data and   */
+/*    the ciphertext of the AEAD construction.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    poly1305                              Poly1305 state                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*    _nx_crypto_poly1305_blocks            Absorb Poly1305 blocks        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_init     Initialize ChaCha20-Poly1305  */
+/*    _nx_crypto_chacha20_poly1305_tag      Compute AEAD tag              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_poly1305_pad(NX_CRYPTO_POLY1305 *poly1305)
+{
+UINT buffer_length = poly1305 -> nx_crypto_poly1305_buffer_length;
+
+    if (buffer_length)
+    {
+        NX_CRYPTO_MEMSET(&poly1305 -> nx_crypto_poly1305_buffer[buffer_length], 0,
+                         NX_CRYPTO_POLY1305_BLOCK_SIZE - buffer_length);
+        _nx_crypto_poly1305_blocks(poly1305, poly1305 -> nx_crypto_poly1305_buffer,
+                                   NX_CRYPTO_POLY1305_BLOCK_SIZE, 1 << 24);
+        poly1305 -> nx_crypto_poly1305_buffer_length = 0;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_poly1305_finish                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function absorbs any buffered partial block, fully reduces the */
+/*    accumulator and adds the second half of the key to produce the tag. */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    poly1305                              Poly1305 state                */
+/*    tag                                   Output 16-byte tag            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*    _nx_crypto_poly1305_blocks            Absorb Poly1305 blocks        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_tag      Compute AEAD tag              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_poly1305_finish(NX_CRYPTO_POLY1305 *poly1305, UCHAR *tag)
+{
+UINT    buffer_length = poly1305 -> nx_crypto_poly1305_buffer_length;
+UINT    h0, h1, h2, h3, h4;
+UINT    g0, g1, g2, g3, g4;
+UINT    c;
+UINT    mask;
+ULONG64 f;
+
+    if (buffer_length)
+    {
+
+        /* The final partial block is terminated by a one byte and has no bit 128. */
+        poly1305 -> nx_crypto_poly1305_buffer[buffer_length] = 1;
+        NX_CRYPTO_MEMSET(&poly1305 -> nx_crypto_poly1305_buffer[buffer_length + 1], 0,
+                         NX_CRYPTO_POLY1305_BLOCK_SIZE - buffer_length - 1);
+        _nx_crypto_poly1305_blocks(poly1305, poly1305 -> nx_crypto_poly1305_buffer,
+                                   NX_CRYPTO_POLY1305_BLOCK_SIZE, 0);
+        poly1305 -> nx_crypto_poly1305_buffer_length = 0;
+    }
+
+    h0 = poly1305 -> nx_crypto_poly1305_h[0];
+    h1 = poly1305 -> nx_crypto_poly1305_h[1];
+    h2 = poly1305 -> nx_crypto_poly1305_h[2];
+    h3 = poly1305 -> nx_crypto_poly1305_h[3];
+    h4 = poly1305 -> nx_crypto_poly1305_h[4];
+
+    /* Fully carry h. */
+    c = h1 >> 26;
+    h1 &= NX_CRYPTO_POLY1305_MASK_26;
+    h2 += c;
+    c = h2 >> 26;
+    h2 &= NX_CRYPTO_POLY1305_MASK_26;
+    h3 += c;
+    c = h3 >> 26;
+    h3 &= NX_CRYPTO_POLY1305_MASK_26;
+    h4 += c;
+    c = h4 >> 26;
+    h4 &= NX_CRYPTO_POLY1305_MASK_26;
+    h0 += c * 5;
+    c = h0 >> 26;
+    h0 &= NX_CRYPTO_POLY1305_MASK_26;
+    h1 += c;
+
+    /* g = h + 5 - 2^130 */
+    g0 = h0 + 5;
+    c = g0 >> 26;
+    g0 &= NX_CRYPTO_POLY1305_MASK_26;
+    g1 = h1 + c;
+    c = g1 >> 26;
+    g1 &= NX_CRYPTO_POLY1305_MASK_26;
+    g2 = h2 + c;
+    c = g2 >> 26;
+    g2 &= NX_CRYPTO_POLY1305_MASK_26;
+    g3 = h3 + c;
+    c = g3 >> 26;
+    g3 &= NX_CRYPTO_POLY1305_MASK_26;
+    g4 = h4 + c - ((UINT)1 << 26);
+
+    /* Select h if h < p, or g otherwise, without branching. */
+    mask = (g4 >> 31) - 1;
+    g0 &= mask;
+    g1 &= mask;
+    g2 &= mask;
+    g3 &= mask;
+    g4 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+    h3 = (h3 & mask) | g3;
+    h4 = (h4 & mask) | g4;
+
+    /* h = h % 2^128 as four 32-bit words. */
+    h0 = (h0 | (h1 << 26));
+    h1 = ((h1 >> 6) | (h2 << 20));
+    h2 = ((h2 >> 12) | (h3 << 14));
+    h3 = ((h3 >> 18) | (h4 << 8));
+
+    /* tag = (h + pad) % 2^128 */
+    f = (ULONG64)h0 + poly1305 -> nx_crypto_poly1305_pad[0];
+    h0 = (UINT)f;
+    f = (ULONG64)h1 + poly1305 -> nx_crypto_poly1305_pad[1] + (f >> 32);
+    h1 = (UINT)f;
+    f = (ULONG64)h2 + poly1305 -> nx_crypto_poly1305_pad[2] + (f >> 32);
+    h2 = (UINT)f;
+    f = (ULONG64)h3 + poly1305 -> nx_crypto_poly1305_pad[3] + (f >> 32);
+    h3 = (UINT)f;
+
+    NX_CRYPTO_CHACHA20_STORE32(tag, h0);
+    NX_CRYPTO_CHACHA20_STORE32(tag + 4, h1);
+    NX_CRYPTO_CHACHA20_STORE32(tag + 8, h2);
+    NX_CRYPTO_CHACHA20_STORE32(tag + 12, h3);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_key_set                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function loads the constants and the 256-bit key into the      */
+/*    ChaCha20 input block.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    key                                   32-byte key                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_init                            */
+/*                                          Init ChaCha20-Poly1305 method */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_key_set(NX_CRYPTO_CHACHA20_POLY1305 *ctx, UCHAR *key)
+{
+UINT i;
+
+    /* "expand 32-byte k" */
+    ctx -> nx_crypto_chacha20_state[0] = 0x61707865;
+    ctx -> nx_crypto_chacha20_state[1] = 0x3320646E;
+    ctx -> nx_crypto_chacha20_state[2] = 0x79622D32;
+    ctx -> nx_crypto_chacha20_state[3] = 0x6B206574;
+
+    for (i = 0; i < 8; i++)
+    {
+        ctx -> nx_crypto_chacha20_state[4 + i] = NX_CRYPTO_CHACHA20_LOAD32(key + (i << 2));
+    }
+
+    /* Counter and nonce are set per message. */
+    ctx -> nx_crypto_chacha20_state[12] = 0;
+    ctx -> nx_crypto_chacha20_state[13] = 0;
+    ctx -> nx_crypto_chacha20_state[14] = 0;
+    ctx -> nx_crypto_chacha20_state[15] = 0;
+    ctx -> nx_crypto_chacha20_keystream_offset = NX_CRYPTO_CHACHA20_KEYSTREAM_SIZE;
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_init                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function starts a ChaCha20-Poly1305 message. The first pass of */
+/*    the core yields the Poly1305 key from block 0 and the keystream of  */
+/*    the following blocks, so no block is computed twice. The additional */
+/*    data is then authenticated.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    nonce                                 12-byte nonce                 */
+/*    additional_data                       Additional data               */
+/*    additional_len                        Length of additional data     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_blocks            Compute ChaCha20 blocks       */
+/*    _nx_crypto_poly1305_key_set           Set Poly1305 key              */
+/*    _nx_crypto_poly1305_update            Update Poly1305               */
+/*    _nx_crypto_poly1305_pad               Pad Poly1305 input            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_init(NX_CRYPTO_CHACHA20_POLY1305 *ctx, UCHAR *nonce,
+                                                      UCHAR *additional_data, UINT additional_len)
+{
+
+    if ((additional_len > 0) && (additional_data == NX_CRYPTO_NULL))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    ctx -> nx_crypto_chacha20_state[12] = 0;
+    ctx -> nx_crypto_chacha20_state[13] = NX_CRYPTO_CHACHA20_LOAD32(nonce);
+    ctx -> nx_crypto_chacha20_state[14] = NX_CRYPTO_CHACHA20_LOAD32(nonce + 4);
+    ctx -> nx_crypto_chacha20_state[15] = NX_CRYPTO_CHACHA20_LOAD32(nonce + 8);
+
+    /* Block 0 is the one-time Poly1305 key, encryption starts at block 1. */
+    _nx_crypto_chacha20_blocks(ctx -> nx_crypto_chacha20_state, ctx -> nx_crypto_chacha20_keystream);
+    _nx_crypto_poly1305_key_set(&ctx -> nx_crypto_chacha20_poly1305_mac, ctx -> nx_crypto_chacha20_keystream);
+    NX_CRYPTO_MEMSET(ctx -> nx_crypto_chacha20_keystream, 0, NX_CRYPTO_CHACHA20_BLOCK_SIZE);
+    ctx -> nx_crypto_chacha20_keystream_offset = NX_CRYPTO_CHACHA20_BLOCK_SIZE;
+
+    ctx -> nx_crypto_chacha20_poly1305_aad_length = additional_len;
+    ctx -> nx_crypto_chacha20_poly1305_text_length = 0;
+
+    if (additional_len > 0)
+    {
+        _nx_crypto_poly1305_update(&ctx -> nx_crypto_chacha20_poly1305_mac, additional_data, additional_len);
+        _nx_crypto_poly1305_pad(&ctx -> nx_crypto_chacha20_poly1305_mac);
+    }
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_encrypt_update         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts data of any length and authenticates the     */
+/*    ciphertext. Each chunk of keystream is applied and then absorbed    */
+/*    into Poly1305 while the data is still in cache. Input and output    */
+/*    may be the same buffer.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    input                                 Plaintext                     */
+/*    output                                Ciphertext                    */
+/*    length                                Length of data                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_blocks            Compute ChaCha20 blocks       */
+/*    _nx_crypto_poly1305_update            Update Poly1305               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_encrypt_update(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                                UCHAR *input, UCHAR *output, UINT length)
+{
+UINT   offset = ctx -> nx_crypto_chacha20_keystream_offset;
+UINT   chunk;
+UINT   i;
+UCHAR *keystream;
+
+    ctx -> nx_crypto_chacha20_poly1305_text_length += length;
+
+    while (length > 0)
+    {
+        if (offset == NX_CRYPTO_CHACHA20_KEYSTREAM_SIZE)
+        {
+            _nx_crypto_chacha20_blocks(ctx -> nx_crypto_chacha20_state, ctx -> nx_crypto_chacha20_keystream);
+            offset = 0;
+        }
+
+        chunk = NX_CRYPTO_CHACHA20_KEYSTREAM_SIZE - offset;
+        if (chunk > length)
+        {
+            chunk = length;
+        }
+
+        keystream = &ctx -> nx_crypto_chacha20_keystream[offset];
+        for (i = 0; i < chunk; i++)
+        {
+            output[i] = (UCHAR)(input[i] ^ keystream[i]);
+        }
+
+        _nx_crypto_poly1305_update(&ctx -> nx_crypto_chacha20_poly1305_mac, output, chunk);
+
+        offset += chunk;
+        input += chunk;
+        output += chunk;
+        length -= chunk;
+    }
+
+    ctx -> nx_crypto_chacha20_keystream_offset = offset;
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_decrypt_update         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function authenticates and decrypts data of any length. Each   */
+/*    chunk of ciphertext is absorbed into Poly1305 before it is          */
+/*    decrypted, so input and output may be the same buffer.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    input                                 Ciphertext                    */
+/*    output                                Plaintext                     */
+/*    length                                Length of data                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_blocks            Compute ChaCha20 blocks       */
+/*    _nx_crypto_poly1305_update            Update Poly1305               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_decrypt_update(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                                UCHAR *input, UCHAR *output, UINT length)
+{
+UINT   offset = ctx -> nx_crypto_chacha20_keystream_offset;
+UINT   chunk;
+UINT   i;
+UCHAR *keystream;
+
+    ctx -> nx_crypto_chacha20_poly1305_text_length += length;
+
+    while (length > 0)
+    {
+        if (offset == NX_CRYPTO_CHACHA20_KEYSTREAM_SIZE)
+        {
+            _nx_crypto_chacha20_blocks(ctx -> nx_crypto_chacha20_state, ctx -> nx_crypto_chacha20_keystream);
+            offset = 0;
+        }
+
+        chunk = NX_CRYPTO_CHACHA20_KEYSTREAM_SIZE - offset;
+        if (chunk > length)
+        {
+            chunk = length;
+        }
+
+        _nx_crypto_poly1305_update(&ctx -> nx_crypto_chacha20_poly1305_mac, input, chunk);
+
+        keystream = &ctx -> nx_crypto_chacha20_keystream[offset];
+        for (i = 0; i < chunk; i++)
+        {
+            output[i] = (UCHAR)(input[i] ^ keystream[i]);
+        }
+
+        offset += chunk;
+        input += chunk;
+        output += chunk;
+        length -= chunk;
+    }
+
+    ctx -> nx_crypto_chacha20_keystream_offset = offset;
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_tag                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function pads the ciphertext, absorbs the lengths of the       */
+/*    additional data and the ciphertext and computes the tag.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    tag                                   Output 16-byte tag            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_poly1305_pad               Pad Poly1305 input            */
+/*    _nx_crypto_poly1305_blocks            Absorb Poly1305 blocks        */
+/*    _nx_crypto_poly1305_finish            Compute Poly1305 tag          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_encrypt_calculate                      */
+/*                                          Calculate authentication tag  */
+/*    _nx_crypto_chacha20_poly1305_decrypt_calculate                      */
+/*                                          Verify authentication tag     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_chacha20_poly1305_tag(NX_CRYPTO_CHACHA20_POLY1305 *ctx, UCHAR *tag)
+{
+UCHAR lengths[NX_CRYPTO_POLY1305_BLOCK_SIZE];
+ULONG length;
+
+    _nx_crypto_poly1305_pad(&ctx -> nx_crypto_chacha20_poly1305_mac);
+
+    /* Little endian 64-bit lengths of the additional data and the ciphertext. */
+    NX_CRYPTO_MEMSET(lengths, 0, sizeof(lengths));
+    length = ctx -> nx_crypto_chacha20_poly1305_aad_length;
+    NX_CRYPTO_CHACHA20_STORE32(lengths, length);
+    length = ctx -> nx_crypto_chacha20_poly1305_text_length;
+    NX_CRYPTO_CHACHA20_STORE32(lengths + 8, length);
+    _nx_crypto_poly1305_blocks(&ctx -> nx_crypto_chacha20_poly1305_mac, lengths,
+                               NX_CRYPTO_POLY1305_BLOCK_SIZE, 1 << 24);
+
+    _nx_crypto_poly1305_finish(&ctx -> nx_crypto_chacha20_poly1305_mac, tag);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_encrypt_calculate      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function calculates the authentication tag of the message.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    output                                Output authentication tag     */
+/*    icv_len                               Length of the tag             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_tag      Compute AEAD tag              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_encrypt_calculate(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                                   UCHAR *output, UINT icv_len)
+{
+UCHAR tag[NX_CRYPTO_POLY1305_TAG_SIZE];
+
+    if (icv_len > NX_CRYPTO_POLY1305_TAG_SIZE)
+    {
+        return(NX_CRYPTO_INVALID_PARAMETER);
+    }
+
+    _nx_crypto_chacha20_poly1305_tag(ctx, tag);
+    NX_CRYPTO_MEMCPY(output, tag, icv_len); /* Use case of memcpy is verified. */
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(tag, 0, sizeof(tag));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_decrypt_calculate      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function verifies the authentication tag of the message. The   */
+/*    comparison does not depend on the position of the first mismatch.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    input                                 Received authentication tag   */
+/*    icv_len                               Length of the tag             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_tag      Compute AEAD tag              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_decrypt_calculate(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                                   UCHAR *input, UINT icv_len)
+{
+UCHAR tag[NX_CRYPTO_POLY1305_TAG_SIZE];
+UCHAR diff = 0;
+UINT  i;
+
+    if (icv_len > NX_CRYPTO_POLY1305_TAG_SIZE)
+    {
+        return(NX_CRYPTO_INVALID_PARAMETER);
+    }
+
+    _nx_crypto_chacha20_poly1305_tag(ctx, tag);
+
+    for (i = 0; i < icv_len; i++)
+    {
+        diff |= (UCHAR)(input[i] ^ tag[i]);
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(tag, 0, sizeof(tag));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    if (diff != 0)
+    {
+
+        /* Authentication failed. */
+        return(NX_CRYPTO_AUTHENTICATION_FAILED);
+    }
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_init            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the ChaCha20-Poly1305 crypto module.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    method                                Crypto Method Object          */
+/*    key                                   Key                           */
+/*    key_size_in_bits                      Size of the key, in bits      */
+/*    handle                                Handle, specified by user     */
+/*    crypto_metadata                       Metadata area                 */
+/*    crypto_metadata_size                  Size of the metadata area     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*    _nx_crypto_chacha20_poly1305_key_set  Set the key                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT  _nx_crypto_method_chacha20_poly1305_init(struct NX_CRYPTO_METHOD_STRUCT *method,
+                                                              UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                              VOID **handle,
+                                                              VOID *crypto_metadata,
+                                                              ULONG crypto_metadata_size)
+{
+
+    NX_CRYPTO_PARAMETER_NOT_USED(handle);
+
+    NX_CRYPTO_STATE_CHECK
+
+    if ((method == NX_CRYPTO_NULL) || (key == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    /* Verify the metadata addrsss is 4-byte aligned. */
+    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if(crypto_metadata_size < sizeof(NX_CRYPTO_CHACHA20_POLY1305))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if (key_size_in_bits != NX_CRYPTO_CHACHA20_KEY_LEN_IN_BITS)
+    {
+        return(NX_CRYPTO_UNSUPPORTED_KEY_SIZE);
+    }
+
+    NX_CRYPTO_MEMSET(crypto_metadata, 0, sizeof(NX_CRYPTO_CHACHA20_POLY1305));
+
+    return(_nx_crypto_chacha20_poly1305_key_set((NX_CRYPTO_CHACHA20_POLY1305 *)crypto_metadata, key));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_cleanup         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function cleans up the crypto metadata.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    crypto_metadata                       Crypto metadata               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT  _nx_crypto_method_chacha20_poly1305_cleanup(VOID *crypto_metadata)
+{
+
+    NX_CRYPTO_STATE_CHECK
+
+#ifdef NX_SECURE_KEY_CLEAR
+    if (!crypto_metadata)
+        return (NX_CRYPTO_SUCCESS);
+
+    /* Clean up the crypto metadata.  */
+    NX_CRYPTO_MEMSET(crypto_metadata, 0, sizeof(NX_CRYPTO_CHACHA20_POLY1305));
+#else
+    NX_CRYPTO_PARAMETER_NOT_USED(crypto_metadata);
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts and decrypts a message using                 */
+/*    the ChaCha20-Poly1305 algorithm.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    op                                    Crypto operation              */
+/*    handle                                Crypto handle                 */
+/*    method                                Cryption Method Object        */
+/*    key                                   Encryption Key                */
+/*    key_size_in_bits                      Key size in bits              */
+/*    input                                 Input data                    */
+/*    input_length_in_byte                  Input data size               */
+/*    iv_ptr                                Nonce length (1 byte) + nonce */
+/*    output                                Output buffer                 */
+/*    output_length_in_byte                 Output buffer size            */
+/*    crypto_metadata                       Metadata area                 */
+/*    crypto_metadata_size                  Metadata area size            */
+/*    packet_ptr                            Pointer to packet             */
+/*    nx_crypto_hw_process_callback         Callback function pointer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_init     Initialize ChaCha20-Poly1305  */
+/*    _nx_crypto_chacha20_poly1305_encrypt_update                         */
+/*                                          Encrypt data                  */
+/*    _nx_crypto_chacha20_poly1305_decrypt_update                         */
+/*                                          Decrypt data                  */
+/*    _nx_crypto_chacha20_poly1305_encrypt_calculate                      */
+/*                                          Calculate authentication tag  */
+/*    _nx_crypto_chacha20_poly1305_decrypt_calculate                      */
+/*                                          Verify authentication tag     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT  _nx_crypto_method_chacha20_poly1305_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
+                                                                   VOID *handle, /* Crypto handler */
+                                                                   struct NX_CRYPTO_METHOD_STRUCT *method,
+                                                                   UCHAR *key,
+                                                                   NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                                   UCHAR *input,
+                                                                   ULONG input_length_in_byte,
+                                                                   UCHAR *iv_ptr,
+                                                                   UCHAR *output,
+                                                                   ULONG output_length_in_byte,
+                                                                   VOID *crypto_metadata,
+                                                                   ULONG crypto_metadata_size,
+                                                                   VOID *packet_ptr,
+                                                                   VOID (*nx_crypto_hw_process_callback)(VOID *packet_ptr, UINT status))
+{
+
+NX_CRYPTO_CHACHA20_POLY1305 *ctx;
+UINT                         icv_len;
+UINT                         message_len;
+UINT                         status;
+
+    NX_CRYPTO_PARAMETER_NOT_USED(handle);
+    NX_CRYPTO_PARAMETER_NOT_USED(key);
+    NX_CRYPTO_PARAMETER_NOT_USED(key_size_in_bits);
+    NX_CRYPTO_PARAMETER_NOT_USED(packet_ptr);
+    NX_CRYPTO_PARAMETER_NOT_USED(nx_crypto_hw_process_callback);
+
+    NX_CRYPTO_STATE_CHECK
+
+    /* Verify the metadata addrsss is 4-byte aligned. */
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if(crypto_metadata_size < sizeof(NX_CRYPTO_CHACHA20_POLY1305))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    ctx = (NX_CRYPTO_CHACHA20_POLY1305 *)crypto_metadata;
+
+    if (method -> nx_crypto_algorithm != NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305)
+    {
+        return(NX_CRYPTO_INVALID_ALGORITHM);
+    }
+
+    /* The nonce is passed as its length (1 byte) followed by the nonce. */
+    if ((iv_ptr != NX_CRYPTO_NULL) && (iv_ptr[0] != NX_CRYPTO_CHACHA20_NONCE_SIZE))
+    {
+        return(NX_CRYPTO_INVALID_PARAMETER);
+    }
+
+    icv_len = (method -> nx_crypto_ICV_size_in_bits >> 3);
+
+    switch (op)
+    {
+        case NX_CRYPTO_DECRYPT:
+        {
+            if (iv_ptr == NX_CRYPTO_NULL)
+            {
+                status = NX_CRYPTO_PTR_ERROR;
+                break;
+            }
+
+            if (input_length_in_byte < icv_len || output_length_in_byte < input_length_in_byte - icv_len)
+            {
+                status = NX_CRYPTO_INVALID_BUFFER_SIZE;
+                break;
+            }
+
+            message_len = input_length_in_byte - icv_len;
+            status = _nx_crypto_chacha20_poly1305_init(ctx, iv_ptr + 1,
+                                                       ctx -> nx_crypto_chacha20_poly1305_additional_data,
+                                                       ctx -> nx_crypto_chacha20_poly1305_additional_data_len);
+
+            if (status)
+            {
+                break;
+            }
+
+            _nx_crypto_chacha20_poly1305_decrypt_update(ctx, input, output, message_len);
+
+            status = _nx_crypto_chacha20_poly1305_decrypt_calculate(ctx, input + message_len, icv_len);
+        } break;
+
+        case NX_CRYPTO_ENCRYPT:
+        {
+            if (iv_ptr == NX_CRYPTO_NULL)
+            {
+                status = NX_CRYPTO_PTR_ERROR;
+                break;
+            }
+
+            if (output_length_in_byte < input_length_in_byte + icv_len)
+            {
+                status = NX_CRYPTO_INVALID_BUFFER_SIZE;
+                break;
+            }
+
+            status = _nx_crypto_chacha20_poly1305_init(ctx, iv_ptr + 1,
+                                                       ctx -> nx_crypto_chacha20_poly1305_additional_data,
+                                                       ctx -> nx_crypto_chacha20_poly1305_additional_data_len);
+
+            if (status)
+            {
+                break;
+            }
+
+            _nx_crypto_chacha20_poly1305_encrypt_update(ctx, input, output, input_length_in_byte);
+
+            status = _nx_crypto_chacha20_poly1305_encrypt_calculate(ctx, output + input_length_in_byte, icv_len);
+        } break;
+
+        case NX_CRYPTO_DECRYPT_INITIALIZE:
+        /* fallthrough */
+        case NX_CRYPTO_ENCRYPT_INITIALIZE:
+        {
+            if (iv_ptr == NX_CRYPTO_NULL)
+            {
+                status = NX_CRYPTO_PTR_ERROR;
+                break;
+            }
+
+            status = _nx_crypto_chacha20_poly1305_init(ctx, iv_ptr + 1,
+                                                       input, /* pointers to AAD */
+                                                       input_length_in_byte /* length of AAD */);
+        } break;
+
+        case NX_CRYPTO_DECRYPT_UPDATE:
+        {
+            status = _nx_crypto_chacha20_poly1305_decrypt_update(ctx, input, output, input_length_in_byte);
+        } break;
+
+        case NX_CRYPTO_ENCRYPT_UPDATE:
+        {
+            status = _nx_crypto_chacha20_poly1305_encrypt_update(ctx, input, output, input_length_in_byte);
+        } break;
+
+        case NX_CRYPTO_DECRYPT_CALCULATE:
+        {
+            if (input_length_in_byte < icv_len)
+            {
+                status = NX_CRYPTO_INVALID_BUFFER_SIZE;
+                break;
+            }
+
+            status = _nx_crypto_chacha20_poly1305_decrypt_calculate(ctx, input, icv_len);
+        } break;
+
+        case NX_CRYPTO_ENCRYPT_CALCULATE:
+        {
+            if (output_length_in_byte < icv_len)
+            {
+                status = NX_CRYPTO_INVALID_BUFFER_SIZE;
+                break;
+            }
+
+            status = _nx_crypto_chacha20_poly1305_encrypt_calculate(ctx, output, icv_len);
+        } break;
+
+        case NX_CRYPTO_SET_ADDITIONAL_DATA:
+        {
+
+            /* Set additonal data pointer.  */
+            ctx -> nx_crypto_chacha20_poly1305_additional_data = (VOID *)input;
+
+            /* Set additional data length.  */
+            ctx -> nx_crypto_chacha20_poly1305_additional_data_len = input_length_in_byte;
+
+            status = NX_CRYPTO_SUCCESS;
+        } break;
+
+        default:
+        {
+            status = NX_CRYPTO_INVALID_ALGORITHM;
+        } break;
+    }
+
+    return(status);
+}
@@ -156,7 +156,7 @@ USHORT result;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_ctr_encrypt                              PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -164,7 +164,8 @@ USHORT result;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function performs CTR mode encryption, only support block of   */
-/*    16 bytes.                                                           */
+/*    16 bytes. Up to NX_CRYPTO_PARALLEL_BLOCKS counter blocks are        */
+/*    encrypted in each call to the crypto function.                      */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -205,6 +206,9 @@ USHORT result;
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            multi-block encryption,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_ctr_encrypt(VOID *crypto_metadata, NX_CRYPTO_CTR *ctr_metadata,
@@ -212,8 +216,8 @@ NX_CRYPTO_KEEP UINT _nx_crypto_ctr_encrypt(VOID *crypto_metadata, NX_CRYPTO_CTR
                                            UCHAR *input, UCHAR *output, UINT length, UINT block_size)
 {
 UCHAR  *control_block = ctr_metadata -> nx_crypto_ctr_counter_block;
-UCHAR  aes_output[NX_CRYPTO_CTR_BLOCK_SIZE];
-UINT   i;
+UCHAR  aes_output[NX_CRYPTO_CTR_BLOCK_SIZE * NX_CRYPTO_PARALLEL_BLOCKS];
+UINT   i, j, n;
 
     /* Check the block size.  */
     if (block_size != NX_CRYPTO_CTR_BLOCK_SIZE)
@@ -221,23 +225,39 @@ UINT   i;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
-    for (i = 0; i < length; i += block_size)
+    for (i = 0; i < length; i += n)
     {
-        if (length - i < block_size)
+
+        /* Encrypt up to NX_CRYPTO_PARALLEL_BLOCKS counter blocks in one call. */
+        n = length - i;
+        if (n > sizeof(aes_output))
         {
-            break;
+            n = sizeof(aes_output);
         }
-        crypto_function(crypto_metadata, control_block, aes_output, block_size);
-        _nx_crypto_ctr_xor(&input[i], aes_output, &output[i]);
-        _nx_crypto_ctr_add_one(control_block);
-    }
 
-    /* If the input is not an even multiple of 16 bytes, we need to truncate and xor the remainder. */
-    if (length - i != 0)
-    {
-        crypto_function(crypto_metadata, control_block, aes_output, block_size);
-        _nx_crypto_ctr_xor(&input[i], aes_output, aes_output);
-        NX_CRYPTO_MEMCPY(&output[i], aes_output, length - i); /* Use case of memcpy is verified. */
+        for (j = 0; j < n; j += block_size)
+        {
+            NX_CRYPTO_MEMCPY(&aes_output[j], control_block, block_size); /* Use case of memcpy is verified. */
+
+            /* The counter is not increased after a partial block. */
+            if (n - j >= block_size)
+            {
+                _nx_crypto_ctr_add_one(control_block);
+            }
+        }
+        crypto_function(crypto_metadata, aes_output, aes_output, j);
+
+        for (j = 0; (n - j) >= block_size; j += block_size)
+        {
+            _nx_crypto_ctr_xor(&input[i + j], &aes_output[j], &output[i + j]);
+        }
+
+        /* If the input is not an even multiple of 16 bytes, we need to truncate and xor the remainder. */
+        if (n - j != 0)
+        {
+            _nx_crypto_ctr_xor(&input[i + j], &aes_output[j], &aes_output[j]);
+            NX_CRYPTO_MEMCPY(&output[i + j], &aes_output[j], n - j); /* Use case of memcpy is verified. */
+        }
     }
 
 #ifdef NX_SECURE_KEY_CLEAR
@@ -0,0 +1,3843 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Curve25519                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#include "nx_crypto_curve25519.h"
+
+/* Comb parameters for the base point: window width w, d = (256 + w - 1) / w, e = d / 2. */
+#define NX_CRYPTO_CURVE25519_COMB_WIDTH           5
+#define NX_CRYPTO_CURVE25519_COMB_D               52
+#define NX_CRYPTO_CURVE25519_COMB_E               26
+
+/* Number of bits in the signed sliding window representation of a scalar. */
+#define NX_CRYPTO_CURVE25519_SLIDE_BITS           256
+
+#ifdef NX_CRYPTO_CURVE25519_RADIX_51
+#define NX_CRYPTO_CURVE25519_MASK_51              0x7FFFFFFFFFFFFULL
+#define NX_CRYPTO_CURVE25519_MUL128(a, b)         ((NX_CRYPTO_CURVE25519_UINT128)(a) * (b))
+#endif /* NX_CRYPTO_CURVE25519_RADIX_51 */
+
+/* Define precomputed affine point (y + x, y - x, 2 * d * x * y). */
+typedef struct NX_CRYPTO_CURVE25519_PRECOMPUTED_STRUCT
+{
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_precomputed_ypx[NX_CRYPTO_CURVE25519_LIMBS];
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_precomputed_ymx[NX_CRYPTO_CURVE25519_LIMBS];
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_precomputed_xy2d[NX_CRYPTO_CURVE25519_LIMBS];
+} NX_CRYPTO_CURVE25519_PRECOMPUTED;
+
+/* Define cached projective point (Y + X, Y - X, Z, 2 * d * T). */
+typedef struct NX_CRYPTO_CURVE25519_CACHED_STRUCT
+{
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_cached_ypx[NX_CRYPTO_CURVE25519_LIMBS];
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_cached_ymx[NX_CRYPTO_CURVE25519_LIMBS];
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_cached_z[NX_CRYPTO_CURVE25519_LIMBS];
+    NX_CRYPTO_CURVE25519_LIMB nx_crypto_curve25519_cached_t2d[NX_CRYPTO_CURVE25519_LIMBS];
+} NX_CRYPTO_CURVE25519_CACHED;
+
+/* d = -121665 / 121666 */
+static NX_CRYPTO_CONST UINT _nx_crypto_curve25519_d[8] =
+{
+    0x135978A3, 0x75EB4DCA, 0x4141D8AB, 0x00700A4D,
+    0x7779E898, 0x8CC74079, 0x2B6FFE73, 0x52036CEE
+};
+
+/* 2 * d */
+static NX_CRYPTO_CONST UINT _nx_crypto_curve25519_d2[8] =
+{
+    0x26B2F159, 0xEBD69B94, 0x8283B156, 0x00E0149A,
+    0xEEF3D130, 0x198E80F2, 0x56DFFCE7, 0x2406D9DC
+};
+
+/* sqrt(-1) = 2^((p - 1) / 4) */
+static NX_CRYPTO_CONST UINT _nx_crypto_curve25519_sqrtm1[8] =
+{
+    0x4A0EA0B0, 0xC4EE1B27, 0xAD2FE478, 0x2F431806,
+    0x3DFBD7A7, 0x2B4D0099, 0x4FC1DF0B, 0x2B832480
+};
+
+/* Precomputed affine points (y + x, y - x, 2 * d * x * y) as little endian words.
+   Entry k - 1 of the comb table is the sum of 2^(52 * j) * B for every bit j set in k,
+   entry k - 1 of the 2e table is that point multiplied by 2^26. */
+static NX_CRYPTO_CONST UINT _nx_crypto_curve25519_comb[][24] =
+{
+
+    /* Entry 1 */
+    {
+        0xF58C3B85, 0x2FBC93C6, 0xFB8C0E19, 0xCF932DC6,
+        0x643D42C2, 0x270B4898, 0x33D4BA65, 0x07CF9D3A,
+        0xD740913E, 0x9D103905, 0xD140BEB3, 0xFD399F05,
+        0x688F8A09, 0xA5C18434, 0x98F81267, 0x44FD2F92,
+        0x877AAA68, 0xABC91205, 0xCCAAC49E, 0x26D9E823,
+        0xDD43598C, 0x5A1B7DCB, 0x9F0C65A8, 0x6F117B68
+    },
+
+    /* Entry 2 */
+    {
+        0x95115389, 0x315C29C7, 0x862F74CE, 0xD7E0E507,
+        0x85927432, 0x0C4A7621, 0x4A25A1E4, 0x72DE6C98,
+        0x4D077C41, 0xE2790AAE, 0xDB7469A3, 0x8B938270,
+        0x8ABD16A2, 0x6EB632DC, 0xAA064B72, 0x720814EC,
+        0xBF6AA310, 0xAE9AB553, 0x806D6E1B, 0x050A50A9,
+        0xADFF5139, 0x92BB7403, 0x45BE618B, 0x0394D276
+    },
+
+    /* Entry 3 */
+    {
+        0xBA59D6A0, 0xD8945D41, 0x63DA5EA0, 0x7472C460,
+        0xF9BD6E19, 0x6489396D, 0x9663A514, 0x24B9A142,
+        0xACBE1424, 0x98AD53BD, 0x80992FC9, 0xC8EB40A1,
+        0xDB9B010F, 0x4934ADBF, 0x4B28F70D, 0x3827650F,
+        0xAE1B3002, 0x137D70DF, 0x7E975231, 0xFC267B68,
+        0x7A988622, 0x72565EA9, 0xD784B6A8, 0x467327D0
+    },
+
+    /* Entry 4 */
+    {
+        0xDCC5CAED, 0xE1014434, 0x3C84FB33, 0x47ED5D96,
+        0xED86A0E7, 0x70019576, 0xD267F9E4, 0x25B2697B,
+        0xD91A78BC, 0x9062B2E0, 0xC8509667, 0x47C9889C,
+        0x405070B8, 0x9DF54A66, 0x2493A1BF, 0x7369E6A9,
+        0x13986864, 0x9D673FFB, 0x415DC7B8, 0x3CA5FBD9,
+        0xDF273B5E, 0xE04ECC3B, 0xB54E4CD2, 0x1420683D
+    },
+
+    /* Entry 5 */
+    {
+        0xD1007C4F, 0xF356AC29, 0xEBF8D689, 0xB32E2399,
+        0x6CE703D4, 0x3FB210D7, 0x3F61003F, 0x18909F9B,
+        0x4C31AEC6, 0xD80C4443, 0x7F53435D, 0xABCFDB17,
+        0xF1098753, 0x4BF5DB0B, 0x3FAB4E93, 0x3A447FD7,
+        0x4D6A7532, 0x0F65E7C0, 0x5269E575, 0x84F06C1C,
+        0xF96D1865, 0xB5093D43, 0x5CB00A7B, 0x1B996862
+    },
+
+    /* Entry 6 */
+    {
+        0xFAE1D1AC, 0x9F433BBD, 0x55206259, 0x93C4C415,
+        0x3351BDBC, 0xA5CF4929, 0xE8914760, 0x34B863B0,
+        0x9C1F3FA8, 0xAD2BD443, 0x4FB2D9BC, 0xE4D8189A,
+        0xA47635C0, 0x146F07A0, 0xA65D2938, 0x7418884E,
+        0xC0A74882, 0xDBA11B58, 0xE98050CB, 0xBC5F4D68,
+        0xF2A31C8D, 0xD2E83DE5, 0x192DD9B1, 0x3165D7B9
+    },
+
+    /* Entry 7 */
+    {
+        0xA589E99C, 0x859E3830, 0x49297063, 0x977D4F4C,
+        0x46170807, 0x03971186, 0xF74A6DE8, 0x34A5746A,
+        0xA7E17C56, 0x322AB129, 0x4ACC1AB7, 0xC8AD009E,
+        0x8FBD98E9, 0x8801E7F9, 0x2A2CEED5, 0x432BB9EA,
+        0xD67B976B, 0x78168760, 0xF2A392E3, 0xE775FA08,
+        0xA163696E, 0x7D06DB1D, 0x69D2F0D2, 0x5B50E630
+    },
+
+    /* Entry 8 */
+    {
+        0x7C6DA1E9, 0x1EA43683, 0x1FB9BDBE, 0xF9C189AF,
+        0xCE5DD155, 0x303001FC, 0xBC57BE52, 0x28A7C99E,
+        0xD11E0D4A, 0x88BD438C, 0x43CCF308, 0x30CB610D,
+        0x91937BCC, 0xE09A0E37, 0x25B1720C, 0x4559135B,
+        0xE8D19E9D, 0xB8FD9399, 0x962423FF, 0x908191CB,
+        0x47C742A3, 0xB2B948D7, 0xD7FB44C4, 0x37F33226
+    },
+
+    /* Entry 9 */
+    {
+        0xF8B6DA0A, 0xB88E66BB, 0xEEAB6098, 0x1409C142,
+        0x0386C119, 0x5A61C4A6, 0x3D57D9FA, 0x09715065,
+        0xEEE78332, 0x6563A38E, 0xBD5D79FA, 0xDFED053F,
+        0x0F9C0452, 0xA32628CB, 0x72EDCE96, 0x2D9594A5,
+        0x42CBCF2E, 0xAAF57772, 0x3D71E0EB, 0x09C6E51A,
+        0x164DD135, 0x1C70C115, 0x97567E6A, 0x3B2CFFA3
+    },
+
+    /* Entry 10 */
+    {
+        0x82BA23FA, 0xB7BEEA3B, 0xADAE4B04, 0xA70503EC,
+        0xE92F68E4, 0xFCF0A243, 0x5C1CC97A, 0x5F1F0943,
+        0x5FB36447, 0x7B1C4B45, 0x8273A254, 0xE4770E07,
+        0x876AA86E, 0x4E432C59, 0x5009B5EF, 0x7E36EF5B,
+        0xC2B7ABA6, 0x9D1579E7, 0x438F6193, 0x2D8C7A61,
+        0xEB91E69D, 0xED8F6E61, 0x3544DF01, 0x48DED37D
+    },
+
+    /* Entry 11 */
+    {
+        0xF646CB54, 0x557D1E2A, 0x7012817D, 0xF4C9C704,
+        0xF5835BF8, 0x9776C0B2, 0x4F8485DD, 0x7C097EFE,
+        0x6CDB8A69, 0x4F7E15D8, 0xEDCDEE26, 0x9975F479,
+        0x5E9038CF, 0x6E822089, 0x8707C68F, 0x3FAE109F,
+        0x7A2347EC, 0xCCDABAFA, 0x53F7D9D3, 0x28372DC5,
+        0xA0786354, 0x68FD9242, 0x6BE61E39, 0x363BE457
+    },
+
+    /* Entry 12 */
+    {
+        0xCFAEFFD1, 0xB082A2AA, 0x17043AA0, 0xFAA12140,
+        0xE17B19B0, 0x3C5A3849, 0x86147AD3, 0x32E29B08,
+        0x842FF8A2, 0xA5D70616, 0x91196277, 0x5B03ED8C,
+        0x319E6824, 0xEF27BF84, 0xFAB7B490, 0x3473A540,
+        0xE3839FF2, 0x7C5C4F2E, 0x37E774AF, 0xD00B5E9B,
+        0xBC24D318, 0x6B14A304, 0x6E871F1E, 0x06DC1972
+    },
+
+    /* Entry 13 */
+    {
+        0x595B0266, 0x30CCB85F, 0x00C75418, 0x8C3153AC,
+        0x585497D5, 0x4612500D, 0x2CE69121, 0x063F4B06,
+        0xEF6E2C83, 0xB872999B, 0x6CEDD150, 0x084C316D,
+        0x9D5ABBFB, 0x2401B256, 0x7ACFE273, 0x3E4656CA,
+        0x5EF4B1C3, 0xB2523A9B, 0x1E8F1AF8, 0x76BC697A,
+        0xA6DA51A2, 0x37004746, 0xD9DFE2D2, 0x4672FD99
+    },
+
+    /* Entry 14 */
+    {
+        0x1A19A551, 0xE5258CB1, 0xFEC389EE, 0x67C8F9C3,
+        0x0386CD45, 0x25FA715F, 0xDD485B8D, 0x128F2F97,
+        0xCB1F5831, 0xD633D94F, 0x37E9D391, 0x9F69A04B,
+        0xBC652BC9, 0xED06202B, 0xF9DE37BF, 0x1B9703F0,
+        0xBEB74192, 0xAC54426E, 0x424C5C48, 0x240EEECA,
+        0xF8230AD6, 0xB44739FB, 0xCB2E07F5, 0x2DF8C909
+    },
+
+    /* Entry 15 */
+    {
+        0x833FA6CE, 0x2BF1E68D, 0x6D8133F9, 0x417A1F53,
+        0x28CB6590, 0x07298338, 0xF6578DA3, 0x3C4A1CEC,
+        0x23F46859, 0xAC3B00B3, 0xB00F538A, 0x5D3360AE,
+        0x7F4E8090, 0x2480C8E3, 0xF6CB6745, 0x3D8DB387,
+        0xE62FDEC1, 0xA4B18D6A, 0x15897684, 0x0255B966,
+        0x8EFCD427, 0xB657610D, 0xE3464C89, 0x4266059A
+    },
+
+    /* Entry 16 */
+    {
+        0x2796BB14, 0xF3AA57A2, 0x9B07DA21, 0x883ABAB7,
+        0x31A0391C, 0xE54BE218, 0xD83205F9, 0x5EE7FB38,
+        0xCE5EC54B, 0x9ADC0FF9, 0x8C2F130D, 0x039C2A6B,
+        0xF0F89515, 0x028007C7, 0xAC04B36B, 0x78968314,
+        0x41446A8E, 0x538DFDCB, 0x434937F9, 0xA5ACFDA9,
+        0x263C8C78, 0x46AF908D, 0x9BCA0D09, 0x61D0633C
+    },
+
+    /* Entry 17 */
+    {
+        0xFC540CE6, 0x5CE50D56, 0x3A802087, 0x9D79DBA7,
+        0x78A50BA6, 0x7B910CB2, 0x3BEF0175, 0x5DD2BF80,
+        0x6ACC271B, 0xF4442891, 0x7030272F, 0xB831243D,
+        0xB0344DD6, 0xD4446EA8, 0xB5ACBE14, 0x68B5CC38,
+        0x424B9274, 0x71374479, 0xD5B74E19, 0xFC23EA3F,
+        0x0CCE27D1, 0x3E34C2C4, 0x12046E5E, 0x1EF9D99E
+    },
+
+    /* Entry 18 */
+    {
+        0x15BC4BF3, 0xC8DE46B9, 0x61AEA902, 0x44599146,
+        0xDF07920B, 0x73875CA8, 0xC1BC1103, 0x3A7E2ACC,
+        0xEC2EBE0A, 0x9149B505, 0x16CEEF59, 0xC350A41A,
+        0xC11072C1, 0xF98DF73C, 0xA6DD62E8, 0x2CDC4E49,
+        0x213D7A88, 0x822C98CE, 0x8E878713, 0x88AAD019,
+        0xBAEEB707, 0xB43A10F2, 0x4EE073D6, 0x134E2C10
+    },
+
+    /* Entry 19 */
+    {
+        0x6C43CEAA, 0xC91D64DB, 0x29D2538C, 0x8DE16517,
+        0x33C659A9, 0x1CEB87E3, 0xAF2D5F15, 0x29976EDC,
+        0x42F8B93C, 0xAF659196, 0x53D6103E, 0x50652897,
+        0x6255C3F7, 0xE89B019B, 0x7AFAC797, 0x52E93F77,
+        0x6DEE27D2, 0x5304F512, 0x0C7AC9A7, 0x8AAF8957,
+        0x84A51F5E, 0xB8258225, 0x3188B6B0, 0x0A3FAFFF
+    },
+
+    /* Entry 20 */
+    {
+        0x715CF902, 0x54D5B050, 0x51A040DB, 0x877DD196,
+        0xABADFE13, 0x1A67CE3E, 0x8570212B, 0x071F951B,
+        0x7938815C, 0xA4C5E562, 0x792EDB94, 0x33DC636A,
+        0x87DF417E, 0x66830D08, 0x996DAFF3, 0x1B90C1D7,
+        0xAA6C7DC5, 0xADF05900, 0x7563F611, 0xE3F07D22,
+        0x184CE99E, 0x053ACACA, 0x89436C65, 0x6D1DCF3F
+    },
+
+    /* Entry 21 */
+    {
+        0xF8F1E485, 0x11CB0A0E, 0xCB71B065, 0xA1C02CB1,
+        0x388EFE5D, 0x8164AA7C, 0x370BD5D9, 0x5BF1DFB1,
+        0xAB4A0BD2, 0x62FC385F, 0x7EE85F04, 0xB8E14DAC,
+        0xF3F87D9A, 0x4A52C88B, 0x86B9DDB1, 0x10D5C52F,
+        0x69AFC59F, 0x099F1FE6, 0xAD55F695, 0xB2A99370,
+        0xA6BF7AFB, 0x6F5BF121, 0x24BDE4CE, 0x357C9BDD
+    },
+
+    /* Entry 22 */
+    {
+        0x67C8D9A3, 0x5DDC218B, 0xD3C48C0C, 0x5C14F38C,
+        0x2A192444, 0x00AAC12D, 0xB822509E, 0x5FBDB00B,
+        0x2329AFAD, 0x47A18EBE, 0xCB710058, 0x0D3C906D,
+        0xD8C99546, 0xA4E5E244, 0x715CA4AC, 0x35476B03,
+        0x08F96CBC, 0x0BC6043C, 0x1CF076AA, 0x2BD5595D,
+        0x51E6F999, 0x36CD8A25, 0xA5CD57BB, 0x7284C942
+    },
+
+    /* Entry 23 */
+    {
+        0x680E7E50, 0xD5A806DB, 0xD862A58C, 0x149A7660,
+        0x6D1764E7, 0x46AD1E9C, 0x7A900045, 0x210A2B9D,
+        0x60BC133C, 0x89ABBD75, 0x291915F9, 0xDB715B91,
+        0x98D9B176, 0x6EE9B7C7, 0xD9160F3F, 0x7D177E9D,
+        0x2BE6EADC, 0x454AF151, 0x8A70DFA1, 0xB9471813,
+        0xB6030ED4, 0x0B863227, 0xA66A9B3F, 0x36413EB6
+    },
+
+    /* Entry 24 */
+    {
+        0x34F65C15, 0x0E08FBE6, 0xE3286885, 0xA91FF27C,
+        0x7BB9E29C, 0x6B78A989, 0x20460622, 0x4772A0A9,
+        0xE7E272D4, 0x8465AF27, 0xB38E4B10, 0x0181FD15,
+        0x675D9857, 0x5B07E5D7, 0x251A9D58, 0x3DF04313,
+        0x22051E11, 0xB5D3D466, 0x214E379E, 0xECE2698D,
+        0x3216A205, 0x7818C488, 0xAF80DF4A, 0x50AA5DD9
+    },
+
+    /* Entry 25 */
+    {
+        0x04AE349F, 0xEBDD802C, 0xBC40B4E8, 0xB9125CE4,
+        0xFE7043CC, 0xD203C288, 0x20E6B5D5, 0x3CECD30B,
+        0x24244C11, 0xA1D9B22A, 0x0FB28BA4, 0xEB7F7F38,
+        0x8C5A1229, 0xC6460821, 0xCE1F5FDF, 0x51FF732F,
+        0x122A1231, 0x132F1DD8, 0x8278950C, 0x868406EE,
+        0x9C972853, 0x3EE81EDB, 0x58FF0231, 0x3665FBF9
+    },
+
+    /* Entry 26 */
+    {
+        0x6C37DCE2, 0x178C80E8, 0x0098C203, 0xE08B577F,
+        0xC3992F57, 0x9260E777, 0x88B807F3, 0x4E121117,
+        0x148994D9, 0x63FFC8BB, 0x7A9A3644, 0xD5902BA7,
+        0x5F59A042, 0xB65585CC, 0xA700D163, 0x16643F46,
+        0x4A28FCD6, 0x262CC4FE, 0x4DE3507D, 0xF654F2B1,
+        0x24111B4F, 0xC6483C5F, 0x8FE82E0B, 0x0C687F57
+    },
+
+    /* Entry 27 */
+    {
+        0x39E958A4, 0xA28D690B, 0x3B26F301, 0x64055EE2,
+        0xD0315383, 0xC9652A40, 0x61D2AD64, 0x00FAE518,
+        0xC343BBC4, 0xE73229E1, 0xDF0A56EF, 0x10C4D927,
+        0x6A89678D, 0x3E539ED1, 0x41363A36, 0x4566536C,
+        0xB750A2CE, 0x8F3449DA, 0xFBA29D3C, 0x05EA548B,
+        0x73C0CCE4, 0xDF7E68A2, 0xF58639D4, 0x44C53C1D
+    },
+
+    /* Entry 28 */
+    {
+        0xDFF1B444, 0x473FE5DE, 0x585FDD28, 0x9A5FB166,
+        0x65A57FDE, 0x11B61BFE, 0x91933A9F, 0x70A99C68,
+        0xCD202446, 0x093E5409, 0xDC993C91, 0xE659F142,
+        0xE9CD56BA, 0xF6BEC9C9, 0x72910CFC, 0x5BBB80A6,
+        0xC763C2F6, 0x2DE53C17, 0xF415AD81, 0x2B40DFDE,
+        0x5C16890D, 0xF641B4F9, 0xBF642F08, 0x323B3A95
+    },
+
+    /* Entry 29 */
+    {
+        0xFC6729B5, 0xFA812E31, 0x644F116F, 0xAE122094,
+        0x78DB1F18, 0x018FD648, 0xF0AE2871, 0x54C220F4,
+        0x9B1FE2C9, 0xC7D56D9D, 0x9B45CAFE, 0x8A945A53,
+        0xC1D04783, 0x5BE80A04, 0x866169C3, 0x52168FB1,
+        0x9799728D, 0xE5FF36E7, 0x96CD24EC, 0xD4018E18,
+        0x595A2094, 0xF0BF8C38, 0x565F66D0, 0x41833E0C
+    },
+
+    /* Entry 30 */
+    {
+        0xD94E8861, 0xB0E6E641, 0x539F33B2, 0x4D5EFB87,
+        0xE075D43A, 0x0DF82079, 0xF05DEDD4, 0x76811BED,
+        0x47F6DD36, 0x522ACC78, 0x1893C710, 0xAD741DA4,
+        0x8CC6226D, 0x79AABE9E, 0x4697465F, 0x6E070A04,
+        0x468F33F8, 0x72724CF4, 0x375FB21E, 0x065E25E7,
+        0x85239F7A, 0xE1294481, 0xA0F407BB, 0x563C36C5
+    },
+
+    /* Entry 31 */
+    {
+        0xE2BB6841, 0x5B3846BC, 0x862AC535, 0xCB566880,
+        0x83DB4C33, 0xA6102F52, 0x60AE54F6, 0x73A2D285,
+        0x571EDD2A, 0x88410377, 0x32DD471F, 0x0D42B3CC,
+        0x4D42168A, 0x42B8EAD6, 0xDF81C88E, 0x3FBDE3DB,
+        0x7E5FA2C6, 0xF737E125, 0xAAF1FD67, 0xC5CE2237,
+        0x659C11A0, 0x58D9AB23, 0x3EF02907, 0x357ACC77
+    }
+};
+
+static NX_CRYPTO_CONST UINT _nx_crypto_curve25519_comb_2e[][24] =
+{
+
+    /* Entry 1 */
+    {
+        0xA596CF14, 0xA02C431C, 0xAED3E400, 0xE3C42D40,
+        0x2E0F26DB, 0xD2452680, 0x9E457068, 0x201F3313,
+        0x6CDF1818, 0x58B31D8F, 0xC36258A2, 0x35CFA74F,
+        0x66E61D6E, 0xE1B3FF4F, 0x6CCDD5F7, 0x5067ACAB,
+        0x08039D51, 0xFD527F6B, 0x017C0006, 0x18B14964,
+        0x2E25A4A8, 0xD5220EB0, 0x62460375, 0x397CBA88
+    },
+
+    /* Entry 2 */
+    {
+        0xD71EB524, 0x95265514, 0x5DF14593, 0xE603D881,
+        0x0D4DE6B7, 0x147CDF41, 0x0437C850, 0x5293B173,
+        0x0354C13D, 0xF2A7AF51, 0xAA372B60, 0xD7A0B145,
+        0x05A3D470, 0x2869B96A, 0x82460173, 0x6528E42D,
+        0x4BCCF226, 0x23D0E081, 0x8196FB93, 0x92C745CD,
+        0x59541E5B, 0x8B61796C, 0xC021F978, 0x40A44DF0
+    },
+
+    /* Entry 3 */
+    {
+        0x263906F8, 0x3338F4D9, 0xECD2BE56, 0x5BC04BDC,
+        0x84A55B6B, 0x362D5303, 0x1B7A66AE, 0x7375DE88,
+        0x837C94BC, 0x86A9CDAB, 0x75C3D54B, 0x8E2F8E83,
+        0x23B58657, 0x61F728E6, 0x3FFC5A67, 0x0E005300,
+        0x48E031F4, 0x26079CCA, 0xF5D4488F, 0x5609DC16,
+        0x4D4A811C, 0x1E0EC410, 0xF9D67794, 0x51A7DC08
+    },
+
+    /* Entry 4 */
+    {
+        0x7CBEC113, 0x9D18F6D9, 0x74BFDBE4, 0x844A06E6,
+        0xAC4E60D6, 0x20F5B522, 0x50955E51, 0x720A5BC0,
+        0xE4616CED, 0xC3A8B0F8, 0x9E25A87D, 0xF700660E,
+        0xF4BCA59C, 0x61E3061F, 0xBDC40BE9, 0x2E0C92BF,
+        0x9B805A35, 0x0C3F0943, 0x6242ABFC, 0xE84E8B37,
+        0x5C229346, 0x691417F3, 0x144EF0EC, 0x0E9B9CBB
+    },
+
+    /* Entry 5 */
+    {
+        0x9AB85B10, 0xE9CAB145, 0x0B617326, 0x80D79F1C,
+        0x4B693561, 0x79BB98B0, 0xF08AC84B, 0x6DEFB86A,
+        0xB5FC4EAD, 0x20A791E8, 0x7666690D, 0xB36153E9,
+        0x0DCCE600, 0xF8377B6A, 0x17C9AD42, 0x50D32907,
+        0x4BD2DDE0, 0x0074B261, 0xA3CE6D01, 0x019277E2,
+        0x00E901E8, 0x606F5375, 0xEAAE3824, 0x4F651F48
+    },
+
+    /* Entry 6 */
+    {
+        0x030241B6, 0xF233FCE1, 0x4792D6F5, 0xBC989320,
+        0x67C7C23A, 0x72255BE7, 0x8E507393, 0x463303AE,
+        0xB194E99E, 0x9C171762, 0xB069D681, 0xD7ADBE2A,
+        0x448ED037, 0x298C701B, 0x25A35236, 0x236455B3,
+        0x1234E486, 0xF9E389CE, 0xF6409D4A, 0x3FB4B78E,
+        0x15480BA8, 0xA3F7F7CE, 0xC7A4D207, 0x2E423E7D
+    },
+
+    /* Entry 7 */
+    {
+        0x1DB99961, 0x57B9056F, 0x105C132C, 0xFC060147,
+        0xAB342C00, 0xCE0F8EA5, 0x3993C2F2, 0x4ECA8D6D,
+        0x5A27EE5A, 0x27FE62DD, 0x18EEC76F, 0xB46E8542,
+        0xBD2B1A10, 0x13217A9C, 0x51193C46, 0x192D57BD,
+        0x40F8E707, 0x4B46C8DF, 0xBC978E2E, 0x6710EC44,
+        0xFAFD1C7C, 0x258C2EBB, 0xD25BEF8B, 0x5B613A68
+    },
+
+    /* Entry 8 */
+    {
+        0x0817E7A6, 0xB5F16B63, 0x3C351026, 0x808C6923,
+        0x54CEF201, 0x324A983B, 0x4A485345, 0x53C09208,
+        0x12E0C9EF, 0x96324EDD, 0xF2420297, 0x468B878D,
+        0xA4F573BE, 0x199A3776, 0x8E91E92A, 0x1E7FBCF1,
+        0xF1CBAFBF, 0xD2D41481, 0x716174E5, 0x231D2DB6,
+        0xE2A55C98, 0x0B7D7656, 0x2AA495F6, 0x3E955CD8
+    },
+
+    /* Entry 9 */
+    {
+        0x7AC191DE, 0xE3B01A2B, 0x6C8770FD, 0x914ADF98,
+        0xC3E2CA76, 0x88EBAD70, 0x7B04A985, 0x43AFF0DE,
+        0x94FE5EC1, 0x2416CA90, 0x9E6C4589, 0x9CD986D4,
+        0x1E01A71B, 0x01E4EE73, 0x5FF2E78E, 0x2EAE1799,
+        0x27E13A4C, 0x3FA9148F, 0x47CE7DD5, 0x32384CB5,
+        0x82426E6F, 0xAFBC74B1, 0x0BDD5AF6, 0x66054872
+    },
+
+    /* Entry 10 */
+    {
+        0x9415EFDB, 0x7A0271F9, 0x8EEAF709, 0xBFC83D3A,
+        0xC619CEA8, 0x89EF45A1, 0x009EA26E, 0x078B45E5,
+        0x45A606A1, 0x19C03740, 0xBA923995, 0xE1D9BEC2,
+        0xB91416AC, 0xE0A17C3A, 0x9232534A, 0x187A8F28,
+        0x253CBDCB, 0x3BF2372E, 0x6678D033, 0xF36D3E2B,
+        0x0BD25E1A, 0x3CE9AB0B, 0x550767ED, 0x465C26AE
+    },
+
+    /* Entry 11 */
+    {
+        0x10D41405, 0x5E162AA1, 0xB2191C40, 0xEAEFEBAA,
+        0x8150E057, 0xF2A3C7A6, 0xAF3F3B1D, 0x1102D1A2,
+        0x1A3D2971, 0xE1F521B8, 0xA51EA51D, 0xB84B6A0A,
+        0x9F473F1D, 0x5AB943E4, 0x31180FA6, 0x2BB64E15,
+        0xFCC9E5CF, 0x0F891176, 0xF770104A, 0xBE8E5D88,
+        0x1AA268B8, 0xE08FE9DA, 0x47E8949F, 0x328A0484
+    },
+
+    /* Entry 12 */
+    {
+        0xC10CBADB, 0x3689F5C9, 0xAB06B583, 0xFE7DE071,
+        0xCD76EA04, 0xD60B011F, 0x39860DC1, 0x505C717C,
+        0x7134C2B2, 0x1DE7CA64, 0x03BDB53E, 0x62D116E9,
+        0x43C9EF4B, 0x25F76C5D, 0x6DB67D8F, 0x507076FE,
+        0x7AB7D643, 0x1649FC06, 0x74DB7926, 0xC57E834A,
+        0x6565F6C4, 0xE9BD145F, 0xB7888AE1, 0x1BFCF9E5
+    },
+
+    /* Entry 13 */
+    {
+        0xC0CF0847, 0x6D622FB2, 0x1540725B, 0x31049637,
+        0xE62AAC62, 0x395A211D, 0x928DF650, 0x14079BFF,
+        0xC1C4D1AA, 0x438604E1, 0xE98E2ACF, 0xAF15F9E1,
+        0xBEFC304C, 0x725DC13A, 0x6FC41FCB, 0x44B305FB,
+        0x03565CE7, 0x996ED1F2, 0xC5DF5E7F, 0x444AA138,
+        0x692E48CC, 0x426EC291, 0xDAE29672, 0x41A802CD
+    },
+
+    /* Entry 14 */
+    {
+        0x09294223, 0xDAE7EEEB, 0x6A4D845C, 0x5934D773,
+        0x003BCDB7, 0x621CC992, 0x72DBC2E9, 0x479F2089,
+        0x229287D4, 0xDCCF39C3, 0x4548FCAC, 0xD5208030,
+        0x417EFA6C, 0x0E606A8D, 0xC0AFE394, 0x5B1BCD99,
+        0xA074F302, 0xE368C39B, 0x6A5CD79A, 0x192F0A97,
+        0x632B949D, 0x6D7C7A16, 0x1D0AB0A3, 0x32A582CF
+    },
+
+    /* Entry 15 */
+    {
+        0x91AF4030, 0xA3CB50F4, 0xC03D58D0, 0x6C70185A,
+        0x4631991C, 0xA067D0FD, 0x6C080915, 0x3DCAA5FF,
+        0xFD9FA822, 0x2F0840C4, 0x0F86C705, 0x77286F3F,
+        0xA52EEC72, 0x38D52B56, 0x2A64AF22, 0x73867885,
+        0x23A4ED55, 0x33D55B40, 0x269FEEC4, 0x3B8B16BB,
+        0xFF36FACE, 0xF0386913, 0xAD988B0E, 0x700FA25B
+    },
+
+    /* Entry 16 */
+    {
+        0x89DDBBAD, 0xF1BEA8FB, 0x61AEAECB, 0x3BCB2CBC,
+        0x1F9B8D9D, 0x8F58A7BB, 0x5112A686, 0x21547EDA,
+        0x82C9F57C, 0xB294634D, 0x24934536, 0x1FCBFDE1,
+        0x418CDB5A, 0x9E9C4DB3, 0x454419FC, 0x0040F3D9,
+        0xFD5986D3, 0xDEFDE939, 0x510A380C, 0xF4272C89,
+        0xBB3119B9, 0xB72BA407, 0x4A254DF4, 0x63550A33
+    },
+
+    /* Entry 17 */
+    {
+        0x7AE3D73B, 0x8A80B885, 0xEDCAD4E8, 0xC2C1AEDC,
+        0xFADE25B1, 0x05F2B899, 0x0D094207, 0x28FB74A5,
+        0xE961757C, 0xA6A0788A, 0xC9200773, 0x2BF11C45,
+        0x40B58D16, 0x6577CB61, 0xC34849F0, 0x383DF9E1,
+        0x04007421, 0x26C0D723, 0x2E0391D5, 0xEEB54636,
+        0x69553F02, 0x68E60363, 0xB504EFC9, 0x1ED1EEE5
+    },
+
+    /* Entry 18 */
+    {
+        0x5B64B0C7, 0xDF9CDD09, 0x9691A0C6, 0xFDCB981C,
+        0x9B1DC1CE, 0xE423E1C9, 0x55E1584E, 0x26CD5082,
+        0xBD8DF109, 0x529EA865, 0x7895622A, 0x3CF73EB2,
+        0xD2B4EAB8, 0x51189530, 0x8F71ECAA, 0x38E259A5,
+        0xA456BE05, 0xD0CD86D3, 0x602CAC44, 0xBF52F935,
+        0x9201463C, 0x831B2FC5, 0x2D22EE5D, 0x3B1805A6
+    },
+
+    /* Entry 19 */
+    {
+        0x8436A62D, 0xB808BFAC, 0xB80B480A, 0x868DB30D,
+        0x85088BA5, 0x717BFE8E, 0x3670482B, 0x6A664A44,
+        0xF253FDDA, 0x9AE9B863, 0x9EB859A7, 0x4D5A44EF,
+        0x96CB4F3F, 0x292B7F17, 0x860AC44E, 0x40869FED,
+        0x35B1ED3D, 0x16819651, 0x773B6B4B, 0x379A3CBC,
+        0x7F28404E, 0xCADD64CF, 0x36EF082A, 0x24C9CDC2
+    },
+
+    /* Entry 20 */
+    {
+        0x796D9A68, 0xDC77191B, 0xC13A5355, 0x2861456E,
+        0xD0412216, 0xF10F9F11, 0x9DEC9754, 0x127518DD,
+        0x94A71595, 0x9AE48B8D, 0xC4BB9BFD, 0x73298778,
+        0xFC36C33F, 0x581AEBC8, 0xB466D852, 0x65694793,
+        0x5BFC0CA0, 0x57B156E4, 0x4A2D7442, 0xB75F22A4,
+        0xCD429094, 0x58161E55, 0xEE87EC6F, 0x2D173AFD
+    },
+
+    /* Entry 21 */
+    {
+        0x2ECD0AA6, 0xBFA98933, 0xC5700924, 0x9CAC1CF0,
+        0x19ACB708, 0x756C4359, 0x52E77FE8, 0x6DAD26B5,
+        0x3D3F7D64, 0x29F2476B, 0xAB8A42FF, 0x07C7D265,
+        0xA43AF3DA, 0x3C666550, 0x4792FEF6, 0x7723861D,
+        0xEB0AFC5F, 0x50597C20, 0x6A07CE73, 0x52BBCB83,
+        0x00F64C68, 0xA19130C6, 0xD7C76041, 0x5D35B1DA
+    },
+
+    /* Entry 22 */
+    {
+        0xE9DC484B, 0xF78F7DEA, 0x9EF95CC4, 0x15FDF925,
+        0xAEF0517F, 0x8690630F, 0xBF8AE3DF, 0x76E3C0C4,
+        0x056FD990, 0xE1ACC617, 0x3E7122A6, 0xF5A507B7,
+        0xD2563476, 0x0B4264C4, 0x4D22BA8D, 0x30B489C3,
+        0x254CFC2E, 0xF1B7D940, 0xA2844D00, 0xB6E5AC12,
+        0x16F002FE, 0xE72E7DD8, 0xEACD33CC, 0x2A22224C
+    },
+
+    /* Entry 23 */
+    {
+        0x6DC5C52F, 0xC6F26E67, 0x3DCFACA2, 0x681115AE,
+        0xF52FBA82, 0x13E4256A, 0xE63124F3, 0x4F4853F0,
+        0x69B41640, 0x4016E7D5, 0x04F4DAD1, 0x62EB95A6,
+        0xE6FCD8BA, 0x0787BD98, 0x32126CE7, 0x56215BA3,
+        0x01F71B2F, 0x3C362816, 0xB97B4562, 0x35848F53,
+        0xE4974AC8, 0x522A84D0, 0x17356353, 0x15B20028
+    },
+
+    /* Entry 24 */
+    {
+        0x5C40A2BB, 0xD38D8CF2, 0x360C19C0, 0x97C07A60,
+        0xC0B40AB7, 0x7DD02A79, 0xBEBF7E57, 0x0B9839FA,
+        0x181EEDD1, 0xDF5528DF, 0xF3A3CA98, 0x5A4A538C,
+        0x53711C5E, 0x13A612E4, 0x4B69D9A3, 0x76322321,
+        0xB6690AF4, 0x3F0EEC19, 0x1574A5E1, 0xE7D67264,
+        0xF83D5F41, 0x1EE575BE, 0xE3681A00, 0x4E374416
+    },
+
+    /* Entry 25 */
+    {
+        0x5952B6A7, 0xADD06D64, 0x7B2656F6, 0xBBC8E15C,
+        0x59E71415, 0x014F6D03, 0x4025C13A, 0x7F2A84BA,
+        0xE8A5ED80, 0x784C47E5, 0xF8B926F6, 0x1404BC9A,
+        0x3959429D, 0x92882732, 0xED4FE42B, 0x2674FD8F,
+        0xF4D09343, 0xDC6F6732, 0x7D155ADF, 0x23203F24,
+        0xAF33574D, 0xF7D61D2E, 0x24A04C00, 0x247B0D60
+    },
+
+    /* Entry 26 */
+    {
+        0xDCDA1ACD, 0x5D9C3680, 0x3ABF4633, 0x9DA11388,
+        0x9DBCD96E, 0xB631CF2E, 0x7312BDBA, 0x6EA12F1F,
+        0x75E4D3F1, 0xCE219DAA, 0xBA4BFAB6, 0x8E44B567,
+        0x018A3CB0, 0x6523C705, 0x933C64CF, 0x48DFB94F,
+        0x17AAEDF4, 0x878F3D26, 0xC9285B1E, 0x1A70B0FB,
+        0x23C95167, 0xBFE7C8E5, 0x40D20AC6, 0x0B4D9A90
+    },
+
+    /* Entry 27 */
+    {
+        0x4F21AE6B, 0xBAC4F69D, 0x6C8A864B, 0xFF86853A,
+        0x797158A1, 0x6A3B6A36, 0xEEA15599, 0x31882A5D,
+        0x3C5D7AEC, 0xEB88054D, 0x994C4D1B, 0xE58C3E70,
+        0x88658F43, 0x2B85455A, 0xC03BB22D, 0x04EBF10A,
+        0x3ECF2923, 0x64D4024F, 0x364D84DB, 0x854C5D67,
+        0x6CFD4376, 0x239CD3DD, 0x715CBEA7, 0x0A6ECC7C
+    },
+
+    /* Entry 28 */
+    {
+        0xB8B23726, 0xB1A64AF7, 0x8A024F80, 0x4430B815,
+        0xB7015E4E, 0x0A5169A4, 0xE33965CF, 0x73837E37,
+        0xB4B994ED, 0x8B002B5F, 0x40DE6D5A, 0x8C0C95AC,
+        0x6B733BDF, 0xBA310E78, 0x947C5F56, 0x7E505703,
+        0x3638FB0A, 0x8EEE1105, 0x6B1B8C54, 0xED8742FC,
+        0xFD8C388A, 0x7036334D, 0xC9C43E1A, 0x30F3EC94
+    },
+
+    /* Entry 29 */
+    {
+        0x40B3F359, 0x871A6DEE, 0x92601F58, 0x9EF82A62,
+        0xCFCCDB8A, 0x73B5290B, 0x56C08F82, 0x1C880CF7,
+        0xCB2DE18D, 0x12DEAA05, 0x2C4C9B8D, 0x0B931095,
+        0x25D4A68D, 0x3184CF52, 0x6AC59ABD, 0x011FE74E,
+        0x71367B16, 0xCA8E2251, 0x80B790CA, 0xC8F26821,
+        0x006B25AB, 0x52F26E63, 0x675B3362, 0x3410138C
+    },
+
+    /* Entry 30 */
+    {
+        0x140C878D, 0xAFA3038A, 0x1A61F276, 0x8E415145,
+        0xC55B2578, 0xD944E118, 0xFD4CFF27, 0x3AAC5083,
+        0x05D0679E, 0xD7AD8E17, 0x197C75CB, 0x2E1AAF25,
+        0xA39B4101, 0x5FFDAABD, 0x6915C795, 0x577CA8AB,
+        0x42CB0DC2, 0x12BC584D, 0x689A9E99, 0x4D0B1CB3,
+        0x601472C5, 0xA598A68A, 0xEA58A9F4, 0x6B7232DC
+    },
+
+    /* Entry 31 */
+    {
+        0xE67B61B3, 0x16F37398, 0xD9819622, 0xD0F34104,
+        0x13427802, 0xEC1C1110, 0xE2A355FF, 0x25BDEC7C,
+        0xE4B6CC5A, 0x36763B1F, 0x5EC0D090, 0xB2C389A3,
+        0xA6A8230E, 0x87E6E16A, 0x9C10539F, 0x4A715F9B,
+        0x894C1A4D, 0x5126FCD4, 0x46C652A2, 0xA9E38896,
+        0x5E34FF1F, 0x1993E3C9, 0xC3CF249E, 0x396E2C38
+    }
+};
+
+static NX_CRYPTO_CONST UINT _nx_crypto_curve25519_base_odd[][24] =
+{
+
+    /* 1 * B */
+    {
+        0xF58C3B85, 0x2FBC93C6, 0xFB8C0E19, 0xCF932DC6,
+        0x643D42C2, 0x270B4898, 0x33D4BA65, 0x07CF9D3A,
+        0xD740913E, 0x9D103905, 0xD140BEB3, 0xFD399F05,
+        0x688F8A09, 0xA5C18434, 0x98F81267, 0x44FD2F92,
+        0x877AAA68, 0xABC91205, 0xCCAAC49E, 0x26D9E823,
+        0xDD43598C, 0x5A1B7DCB, 0x9F0C65A8, 0x6F117B68
+    },
+
+    /* 3 * B */
+    {
+        0x4CEE9730, 0xAF25B0A8, 0xE8864B8A, 0x025A8430,
+        0x9F016732, 0xC11B5002, 0x9A80F8F4, 0x7A164E1B,
+        0xA4FCD265, 0x56611FE8, 0xE5C1BA7D, 0x3BD353FD,
+        0x214BD6BD, 0x8131F31A, 0x555BDA62, 0x2AB91587,
+        0x0DD0D889, 0x14AE933F, 0x1C35DA62, 0x58942322,
+        0x8CF2DB4C, 0xD170E545, 0x12B9B4C6, 0x5A2826AF
+    },
+
+    /* 5 * B */
+    {
+        0x08A5BB33, 0xA212BC44, 0xC75EED02, 0x8D5048C3,
+        0x5ABFEC44, 0xDD1BEB0C, 0x46E206EB, 0x2945CCF1,
+        0xA447D6BA, 0x7F9182C3, 0x4B2729B7, 0xD50014D1,
+        0xB864A087, 0xE33CF11C, 0xEB1B55F3, 0x154A7E73,
+        0x812A8285, 0xBCBBDBF1, 0xD0BDD1FC, 0x270E0807,
+        0x1BBDA72D, 0xB41B670B, 0x6B3BB69A, 0x43AABE69
+    },
+
+    /* 7 * B */
+    {
+        0x944EA3BF, 0x6B1A5CD0, 0xB39DC0D2, 0x7470353A,
+        0x28542E49, 0x71B25282, 0x283C927E, 0x461BEA69,
+        0xAA3221B1, 0xBA6F2C9A, 0x3BBA23A7, 0x6CA02153,
+        0x92192C3A, 0x9DEA764F, 0x2E5317E0, 0x1D6EDD5D,
+        0x01B8B3A2, 0xF1836DC8, 0x053EA49A, 0xB3035F47,
+        0x5877ADF3, 0x529C41BA, 0x6A0F90A7, 0x7A9FBB1C
+    },
+
+    /* 9 * B */
+    {
+        0xA6A8632F, 0x9B2E678A, 0x51BC46C5, 0xA6509E6F,
+        0xC686F5B5, 0xCEB233C9, 0x8ADD7F59, 0x34B9ED33,
+        0x039D8064, 0xF36E217E, 0xF520419B, 0x98A081B6,
+        0xE75EB044, 0x96CBC608, 0xFADC9C8F, 0x49C05A51,
+        0x9045AF1B, 0x06B4E8BF, 0xA719D22F, 0xE2FF83E8,
+        0x93D4CF16, 0xAAF6FC29, 0x1B008B06, 0x73C17202
+    },
+
+    /* 11 * B */
+    {
+        0x8A802ADE, 0x2FBF0084, 0x02302E27, 0xE5D9FECF,
+        0x17703406, 0x113E8471, 0x546D8FAF, 0x4275AAE2,
+        0x49864348, 0x315F5B02, 0x77088381, 0x3ED6B369,
+        0x6A8DEB95, 0xA3A07555, 0x29D5C77F, 0x18AB5980,
+        0xFD6089E9, 0xD82B2CC5, 0x3282E4A4, 0x031EB4A1,
+        0xB51A8622, 0x44311199, 0xB53DF948, 0x3DC65522
+    },
+
+    /* 13 * B */
+    {
+        0xA2007F6D, 0xBF70C222, 0xB5BCDEDB, 0xBF84B39A,
+        0xFB07BA07, 0x537A0E12, 0xC346F241, 0x234FD7EE,
+        0x327FBF93, 0x506F013B, 0x9B776F6B, 0xAEFCEBC9,
+        0xAAAD5968, 0x9D12B232, 0x176024A7, 0x0267882D,
+        0x732EA378, 0x5360A119, 0xDF8DD471, 0x2437E6B1,
+        0x91A7E533, 0xA2EF37F8, 0xAA097863, 0x497BA6FD
+    },
+
+    /* 15 * B */
+    {
+        0x13CFEAA0, 0x24CECC03, 0x189C246D, 0x8648C28D,
+        0xC1F2D4D0, 0x2DBDBDFA, 0xF12DE72B, 0x61E22917,
+        0x468CCF0B, 0x040BCD86, 0x2A9910D6, 0xD3829BA4,
+        0x07B25192, 0x75083008, 0x18D05EBF, 0x43B5CD42,
+        0x9BD0B516, 0x5D9A762F, 0x373FDEEE, 0xEB38AF4E,
+        0x93D64270, 0x032E5A7D, 0x0AE4D842, 0x511D6121
+    }
+};
+
+#ifdef NX_CRYPTO_CURVE25519_RADIX_51
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_from_words                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function loads a field element from eight little endian        */
+/*    32-bit words. The most significant bit is ignored.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    w                                     Words                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_from_words(NX_CRYPTO_CURVE25519_LIMB *r, const UINT *w)
+{
+    r[0] = ((ULONG64)w[0] | ((ULONG64)w[1] << 32)) & NX_CRYPTO_CURVE25519_MASK_51;
+    r[1] = (((ULONG64)w[1] >> 19) | ((ULONG64)w[2] << 13) | ((ULONG64)w[3] << 45)) & NX_CRYPTO_CURVE25519_MASK_51;
+    r[2] = (((ULONG64)w[3] >> 6) | ((ULONG64)w[4] << 26)) & NX_CRYPTO_CURVE25519_MASK_51;
+    r[3] = (((ULONG64)w[4] >> 25) | ((ULONG64)w[5] << 7) | ((ULONG64)w[6] << 39)) & NX_CRYPTO_CURVE25519_MASK_51;
+    r[4] = (((ULONG64)w[6] >> 12) | ((ULONG64)w[7] << 20)) & NX_CRYPTO_CURVE25519_MASK_51;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function propagates the carries of the 128-bit column sums of  */
+/*    a product, producing limbs of at most 52 bits.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    h                                     Column sums                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_carry(NX_CRYPTO_CURVE25519_LIMB *r, NX_CRYPTO_CURVE25519_UINT128 *h)
+{
+NX_CRYPTO_CURVE25519_UINT128 t;
+
+    h[1] += h[0] >> 51;
+    r[0] = (ULONG64)h[0] & NX_CRYPTO_CURVE25519_MASK_51;
+    h[2] += h[1] >> 51;
+    r[1] = (ULONG64)h[1] & NX_CRYPTO_CURVE25519_MASK_51;
+    h[3] += h[2] >> 51;
+    r[2] = (ULONG64)h[2] & NX_CRYPTO_CURVE25519_MASK_51;
+    h[4] += h[3] >> 51;
+    r[3] = (ULONG64)h[3] & NX_CRYPTO_CURVE25519_MASK_51;
+    r[4] = (ULONG64)h[4] & NX_CRYPTO_CURVE25519_MASK_51;
+
+    /* 2^255 = 19 (mod p). */
+    t = (h[4] >> 51) * 19 + r[0];
+    r[0] = (ULONG64)t & NX_CRYPTO_CURVE25519_MASK_51;
+    r[1] += (ULONG64)(t >> 51);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_to_bytes                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function stores the canonical value of a field element as 32   */
+/*    little endian bytes.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    bytes                                 Output buffer                 */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_encode    Encode point                  */
+/*    _nx_crypto_x25519_multiple            X25519 function               */
+/*    _nx_crypto_x25519_base_multiple       X25519 with base point        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_to_bytes(UCHAR *bytes, const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+ULONG64 h[NX_CRYPTO_CURVE25519_LIMBS];
+ULONG64 q;
+UINT    i, j;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        h[i] = a[i];
+    }
+
+    /* Reduce to limbs of 51 bits, value below 2^255 + 19. */
+    for (j = 0; j < 2; j++)
+    {
+        for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS - 1; i++)
+        {
+            h[i + 1] += h[i] >> 51;
+            h[i] &= NX_CRYPTO_CURVE25519_MASK_51;
+        }
+        h[0] += (h[4] >> 51) * 19;
+        h[4] &= NX_CRYPTO_CURVE25519_MASK_51;
+    }
+
+    /* q = 1 if the value is at least p. Subtract q * p by adding 19 * q and dropping 2^255. */
+    q = (h[0] + 19) >> 51;
+    q = (h[1] + q) >> 51;
+    q = (h[2] + q) >> 51;
+    q = (h[3] + q) >> 51;
+    q = (h[4] + q) >> 51;
+    h[0] += 19 * q;
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS - 1; i++)
+    {
+        h[i + 1] += h[i] >> 51;
+        h[i] &= NX_CRYPTO_CURVE25519_MASK_51;
+    }
+    h[4] &= NX_CRYPTO_CURVE25519_MASK_51;
+
+    for (i = 0; i < 32; i++)
+    {
+        j = i << 3;
+        q = h[j / 51] >> (j % 51);
+        if ((((j % 51) + 8) > 51) && ((j / 51) < (NX_CRYPTO_CURVE25519_LIMBS - 1)))
+        {
+            q |= h[j / 51 + 1] << (51 - (j % 51));
+        }
+        bytes[i] = (UCHAR)q;
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_add                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds two field elements without reducing the limbs.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_add(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                  const NX_CRYPTO_CURVE25519_LIMB *b)
+{
+    r[0] = a[0] + b[0];
+    r[1] = a[1] + b[1];
+    r[2] = a[2] + b[2];
+    r[3] = a[3] + b[3];
+    r[4] = a[4] + b[4];
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_sub                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function subtracts two field elements. 4 * p is added first    */
+/*    so that no limb becomes negative.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_sub(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                  const NX_CRYPTO_CURVE25519_LIMB *b)
+{
+ULONG64 h0, h1, h2, h3, h4;
+
+    h0 = a[0] + 0x1FFFFFFFFFFFB4ULL - b[0];
+    h1 = a[1] + 0x1FFFFFFFFFFFFCULL - b[1];
+    h2 = a[2] + 0x1FFFFFFFFFFFFCULL - b[2];
+    h3 = a[3] + 0x1FFFFFFFFFFFFCULL - b[3];
+    h4 = a[4] + 0x1FFFFFFFFFFFFCULL - b[4];
+
+    h1 += h0 >> 51;
+    r[0] = h0 & NX_CRYPTO_CURVE25519_MASK_51;
+    h2 += h1 >> 51;
+    r[1] = h1 & NX_CRYPTO_CURVE25519_MASK_51;
+    h3 += h2 >> 51;
+    r[2] = h2 & NX_CRYPTO_CURVE25519_MASK_51;
+    h4 += h3 >> 51;
+    r[3] = h3 & NX_CRYPTO_CURVE25519_MASK_51;
+    r[4] = h4 & NX_CRYPTO_CURVE25519_MASK_51;
+    r[0] += (h4 >> 51) * 19;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_mul                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies two field elements. The reduction by       */
+/*    2^255 = 19 is folded into the column sums.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_mul(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                  const NX_CRYPTO_CURVE25519_LIMB *b)
+{
+NX_CRYPTO_CURVE25519_UINT128 h[NX_CRYPTO_CURVE25519_LIMBS];
+ULONG64                      b19[NX_CRYPTO_CURVE25519_LIMBS];
+UINT                         i;
+
+    for (i = 1; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        b19[i] = b[i] * 19;
+    }
+
+    h[0] = NX_CRYPTO_CURVE25519_MUL128(a[0], b[0]) + NX_CRYPTO_CURVE25519_MUL128(a[1], b19[4])
+         + NX_CRYPTO_CURVE25519_MUL128(a[2], b19[3]) + NX_CRYPTO_CURVE25519_MUL128(a[3], b19[2])
+         + NX_CRYPTO_CURVE25519_MUL128(a[4], b19[1]);
+    h[1] = NX_CRYPTO_CURVE25519_MUL128(a[0], b[1]) + NX_CRYPTO_CURVE25519_MUL128(a[1], b[0])
+         + NX_CRYPTO_CURVE25519_MUL128(a[2], b19[4]) + NX_CRYPTO_CURVE25519_MUL128(a[3], b19[3])
+         + NX_CRYPTO_CURVE25519_MUL128(a[4], b19[2]);
+    h[2] = NX_CRYPTO_CURVE25519_MUL128(a[0], b[2]) + NX_CRYPTO_CURVE25519_MUL128(a[1], b[1])
+         + NX_CRYPTO_CURVE25519_MUL128(a[2], b[0]) + NX_CRYPTO_CURVE25519_MUL128(a[3], b19[4])
+         + NX_CRYPTO_CURVE25519_MUL128(a[4], b19[3]);
+    h[3] = NX_CRYPTO_CURVE25519_MUL128(a[0], b[3]) + NX_CRYPTO_CURVE25519_MUL128(a[1], b[2])
+         + NX_CRYPTO_CURVE25519_MUL128(a[2], b[1]) + NX_CRYPTO_CURVE25519_MUL128(a[3], b[0])
+         + NX_CRYPTO_CURVE25519_MUL128(a[4], b19[4]);
+    h[4] = NX_CRYPTO_CURVE25519_MUL128(a[0], b[4]) + NX_CRYPTO_CURVE25519_MUL128(a[1], b[3])
+         + NX_CRYPTO_CURVE25519_MUL128(a[2], b[2]) + NX_CRYPTO_CURVE25519_MUL128(a[3], b[1])
+         + NX_CRYPTO_CURVE25519_MUL128(a[4], b[0]);
+
+    _nx_crypto_curve25519_fe_carry(r, h);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_sqr                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function squares a field element.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_sqr(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+NX_CRYPTO_CURVE25519_UINT128 h[NX_CRYPTO_CURVE25519_LIMBS];
+ULONG64                      a2[NX_CRYPTO_CURVE25519_LIMBS];
+ULONG64                      a19[NX_CRYPTO_CURVE25519_LIMBS];
+UINT                         i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        a2[i] = a[i] << 1;
+        a19[i] = a[i] * 19;
+    }
+
+    h[0] = NX_CRYPTO_CURVE25519_MUL128(a[0], a[0]) + NX_CRYPTO_CURVE25519_MUL128(a2[1], a19[4])
+         + NX_CRYPTO_CURVE25519_MUL128(a2[2], a19[3]);
+    h[1] = NX_CRYPTO_CURVE25519_MUL128(a2[0], a[1]) + NX_CRYPTO_CURVE25519_MUL128(a2[2], a19[4])
+         + NX_CRYPTO_CURVE25519_MUL128(a[3], a19[3]);
+    h[2] = NX_CRYPTO_CURVE25519_MUL128(a2[0], a[2]) + NX_CRYPTO_CURVE25519_MUL128(a[1], a[1])
+         + NX_CRYPTO_CURVE25519_MUL128(a2[3], a19[4]);
+    h[3] = NX_CRYPTO_CURVE25519_MUL128(a2[0], a[3]) + NX_CRYPTO_CURVE25519_MUL128(a2[1], a[2])
+         + NX_CRYPTO_CURVE25519_MUL128(a[4], a19[4]);
+    h[4] = NX_CRYPTO_CURVE25519_MUL128(a2[0], a[4]) + NX_CRYPTO_CURVE25519_MUL128(a2[1], a[3])
+         + NX_CRYPTO_CURVE25519_MUL128(a[2], a[2]);
+
+    _nx_crypto_curve25519_fe_carry(r, h);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_sqr_double                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes 2 * a^2, doubling the column sums before     */
+/*    the carry.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_sqr_double(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+NX_CRYPTO_CURVE25519_UINT128 h[NX_CRYPTO_CURVE25519_LIMBS];
+ULONG64                      a2[NX_CRYPTO_CURVE25519_LIMBS];
+ULONG64                      a19[NX_CRYPTO_CURVE25519_LIMBS];
+UINT                         i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        a2[i] = a[i] << 1;
+        a19[i] = a[i] * 19;
+    }
+
+    h[0] = NX_CRYPTO_CURVE25519_MUL128(a[0], a[0]) + NX_CRYPTO_CURVE25519_MUL128(a2[1], a19[4])
+         + NX_CRYPTO_CURVE25519_MUL128(a2[2], a19[3]);
+    h[1] = NX_CRYPTO_CURVE25519_MUL128(a2[0], a[1]) + NX_CRYPTO_CURVE25519_MUL128(a2[2], a19[4])
+         + NX_CRYPTO_CURVE25519_MUL128(a[3], a19[3]);
+    h[2] = NX_CRYPTO_CURVE25519_MUL128(a2[0], a[2]) + NX_CRYPTO_CURVE25519_MUL128(a[1], a[1])
+         + NX_CRYPTO_CURVE25519_MUL128(a2[3], a19[4]);
+    h[3] = NX_CRYPTO_CURVE25519_MUL128(a2[0], a[3]) + NX_CRYPTO_CURVE25519_MUL128(a2[1], a[2])
+         + NX_CRYPTO_CURVE25519_MUL128(a[4], a19[4]);
+    h[4] = NX_CRYPTO_CURVE25519_MUL128(a2[0], a[4]) + NX_CRYPTO_CURVE25519_MUL128(a2[1], a[3])
+         + NX_CRYPTO_CURVE25519_MUL128(a[2], a[2]);
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        h[i] <<= 1;
+    }
+
+    _nx_crypto_curve25519_fe_carry(r, h);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_mul_small                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies a field element by a small constant.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Constant below 2^20           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_mul_small(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                               UINT b)
+{
+NX_CRYPTO_CURVE25519_UINT128 h[NX_CRYPTO_CURVE25519_LIMBS];
+UINT                         i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        h[i] = NX_CRYPTO_CURVE25519_MUL128(a[i], b);
+    }
+
+    _nx_crypto_curve25519_fe_carry(r, h);
+}
+
+#else
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function propagates the carries of the 64-bit column sums of   */
+/*    a product, producing signed limbs of at most 25 or 26 bits. The     */
+/*    carries are rounded so that every limb is balanced around zero.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    h                                     Column sums                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_carry(NX_CRYPTO_CURVE25519_LIMB *r, LONG64 *h)
+{
+LONG64 c;
+
+    /* Two interleaved carry chains keep the dependency depth short.
+       Multiplication is used instead of left shift on negative values. */
+    c = (h[0] + ((LONG64)1 << 25)) >> 26;
+    h[1] += c;
+    h[0] -= c * ((LONG64)1 << 26);
+    c = (h[4] + ((LONG64)1 << 25)) >> 26;
+    h[5] += c;
+    h[4] -= c * ((LONG64)1 << 26);
+    c = (h[1] + ((LONG64)1 << 24)) >> 25;
+    h[2] += c;
+    h[1] -= c * ((LONG64)1 << 25);
+    c = (h[5] + ((LONG64)1 << 24)) >> 25;
+    h[6] += c;
+    h[5] -= c * ((LONG64)1 << 25);
+    c = (h[2] + ((LONG64)1 << 25)) >> 26;
+    h[3] += c;
+    h[2] -= c * ((LONG64)1 << 26);
+    c = (h[6] + ((LONG64)1 << 25)) >> 26;
+    h[7] += c;
+    h[6] -= c * ((LONG64)1 << 26);
+    c = (h[3] + ((LONG64)1 << 24)) >> 25;
+    h[4] += c;
+    h[3] -= c * ((LONG64)1 << 25);
+    c = (h[7] + ((LONG64)1 << 24)) >> 25;
+    h[8] += c;
+    h[7] -= c * ((LONG64)1 << 25);
+    c = (h[4] + ((LONG64)1 << 25)) >> 26;
+    h[5] += c;
+    h[4] -= c * ((LONG64)1 << 26);
+    c = (h[8] + ((LONG64)1 << 25)) >> 26;
+    h[9] += c;
+    h[8] -= c * ((LONG64)1 << 26);
+    c = (h[9] + ((LONG64)1 << 24)) >> 25;
+    h[0] += c * 19;
+    h[9] -= c * ((LONG64)1 << 25);
+    c = (h[0] + ((LONG64)1 << 25)) >> 26;
+    h[1] += c;
+    h[0] -= c * ((LONG64)1 << 26);
+
+    r[0] = (INT)h[0];
+    r[1] = (INT)h[1];
+    r[2] = (INT)h[2];
+    r[3] = (INT)h[3];
+    r[4] = (INT)h[4];
+    r[5] = (INT)h[5];
+    r[6] = (INT)h[6];
+    r[7] = (INT)h[7];
+    r[8] = (INT)h[8];
+    r[9] = (INT)h[9];
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_from_words                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function loads a field element from eight little endian        */
+/*    32-bit words. The most significant bit is ignored.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    w                                     Words                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_from_words(NX_CRYPTO_CURVE25519_LIMB *r, const UINT *w)
+{
+LONG64 h[NX_CRYPTO_CURVE25519_LIMBS];
+
+    h[0] = w[0] & 0x3FFFFFF;
+    h[1] = ((w[0] >> 26) | (w[1] << 6)) & 0x1FFFFFF;
+    h[2] = ((w[1] >> 19) | (w[2] << 13)) & 0x3FFFFFF;
+    h[3] = ((w[2] >> 13) | (w[3] << 19)) & 0x1FFFFFF;
+    h[4] = (w[3] >> 6) & 0x3FFFFFF;
+    h[5] = w[4] & 0x1FFFFFF;
+    h[6] = ((w[4] >> 25) | (w[5] << 7)) & 0x3FFFFFF;
+    h[7] = ((w[5] >> 19) | (w[6] << 13)) & 0x1FFFFFF;
+    h[8] = ((w[6] >> 12) | (w[7] << 20)) & 0x3FFFFFF;
+    h[9] = (w[7] >> 6) & 0x1FFFFFF;
+
+    _nx_crypto_curve25519_fe_carry(r, h);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_to_bytes                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function stores the canonical value of a field element as 32   */
+/*    little endian bytes.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    bytes                                 Output buffer                 */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_encode    Encode point                  */
+/*    _nx_crypto_x25519_multiple            X25519 function               */
+/*    _nx_crypto_x25519_base_multiple       X25519 with base point        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_to_bytes(UCHAR *bytes, const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+NX_CRYPTO_CURVE25519_LIMB h[NX_CRYPTO_CURVE25519_LIMBS];
+LONG64                    t[NX_CRYPTO_CURVE25519_LIMBS];
+UINT                      w[8];
+INT                       q;
+UINT                      i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        t[i] = a[i];
+    }
+    _nx_crypto_curve25519_fe_carry(h, t);
+
+    /* q = floor(h / p), which is 0 or 1 for the carried limbs. */
+    q = (19 * h[9] + (1 << 24)) >> 25;
+    q = (h[0] + q) >> 26;
+    q = (h[1] + q) >> 25;
+    q = (h[2] + q) >> 26;
+    q = (h[3] + q) >> 25;
+    q = (h[4] + q) >> 26;
+    q = (h[5] + q) >> 25;
+    q = (h[6] + q) >> 26;
+    q = (h[7] + q) >> 25;
+    q = (h[8] + q) >> 26;
+    q = (h[9] + q) >> 25;
+
+    /* Subtract q * p by adding 19 * q and dropping 2^255. */
+    h[0] += 19 * q;
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS - 1; i++)
+    {
+        q = h[i] >> (26 - (i & 1));
+        h[i + 1] += q;
+        h[i] -= q * (1 << (26 - (i & 1)));
+    }
+    h[9] &= 0x1FFFFFF;
+
+    w[0] = (UINT)h[0] | ((UINT)h[1] << 26);
+    w[1] = ((UINT)h[1] >> 6) | ((UINT)h[2] << 19);
+    w[2] = ((UINT)h[2] >> 13) | ((UINT)h[3] << 13);
+    w[3] = ((UINT)h[3] >> 19) | ((UINT)h[4] << 6);
+    w[4] = (UINT)h[5] | ((UINT)h[6] << 25);
+    w[5] = ((UINT)h[6] >> 7) | ((UINT)h[7] << 19);
+    w[6] = ((UINT)h[7] >> 13) | ((UINT)h[8] << 12);
+    w[7] = ((UINT)h[8] >> 20) | ((UINT)h[9] << 6);
+
+    for (i = 0; i < 32; i++)
+    {
+        bytes[i] = (UCHAR)(w[i >> 2] >> ((i & 3) << 3));
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_add                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds two field elements without reducing the limbs.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_add(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                  const NX_CRYPTO_CURVE25519_LIMB *b)
+{
+UINT i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        r[i] = a[i] + b[i];
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_sub                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function subtracts two field elements without reducing the     */
+/*    limbs.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_sub(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                  const NX_CRYPTO_CURVE25519_LIMB *b)
+{
+UINT i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        r[i] = a[i] - b[i];
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_mul                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies two field elements. The reduction by       */
+/*    2^255 = 19 is folded into the column sums, and odd by odd limb      */
+/*    products are doubled to account for the alternating limb sizes.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_mul(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                  const NX_CRYPTO_CURVE25519_LIMB *b)
+{
+LONG64 h[NX_CRYPTO_CURVE25519_LIMBS];
+INT    a2[NX_CRYPTO_CURVE25519_LIMBS];
+INT    b19[NX_CRYPTO_CURVE25519_LIMBS];
+UINT   i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        a2[i] = a[i] * 2;
+        b19[i] = b[i] * 19;
+    }
+
+    h[0] = a[0] * (LONG64)b[0] + a2[1] * (LONG64)b19[9] + a[2] * (LONG64)b19[8] + a2[3] * (LONG64)b19[7]
+         + a[4] * (LONG64)b19[6] + a2[5] * (LONG64)b19[5] + a[6] * (LONG64)b19[4] + a2[7] * (LONG64)b19[3]
+         + a[8] * (LONG64)b19[2] + a2[9] * (LONG64)b19[1];
+    h[1] = a[0] * (LONG64)b[1] + a[1] * (LONG64)b[0] + a[2] * (LONG64)b19[9] + a[3] * (LONG64)b19[8]
+         + a[4] * (LONG64)b19[7] + a[5] * (LONG64)b19[6] + a[6] * (LONG64)b19[5] + a[7] * (LONG64)b19[4]
+         + a[8] * (LONG64)b19[3] + a[9] * (LONG64)b19[2];
+    h[2] = a[0] * (LONG64)b[2] + a2[1] * (LONG64)b[1] + a[2] * (LONG64)b[0] + a2[3] * (LONG64)b19[9]
+         + a[4] * (LONG64)b19[8] + a2[5] * (LONG64)b19[7] + a[6] * (LONG64)b19[6] + a2[7] * (LONG64)b19[5]
+         + a[8] * (LONG64)b19[4] + a2[9] * (LONG64)b19[3];
+    h[3] = a[0] * (LONG64)b[3] + a[1] * (LONG64)b[2] + a[2] * (LONG64)b[1] + a[3] * (LONG64)b[0]
+         + a[4] * (LONG64)b19[9] + a[5] * (LONG64)b19[8] + a[6] * (LONG64)b19[7] + a[7] * (LONG64)b19[6]
+         + a[8] * (LONG64)b19[5] + a[9] * (LONG64)b19[4];
+    h[4] = a[0] * (LONG64)b[4] + a2[1] * (LONG64)b[3] + a[2] * (LONG64)b[2] + a2[3] * (LONG64)b[1]
+         + a[4] * (LONG64)b[0] + a2[5] * (LONG64)b19[9] + a[6] * (LONG64)b19[8] + a2[7] * (LONG64)b19[7]
+         + a[8] * (LONG64)b19[6] + a2[9] * (LONG64)b19[5];
+    h[5] = a[0] * (LONG64)b[5] + a[1] * (LONG64)b[4] + a[2] * (LONG64)b[3] + a[3] * (LONG64)b[2]
+         + a[4] * (LONG64)b[1] + a[5] * (LONG64)b[0] + a[6] * (LONG64)b19[9] + a[7] * (LONG64)b19[8]
+         + a[8] * (LONG64)b19[7] + a[9] * (LONG64)b19[6];
+    h[6] = a[0] * (LONG64)b[6] + a2[1] * (LONG64)b[5] + a[2] * (LONG64)b[4] + a2[3] * (LONG64)b[3]
+         + a[4] * (LONG64)b[2] + a2[5] * (LONG64)b[1] + a[6] * (LONG64)b[0] + a2[7] * (LONG64)b19[9]
+         + a[8] * (LONG64)b19[8] + a2[9] * (LONG64)b19[7];
+    h[7] = a[0] * (LONG64)b[7] + a[1] * (LONG64)b[6] + a[2] * (LONG64)b[5] + a[3] * (LONG64)b[4]
+         + a[4] * (LONG64)b[3] + a[5] * (LONG64)b[2] + a[6] * (LONG64)b[1] + a[7] * (LONG64)b[0]
+         + a[8] * (LONG64)b19[9] + a[9] * (LONG64)b19[8];
+    h[8] = a[0] * (LONG64)b[8] + a2[1] * (LONG64)b[7] + a[2] * (LONG64)b[6] + a2[3] * (LONG64)b[5]
+         + a[4] * (LONG64)b[4] + a2[5] * (LONG64)b[3] + a[6] * (LONG64)b[2] + a2[7] * (LONG64)b[1]
+         + a[8] * (LONG64)b[0] + a2[9] * (LONG64)b19[9];
+    h[9] = a[0] * (LONG64)b[9] + a[1] * (LONG64)b[8] + a[2] * (LONG64)b[7] + a[3] * (LONG64)b[6]
+         + a[4] * (LONG64)b[5] + a[5] * (LONG64)b[4] + a[6] * (LONG64)b[3] + a[7] * (LONG64)b[2]
+         + a[8] * (LONG64)b[1] + a[9] * (LONG64)b[0];
+
+    _nx_crypto_curve25519_fe_carry(r, h);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_sqr                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function squares a field element.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_sqr(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+LONG64 h[NX_CRYPTO_CURVE25519_LIMBS];
+INT    a2[NX_CRYPTO_CURVE25519_LIMBS];
+INT    a19[NX_CRYPTO_CURVE25519_LIMBS];
+INT    a38[NX_CRYPTO_CURVE25519_LIMBS];
+UINT   i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        a2[i] = a[i] * 2;
+    }
+
+    /* Only the upper odd limbs are scaled by 38 and the upper even limbs by 19, so an unreduced
+       sum of two field elements still fits the 32-bit limb type. */
+    for (i = 5; i < NX_CRYPTO_CURVE25519_LIMBS; i += 2)
+    {
+        a38[i] = a[i] * 38;
+    }
+    for (i = 6; i < NX_CRYPTO_CURVE25519_LIMBS; i += 2)
+    {
+        a19[i] = a[i] * 19;
+    }
+
+    h[0] = a[0] * (LONG64)a[0] + a2[1] * (LONG64)a38[9] + a2[2] * (LONG64)a19[8] + a2[3] * (LONG64)a38[7]
+         + a2[4] * (LONG64)a19[6] + a[5] * (LONG64)a38[5];
+    h[1] = a2[0] * (LONG64)a[1] + a[2] * (LONG64)a38[9] + a2[3] * (LONG64)a19[8] + a[4] * (LONG64)a38[7]
+         + a2[5] * (LONG64)a19[6];
+    h[2] = a2[0] * (LONG64)a[2] + a2[1] * (LONG64)a[1] + a2[3] * (LONG64)a38[9] + a2[4] * (LONG64)a19[8]
+         + a2[5] * (LONG64)a38[7] + a[6] * (LONG64)a19[6];
+    h[3] = a2[0] * (LONG64)a[3] + a2[1] * (LONG64)a[2] + a[4] * (LONG64)a38[9] + a2[5] * (LONG64)a19[8]
+         + a[6] * (LONG64)a38[7];
+    h[4] = a2[0] * (LONG64)a[4] + a2[1] * (LONG64)a2[3] + a[2] * (LONG64)a[2] + a2[5] * (LONG64)a38[9]
+         + a2[6] * (LONG64)a19[8] + a[7] * (LONG64)a38[7];
+    h[5] = a2[0] * (LONG64)a[5] + a2[1] * (LONG64)a[4] + a2[2] * (LONG64)a[3] + a[6] * (LONG64)a38[9]
+         + a2[7] * (LONG64)a19[8];
+    h[6] = a2[0] * (LONG64)a[6] + a2[1] * (LONG64)a2[5] + a2[2] * (LONG64)a[4] + a2[3] * (LONG64)a[3]
+         + a2[7] * (LONG64)a38[9] + a[8] * (LONG64)a19[8];
+    h[7] = a2[0] * (LONG64)a[7] + a2[1] * (LONG64)a[6] + a2[2] * (LONG64)a[5] + a2[3] * (LONG64)a[4]
+         + a[8] * (LONG64)a38[9];
+    h[8] = a2[0] * (LONG64)a[8] + a2[1] * (LONG64)a2[7] + a2[2] * (LONG64)a[6] + a2[3] * (LONG64)a2[5]
+         + a[4] * (LONG64)a[4] + a[9] * (LONG64)a38[9];
+    h[9] = a2[0] * (LONG64)a[9] + a2[1] * (LONG64)a[8] + a2[2] * (LONG64)a[7] + a2[3] * (LONG64)a[6]
+         + a2[4] * (LONG64)a[5];
+
+    _nx_crypto_curve25519_fe_carry(r, h);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_sqr_double                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes 2 * a^2, doubling the column sums before     */
+/*    the carry.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_sqr_double(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+LONG64 h[NX_CRYPTO_CURVE25519_LIMBS];
+INT    a2[NX_CRYPTO_CURVE25519_LIMBS];
+INT    a19[NX_CRYPTO_CURVE25519_LIMBS];
+INT    a38[NX_CRYPTO_CURVE25519_LIMBS];
+UINT   i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        a2[i] = a[i] * 2;
+    }
+
+    /* Only the upper odd limbs are scaled by 38 and the upper even limbs by 19, so an unreduced
+       sum of two field elements still fits the 32-bit limb type. */
+    for (i = 5; i < NX_CRYPTO_CURVE25519_LIMBS; i += 2)
+    {
+        a38[i] = a[i] * 38;
+    }
+    for (i = 6; i < NX_CRYPTO_CURVE25519_LIMBS; i += 2)
+    {
+        a19[i] = a[i] * 19;
+    }
+
+    h[0] = a[0] * (LONG64)a[0] + a2[1] * (LONG64)a38[9] + a2[2] * (LONG64)a19[8] + a2[3] * (LONG64)a38[7]
+         + a2[4] * (LONG64)a19[6] + a[5] * (LONG64)a38[5];
+    h[1] = a2[0] * (LONG64)a[1] + a[2] * (LONG64)a38[9] + a2[3] * (LONG64)a19[8] + a[4] * (LONG64)a38[7]
+         + a2[5] * (LONG64)a19[6];
+    h[2] = a2[0] * (LONG64)a[2] + a2[1] * (LONG64)a[1] + a2[3] * (LONG64)a38[9] + a2[4] * (LONG64)a19[8]
+         + a2[5] * (LONG64)a38[7] + a[6] * (LONG64)a19[6];
+    h[3] = a2[0] * (LONG64)a[3] + a2[1] * (LONG64)a[2] + a[4] * (LONG64)a38[9] + a2[5] * (LONG64)a19[8]
+         + a[6] * (LONG64)a38[7];
+    h[4] = a2[0] * (LONG64)a[4] + a2[1] * (LONG64)a2[3] + a[2] * (LONG64)a[2] + a2[5] * (LONG64)a38[9]
+         + a2[6] * (LONG64)a19[8] + a[7] * (LONG64)a38[7];
+    h[5] = a2[0] * (LONG64)a[5] + a2[1] * (LONG64)a[4] + a2[2] * (LONG64)a[3] + a[6] * (LONG64)a38[9]
+         + a2[7] * (LONG64)a19[8];
+    h[6] = a2[0] * (LONG64)a[6] + a2[1] * (LONG64)a2[5] + a2[2] * (LONG64)a[4] + a2[3] * (LONG64)a[3]
+         + a2[7] * (LONG64)a38[9] + a[8] * (LONG64)a19[8];
+    h[7] = a2[0] * (LONG64)a[7] + a2[1] * (LONG64)a[6] + a2[2] * (LONG64)a[5] + a2[3] * (LONG64)a[4]
+         + a[8] * (LONG64)a38[9];
+    h[8] = a2[0] * (LONG64)a[8] + a2[1] * (LONG64)a2[7] + a2[2] * (LONG64)a[6] + a2[3] * (LONG64)a2[5]
+         + a[4] * (LONG64)a[4] + a[9] * (LONG64)a38[9];
+    h[9] = a2[0] * (LONG64)a[9] + a2[1] * (LONG64)a[8] + a2[2] * (LONG64)a[7] + a2[3] * (LONG64)a[6]
+         + a2[4] * (LONG64)a[5];
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        h[i] += h[i];
+    }
+
+    _nx_crypto_curve25519_fe_carry(r, h);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_mul_small                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies a field element by a small constant.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Constant below 2^20           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_carry        Propagate carries             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_mul_small(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a,
+                                               UINT b)
+{
+LONG64 h[NX_CRYPTO_CURVE25519_LIMBS];
+UINT   i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        h[i] = a[i] * (LONG64)b;
+    }
+
+    _nx_crypto_curve25519_fe_carry(r, h);
+}
+
+#endif /* NX_CRYPTO_CURVE25519_RADIX_51 */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_set_digit                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets a field element to a small value.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    digit                                 Value below 2^25              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_set_digit(NX_CRYPTO_CURVE25519_LIMB *r, UINT digit)
+{
+    NX_CRYPTO_MEMSET(r, 0, sizeof(NX_CRYPTO_CURVE25519_LIMB) * NX_CRYPTO_CURVE25519_LIMBS);
+    r[0] = (NX_CRYPTO_CURVE25519_LIMB)digit;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_from_bytes                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function loads a field element from 32 little endian bytes.    */
+/*    The most significant bit is ignored.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    bytes                                 Input buffer                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_from_words   Load from words               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_decode    Decode point                  */
+/*    _nx_crypto_x25519_multiple            X25519 function               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_from_bytes(NX_CRYPTO_CURVE25519_LIMB *r, const UCHAR *bytes)
+{
+UINT w[8];
+UINT i;
+
+    for (i = 0; i < 8; i++)
+    {
+        w[i] = ((UINT)bytes[(i << 2)]) |
+               ((UINT)bytes[(i << 2) + 1] << 8) |
+               ((UINT)bytes[(i << 2) + 2] << 16) |
+               ((UINT)bytes[(i << 2) + 3] << 24);
+    }
+
+    _nx_crypto_curve25519_fe_from_words(r, w);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_neg                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function negates a field element.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_set_digit    Set small value               */
+/*    _nx_crypto_curve25519_fe_sub          Subtraction                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_neg(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+NX_CRYPTO_CURVE25519_LIMB zero[NX_CRYPTO_CURVE25519_LIMBS];
+
+    _nx_crypto_curve25519_fe_set_digit(zero, 0);
+    _nx_crypto_curve25519_fe_sub(r, zero, a);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_swap                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function swaps two field elements in constant time when swap   */
+/*    is one.                                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*    swap                                  Zero or one                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_swap(NX_CRYPTO_CURVE25519_LIMB *a, NX_CRYPTO_CURVE25519_LIMB *b, UINT swap)
+{
+NX_CRYPTO_CURVE25519_LIMB mask = (NX_CRYPTO_CURVE25519_LIMB)0 - (NX_CRYPTO_CURVE25519_LIMB)swap;
+NX_CRYPTO_CURVE25519_LIMB t;
+UINT                      i;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_LIMBS; i++)
+    {
+        t = (a[i] ^ b[i]) & mask;
+        a[i] ^= t;
+        b[i] ^= t;
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_is_zero                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks whether a field element is zero modulo p.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    zero                                  One if a is zero              */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_to_bytes     Store canonical value         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_curve25519_fe_is_zero(const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+UCHAR bytes[32];
+UINT  value = 0;
+UINT  i;
+
+    _nx_crypto_curve25519_fe_to_bytes(bytes, a);
+    for (i = 0; i < sizeof(bytes); i++)
+    {
+        value |= bytes[i];
+    }
+
+    return((value - 1) >> 31);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_is_negative                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the least significant bit of the canonical    */
+/*    value, which is the sign of x in the point encoding.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    sign                                  Zero or one                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_to_bytes     Store canonical value         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_curve25519_fe_is_negative(const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+UCHAR bytes[32];
+
+    _nx_crypto_curve25519_fe_to_bytes(bytes, a);
+
+    return(bytes[0] & 1);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_sqr_n                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function squares a field element n times.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    n                                     Number of squarings           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_sqr          Squaring                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_sqr_n(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a, UINT n)
+{
+UINT i;
+
+    _nx_crypto_curve25519_fe_sqr(r, a);
+    for (i = 1; i < n; i++)
+    {
+        _nx_crypto_curve25519_fe_sqr(r, r);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_pow_2_250_1                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes a^(2^250 - 1), the common prefix of the      */
+/*    addition chains for inversion and square root. a^11 is returned as  */
+/*    well.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a11                                   Result a^11                   */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*    _nx_crypto_curve25519_fe_sqr          Squaring                      */
+/*    _nx_crypto_curve25519_fe_sqr_n        Repeated squaring             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_pow_2_250_1(NX_CRYPTO_CURVE25519_LIMB *r, NX_CRYPTO_CURVE25519_LIMB *a11,
+                                                 const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+NX_CRYPTO_CURVE25519_LIMB t0[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB t1[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB t2[NX_CRYPTO_CURVE25519_LIMBS];
+
+    /* t0 = a^2, t1 = a^9, a11 = a^11. */
+    _nx_crypto_curve25519_fe_sqr(t0, a);
+    _nx_crypto_curve25519_fe_sqr_n(t1, t0, 2);
+    _nx_crypto_curve25519_fe_mul(t1, a, t1);
+    _nx_crypto_curve25519_fe_mul(a11, t0, t1);
+
+    /* t1 = a^(2^5 - 1) */
+    _nx_crypto_curve25519_fe_sqr(t0, a11);
+    _nx_crypto_curve25519_fe_mul(t1, t1, t0);
+
+    /* t1 = a^(2^10 - 1) */
+    _nx_crypto_curve25519_fe_sqr_n(t0, t1, 5);
+    _nx_crypto_curve25519_fe_mul(t1, t0, t1);
+
+    /* t2 = a^(2^20 - 1) */
+    _nx_crypto_curve25519_fe_sqr_n(t0, t1, 10);
+    _nx_crypto_curve25519_fe_mul(t2, t0, t1);
+
+    /* t0 = a^(2^40 - 1) */
+    _nx_crypto_curve25519_fe_sqr_n(t0, t2, 20);
+    _nx_crypto_curve25519_fe_mul(t0, t0, t2);
+
+    /* t1 = a^(2^50 - 1) */
+    _nx_crypto_curve25519_fe_sqr_n(t0, t0, 10);
+    _nx_crypto_curve25519_fe_mul(t1, t0, t1);
+
+    /* t2 = a^(2^100 - 1) */
+    _nx_crypto_curve25519_fe_sqr_n(t0, t1, 50);
+    _nx_crypto_curve25519_fe_mul(t2, t0, t1);
+
+    /* t0 = a^(2^200 - 1) */
+    _nx_crypto_curve25519_fe_sqr_n(t0, t2, 100);
+    _nx_crypto_curve25519_fe_mul(t0, t0, t2);
+
+    /* r = a^(2^250 - 1) */
+    _nx_crypto_curve25519_fe_sqr_n(t0, t0, 50);
+    _nx_crypto_curve25519_fe_mul(r, t0, t1);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_inverse                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the modular inverse a^(p - 2) in constant    */
+/*    time.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_pow_2_250_1  Compute a^(2^250 - 1)         */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*    _nx_crypto_curve25519_fe_sqr_n        Repeated squaring             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_fe_inverse(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+NX_CRYPTO_CURVE25519_LIMB t0[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB a11[NX_CRYPTO_CURVE25519_LIMBS];
+
+    /* p - 2 = 2^255 - 21 = (2^250 - 1) * 2^5 + 11 */
+    _nx_crypto_curve25519_fe_pow_2_250_1(t0, a11, a);
+    _nx_crypto_curve25519_fe_sqr_n(t0, t0, 5);
+    _nx_crypto_curve25519_fe_mul(r, t0, a11);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_pow22523                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes a^((p - 5) / 8), used for the square root    */
+/*    in point decoding.                                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_pow_2_250_1  Compute a^(2^250 - 1)         */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*    _nx_crypto_curve25519_fe_sqr_n        Repeated squaring             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_fe_pow22523(NX_CRYPTO_CURVE25519_LIMB *r, const NX_CRYPTO_CURVE25519_LIMB *a)
+{
+NX_CRYPTO_CURVE25519_LIMB t0[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB a11[NX_CRYPTO_CURVE25519_LIMBS];
+
+    /* (p - 5) / 8 = 2^252 - 3 = (2^250 - 1) * 2^2 + 1 */
+    _nx_crypto_curve25519_fe_pow_2_250_1(t0, a11, a);
+    _nx_crypto_curve25519_fe_sqr_n(t0, t0, 2);
+    _nx_crypto_curve25519_fe_mul(r, t0, a);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_set_identity            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the point to the neutral element (0, 1).         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_set_digit    Set small value               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_point_set_identity(NX_CRYPTO_CURVE25519_POINT *r)
+{
+    _nx_crypto_curve25519_fe_set_digit(r -> nx_crypto_curve25519_point_x, 0);
+    _nx_crypto_curve25519_fe_set_digit(r -> nx_crypto_curve25519_point_y, 1);
+    _nx_crypto_curve25519_fe_set_digit(r -> nx_crypto_curve25519_point_z, 1);
+    _nx_crypto_curve25519_fe_set_digit(r -> nx_crypto_curve25519_point_t, 0);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_complete                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function converts the intermediate result (X' : Y' : Z' : T')  */
+/*    of a doubling or an addition into extended coordinates X = X' *     */
+/*    T', Y = Y' * Z', Z = Z' * T', T = X' * Y'.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    x                                     X'                            */
+/*    y                                     Y'                            */
+/*    z                                     Z'                            */
+/*    t                                     T'                            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_point_complete(NX_CRYPTO_CURVE25519_POINT *r,
+                                                 const NX_CRYPTO_CURVE25519_LIMB *x,
+                                                 const NX_CRYPTO_CURVE25519_LIMB *y,
+                                                 const NX_CRYPTO_CURVE25519_LIMB *z,
+                                                 const NX_CRYPTO_CURVE25519_LIMB *t)
+{
+    _nx_crypto_curve25519_fe_mul(r -> nx_crypto_curve25519_point_x, x, t);
+    _nx_crypto_curve25519_fe_mul(r -> nx_crypto_curve25519_point_y, y, z);
+    _nx_crypto_curve25519_fe_mul(r -> nx_crypto_curve25519_point_z, z, t);
+    _nx_crypto_curve25519_fe_mul(r -> nx_crypto_curve25519_point_t, x, y);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_double                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function doubles a point with the dedicated formula for a =    */
+/*    -1, using four squarings and four multiplications.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Point a                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_add          Addition                      */
+/*    _nx_crypto_curve25519_fe_sub          Subtraction                   */
+/*    _nx_crypto_curve25519_fe_sqr          Squaring                      */
+/*    _nx_crypto_curve25519_fe_sqr_double   Doubled squaring              */
+/*    _nx_crypto_curve25519_point_complete  Convert to extended           */
+/*                                            coordinates                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_point_double(NX_CRYPTO_CURVE25519_POINT *r, const NX_CRYPTO_CURVE25519_POINT *a)
+{
+NX_CRYPTO_CURVE25519_LIMB xx[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB yy[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB b[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB x[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB y[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB z[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB t[NX_CRYPTO_CURVE25519_LIMBS];
+
+    _nx_crypto_curve25519_fe_sqr(xx, a -> nx_crypto_curve25519_point_x);
+    _nx_crypto_curve25519_fe_sqr(yy, a -> nx_crypto_curve25519_point_y);
+    _nx_crypto_curve25519_fe_sqr_double(b, a -> nx_crypto_curve25519_point_z);
+    _nx_crypto_curve25519_fe_add(t, a -> nx_crypto_curve25519_point_x, a -> nx_crypto_curve25519_point_y);
+    _nx_crypto_curve25519_fe_sqr(x, t);
+
+    /* Y' = Y^2 + X^2, Z' = Y^2 - X^2, X' = (X + Y)^2 - Y', T' = 2 * Z^2 - Z'. */
+    _nx_crypto_curve25519_fe_add(y, yy, xx);
+    _nx_crypto_curve25519_fe_sub(z, yy, xx);
+    _nx_crypto_curve25519_fe_sub(x, x, y);
+    _nx_crypto_curve25519_fe_sub(t, b, z);
+
+    _nx_crypto_curve25519_point_complete(r, x, y, z, t);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_to_cached               PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function converts a point to the cached form used as the       */
+/*    second operand of an addition.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Point a                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMCPY                      Copy data                     */
+/*    _nx_crypto_curve25519_fe_add          Addition                      */
+/*    _nx_crypto_curve25519_fe_sub          Subtraction                   */
+/*    _nx_crypto_curve25519_fe_from_words   Load from words               */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_point_to_cached(NX_CRYPTO_CURVE25519_CACHED *r, const NX_CRYPTO_CURVE25519_POINT *a)
+{
+NX_CRYPTO_CURVE25519_LIMB d2[NX_CRYPTO_CURVE25519_LIMBS];
+
+    _nx_crypto_curve25519_fe_add(r -> nx_crypto_curve25519_cached_ypx, a -> nx_crypto_curve25519_point_y,
+                                 a -> nx_crypto_curve25519_point_x);
+    _nx_crypto_curve25519_fe_sub(r -> nx_crypto_curve25519_cached_ymx, a -> nx_crypto_curve25519_point_y,
+                                 a -> nx_crypto_curve25519_point_x);
+    NX_CRYPTO_MEMCPY(r -> nx_crypto_curve25519_cached_z, a -> nx_crypto_curve25519_point_z, sizeof(r -> nx_crypto_curve25519_cached_z)); /* Use case of memcpy is verified. */
+    _nx_crypto_curve25519_fe_from_words(d2, _nx_crypto_curve25519_d2);
+    _nx_crypto_curve25519_fe_mul(r -> nx_crypto_curve25519_cached_t2d, a -> nx_crypto_curve25519_point_t, d2);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_add_cached              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds or subtracts a point in cached form, using the   */
+/*    unified formula for a = -1. The formula is complete, so no special  */
+/*    case exists for equal points or the neutral element.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Point a                       */
+/*    b                                     Point b in cached form        */
+/*    negate                                Subtract b when nonzero       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_add          Addition                      */
+/*    _nx_crypto_curve25519_fe_sub          Subtraction                   */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*    _nx_crypto_curve25519_point_complete  Convert to extended           */
+/*                                            coordinates                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_point_add_cached(NX_CRYPTO_CURVE25519_POINT *r,
+                                                   const NX_CRYPTO_CURVE25519_POINT *a,
+                                                   const NX_CRYPTO_CURVE25519_CACHED *b, UINT negate)
+{
+NX_CRYPTO_CURVE25519_LIMB pa[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB pb[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB c[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB d[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB x[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB y[NX_CRYPTO_CURVE25519_LIMBS];
+
+    _nx_crypto_curve25519_fe_add(x, a -> nx_crypto_curve25519_point_y, a -> nx_crypto_curve25519_point_x);
+    _nx_crypto_curve25519_fe_sub(y, a -> nx_crypto_curve25519_point_y, a -> nx_crypto_curve25519_point_x);
+
+    /* -(x, y) = (-x, y) swaps y + x with y - x and negates T. */
+    if (negate)
+    {
+        _nx_crypto_curve25519_fe_mul(pa, x, b -> nx_crypto_curve25519_cached_ymx);
+        _nx_crypto_curve25519_fe_mul(pb, y, b -> nx_crypto_curve25519_cached_ypx);
+    }
+    else
+    {
+        _nx_crypto_curve25519_fe_mul(pa, x, b -> nx_crypto_curve25519_cached_ypx);
+        _nx_crypto_curve25519_fe_mul(pb, y, b -> nx_crypto_curve25519_cached_ymx);
+    }
+    _nx_crypto_curve25519_fe_mul(c, a -> nx_crypto_curve25519_point_t, b -> nx_crypto_curve25519_cached_t2d);
+    _nx_crypto_curve25519_fe_mul(d, a -> nx_crypto_curve25519_point_z, b -> nx_crypto_curve25519_cached_z);
+    _nx_crypto_curve25519_fe_add(d, d, d);
+
+    _nx_crypto_curve25519_fe_sub(x, pa, pb);
+    _nx_crypto_curve25519_fe_add(y, pa, pb);
+    if (negate)
+    {
+        _nx_crypto_curve25519_fe_sub(pa, d, c);
+        _nx_crypto_curve25519_fe_add(pb, d, c);
+    }
+    else
+    {
+        _nx_crypto_curve25519_fe_add(pa, d, c);
+        _nx_crypto_curve25519_fe_sub(pb, d, c);
+    }
+
+    _nx_crypto_curve25519_point_complete(r, x, y, pa, pb);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_add_precomputed         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds or subtracts a precomputed affine point, saving  */
+/*    one multiplication over the cached form.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Point a                       */
+/*    b                                     Precomputed point b           */
+/*    negate                                Subtract b when nonzero       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_add          Addition                      */
+/*    _nx_crypto_curve25519_fe_sub          Subtraction                   */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*    _nx_crypto_curve25519_point_complete  Convert to extended           */
+/*                                            coordinates                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_point_add_precomputed(NX_CRYPTO_CURVE25519_POINT *r,
+                                                        const NX_CRYPTO_CURVE25519_POINT *a,
+                                                        const NX_CRYPTO_CURVE25519_PRECOMPUTED *b, UINT negate)
+{
+NX_CRYPTO_CURVE25519_LIMB pa[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB pb[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB c[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB d[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB x[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB y[NX_CRYPTO_CURVE25519_LIMBS];
+
+    _nx_crypto_curve25519_fe_add(x, a -> nx_crypto_curve25519_point_y, a -> nx_crypto_curve25519_point_x);
+    _nx_crypto_curve25519_fe_sub(y, a -> nx_crypto_curve25519_point_y, a -> nx_crypto_curve25519_point_x);
+
+    if (negate)
+    {
+        _nx_crypto_curve25519_fe_mul(pa, x, b -> nx_crypto_curve25519_precomputed_ymx);
+        _nx_crypto_curve25519_fe_mul(pb, y, b -> nx_crypto_curve25519_precomputed_ypx);
+    }
+    else
+    {
+        _nx_crypto_curve25519_fe_mul(pa, x, b -> nx_crypto_curve25519_precomputed_ypx);
+        _nx_crypto_curve25519_fe_mul(pb, y, b -> nx_crypto_curve25519_precomputed_ymx);
+    }
+    _nx_crypto_curve25519_fe_mul(c, a -> nx_crypto_curve25519_point_t, b -> nx_crypto_curve25519_precomputed_xy2d);
+    _nx_crypto_curve25519_fe_add(d, a -> nx_crypto_curve25519_point_z, a -> nx_crypto_curve25519_point_z);
+
+    _nx_crypto_curve25519_fe_sub(x, pa, pb);
+    _nx_crypto_curve25519_fe_add(y, pa, pb);
+    if (negate)
+    {
+        _nx_crypto_curve25519_fe_sub(pa, d, c);
+        _nx_crypto_curve25519_fe_add(pb, d, c);
+    }
+    else
+    {
+        _nx_crypto_curve25519_fe_add(pa, d, c);
+        _nx_crypto_curve25519_fe_sub(pb, d, c);
+    }
+
+    _nx_crypto_curve25519_point_complete(r, x, y, pa, pb);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_precomputed_load              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function loads a precomputed point from a table entry of 24    */
+/*    little endian words.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    w                                     Table entry                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_from_words   Load from words               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_precomputed_load(NX_CRYPTO_CURVE25519_PRECOMPUTED *r, const UINT *w)
+{
+    _nx_crypto_curve25519_fe_from_words(r -> nx_crypto_curve25519_precomputed_ypx, w);
+    _nx_crypto_curve25519_fe_from_words(r -> nx_crypto_curve25519_precomputed_ymx, w + 8);
+    _nx_crypto_curve25519_fe_from_words(r -> nx_crypto_curve25519_precomputed_xy2d, w + 16);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_comb_select                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function loads entry index - 1 of a comb table, or the         */
+/*    neutral element when index is zero. Every entry is read so that     */
+/*    the memory access pattern does not depend on the secret index.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    table                                 Comb table                    */
+/*    index                                 Comb index, 0 to 31           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_precomputed_load                              */
+/*                                          Load precomputed point        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_comb_select(NX_CRYPTO_CURVE25519_PRECOMPUTED *r, const UINT (*table)[24],
+                                              UINT index)
+{
+UINT w[24];
+UINT mask;
+UINT e, i;
+
+    /* The neutral element is (1, 1, 0). */
+    mask = ((index | (0 - index)) >> 31) - 1;
+    for (i = 0; i < 24; i++)
+    {
+        w[i] = 0;
+    }
+    w[0] = mask & 1;
+    w[8] = mask & 1;
+
+    for (e = 1; e < (1u << NX_CRYPTO_CURVE25519_COMB_WIDTH); e++)
+    {
+        mask = index ^ e;
+        mask = ((mask | (0 - mask)) >> 31) - 1;
+        for (i = 0; i < 24; i++)
+        {
+            w[i] |= table[e - 1][i] & mask;
+        }
+    }
+
+    _nx_crypto_curve25519_precomputed_load(r, w);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_scalar_bit                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns bit position of a 32-byte little endian       */
+/*    scalar, or zero beyond bit 255.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    k                                     Scalar                        */
+/*    position                              Bit position                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    bit                                   Zero or one                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_curve25519_scalar_bit(const UCHAR *k, UINT position)
+{
+    if (position >= 256)
+    {
+        return(0);
+    }
+
+    return((k[position >> 3] >> (position & 7)) & 1);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_base_multiple           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes k * B for the base point B in constant time  */
+/*    with a fixed base comb. The scalar is split into five rows of 52    */
+/*    bits, and two tables for the columns at 0 and 26 halve the number   */
+/*    of doublings to 26.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    k                                     32-byte little endian scalar  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_set_identity                            */
+/*                                          Set neutral element           */
+/*    _nx_crypto_curve25519_point_double    Point doubling                */
+/*    _nx_crypto_curve25519_scalar_bit      Get scalar bit                */
+/*    _nx_crypto_curve25519_comb_select     Constant time table lookup    */
+/*    _nx_crypto_curve25519_point_add_precomputed                         */
+/*                                          Add precomputed point         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_base_multiple       X25519 with base point        */
+/*    _nx_crypto_ed25519_sign               Sign message                  */
+/*    _nx_crypto_ed25519_public_key_generate                              */
+/*                                          Generate public key           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_point_base_multiple(NX_CRYPTO_CURVE25519_POINT *r, const UCHAR *k)
+{
+NX_CRYPTO_CURVE25519_PRECOMPUTED pre;
+UINT                             index1, index2;
+UINT                             i, j;
+
+    _nx_crypto_curve25519_point_set_identity(r);
+
+    for (i = NX_CRYPTO_CURVE25519_COMB_E; i > 0; i--)
+    {
+        _nx_crypto_curve25519_point_double(r, r);
+
+        index1 = 0;
+        index2 = 0;
+        for (j = 0; j < NX_CRYPTO_CURVE25519_COMB_WIDTH; j++)
+        {
+            index1 |= _nx_crypto_curve25519_scalar_bit(k, i - 1 + j * NX_CRYPTO_CURVE25519_COMB_D) << j;
+            index2 |= _nx_crypto_curve25519_scalar_bit(k, i - 1 + NX_CRYPTO_CURVE25519_COMB_E +
+                                                       j * NX_CRYPTO_CURVE25519_COMB_D) << j;
+        }
+
+        _nx_crypto_curve25519_comb_select(&pre, _nx_crypto_curve25519_comb, index1);
+        _nx_crypto_curve25519_point_add_precomputed(r, r, &pre, NX_CRYPTO_FALSE);
+        _nx_crypto_curve25519_comb_select(&pre, _nx_crypto_curve25519_comb_2e, index2);
+        _nx_crypto_curve25519_point_add_precomputed(r, r, &pre, NX_CRYPTO_FALSE);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_scalar_slide                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function recodes a scalar below 2^255 into signed odd digits   */
+/*    between -15 and 15 with at least four zeros between nonzero         */
+/*    digits.                                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Signed digits, one per bit    */
+/*    k                                     32-byte little endian scalar  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_scalar_bit      Get scalar bit                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_curve25519_scalar_slide(CHAR *r, const UCHAR *k)
+{
+INT  value;
+UINT i, b, j;
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_SLIDE_BITS; i++)
+    {
+        r[i] = (CHAR)_nx_crypto_curve25519_scalar_bit(k, i);
+    }
+
+    for (i = 0; i < NX_CRYPTO_CURVE25519_SLIDE_BITS; i++)
+    {
+        if (r[i] == 0)
+        {
+            continue;
+        }
+
+        for (b = 1; (b <= 6) && ((i + b) < NX_CRYPTO_CURVE25519_SLIDE_BITS); b++)
+        {
+            if (r[i + b] == 0)
+            {
+                continue;
+            }
+
+            value = r[i + b] * (1 << b);
+            if ((r[i] + value) <= 15)
+            {
+                r[i] = (CHAR)(r[i] + value);
+                r[i + b] = 0;
+            }
+            else if ((r[i] - value) >= -15)
+            {
+                r[i] = (CHAR)(r[i] - value);
+
+                /* Propagate the carry. */
+                for (j = i + b; j < NX_CRYPTO_CURVE25519_SLIDE_BITS; j++)
+                {
+                    if (r[j] == 0)
+                    {
+                        r[j] = 1;
+                        break;
+                    }
+                    r[j] = 0;
+                }
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_base_multiple_add       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes k1 * B + k2 * q with Shamir's trick over     */
+/*    signed sliding windows. Odd multiples of B come from a table, odd   */
+/*    multiples of q are computed on the fly. It is not constant time     */
+/*    and must only be used with public scalars, as in signature          */
+/*    verification.                                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    k1                                    Scalar of B, below 2^255      */
+/*    q                                     Point q                       */
+/*    k2                                    Scalar of q, below 2^255      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMCPY                      Copy data                     */
+/*    _nx_crypto_curve25519_scalar_slide    Recode scalar                 */
+/*    _nx_crypto_curve25519_point_to_cached                               */
+/*                                          Convert to cached form        */
+/*    _nx_crypto_curve25519_point_double    Point doubling                */
+/*    _nx_crypto_curve25519_point_add_cached                              */
+/*                                          Add cached point              */
+/*    _nx_crypto_curve25519_point_set_identity                            */
+/*                                          Set neutral element           */
+/*    _nx_crypto_curve25519_precomputed_load                              */
+/*                                          Load precomputed point        */
+/*    _nx_crypto_curve25519_point_add_precomputed                         */
+/*                                          Add precomputed point         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ed25519_verify             Verify signature              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_point_base_multiple_add(NX_CRYPTO_CURVE25519_POINT *r, const UCHAR *k1,
+                                                   const NX_CRYPTO_CURVE25519_POINT *q, const UCHAR *k2)
+{
+CHAR                             slide1[NX_CRYPTO_CURVE25519_SLIDE_BITS];
+CHAR                             slide2[NX_CRYPTO_CURVE25519_SLIDE_BITS];
+NX_CRYPTO_CURVE25519_CACHED      table[8];
+NX_CRYPTO_CURVE25519_CACHED      q2;
+NX_CRYPTO_CURVE25519_POINT       t;
+NX_CRYPTO_CURVE25519_PRECOMPUTED pre;
+INT                              i;
+UINT                             j;
+
+    _nx_crypto_curve25519_scalar_slide(slide1, k1);
+    _nx_crypto_curve25519_scalar_slide(slide2, k2);
+
+    /* table[j] = (2 * j + 1) * q */
+    _nx_crypto_curve25519_point_to_cached(&table[0], q);
+    _nx_crypto_curve25519_point_double(&t, q);
+    _nx_crypto_curve25519_point_to_cached(&q2, &t);
+    NX_CRYPTO_MEMCPY(&t, q, sizeof(t)); /* Use case of memcpy is verified. */
+    for (j = 1; j < 8; j++)
+    {
+        _nx_crypto_curve25519_point_add_cached(&t, &t, &q2, NX_CRYPTO_FALSE);
+        _nx_crypto_curve25519_point_to_cached(&table[j], &t);
+    }
+
+    for (i = NX_CRYPTO_CURVE25519_SLIDE_BITS - 1; i >= 0; i--)
+    {
+        if (slide1[i] || slide2[i])
+        {
+            break;
+        }
+    }
+
+    _nx_crypto_curve25519_point_set_identity(r);
+    for (; i >= 0; i--)
+    {
+        _nx_crypto_curve25519_point_double(r, r);
+
+        if (slide1[i] > 0)
+        {
+            _nx_crypto_curve25519_precomputed_load(&pre, _nx_crypto_curve25519_base_odd[slide1[i] >> 1]);
+            _nx_crypto_curve25519_point_add_precomputed(r, r, &pre, NX_CRYPTO_FALSE);
+        }
+        else if (slide1[i] < 0)
+        {
+            _nx_crypto_curve25519_precomputed_load(&pre, _nx_crypto_curve25519_base_odd[(-slide1[i]) >> 1]);
+            _nx_crypto_curve25519_point_add_precomputed(r, r, &pre, NX_CRYPTO_TRUE);
+        }
+
+        if (slide2[i] > 0)
+        {
+            _nx_crypto_curve25519_point_add_cached(r, r, &table[slide2[i] >> 1], NX_CRYPTO_FALSE);
+        }
+        else if (slide2[i] < 0)
+        {
+            _nx_crypto_curve25519_point_add_cached(r, r, &table[(-slide2[i]) >> 1], NX_CRYPTO_TRUE);
+        }
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_negate                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function negates a point in place.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    p                                     Point p                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_neg          Negation                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ed25519_verify             Verify signature              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_point_negate(NX_CRYPTO_CURVE25519_POINT *p)
+{
+    _nx_crypto_curve25519_fe_neg(p -> nx_crypto_curve25519_point_x, p -> nx_crypto_curve25519_point_x);
+    _nx_crypto_curve25519_fe_neg(p -> nx_crypto_curve25519_point_t, p -> nx_crypto_curve25519_point_t);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_encode                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encodes a point as 32 bytes: y in little endian with  */
+/*    the sign of x in the most significant bit, as defined in RFC 8032.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    bytes                                 Output buffer                 */
+/*    p                                     Point p                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_inverse      Modular inversion             */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*    _nx_crypto_curve25519_fe_to_bytes     Store canonical value         */
+/*    _nx_crypto_curve25519_fe_is_negative  Get sign                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ed25519_sign               Sign message                  */
+/*    _nx_crypto_ed25519_verify             Verify signature              */
+/*    _nx_crypto_ed25519_public_key_generate                              */
+/*                                          Generate public key           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_curve25519_point_encode(UCHAR *bytes, const NX_CRYPTO_CURVE25519_POINT *p)
+{
+NX_CRYPTO_CURVE25519_LIMB zinv[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB x[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB y[NX_CRYPTO_CURVE25519_LIMBS];
+
+    _nx_crypto_curve25519_fe_inverse(zinv, p -> nx_crypto_curve25519_point_z);
+    _nx_crypto_curve25519_fe_mul(x, p -> nx_crypto_curve25519_point_x, zinv);
+    _nx_crypto_curve25519_fe_mul(y, p -> nx_crypto_curve25519_point_y, zinv);
+    _nx_crypto_curve25519_fe_to_bytes(bytes, y);
+    bytes[31] = (UCHAR)(bytes[31] ^ (_nx_crypto_curve25519_fe_is_negative(x) << 7));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_curve25519_point_decode                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function decodes a point encoded as defined in RFC 8032. Non   */
+/*    canonical y, points not on the curve and the encoding of x = 0      */
+/*    with the sign bit set are rejected.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    bytes                                 Encoded point                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_curve25519_fe_from_bytes   Load from bytes               */
+/*    _nx_crypto_curve25519_fe_from_words   Load from words               */
+/*    _nx_crypto_curve25519_fe_set_digit    Set small value               */
+/*    _nx_crypto_curve25519_fe_add          Addition                      */
+/*    _nx_crypto_curve25519_fe_sub          Subtraction                   */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*    _nx_crypto_curve25519_fe_sqr          Squaring                      */
+/*    _nx_crypto_curve25519_fe_pow22523     Compute a^((p - 5) / 8)       */
+/*    _nx_crypto_curve25519_fe_is_zero      Check for zero                */
+/*    _nx_crypto_curve25519_fe_is_negative  Get sign                      */
+/*    _nx_crypto_curve25519_fe_neg          Negation                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ed25519_verify             Verify signature              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_crypto_curve25519_point_decode(NX_CRYPTO_CURVE25519_POINT *r, const UCHAR *bytes)
+{
+NX_CRYPTO_CURVE25519_LIMB u[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB v[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB v3[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB t[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB check[NX_CRYPTO_CURVE25519_LIMBS];
+UINT                      sign = (UINT)bytes[31] >> 7;
+UINT                      value;
+UINT                      i;
+
+    /* Reject y >= p, which is 0x7FFF...FFED. */
+    value = (bytes[31] & 0x7F) ^ 0x7F;
+    for (i = 1; i < 31; i++)
+    {
+        value |= bytes[i] ^ 0xFF;
+    }
+    if ((value == 0) && (bytes[0] >= 0xED))
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    _nx_crypto_curve25519_fe_from_bytes(r -> nx_crypto_curve25519_point_y, bytes);
+    _nx_crypto_curve25519_fe_set_digit(r -> nx_crypto_curve25519_point_z, 1);
+
+    /* u = y^2 - 1, v = d * y^2 + 1. */
+    _nx_crypto_curve25519_fe_sqr(u, r -> nx_crypto_curve25519_point_y);
+    _nx_crypto_curve25519_fe_from_words(t, _nx_crypto_curve25519_d);
+    _nx_crypto_curve25519_fe_mul(v, u, t);
+    _nx_crypto_curve25519_fe_sub(u, u, r -> nx_crypto_curve25519_point_z);
+    _nx_crypto_curve25519_fe_add(v, v, r -> nx_crypto_curve25519_point_z);
+
+    /* x = u * v^3 * (u * v^7)^((p - 5) / 8) */
+    _nx_crypto_curve25519_fe_sqr(t, v);
+    _nx_crypto_curve25519_fe_mul(v3, t, v);
+    _nx_crypto_curve25519_fe_sqr(t, v3);
+    _nx_crypto_curve25519_fe_mul(t, t, v);
+    _nx_crypto_curve25519_fe_mul(t, t, u);
+    _nx_crypto_curve25519_fe_pow22523(t, t);
+    _nx_crypto_curve25519_fe_mul(t, t, v3);
+    _nx_crypto_curve25519_fe_mul(r -> nx_crypto_curve25519_point_x, t, u);
+
+    /* Check v * x^2 = u, or v * x^2 = -u in which case x is multiplied by sqrt(-1). */
+    _nx_crypto_curve25519_fe_sqr(t, r -> nx_crypto_curve25519_point_x);
+    _nx_crypto_curve25519_fe_mul(t, t, v);
+    _nx_crypto_curve25519_fe_sub(check, t, u);
+    if (!_nx_crypto_curve25519_fe_is_zero(check))
+    {
+        _nx_crypto_curve25519_fe_add(check, t, u);
+        if (!_nx_crypto_curve25519_fe_is_zero(check))
+        {
+            return(NX_CRYPTO_NOT_SUCCESSFUL);
+        }
+        _nx_crypto_curve25519_fe_from_words(t, _nx_crypto_curve25519_sqrtm1);
+        _nx_crypto_curve25519_fe_mul(r -> nx_crypto_curve25519_point_x, r -> nx_crypto_curve25519_point_x, t);
+    }
+
+    if (_nx_crypto_curve25519_fe_is_zero(r -> nx_crypto_curve25519_point_x) && sign)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+    if (_nx_crypto_curve25519_fe_is_negative(r -> nx_crypto_curve25519_point_x) != sign)
+    {
+        _nx_crypto_curve25519_fe_neg(r -> nx_crypto_curve25519_point_x, r -> nx_crypto_curve25519_point_x);
+    }
+
+    _nx_crypto_curve25519_fe_mul(r -> nx_crypto_curve25519_point_t, r -> nx_crypto_curve25519_point_x,
+                                 r -> nx_crypto_curve25519_point_y);
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_multiple                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the X25519 function of RFC 7748 with the     */
+/*    Montgomery ladder in constant time. The scalar is clamped and the   */
+/*    most significant bit of u is ignored.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    result                                32-byte output u-coordinate   */
+/*    k                                     32-byte scalar                */
+/*    u                                     32-byte input u-coordinate    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMCPY                      Copy data                     */
+/*    _nx_crypto_curve25519_fe_from_bytes   Load from bytes               */
+/*    _nx_crypto_curve25519_fe_set_digit    Set small value               */
+/*    _nx_crypto_curve25519_fe_swap         Conditional swap              */
+/*    _nx_crypto_curve25519_fe_add          Addition                      */
+/*    _nx_crypto_curve25519_fe_sub          Subtraction                   */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*    _nx_crypto_curve25519_fe_sqr          Squaring                      */
+/*    _nx_crypto_curve25519_fe_mul_small    Multiplication by constant    */
+/*    _nx_crypto_curve25519_fe_inverse      Modular inversion             */
+/*    _nx_crypto_curve25519_fe_to_bytes     Store canonical value         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ecdh_compute_secret        Compute ECDH shared secret    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_x25519_multiple(UCHAR *result, const UCHAR *k, const UCHAR *u)
+{
+NX_CRYPTO_CURVE25519_LIMB x1[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB x2[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB z2[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB x3[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB z3[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB a[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB aa[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB b[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB bb[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB c[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB d[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB e[NX_CRYPTO_CURVE25519_LIMBS];
+UCHAR                     scalar[NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES];
+UINT                      swap = 0;
+UINT                      bit;
+INT                       i;
+
+    NX_CRYPTO_MEMCPY(scalar, k, sizeof(scalar)); /* Use case of memcpy is verified. */
+    scalar[0] &= 248;
+    scalar[31] &= 127;
+    scalar[31] |= 64;
+
+    _nx_crypto_curve25519_fe_from_bytes(x1, u);
+    _nx_crypto_curve25519_fe_set_digit(x2, 1);
+    _nx_crypto_curve25519_fe_set_digit(z2, 0);
+    NX_CRYPTO_MEMCPY(x3, x1, sizeof(x3)); /* Use case of memcpy is verified. */
+    _nx_crypto_curve25519_fe_set_digit(z3, 1);
+
+    for (i = 254; i >= 0; i--)
+    {
+        bit = (scalar[i >> 3] >> (i & 7)) & 1;
+        swap ^= bit;
+        _nx_crypto_curve25519_fe_swap(x2, x3, swap);
+        _nx_crypto_curve25519_fe_swap(z2, z3, swap);
+        swap = bit;
+
+        _nx_crypto_curve25519_fe_add(a, x2, z2);
+        _nx_crypto_curve25519_fe_sqr(aa, a);
+        _nx_crypto_curve25519_fe_sub(b, x2, z2);
+        _nx_crypto_curve25519_fe_sqr(bb, b);
+        _nx_crypto_curve25519_fe_sub(e, aa, bb);
+        _nx_crypto_curve25519_fe_add(c, x3, z3);
+        _nx_crypto_curve25519_fe_sub(d, x3, z3);
+        _nx_crypto_curve25519_fe_mul(d, d, a);
+        _nx_crypto_curve25519_fe_mul(c, c, b);
+
+        /* x3 = (DA + CB)^2, z3 = x1 * (DA - CB)^2 */
+        _nx_crypto_curve25519_fe_add(x3, d, c);
+        _nx_crypto_curve25519_fe_sqr(x3, x3);
+        _nx_crypto_curve25519_fe_sub(z3, d, c);
+        _nx_crypto_curve25519_fe_sqr(z3, z3);
+        _nx_crypto_curve25519_fe_mul(z3, z3, x1);
+
+        /* x2 = AA * BB, z2 = E * (AA + a24 * E) */
+        _nx_crypto_curve25519_fe_mul(x2, aa, bb);
+        _nx_crypto_curve25519_fe_mul_small(z2, e, 121665);
+        _nx_crypto_curve25519_fe_add(z2, z2, aa);
+        _nx_crypto_curve25519_fe_mul(z2, z2, e);
+    }
+
+    _nx_crypto_curve25519_fe_swap(x2, x3, swap);
+    _nx_crypto_curve25519_fe_swap(z2, z3, swap);
+
+    _nx_crypto_curve25519_fe_inverse(z2, z2);
+    _nx_crypto_curve25519_fe_mul(x2, x2, z2);
+    _nx_crypto_curve25519_fe_to_bytes(result, x2);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_base_multiple                     PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes X25519 of the base point u = 9. The          */
+/*    multiplication runs on the birationally equivalent Edwards curve    */
+/*    with the fixed base comb, which is several times faster than the    */
+/*    ladder, and the result is mapped back with u = (1 + y) / (1 - y).   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    result                                32-byte output u-coordinate   */
+/*    k                                     32-byte scalar                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMCPY                      Copy data                     */
+/*    _nx_crypto_curve25519_point_base_multiple                           */
+/*                                          Fixed base multiplication     */
+/*    _nx_crypto_curve25519_fe_add          Addition                      */
+/*    _nx_crypto_curve25519_fe_sub          Subtraction                   */
+/*    _nx_crypto_curve25519_fe_inverse      Modular inversion             */
+/*    _nx_crypto_curve25519_fe_mul          Multiplication                */
+/*    _nx_crypto_curve25519_fe_to_bytes     Store canonical value         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ecdh_setup                 Generate ECDH key pair        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_crypto_x25519_base_multiple(UCHAR *result, const UCHAR *k)
+{
+NX_CRYPTO_CURVE25519_POINT p;
+NX_CRYPTO_CURVE25519_LIMB  n[NX_CRYPTO_CURVE25519_LIMBS];
+NX_CRYPTO_CURVE25519_LIMB  d[NX_CRYPTO_CURVE25519_LIMBS];
+UCHAR                      scalar[NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES];
+
+    NX_CRYPTO_MEMCPY(scalar, k, sizeof(scalar)); /* Use case of memcpy is verified. */
+    scalar[0] &= 248;
+    scalar[31] &= 127;
+    scalar[31] |= 64;
+
+    _nx_crypto_curve25519_point_base_multiple(&p, scalar);
+
+    /* u = (Z + Y) / (Z - Y) */
+    _nx_crypto_curve25519_fe_add(n, p.nx_crypto_curve25519_point_z, p.nx_crypto_curve25519_point_y);
+    _nx_crypto_curve25519_fe_sub(d, p.nx_crypto_curve25519_point_z, p.nx_crypto_curve25519_point_y);
+    _nx_crypto_curve25519_fe_inverse(d, d);
+    _nx_crypto_curve25519_fe_mul(n, n, d);
+    _nx_crypto_curve25519_fe_to_bytes(result, n);
+}
@@ -370,6 +370,60 @@ static NX_CRYPTO_CONST HN_UBASE _nx_crypto_ec_secp521r1_h[] =
     HN_ULONG_TO_UBASE(0x00000001)
 };
 
+/* Curve25519, used by X25519 only. The Montgomery form v^2 = u^3 + A * u^2 + u is stored with
+   a = A and b = 1. Arithmetic on this curve is done by nx_crypto_curve25519.c. */
+static NX_CRYPTO_CONST HN_UBASE _nx_crypto_ec_x25519_p[] =
+{
+
+    /* p = 7FFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFED */
+    HN_ULONG_TO_UBASE(0xFFFFFFED), HN_ULONG_TO_UBASE(0xFFFFFFFF),
+    HN_ULONG_TO_UBASE(0xFFFFFFFF), HN_ULONG_TO_UBASE(0xFFFFFFFF),
+    HN_ULONG_TO_UBASE(0xFFFFFFFF), HN_ULONG_TO_UBASE(0xFFFFFFFF),
+    HN_ULONG_TO_UBASE(0xFFFFFFFF), HN_ULONG_TO_UBASE(0x7FFFFFFF)
+};
+static NX_CRYPTO_CONST HN_UBASE _nx_crypto_ec_x25519_a[] =
+{
+
+    /* A = 076D06 */
+    HN_ULONG_TO_UBASE(0x00076D06)
+};
+static NX_CRYPTO_CONST HN_UBASE _nx_crypto_ec_x25519_b[] =
+{
+
+    /* B = 01 */
+    HN_ULONG_TO_UBASE(0x00000001)
+};
+static NX_CRYPTO_CONST HN_UBASE _nx_crypto_ec_x25519_gx[] =
+{
+
+    /* G.u = 09 */
+    HN_ULONG_TO_UBASE(0x00000009)
+};
+static NX_CRYPTO_CONST HN_UBASE _nx_crypto_ec_x25519_gy[] =
+{
+
+    /* G.v = 20AE19A1 B8A086B4 E01EDD2C 7748D14C 923D4D7E 6D7C61B2 29E9C5A2 7ECED3D9 */
+    HN_ULONG_TO_UBASE(0x7ECED3D9), HN_ULONG_TO_UBASE(0x29E9C5A2),
+    HN_ULONG_TO_UBASE(0x6D7C61B2), HN_ULONG_TO_UBASE(0x923D4D7E),
+    HN_ULONG_TO_UBASE(0x7748D14C), HN_ULONG_TO_UBASE(0xE01EDD2C),
+    HN_ULONG_TO_UBASE(0xB8A086B4), HN_ULONG_TO_UBASE(0x20AE19A1)
+};
+static NX_CRYPTO_CONST HN_UBASE _nx_crypto_ec_x25519_n[] =
+{
+
+    /* n = 10000000 00000000 00000000 00000000 14DEF9DE A2F79CD6 5812631A 5CF5D3ED */
+    HN_ULONG_TO_UBASE(0x5CF5D3ED), HN_ULONG_TO_UBASE(0x5812631A),
+    HN_ULONG_TO_UBASE(0xA2F79CD6), HN_ULONG_TO_UBASE(0x14DEF9DE),
+    HN_ULONG_TO_UBASE(0x00000000), HN_ULONG_TO_UBASE(0x00000000),
+    HN_ULONG_TO_UBASE(0x00000000), HN_ULONG_TO_UBASE(0x10000000)
+};
+static NX_CRYPTO_CONST HN_UBASE _nx_crypto_ec_x25519_h[] =
+{
+
+    /* h = 08 */
+    HN_ULONG_TO_UBASE(0x00000008)
+};
+
 extern NX_CRYPTO_CONST NX_CRYPTO_EC_FIXED_POINTS _nx_crypto_ec_secp192r1_fixed_points;
 extern NX_CRYPTO_CONST NX_CRYPTO_EC_FIXED_POINTS _nx_crypto_ec_secp224r1_fixed_points;
 extern NX_CRYPTO_CONST NX_CRYPTO_EC_FIXED_POINTS _nx_crypto_ec_secp256r1_fixed_points;
@@ -435,7 +489,8 @@ NX_CRYPTO_CONST NX_CRYPTO_EC                     _nx_crypto_ec_secp192r1 =
     _nx_crypto_ec_fp_affine_add,
     _nx_crypto_ec_fp_affine_subtract,
     _nx_crypto_ec_fp_projective_multiple,
-    _nx_crypto_ec_secp192r1_reduce
+    _nx_crypto_ec_secp192r1_reduce,
+    NX_CRYPTO_NULL
 };
 
 NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp224r1 =
@@ -497,7 +552,8 @@ NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp224r1 =
     _nx_crypto_ec_fp_affine_add,
     _nx_crypto_ec_fp_affine_subtract,
     _nx_crypto_ec_fp_projective_multiple,
-    _nx_crypto_ec_secp224r1_reduce
+    _nx_crypto_ec_secp224r1_reduce,
+    NX_CRYPTO_NULL
 };
 
 NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp256r1 =
@@ -558,8 +614,15 @@ NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp256r1 =
     (NX_CRYPTO_EC_FIXED_POINTS *)&_nx_crypto_ec_secp256r1_fixed_points,
     _nx_crypto_ec_fp_affine_add,
     _nx_crypto_ec_fp_affine_subtract,
+#ifndef NX_CRYPTO_ECC_DISABLE_SECP256R1_BACKEND
+    _nx_crypto_ec_secp256r1_multiple,
+    _nx_crypto_ec_secp256r1_reduce,
+    _nx_crypto_ec_secp256r1_multiple_add
+#else
     _nx_crypto_ec_fp_projective_multiple,
-    _nx_crypto_ec_secp256r1_reduce
+    _nx_crypto_ec_secp256r1_reduce,
+    NX_CRYPTO_NULL
+#endif /* NX_CRYPTO_ECC_DISABLE_SECP256R1_BACKEND */
 };
 
 NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp384r1 =
@@ -621,7 +684,8 @@ NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp384r1 =
     _nx_crypto_ec_fp_affine_add,
     _nx_crypto_ec_fp_affine_subtract,
     _nx_crypto_ec_fp_projective_multiple,
-    _nx_crypto_ec_secp384r1_reduce
+    _nx_crypto_ec_secp384r1_reduce,
+    NX_CRYPTO_NULL
 };
 
 NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp521r1 =
@@ -683,7 +747,71 @@ NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_secp521r1 =
     _nx_crypto_ec_fp_affine_add,
     _nx_crypto_ec_fp_affine_subtract,
     _nx_crypto_ec_fp_projective_multiple,
-    _nx_crypto_ec_secp521r1_reduce
+    _nx_crypto_ec_secp521r1_reduce,
+    NX_CRYPTO_NULL
+};
+
+NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_x25519 =
+{
+    "x25519",
+    NX_CRYPTO_EC_X25519,
+    4,
+    255,
+    {
+        .fp =
+        {
+            (HN_UBASE *)_nx_crypto_ec_x25519_p,
+            sizeof(_nx_crypto_ec_x25519_p) >> HN_SIZE_SHIFT,
+            sizeof(_nx_crypto_ec_x25519_p),
+            (UINT)NX_CRYPTO_FALSE
+        }
+    },
+    {
+        (HN_UBASE *)_nx_crypto_ec_x25519_a,
+        sizeof(_nx_crypto_ec_x25519_a) >> HN_SIZE_SHIFT,
+        sizeof(_nx_crypto_ec_x25519_a),
+        (UINT)NX_CRYPTO_FALSE
+    },
+    {
+        (HN_UBASE *)_nx_crypto_ec_x25519_b,
+        sizeof(_nx_crypto_ec_x25519_b) >> HN_SIZE_SHIFT,
+        sizeof(_nx_crypto_ec_x25519_b),
+        (UINT)NX_CRYPTO_FALSE
+    },
+    {
+        NX_CRYPTO_EC_POINT_AFFINE,
+        {
+            (HN_UBASE *)_nx_crypto_ec_x25519_gx,
+            sizeof(_nx_crypto_ec_x25519_gx) >> HN_SIZE_SHIFT,
+            sizeof(_nx_crypto_ec_x25519_gx),
+            (UINT)NX_CRYPTO_FALSE
+        },
+        {
+            (HN_UBASE *)_nx_crypto_ec_x25519_gy,
+            sizeof(_nx_crypto_ec_x25519_gy) >> HN_SIZE_SHIFT,
+            sizeof(_nx_crypto_ec_x25519_gy),
+            (UINT)NX_CRYPTO_FALSE
+        },
+        {(HN_UBASE *)NX_CRYPTO_NULL, 0u, 0u, 0u}
+    },
+    {
+        (HN_UBASE *)_nx_crypto_ec_x25519_n,
+        sizeof(_nx_crypto_ec_x25519_n) >> HN_SIZE_SHIFT,
+        sizeof(_nx_crypto_ec_x25519_n),
+        (UINT)NX_CRYPTO_FALSE
+    },
+    {
+        (HN_UBASE *)_nx_crypto_ec_x25519_h,
+        sizeof(_nx_crypto_ec_x25519_h) >> HN_SIZE_SHIFT,
+        sizeof(_nx_crypto_ec_x25519_h),
+        (UINT)NX_CRYPTO_FALSE
+    },
+    NX_CRYPTO_NULL,
+    NX_CRYPTO_NULL,
+    NX_CRYPTO_NULL,
+    NX_CRYPTO_NULL,
+    NX_CRYPTO_NULL,
+    NX_CRYPTO_NULL
 };
 #ifndef NX_CRYPTO_SELF_TEST
 static NX_CRYPTO_CONST NX_CRYPTO_EC *_nx_crypto_ec_named_curves[] =
@@ -4231,6 +4359,91 @@ NX_CRYPTO_KEEP UINT _nx_crypto_method_ec_secp521r1_operation(UINT op,
     return(NX_CRYPTO_SUCCESS);
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_ec_x25519_operation               PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the curve used by X25519.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    op                                    Operation                     */
+/*    handle                                Crypto handle                 */
+/*    method                                Cryption Method Object        */
+/*    key                                   Encryption Key                */
+/*    key_size_in_bits                      Key size in bits              */
+/*    input                                 Input data                    */
+/*    input_length_in_byte                  Input data size               */
+/*    iv_ptr                                Initial vector                */
+/*    output                                Output buffer                 */
+/*    output_length_in_byte                 Output buffer size            */
+/*    crypto_metadata                       Metadata area                 */
+/*    crypto_metadata_size                  Metadata area size            */
+/*    packet_ptr                            Pointer to packet             */
+/*    nx_crypto_hw_process_callback         Callback function pointer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_method_ec_x25519_operation(UINT op,
+                                                          VOID *handle,
+                                                          struct NX_CRYPTO_METHOD_STRUCT *method,
+                                                          UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                          UCHAR *input, ULONG input_length_in_byte,
+                                                          UCHAR *iv_ptr,
+                                                          UCHAR *output, ULONG output_length_in_byte,
+                                                          VOID *crypto_metadata, ULONG crypto_metadata_size,
+                                                          VOID *packet_ptr,
+                                                          VOID (*nx_crypto_hw_process_callback)(VOID *, UINT))
+{
+    NX_CRYPTO_PARAMETER_NOT_USED(handle);
+    NX_CRYPTO_PARAMETER_NOT_USED(method);
+    NX_CRYPTO_PARAMETER_NOT_USED(key);
+    NX_CRYPTO_PARAMETER_NOT_USED(key_size_in_bits);
+    NX_CRYPTO_PARAMETER_NOT_USED(input);
+    NX_CRYPTO_PARAMETER_NOT_USED(input_length_in_byte);
+    NX_CRYPTO_PARAMETER_NOT_USED(iv_ptr);
+    NX_CRYPTO_PARAMETER_NOT_USED(output);
+    NX_CRYPTO_PARAMETER_NOT_USED(output_length_in_byte);
+    NX_CRYPTO_PARAMETER_NOT_USED(crypto_metadata);
+    NX_CRYPTO_PARAMETER_NOT_USED(crypto_metadata_size);
+    NX_CRYPTO_PARAMETER_NOT_USED(packet_ptr);
+    NX_CRYPTO_PARAMETER_NOT_USED(nx_crypto_hw_process_callback);
+
+    if (op != NX_CRYPTO_EC_CURVE_GET)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    *((NX_CRYPTO_EC **)output) = (NX_CRYPTO_EC *)&_nx_crypto_ec_x25519;
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
 
 /**************************************************************************/
 /*                                                                        */
@@ -0,0 +1,2372 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Elliptical Curve Cryptography                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#include "nx_crypto_ec.h"
+
+#ifndef NX_CRYPTO_ECC_DISABLE_SECP256R1_BACKEND
+
+#ifndef ULONG64
+#define ULONG64 unsigned long long
+#endif
+
+/* Field elements of secp256r1 are stored as eight 32-bit limbs, least significant limb first,
+   in Montgomery form (a * 2^256 mod p). All field operations keep the value fully reduced. */
+#define NX_CRYPTO_EC_SECP256R1_LIMBS          8
+
+/* Comb parameters for the base point: window width w, d = (256 + w - 1) / w, e = d / 2. */
+#define NX_CRYPTO_EC_SECP256R1_COMB_WIDTH     5
+#define NX_CRYPTO_EC_SECP256R1_COMB_D         52
+#define NX_CRYPTO_EC_SECP256R1_COMB_E         26
+
+/* Width of the signed window used for an unknown point. */
+#define NX_CRYPTO_EC_SECP256R1_WINDOW_WIDTH   4
+
+/* Width of the non-adjacent form used for signature verification. */
+#define NX_CRYPTO_EC_SECP256R1_WNAF_WIDTH     5
+
+/* Define point in Jacobian coordinates (X / Z^2, Y / Z^3). Z is zero for point at infinity. */
+typedef struct NX_CRYPTO_EC_SECP256R1_POINT_STRUCT
+{
+    UINT nx_crypto_ec_secp256r1_point_x[NX_CRYPTO_EC_SECP256R1_LIMBS];
+    UINT nx_crypto_ec_secp256r1_point_y[NX_CRYPTO_EC_SECP256R1_LIMBS];
+    UINT nx_crypto_ec_secp256r1_point_z[NX_CRYPTO_EC_SECP256R1_LIMBS];
+} NX_CRYPTO_EC_SECP256R1_POINT;
+
+/* p = 2^256 - 2^224 + 2^192 + 2^96 - 1 */
+static NX_CRYPTO_CONST UINT _nx_crypto_ec_secp256r1_fe_p[NX_CRYPTO_EC_SECP256R1_LIMBS] =
+{
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+/* 2^512 mod p, used to convert into Montgomery form. */
+static NX_CRYPTO_CONST UINT _nx_crypto_ec_secp256r1_fe_r2[NX_CRYPTO_EC_SECP256R1_LIMBS] =
+{
+    0x00000003, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFB,
+    0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFD, 0x00000004
+};
+
+/* 2^256 mod p, which is one in Montgomery form. */
+static NX_CRYPTO_CONST UINT _nx_crypto_ec_secp256r1_fe_one[NX_CRYPTO_EC_SECP256R1_LIMBS] =
+{
+    0x00000001, 0x00000000, 0x00000000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0x00000000
+};
+
+/* Precomputed affine points in Montgomery form, x followed by y.
+   Entry k - 1 of the comb table is the sum of 2^(52 * j) * G for every bit j set in k,
+   entry k - 1 of the 2e table is that point multiplied by 2^26. */
+static NX_CRYPTO_CONST UINT _nx_crypto_ec_secp256r1_comb[][16] =
+{
+
+    /* Entry 1 */
+    {
+        0x18A9143C, 0x79E730D4, 0x5FEDB601, 0x75BA95FC,
+        0x77622510, 0x79FB732B, 0xA53755C6, 0x18905F76,
+        0xCE95560A, 0xDDF25357, 0xBA19E45C, 0x8B4AB8E4,
+        0xDD21F325, 0xD2E88688, 0x25885D85, 0x8571FF18
+    },
+
+    /* Entry 2 */
+    {
+        0xCECA9754, 0x83F49167, 0x4B7939A0, 0x426D2CF6,
+        0x723FD0BF, 0x2555E355, 0xC4F144E2, 0xA96E6D06,
+        0x87880E61, 0x4768A8DD, 0xE508E4D5, 0x15543815,
+        0xB1B65E15, 0x09D7E772, 0xAC302FA0, 0x63439DD6
+    },
+
+    /* Entry 3 */
+    {
+        0xA0BE5D0E, 0xF2675562, 0x4D1BB068, 0x4B524D25,
+        0xA9B75B8C, 0xBC2C5FF2, 0xD9A6F548, 0x4F326643,
+        0x1258835E, 0x50DD6844, 0x676090E0, 0x7D21BEEE,
+        0xF4A17B42, 0xB0B62C65, 0xB3CEC3B0, 0x60DFAE28
+    },
+
+    /* Entry 4 */
+    {
+        0xCF7D62D2, 0x20D3C982, 0x23BA8150, 0x1F36E29D,
+        0x92763F9E, 0x48AE0BF0, 0x1D3A7007, 0x7A527E6B,
+        0x581A85E3, 0xB4A89097, 0xDC158BE5, 0x1F1A520F,
+        0x167D726E, 0xF98DB37D, 0x1113E862, 0x8802786E
+    },
+
+    /* Entry 5 */
+    {
+        0xB113F918, 0x531E7B64, 0x920A681D, 0x26B5D70A,
+        0x24C37044, 0x04E52F8F, 0xBB7C375B, 0xBC7C9542,
+        0xF2E26375, 0xB63A044B, 0xE922A3D0, 0xD842A342,
+        0xA9292D57, 0x9EED2ECA, 0x49AC7832, 0xFE27D2C2
+    },
+
+    /* Entry 6 */
+    {
+        0xF24AAB7E, 0xEDBD7944, 0xCD1A1921, 0x56E51D9E,
+        0x962DAE55, 0x11C63188, 0x326ACD14, 0x37090565,
+        0xD71ED134, 0xC436E587, 0xAD89B461, 0x3D96AC3A,
+        0xDCB718BB, 0xCDF570BC, 0xDCFABDE2, 0xAAA490E9
+    },
+
+    /* Entry 7 */
+    {
+        0x0B639942, 0xB0AB5401, 0x19379664, 0xA6E12F57,
+        0x1D040ABC, 0xC535F8B4, 0xA75EEF24, 0xEF255C54,
+        0xAECEB0EA, 0xB236F734, 0x9D879E2F, 0x38FCC8C1,
+        0x180CACAB, 0x674D8FDC, 0xF624DF06, 0x0A18BAD4
+    },
+
+    /* Entry 8 */
+    {
+        0xCA8D9D1A, 0x488F1185, 0xD987DED2, 0xADF2C77D,
+        0x60C46124, 0x5F3039F0, 0x71E095F4, 0xE5D70B75,
+        0x6260E70F, 0x82D58650, 0xF750D105, 0x39D75EA7,
+        0x75BAC364, 0x8CF3D0B1, 0x21D01329, 0xF3A7564D
+    },
+
+    /* Entry 9 */
+    {
+        0x60530D0A, 0x83FC8091, 0x7BC23DC8, 0x58C24F52,
+        0xA653AF5A, 0xECDE2F1F, 0xB10E511E, 0xB2E2A374,
+        0x9BEBE1E4, 0xF0C54B32, 0xADE42270, 0x239C25DF,
+        0x9F22B433, 0xD866F55E, 0xED17EFD3, 0x1E513CA2
+    },
+
+    /* Entry 10 */
+    {
+        0x5BC98E0D, 0x66313DC8, 0x9A256888, 0xB13FE4E6,
+        0xECD6E280, 0x74816589, 0x5BA88474, 0xDEE13CDE,
+        0xC53BC78D, 0xAE4E1872, 0x2F08A464, 0x9B79904A,
+        0x9DA51935, 0xEF6E5CE2, 0x083C47EA, 0x9E58DF82
+    },
+
+    /* Entry 11 */
+    {
+        0xF5A32632, 0x4E066713, 0x4B36F498, 0x431F75D4,
+        0x70BD5F07, 0x40AE279F, 0x239EC23D, 0x252CDB93,
+        0x7312A246, 0xC18DDDF8, 0x23A9E561, 0x5B77673C,
+        0x1715FEDE, 0x020F09C3, 0xA580CFC5, 0xABEF6451
+    },
+
+    /* Entry 12 */
+    {
+        0xF2A0D962, 0x3C8BC3BF, 0x3405A8AA, 0x59F856EE,
+        0xB3DC5948, 0x2FB6590C, 0xED85740E, 0xC8AA740C,
+        0xE9AAFE19, 0xF8081CFB, 0x2534800D, 0xF7D2E1F3,
+        0x8D78D247, 0x355148C2, 0xD1557399, 0xAF0DC5A4
+    },
+
+    /* Entry 13 */
+    {
+        0xC7F68782, 0x34DFBFC4, 0x08AC2685, 0x2C6A80D6,
+        0x08D0255B, 0x5479E1BC, 0x9110C616, 0x42EB9DE0,
+        0x10B4ACBA, 0x97991DD8, 0x94D997C7, 0xF36ACC8F,
+        0x69DDC036, 0xD05AD78B, 0xE68B4243, 0x1AC7E528
+    },
+
+    /* Entry 14 */
+    {
+        0xE82C8E2A, 0xDD9F8A00, 0x21F80126, 0x104B85C6,
+        0x5B17A522, 0x1997228D, 0x923D0BD0, 0x706E5EC3,
+        0x1DC33622, 0x00C6AF27, 0x271F09E1, 0xB3BC76C8,
+        0xE36E325A, 0xEC1B7C0B, 0x68F12BFE, 0x128200E2
+    },
+
+    /* Entry 15 */
+    {
+        0xA8636D07, 0x8E86CB3D, 0x2BE46DA2, 0xC79C42AC,
+        0xAA01E0E1, 0xED70E08A, 0xE3B69272, 0x773579FC,
+        0x4D8464C3, 0xBC0FE555, 0xCF54E071, 0x9E87A057,
+        0x3913B1D3, 0xDA655B0A, 0x9A55DBA4, 0x052774D4
+    },
+
+    /* Entry 16 */
+    {
+        0xADF7CCCF, 0x75D9BC15, 0xDFA1E1B0, 0x81A3E5D6,
+        0x249BC17E, 0x8C39E444, 0x8EA7FD43, 0xF37DCCB2,
+        0x907FBA12, 0xDA654873, 0x4A372904, 0x35DAA6DA,
+        0x6283A6C5, 0x0564CFC6, 0x4A9395BF, 0xD09FA4F6
+    },
+
+    /* Entry 17 */
+    {
+        0xE37542CA, 0xB1F5C026, 0x72E01034, 0x0B860CF3,
+        0x025289F2, 0x3A7C10E4, 0x92901032, 0xD2197D5F,
+        0x267CA2F6, 0xFA06F835, 0xBF6E43AA, 0x8FCB9A29,
+        0x7ED9F8E7, 0x465F6C11, 0xE6077AAF, 0x8A50A5B3
+    },
+
+    /* Entry 18 */
+    {
+        0xD2B59E85, 0xAD76C703, 0x9204C53F, 0x0A230645,
+        0x4A9F1335, 0x9BBC0BC4, 0xD0A967E9, 0x71603515,
+        0xA0205375, 0x8B6D6D6E, 0x51AD76DE, 0x63104183,
+        0xAABBD0AC, 0x5ABFBC21, 0xC71F3060, 0x61FB45C3
+    },
+
+    /* Entry 19 */
+    {
+        0x1D323961, 0x579345DF, 0x94CD3BC4, 0x45B79EAD,
+        0x423668D2, 0x50B664BE, 0x42BC26EA, 0x19DD5B75,
+        0x3677AE8F, 0xC7C1FBAA, 0x5D033158, 0x7B2E711A,
+        0x8942AC93, 0x8AECB50A, 0x8A16718C, 0xE255438B
+    },
+
+    /* Entry 20 */
+    {
+        0x33396533, 0x80253642, 0x2C5AD150, 0x82CB33A7,
+        0x070CA168, 0x7C147998, 0x6AAC6636, 0x07791253,
+        0x7C78BE24, 0x160003AE, 0xA30EEABF, 0xBBA9FE68,
+        0x3073F0ED, 0x16C31C40, 0x789CAECA, 0xD329CD28
+    },
+
+    /* Entry 21 */
+    {
+        0x7972BCDF, 0x840DBCBF, 0xBD11900C, 0xB5C8444F,
+        0x16520CEE, 0x78B2B290, 0xBE88D914, 0xE19F13A3,
+        0x49D3C0DF, 0x052DDC89, 0xE0B4224B, 0xC9FC183C,
+        0xCF31E0BB, 0x2C8DD074, 0xA26B1441, 0x872C7B95
+    },
+
+    /* Entry 22 */
+    {
+        0x74C8A327, 0xED93585D, 0x06BE87CA, 0xF2FB7D08,
+        0x84E36244, 0x707D83CA, 0x3EFA6833, 0x037F499D,
+        0x99BF5DDE, 0xF3218D42, 0x69FF7CE3, 0xBE0A81C0,
+        0x9EB7D4C0, 0x068FBBEA, 0xE6938C78, 0xF4EF6609
+    },
+
+    /* Entry 23 */
+    {
+        0xCB22715E, 0x202E5C5A, 0x288F8243, 0x88E93D23,
+        0xDC7EACE6, 0xDF1D1F52, 0x373183F8, 0xC6B38B3B,
+        0x3EAC9C4B, 0x77798B7F, 0x6BFA9835, 0xA9D37DFF,
+        0xFAAC41C9, 0xAFF4A447, 0x0FCB6036, 0xF14FD13C
+    },
+
+    /* Entry 24 */
+    {
+        0x49CCC093, 0xEF5EE27D, 0x40D359A3, 0x7FF3263D,
+        0xC6D6C0EA, 0x885D1942, 0x28C97FEE, 0x925ABBA3,
+        0x5D95F52D, 0xD7383480, 0x4EB691DB, 0x6979981C,
+        0x553A29C6, 0x6544E8AE, 0x5043559F, 0x28324EF8
+    },
+
+    /* Entry 25 */
+    {
+        0x300C0E39, 0xD6C8E4B7, 0x3E37F58A, 0x37AD4A1A,
+        0xE5E8CDFB, 0x763330F5, 0x870EA133, 0x62BF8C2C,
+        0x763CCAC9, 0x03FBC63A, 0xFB1886C0, 0xC889D8A5,
+        0xBE49D9FE, 0xF0486DE5, 0x62C23338, 0xAF9A8778
+    },
+
+    /* Entry 26 */
+    {
+        0x76AA81B3, 0x8A43A2A1, 0x8A0CC3D2, 0x89602129,
+        0x821F6640, 0x49D311E8, 0x5C734AE4, 0x8035608F,
+        0x349ADC3B, 0xA7BE0561, 0x96A337B5, 0x328525B2,
+        0x6BCCF78A, 0x575413C3, 0x4854960F, 0x6C7292EC
+    },
+
+    /* Entry 27 */
+    {
+        0x3C2943FF, 0x121E6A71, 0x6374C47E, 0x0468565C,
+        0x2826F138, 0xD66FE993, 0x7748E3AC, 0x4E2CFAF1,
+        0x4708A6C8, 0xE9BAAA2C, 0x66FFB5B4, 0xA3845C8C,
+        0xB77C8FAC, 0xAD3E293E, 0x440A35E8, 0x00B5CFA9
+    },
+
+    /* Entry 28 */
+    {
+        0x63E06277, 0x3F55F58C, 0x64BA6E8C, 0x1A81DE8A,
+        0xF4CC043B, 0x85CFDC74, 0x048D26E0, 0x7CBEFB98,
+        0x82ABA891, 0x5BDE4B3C, 0x86DB6F46, 0x863D8F75,
+        0x845186C5, 0xC7AF5C1F, 0xCB527CEC, 0x41D7D404
+    },
+
+    /* Entry 29 */
+    {
+        0x83E1A246, 0x3B446994, 0xF6B819A2, 0x11C5CED4,
+        0xAFF79A46, 0xC79D4660, 0x5F22411A, 0x423BBDC1,
+        0xA964039D, 0x22652251, 0xE738657B, 0x808D6753,
+        0x4E909DC8, 0xC0CA19E3, 0x34AB0D07, 0x0E036E47
+    },
+
+    /* Entry 30 */
+    {
+        0x7A26F742, 0x233593E7, 0xFC0F14D9, 0xDDC1C79F,
+        0x2D359358, 0xB33C8980, 0x730AACFE, 0x51DF6155,
+        0x0F2C0B8D, 0xA9A6066C, 0x2E706F80, 0xB9212227,
+        0x96A5EFE9, 0x3994A532, 0x52316B12, 0xCF3D168B
+    },
+
+    /* Entry 31 */
+    {
+        0x27EAFCC0, 0xBE47DD50, 0xEC7E66DB, 0x23DF1041,
+        0x78A4DDDD, 0x18C977FF, 0x9D2D152E, 0xB51565D7,
+        0x78F4A4DE, 0x24F6A6D5, 0x7D86B2CA, 0xBBC15B20,
+        0x1D3B43CA, 0xA064D39C, 0x52200839, 0x55248667
+    }
+};
+
+static NX_CRYPTO_CONST UINT _nx_crypto_ec_secp256r1_comb_2e[][16] =
+{
+
+    /* 2^26 * entry 1 */
+    {
+        0x879FBBED, 0xF2369F0B, 0xDA9D1869, 0x0FF0AE86,
+        0x56766F45, 0x5251D759, 0x2BE8D0FC, 0x4984D8C0,
+        0xD21008F0, 0x7ECC95A6, 0x3A1A1C49, 0x29BD54A0,
+        0xD26C50F3, 0xAB9828C5, 0x51D0D251, 0x32C0087C
+    },
+
+    /* 2^26 * entry 2 */
+    {
+        0xAED1D1F7, 0x96649933, 0x50563090, 0x566EAFF3,
+        0xAD2E39CF, 0x345057F0, 0x1F832124, 0x148FF65B,
+        0xCF94CF0D, 0x042E89D4, 0x520C58B3, 0x319BEC84,
+        0x5361AA0D, 0x2A267626, 0x8FBC87AD, 0xC86FA302
+    },
+
+    /* 2^26 * entry 3 */
+    {
+        0xD22F29E5, 0x0B268F56, 0x7AB08B3B, 0x719EEC8A,
+        0x60D0130F, 0xAD161F7D, 0x2008F88B, 0xC7024EE5,
+        0x4B8BDFDA, 0x3749D68C, 0x3EE37D69, 0x4CB4F908,
+        0x9E465260, 0xB3C747DA, 0x7AAAADC9, 0x281B9078
+    },
+
+    /* 2^26 * entry 4 */
+    {
+        0x41C23FA3, 0xB4480F04, 0xC1989A2E, 0xB4712EB0,
+        0x93A29CA7, 0x3CCBBA0F, 0xD619428C, 0x6E205C14,
+        0xB3641686, 0x90DB7957, 0x45AC8B4E, 0x0432691D,
+        0xF64E0350, 0x07A759AC, 0x9C972517, 0x0514D89C
+    },
+
+    /* 2^26 * entry 5 */
+    {
+        0x72507CC1, 0x3242C777, 0xB6E8F987, 0xBB765B9A,
+        0x228B3DC1, 0x5E91FBA5, 0x54DC2A2A, 0x730901A9,
+        0x828696AE, 0x6370A21D, 0x75646BFA, 0xCC2F4905,
+        0x237784F1, 0x01F114A0, 0x009A4C20, 0xF5F89CD0
+    },
+
+    /* 2^26 * entry 6 */
+    {
+        0xAF8DB29F, 0x87A2DFC9, 0x34D974F9, 0x9154B55D,
+        0x7D8467A8, 0x9CEEEAD0, 0xC1A0CC86, 0x44E5C167,
+        0x2BE1AAAC, 0x8DD2F35C, 0x217C7609, 0xEFBACC48,
+        0x3EBCE7CC, 0x017B6622, 0x4C674335, 0xBA8CEC33
+    },
+
+    /* 2^26 * entry 7 */
+    {
+        0x03303E3B, 0xA4D2DB97, 0xC1B2AAE9, 0xBBDB05DE,
+        0x55313BC8, 0x0B7733EB, 0x8A3A23E6, 0x687D086A,
+        0x25B2C566, 0x8A33CFA4, 0x49D49C37, 0x43A3E99A,
+        0x9FD87530, 0x0919B0FE, 0xA82C4B51, 0x199C937F
+    },
+
+    /* 2^26 * entry 8 */
+    {
+        0x171B445F, 0x01079383, 0x8131AD4C, 0x9BCF21E3,
+        0xC93987E8, 0x8CDFE205, 0xC92E8C8F, 0xE63F4152,
+        0x30ADD43D, 0x729462A9, 0xC980F05A, 0x62EBB143,
+        0x3B06E968, 0x4F3954E5, 0x242CF6B1, 0xFE1D75AD
+    },
+
+    /* 2^26 * entry 9 */
+    {
+        0xF4D94635, 0x3E4F0526, 0x45E58E46, 0xE188E72D,
+        0xE4CEDA38, 0x02F92BC3, 0xAA4B33D5, 0x1A92AEA7,
+        0x866C03CA, 0x1A438EF9, 0xA7BF988E, 0x69169768,
+        0x74A9567E, 0x1CB2E6D3, 0x3580C528, 0xDBDEDD90
+    },
+
+    /* 2^26 * entry 10 */
+    {
+        0xAF2E6EBF, 0x0D94231A, 0x2BE6027A, 0xA75E011C,
+        0xCF6A7AC0, 0x7D962C91, 0xCA4862BE, 0x186659C2,
+        0x8165CC46, 0x4E9522AC, 0x2D4455CC, 0xF0EFEE8A,
+        0x13748433, 0x5C8F94AF, 0x234D6DC7, 0x27C55B69
+    },
+
+    /* 2^26 * entry 11 */
+    {
+        0xD579C0FC, 0x69555846, 0x6D84F2A2, 0xC85D836E,
+        0xEA9DC9DC, 0x011C08ED, 0xBD603A5A, 0x04E67DA8,
+        0x291E5A86, 0x86FE81E5, 0x3B2F8734, 0x90A02FA1,
+        0x18BCBB29, 0xCFEF077C, 0x9439214A, 0x76874965
+    },
+
+    /* 2^26 * entry 12 */
+    {
+        0xC35BB745, 0x18EB175A, 0x0D32A3BE, 0x4473E59C,
+        0x7928E292, 0x2F7318BD, 0xC8761BC2, 0x32509CA6,
+        0x7408A58E, 0xFA311E19, 0x2B21FD58, 0x1CF3FD6D,
+        0x66332647, 0x57D3945B, 0x622F834B, 0x4288F14D
+    },
+
+    /* 2^26 * entry 13 */
+    {
+        0x6FD3B088, 0x530FD801, 0x3DFFB8A6, 0x2F275D20,
+        0x8206C863, 0x80F114AF, 0x30D71D8B, 0x99E6CB82,
+        0x05951494, 0x1D9D0D66, 0xF5103EEF, 0xD58D1195,
+        0x0EB40C4D, 0x9CC0DED8, 0xD9F91EE2, 0x159D671D
+    },
+
+    /* 2^26 * entry 14 */
+    {
+        0x85E39A97, 0x646B05E9, 0x16BC1199, 0x01ABFF1E,
+        0xAF21BA2A, 0x8A61FF22, 0x98F2A5DC, 0xA821CC60,
+        0x8D90096E, 0xD52029D9, 0x99F3A372, 0x0612D472,
+        0x58985289, 0x54F79C9F, 0x59A39CD0, 0x0C4963E5
+    },
+
+    /* 2^26 * entry 15 */
+    {
+        0x9F735CF1, 0xD167DC63, 0x49C000C4, 0xB500AB70,
+        0x8855D474, 0xFB87877B, 0xD573CD41, 0xAFFE8C2E,
+        0x2E2C9D16, 0x54466F46, 0x6431737F, 0x8E26FC02,
+        0x4132C46E, 0x16949E17, 0x24DBC94A, 0x15F08BD6
+    },
+
+    /* 2^26 * entry 16 */
+    {
+        0x558DF019, 0x9F51439E, 0xAC712B27, 0x230DA4BA,
+        0x55185A24, 0x518919E3, 0x84B78F50, 0x4DCEFCDD,
+        0xA47D4C5A, 0xA7D90FB2, 0xB30E009E, 0x55AC9ABF,
+        0x74EED273, 0xFD2FC359, 0xDBEA8FAF, 0xB72D824C
+    },
+
+    /* 2^26 * entry 17 */
+    {
+        0x7D5B7F06, 0x135642E1, 0xBB317C9C, 0x23E3F419,
+        0xA9AB3DC8, 0x1BA92F6B, 0x06306027, 0x5522405F,
+        0xB64C41A3, 0x9D43CDA2, 0x3B7AA075, 0x7641AE10,
+        0x8C127B54, 0xD229A5AF, 0x05A5988F, 0x8229BD57
+    },
+
+    /* 2^26 * entry 18 */
+    {
+        0x92E1315E, 0x711848DB, 0xC0A02475, 0xA4E1D2E7,
+        0x82324064, 0x9D78E470, 0x56979321, 0xB75A831B,
+        0x7F4AF529, 0x55D0EA12, 0x8BC9111B, 0x9CBFADBF,
+        0x3A54EB2F, 0x6FF6945A, 0x1053D38A, 0x67BF1577
+    },
+
+    /* 2^26 * entry 19 */
+    {
+        0xD06D0A87, 0x1A79DC7D, 0xDFC0B72E, 0xFA2F7833,
+        0x64F09BE1, 0x2736B5A9, 0xABB29A1D, 0xAE3C9A8F,
+        0x115A58C1, 0x46529D35, 0xF9D1AD2C, 0xBC95E4E0,
+        0xD3B8F0EF, 0xB3712870, 0x8B5A559E, 0xF9AF6B96
+    },
+
+    /* 2^26 * entry 20 */
+    {
+        0x215A6E8E, 0xBCC784DE, 0xDD5CD28A, 0xC27A55B9,
+        0x408E0B8A, 0x26E39CCC, 0xA016A9E2, 0x6AC02FC2,
+        0x58C0B629, 0x23AF51C9, 0x2C04D067, 0xC803B587,
+        0x69E10D44, 0x77F50EFB, 0xE2FC5382, 0x9D235D25
+    },
+
+    /* 2^26 * entry 21 */
+    {
+        0x68DDD750, 0x51C331F9, 0x52CD7E0F, 0xC295A734,
+        0x7D1C2CED, 0xC823583E, 0x35F6CDDA, 0x46B45733,
+        0x72424DA2, 0x29175E1E, 0xB844983B, 0x54EA9F95,
+        0x93590D28, 0x493EA1E8, 0x1E8BE02A, 0x042AE28B
+    },
+
+    /* 2^26 * entry 22 */
+    {
+        0x04740732, 0xB81B392C, 0xC427C246, 0x27F93030,
+        0x56FEE842, 0x54761461, 0x3735F0E9, 0x15594B3F,
+        0x0B88B778, 0xB033C020, 0x86BCF977, 0xCD26DFA9,
+        0xC947F4AF, 0x8A49E906, 0x28E84244, 0x01C04A31
+    },
+
+    /* 2^26 * entry 23 */
+    {
+        0xE1CEB7C2, 0x258BAC66, 0x4DAC8CBB, 0xF4259758,
+        0xE92EBB1A, 0xD50983F2, 0xCA2AE0D0, 0xBF120E4E,
+        0x55CD49CD, 0xA3E7617E, 0x71519648, 0xFD5B07FF,
+        0xAFD703ED, 0xDAAE5103, 0x4172130C, 0xB040AD2E
+    },
+
+    /* 2^26 * entry 24 */
+    {
+        0xF56EF20A, 0x805C4D63, 0x4EAB5B33, 0xAE7931EF,
+        0x816FF923, 0x5FB6774F, 0xB7770F0E, 0x22EFFA67,
+        0xE38B79D8, 0xB54F3AAA, 0x7178CE07, 0x38212DAD,
+        0x9F5CC57B, 0xA99A342A, 0xF9CD8E4B, 0x90C9D743
+    },
+
+    /* 2^26 * entry 25 */
+    {
+        0xB56E4851, 0xA44E8DF6, 0x5098DE84, 0x03AF7EC9,
+        0x04AB4AB1, 0xBAD114C5, 0xDC7F874F, 0x1E580877,
+        0x26B4F612, 0xF3789204, 0x1457C827, 0xFA91B824,
+        0x75180CAB, 0x38F9A52C, 0x434E8BD0, 0x809DEEC3
+    },
+
+    /* 2^26 * entry 26 */
+    {
+        0x1F9EC1F4, 0xEAD816E0, 0xDDBA779C, 0xF9531ABD,
+        0x3E5EE249, 0xE5A7D765, 0xA45B2404, 0x2A5B125B,
+        0xFDF13098, 0xD9CD9C0A, 0x5D1D5475, 0xAF2E94BB,
+        0x68DD1F79, 0xF642A921, 0x28FF1C3B, 0x838F2D4D
+    },
+
+    /* 2^26 * entry 27 */
+    {
+        0x8A92C081, 0x6C6A83EF, 0xE838637D, 0x407FB0A9,
+        0x9ACBC6DC, 0xCF209F0B, 0x8CDABE07, 0xE77A8729,
+        0x2944ED0D, 0x93F7910F, 0x00AAFA33, 0xA14A1F63,
+        0x796111CC, 0x64619B60, 0x114C6685, 0xF0A78CFE
+    },
+
+    /* 2^26 * entry 28 */
+    {
+        0x79C31112, 0xB81A504B, 0xCBE7753E, 0x032D6B6F,
+        0xAB3A4272, 0x06B97785, 0x9CEEF34D, 0xB88F875D,
+        0xB5A4B95A, 0xE4E2300E, 0x253F0813, 0x6A2DDE95,
+        0x386594FC, 0x6A49FB8E, 0x8813C0F5, 0xB6175C5C
+    },
+
+    /* 2^26 * entry 29 */
+    {
+        0xB8F6993B, 0x51853136, 0x99F6300D, 0x17757FDD,
+        0xCD3B39D4, 0xA71459A4, 0x7A7B100E, 0x3C9243C7,
+        0x7B8E2675, 0x65F45BAA, 0x2C6F3386, 0x27A2701C,
+        0xC5A639E2, 0xFC4965A0, 0x50DA7A2D, 0xD8B38CE4
+    },
+
+    /* 2^26 * entry 30 */
+    {
+        0xD652075B, 0x0D869BB1, 0x3CF7853C, 0xF1E6E180,
+        0x6938A2ED, 0x1110008E, 0x184224BF, 0x2D43FD1D,
+        0xB98C7D81, 0xE4C34DFE, 0xA4CF873F, 0xC23B9E2E,
+        0xE8935E89, 0xA4377B7C, 0xB7907059, 0x1710AC7F
+    },
+
+    /* 2^26 * entry 31 */
+    {
+        0xF9ACA1B3, 0xD4C30E05, 0xA5EFC245, 0x038F18B6,
+        0x4780D032, 0xAB58BAA7, 0xBDF44DC7, 0x64E42435,
+        0x899537D0, 0x6156AF9B, 0x31841CB5, 0x8C35EE88,
+        0x61452838, 0xAEEDA2F0, 0xB6A1E175, 0x388434B4
+    }
+};
+
+static NX_CRYPTO_CONST UINT _nx_crypto_ec_secp256r1_g_odd[][16] =
+{
+
+    /* 1G */
+    {
+        0x18A9143C, 0x79E730D4, 0x5FEDB601, 0x75BA95FC,
+        0x77622510, 0x79FB732B, 0xA53755C6, 0x18905F76,
+        0xCE95560A, 0xDDF25357, 0xBA19E45C, 0x8B4AB8E4,
+        0xDD21F325, 0xD2E88688, 0x25885D85, 0x8571FF18
+    },
+
+    /* 3G */
+    {
+        0x4EEBC127, 0xFFAC3F90, 0x087D81FB, 0xB027F84A,
+        0x87CBBC98, 0x66AD77DD, 0xB6FF747E, 0x26936A3F,
+        0xC983A7EB, 0xB04C5C1F, 0x0861FE1A, 0x583E47AD,
+        0x1A2EE98E, 0x78820831, 0xE587CC07, 0xD5F06A29
+    },
+
+    /* 5G */
+    {
+        0xC45C61F5, 0xBE1B8AAE, 0x94B9537D, 0x90EC649A,
+        0xD076C20C, 0x941CB5AA, 0x890523C8, 0xC9079605,
+        0xE7BA4F10, 0xEB309B4A, 0xE5EB882B, 0x73C568EF,
+        0x7E7A1F68, 0x3540A987, 0x2DD1E916, 0x73A076BB
+    },
+
+    /* 7G */
+    {
+        0xA0173B4F, 0x0746354E, 0xD23C00F7, 0x2BD20213,
+        0x0C23BB08, 0xF43EAAB5, 0xC3123E03, 0x13BA5119,
+        0x3F5B9D4D, 0x2847D030, 0x5DA67BDD, 0x6742F2F2,
+        0x77C94195, 0xEF933BDC, 0x6E240867, 0xEAEDD915
+    },
+
+    /* 9G */
+    {
+        0x264E20E8, 0x75C96E8F, 0x59A7A841, 0xABE6BFED,
+        0x44C8EB00, 0x2CC09C04, 0xF0C4E16B, 0xE05B3080,
+        0xA45F3314, 0x1EB7777A, 0xCE5D45E3, 0x56AF7BED,
+        0x88B12F1A, 0x2B6E019A, 0xFD835F9B, 0x086659CD
+    },
+
+    /* 11G */
+    {
+        0x6245E404, 0xEA7D260A, 0x6E7FDFE0, 0x9DE40795,
+        0x8DAC1AB5, 0x1FF3A415, 0x649C9073, 0x3E7090F1,
+        0x2B944E88, 0x1A768561, 0xE57F61C8, 0x250F939E,
+        0x1EAD643D, 0x0C0DAA89, 0xE125B88E, 0x68930023
+    },
+
+    /* 13G */
+    {
+        0x4B2ED709, 0xCCC42563, 0x856FD30D, 0x0E356769,
+        0x559E9811, 0xBCBCD43F, 0x5395B759, 0x738477AC,
+        0xC00EE17F, 0x35752B90, 0x742ED2E3, 0x68748390,
+        0xBD1F5BC1, 0x7CD06422, 0xC9E7B797, 0xFBC08769
+    },
+
+    /* 15G */
+    {
+        0xBC60055B, 0x72BCD8B7, 0x56E27E4B, 0x03CC23EE,
+        0xE4819370, 0xEE337424, 0x0AD3DA09, 0xE2AA0E43,
+        0x6383C45D, 0x40B8524F, 0x42A41B25, 0xD7663554,
+        0x778A4797, 0x64EFA6DE, 0x7079ADF4, 0x2042170A
+    }
+};
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_add                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds two field elements modulo p in constant time.    */
+/*    r = (a + b) mod p.                                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_fe_add(UINT *r, const UINT *a, const UINT *b)
+{
+UINT    sum[NX_CRYPTO_EC_SECP256R1_LIMBS];
+ULONG64 t = 0;
+UINT    carry, borrow = 0, mask;
+UINT    i;
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        t += (ULONG64)a[i] + b[i];
+        sum[i] = (UINT)t;
+        t >>= 32;
+    }
+    carry = (UINT)t;
+
+    /* r = sum - p */
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        t = (ULONG64)sum[i] - _nx_crypto_ec_secp256r1_fe_p[i] - borrow;
+        r[i] = (UINT)t;
+        borrow = (UINT)(t >> 63);
+    }
+
+    /* Keep the sum if it is less than p. */
+    mask = 0 - (borrow & (carry ^ 1));
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        r[i] = (sum[i] & mask) | (r[i] & ~mask);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_sub                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function subtracts two field elements modulo p in constant     */
+/*    time. r = (a - b) mod p.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_fe_sub(UINT *r, const UINT *a, const UINT *b)
+{
+ULONG64 t;
+UINT    borrow = 0, mask;
+UINT    i;
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        t = (ULONG64)a[i] - b[i] - borrow;
+        r[i] = (UINT)t;
+        borrow = (UINT)(t >> 63);
+    }
+
+    /* Add p back if the difference is negative. */
+    mask = 0 - borrow;
+    t = 0;
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        t += (ULONG64)r[i] + (_nx_crypto_ec_secp256r1_fe_p[i] & mask);
+        r[i] = (UINT)t;
+        t >>= 32;
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_mul                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies two field elements in Montgomery form      */
+/*    in constant time. r = a * b / 2^256 mod p.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    b                                     Field element b               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_fe_mul(UINT *r, const UINT *a, const UINT *b)
+{
+UINT    t[NX_CRYPTO_EC_SECP256R1_LIMBS + 2];
+ULONG64 product;
+UINT    u, borrow = 0, mask;
+UINT    i, j;
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS + 2; i++)
+    {
+        t[i] = 0;
+    }
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+
+        /* t = t + a * b[i] */
+        product = 0;
+        for (j = 0; j < NX_CRYPTO_EC_SECP256R1_LIMBS; j++)
+        {
+            product += (ULONG64)a[j] * b[i] + t[j];
+            t[j] = (UINT)product;
+            product >>= 32;
+        }
+        product += t[NX_CRYPTO_EC_SECP256R1_LIMBS];
+        t[NX_CRYPTO_EC_SECP256R1_LIMBS] = (UINT)product;
+        t[NX_CRYPTO_EC_SECP256R1_LIMBS + 1] = (UINT)(product >> 32);
+
+        /* -p^(-1) mod 2^32 is 1, so u = t[0]. t = (t + u * p) / 2^32 */
+        u = t[0];
+        product = (ULONG64)u * _nx_crypto_ec_secp256r1_fe_p[0] + t[0];
+        product >>= 32;
+        for (j = 1; j < NX_CRYPTO_EC_SECP256R1_LIMBS; j++)
+        {
+            product += (ULONG64)u * _nx_crypto_ec_secp256r1_fe_p[j] + t[j];
+            t[j - 1] = (UINT)product;
+            product >>= 32;
+        }
+        product += t[NX_CRYPTO_EC_SECP256R1_LIMBS];
+        t[NX_CRYPTO_EC_SECP256R1_LIMBS - 1] = (UINT)product;
+        t[NX_CRYPTO_EC_SECP256R1_LIMBS] = t[NX_CRYPTO_EC_SECP256R1_LIMBS + 1] + (UINT)(product >> 32);
+    }
+
+    /* r = t - p, keep t if it is less than p. */
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        product = (ULONG64)t[i] - _nx_crypto_ec_secp256r1_fe_p[i] - borrow;
+        r[i] = (UINT)product;
+        borrow = (UINT)(product >> 63);
+    }
+    mask = 0 - (borrow & (t[NX_CRYPTO_EC_SECP256R1_LIMBS] ^ 1));
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        r[i] = (t[i] & mask) | (r[i] & ~mask);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_sqr_n                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function squares a field element n times. r = a^(2^n).         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    n                                     Number of squarings           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_mul        Montgomery multiplication     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_fe_sqr_n(UINT *r, const UINT *a, UINT n)
+{
+UINT i;
+
+    _nx_crypto_ec_secp256r1_fe_mul(r, a, a);
+    for (i = 1; i < n; i++)
+    {
+        _nx_crypto_ec_secp256r1_fe_mul(r, r, r);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_inverse                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the inverse of a field element by raising    */
+/*    it to the power of p - 2 with a fixed addition chain.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_mul        Montgomery multiplication     */
+/*    _nx_crypto_ec_secp256r1_fe_sqr_n      Repeated squaring             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_fe_inverse(UINT *r, const UINT *a)
+{
+UINT x2[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT x4[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT x8[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT x16[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT x30[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT x32[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT t[NX_CRYPTO_EC_SECP256R1_LIMBS];
+
+    /* xN = a ^ (2 ^ N - 1) */
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, a, 1);
+    _nx_crypto_ec_secp256r1_fe_mul(x2, t, a);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, x2, 2);
+    _nx_crypto_ec_secp256r1_fe_mul(x4, t, x2);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, x4, 4);
+    _nx_crypto_ec_secp256r1_fe_mul(x8, t, x4);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, x8, 8);
+    _nx_crypto_ec_secp256r1_fe_mul(x16, t, x8);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, x16, 8);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, x8);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, t, 4);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, x4);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, t, 2);
+    _nx_crypto_ec_secp256r1_fe_mul(x30, t, x2);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, x30, 2);
+    _nx_crypto_ec_secp256r1_fe_mul(x32, t, x2);
+
+    /* p - 2 = 0xFFFFFFFF 00000001 00000000 00000000 00000000 FFFFFFFF FFFFFFFF FFFFFFFD */
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, x32, 32);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, a);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, t, 128);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, x32);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, t, 32);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, x32);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, t, 30);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, x30);
+    _nx_crypto_ec_secp256r1_fe_sqr_n(t, t, 2);
+    _nx_crypto_ec_secp256r1_fe_mul(r, t, a);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_is_zero                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks whether a field element is zero without        */
+/*    branching on its value.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    a                                     Field element a               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    is_zero                               1 if a is zero, otherwise 0   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_ec_secp256r1_fe_is_zero(const UINT *a)
+{
+UINT value = 0;
+UINT i;
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        value |= a[i];
+    }
+
+    return(((value | (0 - value)) >> 31) ^ 1);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_select                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a to r when mask is all ones and leaves r      */
+/*    untouched when mask is zero, without branching on the mask.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Field element a               */
+/*    mask                                  Selection mask                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_fe_select(UINT *r, const UINT *a, UINT mask)
+{
+UINT i;
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        r[i] = (a[i] & mask) | (r[i] & ~mask);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_point_select                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies point a to r when mask is all ones and leaves  */
+/*    r untouched when mask is zero, without branching on the mask.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Point a                       */
+/*    mask                                  Selection mask                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_select     Conditional copy              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_point_select(NX_CRYPTO_EC_SECP256R1_POINT *r,
+                                                 NX_CRYPTO_EC_SECP256R1_POINT *a, UINT mask)
+{
+    _nx_crypto_ec_secp256r1_fe_select(r -> nx_crypto_ec_secp256r1_point_x, a -> nx_crypto_ec_secp256r1_point_x, mask);
+    _nx_crypto_ec_secp256r1_fe_select(r -> nx_crypto_ec_secp256r1_point_y, a -> nx_crypto_ec_secp256r1_point_y, mask);
+    _nx_crypto_ec_secp256r1_fe_select(r -> nx_crypto_ec_secp256r1_point_z, a -> nx_crypto_ec_secp256r1_point_z, mask);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_point_set_infinite          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the Jacobian point to infinity.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Point r                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMCPY                      Copy data                     */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_point_set_infinite(NX_CRYPTO_EC_SECP256R1_POINT *r)
+{
+    NX_CRYPTO_MEMCPY(r -> nx_crypto_ec_secp256r1_point_x, _nx_crypto_ec_secp256r1_fe_one, sizeof(r -> nx_crypto_ec_secp256r1_point_x)); /* Use case of memcpy is verified. */
+    NX_CRYPTO_MEMCPY(r -> nx_crypto_ec_secp256r1_point_y, _nx_crypto_ec_secp256r1_fe_one, sizeof(r -> nx_crypto_ec_secp256r1_point_y)); /* Use case of memcpy is verified. */
+    NX_CRYPTO_MEMSET(r -> nx_crypto_ec_secp256r1_point_z, 0, sizeof(r -> nx_crypto_ec_secp256r1_point_z));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_point_double                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function doubles a point in Jacobian coordinates with the      */
+/*    formula for curves where a = -3. r = 2 * a.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Point a                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_add        Modular addition              */
+/*    _nx_crypto_ec_secp256r1_fe_mul        Montgomery multiplication     */
+/*    _nx_crypto_ec_secp256r1_fe_sub        Modular subtraction           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_point_double(NX_CRYPTO_EC_SECP256R1_POINT *r,
+                                                 NX_CRYPTO_EC_SECP256R1_POINT *a)
+{
+UINT delta[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT gamma[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT beta[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT alpha[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT t1[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT t2[NX_CRYPTO_EC_SECP256R1_LIMBS];
+
+    /* delta = Z1^2, gamma = Y1^2, beta = X1 * gamma */
+    _nx_crypto_ec_secp256r1_fe_mul(delta, a -> nx_crypto_ec_secp256r1_point_z, a -> nx_crypto_ec_secp256r1_point_z);
+    _nx_crypto_ec_secp256r1_fe_mul(gamma, a -> nx_crypto_ec_secp256r1_point_y, a -> nx_crypto_ec_secp256r1_point_y);
+    _nx_crypto_ec_secp256r1_fe_mul(beta, a -> nx_crypto_ec_secp256r1_point_x, gamma);
+
+    /* alpha = 3 * (X1 - delta) * (X1 + delta), which is 3 * X1^2 + a * Z1^4 for a = -3. */
+    _nx_crypto_ec_secp256r1_fe_sub(t1, a -> nx_crypto_ec_secp256r1_point_x, delta);
+    _nx_crypto_ec_secp256r1_fe_add(t2, a -> nx_crypto_ec_secp256r1_point_x, delta);
+    _nx_crypto_ec_secp256r1_fe_mul(t1, t1, t2);
+    _nx_crypto_ec_secp256r1_fe_add(alpha, t1, t1);
+    _nx_crypto_ec_secp256r1_fe_add(alpha, alpha, t1);
+
+    /* Z3 = (Y1 + Z1)^2 - gamma - delta */
+    _nx_crypto_ec_secp256r1_fe_add(t1, a -> nx_crypto_ec_secp256r1_point_y, a -> nx_crypto_ec_secp256r1_point_z);
+    _nx_crypto_ec_secp256r1_fe_mul(t1, t1, t1);
+    _nx_crypto_ec_secp256r1_fe_sub(t1, t1, gamma);
+    _nx_crypto_ec_secp256r1_fe_sub(r -> nx_crypto_ec_secp256r1_point_z, t1, delta);
+
+    /* X3 = alpha^2 - 8 * beta */
+    _nx_crypto_ec_secp256r1_fe_add(beta, beta, beta);
+    _nx_crypto_ec_secp256r1_fe_add(beta, beta, beta);
+    _nx_crypto_ec_secp256r1_fe_add(t2, beta, beta);
+    _nx_crypto_ec_secp256r1_fe_mul(t1, alpha, alpha);
+    _nx_crypto_ec_secp256r1_fe_sub(r -> nx_crypto_ec_secp256r1_point_x, t1, t2);
+
+    /* Y3 = alpha * (4 * beta - X3) - 8 * gamma^2 */
+    _nx_crypto_ec_secp256r1_fe_sub(t1, beta, r -> nx_crypto_ec_secp256r1_point_x);
+    _nx_crypto_ec_secp256r1_fe_mul(t1, alpha, t1);
+    _nx_crypto_ec_secp256r1_fe_mul(gamma, gamma, gamma);
+    _nx_crypto_ec_secp256r1_fe_add(gamma, gamma, gamma);
+    _nx_crypto_ec_secp256r1_fe_add(gamma, gamma, gamma);
+    _nx_crypto_ec_secp256r1_fe_add(gamma, gamma, gamma);
+    _nx_crypto_ec_secp256r1_fe_sub(r -> nx_crypto_ec_secp256r1_point_y, t1, gamma);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_point_add                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds two points in Jacobian coordinates. Points at    */
+/*    infinity are handled in constant time. r = a + b.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Point a                       */
+/*    b                                     Point b                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_add        Modular addition              */
+/*    _nx_crypto_ec_secp256r1_fe_is_zero    Check for zero                */
+/*    _nx_crypto_ec_secp256r1_fe_mul        Montgomery multiplication     */
+/*    _nx_crypto_ec_secp256r1_fe_sub        Modular subtraction           */
+/*    _nx_crypto_ec_secp256r1_point_double  Perform point doubling        */
+/*    _nx_crypto_ec_secp256r1_point_select  Conditional copy of point     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_point_add(NX_CRYPTO_EC_SECP256R1_POINT *r,
+                                              NX_CRYPTO_EC_SECP256R1_POINT *a,
+                                              NX_CRYPTO_EC_SECP256R1_POINT *b)
+{
+NX_CRYPTO_EC_SECP256R1_POINT sum;
+UINT                         z1z1[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         z2z2[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         u1[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         s1[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         h[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         rr[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         t[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         a_infinite, b_infinite;
+
+    a_infinite = _nx_crypto_ec_secp256r1_fe_is_zero(a -> nx_crypto_ec_secp256r1_point_z);
+    b_infinite = _nx_crypto_ec_secp256r1_fe_is_zero(b -> nx_crypto_ec_secp256r1_point_z);
+
+    /* U1 = X1 * Z2^2, U2 = X2 * Z1^2, S1 = Y1 * Z2^3, S2 = Y2 * Z1^3 */
+    _nx_crypto_ec_secp256r1_fe_mul(z1z1, a -> nx_crypto_ec_secp256r1_point_z, a -> nx_crypto_ec_secp256r1_point_z);
+    _nx_crypto_ec_secp256r1_fe_mul(z2z2, b -> nx_crypto_ec_secp256r1_point_z, b -> nx_crypto_ec_secp256r1_point_z);
+    _nx_crypto_ec_secp256r1_fe_mul(u1, a -> nx_crypto_ec_secp256r1_point_x, z2z2);
+    _nx_crypto_ec_secp256r1_fe_mul(h, b -> nx_crypto_ec_secp256r1_point_x, z1z1);
+    _nx_crypto_ec_secp256r1_fe_mul(s1, b -> nx_crypto_ec_secp256r1_point_z, z2z2);
+    _nx_crypto_ec_secp256r1_fe_mul(s1, a -> nx_crypto_ec_secp256r1_point_y, s1);
+    _nx_crypto_ec_secp256r1_fe_mul(rr, a -> nx_crypto_ec_secp256r1_point_z, z1z1);
+    _nx_crypto_ec_secp256r1_fe_mul(rr, b -> nx_crypto_ec_secp256r1_point_y, rr);
+
+    /* H = U2 - U1, r = 2 * (S2 - S1) */
+    _nx_crypto_ec_secp256r1_fe_sub(h, h, u1);
+    _nx_crypto_ec_secp256r1_fe_sub(rr, rr, s1);
+
+    /* Both points are the same finite point. This can't happen for a scalar less than the
+       order of the group in the fixed window loops, so it is handled outside of constant time. */
+    if (_nx_crypto_ec_secp256r1_fe_is_zero(h) & _nx_crypto_ec_secp256r1_fe_is_zero(rr) &
+        (a_infinite ^ 1) & (b_infinite ^ 1))
+    {
+        _nx_crypto_ec_secp256r1_point_double(r, a);
+        return;
+    }
+    _nx_crypto_ec_secp256r1_fe_add(rr, rr, rr);
+
+    /* Z3 = ((Z1 + Z2)^2 - Z1Z1 - Z2Z2) * H */
+    _nx_crypto_ec_secp256r1_fe_add(t, a -> nx_crypto_ec_secp256r1_point_z, b -> nx_crypto_ec_secp256r1_point_z);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, t);
+    _nx_crypto_ec_secp256r1_fe_sub(t, t, z1z1);
+    _nx_crypto_ec_secp256r1_fe_sub(t, t, z2z2);
+    _nx_crypto_ec_secp256r1_fe_mul(sum.nx_crypto_ec_secp256r1_point_z, t, h);
+
+    /* I = (2 * H)^2, J = H * I, V = U1 * I */
+    _nx_crypto_ec_secp256r1_fe_add(t, h, h);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, t);
+    _nx_crypto_ec_secp256r1_fe_mul(h, h, t);
+    _nx_crypto_ec_secp256r1_fe_mul(u1, u1, t);
+
+    /* X3 = r^2 - J - 2 * V */
+    _nx_crypto_ec_secp256r1_fe_mul(t, rr, rr);
+    _nx_crypto_ec_secp256r1_fe_sub(t, t, h);
+    _nx_crypto_ec_secp256r1_fe_sub(t, t, u1);
+    _nx_crypto_ec_secp256r1_fe_sub(sum.nx_crypto_ec_secp256r1_point_x, t, u1);
+
+    /* Y3 = r * (V - X3) - 2 * S1 * J */
+    _nx_crypto_ec_secp256r1_fe_sub(t, u1, sum.nx_crypto_ec_secp256r1_point_x);
+    _nx_crypto_ec_secp256r1_fe_mul(t, rr, t);
+    _nx_crypto_ec_secp256r1_fe_mul(s1, s1, h);
+    _nx_crypto_ec_secp256r1_fe_add(s1, s1, s1);
+    _nx_crypto_ec_secp256r1_fe_sub(sum.nx_crypto_ec_secp256r1_point_y, t, s1);
+
+    /* Select the other point when either of them is the point at infinity. */
+    _nx_crypto_ec_secp256r1_point_select(&sum, b, 0 - a_infinite);
+    _nx_crypto_ec_secp256r1_point_select(&sum, a, 0 - b_infinite);
+    *r = sum;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_point_add_affine            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a point in Jacobian coordinates and a point in   */
+/*    affine coordinates. Points at infinity are handled in constant      */
+/*    time. r = a + (x, y).                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Point a                       */
+/*    x                                     X coordinate of point b       */
+/*    y                                     Y coordinate of point b       */
+/*    b_infinite                            Whether point b is infinite   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_fe_add        Modular addition              */
+/*    _nx_crypto_ec_secp256r1_fe_is_zero    Check for zero                */
+/*    _nx_crypto_ec_secp256r1_fe_mul        Montgomery multiplication     */
+/*    _nx_crypto_ec_secp256r1_fe_select     Conditional copy              */
+/*    _nx_crypto_ec_secp256r1_fe_sub        Modular subtraction           */
+/*    _nx_crypto_ec_secp256r1_point_double  Perform point doubling        */
+/*    _nx_crypto_ec_secp256r1_point_select  Conditional copy of point     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_point_add_affine(NX_CRYPTO_EC_SECP256R1_POINT *r,
+                                                     NX_CRYPTO_EC_SECP256R1_POINT *a,
+                                                     const UINT *x, const UINT *y, UINT b_infinite)
+{
+NX_CRYPTO_EC_SECP256R1_POINT sum;
+UINT                         z1z1[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         h[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         hh[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         rr[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         v[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         t[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         a_infinite, mask;
+
+    a_infinite = _nx_crypto_ec_secp256r1_fe_is_zero(a -> nx_crypto_ec_secp256r1_point_z);
+
+    /* U2 = X2 * Z1^2, S2 = Y2 * Z1^3 */
+    _nx_crypto_ec_secp256r1_fe_mul(z1z1, a -> nx_crypto_ec_secp256r1_point_z, a -> nx_crypto_ec_secp256r1_point_z);
+    _nx_crypto_ec_secp256r1_fe_mul(h, x, z1z1);
+    _nx_crypto_ec_secp256r1_fe_mul(rr, a -> nx_crypto_ec_secp256r1_point_z, z1z1);
+    _nx_crypto_ec_secp256r1_fe_mul(rr, y, rr);
+
+    /* H = U2 - X1, r = 2 * (S2 - Y1) */
+    _nx_crypto_ec_secp256r1_fe_sub(h, h, a -> nx_crypto_ec_secp256r1_point_x);
+    _nx_crypto_ec_secp256r1_fe_sub(rr, rr, a -> nx_crypto_ec_secp256r1_point_y);
+
+    /* Both points are the same finite point, see _nx_crypto_ec_secp256r1_point_add. */
+    if (_nx_crypto_ec_secp256r1_fe_is_zero(h) & _nx_crypto_ec_secp256r1_fe_is_zero(rr) &
+        (a_infinite ^ 1) & (b_infinite ^ 1))
+    {
+        _nx_crypto_ec_secp256r1_point_double(r, a);
+        return;
+    }
+    _nx_crypto_ec_secp256r1_fe_add(rr, rr, rr);
+
+    /* Z3 = (Z1 + H)^2 - Z1Z1 - HH */
+    _nx_crypto_ec_secp256r1_fe_mul(hh, h, h);
+    _nx_crypto_ec_secp256r1_fe_add(t, a -> nx_crypto_ec_secp256r1_point_z, h);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, t);
+    _nx_crypto_ec_secp256r1_fe_sub(t, t, z1z1);
+    _nx_crypto_ec_secp256r1_fe_sub(sum.nx_crypto_ec_secp256r1_point_z, t, hh);
+
+    /* I = 4 * HH, J = H * I, V = X1 * I */
+    _nx_crypto_ec_secp256r1_fe_add(hh, hh, hh);
+    _nx_crypto_ec_secp256r1_fe_add(hh, hh, hh);
+    _nx_crypto_ec_secp256r1_fe_mul(h, h, hh);
+    _nx_crypto_ec_secp256r1_fe_mul(v, a -> nx_crypto_ec_secp256r1_point_x, hh);
+
+    /* X3 = r^2 - J - 2 * V */
+    _nx_crypto_ec_secp256r1_fe_mul(t, rr, rr);
+    _nx_crypto_ec_secp256r1_fe_sub(t, t, h);
+    _nx_crypto_ec_secp256r1_fe_sub(t, t, v);
+    _nx_crypto_ec_secp256r1_fe_sub(sum.nx_crypto_ec_secp256r1_point_x, t, v);
+
+    /* Y3 = r * (V - X3) - 2 * Y1 * J */
+    _nx_crypto_ec_secp256r1_fe_sub(t, v, sum.nx_crypto_ec_secp256r1_point_x);
+    _nx_crypto_ec_secp256r1_fe_mul(t, rr, t);
+    _nx_crypto_ec_secp256r1_fe_mul(h, a -> nx_crypto_ec_secp256r1_point_y, h);
+    _nx_crypto_ec_secp256r1_fe_add(h, h, h);
+    _nx_crypto_ec_secp256r1_fe_sub(sum.nx_crypto_ec_secp256r1_point_y, t, h);
+
+    /* Select the other point when either of them is the point at infinity. */
+    mask = 0 - a_infinite;
+    _nx_crypto_ec_secp256r1_fe_select(sum.nx_crypto_ec_secp256r1_point_x, x, mask);
+    _nx_crypto_ec_secp256r1_fe_select(sum.nx_crypto_ec_secp256r1_point_y, y, mask);
+    _nx_crypto_ec_secp256r1_fe_select(sum.nx_crypto_ec_secp256r1_point_z, _nx_crypto_ec_secp256r1_fe_one, mask);
+    _nx_crypto_ec_secp256r1_point_select(&sum, a, 0 - b_infinite);
+    *r = sum;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_scalar_bits                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function extracts count bits of the scalar from position.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    k                                     Scalar k                      */
+/*    position                              Position of the lowest bit    */
+/*    count                                 Number of bits                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    value                                 Extracted bits                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_ec_secp256r1_scalar_bits(const UINT *k, UINT position, UINT count)
+{
+UINT value;
+
+    value = k[position >> 5] >> (position & 31);
+    if (((position & 31) + count) > 32)
+    {
+        value |= k[(position >> 5) + 1] << (32 - (position & 31));
+    }
+
+    return(value & ((1u << count) - 1));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_point_import                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function converts an affine point of huge numbers to           */
+/*    Jacobian coordinates in Montgomery form.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    g                                     Point g                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMCPY                      Copy data                     */
+/*    _nx_crypto_ec_point_is_infinite       Check if the point is infinite*/
+/*    _nx_crypto_huge_number_extract_fixed_size                           */
+/*                                          Extract huge number           */
+/*    _nx_crypto_ec_secp256r1_fe_mul        Montgomery multiplication     */
+/*    _nx_crypto_ec_secp256r1_point_set_infinite                          */
+/*                                          Set the point to infinite     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_ec_secp256r1_point_import(NX_CRYPTO_EC_SECP256R1_POINT *r, NX_CRYPTO_EC_POINT *g)
+{
+UCHAR buffer[32];
+UINT  status;
+UINT  i;
+
+    if (_nx_crypto_ec_point_is_infinite(g))
+    {
+        _nx_crypto_ec_secp256r1_point_set_infinite(r);
+        return(NX_CRYPTO_SUCCESS);
+    }
+
+    status = _nx_crypto_huge_number_extract_fixed_size(&g -> nx_crypto_ec_point_x, buffer, sizeof(buffer));
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        r -> nx_crypto_ec_secp256r1_point_x[i] = ((UINT)buffer[31 - (i << 2)]) |
+                                                 ((UINT)buffer[30 - (i << 2)] << 8) |
+                                                 ((UINT)buffer[29 - (i << 2)] << 16) |
+                                                 ((UINT)buffer[28 - (i << 2)] << 24);
+    }
+
+    status = _nx_crypto_huge_number_extract_fixed_size(&g -> nx_crypto_ec_point_y, buffer, sizeof(buffer));
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        r -> nx_crypto_ec_secp256r1_point_y[i] = ((UINT)buffer[31 - (i << 2)]) |
+                                                 ((UINT)buffer[30 - (i << 2)] << 8) |
+                                                 ((UINT)buffer[29 - (i << 2)] << 16) |
+                                                 ((UINT)buffer[28 - (i << 2)] << 24);
+    }
+
+    /* Convert to Montgomery form. */
+    _nx_crypto_ec_secp256r1_fe_mul(r -> nx_crypto_ec_secp256r1_point_x, r -> nx_crypto_ec_secp256r1_point_x,
+                                   _nx_crypto_ec_secp256r1_fe_r2);
+    _nx_crypto_ec_secp256r1_fe_mul(r -> nx_crypto_ec_secp256r1_point_y, r -> nx_crypto_ec_secp256r1_point_y,
+                                   _nx_crypto_ec_secp256r1_fe_r2);
+    NX_CRYPTO_MEMCPY(r -> nx_crypto_ec_secp256r1_point_z, _nx_crypto_ec_secp256r1_fe_one, sizeof(r -> nx_crypto_ec_secp256r1_point_z)); /* Use case of memcpy is verified. */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_point_export                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function converts a point in Jacobian coordinates to an        */
+/*    affine point of huge numbers.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    a                                     Point a                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*    _nx_crypto_ec_point_set_infinite      Set the point to infinite     */
+/*    _nx_crypto_huge_number_setup          Setup huge number             */
+/*    _nx_crypto_ec_secp256r1_fe_inverse    Modular inversion             */
+/*    _nx_crypto_ec_secp256r1_fe_is_zero    Check for zero                */
+/*    _nx_crypto_ec_secp256r1_fe_mul        Montgomery multiplication     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_point_export(NX_CRYPTO_EC_POINT *r, NX_CRYPTO_EC_SECP256R1_POINT *a)
+{
+UINT  zinv[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT  t[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT  value[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UCHAR buffer[32];
+UINT  i;
+
+    if (_nx_crypto_ec_secp256r1_fe_is_zero(a -> nx_crypto_ec_secp256r1_point_z))
+    {
+        _nx_crypto_ec_point_set_infinite(r);
+        return;
+    }
+
+    /* x = X / Z^2, y = Y / Z^3. Multiplying by 1 converts out of Montgomery form. */
+    _nx_crypto_ec_secp256r1_fe_inverse(zinv, a -> nx_crypto_ec_secp256r1_point_z);
+    _nx_crypto_ec_secp256r1_fe_mul(t, zinv, zinv);
+    _nx_crypto_ec_secp256r1_fe_mul(zinv, zinv, t);
+    NX_CRYPTO_MEMSET(value, 0, sizeof(value));
+    value[0] = 1;
+    _nx_crypto_ec_secp256r1_fe_mul(t, a -> nx_crypto_ec_secp256r1_point_x, t);
+    _nx_crypto_ec_secp256r1_fe_mul(t, t, value);
+    _nx_crypto_ec_secp256r1_fe_mul(zinv, a -> nx_crypto_ec_secp256r1_point_y, zinv);
+    _nx_crypto_ec_secp256r1_fe_mul(value, zinv, value);
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        buffer[31 - (i << 2)] = (UCHAR)t[i];
+        buffer[30 - (i << 2)] = (UCHAR)(t[i] >> 8);
+        buffer[29 - (i << 2)] = (UCHAR)(t[i] >> 16);
+        buffer[28 - (i << 2)] = (UCHAR)(t[i] >> 24);
+    }
+    _nx_crypto_huge_number_setup(&r -> nx_crypto_ec_point_x, buffer, sizeof(buffer));
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        buffer[31 - (i << 2)] = (UCHAR)value[i];
+        buffer[30 - (i << 2)] = (UCHAR)(value[i] >> 8);
+        buffer[29 - (i << 2)] = (UCHAR)(value[i] >> 16);
+        buffer[28 - (i << 2)] = (UCHAR)(value[i] >> 24);
+    }
+    _nx_crypto_huge_number_setup(&r -> nx_crypto_ec_point_y, buffer, sizeof(buffer));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_scalar_import               PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function converts a huge number of at most 256 bits to         */
+/*    limbs.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    k                                     Result k                      */
+/*    d                                     Huge number d                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*    _nx_crypto_huge_number_extract_fixed_size                           */
+/*                                          Extract huge number           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_ec_secp256r1_scalar_import(UINT *k, NX_CRYPTO_HUGE_NUMBER *d)
+{
+UCHAR buffer[32];
+UINT  status;
+UINT  i;
+
+    status = _nx_crypto_huge_number_extract_fixed_size(d, buffer, sizeof(buffer));
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        k[i] = ((UINT)buffer[31 - (i << 2)]) |
+               ((UINT)buffer[30 - (i << 2)] << 8) |
+               ((UINT)buffer[29 - (i << 2)] << 16) |
+               ((UINT)buffer[28 - (i << 2)] << 24);
+    }
+
+    /* One more zero limb so that windows may run past the top bit. */
+    k[NX_CRYPTO_EC_SECP256R1_LIMBS] = 0;
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(buffer, 0, sizeof(buffer));
+#endif /* NX_SECURE_KEY_CLEAR */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_window_multiple             PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function calculates the multiplication of an unknown point     */
+/*    with a signed fixed window. Every window performs the same          */
+/*    operations and the table is read in full, so the time does not      */
+/*    depend on the scalar. r = g * k.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    g                                     Point g                       */
+/*    k                                     Scalar k                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*    _nx_crypto_ec_secp256r1_fe_select     Conditional copy              */
+/*    _nx_crypto_ec_secp256r1_fe_sub        Modular subtraction           */
+/*    _nx_crypto_ec_secp256r1_point_add     Perform point addition        */
+/*    _nx_crypto_ec_secp256r1_point_double  Perform point doubling        */
+/*    _nx_crypto_ec_secp256r1_point_select  Conditional copy of point     */
+/*    _nx_crypto_ec_secp256r1_point_set_infinite                          */
+/*                                          Set the point to infinite     */
+/*    _nx_crypto_ec_secp256r1_scalar_bits   Extract bits of scalar        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_window_multiple(NX_CRYPTO_EC_SECP256R1_POINT *r,
+                                                    NX_CRYPTO_EC_SECP256R1_POINT *g,
+                                                    const UINT *k)
+{
+NX_CRYPTO_EC_SECP256R1_POINT table[1 << (NX_CRYPTO_EC_SECP256R1_WINDOW_WIDTH - 1)];
+NX_CRYPTO_EC_SECP256R1_POINT selected;
+UINT                         negative_y[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT                         window, value, digit, sign, mask;
+UINT                         i, j;
+
+    /* table[i] = (i + 1) * g */
+    table[0] = *g;
+    _nx_crypto_ec_secp256r1_point_double(&table[1], g);
+    for (i = 2; i < (1u << (NX_CRYPTO_EC_SECP256R1_WINDOW_WIDTH - 1)); i++)
+    {
+        _nx_crypto_ec_secp256r1_point_add(&table[i], &table[i - 1], g);
+    }
+
+    _nx_crypto_ec_secp256r1_point_set_infinite(r);
+
+    /* Signed (Booth) recoding: each window of 4 bits together with the top bit of the window
+       below gives a digit in [-8, 8]. The digits are applied from the most significant window. */
+    for (window = (256 / NX_CRYPTO_EC_SECP256R1_WINDOW_WIDTH) + 1; window > 0; window--)
+    {
+        for (i = 0; i < NX_CRYPTO_EC_SECP256R1_WINDOW_WIDTH; i++)
+        {
+            _nx_crypto_ec_secp256r1_point_double(r, r);
+        }
+
+        if (window == 1)
+        {
+            value = (k[0] << 1) & 0x1F;
+        }
+        else
+        {
+            value = _nx_crypto_ec_secp256r1_scalar_bits(k, ((window - 1) * NX_CRYPTO_EC_SECP256R1_WINDOW_WIDTH) - 1,
+                                                        NX_CRYPTO_EC_SECP256R1_WINDOW_WIDTH + 1);
+        }
+
+        /* sign is set when the top bit of the 5-bit value is set, the digit is then negative. */
+        sign = value >> NX_CRYPTO_EC_SECP256R1_WINDOW_WIDTH;
+        mask = 0 - sign;
+        digit = ((0x1F - value) & mask) | (value & ~mask);
+        digit = (digit >> 1) + (digit & 1);
+
+        /* Look up the point in constant time. A zero digit leaves the point at infinity. */
+        _nx_crypto_ec_secp256r1_point_set_infinite(&selected);
+        for (j = 0; j < (1u << (NX_CRYPTO_EC_SECP256R1_WINDOW_WIDTH - 1)); j++)
+        {
+            mask = (((j + 1) ^ digit) - 1) >> 31;
+            _nx_crypto_ec_secp256r1_point_select(&selected, &table[j], 0 - mask);
+        }
+        _nx_crypto_ec_secp256r1_fe_sub(negative_y, _nx_crypto_ec_secp256r1_fe_p, selected.nx_crypto_ec_secp256r1_point_y);
+        _nx_crypto_ec_secp256r1_fe_select(selected.nx_crypto_ec_secp256r1_point_y, negative_y, 0 - sign);
+
+        _nx_crypto_ec_secp256r1_point_add(r, r, &selected);
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(table, 0, sizeof(table));
+    NX_CRYPTO_MEMSET(&selected, 0, sizeof(selected));
+#endif /* NX_SECURE_KEY_CLEAR */
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_comb_multiple               PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function calculates the multiplication of the base point       */
+/*    with the precomputed comb tables in constant time. r = G * k.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result r                      */
+/*    k                                     Scalar k                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*    _nx_crypto_ec_secp256r1_fe_select     Conditional copy              */
+/*    _nx_crypto_ec_secp256r1_point_add_affine                            */
+/*                                          Perform mixed point addition  */
+/*    _nx_crypto_ec_secp256r1_point_double  Perform point doubling        */
+/*    _nx_crypto_ec_secp256r1_point_set_infinite                          */
+/*                                          Set the point to infinite     */
+/*    _nx_crypto_ec_secp256r1_scalar_bits   Extract bits of scalar        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_comb_multiple(NX_CRYPTO_EC_SECP256R1_POINT *r, const UINT *k)
+{
+UINT x[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT y[NX_CRYPTO_EC_SECP256R1_LIMBS];
+UINT index, mask;
+INT  i;
+UINT j, bit;
+
+    _nx_crypto_ec_secp256r1_point_set_infinite(r);
+
+    for (i = NX_CRYPTO_EC_SECP256R1_COMB_E - 1; i >= 0; i--)
+    {
+        _nx_crypto_ec_secp256r1_point_double(r, r);
+
+        /* Two columns are processed per doubling, the second one comes from the 2e table. */
+        for (bit = (UINT)i; bit < NX_CRYPTO_EC_SECP256R1_COMB_D; bit += NX_CRYPTO_EC_SECP256R1_COMB_E)
+        {
+            index = 0;
+            for (j = 0; j < NX_CRYPTO_EC_SECP256R1_COMB_WIDTH; j++)
+            {
+                index |= _nx_crypto_ec_secp256r1_scalar_bits(k, bit + (j * NX_CRYPTO_EC_SECP256R1_COMB_D), 1) << j;
+            }
+
+            /* Look up the point in constant time. */
+            NX_CRYPTO_MEMSET(x, 0, sizeof(x));
+            NX_CRYPTO_MEMSET(y, 0, sizeof(y));
+            for (j = 0; j < (1u << NX_CRYPTO_EC_SECP256R1_COMB_WIDTH) - 1; j++)
+            {
+                mask = 0 - ((((j + 1) ^ index) - 1) >> 31);
+                if (bit < NX_CRYPTO_EC_SECP256R1_COMB_E)
+                {
+                    _nx_crypto_ec_secp256r1_fe_select(x, &_nx_crypto_ec_secp256r1_comb[j][0], mask);
+                    _nx_crypto_ec_secp256r1_fe_select(y, &_nx_crypto_ec_secp256r1_comb[j][NX_CRYPTO_EC_SECP256R1_LIMBS], mask);
+                }
+                else
+                {
+                    _nx_crypto_ec_secp256r1_fe_select(x, &_nx_crypto_ec_secp256r1_comb_2e[j][0], mask);
+                    _nx_crypto_ec_secp256r1_fe_select(y, &_nx_crypto_ec_secp256r1_comb_2e[j][NX_CRYPTO_EC_SECP256R1_LIMBS], mask);
+                }
+            }
+
+            _nx_crypto_ec_secp256r1_point_add_affine(r, r, x, y, ((index | (0 - index)) >> 31) ^ 1);
+        }
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(x, 0, sizeof(x));
+    NX_CRYPTO_MEMSET(y, 0, sizeof(y));
+#endif /* NX_SECURE_KEY_CLEAR */
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_wnaf_compute                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the width-w non-adjacent form of the         */
+/*    scalar. The digits are odd or zero and less than 2^(w-1) in         */
+/*    magnitude.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    naf                                   Result digits                 */
+/*    k                                     Scalar k                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_secp256r1_wnaf_compute(CHAR *naf, const UINT *k)
+{
+UINT    t[NX_CRYPTO_EC_SECP256R1_LIMBS + 1];
+ULONG64 carry;
+INT     digit;
+UINT    i, j;
+
+    for (i = 0; i <= NX_CRYPTO_EC_SECP256R1_LIMBS; i++)
+    {
+        t[i] = k[i];
+    }
+
+    for (i = 0; i <= 256; i++)
+    {
+        digit = 0;
+        if (t[0] & 1)
+        {
+
+            /* Take the odd residue of t modulo 2^w in the range [-2^(w-1), 2^(w-1)). */
+            digit = (INT)(t[0] & ((1u << NX_CRYPTO_EC_SECP256R1_WNAF_WIDTH) - 1));
+            if (digit >= (1 << (NX_CRYPTO_EC_SECP256R1_WNAF_WIDTH - 1)))
+            {
+                digit -= (1 << NX_CRYPTO_EC_SECP256R1_WNAF_WIDTH);
+            }
+
+            /* t = t - digit */
+            if (digit > 0)
+            {
+                carry = (ULONG64)t[0] - (UINT)digit;
+                t[0] = (UINT)carry;
+                for (j = 1; (j <= NX_CRYPTO_EC_SECP256R1_LIMBS) && (carry >> 63); j++)
+                {
+                    carry = (ULONG64)t[j] - 1;
+                    t[j] = (UINT)carry;
+                }
+            }
+            else
+            {
+                carry = (ULONG64)t[0] + (UINT)(-digit);
+                t[0] = (UINT)carry;
+                for (j = 1; (j <= NX_CRYPTO_EC_SECP256R1_LIMBS) && (carry >> 32); j++)
+                {
+                    carry = (ULONG64)t[j] + 1;
+                    t[j] = (UINT)carry;
+                }
+            }
+        }
+        naf[i] = (CHAR)digit;
+
+        /* t = t / 2 */
+        for (j = 0; j < NX_CRYPTO_EC_SECP256R1_LIMBS; j++)
+        {
+            t[j] = (t[j] >> 1) | (t[j + 1] << 31);
+        }
+        t[NX_CRYPTO_EC_SECP256R1_LIMBS] >>= 1;
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_multiple                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function calculates the multiplication on secp256r1 with       */
+/*    fixed width field arithmetic. The base point uses the               */
+/*    precomputed comb tables. r = g * d.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    curve                                 Pointer to curve              */
+/*    g                                     Base point g                  */
+/*    d                                     Factor d                      */
+/*    r                                     Result r                      */
+/*    scratch                               Pointer to scratch buffer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
+/*                                            multiplication              */
+/*    _nx_crypto_ec_secp256r1_comb_multiple Multiply the base point       */
+/*    _nx_crypto_ec_secp256r1_point_export  Convert point to huge numbers */
+/*    _nx_crypto_ec_secp256r1_point_import  Convert point from huge       */
+/*                                            numbers                     */
+/*    _nx_crypto_ec_secp256r1_scalar_import Convert scalar to limbs       */
+/*    _nx_crypto_ec_secp256r1_window_multiple                             */
+/*                                          Multiply an unknown point     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_multiple(NX_CRYPTO_EC *curve,
+                                                     NX_CRYPTO_EC_POINT *g,
+                                                     NX_CRYPTO_HUGE_NUMBER *d,
+                                                     NX_CRYPTO_EC_POINT *r,
+                                                     HN_UBASE *scratch)
+{
+NX_CRYPTO_EC_SECP256R1_POINT point;
+UINT                         k[NX_CRYPTO_EC_SECP256R1_LIMBS + 1];
+
+    if (_nx_crypto_ec_secp256r1_scalar_import(k, d) != NX_CRYPTO_SUCCESS)
+    {
+
+        /* The factor does not fit in 256 bits. */
+        _nx_crypto_ec_fp_projective_multiple(curve, g, d, r, scratch);
+        return;
+    }
+
+    if (g == &curve -> nx_crypto_ec_g)
+    {
+        _nx_crypto_ec_secp256r1_comb_multiple(&point, k);
+    }
+    else
+    {
+        if (_nx_crypto_ec_secp256r1_point_import(&point, g) != NX_CRYPTO_SUCCESS)
+        {
+            _nx_crypto_ec_fp_projective_multiple(curve, g, d, r, scratch);
+            return;
+        }
+        _nx_crypto_ec_secp256r1_window_multiple(&point, &point, k);
+    }
+
+    _nx_crypto_ec_secp256r1_point_export(r, &point);
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(k, 0, sizeof(k));
+    NX_CRYPTO_MEMSET(&point, 0, sizeof(point));
+#endif /* NX_SECURE_KEY_CLEAR */
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_multiple_add                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function calculates u1 * G + u2 * q on secp256r1 with a        */
+/*    single chain of doublings (Shamir's trick). It is not constant      */
+/*    time and must only be used with public inputs, such as in           */
+/*    signature verification.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    curve                                 Pointer to curve              */
+/*    u1                                    Factor of base point          */
+/*    q                                     Point q                       */
+/*    u2                                    Factor of point q             */
+/*    r                                     Result r                      */
+/*    scratch                               Pointer to scratch buffer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_point_set_infinite      Set the point to infinite     */
+/*    _nx_crypto_ec_secp256r1_fe_sub        Modular subtraction           */
+/*    _nx_crypto_ec_secp256r1_point_add     Perform point addition        */
+/*    _nx_crypto_ec_secp256r1_point_add_affine                            */
+/*                                          Perform mixed point addition  */
+/*    _nx_crypto_ec_secp256r1_point_double  Perform point doubling        */
+/*    _nx_crypto_ec_secp256r1_point_export  Convert point to huge numbers */
+/*    _nx_crypto_ec_secp256r1_point_import  Convert point from huge       */
+/*                                            numbers                     */
+/*    _nx_crypto_ec_secp256r1_point_set_infinite                          */
+/*                                          Set the point to infinite     */
+/*    _nx_crypto_ec_secp256r1_scalar_import Convert scalar to limbs       */
+/*    _nx_crypto_ec_secp256r1_wnaf_compute  Compute the non-adjacent form */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ecdsa_verify               Verify ECDSA signature        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_multiple_add(NX_CRYPTO_EC *curve,
+                                                         NX_CRYPTO_HUGE_NUMBER *u1,
+                                                         NX_CRYPTO_EC_POINT *q,
+                                                         NX_CRYPTO_HUGE_NUMBER *u2,
+                                                         NX_CRYPTO_EC_POINT *r,
+                                                         HN_UBASE *scratch)
+{
+NX_CRYPTO_EC_SECP256R1_POINT table[1 << (NX_CRYPTO_EC_SECP256R1_WNAF_WIDTH - 2)];
+NX_CRYPTO_EC_SECP256R1_POINT result;
+NX_CRYPTO_EC_SECP256R1_POINT temp;
+UINT                         k1[NX_CRYPTO_EC_SECP256R1_LIMBS + 1];
+UINT                         k2[NX_CRYPTO_EC_SECP256R1_LIMBS + 1];
+UINT                         y[NX_CRYPTO_EC_SECP256R1_LIMBS];
+CHAR                         naf1[257];
+CHAR                         naf2[257];
+INT                          i;
+UINT                         j, started = NX_CRYPTO_FALSE;
+
+    NX_CRYPTO_PARAMETER_NOT_USED(curve);
+    NX_CRYPTO_PARAMETER_NOT_USED(scratch);
+
+    if ((_nx_crypto_ec_secp256r1_scalar_import(k1, u1) != NX_CRYPTO_SUCCESS) ||
+        (_nx_crypto_ec_secp256r1_scalar_import(k2, u2) != NX_CRYPTO_SUCCESS) ||
+        (_nx_crypto_ec_secp256r1_point_import(&table[0], q) != NX_CRYPTO_SUCCESS))
+    {
+        _nx_crypto_ec_point_set_infinite(r);
+        return;
+    }
+
+    _nx_crypto_ec_secp256r1_wnaf_compute(naf1, k1);
+    _nx_crypto_ec_secp256r1_wnaf_compute(naf2, k2);
+
+    /* table[i] = (2 * i + 1) * q */
+    _nx_crypto_ec_secp256r1_point_double(&temp, &table[0]);
+    for (j = 1; j < (1u << (NX_CRYPTO_EC_SECP256R1_WNAF_WIDTH - 2)); j++)
+    {
+        _nx_crypto_ec_secp256r1_point_add(&table[j], &table[j - 1], &temp);
+    }
+
+    /* Shamir's trick: both factors share the same chain of doublings. All the inputs
+       are public, so zero digits are simply skipped. */
+    _nx_crypto_ec_secp256r1_point_set_infinite(&result);
+    for (i = 256; i >= 0; i--)
+    {
+        if (started)
+        {
+            _nx_crypto_ec_secp256r1_point_double(&result, &result);
+        }
+
+        if (naf1[i] > 0)
+        {
+            _nx_crypto_ec_secp256r1_point_add_affine(&result, &result,
+                                                     &_nx_crypto_ec_secp256r1_g_odd[naf1[i] >> 1][0],
+                                                     &_nx_crypto_ec_secp256r1_g_odd[naf1[i] >> 1][NX_CRYPTO_EC_SECP256R1_LIMBS],
+                                                     NX_CRYPTO_FALSE);
+            started = NX_CRYPTO_TRUE;
+        }
+        else if (naf1[i] < 0)
+        {
+            _nx_crypto_ec_secp256r1_fe_sub(y, _nx_crypto_ec_secp256r1_fe_p,
+                                           &_nx_crypto_ec_secp256r1_g_odd[(-naf1[i]) >> 1][NX_CRYPTO_EC_SECP256R1_LIMBS]);
+            _nx_crypto_ec_secp256r1_point_add_affine(&result, &result,
+                                                     &_nx_crypto_ec_secp256r1_g_odd[(-naf1[i]) >> 1][0],
+                                                     y, NX_CRYPTO_FALSE);
+            started = NX_CRYPTO_TRUE;
+        }
+
+        if (naf2[i] > 0)
+        {
+            _nx_crypto_ec_secp256r1_point_add(&result, &result, &table[naf2[i] >> 1]);
+            started = NX_CRYPTO_TRUE;
+        }
+        else if (naf2[i] < 0)
+        {
+            temp = table[(-naf2[i]) >> 1];
+            _nx_crypto_ec_secp256r1_fe_sub(temp.nx_crypto_ec_secp256r1_point_y, _nx_crypto_ec_secp256r1_fe_p,
+                                           temp.nx_crypto_ec_secp256r1_point_y);
+            _nx_crypto_ec_secp256r1_point_add(&result, &result, &temp);
+            started = NX_CRYPTO_TRUE;
+        }
+    }
+
+    _nx_crypto_ec_secp256r1_point_export(r, &result);
+}
+#endif /* NX_CRYPTO_ECC_DISABLE_SECP256R1_BACKEND */
@@ -33,7 +33,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_ecdh_key_pair_import                     PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -71,6 +71,9 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            added X25519 support,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_ecdh_key_pair_import(NX_CRYPTO_ECDH  *ecdh_ptr,
@@ -85,6 +88,25 @@ NX_CRYPTO_HUGE_NUMBER private_key;
 
     NX_CRYPTO_PARAMETER_NOT_USED(local_public_key_ptr);
 
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+    {
+
+        /* X25519 private keys are stored as the raw 32-byte little-endian scalar. */
+        if ((local_private_key_len != NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES) ||
+            (local_public_key_len > NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES))
+        {
+            return(NX_CRYPTO_SIZE_ERROR);
+        }
+
+        ecdh_ptr -> nx_crypto_ecdh_key_size = NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES;
+        NX_CRYPTO_MEMSET(ecdh_ptr -> nx_crypto_ecdh_private_key_buffer, 0,
+                         sizeof(ecdh_ptr -> nx_crypto_ecdh_private_key_buffer));
+        NX_CRYPTO_MEMCPY(ecdh_ptr -> nx_crypto_ecdh_private_key_buffer, local_private_key_ptr,
+                         NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES); /* Use case of memcpy is verified. */
+
+        return(NX_CRYPTO_SUCCESS);
+    }
+
     if (local_private_key_len > sizeof(ecdh_ptr -> nx_crypto_ecdh_private_key_buffer))
     {
         return(NX_CRYPTO_SIZE_ERROR);
@@ -116,7 +138,7 @@ NX_CRYPTO_HUGE_NUMBER private_key;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_ecdh_private_key_export                  PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -152,6 +174,9 @@ NX_CRYPTO_HUGE_NUMBER private_key;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            added X25519 support,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_crypto_ecdh_private_key_export(NX_CRYPTO_ECDH  *ecdh_ptr,
@@ -174,6 +199,20 @@ NX_CRYPTO_HUGE_NUMBER private_key;
 
     curve = ecdh_ptr -> nx_crypto_ecdh_curve;
 
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+    {
+        if (local_private_key_len < NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES)
+        {
+            return(NX_CRYPTO_SIZE_ERROR);
+        }
+
+        NX_CRYPTO_MEMCPY(local_private_key_ptr, ecdh_ptr -> nx_crypto_ecdh_private_key_buffer,
+                         NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES); /* Use case of memcpy is verified. */
+        *actual_local_private_key_len = NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES;
+
+        return(NX_CRYPTO_SUCCESS);
+    }
+
     /* Figure out the sizes of our keys and buffers. */
     key_size = ecdh_ptr -> nx_crypto_ecdh_key_size;
 
@@ -204,7 +243,7 @@ NX_CRYPTO_HUGE_NUMBER private_key;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_ecdh_setup                               PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -237,6 +276,8 @@ NX_CRYPTO_HUGE_NUMBER private_key;
 /*                                                                        */
 /*    _nx_crypto_ec_key_pair_generation_extra                             */
 /*                                          Generate EC Key Pair          */
+/*    _nx_crypto_x25519_base_multiple       Compute X25519 public key     */
+/*    NX_CRYPTO_RBG                         Generate random number        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -249,6 +290,9 @@ NX_CRYPTO_HUGE_NUMBER private_key;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            added X25519 support,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_ecdh_setup(NX_CRYPTO_ECDH  *ecdh_ptr,
@@ -263,6 +307,32 @@ UINT public_key_len;
 NX_CRYPTO_HUGE_NUMBER private_key;
 NX_CRYPTO_EC_POINT    public_key;
 
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+    {
+        if (local_public_key_len < NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES)
+        {
+            return(NX_CRYPTO_SIZE_ERROR);
+        }
+
+        ecdh_ptr -> nx_crypto_ecdh_curve = curve;
+        ecdh_ptr -> nx_crypto_ecdh_key_size = NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES;
+
+        /* The private key is 32 random bytes; clamping is applied by the scalar multiplication. */
+        NX_CRYPTO_MEMSET(ecdh_ptr -> nx_crypto_ecdh_private_key_buffer, 0,
+                         sizeof(ecdh_ptr -> nx_crypto_ecdh_private_key_buffer));
+        if (NX_CRYPTO_RBG(NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES << 3,
+                          (UCHAR *)ecdh_ptr -> nx_crypto_ecdh_private_key_buffer) != NX_CRYPTO_SUCCESS)
+        {
+            return(NX_CRYPTO_NOT_SUCCESSFUL);
+        }
+
+        _nx_crypto_x25519_base_multiple(local_public_key_ptr,
+                                        (UCHAR *)ecdh_ptr -> nx_crypto_ecdh_private_key_buffer);
+        *actual_local_public_key_len = NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES;
+
+        return(NX_CRYPTO_SUCCESS);
+    }
+
     public_key_len = 1 + (((curve -> nx_crypto_ec_bits + 7) >> 3) << 1);
     if (local_public_key_len < public_key_len)
     {
@@ -311,7 +381,7 @@ NX_CRYPTO_EC_POINT    public_key;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_ecdh_compute_secret                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -345,6 +415,7 @@ NX_CRYPTO_EC_POINT    public_key;
 /*                                                                        */
 /*    _nx_crypto_huge_number_extract        Extract huge number           */
 /*    _nx_crypto_huge_number_setup          Setup huge number             */
+/*    _nx_crypto_x25519_multiple            Compute X25519 shared secret  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -358,6 +429,9 @@ NX_CRYPTO_EC_POINT    public_key;
 /*  09-30-2020     Timothy Stapko           Modified comment(s), and      */
 /*                                            added public key validation,*/
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            added X25519 support,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_ecdh_compute_secret(NX_CRYPTO_ECDH  *ecdh_ptr,
@@ -385,6 +459,34 @@ NX_CRYPTO_EC_POINT    public_key, shared_secret;
 
     curve = ecdh_ptr -> nx_crypto_ecdh_curve;
 
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+    {
+        if ((remote_public_key_len != NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES) ||
+            (share_secret_key_len_ptr < NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES))
+        {
+            return(NX_CRYPTO_SIZE_ERROR);
+        }
+
+        _nx_crypto_x25519_multiple(share_secret_key_ptr,
+                                   (UCHAR *)ecdh_ptr -> nx_crypto_ecdh_private_key_buffer,
+                                   remote_public_key);
+
+        /* Reject small-order peer keys, which yield the all-zero shared secret (RFC 7748, section 6.1). */
+        clen = 0;
+        for (key_size = 0; key_size < NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES; key_size++)
+        {
+            clen |= share_secret_key_ptr[key_size];
+        }
+        if (clen == 0)
+        {
+            return(NX_CRYPTO_NOT_SUCCESSFUL);
+        }
+
+        *actual_share_secret_key_len = NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES;
+
+        return(NX_CRYPTO_SUCCESS);
+    }
+
     /* Figure out the sizes of our keys and buffers. We need 4X the key size for our buffer space. */
     key_size = ecdh_ptr -> nx_crypto_ecdh_key_size;
 
@@ -583,7 +685,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_ecdh_cleanup(VOID *crypto_metadata)
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_method_ecdh_operation                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -629,6 +731,9 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_ecdh_cleanup(VOID *crypto_metadata)
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            added X25519 support,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_method_ecdh_operation(UINT op,
@@ -691,6 +796,34 @@ NX_CRYPTO_EXTENDED_OUTPUT
         }
 
         extended_output = (NX_CRYPTO_EXTENDED_OUTPUT *)output;
+        if (ecdh -> nx_crypto_ecdh_curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+        {
+
+            /* Output the 32-byte private key followed by the 32-byte public key. */
+            if (extended_output -> nx_crypto_extended_output_length_in_byte <
+                (NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES << 1))
+            {
+                return(NX_CRYPTO_SIZE_ERROR);
+            }
+
+            status = _nx_crypto_ecdh_setup(ecdh,
+                                           extended_output -> nx_crypto_extended_output_data +
+                                           NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES,
+                                           NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES,
+                                           &extended_output -> nx_crypto_extended_output_actual_size,
+                                           ecdh -> nx_crypto_ecdh_curve,
+                                           ecdh -> nx_crypto_ecdh_scratch_buffer);
+            if (status == NX_CRYPTO_SUCCESS)
+            {
+                NX_CRYPTO_MEMCPY(extended_output -> nx_crypto_extended_output_data,
+                                 ecdh -> nx_crypto_ecdh_private_key_buffer,
+                                 NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES); /* Use case of memcpy is verified. */
+                extended_output -> nx_crypto_extended_output_actual_size = NX_CRYPTO_CURVE25519_KEY_SIZE_IN_BYTES << 1;
+            }
+
+            return(status);
+        }
+
         status = _nx_crypto_ec_key_pair_stream_generate(ecdh -> nx_crypto_ecdh_curve,
                                                         extended_output -> nx_crypto_extended_output_data,
                                                         extended_output -> nx_crypto_extended_output_length_in_byte,
@@ -268,7 +268,7 @@ UCHAR                *signature_s;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_ecdsa_verify                             PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -311,6 +311,9 @@ UCHAR                *signature_s;
 /*                                            fixed input validation,     */
 /*                                            added public key validation,*/
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            combined multiplication,    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_ecdsa_verify(NX_CRYPTO_EC *curve, UCHAR *hash, UINT hash_length,
@@ -461,10 +464,19 @@ UINT                  buffer_size = curve -> nx_crypto_ec_n.nx_crypto_huge_buffe
     _nx_crypto_huge_number_modulus(&u2, &curve -> nx_crypto_ec_n);
 
     /* Calculate (x1,y1) = u1*G + u2*public_key */
-    curve -> nx_crypto_ec_multiple(curve, &curve -> nx_crypto_ec_g, &u1, &pt, scratch);
-    curve -> nx_crypto_ec_multiple(curve, &pubkey, &u2, &pt2, scratch);
+    if (curve -> nx_crypto_ec_multiple_add)
+    {
 
-    curve -> nx_crypto_ec_add(curve, &pt, &pt2, scratch);
+        /* Both multiplications share one chain of doublings. */
+        curve -> nx_crypto_ec_multiple_add(curve, &u1, &pubkey, &u2, &pt, scratch);
+    }
+    else
+    {
+        curve -> nx_crypto_ec_multiple(curve, &curve -> nx_crypto_ec_g, &u1, &pt, scratch);
+        curve -> nx_crypto_ec_multiple(curve, &pubkey, &u2, &pt2, scratch);
+
+        curve -> nx_crypto_ec_add(curve, &pt, &pt2, scratch);
+    }
 
     _nx_crypto_huge_number_modulus(&pt.nx_crypto_ec_point_x, &curve -> nx_crypto_ec_n);
 
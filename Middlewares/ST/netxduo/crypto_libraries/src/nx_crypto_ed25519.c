@@ -0,0 +1,1000 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Ed25519 Digital Signature Algorithm                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#include "nx_crypto_ed25519.h"
+
+/* Group order L = 2^252 + 27742317777372353535851937790883648493 */
+static NX_CRYPTO_CONST UINT _nx_crypto_ed25519_order[8] =
+{
+    0x5CF5D3ED, 0x5812631A, 0xA2F79CD6, 0x14DEF9DE,
+    0x00000000, 0x00000000, 0x00000000, 0x10000000
+};
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ed25519_scalar_reduce                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reduces a little endian number of up to 64 bytes      */
+/*    modulo the group order L. The reduction shifts in one bit at a      */
+/*    time followed by a conditional subtraction, so the run time only    */
+/*    depends on the input length.                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     32-byte result                */
+/*    x                                     Little endian input           */
+/*    length                                Input length, at most 64      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ed25519_scalar_reduce(UCHAR *r, const UCHAR *x, UINT length)
+{
+UINT    acc[8];
+UINT    t[8];
+ULONG64 diff;
+UINT    bit, borrow, mask;
+INT     i;
+UINT    j;
+
+    for (j = 0; j < 8; j++)
+    {
+        acc[j] = 0;
+    }
+
+    for (i = (INT)(length << 3) - 1; i >= 0; i--)
+    {
+
+        /* acc = 2 * acc + bit, which stays below 2^254 since acc < L. */
+        bit = (x[i >> 3] >> (i & 7)) & 1;
+        for (j = 7; j > 0; j--)
+        {
+            acc[j] = (acc[j] << 1) | (acc[j - 1] >> 31);
+        }
+        acc[0] = (acc[0] << 1) | bit;
+
+        /* Subtract L if acc >= L. */
+        borrow = 0;
+        for (j = 0; j < 8; j++)
+        {
+            diff = (ULONG64)acc[j] - _nx_crypto_ed25519_order[j] - borrow;
+            t[j] = (UINT)diff;
+            borrow = (UINT)(diff >> 63);
+        }
+        mask = borrow - 1;
+        for (j = 0; j < 8; j++)
+        {
+            acc[j] = (t[j] & mask) | (acc[j] & ~mask);
+        }
+    }
+
+    for (j = 0; j < 32; j++)
+    {
+        r[j] = (UCHAR)(acc[j >> 2] >> ((j & 3) << 3));
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ed25519_scalar_muladd                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes (a * b + c) mod L for 32-byte little endian  */
+/*    scalars.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     32-byte result                */
+/*    a                                     Scalar a                      */
+/*    b                                     Scalar b, below L             */
+/*    c                                     Scalar c, below L             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ed25519_scalar_reduce      Reduce modulo L               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ed25519_scalar_muladd(UCHAR *r, const UCHAR *a, const UCHAR *b, const UCHAR *c)
+{
+UINT    aw[8];
+UINT    bw[8];
+UINT    product[16];
+UCHAR   buffer[64];
+ULONG64 t;
+UINT    i, j;
+
+    for (i = 0; i < 8; i++)
+    {
+        aw[i] = (UINT)a[i << 2] | ((UINT)a[(i << 2) + 1] << 8) |
+                ((UINT)a[(i << 2) + 2] << 16) | ((UINT)a[(i << 2) + 3] << 24);
+        bw[i] = (UINT)b[i << 2] | ((UINT)b[(i << 2) + 1] << 8) |
+                ((UINT)b[(i << 2) + 2] << 16) | ((UINT)b[(i << 2) + 3] << 24);
+        product[i] = (UINT)c[i << 2] | ((UINT)c[(i << 2) + 1] << 8) |
+                     ((UINT)c[(i << 2) + 2] << 16) | ((UINT)c[(i << 2) + 3] << 24);
+        product[i + 8] = 0;
+    }
+
+    /* a < 2^256 and b < 2^253, so a * b + c does not overflow 512 bits. */
+    for (i = 0; i < 8; i++)
+    {
+        t = 0;
+        for (j = 0; j < 8; j++)
+        {
+            t += (ULONG64)aw[i] * bw[j] + product[i + j];
+            product[i + j] = (UINT)t;
+            t >>= 32;
+        }
+        for (j = i + 8; (j < 16) && t; j++)
+        {
+            t += product[j];
+            product[j] = (UINT)t;
+            t >>= 32;
+        }
+    }
+
+    for (i = 0; i < 64; i++)
+    {
+        buffer[i] = (UCHAR)(product[i >> 2] >> ((i & 3) << 3));
+    }
+
+    _nx_crypto_ed25519_scalar_reduce(r, buffer, sizeof(buffer));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ed25519_scalar_is_canonical              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks whether a 32-byte little endian scalar is      */
+/*    below L.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    s                                     Scalar s                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    canonical                             NX_CRYPTO_TRUE if s < L       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_ed25519_scalar_is_canonical(const UCHAR *s)
+{
+UINT word;
+INT  i;
+
+    for (i = 7; i >= 0; i--)
+    {
+        word = (UINT)s[i << 2] | ((UINT)s[(i << 2) + 1] << 8) |
+               ((UINT)s[(i << 2) + 2] << 16) | ((UINT)s[(i << 2) + 3] << 24);
+        if (word != _nx_crypto_ed25519_order[i])
+        {
+            return(word < _nx_crypto_ed25519_order[i]);
+        }
+    }
+
+    return(NX_CRYPTO_FALSE);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ed25519_key_expand                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function hashes the 32-byte private key with SHA-512. The      */
+/*    clamped first half is the secret scalar and the second half is the  */
+/*    prefix used to derive the nonce.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    sha512                                SHA-512 context               */
+/*    private_key                           32-byte private key           */
+/*    digest                                64-byte expanded key          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_sha512_initialize          Initialize SHA-512            */
+/*    _nx_crypto_sha512_update              Update SHA-512                */
+/*    _nx_crypto_sha512_digest_calculate    Calculate SHA-512 digest      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_ed25519_key_expand(NX_CRYPTO_SHA512 *sha512, UCHAR *private_key, UCHAR *digest)
+{
+UINT status;
+
+    status = _nx_crypto_sha512_initialize(sha512, NX_CRYPTO_HASH_SHA512);
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = _nx_crypto_sha512_update(sha512, private_key, NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES);
+    }
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = _nx_crypto_sha512_digest_calculate(sha512, digest, NX_CRYPTO_HASH_SHA512);
+    }
+
+    digest[0] &= 248;
+    digest[31] &= 127;
+    digest[31] |= 64;
+
+    return(status);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ed25519_hash_reduce                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes SHA-512(data1 || data2 || message) reduced   */
+/*    modulo L.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    sha512                                SHA-512 context               */
+/*    data1                                 First 32 bytes                */
+/*    data2                                 Second 32 bytes               */
+/*    message                               Message                       */
+/*    message_length                        Length of message             */
+/*    r                                     32-byte result                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_sha512_initialize          Initialize SHA-512            */
+/*    _nx_crypto_sha512_update              Update SHA-512                */
+/*    _nx_crypto_sha512_digest_calculate    Calculate SHA-512 digest      */
+/*    _nx_crypto_ed25519_scalar_reduce      Reduce modulo L               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Internal function                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_ed25519_hash_reduce(NX_CRYPTO_SHA512 *sha512, UCHAR *data1, UCHAR *data2,
+                                           UCHAR *message, UINT message_length, UCHAR *r)
+{
+UCHAR digest[64];
+UINT  status;
+
+    status = _nx_crypto_sha512_initialize(sha512, NX_CRYPTO_HASH_SHA512);
+    if ((status == NX_CRYPTO_SUCCESS) && (data1 != NX_CRYPTO_NULL))
+    {
+        status = _nx_crypto_sha512_update(sha512, data1, 32);
+    }
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = _nx_crypto_sha512_update(sha512, data2, 32);
+    }
+    if ((status == NX_CRYPTO_SUCCESS) && (message_length > 0))
+    {
+        status = _nx_crypto_sha512_update(sha512, message, message_length);
+    }
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = _nx_crypto_sha512_digest_calculate(sha512, digest, NX_CRYPTO_HASH_SHA512);
+    }
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    _nx_crypto_ed25519_scalar_reduce(r, digest, sizeof(digest));
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(digest, 0, sizeof(digest));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ed25519_public_key_generate              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function derives the 32-byte public key A = a * B from a       */
+/*    32-byte private key.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    sha512                                SHA-512 context               */
+/*    private_key                           32-byte private key           */
+/*    public_key                            32-byte public key            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ed25519_key_expand         Expand private key            */
+/*    _nx_crypto_curve25519_point_base_multiple                           */
+/*                                          Fixed base multiplication     */
+/*    _nx_crypto_curve25519_point_encode    Encode point                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ed25519_sign               Sign message                  */
+/*    _nx_crypto_method_ed25519_operation   Handle Ed25519 operation      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_ed25519_public_key_generate(NX_CRYPTO_SHA512 *sha512,
+                                                           UCHAR *private_key,
+                                                           UCHAR *public_key)
+{
+NX_CRYPTO_CURVE25519_POINT point;
+UCHAR                      digest[64];
+UINT                       status;
+
+    status = _nx_crypto_ed25519_key_expand(sha512, private_key, digest);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    _nx_crypto_curve25519_point_base_multiple(&point, digest);
+    _nx_crypto_curve25519_point_encode(public_key, &point);
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(digest, 0, sizeof(digest));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ed25519_sign                             PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function signs a message with Ed25519 as defined in RFC 8032.  */
+/*    The nonce is derived from the private key and the message, so no    */
+/*    random number is needed. If the private key is 64 bytes, the        */
+/*    second half is used as the public key instead of being recomputed.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    sha512                                SHA-512 context               */
+/*    message                               Message to be signed          */
+/*    message_length                        Length of message             */
+/*    private_key                           Private key                   */
+/*    private_key_length                    Length of private key, 32 or  */
+/*                                            64                          */
+/*    signature                             Pointer to signature output   */
+/*    signature_length                      Size of signature buffer      */
+/*    actual_signature_length               Length of signature           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ed25519_key_expand         Expand private key            */
+/*    _nx_crypto_ed25519_public_key_generate                              */
+/*                                          Generate public key           */
+/*    _nx_crypto_ed25519_hash_reduce        Hash and reduce modulo L      */
+/*    _nx_crypto_ed25519_scalar_muladd      Scalar multiply and add       */
+/*    _nx_crypto_curve25519_point_base_multiple                           */
+/*                                          Fixed base multiplication     */
+/*    _nx_crypto_curve25519_point_encode    Encode point                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_ed25519_operation   Handle Ed25519 operation      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_ed25519_sign(NX_CRYPTO_SHA512 *sha512,
+                                            UCHAR *message,
+                                            UINT message_length,
+                                            UCHAR *private_key,
+                                            UINT private_key_length,
+                                            UCHAR *signature,
+                                            ULONG signature_length,
+                                            ULONG *actual_signature_length)
+{
+NX_CRYPTO_CURVE25519_POINT point;
+UCHAR                      digest[64];
+UCHAR                      public_key[NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES];
+UCHAR                      nonce[32];
+UCHAR                      k[32];
+UINT                       status;
+
+    if ((private_key_length != NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES) &&
+        (private_key_length != (NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES << 1)))
+    {
+        return(NX_CRYPTO_SIZE_ERROR);
+    }
+
+    if (signature_length < NX_CRYPTO_ED25519_SIGNATURE_SIZE_IN_BYTES)
+    {
+        return(NX_CRYPTO_SIZE_ERROR);
+    }
+
+    if (private_key_length == NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES)
+    {
+        status = _nx_crypto_ed25519_public_key_generate(sha512, private_key, public_key);
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+    else
+    {
+        NX_CRYPTO_MEMCPY(public_key, private_key + NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES, sizeof(public_key)); /* Use case of memcpy is verified. */
+    }
+
+    status = _nx_crypto_ed25519_key_expand(sha512, private_key, digest);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* r = SHA-512(prefix || M) mod L, R = r * B */
+    status = _nx_crypto_ed25519_hash_reduce(sha512, NX_CRYPTO_NULL, digest + 32, message, message_length, nonce);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+    _nx_crypto_curve25519_point_base_multiple(&point, nonce);
+    _nx_crypto_curve25519_point_encode(signature, &point);
+
+    /* k = SHA-512(R || A || M) mod L, S = (r + k * a) mod L */
+    status = _nx_crypto_ed25519_hash_reduce(sha512, signature, public_key, message, message_length, k);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+    _nx_crypto_ed25519_scalar_muladd(signature + 32, digest, k, nonce);
+
+    *actual_signature_length = NX_CRYPTO_ED25519_SIGNATURE_SIZE_IN_BYTES;
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(digest, 0, sizeof(digest));
+    NX_CRYPTO_MEMSET(nonce, 0, sizeof(nonce));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ed25519_verify                           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function verifies an Ed25519 signature as defined in RFC       */
+/*    8032. S must be below L and A must decode to a valid point. The     */
+/*    check [S]B = R + [k]A is done by computing [S]B + [k](-A) with a    */
+/*    single chain of doublings and comparing its encoding with R.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    sha512                                SHA-512 context               */
+/*    message                               Message to be verified        */
+/*    message_length                        Length of message             */
+/*    public_key                            32-byte public key            */
+/*    public_key_length                     Length of public key          */
+/*    signature                             64-byte signature             */
+/*    signature_length                      Length of signature           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMCMP                      Compare data                  */
+/*    _nx_crypto_ed25519_scalar_is_canonical                              */
+/*                                          Check scalar is below L       */
+/*    _nx_crypto_ed25519_hash_reduce        Hash and reduce modulo L      */
+/*    _nx_crypto_curve25519_point_decode    Decode point                  */
+/*    _nx_crypto_curve25519_point_negate    Negate point                  */
+/*    _nx_crypto_curve25519_point_base_multiple_add                       */
+/*                                          Compute k1 * B + k2 * Q       */
+/*    _nx_crypto_curve25519_point_encode    Encode point                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_ed25519_operation   Handle Ed25519 operation      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_ed25519_verify(NX_CRYPTO_SHA512 *sha512,
+                                              UCHAR *message,
+                                              UINT message_length,
+                                              UCHAR *public_key,
+                                              UINT public_key_length,
+                                              UCHAR *signature,
+                                              UINT signature_length)
+{
+NX_CRYPTO_CURVE25519_POINT a;
+NX_CRYPTO_CURVE25519_POINT r;
+UCHAR                      k[32];
+UCHAR                      encoded[32];
+UINT                       status;
+
+    if ((public_key_length != NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES) ||
+        (signature_length != NX_CRYPTO_ED25519_SIGNATURE_SIZE_IN_BYTES))
+    {
+        return(NX_CRYPTO_SIZE_ERROR);
+    }
+
+    if (!_nx_crypto_ed25519_scalar_is_canonical(signature + 32))
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    status = _nx_crypto_curve25519_point_decode(&a, public_key);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+    _nx_crypto_curve25519_point_negate(&a);
+
+    /* k = SHA-512(R || A || M) mod L */
+    status = _nx_crypto_ed25519_hash_reduce(sha512, signature, public_key, message, message_length, k);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* R' = [S]B - [k]A */
+    _nx_crypto_curve25519_point_base_multiple_add(&r, signature + 32, &a, k);
+    _nx_crypto_curve25519_point_encode(encoded, &r);
+
+    if (NX_CRYPTO_MEMCMP(encoded, signature, sizeof(encoded)))
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_ed25519_init                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the common crypto method init callback for         */
+/*    Microsoft supported Ed25519 cryptographic algorithm.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    method                                Pointer to crypto method      */
+/*    key                                   Pointer to key                */
+/*    key_size_in_bits                      Length of key size in bits    */
+/*    handler                               Returned crypto handler       */
+/*    crypto_metadata                       Metadata area                 */
+/*    crypto_metadata_size                  Size of the metadata area     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT  _nx_crypto_method_ed25519_init(struct  NX_CRYPTO_METHOD_STRUCT *method,
+                                                    UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                    VOID  **handle,
+                                                    VOID  *crypto_metadata,
+                                                    ULONG crypto_metadata_size)
+{
+
+    NX_CRYPTO_PARAMETER_NOT_USED(key);
+    NX_CRYPTO_PARAMETER_NOT_USED(key_size_in_bits);
+    NX_CRYPTO_PARAMETER_NOT_USED(handle);
+
+    NX_CRYPTO_STATE_CHECK
+
+    if ((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    /* Verify the metadata addrsss is 4-byte aligned. */
+    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if(crypto_metadata_size < sizeof(NX_CRYPTO_ED25519))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_ed25519_cleanup                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function cleans up the crypto metadata.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    crypto_metadata                       Crypto metadata               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT  _nx_crypto_method_ed25519_cleanup(VOID *crypto_metadata)
+{
+
+    NX_CRYPTO_STATE_CHECK
+
+#ifdef NX_SECURE_KEY_CLEAR
+    if (!crypto_metadata)
+        return (NX_CRYPTO_SUCCESS);
+
+    /* Clean up the crypto metadata.  */
+    NX_CRYPTO_MEMSET(crypto_metadata, 0, sizeof(NX_CRYPTO_ED25519));
+#else
+    NX_CRYPTO_PARAMETER_NOT_USED(crypto_metadata);
+#endif/* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_ed25519_operation                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs an Ed25519 operation. Ed25519 hashes the     */
+/*    message itself, so NX_CRYPTO_SIGNATURE_GENERATE and                 */
+/*    NX_CRYPTO_SIGNATURE_VERIFY take the message as input and no hash    */
+/*    method is set. NX_CRYPTO_EC_KEY_PAIR_GENERATE returns the 32-byte   */
+/*    private key followed by the 32-byte public key.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    op                                    Ed25519 operation             */
+/*    handle                                Crypto handle                 */
+/*    method                                Cryption Method Object        */
+/*    key                                   Encryption Key                */
+/*    key_size_in_bits                      Key size in bits              */
+/*    input                                 Input data                    */
+/*    input_length_in_byte                  Input data size               */
+/*    iv_ptr                                Initial vector                */
+/*    output                                Output buffer                 */
+/*    output_length_in_byte                 Output buffer size            */
+/*    crypto_metadata                       Metadata area                 */
+/*    crypto_metadata_size                  Metadata area size            */
+/*    packet_ptr                            Pointer to packet             */
+/*    nx_crypto_hw_process_callback         Callback function pointer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_RBG                         Generate random number        */
+/*    _nx_crypto_ed25519_public_key_generate                              */
+/*                                          Generate public key           */
+/*    _nx_crypto_ed25519_sign               Sign using Ed25519            */
+/*    _nx_crypto_ed25519_verify             Verify Ed25519 signature      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_method_ed25519_operation(UINT op,
+                                                        VOID *handle,
+                                                        struct NX_CRYPTO_METHOD_STRUCT *method,
+                                                        UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                        UCHAR *input, ULONG input_length_in_byte,
+                                                        UCHAR *iv_ptr,
+                                                        UCHAR *output, ULONG output_length_in_byte,
+                                                        VOID *crypto_metadata, ULONG crypto_metadata_size,
+                                                        VOID *packet_ptr,
+                                                        VOID (*nx_crypto_hw_process_callback)(VOID *, UINT))
+{
+NX_CRYPTO_ED25519 *ed25519;
+UINT               status = NX_CRYPTO_SUCCESS;
+NX_CRYPTO_EXTENDED_OUTPUT
+                  *extended_output;
+
+    NX_CRYPTO_PARAMETER_NOT_USED(handle);
+    NX_CRYPTO_PARAMETER_NOT_USED(iv_ptr);
+    NX_CRYPTO_PARAMETER_NOT_USED(packet_ptr);
+    NX_CRYPTO_PARAMETER_NOT_USED(nx_crypto_hw_process_callback);
+
+    NX_CRYPTO_STATE_CHECK
+
+    /* Verify the metadata addrsss is 4-byte aligned. */
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if(crypto_metadata_size < sizeof(NX_CRYPTO_ED25519))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    ed25519 = (NX_CRYPTO_ED25519 *)crypto_metadata;
+
+    if ((op == NX_CRYPTO_SIGNATURE_GENERATE) || (op == NX_CRYPTO_AUTHENTICATE))
+    {
+        if ((key == NX_CRYPTO_NULL) || (output == NX_CRYPTO_NULL))
+        {
+            return(NX_CRYPTO_PTR_ERROR);
+        }
+
+        extended_output = (NX_CRYPTO_EXTENDED_OUTPUT *)output;
+
+        status = _nx_crypto_ed25519_sign(&ed25519 -> nx_crypto_ed25519_sha512,
+                                         input,
+                                         input_length_in_byte,
+                                         key,
+                                         key_size_in_bits >> 3,
+                                         extended_output -> nx_crypto_extended_output_data,
+                                         extended_output -> nx_crypto_extended_output_length_in_byte,
+                                         &extended_output -> nx_crypto_extended_output_actual_size);
+    }
+    else if ((op == NX_CRYPTO_SIGNATURE_VERIFY) || (op == NX_CRYPTO_VERIFY))
+    {
+        if ((key == NX_CRYPTO_NULL) || (output == NX_CRYPTO_NULL))
+        {
+            return(NX_CRYPTO_PTR_ERROR);
+        }
+
+        status = _nx_crypto_ed25519_verify(&ed25519 -> nx_crypto_ed25519_sha512,
+                                           input,
+                                           input_length_in_byte,
+                                           key,
+                                           key_size_in_bits >> 3,
+                                           output, output_length_in_byte);
+    }
+    else if (op == NX_CRYPTO_EC_KEY_PAIR_GENERATE)
+    {
+        if (output == NX_CRYPTO_NULL)
+        {
+            return(NX_CRYPTO_PTR_ERROR);
+        }
+
+        extended_output = (NX_CRYPTO_EXTENDED_OUTPUT *)output;
+        if (extended_output -> nx_crypto_extended_output_length_in_byte < (NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES << 1))
+        {
+            return(NX_CRYPTO_SIZE_ERROR);
+        }
+
+        status = NX_CRYPTO_RBG(NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES << 3,
+                               extended_output -> nx_crypto_extended_output_data);
+        if (status == NX_CRYPTO_SUCCESS)
+        {
+            status = _nx_crypto_ed25519_public_key_generate(&ed25519 -> nx_crypto_ed25519_sha512,
+                                                            extended_output -> nx_crypto_extended_output_data,
+                                                            extended_output -> nx_crypto_extended_output_data +
+                                                            NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES);
+        }
+        if (status == NX_CRYPTO_SUCCESS)
+        {
+            extended_output -> nx_crypto_extended_output_actual_size = NX_CRYPTO_ED25519_KEY_SIZE_IN_BYTES << 1;
+        }
+    }
+    else
+    {
+        status = NX_CRYPTO_NOT_SUCCESSFUL;
+    }
+
+    return(status);
+}
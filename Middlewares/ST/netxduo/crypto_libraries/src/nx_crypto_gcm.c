@@ -54,8 +54,9 @@
 /*  CALLED BY                                                             */
 /*                                                                        */
 /*    _nx_crypto_gcm_multi                  Compute multilication in GF   */
-/*    _nx_crypto_gcm_ghash_update           Compute GHASH                 */
+/*    _nx_crypto_gcm_ghash_block            Compute GHASH of one block    */
 /*    _nx_crypto_gcm_gctr                   Perform GCTR operation        */
+/*    _nx_crypto_gcm_gctr_ghash             Perform GCTR and GHASH        */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -129,6 +130,7 @@ UINT *k = (UINT *)key;
 /*  CALLED BY                                                             */
 /*                                                                        */
 /*    _nx_crypto_gcm_gctr                   Perform GCTR operation        */
+/*    _nx_crypto_gcm_gctr_ghash             Perform GCTR and GHASH        */
 /*    _nx_crypto_gcm_encrypt                Perform GCM encrypt/decrypt   */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
@@ -157,6 +159,7 @@ USHORT result;
     counter_block[12] = (UCHAR)(result & 0xFF);
 }
 
+#ifdef NX_CRYPTO_GCM_GHASH_TABLE_DISABLE
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -187,7 +190,7 @@ USHORT result;
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nx_crypto_gcm_ghash_update           Compute GHASH                 */
+/*    _nx_crypto_gcm_ghash_block            Compute GHASH of one block    */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -245,13 +248,329 @@ UCHAR mask;
         }
     }
 }
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_DISABLE */
+
+#ifndef NX_CRYPTO_GCM_GHASH_TABLE_DISABLE
+
+/* Reduction modulo the GCM polynomial of the bits shifted out when a table-driven
+   multiplication step multiplies the partial product by x^4 (or x^8). Values are the
+   upper 16 bits of the reduced 128-bit block.  */
+#ifdef NX_CRYPTO_GCM_GHASH_TABLE_8BIT
+static const USHORT _nx_crypto_gcm_reduction_table[256] =
+{
+    0x0000, 0x01C2, 0x0384, 0x0246, 0x0708, 0x06CA, 0x048C, 0x054E,
+    0x0E10, 0x0FD2, 0x0D94, 0x0C56, 0x0918, 0x08DA, 0x0A9C, 0x0B5E,
+    0x1C20, 0x1DE2, 0x1FA4, 0x1E66, 0x1B28, 0x1AEA, 0x18AC, 0x196E,
+    0x1230, 0x13F2, 0x11B4, 0x1076, 0x1538, 0x14FA, 0x16BC, 0x177E,
+    0x3840, 0x3982, 0x3BC4, 0x3A06, 0x3F48, 0x3E8A, 0x3CCC, 0x3D0E,
+    0x3650, 0x3792, 0x35D4, 0x3416, 0x3158, 0x309A, 0x32DC, 0x331E,
+    0x2460, 0x25A2, 0x27E4, 0x2626, 0x2368, 0x22AA, 0x20EC, 0x212E,
+    0x2A70, 0x2BB2, 0x29F4, 0x2836, 0x2D78, 0x2CBA, 0x2EFC, 0x2F3E,
+    0x7080, 0x7142, 0x7304, 0x72C6, 0x7788, 0x764A, 0x740C, 0x75CE,
+    0x7E90, 0x7F52, 0x7D14, 0x7CD6, 0x7998, 0x785A, 0x7A1C, 0x7BDE,
+    0x6CA0, 0x6D62, 0x6F24, 0x6EE6, 0x6BA8, 0x6A6A, 0x682C, 0x69EE,
+    0x62B0, 0x6372, 0x6134, 0x60F6, 0x65B8, 0x647A, 0x663C, 0x67FE,
+    0x48C0, 0x4902, 0x4B44, 0x4A86, 0x4FC8, 0x4E0A, 0x4C4C, 0x4D8E,
+    0x46D0, 0x4712, 0x4554, 0x4496, 0x41D8, 0x401A, 0x425C, 0x439E,
+    0x54E0, 0x5522, 0x5764, 0x56A6, 0x53E8, 0x522A, 0x506C, 0x51AE,
+    0x5AF0, 0x5B32, 0x5974, 0x58B6, 0x5DF8, 0x5C3A, 0x5E7C, 0x5FBE,
+    0xE100, 0xE0C2, 0xE284, 0xE346, 0xE608, 0xE7CA, 0xE58C, 0xE44E,
+    0xEF10, 0xEED2, 0xEC94, 0xED56, 0xE818, 0xE9DA, 0xEB9C, 0xEA5E,
+    0xFD20, 0xFCE2, 0xFEA4, 0xFF66, 0xFA28, 0xFBEA, 0xF9AC, 0xF86E,
+    0xF330, 0xF2F2, 0xF0B4, 0xF176, 0xF438, 0xF5FA, 0xF7BC, 0xF67E,
+    0xD940, 0xD882, 0xDAC4, 0xDB06, 0xDE48, 0xDF8A, 0xDDCC, 0xDC0E,
+    0xD750, 0xD692, 0xD4D4, 0xD516, 0xD058, 0xD19A, 0xD3DC, 0xD21E,
+    0xC560, 0xC4A2, 0xC6E4, 0xC726, 0xC268, 0xC3AA, 0xC1EC, 0xC02E,
+    0xCB70, 0xCAB2, 0xC8F4, 0xC936, 0xCC78, 0xCDBA, 0xCFFC, 0xCE3E,
+    0x9180, 0x9042, 0x9204, 0x93C6, 0x9688, 0x974A, 0x950C, 0x94CE,
+    0x9F90, 0x9E52, 0x9C14, 0x9DD6, 0x9898, 0x995A, 0x9B1C, 0x9ADE,
+    0x8DA0, 0x8C62, 0x8E24, 0x8FE6, 0x8AA8, 0x8B6A, 0x892C, 0x88EE,
+    0x83B0, 0x8272, 0x8034, 0x81F6, 0x84B8, 0x857A, 0x873C, 0x86FE,
+    0xA9C0, 0xA802, 0xAA44, 0xAB86, 0xAEC8, 0xAF0A, 0xAD4C, 0xAC8E,
+    0xA7D0, 0xA612, 0xA454, 0xA596, 0xA0D8, 0xA11A, 0xA35C, 0xA29E,
+    0xB5E0, 0xB422, 0xB664, 0xB7A6, 0xB2E8, 0xB32A, 0xB16C, 0xB0AE,
+    0xBBF0, 0xBA32, 0xB874, 0xB9B6, 0xBCF8, 0xBD3A, 0xBF7C, 0xBEBE
+};
+#else
+static const USHORT _nx_crypto_gcm_reduction_table[16] =
+{
+    0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+    0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+};
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_8BIT */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_gcm_table_init                           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function precomputes the multiples of the hash key H used by   */
+/*    the table-driven GHASH. The entry with only the top index bit set   */
+/*    is H, each lower power of two entry is the next one times x, and    */
+/*    every other entry is the sum of the power of two entries of its     */
+/*    index bits.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    gcm_metadata                          Pointer to GCM context        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_gcm_encrypt_init           Initialize GCM mode           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_table_init(NX_CRYPTO_GCM *gcm_metadata)
+{
+UINT (*table)[NX_CRYPTO_GCM_BLOCK_SIZE_INT] = gcm_metadata -> nx_crypto_gcm_hkey_table;
+UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
+UINT i, j;
+UINT lsb;
+
+    /* Entry 0 is zero. */
+    table[0][0] = 0;
+    table[0][1] = 0;
+    table[0][2] = 0;
+    table[0][3] = 0;
+
+    /* The top power of two entry is H. */
+    i = NX_CRYPTO_GCM_GHASH_TABLE_SIZE >> 1;
+    for (j = 0; j < NX_CRYPTO_GCM_BLOCK_SIZE_INT; j++)
+    {
+        table[i][j] = ((UINT)hkey[j << 2] << 24) | ((UINT)hkey[(j << 2) + 1] << 16) |
+                      ((UINT)hkey[(j << 2) + 2] << 8) | (UINT)hkey[(j << 2) + 3];
+    }
+
+    /* table[i] = table[i << 1] * x, that is a right shift with reduction. */
+    for (i = i >> 1; i > 0; i = i >> 1)
+    {
+        lsb = table[i << 1][3] & 1;
+        table[i][3] = (table[i << 1][3] >> 1) | (table[i << 1][2] << 31);
+        table[i][2] = (table[i << 1][2] >> 1) | (table[i << 1][1] << 31);
+        table[i][1] = (table[i << 1][1] >> 1) | (table[i << 1][0] << 31);
+        table[i][0] = (table[i << 1][0] >> 1) ^ ((0 - lsb) & 0xE1000000);
+    }
+
+    /* Multiplication is linear, so the remaining entries are sums of power of two entries. */
+    for (i = 2; i < NX_CRYPTO_GCM_GHASH_TABLE_SIZE; i = i << 1)
+    {
+        for (j = 1; j < i; j++)
+        {
+            table[i + j][0] = table[i][0] ^ table[j][0];
+            table[i + j][1] = table[i][1] ^ table[j][1];
+            table[i + j][2] = table[i][2] ^ table[j][2];
+            table[i + j][3] = table[i][3] ^ table[j][3];
+        }
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_gcm_table_multi                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies a block by the hash key H in GF(2^128)     */
+/*    using the precomputed table, processing the block from its last     */
+/*    byte to its first, four or eight bits per step (Shoup's method).    */
+/*    Each step multiplies the partial product by x^4 (or x^8), folds     */
+/*    the bits shifted out back in with the reduction table, and adds     */
+/*    the table entry for the next bits of the block.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    table                                 Precomputed multiples of H    */
+/*    x                                     Pointer to X block            */
+/*    output                                Pointer to result block       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_gcm_ghash_block            Compute GHASH of one block    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_table_multi(UINT (*table)[NX_CRYPTO_GCM_BLOCK_SIZE_INT],
+                                                       UCHAR *x, UCHAR *output)
+{
+UINT z0, z1, z2, z3;
+UINT rem;
+UINT index;
+INT i;
+
+#ifdef NX_CRYPTO_GCM_GHASH_TABLE_8BIT
+    index = x[NX_CRYPTO_GCM_BLOCK_SIZE - 1];
+#else
+    index = x[NX_CRYPTO_GCM_BLOCK_SIZE - 1] & 0xF;
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_8BIT */
+    z0 = table[index][0];
+    z1 = table[index][1];
+    z2 = table[index][2];
+    z3 = table[index][3];
+
+#ifdef NX_CRYPTO_GCM_GHASH_TABLE_8BIT
+    for (i = NX_CRYPTO_GCM_BLOCK_SIZE - 2; i >= 0; i--)
+    {
+
+        /* z = z * x^8 + table[x[i]] */
+        rem = z3 & 0xFF;
+        z3 = (z3 >> 8) | (z2 << 24);
+        z2 = (z2 >> 8) | (z1 << 24);
+        z1 = (z1 >> 8) | (z0 << 24);
+        z0 = (z0 >> 8) ^ ((UINT)_nx_crypto_gcm_reduction_table[rem] << 16);
+
+        index = x[i];
+        z0 ^= table[index][0];
+        z1 ^= table[index][1];
+        z2 ^= table[index][2];
+        z3 ^= table[index][3];
+    }
+#else
+    for (i = (NX_CRYPTO_GCM_BLOCK_SIZE << 1) - 2; i >= 0; i--)
+    {
+
+        /* z = z * x^4 + table[nibble i of x] */
+        rem = z3 & 0xF;
+        z3 = (z3 >> 4) | (z2 << 28);
+        z2 = (z2 >> 4) | (z1 << 28);
+        z1 = (z1 >> 4) | (z0 << 28);
+        z0 = (z0 >> 4) ^ ((UINT)_nx_crypto_gcm_reduction_table[rem] << 16);
+
+        /* Odd nibbles are the low halves of the bytes. */
+        if (i & 1)
+        {
+            index = x[i >> 1] & 0xF;
+        }
+        else
+        {
+            index = (UINT)(x[i >> 1] >> 4);
+        }
+        z0 ^= table[index][0];
+        z1 ^= table[index][1];
+        z2 ^= table[index][2];
+        z3 ^= table[index][3];
+    }
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_8BIT */
+
+    output[0] = (UCHAR)(z0 >> 24);
+    output[1] = (UCHAR)(z0 >> 16);
+    output[2] = (UCHAR)(z0 >> 8);
+    output[3] = (UCHAR)z0;
+    output[4] = (UCHAR)(z1 >> 24);
+    output[5] = (UCHAR)(z1 >> 16);
+    output[6] = (UCHAR)(z1 >> 8);
+    output[7] = (UCHAR)z1;
+    output[8] = (UCHAR)(z2 >> 24);
+    output[9] = (UCHAR)(z2 >> 16);
+    output[10] = (UCHAR)(z2 >> 8);
+    output[11] = (UCHAR)z2;
+    output[12] = (UCHAR)(z3 >> 24);
+    output[13] = (UCHAR)(z3 >> 16);
+    output[14] = (UCHAR)(z3 >> 8);
+    output[15] = (UCHAR)z3;
+}
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_DISABLE */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_gcm_ghash_block                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function updates GHASH with one full block of input, that is   */
+/*    output = (output xor input) * H, using the precomputed table unless */
+/*    NX_CRYPTO_GCM_GHASH_TABLE_DISABLE is defined.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    gcm_metadata                          Pointer to GCM context        */
+/*    input                                 Pointer to input block        */
+/*    output                                Pointer to updated hash       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_gcm_xor                    Perform XOR operation         */
+/*    _nx_crypto_gcm_table_multi            Perform table multiplication  */
+/*    _nx_crypto_gcm_multi                  Perform multiplication in GF  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
+/*    _nx_crypto_gcm_gctr_ghash             Perform GCTR and GHASH        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_ghash_block(NX_CRYPTO_GCM *gcm_metadata, UCHAR *input, UCHAR *output)
+{
+UCHAR tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE];
+
+    _nx_crypto_gcm_xor(output, input, tmp_block);
+#ifndef NX_CRYPTO_GCM_GHASH_TABLE_DISABLE
+    _nx_crypto_gcm_table_multi(gcm_metadata -> nx_crypto_gcm_hkey_table, tmp_block, output);
+#else
+    _nx_crypto_gcm_multi(tmp_block, gcm_metadata -> nx_crypto_gcm_hkey, output);
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_DISABLE */
+}
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_gcm_ghash_update                         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -263,7 +582,7 @@ UCHAR mask;
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    hkey                                  Pointer to hash key           */
+/*    gcm_metadata                          Pointer to GCM context        */
 /*    input                                 Pointer to bytes of input     */
 /*    input_length                          Length of bytes of input      */
 /*    output                                Pointer to updated hash       */
@@ -274,8 +593,7 @@ UCHAR mask;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_crypto_gcm_xor                    Perform XOR operation         */
-/*    _nx_crypto_gcm_multi                  Perform multiplication in GF  */
+/*    _nx_crypto_gcm_ghash_block            Compute GHASH of one block    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -289,9 +607,12 @@ UCHAR mask;
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            table-driven GHASH,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_ghash_update(UCHAR *hkey, UCHAR *input, UINT input_length, UCHAR *output)
+NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_ghash_update(NX_CRYPTO_GCM *gcm_metadata, UCHAR *input, UINT input_length, UCHAR *output)
 {
 UCHAR tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE];
 UINT i, n;
@@ -301,8 +622,7 @@ UINT i, n;
     {
 
         /* output = (output xor input) multi hkey */
-        _nx_crypto_gcm_xor(output, input, tmp_block);
-        _nx_crypto_gcm_multi(tmp_block, hkey, output);
+        _nx_crypto_gcm_ghash_block(gcm_metadata, input, output);
         input += NX_CRYPTO_GCM_BLOCK_SIZE;
     }
 
@@ -314,8 +634,7 @@ UINT i, n;
             multiple of the block size. */
         NX_CRYPTO_MEMCPY(tmp_block, input, input_length); /* Use case of memcpy is verified. */
         NX_CRYPTO_MEMSET(&tmp_block[input_length], 0, sizeof(tmp_block) - input_length);
-        _nx_crypto_gcm_xor(output, tmp_block, tmp_block);
-        _nx_crypto_gcm_multi(tmp_block, hkey, output);
+        _nx_crypto_gcm_ghash_block(gcm_metadata, tmp_block, output);
     }
 }
 
@@ -354,7 +673,9 @@ UINT i, n;
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nx_crypto_gcm_encrypt                Perform GCM encrypt/decrypt   */
+/*    _nx_crypto_gcm_gctr_ghash             Perform GCTR and GHASH        */
+/*    _nx_crypto_gcm_encrypt_calculate      Calculate the GCM tag         */
+/*    _nx_crypto_gcm_decrypt_calculate      Verify the GCM tag            */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -404,12 +725,138 @@ UINT i, n;
 
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_gcm_gctr_ghash                           PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts or decrypts the input with GCTR and updates  */
+/*    GHASH with the cipher text in a single pass, one block at a time,   */
+/*    so each block is authenticated while it is still in cache. When     */
+/*    decrypting, the cipher text block is hashed before it is XORed,     */
+/*    which allows input and output to be the same buffer. Up to          */
+/*    NX_CRYPTO_PARALLEL_BLOCKS counter blocks are encrypted in each      */
+/*    call to the crypto function.                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    crypto_metadata                       Pointer to AES context        */
+/*    gcm_metadata                          Pointer to GCM context        */
+/*    crypto_function                       Pointer to AES encrypt        */
+/*    input                                 Pointer to input              */
+/*    output                                Pointer to output             */
+/*    length                                Length of input               */
+/*    encrypt                               Encrypt (true) or decrypt     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (crypto_function)                     Encrypt the counter block     */
+/*    _nx_crypto_gcm_xor                    Perform XOR operation         */
+/*    _nx_crypto_gcm_inc32                  Increase the counter by one   */
+/*    _nx_crypto_gcm_ghash_block            Compute GHASH of one block    */
+/*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
+/*    _nx_crypto_gcm_gctr                   Perform GCTR operation        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_gcm_encrypt_update         Update data for GCM mode      */
+/*    _nx_crypto_gcm_decrypt_update         Update data for GCM mode      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_gctr_ghash(VOID *crypto_metadata, NX_CRYPTO_GCM *gcm_metadata,
+                                                     UINT (*crypto_function)(VOID *, UCHAR *, UCHAR *, UINT),
+                                                     UCHAR *input, UCHAR *output, UINT length, UINT encrypt)
+{
+UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
+UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
+UCHAR aes_output[NX_CRYPTO_GCM_BLOCK_SIZE * NX_CRYPTO_PARALLEL_BLOCKS];
+UINT i, n, blocks;
+
+    n = length >> NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT;
+
+    while (n > 0)
+    {
+
+        /* Encrypt up to NX_CRYPTO_PARALLEL_BLOCKS counter blocks in one call. */
+        blocks = (n < NX_CRYPTO_PARALLEL_BLOCKS) ? n : NX_CRYPTO_PARALLEL_BLOCKS;
+        for (i = 0; i < blocks; i++)
+        {
+            NX_CRYPTO_MEMCPY(&aes_output[i << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT], counter, NX_CRYPTO_GCM_BLOCK_SIZE); /* Use case of memcpy is verified. */
+
+            /* Increase the counter block. */
+            _nx_crypto_gcm_inc32(counter);
+        }
+        crypto_function(crypto_metadata, aes_output, aes_output, blocks << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT);
+
+        for (i = 0; i < blocks; i++)
+        {
+            if (encrypt)
+            {
+
+                /* XOR the input with encrypted counter, then hash the cipher text. */
+                _nx_crypto_gcm_xor(input, &aes_output[i << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT], output);
+                _nx_crypto_gcm_ghash_block(gcm_metadata, output, s);
+            }
+            else
+            {
+
+                /* Hash the cipher text, then XOR it with encrypted counter. */
+                _nx_crypto_gcm_ghash_block(gcm_metadata, input, s);
+                _nx_crypto_gcm_xor(input, &aes_output[i << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT], output);
+            }
+
+            input += NX_CRYPTO_GCM_BLOCK_SIZE;
+            output += NX_CRYPTO_GCM_BLOCK_SIZE;
+        }
+
+        n -= blocks;
+    }
+
+    length &= (NX_CRYPTO_GCM_BLOCK_SIZE - 1);
+    if (length > 0)
+    {
+
+        /* Process the last partial block. */
+        if (encrypt)
+        {
+            _nx_crypto_gcm_gctr(crypto_metadata, crypto_function, input, output, length, counter);
+            _nx_crypto_gcm_ghash_update(gcm_metadata, output, length, s);
+        }
+        else
+        {
+            _nx_crypto_gcm_ghash_update(gcm_metadata, input, length, s);
+            _nx_crypto_gcm_gctr(crypto_metadata, crypto_function, input, output, length, counter);
+        }
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(aes_output, 0, sizeof(aes_output));
+#endif
+}
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_gcm_encrypt_init                         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -438,6 +885,7 @@ UINT i, n;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_crypto_gcm_table_init             Precompute GHASH table        */
 /*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
 /*    _nx_crypto_gcm_inc32                  Increase the counter by one   */
 /*                                                                        */
@@ -453,6 +901,9 @@ UINT i, n;
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            GHASH table precomputation, */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_gcm_encrypt_init(VOID *crypto_metadata, NX_CRYPTO_GCM *gcm_metadata,
@@ -477,6 +928,11 @@ UCHAR iv_len;
     NX_CRYPTO_MEMSET(hkey, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
     crypto_function(crypto_metadata, hkey, hkey, NX_CRYPTO_GCM_BLOCK_SIZE);
 
+#ifndef NX_CRYPTO_GCM_GHASH_TABLE_DISABLE
+    /* Precompute the multiples of the hash key for GHASH. */
+    _nx_crypto_gcm_table_init(gcm_metadata);
+#endif /* NX_CRYPTO_GCM_GHASH_TABLE_DISABLE */
+
     /* Generate the pre-counter block j0. */
     iv_len = iv[0];
     iv = iv + 1;
@@ -496,18 +952,18 @@ UCHAR iv_len;
 
         /* When the length of IV is not 12 then apply GHASH to the IV. */
         NX_CRYPTO_MEMSET(j0, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
-        _nx_crypto_gcm_ghash_update(hkey, iv, iv_len, j0);
+        _nx_crypto_gcm_ghash_update(gcm_metadata, iv, iv_len, j0);
 
         /* Apply GHASH to the length of IV to form j0.*/
         NX_CRYPTO_MEMSET(tmp_block, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
         tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE - 2] = (UCHAR)(((iv_len << 3) & 0xFF00) >> 8);
         tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE - 1] = (UCHAR)((iv_len << 3) & 0x00FF);
-        _nx_crypto_gcm_ghash_update(hkey, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, j0);
+        _nx_crypto_gcm_ghash_update(gcm_metadata, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, j0);
     }
 
     /* Apply GHASH to the additional authenticated data. */
     NX_CRYPTO_MEMSET(s, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
-    _nx_crypto_gcm_ghash_update(hkey, additional_data, additional_len, s);
+    _nx_crypto_gcm_ghash_update(gcm_metadata, additional_data, additional_len, s);
 
     /* Initial counter block for GCTR is j0 + 1. */
     NX_CRYPTO_MEMCPY(counter, j0, NX_CRYPTO_GCM_BLOCK_SIZE); /* Use case of memcpy is verified. */
@@ -528,7 +984,7 @@ UCHAR iv_len;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_gcm_encrypt_update                       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -553,8 +1009,7 @@ UCHAR iv_len;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_crypto_gcm_gctr                   Update data for GCM mode      */
-/*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
+/*    _nx_crypto_gcm_gctr_ghash             Perform GCTR and GHASH        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -567,6 +1022,9 @@ UCHAR iv_len;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            single pass GCTR and GHASH, */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_gcm_encrypt_update(VOID *crypto_metadata, NX_CRYPTO_GCM *gcm_metadata,
@@ -574,9 +1032,6 @@ NX_CRYPTO_KEEP UINT _nx_crypto_gcm_encrypt_update(VOID *crypto_metadata, NX_CRYP
                                                   UCHAR *input, UCHAR *output, UINT length,
                                                   UINT block_size)
 {
-UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
-UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
-UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 
     /* Check the block size.  */
     if (block_size != NX_CRYPTO_GCM_BLOCK_SIZE)
@@ -584,11 +1039,8 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
-    /* Invoke GCTR function to encrypt or decrypt the input message. */
-    _nx_crypto_gcm_gctr(crypto_metadata, crypto_function, input, output, length, counter);
-
-    /* Apply GHASH to the cipher text. */
-    _nx_crypto_gcm_ghash_update(hkey, output, length, s);
+    /* Encrypt the input message and apply GHASH to the cipher text. */
+    _nx_crypto_gcm_gctr_ghash(crypto_metadata, gcm_metadata, crypto_function, input, output, length, NX_CRYPTO_TRUE);
 
     gcm_metadata -> nx_crypto_gcm_input_total_length += length;
 
@@ -600,7 +1052,7 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_gcm_encrypt_calculate                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -639,13 +1091,15 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            table-driven GHASH,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_gcm_encrypt_calculate(VOID *crypto_metadata, NX_CRYPTO_GCM *gcm_metadata,
                                                      UINT (*crypto_function)(VOID *, UCHAR *, UCHAR *, UINT),
                                                      UCHAR *output, UINT icv_len, UINT block_size)
 {
-UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
 UCHAR *j0 = gcm_metadata -> nx_crypto_gcm_j0;
 UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
 UCHAR tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE];
@@ -676,7 +1130,7 @@ UINT length;
     tmp_block[13] = (UCHAR)(((length << 3) & 0x00FF0000) >> 16);
     tmp_block[14] = (UCHAR)(((length << 3) & 0x0000FF00) >> 8);
     tmp_block[15] = (UCHAR)((length << 3) & 0x000000FF);
-    _nx_crypto_gcm_ghash_update(hkey, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, s);
+    _nx_crypto_gcm_ghash_update(gcm_metadata, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, s);
 
     /* Encrypt the GHASH result using GCTR with j0 as initial counter block.
         The result is the authentication tag. */
@@ -697,7 +1151,7 @@ UINT length;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_gcm_decrypt_update                       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -722,8 +1176,7 @@ UINT length;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_crypto_gcm_gctr                   Update data for GCM mode      */
-/*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
+/*    _nx_crypto_gcm_gctr_ghash             Perform GCTR and GHASH        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -736,6 +1189,9 @@ UINT length;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            single pass GCTR and GHASH, */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_gcm_decrypt_update(VOID *crypto_metadata, NX_CRYPTO_GCM *gcm_metadata,
@@ -743,9 +1199,6 @@ NX_CRYPTO_KEEP UINT _nx_crypto_gcm_decrypt_update(VOID *crypto_metadata, NX_CRYP
                                                   UCHAR *input, UCHAR *output, UINT length,
                                                   UINT block_size)
 {
-UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
-UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
-UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 
     /* Check the block size.  */
     if (block_size != NX_CRYPTO_GCM_BLOCK_SIZE)
@@ -753,11 +1206,8 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
-    /* Apply GHASH to the cipher text. */
-    _nx_crypto_gcm_ghash_update(hkey, input, length, s);
-
-    /* Invoke GCTR function to encrypt or decrypt the input message. */
-    _nx_crypto_gcm_gctr(crypto_metadata, crypto_function, input, output, length, counter);
+    /* Apply GHASH to the cipher text and decrypt it. */
+    _nx_crypto_gcm_gctr_ghash(crypto_metadata, gcm_metadata, crypto_function, input, output, length, NX_CRYPTO_FALSE);
 
     gcm_metadata -> nx_crypto_gcm_input_total_length += length;
 
@@ -769,7 +1219,7 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_gcm_decrypt_calculate                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -807,13 +1257,15 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            table-driven GHASH,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_gcm_decrypt_calculate(VOID *crypto_metadata, NX_CRYPTO_GCM *gcm_metadata,
                                                      UINT (*crypto_function)(VOID *, UCHAR *, UCHAR *, UINT),
                                                      UCHAR *input, UINT icv_len, UINT block_size)
 {
-UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
 UCHAR *j0 = gcm_metadata -> nx_crypto_gcm_j0;
 UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
 UCHAR tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE];
@@ -845,7 +1297,7 @@ UINT i;
     tmp_block[13] = (UCHAR)(((length << 3) & 0x00FF0000) >> 16);
     tmp_block[14] = (UCHAR)(((length << 3) & 0x0000FF00) >> 8);
     tmp_block[15] = (UCHAR)((length << 3) & 0x000000FF);
-    _nx_crypto_gcm_ghash_update(hkey, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, s);
+    _nx_crypto_gcm_ghash_update(gcm_metadata, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, s);
 
 #ifdef NX_SECURE_KEY_CLEAR
     NX_CRYPTO_MEMSET(tmp_block, 0, sizeof(tmp_block));
@@ -29,7 +29,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    nx_crypto_generic_ciphersuites                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -66,6 +66,11 @@
 /*                                            curves in the crypto array, */
 /*                                            added TLS ciphersuite entry,*/
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            X25519 and Ed25519 methods, */
+/*                                            added ChaCha20-Poly1305     */
+/*                                            ciphersuites,               */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -79,14 +84,17 @@ extern NX_CRYPTO_METHOD crypto_method_aes_ccm_8;
 extern NX_CRYPTO_METHOD crypto_method_aes_ccm_16;
 extern NX_CRYPTO_METHOD crypto_method_aes_128_gcm_16;
 extern NX_CRYPTO_METHOD crypto_method_aes_256_gcm_16;
+extern NX_CRYPTO_METHOD crypto_method_chacha20_poly1305;
 extern NX_CRYPTO_METHOD crypto_method_ecdsa;
 extern NX_CRYPTO_METHOD crypto_method_ecdhe;
+extern NX_CRYPTO_METHOD crypto_method_ed25519;
 extern NX_CRYPTO_METHOD crypto_method_hmac_sha1;
 extern NX_CRYPTO_METHOD crypto_method_hmac_sha256;
 extern NX_CRYPTO_METHOD crypto_method_hmac_md5;
 extern NX_CRYPTO_METHOD crypto_method_rsa;
 extern NX_CRYPTO_METHOD crypto_method_pkcs1;
 extern NX_CRYPTO_METHOD crypto_method_auth_psk;
+extern NX_CRYPTO_METHOD crypto_method_ec_x25519;
 extern NX_CRYPTO_METHOD crypto_method_ec_secp256;
 extern NX_CRYPTO_METHOD crypto_method_ec_secp384;
 extern NX_CRYPTO_METHOD crypto_method_ec_secp521;
@@ -198,6 +206,7 @@ NX_SECURE_TLS_CIPHERSUITE_INFO _nx_crypto_ciphersuite_lookup_table_tls_1_3[] =
 {
 #ifdef NX_SECURE_ENABLE_AEAD_CIPHER
     {TLS_AES_128_GCM_SHA256,                  &crypto_method_ecdhe,      &crypto_method_ecdsa,     &crypto_method_aes_128_gcm_16,  96,      16,        &crypto_method_sha256,         32,         &crypto_method_hkdf},
+    {TLS_CHACHA20_POLY1305_SHA256,            &crypto_method_ecdhe,      &crypto_method_ecdsa,     &crypto_method_chacha20_poly1305, 96,    32,        &crypto_method_sha256,         32,         &crypto_method_hkdf},
     /* SHA-384 ciphersuites not yet supported... {TLS_AES_256_GCM_SHA384,                  &crypto_method_ecdhe,      &crypto_method_rsa,     &crypto_method_aes_256_gcm_16,  16,      16,        &crypto_method_sha384,         48,         &crypto_method_hkdf},*/
     {TLS_AES_128_CCM_SHA256,                  &crypto_method_ecdhe,      &crypto_method_ecdsa,     &crypto_method_aes_ccm_16,       96,      16,        &crypto_method_sha256,         32,         &crypto_method_hkdf},
     {TLS_AES_128_CCM_8_SHA256,                &crypto_method_ecdhe,      &crypto_method_ecdsa,     &crypto_method_aes_ccm_8,       96,      16,        &crypto_method_sha256,         32,         &crypto_method_hkdf},
@@ -215,6 +224,7 @@ NX_SECURE_TLS_CIPHERSUITE_INFO _nx_crypto_ciphersuite_lookup_table_ecc[] =
     /* Ciphersuite,                           public cipher,            public_auth,              session cipher & cipher mode,   iv size, key size,  hash method,                    hash size, TLS PRF */
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
     {TLS_AES_128_GCM_SHA256,                  &crypto_method_ecdhe,     &crypto_method_ecdsa,     &crypto_method_aes_128_gcm_16,  96,      16,        &crypto_method_sha256,         32,         &crypto_method_hkdf},
+    {TLS_CHACHA20_POLY1305_SHA256,            &crypto_method_ecdhe,     &crypto_method_ecdsa,     &crypto_method_chacha20_poly1305, 96,    32,        &crypto_method_sha256,         32,         &crypto_method_hkdf},
     {TLS_AES_128_CCM_SHA256,                  &crypto_method_ecdhe,     &crypto_method_ecdsa,     &crypto_method_aes_ccm_16,      96,      16,        &crypto_method_sha256,         32,         &crypto_method_hkdf},
     {TLS_AES_128_CCM_8_SHA256,                &crypto_method_ecdhe,     &crypto_method_ecdsa,     &crypto_method_aes_ccm_8,       96,      16,        &crypto_method_sha256,         32,         &crypto_method_hkdf},
 #endif
@@ -222,6 +232,8 @@ NX_SECURE_TLS_CIPHERSUITE_INFO _nx_crypto_ciphersuite_lookup_table_ecc[] =
 #ifdef NX_SECURE_ENABLE_AEAD_CIPHER
     {TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256, &crypto_method_ecdhe,     &crypto_method_ecdsa,     &crypto_method_aes_128_gcm_16,  16,      16,        &crypto_method_null,            0,         &crypto_method_tls_prf_sha256},
     {TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256,   &crypto_method_ecdhe,     &crypto_method_rsa,       &crypto_method_aes_128_gcm_16,  16,      16,        &crypto_method_null,            0,         &crypto_method_tls_prf_sha256},
+    {TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256, &crypto_method_ecdhe, &crypto_method_ecdsa, &crypto_method_chacha20_poly1305, 12,   32,        &crypto_method_null,            0,         &crypto_method_tls_prf_sha256},
+    {TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256, &crypto_method_ecdhe,   &crypto_method_rsa,       &crypto_method_chacha20_poly1305, 12,   32,        &crypto_method_null,            0,         &crypto_method_tls_prf_sha256},
 #endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
 
     {TLS_ECDHE_ECDSA_WITH_AES_128_CBC_SHA256, &crypto_method_ecdhe,     &crypto_method_ecdsa,     &crypto_method_aes_cbc_128,     16,      16,        &crypto_method_hmac_sha256,     32,        &crypto_method_tls_prf_sha256},
@@ -283,6 +295,7 @@ const NX_SECURE_TLS_CRYPTO nx_crypto_tls_ciphers_ecc =
 
 const USHORT nx_crypto_ecc_supported_groups[] =
 {
+    (USHORT)NX_CRYPTO_EC_X25519,
     (USHORT)NX_CRYPTO_EC_SECP256R1,
     (USHORT)NX_CRYPTO_EC_SECP384R1,
     (USHORT)NX_CRYPTO_EC_SECP521R1,
@@ -290,6 +303,7 @@ const USHORT nx_crypto_ecc_supported_groups[] =
 
 const NX_CRYPTO_METHOD *nx_crypto_ecc_curves[] =
 {
+    &crypto_method_ec_x25519,
     &crypto_method_ec_secp256,
     &crypto_method_ec_secp384,
     &crypto_method_ec_secp521,
@@ -398,6 +412,44 @@ const NX_CRYPTO_CIPHERSUITE nx_crypto_tls_ecdhe_ecdsa_with_aes_128_gcm_sha256 =
     (NX_SECURE_TLS_BITFIELD_VERSIONS_PRE_1_3 | NX_SECURE_DTLS_BITFIELD_VERSIONS_PRE_1_3)
 };
 
+const NX_CRYPTO_CIPHERSUITE nx_crypto_tls_ecdhe_rsa_with_chacha20_poly1305_sha256 =
+/* TLS ciphersuite entry. */
+{   TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256,   /* Ciphersuite ID. */
+    NX_SECURE_APPLICATION_TLS,                     /* Internal application label. */
+    32,                                            /* Symmetric key size. */
+    {   /* Cipher role array. */
+        {NX_CRYPTO_KEY_EXCHANGE_ECDHE,           NX_CRYPTO_ROLE_KEY_EXCHANGE},
+        {NX_CRYPTO_KEY_EXCHANGE_RSA,             NX_CRYPTO_ROLE_SIGNATURE_CRYPTO},
+        {NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305, NX_CRYPTO_ROLE_SYMMETRIC},
+        {NX_CRYPTO_NONE,                         NX_CRYPTO_ROLE_MAC_HASH},
+        {NX_CRYPTO_HASH_SHA256,                  NX_CRYPTO_ROLE_RAW_HASH},
+        {NX_CRYPTO_HASH_HMAC,                    NX_CRYPTO_ROLE_HMAC},
+        {NX_CRYPTO_PRF_HMAC_SHA2_256,            NX_CRYPTO_ROLE_PRF},
+        {NX_CRYPTO_NONE,                         NX_CRYPTO_ROLE_NONE}
+    },
+    /* TLS/DTLS Versions supported. */
+    (NX_SECURE_TLS_BITFIELD_VERSIONS_PRE_1_3 | NX_SECURE_DTLS_BITFIELD_VERSIONS_PRE_1_3)
+};
+
+const NX_CRYPTO_CIPHERSUITE nx_crypto_tls_ecdhe_ecdsa_with_chacha20_poly1305_sha256 =
+/* TLS ciphersuite entry. */
+{   TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256, /* Ciphersuite ID. */
+    NX_SECURE_APPLICATION_TLS,                     /* Internal application label. */
+    32,                                            /* Symmetric key size. */
+    {   /* Cipher role array. */
+        {NX_CRYPTO_KEY_EXCHANGE_ECDHE,           NX_CRYPTO_ROLE_KEY_EXCHANGE},
+        {NX_CRYPTO_DIGITAL_SIGNATURE_ECDSA,      NX_CRYPTO_ROLE_SIGNATURE_CRYPTO},
+        {NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305, NX_CRYPTO_ROLE_SYMMETRIC},
+        {NX_CRYPTO_NONE,                         NX_CRYPTO_ROLE_MAC_HASH},
+        {NX_CRYPTO_HASH_SHA256,                  NX_CRYPTO_ROLE_RAW_HASH},
+        {NX_CRYPTO_HASH_HMAC,                    NX_CRYPTO_ROLE_HMAC},
+        {NX_CRYPTO_PRF_HMAC_SHA2_256,            NX_CRYPTO_ROLE_PRF},
+        {NX_CRYPTO_NONE,                         NX_CRYPTO_ROLE_NONE}
+    },
+    /* TLS/DTLS Versions supported. */
+    (NX_SECURE_TLS_BITFIELD_VERSIONS_PRE_1_3 | NX_SECURE_DTLS_BITFIELD_VERSIONS_PRE_1_3)
+};
+
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
 const NX_CRYPTO_CIPHERSUITE nx_crypto_tls_aes_128_gcm_sha256 =
 /* TLS ciphersuite entry. */
@@ -416,6 +468,24 @@ const NX_CRYPTO_CIPHERSUITE nx_crypto_tls_aes_128_gcm_sha256 =
     /* TLS/DTLS Versions supported. */
     (NX_SECURE_TLS_BITFIELD_VERSION_1_3 | NX_SECURE_DTLS_BITFIELD_VERSION_1_3)
 };
+
+const NX_CRYPTO_CIPHERSUITE nx_crypto_tls_chacha20_poly1305_sha256 =
+/* TLS ciphersuite entry. */
+{   TLS_CHACHA20_POLY1305_SHA256,       /* Ciphersuite ID. */
+    NX_SECURE_APPLICATION_TLS,          /* Internal application label. */
+    32,                                 /* Symmetric key size. */
+    {   /* Cipher role array. */
+        {NX_CRYPTO_KEY_EXCHANGE_ECDHE,           NX_CRYPTO_ROLE_KEY_EXCHANGE},
+        {NX_CRYPTO_DIGITAL_SIGNATURE_ECDSA,      NX_CRYPTO_ROLE_SIGNATURE_CRYPTO},
+        {NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305, NX_CRYPTO_ROLE_SYMMETRIC},
+        {NX_CRYPTO_HASH_SHA256,                  NX_CRYPTO_ROLE_MAC_HASH},
+        {NX_CRYPTO_HASH_SHA256,                  NX_CRYPTO_ROLE_RAW_HASH},
+        {NX_CRYPTO_HKDF_METHOD,                  NX_CRYPTO_ROLE_PRF},
+        {NX_CRYPTO_NONE,                         NX_CRYPTO_ROLE_NONE}
+    },
+    /* TLS/DTLS Versions supported. */
+    (NX_SECURE_TLS_BITFIELD_VERSION_1_3 | NX_SECURE_DTLS_BITFIELD_VERSION_1_3)
+};
 #endif
 
 const NX_CRYPTO_CIPHERSUITE nx_crypto_x509_rsa_md5 =
@@ -579,11 +649,13 @@ const NX_CRYPTO_METHOD *supported_crypto[] =
     &crypto_method_pkcs1,
     &crypto_method_ecdhe,
     &crypto_method_ecdsa,
+    &crypto_method_ed25519,
     &crypto_method_aes_ccm_8,
     &crypto_method_aes_cbc_128,
     &crypto_method_aes_cbc_256,
     &crypto_method_aes_128_gcm_16,
     &crypto_method_aes_256_gcm_16,
+    &crypto_method_chacha20_poly1305,
     &crypto_method_hmac,
     &crypto_method_hmac_md5,
     &crypto_method_hmac_sha1,
@@ -597,6 +669,7 @@ const NX_CRYPTO_METHOD *supported_crypto[] =
     &crypto_method_tls_prf_1,
     &crypto_method_tls_prf_sha256,
     &crypto_method_hkdf,
+    &crypto_method_ec_x25519,
     &crypto_method_ec_secp256,
     &crypto_method_ec_secp384,
     &crypto_method_ec_secp521,
@@ -609,9 +682,12 @@ const NX_CRYPTO_CIPHERSUITE *ciphersuite_map[] =
     /* TLS ciphersuites. */
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
     &nx_crypto_tls_aes_128_gcm_sha256,
+    &nx_crypto_tls_chacha20_poly1305_sha256,
 #endif
     &nx_crypto_tls_ecdhe_rsa_with_aes_128_gcm_sha256,
     &nx_crypto_tls_ecdhe_ecdsa_with_aes_128_gcm_sha256,
+    &nx_crypto_tls_ecdhe_rsa_with_chacha20_poly1305_sha256,
+    &nx_crypto_tls_ecdhe_ecdsa_with_chacha20_poly1305_sha256,
     &nx_crypto_tls_rsa_with_aes_128_cbc_sha256,
 
     /* X.509 ciphersuites. */
@@ -21,6 +21,8 @@
 /**************************************************************************/
 
 #include "nx_crypto_hmac.h"
+#include "nx_crypto_sha2.h"
+#include "nx_crypto_sha5.h"
 
 /**************************************************************************/
 /*                                                                        */
@@ -93,8 +95,7 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac(NX_CRYPTO_HMAC *hmac_metadata,
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_hmac_initialize                          PORTABLE C      */
-/*                                                           6.1          */
-/*                                                                        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -136,12 +137,16 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac(NX_CRYPTO_HMAC *hmac_metadata,
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), reused   */
+/*                                            cached pad states,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_hmac_initialize(NX_CRYPTO_HMAC *hmac_metadata, UCHAR *key_ptr, UINT key_length)
 {
 UCHAR temp_key[128];
 UINT  i;
+UCHAR diff;
 
     /* If key is longer than block size, reset it to key=CRYPTO(key). */
     if (key_length > hmac_metadata -> block_size)
@@ -158,6 +163,35 @@ UINT  i;
         key_length = hmac_metadata -> output_length;
     }
 
+    /* Check whether the saved pad states belong to this key. The comparison
+       runs over the whole block so that its timing does not depend on where
+       the keys differ.  */
+    if ((hmac_metadata -> state_size != 0) &&
+        (hmac_metadata -> state_algorithm == hmac_metadata -> algorithm))
+    {
+        diff = 0;
+        for (i = 0; i < hmac_metadata -> block_size; i++)
+        {
+            diff |= (UCHAR)(hmac_metadata -> k_ipad[i] ^ ((i < key_length) ? key_ptr[i] : 0) ^ 0x36);
+        }
+
+        if (diff == 0)
+        {
+
+            /* Resume the inner hash from the state after the padded key. */
+            hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+            NX_CRYPTO_MEMCPY(hmac_metadata -> state_context, hmac_metadata -> ipad_state, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+
+#ifdef NX_SECURE_KEY_CLEAR
+            NX_CRYPTO_MEMSET(temp_key, 0, sizeof(temp_key));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+            /* Return success.  */
+            return(NX_CRYPTO_SUCCESS);
+        }
+    }
+    hmac_metadata -> state_algorithm = 0;
+
     hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
 
     /* The HMAC_CRYPTO transform looks like:
@@ -185,9 +219,26 @@ UINT  i;
         hmac_metadata -> k_opad[i] ^= 0x5c;
     }
 
+    if (hmac_metadata -> state_size != 0)
+    {
+
+        /* Save the outer hash state after the padded key. */
+        hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+        NX_CRYPTO_MEMCPY(hmac_metadata -> opad_state, hmac_metadata -> state_context, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+        hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+    }
+
     /* Kick off the inner hash with our padded key. */
     hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_ipad, hmac_metadata -> block_size);
 
+    if (hmac_metadata -> state_size != 0)
+    {
+
+        /* Save the inner hash state after the padded key. */
+        NX_CRYPTO_MEMCPY(hmac_metadata -> ipad_state, hmac_metadata -> state_context, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+        hmac_metadata -> state_algorithm = hmac_metadata -> algorithm;
+    }
+
 #ifdef NX_SECURE_KEY_CLEAR
     NX_CRYPTO_MEMSET(temp_key, 0, sizeof(temp_key));
 #endif /* NX_SECURE_KEY_CLEAR  */
@@ -256,8 +307,7 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac_update(NX_CRYPTO_HMAC *hmac_metadata, UCHAR
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_hmac_digest_calculate                    PORTABLE C      */
-/*                                                           6.1          */
-/*                                                                        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -294,6 +344,9 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac_update(NX_CRYPTO_HMAC *hmac_metadata, UCHAR
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), reused   */
+/*                                            cached outer pad state,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_hmac_digest_calculate(NX_CRYPTO_HMAC *hmac_metadata, UCHAR *digest_ptr, UINT digest_length)
@@ -306,7 +359,17 @@ UCHAR icv_ptr[64];
 
     hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
 
-    hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+    if ((hmac_metadata -> state_size != 0) &&
+        (hmac_metadata -> state_algorithm == hmac_metadata -> algorithm))
+    {
+
+        /* Resume the outer hash from the state after the padded key. */
+        NX_CRYPTO_MEMCPY(hmac_metadata -> state_context, hmac_metadata -> opad_state, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+    }
+    else
+    {
+        hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+    }
 
     hmac_metadata -> crypto_update(hmac_metadata -> context, icv_ptr, hmac_metadata -> output_length);
 
@@ -328,8 +391,7 @@ UCHAR icv_ptr[64];
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_hmac_metadata_set                        PORTABLE C      */
-/*                                                           6.1          */
-/*                                                                        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -374,6 +436,9 @@ UCHAR icv_ptr[64];
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), reset    */
+/*                                            pad state cache,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_hmac_metadata_set(NX_CRYPTO_HMAC *hmac_metadata,
@@ -391,6 +456,250 @@ NX_CRYPTO_KEEP VOID _nx_crypto_hmac_metadata_set(NX_CRYPTO_HMAC *hmac_metadata,
     hmac_metadata -> crypto_initialize = crypto_initialize;
     hmac_metadata -> crypto_update = crypto_update;
     hmac_metadata -> crypto_digest_calculate = crypto_digest_calculate;
+    hmac_metadata -> state_context = NX_CRYPTO_NULL;
+    hmac_metadata -> state_size = 0;
+    hmac_metadata -> crypto_multi_update = NX_CRYPTO_NULL;
+    hmac_metadata -> crypto_multi_digest_calculate = NX_CRYPTO_NULL;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_hmac_state_cache_set                     PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function enables caching of the hash states reached after the  */
+/*    keyed ipad and opad blocks. The state to save is the first          */
+/*    state_size bytes of state_context; when initialization sees the     */
+/*    same key again it restores these states instead of hashing the      */
+/*    padded key blocks. A state_size of zero or one larger than          */
+/*    NX_CRYPTO_HMAC_MAX_STATE_SIZE disables the cache.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hmac_metadata                         pointer to HMAC metadata      */
+/*    state_context                         pointer to hash state         */
+/*    state_size                            size of hash state            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_crypto_method_hmac_operation      Handle HMAC operation         */
+/*    _nx_crypto_method_hmac_sha256_operation Handle HMAC-SHA256 operation*/
+/*    _nx_crypto_method_hmac_sha512_operation Handle HMAC-SHA512 operation*/
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_hmac_state_cache_set(NX_CRYPTO_HMAC *hmac_metadata, VOID *state_context, UINT state_size)
+{
+
+    if ((state_context == NX_CRYPTO_NULL) || (state_size > NX_CRYPTO_HMAC_MAX_STATE_SIZE))
+    {
+        state_size = 0;
+    }
+
+    hmac_metadata -> state_context = state_context;
+    hmac_metadata -> state_size = state_size;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_hmac_multi_buffer_set                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the hash functions that process several          */
+/*    contexts together, used by _nx_crypto_hmac_multi.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hmac_metadata                         pointer to HMAC metadata      */
+/*    crypto_multi_update                   multi-buffer update function  */
+/*    crypto_multi_digest_calculate         multi-buffer digest function  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_crypto_method_hmac_sha256_operation Handle HMAC-SHA256 operation*/
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_hmac_multi_buffer_set(NX_CRYPTO_HMAC *hmac_metadata,
+                                                     UINT (*crypto_multi_update)(VOID **, UCHAR **, UINT, UINT),
+                                                     UINT (*crypto_multi_digest_calculate)(VOID **, UCHAR **, UINT, UINT))
+{
+
+    hmac_metadata -> crypto_multi_update = crypto_multi_update;
+    hmac_metadata -> crypto_multi_digest_calculate = crypto_multi_digest_calculate;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_hmac_multi                               PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function calculates the HMAC of count messages of equal length */
+/*    under the key last passed to _nx_crypto_hmac_initialize. Each       */
+/*    message uses its own hash context, and the inner and outer hashes   */
+/*    of up to NX_CRYPTO_HMAC_MULTI_BUFFER_LANES messages are computed    */
+/*    together by the multi-buffer hash functions. The cached pad states  */
+/*    and the multi-buffer functions must both be set.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hmac_metadata                         pointer to HMAC metadata      */
+/*    context                               array of hash contexts        */
+/*    input_ptr                             array of input streams        */
+/*    input_length                          length of each input stream   */
+/*    digest_ptr                            array of output digests       */
+/*    digest_length                         length of each digest         */
+/*    count                                 number of messages            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [crypto_initialize]                   Perform crypto initialization */
+/*    [crypto_multi_update]                 Update several contexts       */
+/*    [crypto_multi_digest_calculate]       Calculate several digests     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_hmac_multi(NX_CRYPTO_HMAC *hmac_metadata, VOID **context,
+                                          UCHAR **input_ptr, UINT input_length,
+                                          UCHAR **digest_ptr, UINT digest_length, UINT count)
+{
+UCHAR  icv[NX_CRYPTO_HMAC_MULTI_BUFFER_LANES][64];
+UCHAR *icv_ptr[NX_CRYPTO_HMAC_MULTI_BUFFER_LANES];
+UINT   offset;
+UINT   lanes;
+UINT   i;
+ULONG  state_offset;
+
+    if ((hmac_metadata -> crypto_multi_update == NX_CRYPTO_NULL) ||
+        (hmac_metadata -> crypto_multi_digest_calculate == NX_CRYPTO_NULL) ||
+        (hmac_metadata -> state_size == 0) ||
+        (hmac_metadata -> state_algorithm != hmac_metadata -> algorithm) ||
+        (hmac_metadata -> output_length > sizeof(icv[0])))
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    if ((context == NX_CRYPTO_NULL) || (input_ptr == NX_CRYPTO_NULL) || (digest_ptr == NX_CRYPTO_NULL))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if (digest_length > hmac_metadata -> output_length)
+    {
+        digest_length = hmac_metadata -> output_length;
+    }
+
+    /* The saved states live at the same offset in every hash context. */
+    state_offset = (ULONG)((UCHAR *)hmac_metadata -> state_context - (UCHAR *)hmac_metadata -> context);
+
+    for (i = 0; i < NX_CRYPTO_HMAC_MULTI_BUFFER_LANES; i++)
+    {
+        icv_ptr[i] = icv[i];
+    }
+
+    for (offset = 0; offset < count; offset += lanes)
+    {
+        lanes = count - offset;
+        if (lanes > NX_CRYPTO_HMAC_MULTI_BUFFER_LANES)
+        {
+            lanes = NX_CRYPTO_HMAC_MULTI_BUFFER_LANES;
+        }
+
+        /* Inner hashes. */
+        for (i = 0; i < lanes; i++)
+        {
+            hmac_metadata -> crypto_initialize(context[offset + i], hmac_metadata -> algorithm);
+            NX_CRYPTO_MEMCPY((UCHAR *)context[offset + i] + state_offset, hmac_metadata -> ipad_state, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+        }
+        hmac_metadata -> crypto_multi_update(&context[offset], &input_ptr[offset], input_length, lanes);
+        hmac_metadata -> crypto_multi_digest_calculate(&context[offset], icv_ptr, lanes, hmac_metadata -> algorithm);
+
+        /* Outer hashes. */
+        for (i = 0; i < lanes; i++)
+        {
+            hmac_metadata -> crypto_initialize(context[offset + i], hmac_metadata -> algorithm);
+            NX_CRYPTO_MEMCPY((UCHAR *)context[offset + i] + state_offset, hmac_metadata -> opad_state, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+        }
+        hmac_metadata -> crypto_multi_update(&context[offset], icv_ptr, hmac_metadata -> output_length, lanes);
+        hmac_metadata -> crypto_multi_digest_calculate(&context[offset], icv_ptr, lanes, hmac_metadata -> algorithm);
+
+        for (i = 0; i < lanes; i++)
+        {
+            NX_CRYPTO_MEMCPY(digest_ptr[offset + i], icv[i], digest_length); /* Use case of memcpy is verified. */
+        }
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(icv, 0, sizeof(icv));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    /* Return success.  */
+    return(NX_CRYPTO_SUCCESS);
 }
 
 /**************************************************************************/
@@ -776,8 +1085,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_cleanup(VOID *crypto_metadata)
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_method_hmac_operation                    PORTABLE C      */
-/*                                                           6.1          */
-/*                                                                        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -821,6 +1129,9 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_cleanup(VOID *crypto_metadata)
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), enabled  */
+/*                                            pad state cache for SHA-2,  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_method_hmac_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
@@ -881,6 +1192,22 @@ UINT                 status;
                                      _nx_crypto_hmac_hash_update,
                                      _nx_crypto_hmac_hash_digest_calculate);
 
+        /* The built-in SHA-2 methods keep their state at the start of the hash context,
+         * so the keyed pad states can be cached. */
+        hmac->state_algorithm = 0;
+        if (method->nx_crypto_operation == _nx_crypto_method_sha256_operation)
+        {
+            _nx_crypto_hmac_state_cache_set(hmac, hmac->hash_context,
+                                            sizeof(((NX_CRYPTO_SHA256 *)0)->nx_sha256_states) +
+                                            sizeof(((NX_CRYPTO_SHA256 *)0)->nx_sha256_bit_count));
+        }
+        else if (method->nx_crypto_operation == _nx_crypto_method_sha512_operation)
+        {
+            _nx_crypto_hmac_state_cache_set(hmac, hmac->hash_context,
+                                            sizeof(((NX_CRYPTO_SHA512 *)0)->nx_sha512_states) +
+                                            sizeof(((NX_CRYPTO_SHA512 *)0)->nx_sha512_bit_count));
+        }
+
         /* Initialize the hash routine. */
         status = method->nx_crypto_init(method, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, hmac->hash_context, method->nx_crypto_metadata_area_size);
         break;
@@ -166,8 +166,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha256_cleanup(VOID *crypto_metadata
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_method_hmac_sha256_operation             PORTABLE C      */
-/*                                                           6.1          */
-/*  AUTHOR                                                                */
+/*                                                           6.1.8        */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
 /*                                                                        */
@@ -200,6 +199,8 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha256_cleanup(VOID *crypto_metadata
 /*                                                                        */
 /*    _nx_crypto_hmac                       Calculate the HMAC            */
 /*    _nx_crypto_hmac_metadata_set          Set HMAC metadata             */
+/*    _nx_crypto_hmac_state_cache_set       Enable pad state cache        */
+/*    _nx_crypto_hmac_multi_buffer_set      Set multi-buffer functions    */
 /*    _nx_crypto_hmac_initialize            Perform HMAC initialization   */
 /*    _nx_crypto_hmac_update                Perform HMAC update           */
 /*    _nx_crypto_hmac_digest_calculate      Calculate HMAC digest         */
@@ -215,6 +216,10 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha256_cleanup(VOID *crypto_metadata
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), enabled  */
+/*                                            pad state cache and         */
+/*                                            multi-buffer HMAC,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha256_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
@@ -280,6 +285,11 @@ UINT                    icv_length;
                                  (UINT (*)(VOID *, UINT))_nx_crypto_sha256_initialize,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha256_update,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha256_digest_calculate);
+    _nx_crypto_hmac_state_cache_set(hmac_metadata, &(ctx -> nx_sha256_hmac_context),
+                                    sizeof(ctx -> nx_sha256_hmac_context.nx_sha256_states) + sizeof(ctx -> nx_sha256_hmac_context.nx_sha256_bit_count));
+    _nx_crypto_hmac_multi_buffer_set(hmac_metadata,
+                                     (UINT (*)(VOID **, UCHAR **, UINT, UINT))_nx_crypto_sha256_multi_update,
+                                     (UINT (*)(VOID **, UCHAR **, UINT, UINT))_nx_crypto_sha256_multi_digest_calculate);
 
 
     switch (op)
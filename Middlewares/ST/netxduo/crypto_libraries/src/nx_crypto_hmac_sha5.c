@@ -165,8 +165,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha512_cleanup(VOID *crypto_metadata
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_method_hmac_sha512_operation             PORTABLE C      */
-/*                                                           6.1          */
-/*  AUTHOR                                                                */
+/*                                                           6.1.8        */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
 /*                                                                        */
@@ -199,6 +198,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha512_cleanup(VOID *crypto_metadata
 /*                                                                        */
 /*    _nx_crypto_hmac                       Calculate the HMAC            */
 /*    _nx_crypto_hmac_metadata_set          Set HMAC metadata             */
+/*    _nx_crypto_hmac_state_cache_set       Enable pad state cache        */
 /*    _nx_crypto_hmac_initialize            Perform HMAC initialization   */
 /*    _nx_crypto_hmac_update                Perform HMAC update           */
 /*    _nx_crypto_hmac_digest_calculate      Calculate HMAC digest         */
@@ -214,6 +214,9 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha512_cleanup(VOID *crypto_metadata
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), enabled  */
+/*                                            pad state cache,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha512_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
@@ -294,6 +297,8 @@ UINT                    icv_full_length;
                                  (UINT (*)(VOID *, UINT))_nx_crypto_sha512_initialize,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha512_update,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha512_digest_calculate);
+    _nx_crypto_hmac_state_cache_set(hmac_metadata, &(ctx -> nx_sha512_hmac_context),
+                                    sizeof(ctx -> nx_sha512_hmac_context.nx_sha512_states) + sizeof(ctx -> nx_sha512_hmac_context.nx_sha512_bit_count));
 
 
     switch (op)
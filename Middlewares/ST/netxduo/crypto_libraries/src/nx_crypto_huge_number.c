@@ -2402,7 +2402,7 @@ UINT                  buffer_size;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_huge_number_mont                         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -2411,6 +2411,8 @@ UINT                  buffer_size;
 /*                                                                        */
 /*    This function performs Montgomery reduction for multiplication.     */
 /*                  r = (x * y) * R ^ (-1) mod m                          */
+/*    Multiplication and reduction are interleaved digit by digit         */
+/*    (CIOS), so r is scanned once per digit of x.                        */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -2446,6 +2448,10 @@ UINT                  buffer_size;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            interleaved multiplication  */
+/*                                            and reduction,              */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_mont(NX_CRYPTO_HUGE_NUMBER *m, UINT mi,
@@ -2454,9 +2460,11 @@ NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_mont(NX_CRYPTO_HUGE_NUMBER *m, UINT m
                                                 NX_CRYPTO_HUGE_NUMBER *result)
 {
 UINT      i, j;
+UINT      loop_len;
 HN_UBASE  u;
 HN_UBASE  xi;
 HN_UBASE2 product;
+HN_UBASE2 carry;
 UINT      m_len = m -> nx_crypto_huge_number_size;
 UINT      x_len = x -> nx_crypto_huge_number_size;
 UINT      y_len = y -> nx_crypto_huge_number_size;
@@ -2467,60 +2475,43 @@ HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
 
     NX_CRYPTO_MEMSET(result -> nx_crypto_huge_number_data, 0, (m_len + 1) * sizeof(HN_UBASE));
 
-    for (i = 0; i < x_len; i++)
-    {
+    loop_len = (x_len > m_len) ? x_len : m_len;
 
-        xi = x_buffer[i];
+    /* Coarsely Integrated Operand Scanning (CIOS). Both the multiplication and the reduction
+       are done in one pass over r per digit of x, each with its own carry:
+       r = (r + x[i] * y + u * m) / radix */
+    for (i = 0; i < loop_len; i++)
+    {
 
-        /* r = (r + x[i] * y + u * m) / radix */
-        product = 0;
-        for (j = 0; j < y_len; j++)
-        {
-            product >>= HN_SHIFT;
-            product += result_buffer[j] + (HN_UBASE2)xi * y_buffer[j];
-            result_buffer[j] = (product & HN_MASK);
-        }
-        for (; j < (m_len + 1); j++)
-        {
-            product >>= HN_SHIFT;
-            product += result_buffer[j];
-            result_buffer[j] = (product & HN_MASK);
-        }
+        xi = (i < x_len) ? x_buffer[i] : 0;
 
         /* u = (r[0] + x[i] * y[0]) * mi mod radix */
-        u = result_buffer[0] * mi;
+        product = result_buffer[0] + (HN_UBASE2)xi * y_buffer[0];
+        u = (HN_UBASE)((HN_UBASE)product * mi);
+        carry = ((product & HN_MASK) + (HN_UBASE2)u * m_buffer[0]) >> HN_SHIFT;
+        product >>= HN_SHIFT;
 
-        product = result_buffer[0] + (HN_UBASE2)u * m_buffer[0];
-        for (j = 1; j < m_len; j++)
+        for (j = 1; j < y_len; j++)
         {
+            product += result_buffer[j] + (HN_UBASE2)xi * y_buffer[j];
+            carry += (product & HN_MASK) + (HN_UBASE2)u * m_buffer[j];
+            result_buffer[j - 1] = (HN_UBASE)(carry & HN_MASK);
             product >>= HN_SHIFT;
-            product += result_buffer[j] + (HN_UBASE2)u * m_buffer[j];
-            result_buffer[j - 1] = (product & HN_MASK);
+            carry >>= HN_SHIFT;
         }
-        product >>= HN_SHIFT;
-        product += result_buffer[j];
-        result_buffer[j - 1] = (product & HN_MASK);
-        result_buffer[j] = (HN_UBASE)(product >> HN_SHIFT);
-    }
-
-    for (; i < m_len; i++)
-    {
-
-        /* u = (r[0] + x[i] * y[0]) * mi mod radix */
-        u = ((result_buffer[0] * mi) & HN_MASK);
-
-        /* r = (r + x[i] * y + u * m) / radix */
-        product = result_buffer[0] + (HN_UBASE2)u * m_buffer[0];
-        for (j = 1; j < m_len; j++)
+        for (; j < m_len; j++)
         {
+            product += result_buffer[j];
+            carry += (product & HN_MASK) + (HN_UBASE2)u * m_buffer[j];
+            result_buffer[j - 1] = (HN_UBASE)(carry & HN_MASK);
             product >>= HN_SHIFT;
-            product += result_buffer[j] + (HN_UBASE2)u * m_buffer[j];
-            result_buffer[j - 1] = (product & HN_MASK);
+            carry >>= HN_SHIFT;
         }
-        product >>= HN_SHIFT;
-        product += result_buffer[j];
-        result_buffer[j - 1] = (product & HN_MASK);
-        result_buffer[j] = (HN_UBASE)(product >> HN_SHIFT);
+
+        /* Fold both carries into the top two digits. */
+        carry += product + result_buffer[m_len];
+        result_buffer[m_len - 1] = (HN_UBASE)(carry & HN_MASK);
+        result_buffer[m_len] = (HN_UBASE)(carry >> HN_SHIFT);
     }
 
     /* Set result size. */
@@ -2540,7 +2531,7 @@ HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_huge_number_mont_power_modulus           PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -2550,8 +2541,12 @@ HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
 /*    This function raises a huge number to the power of a second huge    */
 /*    number using a third huge number as a modulus. The result is placed */
 /*    in a fourth huge number. Montgomery reduction is used.              */
-/*    scratch is required to be larger than twice of buffer size of m     */
-/*    plus 8 bytes.                                                       */
+/*    The exponent is scanned with a sliding window whose size depends on */
+/*    the exponent length and is limited by                               */
+/*    NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS.                             */
+/*    scratch is required to be larger than                               */
+/*    (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_SIZE + 1) times of buffer size   */
+/*    of m plus 4 bytes.                                                  */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -2600,6 +2595,9 @@ HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            sliding window exponent,    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_mont_power_modulus(NX_CRYPTO_HUGE_NUMBER *x,
@@ -2609,7 +2607,7 @@ NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_mont_power_modulus(NX_CRYPTO_HUGE_NUM
                                                               HN_UBASE *scratch)
 {
 UINT                   m_len;
-NX_CRYPTO_HUGE_NUMBER  xx;
+NX_CRYPTO_HUGE_NUMBER  table[NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_SIZE];
 NX_CRYPTO_HUGE_NUMBER  temp;
 NX_CRYPTO_HUGE_NUMBER  digit;
 NX_CRYPTO_HUGE_NUMBER  radix;
@@ -2619,8 +2617,8 @@ HN_UBASE               digit_value;
 HN_UBASE              *val;
 HN_UBASE               radix_buffer[2] = {0, 1};
 HN_UBASE               mm_buffer[2];
-HN_UBASE               cur_block;
-UINT                   bit, exp_size;
+UINT                   window_bits, window_value;
+UINT                   i, bit, exp_bits, started;
 NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 
     /* Adjust sizes before performing the calculation. */
@@ -2644,10 +2642,47 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
     _nx_crypto_huge_number_inverse_modulus(&m0, &radix, &mi, scratch);
     mm_buffer[0] = (HN_UBASE)(HN_RADIX - mm_buffer[0]);
 
+    /* Count the significant bits of the exponent. */
+    exp_bits = e -> nx_crypto_huge_number_size << (HN_SIZE_SHIFT + 3);
+    while ((exp_bits > 0) && !NX_CRYPTO_HUGE_NUMBER_BIT(e, exp_bits - 1))
+    {
+        exp_bits--;
+    }
+
+    /* Pick the window size from the exponent length, bounded by the size of the table. */
+    if (exp_bits > 671)
+    {
+        window_bits = 6;
+    }
+    else if (exp_bits > 239)
+    {
+        window_bits = 5;
+    }
+    else if (exp_bits > 79)
+    {
+        window_bits = 4;
+    }
+    else if (exp_bits > 23)
+    {
+        window_bits = 3;
+    }
+    else
+    {
+        window_bits = 1;
+    }
+    if (window_bits > NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS)
+    {
+        window_bits = NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_BITS;
+    }
+
     /* Set buffers. */
-    /* Buffer usage: 2 * buffer_size of m + 8 */
-    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&xx, scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
+    /* Buffer usage: (table size + 1) * (buffer_size of m + 4) */
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&table[0], scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
+    for (i = 1; i < (1u << (window_bits - 1)); i++)
+    {
+        NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&table[i], scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
+    }
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE_DIGIT(&digit, &digit_value, 1);
 
 
@@ -2662,41 +2697,60 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
     /* xx = mont(x, radix ^ (2 * m_len) mod m)*/
     _nx_crypto_huge_number_square(&temp, result);
     _nx_crypto_huge_number_modulus(result, m);
-    _nx_crypto_huge_number_mont(m, mm_buffer[0], x, result, &xx);
+    _nx_crypto_huge_number_mont(m, mm_buffer[0], x, result, &table[0]);
+
+    /* Precompute the odd powers of xx: table[i] = xx ^ (2 * i + 1). */
+    if (window_bits > 1)
+    {
+
+        /* result = xx ^ 2 */
+        _nx_crypto_huge_number_mont(m, mm_buffer[0], &table[0], &table[0], result);
+        for (i = 1; i < (1u << (window_bits - 1)); i++)
+        {
+            _nx_crypto_huge_number_mont(m, mm_buffer[0], &table[i - 1], result, &table[i]);
+        }
+    }
 
     /* result = x' */
     NX_CRYPTO_HUGE_NUMBER_COPY(result, &temp);
 
-    /* Clear out the result since we need it to start with a simple value. */
-
     operand = result;
     temp_result = &temp;
+    started = NX_CRYPTO_FALSE;
 
-    exp_size = e -> nx_crypto_huge_number_size;
-    m -> nx_crypto_huge_number_size = m -> nx_crypto_huge_number_size;
-    val = e -> nx_crypto_huge_number_data + (exp_size - 1);
-
-    /* Loop through the bits of the exponent. For each bit set, multiply the result by the running square. */
-    for (; (ULONG)val >= (ULONG)(e -> nx_crypto_huge_number_data); val--)
+    /* Scan the exponent from the most significant bit. Runs of zero bits cost one square each,
+       while a window of up to window_bits bits that starts and ends with a set bit costs one
+       square per bit plus a single multiply by the matching odd power from the table. */
+    bit = exp_bits;
+    while (bit > 0)
     {
-        /* Current byte in the exponent determines whether we multiply or not. */
-        cur_block = *val;
-
-        /* Loop over the bits in the current byte to see whether we add or not. */
-        for (bit = 0; bit < HN_SHIFT; bit++)
+        if (!NX_CRYPTO_HUGE_NUMBER_BIT(e, bit - 1))
         {
 
-            /* A non-zero bit means we need to multiply. */
-            if (cur_block & (1u << (NX_CRYPTO_HUGE_NUMBER_BITS - (1 + bit))))
-            {
+            /* result = mont(result, result) */
+            _nx_crypto_huge_number_mont(m, mm_buffer[0], operand, operand, temp_result);
+            temp_swap = temp_result;
+            temp_result = operand;
+            operand = temp_swap;
+            bit--;
+            continue;
+        }
 
-                /* result = mont(result, result) */
-                _nx_crypto_huge_number_mont(m, mm_buffer[0], operand, operand, temp_result);
+        /* Find the longest window that ends with a set bit. */
+        i = (bit > window_bits) ? (bit - window_bits) : 0;
+        while (!NX_CRYPTO_HUGE_NUMBER_BIT(e, i))
+        {
+            i++;
+        }
 
-                /* result = mont(result, xx) */
-                _nx_crypto_huge_number_mont(m, mm_buffer[0], temp_result, &xx, operand);
-            }
-            else
+        /* Collect the window value and square once per bit. */
+        window_value = 0;
+        while (bit > i)
+        {
+            bit--;
+            window_value = (window_value << 1) | NX_CRYPTO_HUGE_NUMBER_BIT(e, bit);
+
+            if (started)
             {
 
                 /* result = mont(result, result) */
@@ -2706,6 +2760,23 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
                 operand = temp_swap;
             }
         }
+
+        if (started)
+        {
+
+            /* result = mont(result, xx ^ window_value) */
+            _nx_crypto_huge_number_mont(m, mm_buffer[0], operand, &table[window_value >> 1], temp_result);
+            temp_swap = temp_result;
+            temp_result = operand;
+            operand = temp_swap;
+        }
+        else
+        {
+
+            /* The first window simply loads the table entry. */
+            NX_CRYPTO_HUGE_NUMBER_COPY(operand, &table[window_value >> 1]);
+            started = NX_CRYPTO_TRUE;
+        }
     }
 
     /* result = mont(result, 1) */
@@ -2721,7 +2792,7 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_huge_number_crt_power_modulus            PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -2731,13 +2802,15 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 /*    This function raises a huge number to the power of a second huge    */
 /*    number using a fifth huge number as a modulus. The result is placed */
 /*    in a sixth huge number. Montgomery reduction and Chinese Remainder  */
-/*    Theorem are used.                                                   */
+/*    Theorem are used. The two halves are recombined with Garner's       */
+/*    formula, which needs only the inverse of q modulo p.                */
 /*                                                                        */
 /*    Requirement:                                                        */
 /*      1. m = p * q                                                      */
 /*      2. p and q are primes                                             */
-/*      3. scratch is required to be no less than 4 times of buffer size  */
-/*    of m plus 24 bytes.                                                 */
+/*      3. scratch is required to be no less than 2.5 times of buffer     */
+/*    size of m plus (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_SIZE + 1) times   */
+/*    of half buffer size of m plus 4 bytes, plus 24 bytes.               */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -2767,6 +2840,7 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 /*                                             huge numbers               */
 /*    _nx_crypto_huge_number_multiply       Multiply two huge numbers     */
 /*    _nx_crypto_huge_number_modulus        Perform a modulus operation   */
+/*    _nx_crypto_huge_number_compare        Compare two huge numbers      */
 /*    _nx_crypto_huge_number_inverse_modulus_prime                        */
 /*                                          Perform an inverse modulus    */
 /*                                            operation for prime number  */
@@ -2785,6 +2859,9 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            Garner's recombination,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_crt_power_modulus(NX_CRYPTO_HUGE_NUMBER *x,
@@ -2795,8 +2872,8 @@ NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_crt_power_modulus(NX_CRYPTO_HUGE_NUMB
                                                              NX_CRYPTO_HUGE_NUMBER *result,
                                                              HN_UBASE *scratch)
 {
-NX_CRYPTO_HUGE_NUMBER *ep, *eq, *xp, *xq, *m1, *m2;
-NX_CRYPTO_HUGE_NUMBER  pi, qi;
+NX_CRYPTO_HUGE_NUMBER *ep, *eq, *xp, *xq, *m1, *m2, *h;
+NX_CRYPTO_HUGE_NUMBER  qi;
 NX_CRYPTO_HUGE_NUMBER  temp1, temp2, temp3;
 NX_CRYPTO_HUGE_NUMBER  digit;
 HN_UBASE               digit_value;
@@ -2810,22 +2887,19 @@ HN_UBASE               digit_value;
      * xq = x mod q
      * m2 = xq ^ eq mod q
      *
-     * pi = p ^ (-1) mod q
      * qi = q ^ (-1) mod p
      *
-     * r = (m1 * qi * q + m2 * pi * p) mod m
+     * Garner's recombination:
+     * h = qi * (m1 - m2) mod p
+     * r = m2 + h * q
      ****************************************/
 
-    /* Buffer usage: 1 * buffer size of m */
-    /* temp1 is used to hold the result of pi * p * m2. So twice of m buffer size is used.  */
-    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&pi, scratch, p -> nx_crypto_huge_buffer_size);
-    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&qi, scratch, q -> nx_crypto_huge_buffer_size);
+    /* Buffer usage: 0.5 * buffer size of m */
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&qi, scratch, p -> nx_crypto_huge_buffer_size);
 
     /* qi = q ^ (-1) mod p */
-    /* pi = p ^ (-1) mod q */
     /* Buffer usage: 2 * buffer_size of m + 24 bytes */
     _nx_crypto_huge_number_inverse_modulus_prime(q, p, &qi, scratch);
-    _nx_crypto_huge_number_inverse_modulus_prime(p, q, &pi, scratch);
 
     /* Buffer usage: 2 * buffer size of m */
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp1, scratch, m -> nx_crypto_huge_buffer_size);
@@ -2849,12 +2923,11 @@ HN_UBASE               digit_value;
     /* m1 = xp ^ ep mod p */
     m1 = &temp1;
 
-    /* Buffer usage: 1 * buffer_size of m + 8 bytes */
+    /* Buffer usage: (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_SIZE + 1) * (0.5 * buffer_size of m + 4 bytes) */
     _nx_crypto_huge_number_mont_power_modulus(xp, ep, p, m1, scratch);
 
-    /* m1 * qi * q */
-    _nx_crypto_huge_number_multiply(&qi, m1, &temp3);
-    _nx_crypto_huge_number_multiply(&temp3, q, result);
+    /* Keep m1 in result. */
+    NX_CRYPTO_HUGE_NUMBER_COPY(result, m1);
 
 
     /* In the following calculation, buffer of temp3 is used by temp2. */
@@ -2873,20 +2946,27 @@ HN_UBASE               digit_value;
     /* m2 = xq ^ eq mod q */
     m2 = &temp1;
 
-    /* Buffer usage: 1 * buffer_size of m + 8 bytes */
+    /* Buffer usage: (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_SIZE + 1) * (0.5 * buffer_size of m + 4 bytes) */
     _nx_crypto_huge_number_mont_power_modulus(xq, eq, q, m2, scratch);
 
-    /* pi * p * m2 */
-    _nx_crypto_huge_number_multiply(&pi, m2, &temp3);
 
-    /* Buffer of temp2 is not used anymore. It is used by temp1.
-     * So buffer length of temp1 is 1.5 * buffer length of m.
-     * It is large enough to hold the result of pi * p * m2 */
-    _nx_crypto_huge_number_multiply(p, &temp3, &temp1);
+    /* m1 - m2 mod p, kept non-negative by adding p when m1 < (m2 mod p). */
+    NX_CRYPTO_HUGE_NUMBER_COPY(&temp3, m2);
+    _nx_crypto_huge_number_modulus(&temp3, p);
+    if (_nx_crypto_huge_number_compare(result, &temp3) == NX_CRYPTO_HUGE_NUMBER_LESS)
+    {
+        _nx_crypto_huge_number_add(result, p);
+    }
+    _nx_crypto_huge_number_subtract(result, &temp3);
 
+    /* h = qi * (m1 - m2) mod p */
+    /* Buffer of temp3 is not used anymore. It is used by temp2 to hold the product. */
+    h = &temp2;
+    _nx_crypto_huge_number_multiply(result, &qi, h);
+    _nx_crypto_huge_number_modulus(h, p);
 
-    /* r = (m1 * qi * q + m2 * pi * p) mod m */
-    _nx_crypto_huge_number_add(result, &temp1);
-    _nx_crypto_huge_number_modulus(result, m);
+    /* r = m2 + h * q */
+    _nx_crypto_huge_number_multiply(h, q, result);
+    _nx_crypto_huge_number_add(result, m2);
 }
 
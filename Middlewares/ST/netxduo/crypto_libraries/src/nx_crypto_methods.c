@@ -38,11 +38,13 @@
 #include "nx_crypto_hmac_sha5.h"
 #include "nx_crypto_hmac_md5.h"
 #include "nx_crypto_aes.h"
+#include "nx_crypto_chacha20_poly1305.h"
 #include "nx_crypto_rsa.h"
 #include "nx_crypto_null.h"
 #include "nx_crypto_ecjpake.h"
 #include "nx_crypto_ecdsa.h"
 #include "nx_crypto_ecdh.h"
+#include "nx_crypto_ed25519.h"
 #include "nx_crypto_drbg.h"
 #include "nx_crypto_pkcs1_v1.5.h"
 
@@ -51,7 +53,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    nx_crypto_methods                                   PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -86,6 +88,10 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            added X25519 and Ed25519,   */
+/*                                            added ChaCha20-Poly1305,    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -219,6 +225,20 @@ NX_CRYPTO_METHOD crypto_method_aes_256_gcm_16 =
     _nx_crypto_method_aes_gcm_operation,         /* AES-GCM operation                      */
 };
 
+/* Declare the ChaCha20-Poly1305 encrytion method. */
+NX_CRYPTO_METHOD crypto_method_chacha20_poly1305 =
+{
+    NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305,      /* ChaCha20-Poly1305 crypto algorithm     */
+    NX_CRYPTO_CHACHA20_KEY_LEN_IN_BITS,          /* Key size in bits                       */
+    (NX_CRYPTO_CHACHA20_NONCE_SIZE << 3),        /* IV size in bits                        */
+    (NX_CRYPTO_POLY1305_TAG_SIZE << 3),          /* ICV size in bits                       */
+    NX_CRYPTO_CHACHA20_BLOCK_SIZE,               /* Block size in bytes.                   */
+    sizeof(NX_CRYPTO_CHACHA20_POLY1305),         /* Metadata size in bytes                 */
+    _nx_crypto_method_chacha20_poly1305_init,    /* ChaCha20-Poly1305 initialization       */
+    _nx_crypto_method_chacha20_poly1305_cleanup, /* ChaCha20-Poly1305 cleanup routine      */
+    _nx_crypto_method_chacha20_poly1305_operation /* ChaCha20-Poly1305 operation           */
+};
+
 /* Declare the AES-XCBC-MAC encrytion method. */
 NX_CRYPTO_METHOD crypto_method_aes_xcbc_mac_96 =
 {
@@ -261,6 +281,20 @@ NX_CRYPTO_METHOD crypto_method_ecdsa =
     _nx_crypto_method_ecdsa_operation            /* ECDSA operation                        */
 };
 
+/* Declare the Ed25519 crypto method */
+NX_CRYPTO_METHOD crypto_method_ed25519 =
+{
+    NX_CRYPTO_DIGITAL_SIGNATURE_ED25519,         /* Ed25519 crypto algorithm               */
+    0,                                           /* Key size in bits                       */
+    0,                                           /* IV size in bits                        */
+    0,                                           /* ICV size in bits, not used             */
+    0,                                           /* Block size in bytes                    */
+    sizeof(NX_CRYPTO_ED25519),                   /* Metadata size in bytes                 */
+    _nx_crypto_method_ed25519_init,              /* Ed25519 initialization routine         */
+    _nx_crypto_method_ed25519_cleanup,           /* Ed25519 cleanup routine                */
+    _nx_crypto_method_ed25519_operation          /* Ed25519 operation                      */
+};
+
 /* Declare the ECDH crypto method */
 NX_CRYPTO_METHOD crypto_method_ecdh =
 {
@@ -513,6 +547,20 @@ NX_CRYPTO_METHOD crypto_method_ec_secp521 =
     _nx_crypto_method_ec_secp521r1_operation, /* Operation                              */
 };
 
+/* Declare a placeholder for EC X25519. */
+NX_CRYPTO_METHOD crypto_method_ec_x25519 =
+{
+    NX_CRYPTO_EC_X25519,                      /* EC placeholder                         */
+    255,                                      /* Key size in bits                       */
+    0,                                        /* IV size in bits                        */
+    0,                                        /* ICV size in bits, not used.            */
+    0,                                        /* Block size in bytes.                   */
+    0,                                        /* Metadata size in bytes                 */
+    NX_CRYPTO_NULL,                           /* Initialization routine.                */
+    NX_CRYPTO_NULL,                           /* Cleanup routine, not used.             */
+    _nx_crypto_method_ec_x25519_operation,    /* Operation                              */
+};
+
 /* Declare the public NULL cipher (not to be confused with the NULL methods above). This
  * is used as a placeholder in ciphersuites that do not use a cipher method for a
  * particular operation (e.g. some PSK ciphersuites don't use a public-key algorithm
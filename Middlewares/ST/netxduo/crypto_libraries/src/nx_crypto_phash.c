@@ -28,7 +28,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_phash                                    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -65,6 +65,9 @@
 /*                                            verified memcpy use cases,  */
 /*                                            and updated constants,      */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), set up   */
+/*                                            HMAC once for all blocks,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT _nx_crypto_phash(NX_CRYPTO_PHASH *phash, UCHAR *output, UINT desired_length)
@@ -132,25 +135,27 @@ NX_CRYPTO_METHOD *hash_method = phash -> nx_crypto_hmac_method;
     NX_CRYPTO_MEMCPY(temp_A, seed, seed_len); /* Use case of memcpy is verified. */
     A_len = phash -> nx_crypto_phash_seed_length;
 
+    /* The HMAC metadata is set up once for all blocks so that the padded
+       secret is only hashed for the first block.  */
+    if (hash_method -> nx_crypto_init)
+    {
+        status = hash_method -> nx_crypto_init(hash_method,
+                                      secret,
+                                      (NX_CRYPTO_KEY_SIZE)(secret_len << 3),
+                                      &handler,
+                                      metadata,
+                                      metadata_size);
+
+        if(status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }                                                     
+    }
+
     remaining_len = desired_length;
     for (offset = 0; offset < desired_length; offset += hash_size)
     {
         /* Calculate A(i) */
-        if (hash_method -> nx_crypto_init)
-        {
-            status = hash_method -> nx_crypto_init(hash_method,
-                                          secret,
-                                          (NX_CRYPTO_KEY_SIZE)(secret_len << 3),
-                                          &handler,
-                                          metadata,
-                                          metadata_size);
-
-            if(status != NX_CRYPTO_SUCCESS)
-            {
-                return(status);
-            }                                                     
-        }
-
         status = hash_method -> nx_crypto_operation(NX_CRYPTO_AUTHENTICATE,
                                            handler,
                                            hash_method,
@@ -222,14 +227,9 @@ NX_CRYPTO_METHOD *hash_method = phash -> nx_crypto_hmac_method;
 
         /* Adjust our remaining length by the number of bytes written. */
         remaining_len -= hash_size;
-
-        status = hash_method -> nx_crypto_cleanup(metadata);
-
-        if(status != NX_CRYPTO_SUCCESS)
-        {
-            return(status);
-        }                                                     
     }
 
-    return(NX_CRYPTO_SUCCESS);
+    status = hash_method -> nx_crypto_cleanup(metadata);
+
+    return(status);
 }
@@ -46,6 +46,29 @@ const ULONG _sha2_round_constants[64] =
 #define SMALL_SIGMA_0(x)           (RIGHT_SHIFT_CIRCULAR((x),  7) ^ RIGHT_SHIFT_CIRCULAR((x), 18) ^ ((x) >> 3))
 #define SMALL_SIGMA_1(x)           (RIGHT_SHIFT_CIRCULAR((x), 17) ^ RIGHT_SHIFT_CIRCULAR((x), 19) ^ ((x) >> 10))
 
+/* Compute word t + 16 of the message schedule in place of word t.  */
+#define NX_CRYPTO_SHA256_SCHEDULE(w, t)                                               \
+    ((w)[(t)] += SMALL_SIGMA_1((w)[((t) + 14) & 15]) + (w)[((t) + 9) & 15] +  \
+                 SMALL_SIGMA_0((w)[((t) + 1) & 15]))
+
+/* Perform round t. Instead of moving the working variables, the caller
+   rotates their names: the new A is written to h and the new E to d.  */
+#define NX_CRYPTO_SHA256_ROUND(a, b, c, d, e, f, g, h, t, wt)                                     \
+    temp1 = (h) + LARGE_SIGMA_1(e) + CH_FUNC((e), (f), (g)) + _sha2_round_constants[(t)] + (wt);  \
+    (d) += temp1;                                                                                 \
+    (h) = temp1 + LARGE_SIGMA_0(a) + MAJ_FUNC((a), (b), (c))
+
+/* Perform round t in every lane. As in the single block routine, the
+   names of the working variables rotate instead of their values.  */
+#define NX_CRYPTO_SHA256_LANE_ROUND(a, b, c, d, e, f, g, h, t)                           \
+    for (l = 0; l < NX_CRYPTO_SHA256_MULTI_BUFFER_LANES; l++)                            \
+    {                                                                                    \
+        temp1 = s[h][l] + LARGE_SIGMA_1(s[e][l]) + CH_FUNC(s[e][l], s[f][l], s[g][l]) +  \
+                _sha2_round_constants[(t)] + w[(t) & 15][l];                             \
+        s[d][l] += temp1;                                                                \
+        s[h][l] = temp1 + LARGE_SIGMA_0(s[a][l]) + MAJ_FUNC(s[a][l], s[b][l], s[c][l]);  \
+    }
+
 /* Define the padding array.  This is used to pad the message such that its length is
    64 bits shy of being a multiple of 512 bits long.  */
 const UCHAR   _nx_crypto_sha256_padding[64] = {0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
@@ -391,8 +414,7 @@ ULONG padding_bytes;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_crypto_sha256_process_buffer                    PORTABLE C      */
-/*                                                           6.1          */
-/*                                                                        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -400,7 +422,8 @@ ULONG padding_bytes;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function implements the SHA256 algorithm which works on        */
-/*    64-byte (512-bit) blocks of data.                                   */
+/*    64-byte (512-bit) blocks of data. The rounds are unrolled sixteen   */
+/*    at a time over a 16-word rolling message schedule.                  */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -427,19 +450,19 @@ ULONG padding_bytes;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            unrolled the rounds,        */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_sha256_process_buffer(NX_CRYPTO_SHA256 *context, UCHAR buffer[64])
 {
-ULONG *w;
+ULONG  w[16];
 UINT   t;
-ULONG  temp1, temp2;
+ULONG  temp1;
 ULONG  a, b, c, d, e, f, g, h;
 
 
-    /* Setup pointers to the word array.  */
-    w =  context -> nx_sha256_word_array;
-
     /* Initialize the first 16 words of the word array, taking care of the
        endian issues at the same time.  */
     for (t = 0; t < 16; t++)
@@ -448,13 +471,6 @@ ULONG  a, b, c, d, e, f, g, h;
         w[t] =  (((ULONG)buffer[t * 4]) << 24) | (((ULONG)buffer[(t * 4) + 1]) << 16) | (((ULONG)buffer[(t * 4) + 2]) << 8) | ((ULONG)buffer[(t * 4) + 3]);
     }
 
-    /* Setup the remaining entries of the word array.  */
-    for (t = 16; t < 64; t++)
-    {
-        /* Setup each entry.  */
-        w[t] =  SMALL_SIGMA_1(w[t - 2]) + w[t - 7] + SMALL_SIGMA_0(w[t - 15]) + w[t - 16];
-    }
-
     /* Initialize the state variables.  */
     a =  context -> nx_sha256_states[0];
     b =  context -> nx_sha256_states[1];
@@ -465,19 +481,39 @@ ULONG  a, b, c, d, e, f, g, h;
     g =  context -> nx_sha256_states[6];
     h =  context -> nx_sha256_states[7];
 
-    /* Now, perform Round operations.  */
-    for (t = 0; t < 64; t++)
+    /* Now, perform Round operations, sixteen at a time.  */
+    for (t = 0; t < 64; t += 16)
     {
-        temp1 = h + LARGE_SIGMA_1(e) + CH_FUNC(e, f, g) + _sha2_round_constants[t] + w[t];
-        temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC(a, b, c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + temp1;
-        d = c;
-        c = b;
-        b = a;
-        a = temp1 + temp2;
+        if (t)
+        {
+
+            /* Setup the next 16 entries of the word array in place.  */
+            NX_CRYPTO_SHA256_SCHEDULE(w, 0);  NX_CRYPTO_SHA256_SCHEDULE(w, 1);
+            NX_CRYPTO_SHA256_SCHEDULE(w, 2);  NX_CRYPTO_SHA256_SCHEDULE(w, 3);
+            NX_CRYPTO_SHA256_SCHEDULE(w, 4);  NX_CRYPTO_SHA256_SCHEDULE(w, 5);
+            NX_CRYPTO_SHA256_SCHEDULE(w, 6);  NX_CRYPTO_SHA256_SCHEDULE(w, 7);
+            NX_CRYPTO_SHA256_SCHEDULE(w, 8);  NX_CRYPTO_SHA256_SCHEDULE(w, 9);
+            NX_CRYPTO_SHA256_SCHEDULE(w, 10); NX_CRYPTO_SHA256_SCHEDULE(w, 11);
+            NX_CRYPTO_SHA256_SCHEDULE(w, 12); NX_CRYPTO_SHA256_SCHEDULE(w, 13);
+            NX_CRYPTO_SHA256_SCHEDULE(w, 14); NX_CRYPTO_SHA256_SCHEDULE(w, 15);
+        }
+
+        NX_CRYPTO_SHA256_ROUND(a, b, c, d, e, f, g, h, t + 0,  w[0]);
+        NX_CRYPTO_SHA256_ROUND(h, a, b, c, d, e, f, g, t + 1,  w[1]);
+        NX_CRYPTO_SHA256_ROUND(g, h, a, b, c, d, e, f, t + 2,  w[2]);
+        NX_CRYPTO_SHA256_ROUND(f, g, h, a, b, c, d, e, t + 3,  w[3]);
+        NX_CRYPTO_SHA256_ROUND(e, f, g, h, a, b, c, d, t + 4,  w[4]);
+        NX_CRYPTO_SHA256_ROUND(d, e, f, g, h, a, b, c, t + 5,  w[5]);
+        NX_CRYPTO_SHA256_ROUND(c, d, e, f, g, h, a, b, t + 6,  w[6]);
+        NX_CRYPTO_SHA256_ROUND(b, c, d, e, f, g, h, a, t + 7,  w[7]);
+        NX_CRYPTO_SHA256_ROUND(a, b, c, d, e, f, g, h, t + 8,  w[8]);
+        NX_CRYPTO_SHA256_ROUND(h, a, b, c, d, e, f, g, t + 9,  w[9]);
+        NX_CRYPTO_SHA256_ROUND(g, h, a, b, c, d, e, f, t + 10, w[10]);
+        NX_CRYPTO_SHA256_ROUND(f, g, h, a, b, c, d, e, t + 11, w[11]);
+        NX_CRYPTO_SHA256_ROUND(e, f, g, h, a, b, c, d, t + 12, w[12]);
+        NX_CRYPTO_SHA256_ROUND(d, e, f, g, h, a, b, c, t + 13, w[13]);
+        NX_CRYPTO_SHA256_ROUND(c, d, e, f, g, h, a, b, t + 14, w[14]);
+        NX_CRYPTO_SHA256_ROUND(b, c, d, e, f, g, h, a, t + 15, w[15]);
     }
 
     /* Save the resulting in this SHA256 context.  */
@@ -493,11 +529,448 @@ ULONG  a, b, c, d, e, f, g, h;
 #ifdef NX_SECURE_KEY_CLEAR
     a = 0; b = 0; c = 0; d = 0;
     e = 0; f = 0; g = 0; h = 0;
-    temp1 = 0; temp2 = 0;
+    temp1 = 0;
+    NX_CRYPTO_MEMSET(w, 0, sizeof(w));
 #endif /* NX_SECURE_KEY_CLEAR  */
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_sha256_process_buffers                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes one 64-byte block for each of up to         */
+/*    NX_CRYPTO_SHA256_MULTI_BUFFER_LANES independent SHA256 contexts.    */
+/*    The rounds of all lanes are computed together so that the compiler  */
+/*    can keep the lanes in vector registers. Unused lanes repeat the     */
+/*    first stream and their results are discarded.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    context                               Array of SHA256 contexts      */
+/*    buffer                                Array of 64-byte buffers      */
+/*    count                                 Number of contexts            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_sha256_process_buffer      Process complete buffer       */
+/*                                            using SHA256                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_sha256_multi_update        Update several digests        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_sha256_process_buffers(NX_CRYPTO_SHA256 **context, UCHAR **buffer, UINT count)
+{
+ULONG  w[16][NX_CRYPTO_SHA256_MULTI_BUFFER_LANES];
+ULONG  s[8][NX_CRYPTO_SHA256_MULTI_BUFFER_LANES];
+ULONG  temp1;
+UCHAR *input;
+UINT   t, l, i;
+
+
+    /* With half of the lanes or fewer in use, the single block routine is faster.  */
+    if (count <= (NX_CRYPTO_SHA256_MULTI_BUFFER_LANES >> 1))
+    {
+        for (l = 0; l < count; l++)
+        {
+            _nx_crypto_sha256_process_buffer(context[l], buffer[l]);
+        }
+
+        return;
+    }
+
+    /* Load the message words and the states of each lane.  */
+    for (l = 0; l < NX_CRYPTO_SHA256_MULTI_BUFFER_LANES; l++)
+    {
+        input = (l < count) ? buffer[l] : buffer[0];
+        for (t = 0; t < 16; t++)
+        {
+            w[t][l] =  (((ULONG)input[t * 4]) << 24) | (((ULONG)input[(t * 4) + 1]) << 16) | (((ULONG)input[(t * 4) + 2]) << 8) | ((ULONG)input[(t * 4) + 3]);
+        }
+
+        for (t = 0; t < 8; t++)
+        {
+            s[t][l] = (l < count) ? context[l] -> nx_sha256_states[t] : context[0] -> nx_sha256_states[t];
+        }
+    }
+
+    /* Now, perform Round operations, eight at a time.  */
+    for (t = 0; t < 64; t += 8)
+    {
+        if (t >= 16)
+        {
+            for (i = t; i < (t + 8); i++)
+            {
+                for (l = 0; l < NX_CRYPTO_SHA256_MULTI_BUFFER_LANES; l++)
+                {
+                    w[i & 15][l] += SMALL_SIGMA_1(w[(i - 2) & 15][l]) + w[(i - 7) & 15][l] + SMALL_SIGMA_0(w[(i - 15) & 15][l]);
+                }
+            }
+        }
+
+        NX_CRYPTO_SHA256_LANE_ROUND(0, 1, 2, 3, 4, 5, 6, 7, t + 0);
+        NX_CRYPTO_SHA256_LANE_ROUND(7, 0, 1, 2, 3, 4, 5, 6, t + 1);
+        NX_CRYPTO_SHA256_LANE_ROUND(6, 7, 0, 1, 2, 3, 4, 5, t + 2);
+        NX_CRYPTO_SHA256_LANE_ROUND(5, 6, 7, 0, 1, 2, 3, 4, t + 3);
+        NX_CRYPTO_SHA256_LANE_ROUND(4, 5, 6, 7, 0, 1, 2, 3, t + 4);
+        NX_CRYPTO_SHA256_LANE_ROUND(3, 4, 5, 6, 7, 0, 1, 2, t + 5);
+        NX_CRYPTO_SHA256_LANE_ROUND(2, 3, 4, 5, 6, 7, 0, 1, t + 6);
+        NX_CRYPTO_SHA256_LANE_ROUND(1, 2, 3, 4, 5, 6, 7, 0, t + 7);
+    }
+
+    /* Save the results in the contexts of the used lanes.  */
+    for (l = 0; l < count; l++)
+    {
+        for (t = 0; t < 8; t++)
+        {
+            context[l] -> nx_sha256_states[t] += s[t][l];
+        }
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(w, 0, sizeof(w));
+    NX_CRYPTO_MEMSET(s, 0, sizeof(s));
+    temp1 = 0;
+#endif /* NX_SECURE_KEY_CLEAR  */
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_sha256_multi_update                      PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function updates several independent SHA256 digests in         */
+/*    parallel. Each context is updated with input_length bytes from its  */
+/*    own input pointer. Contexts that have absorbed the same number of   */
+/*    bytes are processed together; otherwise each context is updated     */
+/*    separately.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    context                               Array of SHA256 contexts      */
+/*    input_ptr                             Array of input pointers       */
+/*    input_length                          Number of bytes per input     */
+/*    count                                 Number of contexts            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_sha256_process_buffers     Process blocks of several     */
+/*                                            contexts                    */
+/*    _nx_crypto_sha256_update              Update the digest with input  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_crypto_sha256_multi_digest_calculate                            */
+/*                                          Calculate several digests     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_sha256_multi_update(NX_CRYPTO_SHA256 **context, UCHAR **input_ptr, UINT input_length, UINT count)
+{
+NX_CRYPTO_SHA256 *lane_context[NX_CRYPTO_SHA256_MULTI_BUFFER_LANES];
+UCHAR            *lane_buffer[NX_CRYPTO_SHA256_MULTI_BUFFER_LANES];
+ULONG             current_bytes;
+ULONG             needed_fill_bytes;
+UINT              offset;
+UINT              i, j, n;
+
+    /* Determine if the contexts are non-null.  */
+    if ((context == NX_CRYPTO_NULL) || (input_ptr == NX_CRYPTO_NULL))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (context[i] == NX_CRYPTO_NULL)
+        {
+            return(NX_CRYPTO_PTR_ERROR);
+        }
+    }
+
+    /* Determine if there is a length.  */
+    if ((input_length == 0) || (count == 0))
+    {
+        return(NX_CRYPTO_SUCCESS);
+    }
+
+    /* The lanes share the block boundaries, so all contexts must be at the same position.  */
+    for (i = 1; i < count; i++)
+    {
+        if ((context[i] -> nx_sha256_bit_count[0] != context[0] -> nx_sha256_bit_count[0]) ||
+            (context[i] -> nx_sha256_bit_count[1] != context[0] -> nx_sha256_bit_count[1]))
+        {
+
+            /* Update each digest separately.  */
+            for (i = 0; i < count; i++)
+            {
+                _nx_crypto_sha256_update(context[i], input_ptr[i], input_length);
+            }
+
+            return(NX_CRYPTO_SUCCESS);
+        }
+    }
+
+    for (i = 0; i < count; i += n)
+    {
+
+        /* Take the next group of contexts.  */
+        n = count - i;
+        if (n > NX_CRYPTO_SHA256_MULTI_BUFFER_LANES)
+        {
+            n = NX_CRYPTO_SHA256_MULTI_BUFFER_LANES;
+        }
+
+        /* Calculate the current byte count mod 64 and the number of bytes
+           needed to fill the buffer.  */
+        current_bytes =  (context[i] -> nx_sha256_bit_count[0] >> 3) & 0x3F;
+        needed_fill_bytes =  64 - current_bytes;
+
+        /* Update the total bit count of each context.  */
+        for (j = 0; j < n; j++)
+        {
+            lane_context[j] = context[i + j];
+            lane_context[j] -> nx_sha256_bit_count[0] += (input_length << 3);
+            if (lane_context[j] -> nx_sha256_bit_count[0] < (input_length << 3))
+            {
+                lane_context[j] -> nx_sha256_bit_count[1]++;
+            }
+            lane_context[j] -> nx_sha256_bit_count[1] +=  (input_length >> 29);
+        }
+
+        offset = 0;
+
+        /* Check for partial buffers that need to be transformed.  */
+        if ((current_bytes) && (input_length >= needed_fill_bytes))
+        {
+            for (j = 0; j < n; j++)
+            {
+                NX_CRYPTO_MEMCPY((void *)&(lane_context[j] -> nx_sha256_buffer[current_bytes]), (void *)input_ptr[i + j], needed_fill_bytes); /* Use case of memcpy is verified. */
+                lane_buffer[j] = lane_context[j] -> nx_sha256_buffer;
+            }
+
+            _nx_crypto_sha256_process_buffers(lane_context, lane_buffer, n);
+
+            offset = needed_fill_bytes;
+            current_bytes =  0;
+        }
+
+        /* Process any and all whole blocks of input.  */
+        while ((input_length - offset) >= 64)
+        {
+            for (j = 0; j < n; j++)
+            {
+                lane_buffer[j] = input_ptr[i + j] + offset;
+            }
+
+            _nx_crypto_sha256_process_buffers(lane_context, lane_buffer, n);
+
+            offset += 64;
+        }
+
+        /* Save the remaining bytes in the internal buffers.  */
+        if (input_length > offset)
+        {
+            for (j = 0; j < n; j++)
+            {
+                NX_CRYPTO_MEMCPY((void *)&(lane_context[j] -> nx_sha256_buffer[current_bytes]), (void *)(input_ptr[i + j] + offset), input_length - offset); /* Use case of memcpy is verified. */
+            }
+        }
+    }
+
+    /* Return success.  */
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_sha256_multi_digest_calculate            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finishes several SHA256 digests in parallel and       */
+/*    stores each one at the corresponding digest pointer.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    context                               Array of SHA256 contexts      */
+/*    digest                                Array of digest pointers      */
+/*    count                                 Number of contexts            */
+/*    algorithm                             SHA-224 or SHA-256            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_sha256_multi_update        Update several digests        */
+/*    _nx_crypto_sha256_digest_calculate    Calculate the digest          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_sha256_multi_digest_calculate(NX_CRYPTO_SHA256 **context, UCHAR **digest, UINT count, UINT algorithm)
+{
+UCHAR  bit_count_string[8];
+UCHAR *padding_ptr[NX_CRYPTO_SHA256_MULTI_BUFFER_LANES];
+UCHAR *bit_count_ptr[NX_CRYPTO_SHA256_MULTI_BUFFER_LANES];
+ULONG  current_byte_count;
+ULONG  padding_bytes;
+UINT   words;
+UINT   i, j, n;
+
+    /* Determine if the contexts are non-null.  */
+    if ((context == NX_CRYPTO_NULL) || (digest == NX_CRYPTO_NULL))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (context[i] == NX_CRYPTO_NULL)
+        {
+            return(NX_CRYPTO_PTR_ERROR);
+        }
+    }
+
+    if (count == 0)
+    {
+        return(NX_CRYPTO_SUCCESS);
+    }
+
+    /* The padding is shared, so all contexts must be at the same position.  */
+    for (i = 1; i < count; i++)
+    {
+        if ((context[i] -> nx_sha256_bit_count[0] != context[0] -> nx_sha256_bit_count[0]) ||
+            (context[i] -> nx_sha256_bit_count[1] != context[0] -> nx_sha256_bit_count[1]))
+        {
+
+            /* Calculate each digest separately.  */
+            for (i = 0; i < count; i++)
+            {
+                _nx_crypto_sha256_digest_calculate(context[i], digest[i], algorithm);
+            }
+
+            return(NX_CRYPTO_SUCCESS);
+        }
+    }
+
+    /* Move the bit count into the array.  */
+    for (i = 0; i < 4; i++)
+    {
+        bit_count_string[i] =  (UCHAR)(context[0] -> nx_sha256_bit_count[1] >> (24 - (i << 3)));
+        bit_count_string[i + 4] =  (UCHAR)(context[0] -> nx_sha256_bit_count[0] >> (24 - (i << 3)));
+    }
+
+    /* Calculate the padding bytes needed.  */
+    current_byte_count =  (context[0] -> nx_sha256_bit_count[0] >> 3) & 0x3F;
+    padding_bytes =  (current_byte_count < 56) ? (56 - current_byte_count) : (120 - current_byte_count);
+
+    for (i = 0; i < NX_CRYPTO_SHA256_MULTI_BUFFER_LANES; i++)
+    {
+        padding_ptr[i] = (UCHAR *)_nx_crypto_sha256_padding;
+        bit_count_ptr[i] = bit_count_string;
+    }
+
+    /* SHA-224 digests are one word shorter.  */
+    if ((algorithm == NX_CRYPTO_AUTHENTICATION_HMAC_SHA2_256) ||
+        (algorithm == NX_CRYPTO_HASH_SHA256))
+    {
+        words = 8;
+    }
+    else
+    {
+        words = 7;
+    }
+
+    for (i = 0; i < count; i += n)
+    {
+        n = count - i;
+        if (n > NX_CRYPTO_SHA256_MULTI_BUFFER_LANES)
+        {
+            n = NX_CRYPTO_SHA256_MULTI_BUFFER_LANES;
+        }
+
+        /* Add the padding and the length.  */
+        _nx_crypto_sha256_multi_update(&context[i], padding_ptr, padding_bytes, n);
+        _nx_crypto_sha256_multi_update(&context[i], bit_count_ptr, 8, n);
+    }
+
+    /* Now store the digests in the caller specified destinations.  */
+    for (i = 0; i < count; i++)
+    {
+        for (j = 0; j < words; j++)
+        {
+            digest[i][j * 4] =  (UCHAR)(context[i] -> nx_sha256_states[j] >> 24);
+            digest[i][(j * 4) + 1] =  (UCHAR)(context[i] -> nx_sha256_states[j] >> 16);
+            digest[i][(j * 4) + 2] =  (UCHAR)(context[i] -> nx_sha256_states[j] >> 8);
+            digest[i][(j * 4) + 3] =  (UCHAR)(context[i] -> nx_sha256_states[j]);
+        }
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(bit_count_string, 0, sizeof(bit_count_string));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    /* Return successful completion.  */
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
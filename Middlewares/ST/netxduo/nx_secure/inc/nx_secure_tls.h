@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    nx_secure_tls.h                                     PORTABLE C      */
-/*                                                           6.1.7        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -70,6 +70,13 @@
 /*  06-02-2021     Yuxin Zhou               Modified comment(s), and      */
 /*                                            updated product constants,  */
 /*                                            resulting in version 6.1.7  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            ChaCha20-Poly1305           */
+/*                                            ciphersuites and            */
+/*                                            application data record     */
+/*                                            coalescing and TLS 1.3      */
+/*                                            session tickets,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -266,6 +273,7 @@ extern   "C" {
 #define NX_SECURE_TLS_RECORD_OVERFLOW                   0x151       /* Received a TLSCiphertext record that had a length too long. */
 #define NX_SECURE_TLS_HANDSHAKE_FRAGMENT_RECEIVED       0x152       /* Received a fragmented handshake message - take appropriate action at a higher level of the state machine. */
 #define NX_SECURE_TLS_TRANSMIT_LOCKED                   0x153       /* Another thread is transmitting. */
+#define NX_SECURE_TLS_BAD_SERVERHELLO_PSK_EXTENSION     0x154       /* In a TLS 1.3 PSK extension from a remote server, the server selected a PSK its ciphersuite cannot use. */
 
 /* NX_CONTINUE is a symbol defined in NetX Duo 5.10.  For backward compatibility, this symbol is defined here */
 #if ((__NETXDUO_MAJOR_VERSION__ == 5) && (__NETXDUO_MINOR_VERSION__ == 9))
@@ -508,9 +516,12 @@ typedef struct NX_SECURE_VERSIONS_LIST_STRUCT
 #define TLS_ECDHE_RSA_WITH_AES_256_GCM_SHA384              0xC030
 #define TLS_ECDH_RSA_WITH_AES_128_GCM_SHA256               0xC031
 #define TLS_ECDH_RSA_WITH_AES_256_GCM_SHA384               0xC032
+#define TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256        0xCCA8
+#define TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256      0xCCA9
 
 #define TLS_AES_128_GCM_SHA256                             0x1301
 #define TLS_AES_256_GCM_SHA384                             0x1302
+#define TLS_CHACHA20_POLY1305_SHA256                       0x1303
 #define TLS_AES_128_CCM_SHA256                             0x1304
 #define TLS_AES_128_CCM_8_SHA256                           0x1305
 
@@ -749,10 +760,98 @@ typedef struct NX_SECURE_TLS_PSK_STORE_STRUCT
      */
     const struct NX_SECURE_TLS_CIPHERSUITE_INFO_STRUCT *nx_secure_tls_psk_binder_ciphersuite;
 
+    /* Set if the PSK was derived from a session ticket ("res binder" label)
+       rather than provisioned by the application ("ext binder" label). */
+    UINT  nx_secure_tls_psk_resumption;
+
 #endif
 } NX_SECURE_TLS_PSK_STORE;
 #endif /* defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES) || defined(NX_SECURE_ENABLE_ECJPAKE_CIPHERSUITE) */
 
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+
+/* Largest session ticket kept by a TLS 1.3 client. Tickets issued by a NetX Secure
+   server are NX_SECURE_TLS_TICKET_OVERHEAD bytes plus the resumption PSK. */
+#ifndef NX_SECURE_TLS_MAX_TICKET_SIZE
+#define NX_SECURE_TLS_MAX_TICKET_SIZE                      (160)
+#endif /* NX_SECURE_TLS_MAX_TICKET_SIZE */
+
+/* Largest server identity (e.g. host name) used to look up cached tickets. */
+#ifndef NX_SECURE_TLS_MAX_TICKET_SERVER_ID_SIZE
+#define NX_SECURE_TLS_MAX_TICKET_SERVER_ID_SIZE            (64)
+#endif /* NX_SECURE_TLS_MAX_TICKET_SERVER_ID_SIZE */
+
+/* Size of the secret used by a TLS 1.3 server to protect the tickets it issues. */
+#define NX_SECURE_TLS_TICKET_KEY_SIZE                      (32)
+
+/* Layout of server-issued tickets: key name, IV, encrypted state and HMAC-SHA256 tag.
+   The encrypted state holds the ciphersuite, issue time, lifetime, age_add and PSK. */
+#define NX_SECURE_TLS_TICKET_KEY_NAME_SIZE                 (4)
+#define NX_SECURE_TLS_TICKET_IV_SIZE                       (16)
+#define NX_SECURE_TLS_TICKET_STATE_SIZE                    (15)
+#define NX_SECURE_TLS_TICKET_TAG_SIZE                      (32)
+#define NX_SECURE_TLS_TICKET_OVERHEAD                      (NX_SECURE_TLS_TICKET_KEY_NAME_SIZE + NX_SECURE_TLS_TICKET_IV_SIZE + \
+                                                            NX_SECURE_TLS_TICKET_STATE_SIZE + NX_SECURE_TLS_TICKET_TAG_SIZE)
+
+/* A session ticket received from a TLS 1.3 server. The client offers it as a
+   resumption PSK on later connections to the same server, which then skip the
+   server certificate and CertificateVerify. */
+typedef struct NX_SECURE_TLS_TICKET_STRUCT
+{
+    /* Identity of the server that issued the ticket. Zero size marks a free entry. */
+    UCHAR  nx_secure_tls_ticket_server_id[NX_SECURE_TLS_MAX_TICKET_SERVER_ID_SIZE];
+    UINT   nx_secure_tls_ticket_server_id_size;
+
+    /* Opaque ticket sent back to the server as the PSK identity. */
+    UCHAR  nx_secure_tls_ticket_data[NX_SECURE_TLS_MAX_TICKET_SIZE];
+    UINT   nx_secure_tls_ticket_size;
+
+    /* Resumption PSK derived from the ticket nonce. */
+    UCHAR  nx_secure_tls_ticket_psk[NX_SECURE_TLS_MAX_PSK_SIZE];
+    UINT   nx_secure_tls_ticket_psk_size;
+
+    /* Ciphersuite of the connection that issued the ticket - its hash is used for the binder. */
+    USHORT nx_secure_tls_ticket_ciphersuite;
+
+    /* Lifetime (seconds), ticket age obfuscation value and time the ticket was received (ticks). */
+    ULONG  nx_secure_tls_ticket_lifetime;
+    ULONG  nx_secure_tls_ticket_age_add;
+    ULONG  nx_secure_tls_ticket_received;
+} NX_SECURE_TLS_TICKET;
+
+/* Client ticket store, shared by all sessions connecting to the servers it holds tickets for. */
+typedef struct NX_SECURE_TLS_TICKET_CACHE_STRUCT
+{
+    NX_SECURE_TLS_TICKET *nx_secure_tls_ticket_cache_entries;
+    UINT                  nx_secure_tls_ticket_cache_count;
+
+    /* Entry replaced when a ticket arrives from a server that has no entry yet. */
+    UINT                  nx_secure_tls_ticket_cache_next;
+} NX_SECURE_TLS_TICKET_CACHE;
+
+/* A secret protecting server-issued tickets, identified in each ticket by its name. */
+typedef struct NX_SECURE_TLS_TICKET_KEY_STRUCT
+{
+    ULONG nx_secure_tls_ticket_key_name;
+    UCHAR nx_secure_tls_ticket_key_data[NX_SECURE_TLS_TICKET_KEY_SIZE];
+    UINT  nx_secure_tls_ticket_key_size;
+} NX_SECURE_TLS_TICKET_KEY;
+
+/* Server ticket keys, shared by all sessions issuing and accepting tickets. New tickets
+   are protected with the current key; tickets protected with the previous key are
+   still accepted until the next rotation. Tickets hold all resumption state, so the
+   server keeps nothing per client. */
+typedef struct NX_SECURE_TLS_TICKET_KEYS_STRUCT
+{
+    NX_SECURE_TLS_TICKET_KEY nx_secure_tls_ticket_key_current;
+    NX_SECURE_TLS_TICKET_KEY nx_secure_tls_ticket_key_previous;
+
+    /* Lifetime of issued tickets, in seconds. */
+    ULONG                    nx_secure_tls_ticket_lifetime;
+} NX_SECURE_TLS_TICKET_KEYS;
+
+#endif /* (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES) */
+
 
 /* TLS Ciphersuite lookup table. Contains all pertinent information for ciphersuites used in TLS operations.
  * The lookup is based on the first field, which will contain the defined TLS value for the ciphersuite. */
@@ -1087,6 +1186,13 @@ typedef struct NX_SECURE_TLS_SESSION_STRUCT
     NX_PACKET *nx_secure_record_queue_header;
     NX_PACKET *nx_secure_record_decrypted_packet;
 
+    /* Application data held back to be sent in a single record, and the
+       number of bytes that triggers sending it (0 disables coalescing).
+       Held data is not sent on a timer; call nx_secure_tls_session_flush
+       once a message is complete. */
+    NX_PACKET *nx_secure_tls_coalesce_packet;
+    ULONG      nx_secure_tls_coalesce_threshold;
+
     /* Packet pool used by TLS stack to allocate outgoing packets used in TLS handshake. */
     NX_PACKET_POOL *nx_secure_tls_packet_pool;
 
@@ -1307,6 +1413,21 @@ typedef struct NX_SECURE_TLS_SESSION_STRUCT
     UINT   nx_secure_tls_cookie_length;
 
     UINT nx_secure_tls_signature_algorithm;
+
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+    /* TLS Client: ticket cache, identity of the server being connected to and
+       the cached ticket offered in the ClientHello (if any). */
+    NX_SECURE_TLS_TICKET_CACHE *nx_secure_tls_ticket_cache;
+    UCHAR                      *nx_secure_tls_ticket_server_id;
+    UINT                        nx_secure_tls_ticket_server_id_size;
+    NX_SECURE_TLS_TICKET       *nx_secure_tls_ticket_offered;
+
+    /* TLS Server: keys protecting the session tickets issued and accepted. */
+    NX_SECURE_TLS_TICKET_KEYS  *nx_secure_tls_ticket_keys;
+
+    /* Index of the PSK chosen from the identities in the ClientHello. */
+    UINT                        nx_secure_tls_psk_selected_identity;
+#endif /* NX_SECURE_ENABLE_PSK_CIPHERSUITES */
 #endif
 } NX_SECURE_TLS_SESSION;
 
@@ -1354,7 +1475,8 @@ UINT _nx_secure_tls_1_3_server_handshake(NX_SECURE_TLS_SESSION *tls_session, UCH
                                          UINT data_length, ULONG wait_option);    
 UINT _nx_secure_tls_1_3_generate_handshake_keys(NX_SECURE_TLS_SESSION *tls_session);
 UINT _nx_secure_tls_1_3_generate_session_keys(NX_SECURE_TLS_SESSION *tls_session);
-UINT _nx_secure_tls_1_3_session_psk_generate(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_PSK_STORE *ticket_psk, UCHAR *nonce, UINT nonce_len);
+UINT _nx_secure_tls_1_3_session_psk_generate(NX_SECURE_TLS_SESSION *tls_session, UCHAR *nonce, UINT nonce_len,
+                                             UCHAR *psk, UINT psk_size, UINT *psk_length);
 UINT _nx_secure_tls_psk_binder_generate(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_PSK_STORE *psk_entry);
 UINT _nx_secure_tls_1_3_session_keys_set(NX_SECURE_TLS_SESSION *tls_session, USHORT key_set);
 UINT _nx_secure_tls_1_3_transcript_hash_save(NX_SECURE_TLS_SESSION *tls_session, UINT hash_index, UINT need_copy);
@@ -1561,6 +1683,7 @@ UINT _nx_secure_tls_session_client_verify_disable(NX_SECURE_TLS_SESSION *tls_ses
 UINT _nx_secure_tls_session_client_verify_enable(NX_SECURE_TLS_SESSION *tls_session);
 UINT _nx_secure_tls_session_x509_client_verify_configure(NX_SECURE_TLS_SESSION *tls_session, UINT certs_number,
                                                            VOID *certificate_buffer, ULONG buffer_size);
+UINT _nx_secure_tls_session_coalesce_set(NX_SECURE_TLS_SESSION *tls_session, ULONG threshold);
 UINT _nx_secure_tls_session_create(NX_SECURE_TLS_SESSION *session_ptr,
                                    const NX_SECURE_TLS_CRYPTO *cipher_table,
                                    VOID *metadata_area,
@@ -1574,6 +1697,7 @@ UINT _nx_secure_tls_session_create_ext(NX_SECURE_TLS_SESSION *tls_session,
 
 UINT _nx_secure_tls_session_delete(NX_SECURE_TLS_SESSION *tls_session);
 UINT _nx_secure_tls_session_end(NX_SECURE_TLS_SESSION *tls_session, UINT wait_option);
+UINT _nx_secure_tls_session_flush(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option);
 UINT _nx_secure_tls_session_packet_buffer_set(NX_SECURE_TLS_SESSION *session_ptr,
                                               UCHAR *buffer_ptr, ULONG buffer_size);
 UINT _nx_secure_tls_session_protocol_version_override(NX_SECURE_TLS_SESSION *tls_session,
@@ -1617,7 +1741,21 @@ UINT _nx_secure_tls_client_psk_set(NX_SECURE_TLS_SESSION *tls_session, UCHAR *pr
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
 UINT _nx_secure_tls_psk_identity_find(NX_SECURE_TLS_SESSION *tls_session, UCHAR **psk_data, UINT *psk_length,
                                       UCHAR *psk_identity, UINT identity_length, UINT *psk_store_index);
+UINT _nx_secure_tls_session_ticket_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_CACHE *ticket_cache,
+                                             UCHAR *server_id, UINT server_id_length);
+UINT _nx_secure_tls_session_ticket_keys_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_KEYS *ticket_keys);
+UINT _nx_secure_tls_ticket_cache_create(NX_SECURE_TLS_TICKET_CACHE *ticket_cache, VOID *memory_ptr, ULONG memory_size);
+UINT _nx_secure_tls_ticket_cache_find(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET **ticket);
+UINT _nx_secure_tls_ticket_decrypt(NX_SECURE_TLS_SESSION *tls_session, const UCHAR *ticket, UINT ticket_length,
+                                   UCHAR *state, UINT state_size, UINT *state_length);
+UINT _nx_secure_tls_ticket_encrypt(NX_SECURE_TLS_SESSION *tls_session, UCHAR *state, UINT state_length,
+                                   UCHAR *ticket, UINT ticket_size, UINT *ticket_length);
+UINT _nx_secure_tls_ticket_key_rotate(NX_SECURE_TLS_TICKET_KEYS *ticket_keys, UCHAR *key, UINT key_length);
+UINT _nx_secure_tls_ticket_keys_create(NX_SECURE_TLS_TICKET_KEYS *ticket_keys, ULONG lifetime);
 #endif
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nx_secure_tls_session_x509_verify_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_X509_VERIFY_CACHE *verify_cache);
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 #ifdef NX_SECURE_ENABLE_ECC_CIPHERSUITE
 UINT _nx_secure_tls_ecc_initialize(NX_SECURE_TLS_SESSION *tls_session,
                                    const USHORT *supported_groups, USHORT supported_group_count,
@@ -1660,12 +1798,14 @@ UINT _nxe_secure_tls_session_client_verify_disable(NX_SECURE_TLS_SESSION *tls_se
 UINT _nxe_secure_tls_session_client_verify_enable(NX_SECURE_TLS_SESSION *tls_session);
 UINT _nxe_secure_tls_session_x509_client_verify_configure(NX_SECURE_TLS_SESSION *tls_session, UINT certs_number,
                                                            VOID *certificate_buffer, ULONG buffer_size);
+UINT _nxe_secure_tls_session_coalesce_set(NX_SECURE_TLS_SESSION *tls_session, ULONG threshold);
 UINT _nxe_secure_tls_session_create(NX_SECURE_TLS_SESSION *session_ptr,
                                     const NX_SECURE_TLS_CRYPTO *cipher_table,
                                     VOID *metadata_area,
                                     ULONG metadata_size);
 UINT _nxe_secure_tls_session_delete(NX_SECURE_TLS_SESSION *tls_session);
 UINT _nxe_secure_tls_session_end(NX_SECURE_TLS_SESSION *tls_session, UINT wait_option);
+UINT _nxe_secure_tls_session_flush(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option);
 UINT _nxe_secure_tls_session_packet_buffer_set(NX_SECURE_TLS_SESSION *session_ptr,
                                                UCHAR *buffer_ptr, ULONG buffer_size);
 UINT _nxe_secure_tls_session_protocol_version_override(NX_SECURE_TLS_SESSION *tls_session,
@@ -1706,6 +1846,17 @@ UINT _nxe_secure_tls_psk_find(NX_SECURE_TLS_SESSION *tls_session, UCHAR **psk_da
 UINT _nxe_secure_tls_client_psk_set(NX_SECURE_TLS_SESSION *tls_session, UCHAR *pre_shared_key, UINT psk_length,
                                     UCHAR *psk_identity, UINT identity_length, UCHAR *hint, UINT hint_length);
 #endif
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT _nxe_secure_tls_session_ticket_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_CACHE *ticket_cache,
+                                              UCHAR *server_id, UINT server_id_length);
+UINT _nxe_secure_tls_session_ticket_keys_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_KEYS *ticket_keys);
+UINT _nxe_secure_tls_ticket_cache_create(NX_SECURE_TLS_TICKET_CACHE *ticket_cache, VOID *memory_ptr, ULONG memory_size);
+UINT _nxe_secure_tls_ticket_key_rotate(NX_SECURE_TLS_TICKET_KEYS *ticket_keys, UCHAR *key, UINT key_length);
+UINT _nxe_secure_tls_ticket_keys_create(NX_SECURE_TLS_TICKET_KEYS *ticket_keys, ULONG lifetime);
+#endif
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nxe_secure_tls_session_x509_verify_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_X509_VERIFY_CACHE *verify_cache);
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 
 /* TLS component data declarations follow.  */
 
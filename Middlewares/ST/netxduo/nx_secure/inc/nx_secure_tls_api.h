@@ -26,7 +26,7 @@
 /*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
 /*                                                                        */
 /*    nx_secure_tls_api.h                                 PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -44,6 +44,10 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            record coalescing and       */
+/*                                            session ticket services,    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -90,9 +94,11 @@ extern   "C" {
 #define nx_secure_tls_session_client_verify_disable        _nx_secure_tls_session_client_verify_disable
 #define nx_secure_tls_session_client_verify_enable         _nx_secure_tls_session_client_verify_enable
 #define nx_secure_tls_session_x509_client_verify_configure _nx_secure_tls_session_x509_client_verify_configure
+#define nx_secure_tls_session_coalesce_set                 _nx_secure_tls_session_coalesce_set
 #define nx_secure_tls_session_create                       _nx_secure_tls_session_create
 #define nx_secure_tls_session_delete                       _nx_secure_tls_session_delete
 #define nx_secure_tls_session_end                          _nx_secure_tls_session_end
+#define nx_secure_tls_session_flush                        _nx_secure_tls_session_flush
 #define nx_secure_tls_session_packet_buffer_set            _nx_secure_tls_session_packet_buffer_set
 #define nx_secure_tls_session_protocol_version_override    _nx_secure_tls_session_protocol_version_override
 #define nx_secure_tls_session_receive                      _nx_secure_tls_session_receive
@@ -112,6 +118,16 @@ extern   "C" {
 #define nx_secure_tls_client_psk_set                       _nx_secure_tls_client_psk_set
 #define nx_secure_tls_psk_add                              _nx_secure_tls_psk_add
 #endif /* defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES) || defined(NX_SECURE_ENABLE_ECJPAKE_CIPHERSUITE) */
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+#define nx_secure_tls_session_ticket_cache_set             _nx_secure_tls_session_ticket_cache_set
+#define nx_secure_tls_session_ticket_keys_set              _nx_secure_tls_session_ticket_keys_set
+#define nx_secure_tls_ticket_cache_create                  _nx_secure_tls_ticket_cache_create
+#define nx_secure_tls_ticket_key_rotate                    _nx_secure_tls_ticket_key_rotate
+#define nx_secure_tls_ticket_keys_create                   _nx_secure_tls_ticket_keys_create
+#endif /* (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES) */
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+#define nx_secure_tls_session_x509_verify_cache_set        _nx_secure_tls_session_x509_verify_cache_set
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 #else /* !NX_SEURE_DISABLE_ERROR_CHECKING */
 #define nx_secure_tls_active_certificate_set               _nxe_secure_tls_active_certificate_set
 #define nx_secure_tls_initialize                           _nx_secure_tls_initialize
@@ -132,9 +148,11 @@ extern   "C" {
 #define nx_secure_tls_session_client_verify_disable        _nxe_secure_tls_session_client_verify_disable
 #define nx_secure_tls_session_client_verify_enable         _nxe_secure_tls_session_client_verify_enable
 #define nx_secure_tls_session_x509_client_verify_configure _nxe_secure_tls_session_x509_client_verify_configure
+#define nx_secure_tls_session_coalesce_set                 _nxe_secure_tls_session_coalesce_set
 #define nx_secure_tls_session_create                       _nxe_secure_tls_session_create
 #define nx_secure_tls_session_delete                       _nxe_secure_tls_session_delete
 #define nx_secure_tls_session_end                          _nxe_secure_tls_session_end
+#define nx_secure_tls_session_flush                        _nxe_secure_tls_session_flush
 #define nx_secure_tls_session_packet_buffer_set            _nxe_secure_tls_session_packet_buffer_set
 #define nx_secure_tls_session_protocol_version_override    _nxe_secure_tls_session_protocol_version_override
 #define nx_secure_tls_session_receive                      _nxe_secure_tls_session_receive
@@ -154,6 +172,16 @@ extern   "C" {
 #define nx_secure_tls_client_psk_set                       _nxe_secure_tls_client_psk_set
 #define nx_secure_tls_psk_add                              _nxe_secure_tls_psk_add
 #endif /* defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES) || defined(NX_SECURE_ENABLE_ECJPAKE_CIPHERSUITE) */
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+#define nx_secure_tls_session_ticket_cache_set             _nxe_secure_tls_session_ticket_cache_set
+#define nx_secure_tls_session_ticket_keys_set              _nxe_secure_tls_session_ticket_keys_set
+#define nx_secure_tls_ticket_cache_create                  _nxe_secure_tls_ticket_cache_create
+#define nx_secure_tls_ticket_key_rotate                    _nxe_secure_tls_ticket_key_rotate
+#define nx_secure_tls_ticket_keys_create                   _nxe_secure_tls_ticket_keys_create
+#endif /* (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES) */
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+#define nx_secure_tls_session_x509_verify_cache_set        _nxe_secure_tls_session_x509_verify_cache_set
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 #endif /* NX_SECURE_DISABLE_ERROR_CHECKING */
 #define nx_secure_crypto_table_self_test                   _nx_secure_crypto_table_self_test
 #define nx_secure_crypto_rng_self_test                     _nx_secure_crypto_rng_self_test
@@ -210,12 +238,14 @@ UINT nx_secure_tls_session_client_verify_enable(NX_SECURE_TLS_SESSION *tls_sessi
 UINT nx_secure_tls_session_x509_client_verify_configure(NX_SECURE_TLS_SESSION *tls_session, UINT certs_number,
                                                           VOID *certificate_buffer, ULONG buffer_size);
 
+UINT nx_secure_tls_session_coalesce_set(NX_SECURE_TLS_SESSION *tls_session, ULONG threshold);
 UINT nx_secure_tls_session_create(NX_SECURE_TLS_SESSION *session_ptr,
                                   const NX_SECURE_TLS_CRYPTO *cipher_table,
                                   VOID *metadata_area,
                                   ULONG metadata_size);
 UINT nx_secure_tls_session_delete(NX_SECURE_TLS_SESSION *tls_session);
 UINT nx_secure_tls_session_end(NX_SECURE_TLS_SESSION *tls_session, UINT wait_option);
+UINT nx_secure_tls_session_flush(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option);
 UINT nx_secure_tls_session_packet_buffer_set(NX_SECURE_TLS_SESSION *session_ptr,
                                              UCHAR *buffer_ptr, ULONG buffer_size);
 UINT nx_secure_tls_session_protocol_version_override(NX_SECURE_TLS_SESSION *tls_session,
@@ -254,6 +284,17 @@ UINT nx_secure_tls_psk_add(NX_SECURE_TLS_SESSION *tls_session, UCHAR *pre_shared
 UINT nx_secure_tls_client_psk_set(NX_SECURE_TLS_SESSION *tls_session, UCHAR *pre_shared_key, UINT psk_length,
                                   UCHAR *psk_identity, UINT identity_length, UCHAR *hint, UINT hint_length);
 #endif
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT nx_secure_tls_session_ticket_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_CACHE *ticket_cache,
+                                            UCHAR *server_id, UINT server_id_length);
+UINT nx_secure_tls_session_ticket_keys_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_KEYS *ticket_keys);
+UINT nx_secure_tls_ticket_cache_create(NX_SECURE_TLS_TICKET_CACHE *ticket_cache, VOID *memory_ptr, ULONG memory_size);
+UINT nx_secure_tls_ticket_key_rotate(NX_SECURE_TLS_TICKET_KEYS *ticket_keys, UCHAR *key, UINT key_length);
+UINT nx_secure_tls_ticket_keys_create(NX_SECURE_TLS_TICKET_KEYS *ticket_keys, ULONG lifetime);
+#endif
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT nx_secure_tls_session_x509_verify_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_X509_VERIFY_CACHE *verify_cache);
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 #ifdef NX_SECURE_ENABLE_ECC_CIPHERSUITE
 UINT nx_secure_tls_ecc_initialize(NX_SECURE_TLS_SESSION *tls_session,
                                   const USHORT *supported_groups, USHORT supported_group_count,
@@ -293,6 +293,12 @@
    #define NX_SECURE_X509_DISABLE_CRL
 */
 
+/* NX_SECURE_X509_DISABLE_VERIFY_CACHE removes the optional cache of verified X509 certificate
+   signatures. By default the cache is available and used when one is attached to a certificate store. */
+/*
+   #define NX_SECURE_X509_DISABLE_VERIFY_CACHE
+*/
+
 /* NX_SECURE_X509_STRICT_NAME_COMPARE enables strict X509 comparisons for all fields.
    By default this feature is not enabled. */
 /*
@@ -26,7 +26,7 @@
 /*  COMPONENT DEFINITION                                   RELEASE        */
 /*                                                                        */
 /*    nx_secure_x509.h                                    PORTABLE C      */
-/*                                                           6.1.7        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -51,6 +51,9 @@
 /*                                            supported hardware EC       */
 /*                                            private key,                */
 /*                                            resulting in version 6.1.7  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            verified signature cache,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -871,6 +874,49 @@ typedef struct NX_SECURE_X509_CRL_STRUCT
 #define NX_SECURE_X509_CERT_LOCATION_EXCEPTIONS 4 /* Certificate is added as an exception (trusted temporarily). */
 #define NX_SECURE_X509_CERT_LOCATION_FREE       5 /* Certificate is uninitialized (except for next pointer) and usable by X509, TLS, etc. */
 
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+
+/* Size of the digests identifying a verified certificate signature. Longer digests are truncated. */
+#ifndef NX_SECURE_X509_VERIFY_CACHE_DIGEST_SIZE
+#define NX_SECURE_X509_VERIFY_CACHE_DIGEST_SIZE 32
+#endif /* NX_SECURE_X509_VERIFY_CACHE_DIGEST_SIZE */
+
+/* A certificate signature that has been verified against the public key of its issuer. The signed
+   portion of the certificate is identified by its digest under the signature hash, the issuer by a
+   digest of its public key and the signature value. */
+typedef struct NX_SECURE_X509_VERIFY_CACHE_ENTRY_STRUCT
+{
+    UCHAR  nx_secure_x509_verify_cache_entry_certificate[NX_SECURE_X509_VERIFY_CACHE_DIGEST_SIZE];
+    UCHAR  nx_secure_x509_verify_cache_entry_link[NX_SECURE_X509_VERIFY_CACHE_DIGEST_SIZE];
+
+    /* Signature algorithm of the certificate, zero if the entry is free. */
+    USHORT nx_secure_x509_verify_cache_entry_signature_algorithm;
+    USHORT nx_secure_x509_verify_cache_entry_digest_length;
+
+    /* Value of the cache use counter when the entry was last used, for LRU replacement. */
+    ULONG  nx_secure_x509_verify_cache_entry_last_use;
+} NX_SECURE_X509_VERIFY_CACHE_ENTRY;
+
+/* Bounded LRU cache of verified certificate signatures, shared by any number of certificate stores.
+   Only the public-key signature operation is skipped on a hit - issuer lookup, key usage and
+   the trust anchor checks are still performed for every chain. */
+typedef struct NX_SECURE_X509_VERIFY_CACHE_STRUCT
+{
+    NX_SECURE_X509_VERIFY_CACHE_ENTRY *nx_secure_x509_verify_cache_entries;
+    UINT                               nx_secure_x509_verify_cache_count;
+    ULONG                              nx_secure_x509_verify_cache_use_counter;
+
+    /* Current time in the format of _nx_secure_x509_expiration_check, or zero if unknown. When
+       known, entries are only used and added while both certificates are within their validity. */
+    ULONG                              nx_secure_x509_verify_cache_current_time;
+
+    /* Statistics. */
+    ULONG                              nx_secure_x509_verify_cache_hits;
+    ULONG                              nx_secure_x509_verify_cache_misses;
+} NX_SECURE_X509_VERIFY_CACHE;
+
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
+
 /* Certificate store structure - contains linked lists of all certificates for this device. */
 typedef struct NX_SECURE_X509_CERTIFICATE_STORE_STRUCT
 {
@@ -891,6 +937,11 @@ typedef struct NX_SECURE_X509_CERTIFICATE_STORE_STRUCT
        temporarily and not something we want in a the trusted store. Keep this store separate
        so we can clear it out more easily. */
     NX_SECURE_X509_CERT *nx_secure_x509_certificate_exceptions;
+
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+    /* Optional cache of verified certificate signatures. */
+    NX_SECURE_X509_VERIFY_CACHE *nx_secure_x509_verify_cache;
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 } NX_SECURE_X509_CERTIFICATE_STORE;
 
 /* Get certificate for local device. */
@@ -1001,6 +1052,18 @@ UINT _nx_secure_x509_extension_find(NX_SECURE_X509_CERT *certificate,
 UINT _nx_secure_x509_key_usage_extension_parse(NX_SECURE_X509_CERT *certificate, USHORT *bitfield);
 UINT _nx_secure_x509_subject_alt_names_find(NX_SECURE_X509_EXTENSION *extension, const UCHAR *name,
                                             UINT name_length, USHORT name_type);
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nx_secure_x509_verify_cache_add(NX_SECURE_X509_VERIFY_CACHE *cache, NX_SECURE_X509_CERT *certificate,
+                                      NX_SECURE_X509_CERT *issuer_certificate, const UCHAR *certificate_digest,
+                                      const UCHAR *link_digest, UINT digest_length);
+UINT _nx_secure_x509_verify_cache_create(NX_SECURE_X509_VERIFY_CACHE *cache, VOID *memory_ptr, ULONG memory_size);
+UINT _nx_secure_x509_verify_cache_find(NX_SECURE_X509_VERIFY_CACHE *cache, NX_SECURE_X509_CERT *certificate,
+                                       NX_SECURE_X509_CERT *issuer_certificate, const UCHAR *certificate_digest,
+                                       const UCHAR *link_digest, UINT digest_length);
+UINT _nx_secure_x509_verify_cache_flush(NX_SECURE_X509_VERIFY_CACHE *cache);
+UINT _nx_secure_x509_verify_cache_info_get(NX_SECURE_X509_VERIFY_CACHE *cache, UINT *entries_used,
+                                           ULONG *hits, ULONG *misses);
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 
 /* Error-checking APIs. */
 UINT _nxe_secure_x509_certificate_initialize(NX_SECURE_X509_CERT *certificate,
@@ -1020,6 +1083,12 @@ UINT _nxe_secure_x509_extended_key_usage_extension_parse(NX_SECURE_X509_CERT *ce
 UINT _nxe_secure_x509_extension_find(NX_SECURE_X509_CERT *certificate,
                                      NX_SECURE_X509_EXTENSION *extension, USHORT extension_id);
 UINT _nxe_secure_x509_key_usage_extension_parse(NX_SECURE_X509_CERT *certificate, USHORT *bitfield);
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nxe_secure_x509_verify_cache_create(NX_SECURE_X509_VERIFY_CACHE *cache, VOID *memory_ptr, ULONG memory_size);
+UINT _nxe_secure_x509_verify_cache_flush(NX_SECURE_X509_VERIFY_CACHE *cache);
+UINT _nxe_secure_x509_verify_cache_info_get(NX_SECURE_X509_VERIFY_CACHE *cache, UINT *entries_used,
+                                            ULONG *hits, ULONG *misses);
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 
 
 /* MAP APIs. */
@@ -1031,6 +1100,9 @@ UINT _nxe_secure_x509_key_usage_extension_parse(NX_SECURE_X509_CERT *certificate
 #define nx_secure_x509_extended_key_usage_extension_parse _nx_secure_x509_extended_key_usage_extension_parse
 #define nx_secure_x509_extension_find                     _nx_secure_x509_extension_find
 #define nx_secure_x509_key_usage_extension_parse          _nx_secure_x509_key_usage_extension_parse
+#define nx_secure_x509_verify_cache_create                _nx_secure_x509_verify_cache_create
+#define nx_secure_x509_verify_cache_flush                 _nx_secure_x509_verify_cache_flush
+#define nx_secure_x509_verify_cache_info_get              _nx_secure_x509_verify_cache_info_get
 #else
 #define nx_secure_x509_certificate_initialize             _nxe_secure_x509_certificate_initialize
 #define nx_secure_x509_common_name_dns_check              _nxe_secure_x509_common_name_dns_check
@@ -1039,6 +1111,9 @@ UINT _nxe_secure_x509_key_usage_extension_parse(NX_SECURE_X509_CERT *certificate
 #define nx_secure_x509_extended_key_usage_extension_parse _nxe_secure_x509_extended_key_usage_extension_parse
 #define nx_secure_x509_extension_find                     _nxe_secure_x509_extension_find
 #define nx_secure_x509_key_usage_extension_parse          _nxe_secure_x509_key_usage_extension_parse
+#define nx_secure_x509_verify_cache_create                _nxe_secure_x509_verify_cache_create
+#define nx_secure_x509_verify_cache_flush                 _nxe_secure_x509_verify_cache_flush
+#define nx_secure_x509_verify_cache_info_get              _nxe_secure_x509_verify_cache_info_get
 #endif
 
 UINT nx_secure_x509_certificate_initialize(NX_SECURE_X509_CERT *certificate, UCHAR *certificate_data,
@@ -1057,6 +1132,12 @@ UINT nx_secure_x509_extended_key_usage_extension_parse(NX_SECURE_X509_CERT *cert
 UINT nx_secure_x509_extension_find(NX_SECURE_X509_CERT *certificate,
                                    NX_SECURE_X509_EXTENSION *extension, USHORT extension_id);
 UINT nx_secure_x509_key_usage_extension_parse(NX_SECURE_X509_CERT *certificate, USHORT *bitfield);
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT nx_secure_x509_verify_cache_create(NX_SECURE_X509_VERIFY_CACHE *cache, VOID *memory_ptr, ULONG memory_size);
+UINT nx_secure_x509_verify_cache_flush(NX_SECURE_X509_VERIFY_CACHE *cache);
+UINT nx_secure_x509_verify_cache_info_get(NX_SECURE_X509_VERIFY_CACHE *cache, UINT *entries_used,
+                                          ULONG *hits, ULONG *misses);
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 
 #ifdef __cplusplus
 }
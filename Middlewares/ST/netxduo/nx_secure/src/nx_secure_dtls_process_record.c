@@ -30,7 +30,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_dtls_process_record                      PORTABLE C      */
-/*                                                           6.1.3        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -84,6 +84,10 @@
 /*                                            improved buffer length      */
 /*                                            verification,               */
 /*                                            resulting in version 6.1.3  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            initialized decrypted       */
+/*                                            packet,                     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_dtls_process_record(NX_SECURE_DTLS_SESSION *dtls_session, NX_PACKET *packet_ptr,
@@ -166,7 +170,8 @@ NX_PACKET             *decrypted_packet;
         epoch_seq_num[6] = header_data[4];
         epoch_seq_num[7] = header_data[3];
 
-        /* Decrypt the record data. */
+        /* Decrypt the record data into a new packet. */
+        decrypted_packet = NX_NULL;
         status = _nx_secure_tls_record_payload_decrypt(tls_session, packet_ptr, header_length, message_length,
                                                        &decrypted_packet, (ULONG *)epoch_seq_num, (UCHAR)message_type,
                                                        wait_option);
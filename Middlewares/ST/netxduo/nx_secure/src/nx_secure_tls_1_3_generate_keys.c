@@ -58,7 +58,7 @@ static UINT _nx_secure_tls_hkdf_extract(NX_SECURE_TLS_SESSION *tls_session, UCHA
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_1_3_generate_psk_secrets             PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -93,6 +93,10 @@ static UINT _nx_secure_tls_hkdf_extract(NX_SECURE_TLS_SESSION *tls_session, UCHA
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), used the */
+/*                                            resumption binder label for */
+/*                                            ticket PSKs,                */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -105,12 +109,15 @@ UCHAR *psk_secret;
 UINT   psk_secret_length;
 UCHAR *label;
 UINT label_length;
-UINT is_resumption_psk = NX_FALSE;
+UINT is_resumption_psk;
 
 
     /* Get the hash length so we know how much data we are generating. */
     hash_length = (hash_method->nx_crypto_ICV_size_in_bits >> 3);
 
+    /* PSKs from session tickets use the "res binder" label. */
+    is_resumption_psk = psk_entry->nx_secure_tls_psk_resumption;
+
     /* The PSK is the input to the early secret. */
     psk_secret = (UCHAR *)psk_entry->nx_secure_tls_psk_data;
     psk_secret_length = psk_entry->nx_secure_tls_psk_data_size;
@@ -596,7 +603,7 @@ UINT                                  key_offset;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_generate_session_psk                 PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -610,9 +617,11 @@ UINT                                  key_offset;
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           TLS control block             */
-/*    ticket_psk                            PSK control block for output  */
 /*    nonce                                 Pointer to session nonce      */
 /*    nonce_len                             Length of nonce               */
+/*    psk                                   Output PSK buffer             */
+/*    psk_size                              Size of PSK buffer            */
+/*    psk_length                            Length of generated PSK       */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -631,11 +640,17 @@ UINT                                  key_offset;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), derived  */
+/*                                            the resumption master       */
+/*                                            secret from the full        */
+/*                                            handshake transcript,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
 
-UINT _nx_secure_tls_1_3_session_psk_generate(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_PSK_STORE *ticket_psk, UCHAR *nonce, UINT nonce_len)
+UINT _nx_secure_tls_1_3_session_psk_generate(NX_SECURE_TLS_SESSION *tls_session, UCHAR *nonce, UINT nonce_len,
+                                             UCHAR *psk, UINT psk_size, UINT *psk_length)
 {
 NX_SECURE_TLS_KEY_SECRETS *secrets;
 UINT status;
@@ -661,14 +676,34 @@ const NX_CRYPTO_METHOD *hash_method;
     hash_method = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_hash;
     hash_length = (hash_method->nx_crypto_ICV_size_in_bits >> 3);
 
+    if (psk_size < hash_length)
+    {
+        return(NX_SECURE_TLS_PACKET_BUFFER_TOO_SMALL);
+    }
+
+    /* Derive the resumption master secret once the whole handshake, including the client Finished, is in the transcript:
+         resumption_master_secret = Derive-Secret(Master Secret, "res master", ClientHello...client Finished) */
+    if (secrets->tls_resumption_master_secret_len == 0)
+    {
+        status = _nx_secure_tls_derive_secret(tls_session, secrets->tls_master_secret, secrets->tls_master_secret_len,
+                                              (UCHAR *)"res master", 10,
+                                              tls_session->nx_secure_tls_key_material.nx_secure_tls_transcript_hashes[NX_SECURE_TLS_TRANSCRIPT_IDX_CLIENT_FINISHED],
+                                              hash_length, secrets->tls_resumption_master_secret, hash_length, hash_method);
+
+        if(status != NX_SUCCESS)
+        {
+            return(status);
+        }
+        secrets->tls_resumption_master_secret_len = hash_length;
+    }
+
     /* Generate the PSK by running HKDF-Expand-Label with the resumption secret and the passed-in nonce. */
     status = _nx_secure_tls_hkdf_expand_label(tls_session, secrets->tls_resumption_master_secret, secrets->tls_resumption_master_secret_len,
                                           (UCHAR *)"resumption", 10, nonce, nonce_len, hash_length,
-                                          ticket_psk->nx_secure_tls_psk_data,
-                                          sizeof(ticket_psk->nx_secure_tls_psk_data), hash_method);
+                                          psk, psk_size, hash_method);
 
     /* Set the length of our PSK. */
-    ticket_psk->nx_secure_tls_psk_data_size = hash_length;
+    *psk_length = hash_length;
 
     return(status);
 }
@@ -679,7 +714,7 @@ const NX_CRYPTO_METHOD *hash_method;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_1_3_generate_handshake_secrets       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -709,6 +744,10 @@ const NX_CRYPTO_METHOD *hash_method;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), used the */
+/*                                            resumption binder label for */
+/*                                            ticket PSKs,                */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -853,6 +892,7 @@ UINT is_resumption_psk = NX_FALSE;
     {
         psk_secret = tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_data;
         psk_secret_length = tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_data_size;
+        is_resumption_psk = tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_resumption;
     }
 
     NX_SECURE_MEMSET(_nx_secure_tls_zeroes, 0, sizeof(_nx_secure_tls_zeroes));
@@ -990,7 +1030,7 @@ UINT is_resumption_psk = NX_FALSE;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_1_3_generate_session_secrets         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -1020,6 +1060,11 @@ UINT is_resumption_psk = NX_FALSE;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), deferred */
+/*                                            the resumption master       */
+/*                                            secret until the client     */
+/*                                            Finished is hashed,         */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -1123,21 +1168,9 @@ UCHAR (*transcript_hashes)[NX_SECURE_TLS_MAX_HASH_SIZE] = tls_session->nx_secure
         }
         secrets->tls_early_exporter_master_secret_len = hash_length;
 
-        /*----- Resumption master secret. -----*/
-        label = (UCHAR *)"res master";
-        label_length = 10;
-
-        status = _nx_secure_tls_derive_secret(tls_session, secrets->tls_master_secret, secrets->tls_master_secret_len, label, label_length,
-                                              transcript_hashes[NX_SECURE_TLS_TRANSCRIPT_IDX_CLIENT_FINISHED], hash_length,
-                                              secrets->tls_resumption_master_secret, hash_length, hash_method);
-
-        if(status != NX_SUCCESS)
-        {
-            return(status);
-        }
-        secrets->tls_resumption_master_secret_len = hash_length;
-
-
+        /* The resumption master secret covers the client Finished, which has not been
+           received yet when the server generates its session keys. It is derived by
+           _nx_secure_tls_1_3_session_psk_generate when the first ticket is handled. */
     }
 
     return(NX_SUCCESS);
@@ -31,7 +31,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_server_handshake                     PORTABLE C      */
-/*                                                           6.1.4        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -107,6 +107,12 @@
 /*                                            support for fragmented TLS  */
 /*                                            Handshake messages,         */
 /*                                            resulting in version 6.1.4  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), issued   */
+/*                                            session tickets when ticket */
+/*                                            keys are set, saved the     */
+/*                                            client Finished transcript  */
+/*                                            after hashing it,           */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -288,13 +294,6 @@ NX_SECURE_TLS_SERVER_STATE            old_server_state;
             break;
         }
 
-        /* Save the transcript hash to this point for key generation - Server Finished was processed so save it. */
-        status = _nx_secure_tls_1_3_transcript_hash_save(tls_session, NX_SECURE_TLS_TRANSCRIPT_IDX_CLIENT_FINISHED, NX_TRUE);
-        if(status != NX_SUCCESS)
-        {
-            break;
-        }
-
         tls_session -> nx_secure_tls_server_state = NX_SECURE_TLS_SERVER_STATE_FINISH_HANDSHAKE;
         break;
 /*  Invalid message types in tls 1.3. 
@@ -567,6 +566,14 @@ NX_SECURE_TLS_SERVER_STATE            old_server_state;
         break;
     case NX_SECURE_TLS_SERVER_STATE_FINISH_HANDSHAKE:
 
+        /* Save the transcript hash to this point for the resumption master secret - the Client Finished
+           was hashed above so save it. */
+        status = _nx_secure_tls_1_3_transcript_hash_save(tls_session, NX_SECURE_TLS_TRANSCRIPT_IDX_CLIENT_FINISHED, NX_TRUE);
+        if(status != NX_SUCCESS)
+        {
+            break;
+        }
+
         /* Now switch to the session keys for our remote session since we have processed the Finished from the Client. */
         status = _nx_secure_tls_1_3_session_keys_set(tls_session, NX_SECURE_TLS_KEY_SET_REMOTE);
         if(status != NX_SUCCESS)
@@ -576,20 +583,33 @@ NX_SECURE_TLS_SERVER_STATE            old_server_state;
 
         /* Post-Auth server messages (if any) are sent here. */
 
-        /* For session resumption, send a NewSessionTicket message to allow for resumption PSK to be generated. */
-        status = _nx_secure_tls_allocate_handshake_packet(tls_session, packet_pool, &send_packet, wait_option);
-        if (status != NX_SUCCESS)
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+        /* For session resumption, send a NewSessionTicket message to allow for resumption PSK to be generated.
+           Tickets are only issued once the application has installed a ticket key. */
+        if ((tls_session -> nx_secure_tls_ticket_keys != NX_NULL) &&
+            (tls_session -> nx_secure_tls_ticket_keys -> nx_secure_tls_ticket_key_current.nx_secure_tls_ticket_key_size != 0))
         {
-            break;
-        }
+            status = _nx_secure_tls_allocate_handshake_packet(tls_session, packet_pool, &send_packet, wait_option);
+            if (status != NX_SUCCESS)
+            {
+                break;
+            }
 
-        /* Populate the packet with our NewSessionTicket Message. */
-        status = _nx_secure_tls_send_newsessionticket(tls_session, send_packet);
-        status = _nx_secure_tls_send_handshake_record(tls_session, send_packet, NX_SECURE_TLS_NEW_SESSION_TICKET, wait_option);
-        if(status != NX_SUCCESS)
-        {
-            break;
+            /* Populate the packet with our NewSessionTicket Message. */
+            status = _nx_secure_tls_send_newsessionticket(tls_session, send_packet);
+            if (status != NX_SUCCESS)
+            {
+                nx_secure_tls_packet_release(send_packet);
+                break;
+            }
+
+            status = _nx_secure_tls_send_handshake_record(tls_session, send_packet, NX_SECURE_TLS_NEW_SESSION_TICKET, wait_option);
+            if(status != NX_SUCCESS)
+            {
+                break;
+            }
         }
+#endif /* NX_SECURE_ENABLE_PSK_CIPHERSUITES */
 
         /* If we get here, the Client Finished was processed without errors and the handshake is complete. */
         tls_session -> nx_secure_tls_server_state = NX_SECURE_TLS_SERVER_STATE_HANDSHAKE_FINISHED;
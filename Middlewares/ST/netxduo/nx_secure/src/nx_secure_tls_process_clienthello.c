@@ -36,7 +36,7 @@ static UINT _nx_secure_tls_check_ciphersuite(const NX_SECURE_TLS_CIPHERSUITE_INF
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_process_clienthello                  PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -91,6 +91,10 @@ static UINT _nx_secure_tls_check_ciphersuite(const NX_SECURE_TLS_CIPHERSUITE_INF
 /*                                            fixed renegotiation bug,    */
 /*                                            improved negotiation logic, */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), dropped  */
+/*                                            a resumption PSK with a     */
+/*                                            mismatched hash,            */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_process_clienthello(NX_SECURE_TLS_SESSION *tls_session, UCHAR *packet_buffer,
@@ -501,6 +505,19 @@ USHORT                                tls_1_3 = tls_session -> nx_secure_tls_1_3
         return(NX_SECURE_TLS_NO_SUPPORTED_CIPHERS);
     }
 
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+    /* A resumption PSK may only be used with a ciphersuite having the same hash as the connection
+       that issued the ticket. Otherwise fall back to a full handshake. */
+    if ((tls_session -> nx_secure_tls_1_3) &&
+        (tls_session -> nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_resumption) &&
+        (tls_session -> nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_binder_ciphersuite -> nx_secure_tls_hash !=
+         tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_hash))
+    {
+        tls_session -> nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_data_size = 0;
+        tls_session -> nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_resumption = NX_FALSE;
+    }
+#endif
+
 #ifdef NX_SECURE_TLS_SERVER_DISABLED
     /* If TLS Server is disabled and we have processed a ClientHello, something is wrong... */
     tls_session -> nx_secure_tls_client_state = NX_SECURE_TLS_CLIENT_STATE_ERROR;
@@ -54,7 +54,7 @@ static UINT _nx_secure_tls_process_clienthello_psk_extension(NX_SECURE_TLS_SESSI
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_process_clienthello_extensions       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -100,6 +100,11 @@ static UINT _nx_secure_tls_process_clienthello_psk_extension(NX_SECURE_TLS_SESSI
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            fixed renegotiation bug,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            continued with a full       */
+/*                                            handshake when no offered   */
+/*                                            PSK is known,               */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_process_clienthello_extensions(NX_SECURE_TLS_SESSION *tls_session,
@@ -213,7 +218,12 @@ USHORT supported_version = tls_session -> nx_secure_tls_protocol_version;
                 status = _nx_secure_tls_process_clienthello_psk_extension(tls_session, &packet_buffer[offset],
                                                                           (USHORT)extension_length, client_hello_buffer, client_hello_length);
 
-                if (status)
+                /* If none of the offered PSKs is known (e.g. an expired ticket), continue with a full handshake. */
+                if (status == NX_SECURE_TLS_NO_MATCHING_PSK)
+                {
+                    status = NX_SUCCESS;
+                }
+                else if (status)
                 {
                     return(status);
                 }
@@ -704,7 +714,7 @@ UCHAR expected_signature = 0;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_proc_clienthello_keyshare_extension  PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -739,6 +749,9 @@ UCHAR expected_signature = 0;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), accepted */
+/*                                            X25519 key shares,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -863,7 +876,16 @@ NX_SECURE_TLS_ECC *ecc_info;
       so don't advance the offset! */
     legacy_form = pubkey[0];
 
-    if(legacy_form != 0x4)
+    if (key_group == (USHORT)NX_CRYPTO_EC_X25519)
+    {
+
+        /* X25519 key shares are the raw 32-byte u-coordinate with no form byte (RFC 8446, section 4.2.8.2). */
+        if (key_length != 32)
+        {
+            return(NX_SECURE_TLS_BAD_CLIENTHELLO_KEYSHARE);
+        }
+    }
+    else if(legacy_form != 0x4)
     {
         /* In TLS 1.3, the only valid form is 0x4. */
         return(NX_SECURE_TLS_BAD_CLIENTHELLO_KEYSHARE);
@@ -1289,7 +1311,7 @@ VOID _nx_secure_tls_get_signature_algorithm_id(UINT signature_algorithm, USHORT
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_process_clienthello_psk_extension    PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -1323,6 +1345,12 @@ VOID _nx_secure_tls_get_signature_algorithm_id(UINT signature_algorithm, USHORT
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), accepted */
+/*                                            session tickets as          */
+/*                                            resumption PSKs, fixed      */
+/*                                            binder lookup for later     */
+/*                                            identities,                 */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
@@ -1345,6 +1373,15 @@ UINT   status;
 UINT   age;
 UINT psk_found = NX_FALSE;
 UINT partial_hello_length;
+UINT is_ticket = NX_FALSE;
+UINT ticket_state_length;
+ULONG issue_time;
+ULONG lifetime;
+UCHAR ticket_state[NX_SECURE_TLS_TICKET_STATE_SIZE + NX_SECURE_TLS_MAX_PSK_SIZE];
+const NX_SECURE_TLS_CIPHERSUITE_INFO *ticket_ciphersuite = NX_NULL;
+USHORT ticket_priority;
+NX_SECURE_TLS_PSK_STORE *psk_entry;
+NX_SECURE_TLS_PSK_STORE *client_psk;
 
 NX_SECURE_TLS_PSK_STORE *psk_store;
 
@@ -1447,16 +1484,12 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
         id = &packet_buffer[offset];
         offset += id_len;
 
-        /* Extract the age field. */
+        /* Extract the age field. The obfuscated ticket age only matters for early data, which is
+           not supported, so it is not checked. */
         age = (UINT)((packet_buffer[offset]     << 24) + (packet_buffer[offset + 1] << 16) +
                      (packet_buffer[offset + 2] <<  8) +  packet_buffer[offset + 3]);
         offset += 4;
-        
-        /* Only support external PSKs (no session resumption). */
-        if(age != 0)
-        {
-            return(NX_SECURE_TLS_BAD_CLIENTHELLO_PSK_EXTENSION);
-        }
+        NX_PARAMETER_NOT_USED(age);
 
         /* Size of entry = 2 bytes id_len + <id_len> + 4 bytes age field. */
         list_length -= (2 + id_len + 4);
@@ -1464,6 +1497,26 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
         /* Check the ID list against our PSK store. */
         status = _nx_secure_tls_psk_identity_find(tls_session, &psk_data, &psk_length, (UCHAR*)id, id_len, &psk_store_index);
 
+        /* Otherwise the ID may be a session ticket we issued. Tickets that do not decrypt, have
+           expired or name a ciphersuite we no longer support are skipped like unknown IDs. */
+        if ((status == NX_SECURE_TLS_NO_MATCHING_PSK) && (tls_session -> nx_secure_tls_ticket_keys != NX_NULL) &&
+            (_nx_secure_tls_ticket_decrypt(tls_session, id, id_len, ticket_state, sizeof(ticket_state), &ticket_state_length) == NX_SUCCESS))
+        {
+            issue_time = (ULONG)((ticket_state[2] << 24) + (ticket_state[3] << 16) + (ticket_state[4] << 8) + ticket_state[5]);
+            lifetime = (ULONG)((ticket_state[6] << 24) + (ticket_state[7] << 16) + (ticket_state[8] << 8) + ticket_state[9]);
+            psk_length = ticket_state[14];
+
+            if ((ticket_state_length == (NX_SECURE_TLS_TICKET_STATE_SIZE + psk_length)) &&
+                (((ULONG)(tx_time_get() - issue_time) / NX_IP_PERIODIC_RATE) < lifetime) &&
+                (_nx_secure_tls_ciphersuite_lookup(tls_session, (UINT)((ticket_state[0] << 8) + ticket_state[1]),
+                                                   &ticket_ciphersuite, &ticket_priority) == NX_SUCCESS))
+            {
+                psk_data = &ticket_state[NX_SECURE_TLS_TICKET_STATE_SIZE];
+                is_ticket = NX_TRUE;
+                status = NX_SUCCESS;
+            }
+        }
+
         /* No match? Continue. */
         if(status == NX_SECURE_TLS_NO_MATCHING_PSK)
         {
@@ -1540,6 +1593,7 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
         }
 
         /* Advance the binder index. */
+        offset += binder_len;
         binder_index++;
     }
 
@@ -1589,28 +1643,59 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
                          tls_session -> nx_secure_tls_handshake_hash.nx_secure_tls_handshake_hash_sha256_metadata_size); /* Use case of memcpy is verified. */
     }
 
+    /* The PSK is too big to save in our internal buffer. */
+    if(psk_length > NX_SECURE_TLS_MAX_PSK_SIZE)
+    {
+        return(NX_SECURE_TLS_NO_MORE_PSK_SPACE);
+    }
+
+    /* A ticket PSK has no store entry, so the Client PSK holds it while its binder is generated, using
+       the "res binder" label and the hash of the connection that issued the ticket. */
+    client_psk = &tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk;
+    if (is_ticket)
+    {
+        NX_SECURE_MEMCPY(client_psk -> nx_secure_tls_psk_data, psk_data, psk_length); /* Use case of memcpy is verified. */
+        client_psk -> nx_secure_tls_psk_data_size = psk_length;
+        client_psk -> nx_secure_tls_psk_binder_ciphersuite = ticket_ciphersuite;
+        client_psk -> nx_secure_tls_psk_resumption = NX_TRUE;
+        psk_entry = client_psk;
+        NX_SECURE_MEMSET(ticket_state, 0, sizeof(ticket_state));
+    }
+    else
+    {
+        psk_entry = &psk_store[psk_store_index];
+    }
+
     /* Generate the binder for our selected PSK. */
-    _nx_secure_tls_psk_binder_generate(tls_session, &psk_store[psk_store_index]);
+    status = _nx_secure_tls_psk_binder_generate(tls_session, psk_entry);
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
 
     /* Compare the generated binder to the received binder, using our generated length to avoid overflow
        from incoming length problems. */
-    status = (UINT)NX_SECURE_MEMCMP(binder, psk_store[psk_store_index].nx_secure_tls_psk_binder, psk_store[psk_store_index].nx_secure_tls_psk_binder_size);
+    status = (UINT)NX_SECURE_MEMCMP(binder, psk_entry -> nx_secure_tls_psk_binder, psk_entry -> nx_secure_tls_psk_binder_size);
 
     /* Make sure the generated binder matches the one sent by the client. */
-    if((status != 0) || (binder_len != psk_store[psk_store_index].nx_secure_tls_psk_binder_size))
+    if((status != 0) || (binder_len != psk_entry -> nx_secure_tls_psk_binder_size))
     {
+        client_psk -> nx_secure_tls_psk_data_size = 0;
         return(NX_SECURE_TLS_PSK_BINDER_MISMATCH);
     }
 
-    /* The PSK is too big to save in our internal buffer. */
-    if(psk_length > NX_SECURE_TLS_MAX_PSK_SIZE)
+    if (!is_ticket)
     {
-        return(NX_SECURE_TLS_NO_MORE_PSK_SPACE);
+
+        /* Make sure the Client PSK is initialized for later key generation. */
+        NX_SECURE_MEMCPY(client_psk -> nx_secure_tls_psk_data, psk_data, psk_length); /* Use case of memcpy is verified. */
+        client_psk -> nx_secure_tls_psk_data_size = psk_length;
+        client_psk -> nx_secure_tls_psk_binder_ciphersuite = psk_entry -> nx_secure_tls_psk_binder_ciphersuite;
+        client_psk -> nx_secure_tls_psk_resumption = NX_FALSE;
     }
 
-    /* Make sure the Client PSK is initialized for later key generation. */
-    NX_SECURE_MEMCPY(tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_data, psk_data, psk_length); /* Use case of memcpy is verified. */
-    tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_data_size = psk_length;
+    /* Tell the client which of its identities was selected. */
+    tls_session -> nx_secure_tls_psk_selected_identity = psk_index;
 
     return(NX_SUCCESS);
 }
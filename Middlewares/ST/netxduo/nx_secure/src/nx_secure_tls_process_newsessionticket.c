@@ -29,7 +29,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_process_newsessionticket             PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -39,12 +39,15 @@
 /*    This function processes a NewSessionTicket message from a TLS       */
 /*    Server. The message contains data used to generate a PSK that can   */
 /*    be used for session resumption should the same client attempt       */
-/*    another connection within the lifespan of the ticket.               */
+/*    another connection within the lifespan of the ticket. The ticket    */
+/*    and its PSK are kept in the session ticket cache under the server   */
+/*    identity; without a cache the ticket is ignored.                    */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           TLS control block             */
-/*    send_packet                           Packet used to send message   */
+/*    packet_buffer                         Pointer to message data       */
+/*    message_length                        Length of message data        */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -52,11 +55,14 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    N/A                                                                 */
+/*    _nx_secure_tls_1_3_session_psk_generate                             */
+/*                                          Generate resumption PSK       */
+/*    _nx_secure_tls_ticket_cache_find      Find cached ticket            */
+/*    tx_time_get                           Get current time              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nx_secure_tls_client_handshake       TLS client state machine      */
+/*    _nx_secure_tls_process_record         Process TLS record            */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -67,20 +73,27 @@
 /*                                            verified memcpy use cases,  */
 /*                                            fixed compiler warnings,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), stored   */
+/*                                            tickets in the session      */
+/*                                            ticket cache,               */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
 UINT _nx_secure_tls_process_newsessionticket(NX_SECURE_TLS_SESSION *tls_session, UCHAR *packet_buffer,
                                              UINT message_length)
 {
-UINT             status = NX_SUCCESS;
-UINT             lifetime;
-UINT             nonce;
-UINT             nonce_len;
-UINT             ticket_len;
-UCHAR            *ticket;
-UINT             psk_count;
-NX_SECURE_TLS_PSK_STORE *ticket_psk;
+UINT                        status;
+ULONG                       lifetime;
+ULONG                       age_add;
+UINT                        nonce_len;
+UCHAR                      *nonce;
+UINT                        ticket_len;
+UCHAR                      *ticket;
+UINT                        psk_length;
+NX_SECURE_TLS_TICKET_CACHE *ticket_cache;
+NX_SECURE_TLS_TICKET       *entry;
+UCHAR                       psk[NX_SECURE_TLS_MAX_PSK_SIZE];
 
     /* From RFC 8446:
        struct {
@@ -145,64 +158,101 @@ NX_SECURE_TLS_PSK_STORE *ticket_psk;
 
     */
 
-    /* Get a PSK entry into which we can copy the ticket data we received. */
-    psk_count = tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count;
-    psk_count++;
-    if(psk_count >= NX_SECURE_TLS_MAX_PSK_KEYS)
+    /* Lifetime, age_add and nonce length. */
+    if (message_length < 9)
     {
-        psk_count = 0;
+        return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
     }
-    ticket_psk = &(tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_store[psk_count]);
 
+    /* First, the ticket lifetime in seconds - 604800 is the maximum. */
+    lifetime = (ULONG)((packet_buffer[0] << 24) + (packet_buffer[1] << 16) + (packet_buffer[2] << 8) + packet_buffer[3]);
 
-    /* First, the ticket lifetime in ms - 604800 is the maximum. */
-    lifetime = (UINT)((packet_buffer[0] << 24) + (packet_buffer[1] << 16) + (packet_buffer[2] << 8) + packet_buffer[3]);
-    packet_buffer = &packet_buffer[4];
+    /* Then the value used to obscure the ticket age. */
+    age_add = (ULONG)((packet_buffer[4] << 24) + (packet_buffer[5] << 16) + (packet_buffer[6] << 8) + packet_buffer[7]);
 
-    if(lifetime > NX_SECURE_TLS_MAX_SESSION_TICKET_AGE)
+    /* Get the nonce. */
+    nonce_len = packet_buffer[8];
+    nonce = &packet_buffer[9];
+    if (message_length < (11 + nonce_len))
     {
-        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+        return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
     }
 
-    /* Save the lifetime of the ticket. */
-    ticket_psk->nx_secure_tls_psk_ticket_lifetime = lifetime;
+    /* Now for the ticket itself. 16-bit length with the ticket being a label
+       used as the PSK identity. */
+    ticket_len = (UINT)((packet_buffer[9 + nonce_len] << 8) + packet_buffer[10 + nonce_len]);
+    ticket = &packet_buffer[11 + nonce_len];
 
-    /* Skip the age add value. */
-    packet_buffer = &packet_buffer[4];
+    /* The extensions (early_data only) follow the ticket. Early data is not supported so they are skipped. */
+    if ((ticket_len == 0) || (message_length < (13 + nonce_len + ticket_len)))
+    {
+        return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+    }
 
-    /* Get the nonce length. */
-    nonce_len = packet_buffer[0];
-    packet_buffer = &packet_buffer[1];
+    /* Without a ticket cache there is nowhere to keep the ticket. */
+    ticket_cache = tls_session -> nx_secure_tls_ticket_cache;
+    if ((ticket_cache == NX_NULL) || (tls_session -> nx_secure_tls_ticket_server_id_size == 0))
+    {
+        return(NX_SUCCESS);
+    }
 
-    /* Get the nonce. */
-    if(nonce_len > message_length || nonce_len > NX_SECURE_TLS_MAX_PSK_NONCE_SIZE)
+    /* Tickets from this server replace the one already cached for it. */
+    (VOID)_nx_secure_tls_ticket_cache_find(tls_session, &entry);
+
+    /* A lifetime of zero means the ticket must be discarded. Tickets too large to cache are dropped as well. */
+    if ((lifetime == 0) || (ticket_len > NX_SECURE_TLS_MAX_TICKET_SIZE))
     {
-        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+        if (entry != NX_NULL)
+        {
+            entry -> nx_secure_tls_ticket_size = 0;
+        }
+        return(NX_SUCCESS);
     }
-    nonce = (UINT)((packet_buffer[0] << 24) + (packet_buffer[1] << 16) + (packet_buffer[2] << 8) + packet_buffer[3]);;
-    packet_buffer = &packet_buffer[nonce_len];
 
-    /* Now for the ticket ID itself. 16-bit length with the ticket being a label
-       used as the PSK identity. */
-    ticket_len = (USHORT)((packet_buffer[0] << 8) + packet_buffer[1]);
-    packet_buffer = &packet_buffer[2];
-    ticket =  (UCHAR *)(&packet_buffer[0]);
+    /* We can now generate the PSK for this session using our ticket nonce and the cryptographic
+       secrets generated in the handshake. */
+    status = _nx_secure_tls_1_3_session_psk_generate(tls_session, nonce, nonce_len, psk, sizeof(psk), &psk_length);
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
 
-    if(ticket_len > message_length || ticket_len > NX_SECURE_TLS_MAX_PSK_ID_SIZE)
+    if (entry == NX_NULL)
     {
-        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+
+        /* No entry for this server yet, take the next one in turn. */
+        entry = &ticket_cache -> nx_secure_tls_ticket_cache_entries[ticket_cache -> nx_secure_tls_ticket_cache_next];
+        ticket_cache -> nx_secure_tls_ticket_cache_next++;
+        if (ticket_cache -> nx_secure_tls_ticket_cache_next >= ticket_cache -> nx_secure_tls_ticket_cache_count)
+        {
+            ticket_cache -> nx_secure_tls_ticket_cache_next = 0;
+        }
+
+        NX_SECURE_MEMCPY(entry -> nx_secure_tls_ticket_server_id, tls_session -> nx_secure_tls_ticket_server_id,
+                         tls_session -> nx_secure_tls_ticket_server_id_size); /* Use case of memcpy is verified. */
+        entry -> nx_secure_tls_ticket_server_id_size = tls_session -> nx_secure_tls_ticket_server_id_size;
     }
-    packet_buffer = &packet_buffer[ticket_len];
 
-    /* Copy ticket to PSK store - the ticket is the PSK ID used to identify the PSK in the future. */
-    NX_SECURE_MEMCPY(ticket_psk->nx_secure_tls_psk_id, ticket, ticket_len); /* Use case of memcpy is verified. */
-    ticket_psk->nx_secure_tls_psk_id_size = ticket_len;
+    /* Copy the ticket - the ticket is the PSK ID used to identify the PSK in the future. */
+    NX_SECURE_MEMCPY(entry -> nx_secure_tls_ticket_data, ticket, ticket_len); /* Use case of memcpy is verified. */
+    entry -> nx_secure_tls_ticket_size = ticket_len;
+    NX_SECURE_MEMCPY(entry -> nx_secure_tls_ticket_psk, psk, psk_length); /* Use case of memcpy is verified. */
+    entry -> nx_secure_tls_ticket_psk_size = psk_length;
+    NX_SECURE_MEMSET(psk, 0, sizeof(psk));
 
-    /* We can now generate the PSK for this session using our ticket nonce and the cryptographic
-       secrets we created earlier in the handshake. */
-    status = _nx_secure_tls_1_3_session_psk_generate(tls_session, ticket_psk, (UCHAR *)nonce, nonce_len);
+    /* Resumption must use a ciphersuite with the same hash as this connection. */
+    entry -> nx_secure_tls_ticket_ciphersuite = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_ciphersuite;
+
+    /* Clients MUST NOT cache tickets for longer than 7 days. */
+    if (lifetime > NX_SECURE_TLS_MAX_SESSION_TICKET_AGE)
+    {
+        lifetime = NX_SECURE_TLS_MAX_SESSION_TICKET_AGE;
+    }
+    entry -> nx_secure_tls_ticket_lifetime = lifetime;
+    entry -> nx_secure_tls_ticket_age_add = age_add;
+    entry -> nx_secure_tls_ticket_received = tx_time_get();
 
-    return(status);
+    return(NX_SUCCESS);
 }
 
 #endif
@@ -25,13 +25,16 @@
 #include "nx_secure_tls.h"
 
 static VOID _nx_secure_tls_packet_trim(NX_PACKET *packet_ptr);
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+static NX_PACKET *_nx_secure_tls_record_queue_detach(NX_SECURE_TLS_SESSION *tls_session, ULONG record_offset);
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
 
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_process_record                       PORTABLE C      */
-/*                                                           6.1.4        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -43,6 +46,10 @@ static VOID _nx_secure_tls_packet_trim(NX_PACKET *packet_ptr);
 /*    received in a single lower-level network packet (e.g. TCP), the     */
 /*    "record_offset" parameter is used to offset into the packet buffer. */
 /*                                                                        */
+/*    An AEAD record that ends the record queue is detached from the      */
+/*    queue and decrypted in place, so the application receives the       */
+/*    packets that carried it instead of a copy.                          */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           Pointer to TLS control block  */
@@ -60,6 +67,10 @@ static VOID _nx_secure_tls_packet_trim(NX_PACKET *packet_ptr);
 /*    _nx_secure_tls_process_changecipherspec                             */
 /*                                          Process ChangeCipherSpec      */
 /*    _nx_secure_tls_process_header         Process record header         */
+/*    _nx_secure_tls_process_handshake_header                             */
+/*                                          Process handshake header      */
+/*    _nx_secure_tls_process_newsessionticket                             */
+/*                                          Process NewSessionTicket      */
 /*    _nx_secure_tls_record_payload_decrypt Decrypt record data           */
 /*    _nx_secure_tls_server_handshake       TLS Server state machine      */
 /*    _nx_secure_tls_verify_mac             Verify record MAC checksum    */
@@ -67,6 +78,7 @@ static VOID _nx_secure_tls_packet_trim(NX_PACKET *packet_ptr);
 /*    nx_packet_data_append                 Append data to packet         */
 /*    nx_packet_data_extract_offset         Extract data from NX_PACKET   */
 /*    _nx_secure_tls_packet_trim            Trim TLS packet               */
+/*    _nx_secure_tls_record_queue_detach    Detach record from queue      */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
 /*                                                                        */
@@ -88,6 +100,11 @@ static VOID _nx_secure_tls_packet_trim(NX_PACKET *packet_ptr);
 /*                                            support for fragmented TLS  */
 /*                                            Handshake messages,         */
 /*                                            resulting in version 6.1.4  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            in-place AEAD decryption    */
+/*                                            and TLS 1.3 session ticket  */
+/*                                            processing,                 */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_process_record(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
@@ -103,6 +120,12 @@ ULONG      bytes_copied;
 UCHAR     *packet_data = NX_NULL;
 ULONG      record_offset = 0;
 ULONG      record_offset_next = 0;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT       handshake_offset;
+UINT       handshake_header_size;
+UINT       handshake_length;
+USHORT     handshake_type;
+#endif
 NX_PACKET *decrypted_packet;
 
     /* Basic state machine:
@@ -163,9 +186,6 @@ NX_PACKET *decrypted_packet;
         tls_session->nx_secure_tls_packet_buffer_bytes_copied = 0;
     }
 
-    /* Get packet from record queue. */
-    packet_ptr = tls_session -> nx_secure_record_queue_header;
-    
     /* Process multiple records per packet. */
     while (status == NX_CONTINUE)
     {
@@ -178,6 +198,13 @@ NX_PACKET *decrypted_packet;
         }
         decrypted_packet = NX_NULL;
 
+        /* Get packet from record queue. The queue is empty after a record was detached from it. */
+        packet_ptr = tls_session -> nx_secure_record_queue_header;
+        if (packet_ptr == NX_NULL)
+        {
+            return(NX_CONTINUE);
+        }
+
         /* Retrieve the saved record offset when more TCP packet is received for this one record. */
         if (tls_session -> nx_secure_tls_record_offset)
         {
@@ -246,6 +273,25 @@ NX_PACKET *decrypted_packet;
                 }
             }
 
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+            if ((tls_session -> nx_secure_tls_session_ciphersuite != NX_NULL) &&
+                (tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher -> nx_crypto_ICV_size_in_bits > 0) &&
+                (record_offset_next == packet_ptr -> nx_packet_length))
+            {
+
+                /* The record is the last data in the queue. Detach its packets so the payload
+                   is decrypted in place and returned without allocating another packet. Nothing
+                   is left in the queue to trim once the record is processed. */
+                packet_ptr = _nx_secure_tls_record_queue_detach(tls_session, record_offset);
+                tls_session -> nx_secure_record_decrypted_packet = packet_ptr;
+                decrypted_packet = packet_ptr;
+                record_offset = 0;
+                record_offset_next = 0;
+                *bytes_processed = 0;
+                tls_session -> nx_secure_tls_bytes_processed = 0;
+            }
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
+
             /* Decrypt the record data. */
             status = _nx_secure_tls_record_payload_decrypt(tls_session, packet_ptr, record_offset,
                                                            message_length, &decrypted_packet,
@@ -438,6 +484,30 @@ NX_PACKET *decrypted_packet;
             /* TLS 1.3 can send post-handshake messages with TLS HANDSHAKE record type. Process those separately. */
             if(tls_session->nx_secure_tls_1_3 && tls_session -> nx_secure_tls_client_state == NX_SECURE_TLS_CLIENT_STATE_HANDSHAKE_FINISHED)
             {
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+                /* Keep session tickets for resumption. Other post-handshake messages are ignored. */
+                for (handshake_offset = 0; handshake_offset < message_length; handshake_offset += handshake_header_size + handshake_length)
+                {
+                    handshake_header_size = message_length - handshake_offset;
+                    status = _nx_secure_tls_process_handshake_header(&packet_data[handshake_offset], &handshake_type,
+                                                                     &handshake_header_size, &handshake_length);
+                    if ((status != NX_SUCCESS) || ((handshake_offset + handshake_header_size + handshake_length) > message_length))
+                    {
+                        return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+                    }
+
+                    if (handshake_type == NX_SECURE_TLS_NEW_SESSION_TICKET)
+                    {
+                        status = _nx_secure_tls_process_newsessionticket(tls_session, &packet_data[handshake_offset + handshake_header_size],
+                                                                         handshake_length);
+                        if (status != NX_SUCCESS)
+                        {
+                            return(status);
+                        }
+                    }
+                }
+#endif /* NX_SECURE_ENABLE_PSK_CIPHERSUITES */
+
                 /* Process post-handshake messages. */
                 status = NX_SECURE_TLS_POST_HANDSHAKE_RECEIVED;
                 break;
@@ -638,3 +708,82 @@ NX_PACKET *current_ptr;
         message_length -= (ULONG)(current_ptr -> nx_packet_append_ptr - current_ptr -> nx_packet_prepend_ptr);
     }
 }
+
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_queue_detach                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes all packets from the record queue when the    */
+/*    current record ends the queue. Packets holding only data of earlier */
+/*    records are released and the returned chain starts at the record    */
+/*    payload.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           Pointer to TLS control block  */
+/*    record_offset                         Offset of the record payload  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    packet_ptr                            Detached record packet        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_tls_packet_release          Release packet                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_process_record         Process TLS records           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static NX_PACKET *_nx_secure_tls_record_queue_detach(NX_SECURE_TLS_SESSION *tls_session, ULONG record_offset)
+{
+NX_PACKET *packet_ptr = tls_session -> nx_secure_record_queue_header;
+NX_PACKET *current_ptr = packet_ptr;
+NX_PACKET *previous_ptr = NX_NULL;
+ULONG      payload_length;
+ULONG      record_length = packet_ptr -> nx_packet_length - record_offset;
+
+    tls_session -> nx_secure_record_queue_header = NX_NULL;
+
+    /* Find the packet holding the first byte of the payload. */
+    payload_length = (ULONG)(current_ptr -> nx_packet_append_ptr - current_ptr -> nx_packet_prepend_ptr);
+    while ((record_offset >= payload_length) && (current_ptr -> nx_packet_next))
+    {
+        record_offset -= payload_length;
+        previous_ptr = current_ptr;
+        current_ptr = current_ptr -> nx_packet_next;
+        payload_length = (ULONG)(current_ptr -> nx_packet_append_ptr - current_ptr -> nx_packet_prepend_ptr);
+    }
+
+    if (previous_ptr)
+    {
+
+        /* Release packets consumed by earlier records. */
+        previous_ptr -> nx_packet_next = NX_NULL;
+        current_ptr -> nx_packet_last = packet_ptr -> nx_packet_last;
+        packet_ptr -> nx_packet_last = previous_ptr;
+        nx_secure_tls_packet_release(packet_ptr);
+    }
+
+    current_ptr -> nx_packet_prepend_ptr += record_offset;
+    current_ptr -> nx_packet_length = record_length;
+
+    return(current_ptr);
+}
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
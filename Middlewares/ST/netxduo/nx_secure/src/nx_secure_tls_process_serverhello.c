@@ -32,7 +32,7 @@ extern const UCHAR _nx_secure_tls_hello_retry_request_random[32];
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_process_serverhello                  PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -78,6 +78,10 @@ extern const UCHAR _nx_secure_tls_hello_retry_request_random[32];
 /*                                            verified memcpy use cases,  */
 /*                                            fixed renegotiation bug,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), cleared  */
+/*                                            the TLS 1.3 PSK not         */
+/*                                            selected by the server,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_process_serverhello(NX_SECURE_TLS_SESSION *tls_session, UCHAR *packet_buffer,
@@ -207,6 +211,18 @@ NX_SECURE_TLS_SERVER_STATE            old_client_state = tls_session -> nx_secur
     }
     length++;
 
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+    /* A TLS 1.3 ServerHello selects a PSK only through its pre_shared_key extension, which sets the
+       client PSK again. A HelloRetryRequest keeps the offered ticket PSK for ClientHello2. */
+    if ((tls_session -> nx_secure_tls_1_3) &&
+        ((tls_session -> nx_secure_tls_client_state != NX_SECURE_TLS_CLIENT_STATE_HELLO_RETRY) ||
+         (old_client_state == NX_SECURE_TLS_CLIENT_STATE_HELLO_RETRY)))
+    {
+        tls_session -> nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_data_size = 0;
+        tls_session -> nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_resumption = NX_FALSE;
+    }
+#endif
+
     /* Padding data? */
     if (message_length >= (length + 2))
     {
@@ -56,7 +56,7 @@ static UINT _nx_secure_tls_proc_serverhello_ecjpake_key_kp_pair(NX_SECURE_TLS_SE
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_process_serverhello_extensions       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -102,6 +102,10 @@ static UINT _nx_secure_tls_proc_serverhello_ecjpake_key_kp_pair(NX_SECURE_TLS_SE
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            fixed renegotiation bug,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s),          */
+/*                                            processed the TLS 1.3       */
+/*                                            pre_shared_key extension,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_process_serverhello_extensions(NX_SECURE_TLS_SESSION *tls_session,
@@ -119,6 +123,13 @@ USHORT                                extension_id;
 USHORT                                extension_length;
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
 USHORT                                supported_version = tls_session -> nx_secure_tls_protocol_version;
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+USHORT                                selected_identity;
+UINT                                  ticket_count;
+NX_SECURE_TLS_PSK_STORE              *psk_entry;
+NX_SECURE_TLS_PSK_STORE              *client_psk;
+const NX_CRYPTO_METHOD               *binder_hash;
+#endif
 #endif
 
 #ifdef NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION
@@ -251,6 +262,70 @@ USHORT                                supported_version = tls_session -> nx_secu
             }
 
             break;
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+        case NX_SECURE_TLS_EXTENSION_PRE_SHARED_KEY:
+            extension_length = (USHORT)((packet_buffer[offset] << 8) + packet_buffer[offset + 1]);
+            offset += 2;
+
+            if ((extension_length + offset > message_length) || (extension_length < 2))
+            {
+                return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+            }
+
+            if (tls_session -> nx_secure_tls_1_3)
+            {
+
+                /* The selected identity indexes the ClientHello PSK list: an offered session
+                   ticket comes first, followed by the external PSKs. */
+                selected_identity = (USHORT)((packet_buffer[offset] << 8) + packet_buffer[offset + 1]);
+                ticket_count = (tls_session -> nx_secure_tls_ticket_offered != NX_NULL) ? 1 : 0;
+                client_psk = &tls_session -> nx_secure_tls_credentials.nx_secure_tls_client_psk;
+
+                if (selected_identity >= tls_session -> nx_secure_tls_credentials.nx_secure_tls_psk_count + ticket_count)
+                {
+                    return(NX_SECURE_TLS_NO_MATCHING_PSK);
+                }
+
+                /* Place the selected PSK in the client PSK for the key schedule. */
+                if (selected_identity < ticket_count)
+                {
+                    NX_SECURE_MEMCPY(client_psk -> nx_secure_tls_psk_data, tls_session -> nx_secure_tls_ticket_offered -> nx_secure_tls_ticket_psk,
+                                     tls_session -> nx_secure_tls_ticket_offered -> nx_secure_tls_ticket_psk_size); /* Use case of memcpy is verified. */
+                    client_psk -> nx_secure_tls_psk_data_size = tls_session -> nx_secure_tls_ticket_offered -> nx_secure_tls_ticket_psk_size;
+                    client_psk -> nx_secure_tls_psk_resumption = NX_TRUE;
+                }
+                else
+                {
+                    psk_entry = &tls_session -> nx_secure_tls_credentials.nx_secure_tls_psk_store[selected_identity - ticket_count];
+                    NX_SECURE_MEMCPY(client_psk -> nx_secure_tls_psk_data, psk_entry -> nx_secure_tls_psk_data,
+                                     psk_entry -> nx_secure_tls_psk_data_size); /* Use case of memcpy is verified. */
+                    client_psk -> nx_secure_tls_psk_data_size = psk_entry -> nx_secure_tls_psk_data_size;
+                    client_psk -> nx_secure_tls_psk_binder_ciphersuite = psk_entry -> nx_secure_tls_psk_binder_ciphersuite;
+                    client_psk -> nx_secure_tls_psk_resumption = NX_FALSE;
+                }
+
+                /* The server must select a ciphersuite with the hash the PSK binder was computed
+                   with (RFC 8446 4.2.11). PSKs without a binder ciphersuite use SHA-256. */
+                if (client_psk -> nx_secure_tls_psk_binder_ciphersuite != NX_NULL)
+                {
+                    binder_hash = client_psk -> nx_secure_tls_psk_binder_ciphersuite -> nx_secure_tls_hash;
+                }
+                else
+                {
+                    binder_hash = tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_sha256_method;
+                }
+
+                if ((tls_session -> nx_secure_tls_session_ciphersuite == NX_NULL) ||
+                    (binder_hash -> nx_crypto_algorithm !=
+                     tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_hash -> nx_crypto_algorithm))
+                {
+                    client_psk -> nx_secure_tls_psk_data_size = 0;
+                    return(NX_SECURE_TLS_BAD_SERVERHELLO_PSK_EXTENSION);
+                }
+            }
+
+            break;
+#endif /* NX_SECURE_ENABLE_PSK_CIPHERSUITES */
 #endif
 #ifdef NX_SECURE_ENABLE_ECJPAKE_CIPHERSUITE
         /* ECJPAKE ciphersuite extensions. */
@@ -358,6 +433,7 @@ USHORT                                supported_version = tls_session -> nx_secu
                 /* Server negotiates TLS 1.3 must set the legacy version to TLS 1.2. */
                 return(NX_SECURE_TLS_UNKNOWN_TLS_VERSION);
             }
+
         }
     }
 #endif
@@ -740,7 +816,7 @@ INT    compare_value;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_proc_serverhello_keyshare_extension  PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -777,6 +853,9 @@ INT    compare_value;
 /*  09-30-2020     Timothy Stapko           Modified comment(s), update   */
 /*                                            ECC find curve method,      */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), accepted */
+/*                                            X25519 key shares,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -871,7 +950,16 @@ NX_SECURE_TLS_ECC *ecc_info;
           so don't advance the offset! */
         legacy_form = packet_buffer[offset];
 
-        if(legacy_form != 0x4)
+        if (key_group == (USHORT)NX_CRYPTO_EC_X25519)
+        {
+
+            /* X25519 key shares are the raw 32-byte u-coordinate with no form byte (RFC 8446, section 4.2.8.2). */
+            if (key_length != 32)
+            {
+                return(NX_SECURE_TLS_BAD_SERVERHELLO_KEYSHARE);
+            }
+        }
+        else if(legacy_form != 0x4)
         {
             /* In TLS 1.3, the only valid form is 0x4. */
             return(NX_SECURE_TLS_BAD_SERVERHELLO_KEYSHARE);
@@ -38,6 +38,9 @@ static UINT _nx_secure_tls_record_packet_decrypt(NX_SECURE_TLS_SESSION *tls_sess
                                                  NX_PACKET *encrypted_packet, UINT offset, UINT message_length,
                                                  NX_PACKET *decrypted_packet, UINT *bytes_processed,
                                                  UINT wait_option);
+static UINT _nx_secure_tls_record_in_place_decrypt(NX_SECURE_TLS_SESSION *tls_session,
+                                                   const NX_CRYPTO_METHOD *session_cipher_method,
+                                                   NX_PACKET *packet_ptr, UINT offset, UINT message_length);
 static UINT _nx_secure_tls_data_decrypt(NX_SECURE_TLS_SESSION *tls_session,
                                         UCHAR *input, UCHAR *output, UINT length);
 
@@ -49,7 +52,7 @@ extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_S
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_record_payload_decrypt               PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -60,6 +63,12 @@ extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_S
 /*    the session keys generated and ciphersuite determined during the    */
 /*    TLS handshake.                                                      */
 /*                                                                        */
+/*    If *decrypted_packet points to encrypted_packet on entry, an AEAD   */
+/*    record is decrypted in place. The caller must own the whole chain;  */
+/*    on success the prepend pointer and length of encrypted_packet are   */
+/*    adjusted to cover the plaintext, which avoids allocating and        */
+/*    copying into a second packet.                                       */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           TLS control block             */
@@ -101,6 +110,10 @@ extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_S
 /*                                            verified memcpy use cases,  */
 /*                                            supported chained packet,   */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            ChaCha20-Poly1305 nonce and */
+/*                                            in-place AEAD decryption,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_record_payload_decrypt(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *encrypted_packet,
@@ -160,6 +173,7 @@ UCHAR                                 nonce[13];
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_12) ||
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_16) ||
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_GCM_16) ||
+        (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305) ||
         NX_SECURE_AEAD_CIPHER_CHECK(session_cipher_method -> nx_crypto_algorithm))
     {
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -228,6 +242,53 @@ UCHAR                                 nonce[13];
         }
         else
 #endif
+        if (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305)
+        {
+
+            /* ChaCha20-Poly1305 in TLS 1.2 (RFC 7905) has no explicit nonce. The 12-byte
+               client_write_IV or server_write_IV is XORed with the padded sequence number. */
+            icv_size = (session_cipher_method -> nx_crypto_ICV_size_in_bits >> 3);
+
+            if (message_length < icv_size)
+            {
+                return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
+            }
+
+            nonce[0] = 12;
+
+            /* Copy client_write_IV or server_write_IV.  */
+            NX_SECURE_MEMCPY(&nonce[1], iv, 12); /* Use case of memcpy is verified. */
+
+            nonce[5]  = (UCHAR)(nonce[5] ^ (sequence_num[1] >> 24));
+            nonce[6]  = (UCHAR)(nonce[6] ^ (sequence_num[1] >> 16));
+            nonce[7]  = (UCHAR)(nonce[7] ^ (sequence_num[1] >> 8));
+            nonce[8]  = (UCHAR)(nonce[8] ^ (sequence_num[1]));
+            nonce[9]  = (UCHAR)(nonce[9] ^ (sequence_num[0] >> 24));
+            nonce[10] = (UCHAR)(nonce[10] ^ (sequence_num[0] >> 16));
+            nonce[11] = (UCHAR)(nonce[11] ^ (sequence_num[0] >> 8));
+            nonce[12] = (UCHAR)(nonce[12] ^ (sequence_num[0]));
+
+            /*  additional_data = seq_num + TLSCompressed.type +
+                            TLSCompressed.version + TLSCompressed.length;
+             */
+            additional_data[0] = (UCHAR)(sequence_num[1] >> 24);
+            additional_data[1] = (UCHAR)(sequence_num[1] >> 16);
+            additional_data[2] = (UCHAR)(sequence_num[1] >> 8);
+            additional_data[3] = (UCHAR)(sequence_num[1]);
+            additional_data[4] = (UCHAR)(sequence_num[0] >> 24);
+            additional_data[5] = (UCHAR)(sequence_num[0] >> 16);
+            additional_data[6] = (UCHAR)(sequence_num[0] >> 8);
+            additional_data[7] = (UCHAR)(sequence_num[0]);
+            additional_data[8]  = record_type;
+            additional_data[9]  = (UCHAR)(tls_session -> nx_secure_tls_protocol_version >> 8);
+            additional_data[10] = (UCHAR)(tls_session -> nx_secure_tls_protocol_version);
+            additional_data[11] = (UCHAR)((message_length - icv_size) >> 8);
+            additional_data[12] = (UCHAR)(message_length - icv_size);
+
+            /* We have 13 bytes of additional data (8 bytes seq num + 5 bytes header). */
+            additional_data_size = 13;
+        }
+        else
         {
             /* AEAD ciphers structure:
                  struct {
@@ -486,7 +547,7 @@ UCHAR                                 nonce[13];
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_record_chained_packet_decrypt        PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -495,7 +556,8 @@ UCHAR                                 nonce[13];
 /*                                                                        */
 /*    This function decrypts the payload of an incoming TLS record in     */
 /*    chained packet using the session keys generated and ciphersuite     */
-/*    determined during the TLS handshake.                                */
+/*    determined during the TLS handshake. When *decrypted_packet is      */
+/*    encrypted_packet, the payload is decrypted in place.                */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -521,6 +583,9 @@ UCHAR                                 nonce[13];
 /*                                                                        */
 /*    [nx_crypto_operation]                 Crypto operation              */
 /*    _nx_secure_tls_record_packet_decrypt  Decrypt packet in one packet  */
+/*    _nx_secure_tls_record_in_place_decrypt                              */
+/*                                          Decrypt chained packet in     */
+/*                                            place                       */
 /*    nx_secure_tls_packet_release          Release packet                */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -532,6 +597,9 @@ UCHAR                                 nonce[13];
 /*    DATE              NAME                      DESCRIPTION             */
 /*                                                                        */
 /*  09-30-2020     Timothy Stapko           Initial Version 6.1           */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            in-place decryption,        */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_secure_tls_record_chained_packet_decrypt(NX_SECURE_TLS_SESSION *tls_session,
@@ -547,6 +615,8 @@ UINT bytes_processed;
 ULONG bytes_copied;
 NX_PACKET *packet_ptr;
 UINT icv_offset = offset;
+UINT plaintext_length = 0;
+NX_PACKET *current_packet;
 VOID *handler = NX_NULL;
 VOID *crypto_method_metadata;
 const NX_CRYPTO_METHOD *session_cipher_method;
@@ -603,13 +673,31 @@ const NX_CRYPTO_METHOD *session_cipher_method;
         }
     }
 
-    /* Allocate another packet for decryption. */
-    status = nx_packet_allocate(tls_session -> nx_secure_tls_packet_pool, &packet_ptr, 0, wait_option);
-    if (status)
+    if (*decrypted_packet == encrypted_packet)
+    {
+
+        /* The caller owns the chain, so decrypt the payload where it is. */
+        packet_ptr = encrypted_packet;
+        status = _nx_secure_tls_record_in_place_decrypt(tls_session, session_cipher_method, packet_ptr,
+                                                        offset, message_length);
+        if (status)
+        {
+            return(status);
+        }
+        plaintext_length = message_length;
+        message_length = 0;
+    }
+    else
     {
-        return(status);
+
+        /* Allocate another packet for decryption. */
+        status = nx_packet_allocate(tls_session -> nx_secure_tls_packet_pool, &packet_ptr, 0, wait_option);
+        if (status)
+        {
+            return(status);
+        }
+        packet_ptr -> nx_packet_last = packet_ptr;
     }
-    packet_ptr -> nx_packet_last = packet_ptr;
 
     /* Loop to decrypt data in chained packet. */
     while (message_length > 0)
@@ -650,7 +738,10 @@ const NX_CRYPTO_METHOD *session_cipher_method;
                                                icv_ptr, icv_size, &bytes_copied);
         if (status || (bytes_copied != icv_size))
         {
-            nx_secure_tls_packet_release(packet_ptr);
+            if (packet_ptr != encrypted_packet)
+            {
+                nx_secure_tls_packet_release(packet_ptr);
+            }
             return(status);
         }
     }
@@ -670,7 +761,10 @@ const NX_CRYPTO_METHOD *session_cipher_method;
 
     if (status)
     {
-        nx_secure_tls_packet_release(packet_ptr);
+        if (packet_ptr != encrypted_packet)
+        {
+            nx_secure_tls_packet_release(packet_ptr);
+        }
         if (status == NX_CRYPTO_AUTHENTICATION_FAILED)
         {
             return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
@@ -681,6 +775,25 @@ const NX_CRYPTO_METHOD *session_cipher_method;
         }
     }
 
+    if (packet_ptr == encrypted_packet)
+    {
+
+        /* Skip the data ahead of the plaintext. A packet emptied here stays in the chain. */
+        for (current_packet = packet_ptr; offset > 0; current_packet = current_packet -> nx_packet_next)
+        {
+            bytes_processed = (UINT)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
+            if (bytes_processed > offset)
+            {
+                bytes_processed = offset;
+            }
+            current_packet -> nx_packet_prepend_ptr += bytes_processed;
+            offset -= bytes_processed;
+        }
+
+        /* Drop the ICV from the length. It is trimmed off by the caller. */
+        packet_ptr -> nx_packet_length = plaintext_length;
+    }
+
     *decrypted_packet = packet_ptr;
     return(NX_SECURE_TLS_SUCCESS);
 }
@@ -912,6 +1025,177 @@ UINT original_offset = offset;
     return(NX_SECURE_TLS_SUCCESS);
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_in_place_decrypt              PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function decrypts the payload of an incoming TLS record in     */
+/*    place across a packet chain. Blocks that straddle two packets are   */
+/*    decrypted through the record block buffer and copied back.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    session_cipher_method                 Pointer to cipher method      */
+/*    packet_ptr                            Pointer to packet containing  */
+/*                                            encrypted data              */
+/*    offset                                Offset of message data in     */
+/*                                            packet_ptr                  */
+/*    message_length                        Length of message data in     */
+/*                                            packet_ptr                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_data_decrypt           Decrypt data                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_record_chained_packet_decrypt                        */
+/*                                          Decrypt chained packet        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_tls_record_in_place_decrypt(NX_SECURE_TLS_SESSION *tls_session,
+                                                   const NX_CRYPTO_METHOD *session_cipher_method,
+                                                   NX_PACKET *packet_ptr, UINT offset, UINT message_length)
+{
+UINT status = NX_SECURE_TLS_SUCCESS;
+UINT block_size;
+UINT length;
+UINT available_length;
+UINT copy_length;
+UINT block_offset;
+NX_PACKET *current_packet;
+
+    /* block_size must be no larger than NX_SECURE_TLS_MAX_CIPHER_BLOCK_SIZE. */
+    block_size = session_cipher_method -> nx_crypto_block_size_in_bytes;
+    NX_ASSERT(block_size <= sizeof(_nx_secure_tls_record_block_buffer));
+
+    /* Locate input data. */
+    while (offset >= (UINT)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr))
+    {
+        offset -= (UINT)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr);
+        packet_ptr = packet_ptr -> nx_packet_next;
+        if (packet_ptr == NX_NULL)
+        {
+            return(NX_SECURE_TLS_INVALID_PACKET);
+        }
+    }
+
+    while (message_length > 0)
+    {
+        available_length = (UINT)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr) - offset;
+
+        if ((available_length >= message_length) || (available_length >= block_size))
+        {
+
+            /* Decrypt whole blocks, or the tail of the message, directly in the packet. */
+            if (available_length >= message_length)
+            {
+                length = message_length;
+            }
+            else if (block_size)
+            {
+                length = available_length - (available_length % block_size);
+            }
+            else
+            {
+                length = available_length;
+            }
+
+            status = _nx_secure_tls_data_decrypt(tls_session, packet_ptr -> nx_packet_prepend_ptr + offset,
+                                                 packet_ptr -> nx_packet_prepend_ptr + offset, length);
+            if (status)
+            {
+                break;
+            }
+
+            offset += length;
+            message_length -= length;
+        }
+        else
+        {
+
+            /* The next block straddles packets. Gather it into the block buffer. */
+            length = (message_length < block_size) ? message_length : block_size;
+            current_packet = packet_ptr;
+            block_offset = offset;
+            for (copy_length = 0; copy_length < length; copy_length += available_length)
+            {
+                available_length = (UINT)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr) - block_offset;
+                if (available_length > (length - copy_length))
+                {
+                    available_length = length - copy_length;
+                }
+                NX_SECURE_MEMCPY(&_nx_secure_tls_record_block_buffer[copy_length],
+                                 current_packet -> nx_packet_prepend_ptr + block_offset,
+                                 available_length); /* Use case of memcpy is verified. */
+                block_offset = 0;
+                current_packet = current_packet -> nx_packet_next;
+            }
+
+            status = _nx_secure_tls_data_decrypt(tls_session, _nx_secure_tls_record_block_buffer,
+                                                 _nx_secure_tls_record_block_buffer, length);
+            if (status)
+            {
+                break;
+            }
+
+            /* Scatter the plaintext back, leaving packet_ptr and offset after the block. */
+            for (copy_length = 0; copy_length < length; copy_length += available_length)
+            {
+                available_length = (UINT)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr) - offset;
+                if (available_length > (length - copy_length))
+                {
+                    available_length = length - copy_length;
+                }
+                NX_SECURE_MEMCPY(packet_ptr -> nx_packet_prepend_ptr + offset,
+                                 &_nx_secure_tls_record_block_buffer[copy_length],
+                                 available_length); /* Use case of memcpy is verified. */
+                offset += available_length;
+                if ((packet_ptr -> nx_packet_prepend_ptr + offset) == packet_ptr -> nx_packet_append_ptr)
+                {
+                    packet_ptr = packet_ptr -> nx_packet_next;
+                    offset = 0;
+                }
+            }
+            message_length -= length;
+            continue;
+        }
+
+        if ((message_length > 0) && ((packet_ptr -> nx_packet_prepend_ptr + offset) == packet_ptr -> nx_packet_append_ptr))
+        {
+
+            /* Move to the next packet. */
+            packet_ptr = packet_ptr -> nx_packet_next;
+            offset = 0;
+        }
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_SECURE_MEMSET(_nx_secure_tls_record_block_buffer, 0, sizeof(_nx_secure_tls_record_block_buffer));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(status);
+}
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
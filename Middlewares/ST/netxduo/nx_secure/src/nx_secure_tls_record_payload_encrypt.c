@@ -36,7 +36,7 @@ UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_SIZE];
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_record_payload_encrypt               PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -77,6 +77,10 @@ UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_SIZE];
 /*                                            fixed data copy in chained  */
 /*                                            packet,                     */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), wrote    */
+/*                                            AEAD tag into packet tail   */
+/*                                            room,                       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_record_payload_encrypt(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet,
@@ -96,6 +100,10 @@ ULONG                                 remainder_length;
 UINT                                  data_offset = 0;
 VOID                                 *handler = NX_NULL;
 VOID                                 *crypto_method_metadata;
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+UCHAR                                *icv_ptr;
+UINT                                  icv_size;
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
 
     if (tls_session -> nx_secure_tls_session_ciphersuite == NX_NULL)
     {
@@ -329,6 +337,18 @@ VOID                                 *crypto_method_metadata;
             return(NX_SIZE_ERROR);
         }
 
+        /* Write the TAG straight into the last packet when it has room for it. */
+        icv_size = session_cipher_method -> nx_crypto_ICV_size_in_bits >> 3;
+        current_packet = (send_packet -> nx_packet_next) ? send_packet -> nx_packet_last : send_packet;
+        if ((ULONG)(current_packet -> nx_packet_data_end - current_packet -> nx_packet_append_ptr) >= icv_size)
+        {
+            icv_ptr = current_packet -> nx_packet_append_ptr;
+        }
+        else
+        {
+            icv_ptr = _nx_secure_tls_record_block_buffer;
+        }
+
         /* Get TAG.  */
         status = session_cipher_method -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_CALCULATE,
                                                               handler,
@@ -338,8 +358,8 @@ VOID                                 *crypto_method_metadata;
                                                               NX_NULL,
                                                               0,
                                                               NX_NULL,
-                                                              _nx_secure_tls_record_block_buffer,
-                                                              (session_cipher_method -> nx_crypto_ICV_size_in_bits >> 3),
+                                                              icv_ptr,
+                                                              icv_size,
                                                               crypto_method_metadata,
                                                               tls_session -> nx_secure_session_cipher_metadata_size,
                                                               NX_NULL, NX_NULL);
@@ -348,12 +368,19 @@ VOID                                 *crypto_method_metadata;
             return(status);
         }
 
-        status = nx_packet_data_append(send_packet, _nx_secure_tls_record_block_buffer,
-                                       (session_cipher_method -> nx_crypto_ICV_size_in_bits >> 3),
-                                       tls_session -> nx_secure_tls_packet_pool, NX_WAIT_FOREVER);
-        if (status)
+        if (icv_ptr == _nx_secure_tls_record_block_buffer)
         {
-            return(status);
+            status = nx_packet_data_append(send_packet, _nx_secure_tls_record_block_buffer, icv_size,
+                                           tls_session -> nx_secure_tls_packet_pool, NX_WAIT_FOREVER);
+            if (status)
+            {
+                return(status);
+            }
+        }
+        else
+        {
+            current_packet -> nx_packet_append_ptr += icv_size;
+            send_packet -> nx_packet_length += icv_size;
         }
     }
 #endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
@@ -366,7 +393,7 @@ VOID                                 *crypto_method_metadata;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_record_data_encrypt_init             PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -405,6 +432,9 @@ VOID                                 *crypto_method_metadata;
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            ChaCha20-Poly1305 nonce,    */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 static UINT _nx_secure_tls_record_data_encrypt_init(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet,
@@ -461,6 +491,7 @@ UINT                                  message_length;
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_12) ||
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_16) ||
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_GCM_16) ||
+        (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305) ||
         NX_SECURE_AEAD_CIPHER_CHECK(session_cipher_method -> nx_crypto_algorithm))
     {
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -530,6 +561,48 @@ UINT                                  message_length;
         }
         else
 #endif
+        if (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305)
+        {
+
+            /* ChaCha20-Poly1305 in TLS 1.2 (RFC 7905) has no explicit nonce. The 12-byte
+               client_write_IV or server_write_IV is XORed with the padded sequence number
+               as in TLS 1.3, and the record carries only the ciphertext and the tag.  */
+            nonce[0] = 12;
+
+            /* Copy client_write_IV or server_write_IV.  */
+            NX_SECURE_MEMCPY(&nonce[1], iv, 12); /* Use case of memcpy is verified. */
+
+            nonce[5]  = (UCHAR)(nonce[5] ^ (sequence_num[1] >> 24));
+            nonce[6]  = (UCHAR)(nonce[6] ^ (sequence_num[1] >> 16));
+            nonce[7]  = (UCHAR)(nonce[7] ^ (sequence_num[1] >> 8));
+            nonce[8]  = (UCHAR)(nonce[8] ^ (sequence_num[1]));
+            nonce[9]  = (UCHAR)(nonce[9] ^ (sequence_num[0] >> 24));
+            nonce[10] = (UCHAR)(nonce[10] ^ (sequence_num[0] >> 16));
+            nonce[11] = (UCHAR)(nonce[11] ^ (sequence_num[0] >> 8));
+            nonce[12] = (UCHAR)(nonce[12] ^ (sequence_num[0]));
+
+            /*  additional_data = seq_num + TLSCompressed.type +
+                            TLSCompressed.version + TLSCompressed.length;
+             */
+            message_length = send_packet -> nx_packet_length;
+            additional_data[0] = (UCHAR)(sequence_num[1] >> 24);
+            additional_data[1] = (UCHAR)(sequence_num[1] >> 16);
+            additional_data[2] = (UCHAR)(sequence_num[1] >> 8);
+            additional_data[3] = (UCHAR)(sequence_num[1]);
+            additional_data[4] = (UCHAR)(sequence_num[0] >> 24);
+            additional_data[5] = (UCHAR)(sequence_num[0] >> 16);
+            additional_data[6] = (UCHAR)(sequence_num[0] >> 8);
+            additional_data[7] = (UCHAR)(sequence_num[0]);
+            additional_data[8]  = record_type;
+            additional_data[9]  = (UCHAR)(tls_session -> nx_secure_tls_protocol_version >> 8);
+            additional_data[10] = (UCHAR)(tls_session -> nx_secure_tls_protocol_version);
+            additional_data[11] = (UCHAR)(message_length >> 8);
+            additional_data[12] = (UCHAR)(message_length);
+
+            /* We have 13 bytes of additional data (8 bytes seq num + 5 bytes header). */
+            additional_data_size = 13;
+        }
+        else
         {
 
             /* AEAD ciphers structure:
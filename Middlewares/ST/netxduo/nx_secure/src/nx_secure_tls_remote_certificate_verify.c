@@ -30,7 +30,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_remote_certificate_verify            PORTABLE C      */
-/*                                                           6.1.6        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -77,6 +77,9 @@
 /*  04-02-2021     Timothy Stapko           Modified comment(s),          */
 /*                                            updated X.509 return value, */
 /*                                            resulting in version 6.1.6  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), set      */
+/*                                            verify cache time,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_remote_certificate_verify(NX_SECURE_TLS_SESSION *tls_session)
@@ -129,6 +132,14 @@ ULONG                             current_time;
         }
     }
 
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+    /* Let the verify cache drop entries for certificates that have expired since they were cached. */
+    if (store -> nx_secure_x509_verify_cache != NX_NULL)
+    {
+        store -> nx_secure_x509_verify_cache -> nx_secure_x509_verify_cache_current_time = current_time;
+    }
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
+
     /* Now verify our remote certificate chain. If the certificate can be linked to an issuer in the trusted store
        through an issuer chain, this function will return NX_SUCCESS. */
     status = _nx_secure_x509_certificate_chain_verify(store, remote_certificate);
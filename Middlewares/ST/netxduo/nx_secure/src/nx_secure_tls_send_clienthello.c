@@ -38,7 +38,7 @@ UINT _nx_secure_tls_send_clienthello_psk_extension(NX_SECURE_TLS_SESSION *tls_se
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_send_clienthello                     PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -59,11 +59,13 @@ UINT _nx_secure_tls_send_clienthello_psk_extension(NX_SECURE_TLS_SESSION *tls_se
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_secure_tls_ciphersuite_lookup     Get cipher information        */
 /*    _nx_secure_tls_handshake_hash_init    Initialize the finished hash  */
 /*    _nx_secure_tls_newest_supported_version                             */
 /*                                          Get the version of TLS to use */
 /*    _nx_secure_tls_send_clienthello_extensions                          */
 /*                                          Send TLS ClientHello extension*/
+/*    _nx_secure_tls_ticket_cache_find      Find cached session ticket    */
 /*    [nx_secure_tls_session_time_function] Get the current time for the  */
 /*                                            TLS timestamp               */
 /*                                                                        */
@@ -81,6 +83,9 @@ UINT _nx_secure_tls_send_clienthello_psk_extension(NX_SECURE_TLS_SESSION *tls_se
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), offered  */
+/*                                            cached session tickets,     */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_send_clienthello(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet)
@@ -100,6 +105,15 @@ UINT                        status;
 UINT                        fallback_enabled = NX_FALSE;
 const NX_SECURE_TLS_CRYPTO *crypto_table;
 ULONG                      extension_length, total_extensions_length;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+UINT                        psk_count;
+#endif
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+NX_SECURE_TLS_TICKET       *ticket;
+NX_SECURE_TLS_PSK_STORE    *client_psk;
+const NX_SECURE_TLS_CIPHERSUITE_INFO *ticket_ciphersuite;
+USHORT                      ticket_priority;
+#endif
 
 
     /* ClientHello structure:
@@ -278,6 +292,33 @@ ULONG                      extension_length, total_extensions_length;
     packet_buffer[length] = 0x0;
     length++;
 
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+    /* Offer a session ticket cached for this server as a resumption PSK. The ticket PSK is placed in the client
+       PSK so it is used for the binder and, if the server selects it, for the key schedule. ClientHello2 offers
+       the same ticket as ClientHello1. */
+    if (tls_session -> nx_secure_tls_1_3 && (tls_session -> nx_secure_tls_client_state != NX_SECURE_TLS_CLIENT_STATE_HELLO_RETRY))
+    {
+        tls_session -> nx_secure_tls_ticket_offered = NX_NULL;
+
+        /* Binders are computed over the SHA-256 ClientHello transcript, so only tickets from
+           connections with a SHA-256 ciphersuite can be offered. */
+        if ((_nx_secure_tls_ticket_cache_find(tls_session, &ticket) == NX_SUCCESS) &&
+            (_nx_secure_tls_ciphersuite_lookup(tls_session, ticket -> nx_secure_tls_ticket_ciphersuite,
+                                               &ticket_ciphersuite, &ticket_priority) == NX_SUCCESS) &&
+            (ticket_ciphersuite -> nx_secure_tls_hash -> nx_crypto_algorithm == NX_CRYPTO_HASH_SHA256) &&
+            (ticket -> nx_secure_tls_ticket_psk_size <= sizeof(tls_session -> nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_data)))
+        {
+            client_psk = &tls_session -> nx_secure_tls_credentials.nx_secure_tls_client_psk;
+            NX_SECURE_MEMCPY(client_psk -> nx_secure_tls_psk_data, ticket -> nx_secure_tls_ticket_psk,
+                             ticket -> nx_secure_tls_ticket_psk_size); /* Use case of memcpy is verified. */
+            client_psk -> nx_secure_tls_psk_data_size = ticket -> nx_secure_tls_ticket_psk_size;
+            client_psk -> nx_secure_tls_psk_binder_ciphersuite = ticket_ciphersuite;
+            client_psk -> nx_secure_tls_psk_resumption = NX_TRUE;
+            tls_session -> nx_secure_tls_ticket_offered = ticket;
+        }
+    }
+#endif
+
     /* ============ TLS ClientHello extensions. ============= */
 
     /* Save an offset to the beginning of the extensions so we can fill in the length
@@ -300,8 +341,16 @@ ULONG                      extension_length, total_extensions_length;
 
     /* !!! NOTE !!! The TLS 1.3 PSK extension MUST be the LAST extension in the ClientHello! (RFC 8446, Section 4.2.11) */
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    psk_count = tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count;
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+    if (tls_session -> nx_secure_tls_ticket_offered != NX_NULL)
+    {
+        psk_count++;
+    }
+#endif
+
     /* Send TLS 1.3 PSK extension, but only if there is a PSK to send. */
-    if(tls_session->nx_secure_tls_1_3 && tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count > 0)
+    if(tls_session->nx_secure_tls_1_3 && psk_count > 0)
     {
         status = _nx_secure_tls_send_clienthello_psk_extension(tls_session, packet_buffer, &length, 
                                                                extension_offset, total_extensions_length,
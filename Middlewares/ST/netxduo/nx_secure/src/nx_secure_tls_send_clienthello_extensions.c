@@ -82,7 +82,7 @@ static UINT _nx_secure_tls_send_clienthello_sec_reneg_extension(NX_SECURE_TLS_SE
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_send_clienthello_extensions          PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -131,6 +131,10 @@ static UINT _nx_secure_tls_send_clienthello_sec_reneg_extension(NX_SECURE_TLS_SE
 /*                                            verified memcpy use cases,  */
 /*                                            fixed renegotiation bug,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), sent     */
+/*                                            psk_key_exchange_modes when */
+/*                                            offering a session ticket,  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_send_clienthello_extensions(NX_SECURE_TLS_SESSION *tls_session,
@@ -140,6 +144,9 @@ UINT _nx_secure_tls_send_clienthello_extensions(NX_SECURE_TLS_SESSION *tls_sessi
 ULONG  length = *packet_offset;
 USHORT extension_length = 0, total_extensions_length;
 UINT   status;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+UINT   psk_count;
+#endif
 
     total_extensions_length = 0;
 
@@ -244,7 +251,15 @@ UINT   status;
 #endif
 
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
-    if(tls_session->nx_secure_tls_1_3 && tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count > 0)
+    psk_count = tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count;
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+    if (tls_session -> nx_secure_tls_ticket_offered != NX_NULL)
+    {
+        psk_count++;
+    }
+#endif
+
+    if(tls_session->nx_secure_tls_1_3 && psk_count > 0)
     {
         status = _nx_secure_tls_send_clienthello_psk_kem_extension(tls_session, packet_buffer, &length, &extension_length);
         if (status != NX_SUCCESS)
@@ -826,7 +841,7 @@ USHORT named_curve;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_send_clienthello_psk_extension       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -865,6 +880,11 @@ USHORT named_curve;
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), offered  */
+/*                                            session tickets, computed   */
+/*                                            the binder list length from */
+/*                                            the PSK hashes,             */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -891,7 +911,13 @@ UINT   binder_offset;
 UINT   binder_total;
 UINT   status;
 UINT   partial_client_hello_len;
+UINT   ticket_count = 0;
 NX_SECURE_TLS_PSK_STORE *psk_store;
+NX_SECURE_TLS_PSK_STORE *psk_entry;
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+NX_SECURE_TLS_TICKET    *ticket;
+ULONG  elapsed;
+#endif
 
 
     /* Key Share Extension structure (From TLS 1.3 RFC 8446):
@@ -978,12 +1004,41 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
     ids_total = 0;
     binder_total = 0;
 
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+    /* A session ticket is offered as the first identity, ahead of the external PSKs. Its PSK
+       was placed in the client PSK entry when the ticket was chosen. */
+    ticket = tls_session -> nx_secure_tls_ticket_offered;
+    if (ticket != NX_NULL)
+    {
+        ticket_count = 1;
+    }
+#endif
+    num_ids += ticket_count;
+
     /* Loop through all IDs. */
     for(i = 0; i < num_ids; ++i)
     {
         /* Setup the ID list. */
-        id_len = psk_store[i].nx_secure_tls_psk_id_size;
-        id = psk_store[i].nx_secure_tls_psk_id;
+        psk_entry = (i < ticket_count) ? &tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk : &psk_store[i - ticket_count];
+        id_len = psk_entry -> nx_secure_tls_psk_id_size;
+        id = psk_entry -> nx_secure_tls_psk_id;
+
+        /* Set the obfuscated PSK age - 0 for external PSKs. */
+        age = 0;
+
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+        if (i < ticket_count)
+        {
+
+            /* The ticket is the identity. The age is the time since the ticket was received in
+               milliseconds, obfuscated by adding the ticket_age_add value from the server. */
+            id_len = ticket -> nx_secure_tls_ticket_size;
+            id = ticket -> nx_secure_tls_ticket_data;
+            elapsed = tx_time_get() - ticket -> nx_secure_tls_ticket_received;
+            age = (UINT)((elapsed / NX_IP_PERIODIC_RATE) * 1000 + ((elapsed % NX_IP_PERIODIC_RATE) * 1000) / NX_IP_PERIODIC_RATE +
+                         ticket -> nx_secure_tls_ticket_age_add);
+        }
+#endif
 
         if (available_size < (offset + 6u + id_len))
         {
@@ -1000,8 +1055,6 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
         NX_SECURE_MEMCPY(&packet_buffer[offset], id, id_len); /* Use case of memcpy is verified. */
         offset += (UINT)(id_len);
 
-        /* Set the obfuscated PSK age. */
-        age = 0;
         packet_buffer[offset]     = (UCHAR)((age & 0xFF000000) >> 24);
         packet_buffer[offset + 1] = (UCHAR)((age & 0x00FF0000) >> 16);
         packet_buffer[offset + 2] = (UCHAR)((age & 0x0000FF00) >> 8);
@@ -1011,8 +1064,17 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
         /* Update the length with the ID length (id_len), length field (2), and age field (4). */
         ids_total = ids_total + (UINT)(id_len + 2 + 4);
         
-        /* Caclulate the length of the binder list - binder for each PSK + the length field. */
-        binder_total += (UINT)(1 + binder_len);        
+        /* Caclulate the length of the binder list - binder for each PSK + the length field. The binder is
+           the size of the PSK hash, SHA-256 unless a ciphersuite is associated with the PSK. */
+        if (psk_entry -> nx_secure_tls_psk_binder_ciphersuite != NX_NULL)
+        {
+            binder_len = psk_entry -> nx_secure_tls_psk_binder_ciphersuite -> nx_secure_tls_hash_size;
+        }
+        else
+        {
+            binder_len = (tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_sha256_method -> nx_crypto_ICV_size_in_bits >> 3);
+        }
+        binder_total += (UINT)(1 + binder_len);
     }
 
     /* Put the list length into the packet - the list length is the 16-bit field following the total length field (16-bits). */
@@ -1026,9 +1088,7 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
     
     /* Update the total length of the extension with the anticipated size of the binders - this is used in generating
        the binder hashes. */
-//    printf(">>>Binder list length: %d\n", binder_total);
-    binder_total = 33;
-    data_length += binder_total; 
+    data_length += binder_total;
 
     /* Extension length. */
     packet_buffer[length_offset] =     (UCHAR)((data_length & 0xFF00) >> 8);
@@ -1103,7 +1163,12 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
     /* Loop through all IDs and set the binders accordingly. */
     for(i = 0; i < num_ids; ++i)
     {
-        _nx_secure_tls_psk_binder_generate(tls_session, &psk_store[i]);
+        psk_entry = (i < ticket_count) ? &tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk : &psk_store[i - ticket_count];
+        status = _nx_secure_tls_psk_binder_generate(tls_session, psk_entry);
+        if (status != NX_SUCCESS)
+        {
+            return(status);
+        }
     }
 
     if (available_size < (offset + 2u))
@@ -1121,8 +1186,9 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
     num_binders = num_ids;
     for(i = 0; i < num_binders; ++i)
     {
-        binder_len = psk_store[i].nx_secure_tls_psk_binder_size;
-        binder = psk_store[i].nx_secure_tls_psk_binder;
+        psk_entry = (i < ticket_count) ? &tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk : &psk_store[i - ticket_count];
+        binder_len = psk_entry -> nx_secure_tls_psk_binder_size;
+        binder = psk_entry -> nx_secure_tls_psk_binder;
 
         if (available_size < (offset + 1u + binder_len))
         {
@@ -29,7 +29,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_send_newsessionticket                PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -39,7 +39,8 @@
 /*    This function generates a NewSessionTicket message for a TLS Server.*/
 /*    The message contains data used to generate a PSK that can be used   */
 /*    for session resumption should the same client attempt another       */
-/*    connection within the lifespan of the ticket.                       */
+/*    connection within the lifespan of the ticket. The ticket carries    */
+/*    the resumption state, protected with the server ticket key.         */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -53,6 +54,9 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    NX_RAND                               Generate ticket data          */
+/*    _nx_secure_tls_1_3_session_psk_generate                             */
+/*                                          Generate resumption PSK       */
+/*    _nx_secure_tls_ticket_encrypt         Protect ticket state          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -66,21 +70,28 @@
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            verified memcpy use cases,  */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), issued   */
+/*                                            protected session tickets,  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
-#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
 UINT _nx_secure_tls_send_newsessionticket(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet)
 {
-UINT             status = NX_SUCCESS;
+UINT             status;
 UINT             length;
-UINT             lifetime;
-UINT             age_add;
+ULONG            lifetime;
+ULONG            age_add;
+ULONG            issue_time;
 UINT             nonce;
 UINT             nonce_len;
+UINT             psk_length;
 UINT             ticket_len;
-UCHAR            *ticket;
 UINT             extensions_len;
-UCHAR            *packet_buffer;
+UINT             available_size;
+USHORT           ciphersuite;
+UCHAR           *packet_buffer;
+UCHAR            state[NX_SECURE_TLS_TICKET_STATE_SIZE + NX_SECURE_TLS_MAX_PSK_SIZE];
 
     /* From RFC 8446:
        struct {
@@ -145,9 +156,13 @@ UCHAR            *packet_buffer;
 
     */
 
-     NX_PARAMETER_NOT_USED(tls_session);
+    if ((tls_session -> nx_secure_tls_ticket_keys == NX_NULL) || (tls_session -> nx_secure_tls_session_ciphersuite == NX_NULL))
+    {
+        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+    }
 
-    if (((ULONG)(send_packet -> nx_packet_data_end) - (ULONG)(send_packet -> nx_packet_append_ptr)) < 13u)
+    available_size = (UINT)((ULONG)(send_packet -> nx_packet_data_end) - (ULONG)(send_packet -> nx_packet_append_ptr));
+    if (available_size < 17u)
     {
 
         /* Packet buffer too small. */
@@ -157,8 +172,8 @@ UCHAR            *packet_buffer;
     length = 0;
     packet_buffer = send_packet -> nx_packet_append_ptr;
 
-    /* First, the ticket lifetime in ms - 604800 is the maximum. */
-    lifetime = 604800;
+    /* First, the ticket lifetime in seconds - 604800 is the maximum. */
+    lifetime = tls_session -> nx_secure_tls_ticket_keys -> nx_secure_tls_ticket_lifetime;
     packet_buffer[length]     = (UCHAR)((lifetime & 0xFF000000) >> 24);
     packet_buffer[length + 1] = (UCHAR)((lifetime & 0x00FF0000) >> 16);
     packet_buffer[length + 2] = (UCHAR)((lifetime & 0x0000FF00) >> 8);
@@ -166,7 +181,7 @@ UCHAR            *packet_buffer;
     length += 4;
 
     /* The age_add is a cryptographically secure random 32-bit number. */
-    age_add = (UINT)NX_RAND();
+    age_add = (ULONG)NX_RAND();
     packet_buffer[length]     = (UCHAR)((age_add & 0xFF000000) >> 24);
     packet_buffer[length + 1] = (UCHAR)((age_add & 0x00FF0000) >> 16);
     packet_buffer[length + 2] = (UCHAR)((age_add & 0x0000FF00) >> 8);
@@ -187,41 +202,65 @@ UCHAR            *packet_buffer;
     packet_buffer[length + 1] = (UCHAR)((nonce & 0x00FF0000) >> 16);
     packet_buffer[length + 2] = (UCHAR)((nonce & 0x0000FF00) >> 8);
     packet_buffer[length + 3] = (UCHAR) (nonce & 0x000000FF);
-    length += nonce_len;
 
-
-    /* Now for the ticket ID itself. 16-bit length with the ticket being a label
-       used as the PSK identity. */
-    ticket =  (UCHAR *)("NewSessionTicket");
-    ticket_len = sizeof("NewSessionTicket");
-
-    if (((ULONG)(send_packet -> nx_packet_data_end) - (ULONG)(send_packet -> nx_packet_append_ptr)) < (17u + ticket_len))
+    /* The ticket holds everything needed to resume, so the server keeps no state per client:
+       | 2 ciphersuite | 4 issue time (ticks) | 4 lifetime | 4 age_add | 1 psk_len | <psk_len> PSK | */
+    status = _nx_secure_tls_1_3_session_psk_generate(tls_session, &packet_buffer[length], nonce_len,
+                                                     &state[NX_SECURE_TLS_TICKET_STATE_SIZE],
+                                                     sizeof(state) - NX_SECURE_TLS_TICKET_STATE_SIZE, &psk_length);
+    length += nonce_len;
+    if (status != NX_SUCCESS)
     {
+        return(status);
+    }
 
-        /* Packet buffer too small. */
-        return(NX_SECURE_TLS_PACKET_BUFFER_TOO_SMALL);
+    ciphersuite = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_ciphersuite;
+    issue_time = tx_time_get();
+    state[0]  = (UCHAR)(ciphersuite >> 8);
+    state[1]  = (UCHAR)(ciphersuite);
+    state[2]  = (UCHAR)(issue_time >> 24);
+    state[3]  = (UCHAR)(issue_time >> 16);
+    state[4]  = (UCHAR)(issue_time >> 8);
+    state[5]  = (UCHAR)(issue_time);
+    state[6]  = (UCHAR)(lifetime >> 24);
+    state[7]  = (UCHAR)(lifetime >> 16);
+    state[8]  = (UCHAR)(lifetime >> 8);
+    state[9]  = (UCHAR)(lifetime);
+    state[10] = (UCHAR)(age_add >> 24);
+    state[11] = (UCHAR)(age_add >> 16);
+    state[12] = (UCHAR)(age_add >> 8);
+    state[13] = (UCHAR)(age_add);
+    state[14] = (UCHAR)psk_length;
+
+    /* Now for the ticket itself. 16-bit length with the encrypted state being the
+       PSK identity, leaving room for the extensions length. */
+    status = _nx_secure_tls_ticket_encrypt(tls_session, state, NX_SECURE_TLS_TICKET_STATE_SIZE + psk_length,
+                                           &packet_buffer[length + 2], available_size - (length + 4), &ticket_len);
+
+    /* The PSK is no longer needed. */
+    NX_SECURE_MEMSET(state, 0, sizeof(state));
+
+    if (status != NX_SUCCESS)
+    {
+        return(status);
     }
 
     /* Insert ticket length. */
     packet_buffer[length]     = (UCHAR)((ticket_len & 0xFF00) >> 8);
     packet_buffer[length + 1] = (UCHAR)(ticket_len & 0x00FF);
-    length += 2;
-
-    /* Copy in ticket. */
-    NX_SECURE_MEMCPY(&packet_buffer[length], ticket, ticket_len); /* Use case of memcpy is verified. */
-    length += ticket_len;
+    length += 2 + ticket_len;
 
-    /* Add in extensions if available. */
+    /* No extensions: the ticket does not allow early data. */
     extensions_len = 0;
     packet_buffer[length]     = (UCHAR)((extensions_len & 0xFF00) >> 8);
     packet_buffer[length + 1] = (UCHAR) (extensions_len & 0x00FF);
     length += 2;
 
-    /* Adjust the packet into which we just wrote the finished hash. */
+    /* Adjust the packet into which we just wrote the ticket. */
     send_packet -> nx_packet_append_ptr = send_packet -> nx_packet_append_ptr + length;
     send_packet -> nx_packet_length = send_packet -> nx_packet_length + length;
 
-    return(status);
+    return(NX_SUCCESS);
 }
 
 #endif
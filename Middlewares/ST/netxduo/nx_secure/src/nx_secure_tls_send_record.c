@@ -29,7 +29,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_send_record                          PORTABLE C      */
-/*                                                           6.1.7        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -40,7 +40,8 @@
 /*    functionality. The incoming packet data is wrapped in               */
 /*    a TLS record, which includes a header and footer (for               */
 /*    encrypted data). Also, all encryption of application                */
-/*    data is handled here.                                               */
+/*    data is handled here. Application data held back by record          */
+/*    coalescing is sent first so that records stay in order.             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -60,7 +61,9 @@
 /*    _nx_secure_tls_record_hash_update     Update hash of record         */
 /*    _nx_secure_tls_record_payload_encrypt Encrypt payload               */
 /*    _nx_secure_tls_session_iv_size_get    Get IV size for this session. */
+/*    _nx_secure_tls_send_record            Send held back data           */
 /*    nx_packet_data_append                 Append data to packet         */
+/*    nx_secure_tls_packet_release          Release packet                */
 /*    nx_tcp_socket_send                    Send packet                   */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
@@ -73,6 +76,7 @@
 /*    _nx_secure_tls_session_end            End of a session              */
 /*    _nx_secure_tls_session_receive_records                              */
 /*                                          Receive TLS records           */
+/*    _nx_secure_tls_session_flush          Send held back data           */
 /*    _nx_secure_tls_session_send           Send session packet           */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
@@ -86,6 +90,11 @@
 /*                                            resulting in version 6.1    */
 /*  06-02-2021     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1.7  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), sent     */
+/*                                            coalesced data first and    */
+/*                                            wrote MAC into packet tail  */
+/*                                            room,                       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_send_record(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet,
@@ -103,6 +112,23 @@ ULONG      length;
 USHORT     iv_size = 0;
 NX_PACKET *current_packet;
 
+    /* Application data held back for coalescing must go out ahead of this record. */
+    if (tls_session -> nx_secure_tls_coalesce_packet != NX_NULL)
+    {
+        current_packet = tls_session -> nx_secure_tls_coalesce_packet;
+        tls_session -> nx_secure_tls_coalesce_packet = NX_NULL;
+
+        status = _nx_secure_tls_send_record(tls_session, current_packet, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+
+        if (status != NX_SUCCESS)
+        {
+
+            /* The held back data belongs to the session, so release it here. */
+            nx_secure_tls_packet_release(current_packet);
+            return(status);
+        }
+    }
+
     /* Length of the data in the packet. */
     length = send_packet -> nx_packet_length;
 
@@ -281,22 +307,36 @@ NX_PACKET *current_packet;
                 }
             } while (current_packet != NX_NULL);
 
-            /* Generate the hash on the plaintext data. */
-            _nx_secure_tls_record_hash_calculate(tls_session, record_hash, &hash_length);
+            /* Generate the hash directly into the last packet when it has room for it. */
+            current_packet = (send_packet -> nx_packet_next != NX_NULL) ? send_packet -> nx_packet_last : send_packet;
+            if ((ULONG)(current_packet -> nx_packet_data_end - current_packet -> nx_packet_append_ptr) >=
+                tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_hash_size)
+            {
+                _nx_secure_tls_record_hash_calculate(tls_session, current_packet -> nx_packet_append_ptr, &hash_length);
 
-            /* Release the protection before suspending on nx_packet_data_append. */
-            tx_mutex_put(&_nx_secure_tls_protection);
+                current_packet -> nx_packet_append_ptr += hash_length;
+                send_packet -> nx_packet_length += hash_length;
+            }
+            else
+            {
 
-            /* Append the hash to the plaintext data in the last packet before encryption. */
-            status = nx_packet_data_append(send_packet, record_hash, hash_length,
-                                           tls_session -> nx_secure_tls_packet_pool, wait_option);
+                /* Generate the hash on the plaintext data. */
+                _nx_secure_tls_record_hash_calculate(tls_session, record_hash, &hash_length);
+
+                /* Release the protection before suspending on nx_packet_data_append. */
+                tx_mutex_put(&_nx_secure_tls_protection);
+
+                /* Append the hash to the plaintext data in the last packet before encryption. */
+                status = nx_packet_data_append(send_packet, record_hash, hash_length,
+                                               tls_session -> nx_secure_tls_packet_pool, wait_option);
 
 #ifdef NX_SECURE_KEY_CLEAR
-            NX_SECURE_MEMSET(record_hash, 0, sizeof(record_hash));
+                NX_SECURE_MEMSET(record_hash, 0, sizeof(record_hash));
 #endif /* NX_SECURE_KEY_CLEAR  */
 
-            /* Get the protection after nx_packet_data_append. */
-            tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+                /* Get the protection after nx_packet_data_append. */
+                tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+            }
         }
 
 
@@ -724,7 +724,7 @@ USHORT named_curve;
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_send_serverhello_psk_extension       PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -762,6 +762,9 @@ USHORT named_curve;
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), sent the */
+/*                                            selected PSK identity,      */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 
@@ -820,7 +823,6 @@ USHORT ext;
       |     2      |         2          |       2      |
       |  Ext Type  |  Extension length  |  Selected ID |
     */
-    NX_PARAMETER_NOT_USED(tls_session);
 
     /* Start with our passed-in packet offset. */
     offset = *packet_length;
@@ -851,8 +853,8 @@ USHORT ext;
     offset += 2;
 
     /* The selected_identity index into the ClientHello PSK list. */
-    packet_buffer[offset] = (UCHAR)(0);
-    packet_buffer[offset + 1] = (UCHAR)(0);
+    packet_buffer[offset] = (UCHAR)((tls_session -> nx_secure_tls_psk_selected_identity & 0xFF00) >> 8);
+    packet_buffer[offset + 1] = (UCHAR)(tls_session -> nx_secure_tls_psk_selected_identity & 0x00FF);
     offset += 2;
 
 
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_coalesce_set                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function configures coalescing of application data for a TLS   */
+/*    session. Packets passed to nx_secure_tls_session_send that are      */
+/*    smaller than the threshold are held back and combined into one      */
+/*    record, which is sent once it holds at least threshold bytes or     */
+/*    when the session sends any other record, receives data, or is       */
+/*    flushed with nx_secure_tls_session_flush. A threshold of 0 disables */
+/*    coalescing; data already held back is sent with the next record.    */
+/*                                                                        */
+/*    Held data is never sent on a timer, and a receive with NX_NO_WAIT   */
+/*    does not send it. Protocols that send a request and then poll for   */
+/*    the reply must call nx_secure_tls_session_flush after each message, */
+/*    otherwise a short message may stay held indefinitely.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    threshold                             Bytes that trigger a record   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_secure_tls_session_coalesce_set(NX_SECURE_TLS_SESSION *tls_session, ULONG threshold)
+{
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    tls_session -> nx_secure_tls_coalesce_threshold = threshold;
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_SUCCESS);
+}
+
@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_flush                        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends any application data held back by record        */
+/*    coalescing (see nx_secure_tls_session_coalesce_set) as one record.  */
+/*    It returns success if no data is held back. If another thread is    */
+/*    transmitting, the data stays held back and the session is kept.     */
+/*    Other send errors reset the session, as the record may already be   */
+/*    encrypted.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    wait_option                           Indicates behavior if TCP     */
+/*                                          socket cannot send packet     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_send_record            Send TLS encrypted record     */
+/*    _nx_secure_tls_session_reset          Clear out the session         */
+/*    nx_secure_tls_packet_release          Release packet                */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_secure_tls_session_receive        Receive TLS data              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_secure_tls_session_flush(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option)
+{
+UINT       status = NX_SUCCESS;
+NX_PACKET *packet_ptr;
+
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    packet_ptr = tls_session -> nx_secure_tls_coalesce_packet;
+    if (packet_ptr != NX_NULL)
+    {
+        tls_session -> nx_secure_tls_coalesce_packet = NX_NULL;
+
+        status = _nx_secure_tls_send_record(tls_session, packet_ptr, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+
+        if (status == NX_SECURE_TLS_TRANSMIT_LOCKED)
+        {
+
+            /* Another thread is transmitting and the data is untouched, keep holding it back. */
+            tls_session -> nx_secure_tls_coalesce_packet = packet_ptr;
+        }
+        else if (status != NX_SUCCESS)
+        {
+
+            /* The held back data belongs to the session, so release it here. */
+            nx_secure_tls_packet_release(packet_ptr);
+
+            /* Make sure we clear keys on errors. */
+            _nx_secure_tls_session_reset(tls_session);
+        }
+    }
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(status);
+}
+
@@ -29,7 +29,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_session_receive                      PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -40,6 +40,9 @@
 /*    all decryption and verification before returning the data to the    */
 /*    caller in the supplied NX_PACKET structure.                         */
 /*                                                                        */
+/*    Application data held back by record coalescing is sent first,      */
+/*    unless wait_option is NX_NO_WAIT.                                   */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           TLS control block             */
@@ -56,6 +59,7 @@
 /*    _nx_secure_tls_handshake_process      Process TLS handshake         */
 /*    _nx_secure_tls_session_receive_records                              */
 /*                                          Receive TLS records           */
+/*    _nx_secure_tls_session_flush          Send held back data           */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -70,6 +74,10 @@
 /*                                            supported chained packet,   */
 /*                                            fixed renegotiation bug,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), flushed  */
+/*                                            coalesced data before       */
+/*                                            receiving,                  */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_secure_tls_session_receive(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET **packet_ptr_ptr,
@@ -108,6 +116,19 @@ UINT local_initiated_renegotiation = NX_FALSE;
 #endif
 #endif /* NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION */
 
+    /* Send application data held back for coalescing before waiting for a reply. A receive
+       that does not wait leaves the data held back, since a record that fails to go out after
+       it is encrypted cannot be sent again and the session would have to be reset. */
+    if ((tls_session -> nx_secure_tls_coalesce_packet != NX_NULL) && (wait_option != NX_NO_WAIT))
+    {
+        status = _nx_secure_tls_session_flush(tls_session, wait_option);
+
+        if (status != NX_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
     /* Try receiving records from the remote host. */
     status = _nx_secure_tls_session_receive_records(tls_session, packet_ptr_ptr, wait_option);
 
@@ -29,7 +29,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_session_receive_records              PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -77,6 +77,9 @@
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            supported chained packet,   */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), handled  */
+/*                                            records decrypted in place, */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT  _nx_secure_tls_session_receive_records(NX_SECURE_TLS_SESSION *tls_session,
@@ -149,51 +152,55 @@ UCHAR          handshake_finished = NX_FALSE;
     if (status == NX_SUCCESS || status == NX_SECURE_TLS_POST_HANDSHAKE_RECEIVED)
     {
 
-        /* Remove processed packets. Data in released packet will be cleared by nx_secure_tls_packet_release. */
-        tls_session -> nx_secure_record_queue_header -> nx_packet_length -= bytes_processed;
-        current_packet = tls_session -> nx_secure_record_queue_header;
-        previous_packet = NX_NULL;
-        while (current_packet)
+        /* Remove processed packets. Data in released packet will be cleared by nx_secure_tls_packet_release.
+           The queue is already empty when the last record was detached and decrypted in place. */
+        if (tls_session -> nx_secure_record_queue_header)
         {
-            packet_fragment_length = (ULONG)(current_packet -> nx_packet_append_ptr) - (ULONG)(current_packet -> nx_packet_prepend_ptr);
-
-            /* Determine if all data in the current fragment have been processed. */
-            if (packet_fragment_length <= bytes_processed)
+            tls_session -> nx_secure_record_queue_header -> nx_packet_length -= bytes_processed;
+            current_packet = tls_session -> nx_secure_record_queue_header;
+            previous_packet = NX_NULL;
+            while (current_packet)
             {
-                bytes_processed -= packet_fragment_length;
+                packet_fragment_length = (ULONG)(current_packet -> nx_packet_append_ptr) - (ULONG)(current_packet -> nx_packet_prepend_ptr);
+
+                /* Determine if all data in the current fragment have been processed. */
+                if (packet_fragment_length <= bytes_processed)
+                {
+                    bytes_processed -= packet_fragment_length;
+                }
+                else
+                {
+                    current_packet -> nx_packet_prepend_ptr += bytes_processed;
+                    bytes_processed = 0;
+                    break;
+                }
+                previous_packet = current_packet;
+                current_packet = current_packet -> nx_packet_next;
             }
-            else
+
+            if (!current_packet)
             {
-                current_packet -> nx_packet_prepend_ptr += bytes_processed;
-                bytes_processed = 0;
-                break;
+                nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
+                tls_session -> nx_secure_record_queue_header = NX_NULL;
             }
-            previous_packet = current_packet;
-            current_packet = current_packet -> nx_packet_next;
-        }
-
-        if (!current_packet)
-        {
-            nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
-            tls_session -> nx_secure_record_queue_header = NX_NULL;
-        }
-        else if (previous_packet)
-        {
+            else if (previous_packet)
+            {
 
-            /* Release trimmed packets. */
-            /* Packets from tls_session -> nx_secure_record_queue_header till previous_packet can be trimmed. */
-            previous_packet -> nx_packet_next = NX_NULL;
+                /* Release trimmed packets. */
+                /* Packets from tls_session -> nx_secure_record_queue_header till previous_packet can be trimmed. */
+                previous_packet -> nx_packet_next = NX_NULL;
 
-            /* Update the length and last packet of remaining packets. */
-            current_packet -> nx_packet_length = tls_session -> nx_secure_record_queue_header -> nx_packet_length;
-            current_packet -> nx_packet_last = tls_session -> nx_secure_record_queue_header -> nx_packet_last;
+                /* Update the length and last packet of remaining packets. */
+                current_packet -> nx_packet_length = tls_session -> nx_secure_record_queue_header -> nx_packet_length;
+                current_packet -> nx_packet_last = tls_session -> nx_secure_record_queue_header -> nx_packet_last;
 
-            /* Correct the last packet to be trimmed. */
-            tls_session -> nx_secure_record_queue_header -> nx_packet_last = previous_packet;
-            nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
+                /* Correct the last packet to be trimmed. */
+                tls_session -> nx_secure_record_queue_header -> nx_packet_last = previous_packet;
+                nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
 
-            /* Update the remaining packets. */
-            tls_session -> nx_secure_record_queue_header = current_packet;
+                /* Update the remaining packets. */
+                tls_session -> nx_secure_record_queue_header = current_packet;
+            }
         }
 
         if (bytes_processed)
@@ -29,7 +29,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_session_reset                        PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -52,6 +52,7 @@
 /*    _nx_secure_tls_key_material_init      Clear TLS key material        */
 /*    _nx_secure_tls_remote_certificate_free_all                          */
 /*                                          Free all remote certificates  */
+/*    nx_secure_tls_packet_release          Release packet                */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
 /*                                                                        */
@@ -71,6 +72,10 @@
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            fixed renegotiation bug,    */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), released */
+/*                                            coalesced data, cleared the */
+/*                                            TLS 1.3 selected PSK,       */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_session_reset(NX_SECURE_TLS_SESSION *session_ptr)
@@ -115,6 +120,13 @@ UINT temp_status;
         }
     }
 
+    /* Drop application data held back for coalescing. */
+    if (session_ptr -> nx_secure_tls_coalesce_packet != NX_NULL)
+    {
+        nx_secure_tls_packet_release(session_ptr -> nx_secure_tls_coalesce_packet);
+        session_ptr -> nx_secure_tls_coalesce_packet = NX_NULL;
+    }
+
     /* Reset socket type. */
     session_ptr -> nx_secure_tls_socket_type = NX_SECURE_TLS_SESSION_TYPE_NONE;
 
@@ -178,6 +190,17 @@ UINT temp_status;
     session_ptr -> nx_secure_tls_key_material.nx_secure_tls_handshake_cache_length = 0;
 
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+#ifdef NX_SECURE_ENABLE_PSK_CIPHERSUITES
+    /* In TLS 1.3 the client PSK holds the PSK selected in the last handshake. Clear it so
+       the next handshake on this session starts without one. */
+    if (session_ptr -> nx_secure_tls_1_3)
+    {
+        session_ptr -> nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_data_size = 0;
+        session_ptr -> nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_resumption = NX_FALSE;
+    }
+    session_ptr -> nx_secure_tls_ticket_offered = NX_NULL;
+#endif /* NX_SECURE_ENABLE_PSK_CIPHERSUITES */
+
     /* Reset TLS 1.3 state. */
     session_ptr -> nx_secure_tls_1_3 = session_ptr -> nx_secure_tls_1_3_supported;
 #endif
@@ -29,7 +29,7 @@
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_tls_session_send                         PORTABLE C      */
-/*                                                           6.1          */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -40,6 +40,11 @@
 /*    all encryption and hashing before sending data over the established */
 /*    TCP socket connection.                    .                         */
 /*                                                                        */
+/*    When record coalescing is enabled, packets smaller than the         */
+/*    threshold are held back and sent together as one record once the    */
+/*    threshold is reached. The session owns a held back packet, so the   */
+/*    caller must not release it after a successful return.               */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           TLS control block             */
@@ -54,6 +59,9 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_secure_tls_send_record            Send TLS encrypted record     */
+/*    _nx_secure_tls_session_reset          Clear out the session         */
+/*    nx_packet_data_append                 Append data to packet         */
+/*    nx_secure_tls_packet_release          Release packet                */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
 /*                                                                        */
@@ -68,18 +76,96 @@
 /*  05-19-2020     Timothy Stapko           Initial Version 6.0           */
 /*  09-30-2020     Timothy Stapko           Modified comment(s),          */
 /*                                            resulting in version 6.1    */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            record coalescing,          */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_tls_session_send(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
                                  ULONG wait_option)
 {
-UINT status;
+UINT       status;
+NX_PACKET *pending_packet;
+NX_PACKET *copied_packet;
 
 
     /* Get the protection. */
     tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
 
-    status = _nx_secure_tls_send_record(tls_session, packet_ptr, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+    /* Hold back small writes so they go out in a single record. */
+    if ((tls_session -> nx_secure_tls_coalesce_threshold != 0) &&
+        (tls_session -> nx_secure_tls_local_session_active) &&
+        (packet_ptr -> nx_packet_length < tls_session -> nx_secure_tls_coalesce_threshold))
+    {
+        pending_packet = tls_session -> nx_secure_tls_coalesce_packet;
+        copied_packet = NX_NULL;
+
+        if (pending_packet == NX_NULL)
+        {
+
+            /* The session takes ownership of the packet. */
+            tls_session -> nx_secure_tls_coalesce_packet = packet_ptr;
+        }
+        else if ((packet_ptr -> nx_packet_next == NX_NULL) &&
+                 ((pending_packet -> nx_packet_length + packet_ptr -> nx_packet_length) <= NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH) &&
+                 (nx_packet_data_append(pending_packet, packet_ptr -> nx_packet_prepend_ptr, packet_ptr -> nx_packet_length,
+                                        tls_session -> nx_secure_tls_packet_pool, NX_NO_WAIT) == NX_SUCCESS))
+        {
+
+            /* The data is copied rather than chained because appending keeps every packet
+               but the last one full, which the TCP checksum of a packet chain relies on. */
+            copied_packet = packet_ptr;
+        }
+        else
+        {
+
+            /* Send the held back data and hold back this packet instead. */
+            tls_session -> nx_secure_tls_coalesce_packet = NX_NULL;
+
+            status = _nx_secure_tls_send_record(tls_session, pending_packet, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+
+            if (status != NX_SUCCESS)
+            {
+                nx_secure_tls_packet_release(pending_packet);
+
+                /* Make sure we clear keys on errors. */
+                _nx_secure_tls_session_reset(tls_session);
+
+                /* Release the protection. */
+                tx_mutex_put(&_nx_secure_tls_protection);
+
+                return(status);
+            }
+
+            tls_session -> nx_secure_tls_coalesce_packet = packet_ptr;
+        }
+
+        status = NX_SUCCESS;
+        pending_packet = tls_session -> nx_secure_tls_coalesce_packet;
+
+        /* Send the held back data once it reaches the threshold. */
+        if (pending_packet -> nx_packet_length >= tls_session -> nx_secure_tls_coalesce_threshold)
+        {
+            tls_session -> nx_secure_tls_coalesce_packet = NX_NULL;
+
+            status = _nx_secure_tls_send_record(tls_session, pending_packet, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+
+            /* On error the caller still owns its packet, so only release the held back data. */
+            if ((status != NX_SUCCESS) && (pending_packet != packet_ptr))
+            {
+                nx_secure_tls_packet_release(pending_packet);
+            }
+        }
+
+        if ((status == NX_SUCCESS) && (copied_packet != NX_NULL))
+        {
+            nx_secure_tls_packet_release(copied_packet);
+        }
+    }
+    else
+    {
+        status = _nx_secure_tls_send_record(tls_session, packet_ptr, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+    }
 
     if(status != NX_SUCCESS)
     {
@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_ticket_cache_set             PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function enables TLS 1.3 session resumption for a TLS Client   */
+/*    session. Session tickets received from the server are stored in     */
+/*    the ticket cache under server_id, and a valid cached ticket for     */
+/*    server_id is offered as a resumption PSK in the ClientHello of      */
+/*    later connections, which then skip the server certificate and       */
+/*    CertificateVerify. The server identity (e.g. the host name) is not  */
+/*    copied and must remain valid while the session uses it. Passing a   */
+/*    NULL cache disables resumption.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    ticket_cache                          Ticket cache, or NX_NULL      */
+/*    server_id                             Identity of the server        */
+/*    server_id_length                      Length of server identity     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT _nx_secure_tls_session_ticket_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_CACHE *ticket_cache,
+                                             UCHAR *server_id, UINT server_id_length)
+{
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    tls_session -> nx_secure_tls_ticket_cache = ticket_cache;
+    tls_session -> nx_secure_tls_ticket_server_id = server_id;
+    tls_session -> nx_secure_tls_ticket_server_id_size = server_id_length;
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_SUCCESS);
+}
+#endif
@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_x509_verify_cache_set        PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function attaches a cache of verified X.509 certificate        */
+/*    signatures (created with nx_secure_x509_verify_cache_create) to     */
+/*    the certificate store of a TLS session. Remote certificate chains   */
+/*    already verified through the cache skip the issuer signature        */
+/*    verification in later handshakes; the chain is still built and      */
+/*    checked against the trusted store, and the certificate callback is  */
+/*    still invoked. If the session has a time function, cached entries   */
+/*    of expired certificates are not used. Passing a NULL cache          */
+/*    disables the cache.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    verify_cache                          Verify cache, or NX_NULL      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nx_secure_tls_session_x509_verify_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_X509_VERIFY_CACHE *verify_cache)
+{
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    tls_session -> nx_secure_tls_credentials.nx_secure_tls_certificate_store.nx_secure_x509_verify_cache = verify_cache;
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_cache_create                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes a TLS 1.3 client session ticket cache in  */
+/*    the memory supplied by the application. The cache holds one ticket  */
+/*    per server, up to memory_size / sizeof(NX_SECURE_TLS_TICKET)        */
+/*    servers; when it is full, a ticket from a new server replaces the   */
+/*    entries in round-robin order. The cache may be shared by any        */
+/*    number of TLS sessions with                                         */
+/*    nx_secure_tls_session_ticket_cache_set.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ticket_cache                          Ticket cache control block    */
+/*    memory_ptr                            Memory for cache entries      */
+/*    memory_size                           Size of memory                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_SECURE_MEMSET                      Clear cache entries           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT _nx_secure_tls_ticket_cache_create(NX_SECURE_TLS_TICKET_CACHE *ticket_cache, VOID *memory_ptr, ULONG memory_size)
+{
+UINT count;
+
+    count = (UINT)(memory_size / sizeof(NX_SECURE_TLS_TICKET));
+
+    /* Zero size server identities mark the entries free. */
+    NX_SECURE_MEMSET(memory_ptr, 0, count * sizeof(NX_SECURE_TLS_TICKET));
+
+    ticket_cache -> nx_secure_tls_ticket_cache_entries = (NX_SECURE_TLS_TICKET *)memory_ptr;
+    ticket_cache -> nx_secure_tls_ticket_cache_count = count;
+    ticket_cache -> nx_secure_tls_ticket_cache_next = 0;
+
+    return(NX_SUCCESS);
+}
+#endif
@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_cache_find                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function looks up the session ticket cached for the server a   */
+/*    TLS Client session is connecting to. Tickets past their lifetime    */
+/*    are discarded. The entry for the server is returned even if it      */
+/*    holds no valid ticket, so a new ticket can replace it; it is        */
+/*    NX_NULL if the server has no entry. The caller must hold the TLS    */
+/*    protection mutex.                                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    ticket                                Cache entry for the server    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_process_newsessionticket                             */
+/*                                          Process NewSessionTicket      */
+/*    _nx_secure_tls_send_clienthello       Send ClientHello              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT _nx_secure_tls_ticket_cache_find(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET **ticket)
+{
+NX_SECURE_TLS_TICKET_CACHE *ticket_cache;
+NX_SECURE_TLS_TICKET       *entry;
+ULONG                       age;
+UINT                        i;
+
+    *ticket = NX_NULL;
+
+    ticket_cache = tls_session -> nx_secure_tls_ticket_cache;
+    if ((ticket_cache == NX_NULL) || (tls_session -> nx_secure_tls_ticket_server_id_size == 0))
+    {
+        return(NX_SECURE_TLS_NO_MATCHING_PSK);
+    }
+
+    for (i = 0; i < ticket_cache -> nx_secure_tls_ticket_cache_count; i++)
+    {
+        entry = &ticket_cache -> nx_secure_tls_ticket_cache_entries[i];
+
+        if ((entry -> nx_secure_tls_ticket_server_id_size != tls_session -> nx_secure_tls_ticket_server_id_size) ||
+            (NX_SECURE_MEMCMP(entry -> nx_secure_tls_ticket_server_id, tls_session -> nx_secure_tls_ticket_server_id,
+                              entry -> nx_secure_tls_ticket_server_id_size) != 0))
+        {
+            continue;
+        }
+
+        /* Free entries have no server identity, so this entry holds a ticket. */
+        *ticket = entry;
+
+        /* Expired tickets are dropped rather than offered. */
+        age = (ULONG)(tx_time_get() - entry -> nx_secure_tls_ticket_received) / NX_IP_PERIODIC_RATE;
+        if (age >= entry -> nx_secure_tls_ticket_lifetime)
+        {
+            entry -> nx_secure_tls_ticket_size = 0;
+        }
+
+        if (entry -> nx_secure_tls_ticket_size == 0)
+        {
+            return(NX_SECURE_TLS_NO_MATCHING_PSK);
+        }
+
+        return(NX_SUCCESS);
+    }
+
+    return(NX_SECURE_TLS_NO_MATCHING_PSK);
+}
+#endif
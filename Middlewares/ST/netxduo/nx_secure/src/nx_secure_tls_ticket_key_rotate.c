@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_key_rotate                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function installs a new secret for protecting TLS 1.3 session  */
+/*    tickets. Tickets issued from now on are protected with the new      */
+/*    key. The key it replaces is kept, so tickets issued before the      */
+/*    rotation are still accepted until the next rotation; tickets        */
+/*    protected with older keys fall back to a full handshake. The        */
+/*    application should rotate keys at least once per ticket lifetime,   */
+/*    using keys from a secure random source.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ticket_keys                           Ticket keys control block     */
+/*    key                                   New ticket key                */
+/*    key_length                            Length of key                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*    NX_RAND                               Generate first key name       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT _nx_secure_tls_ticket_key_rotate(NX_SECURE_TLS_TICKET_KEYS *ticket_keys, UCHAR *key, UINT key_length)
+{
+NX_SECURE_TLS_TICKET_KEY *current_key;
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    current_key = &ticket_keys -> nx_secure_tls_ticket_key_current;
+
+    /* The current key still protects outstanding tickets. */
+    NX_SECURE_MEMCPY(&ticket_keys -> nx_secure_tls_ticket_key_previous, current_key,
+                     sizeof(NX_SECURE_TLS_TICKET_KEY)); /* Use case of memcpy is verified. */
+
+    /* Give the new key a different name so tickets can be matched to their key. */
+    if (current_key -> nx_secure_tls_ticket_key_size == 0)
+    {
+        current_key -> nx_secure_tls_ticket_key_name = (ULONG)NX_RAND();
+    }
+    else
+    {
+        current_key -> nx_secure_tls_ticket_key_name++;
+    }
+
+    NX_SECURE_MEMCPY(current_key -> nx_secure_tls_ticket_key_data, key, key_length); /* Use case of memcpy is verified. */
+    current_key -> nx_secure_tls_ticket_key_size = key_length;
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_SUCCESS);
+}
+#endif
@@ -0,0 +1,80 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_keys_create                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the keys a TLS 1.3 server uses to         */
+/*    protect the session tickets it issues. No ticket is issued until a  */
+/*    key is installed with nx_secure_tls_ticket_key_rotate. The keys     */
+/*    may be shared by any number of TLS Server sessions with             */
+/*    nx_secure_tls_session_ticket_keys_set.                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ticket_keys                           Ticket keys control block     */
+/*    lifetime                              Ticket lifetime in seconds    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_SECURE_MEMSET                      Clear ticket keys             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT _nx_secure_tls_ticket_keys_create(NX_SECURE_TLS_TICKET_KEYS *ticket_keys, ULONG lifetime)
+{
+
+    NX_SECURE_MEMSET(ticket_keys, 0, sizeof(NX_SECURE_TLS_TICKET_KEYS));
+
+    ticket_keys -> nx_secure_tls_ticket_lifetime = lifetime;
+
+    return(NX_SUCCESS);
+}
+#endif
@@ -0,0 +1,509 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+static UINT _nx_secure_tls_ticket_hmac(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_KEY *ticket_key,
+                                       const UCHAR *label, const UCHAR *input, UINT input_length,
+                                       const UCHAR *counter, UCHAR *output);
+static UINT _nx_secure_tls_ticket_crypt(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_KEY *ticket_key,
+                                        const UCHAR *iv, const UCHAR *input, UCHAR *output, UINT length);
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_encrypt                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds a self-contained TLS 1.3 session ticket for a  */
+/*    TLS Server. The resumption state is encrypted and authenticated     */
+/*    with the current ticket key so the server does not need to keep     */
+/*    any per-client state:                                               */
+/*                                                                        */
+/*      | 4 key name | 16 IV | encrypted state | 32 HMAC-SHA256 tag |     */
+/*                                                                        */
+/*    The state is encrypted with a keystream of HMAC(key, "ticket enc"   */
+/*    || IV || counter) blocks and the tag is HMAC(key, "ticket mac" ||   */
+/*    key name || IV || encrypted state).                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    state                                 Resumption state to protect   */
+/*    state_length                          Length of state               */
+/*    ticket                                Output ticket buffer          */
+/*    ticket_size                           Size of ticket buffer         */
+/*    ticket_length                         Length of generated ticket    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_crypt           Apply ticket keystream        */
+/*    _nx_secure_tls_ticket_hmac            Compute ticket HMAC           */
+/*    NX_RAND                               Generate ticket IV            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_send_newsessionticket  Send NewSessionTicket         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT _nx_secure_tls_ticket_encrypt(NX_SECURE_TLS_SESSION *tls_session, UCHAR *state, UINT state_length,
+                                   UCHAR *ticket, UINT ticket_size, UINT *ticket_length)
+{
+UINT                      status;
+UINT                      i;
+UINT                      random_value;
+UINT                      offset;
+NX_SECURE_TLS_TICKET_KEY *ticket_key;
+UCHAR                    *iv;
+
+    if (tls_session -> nx_secure_tls_ticket_keys == NX_NULL)
+    {
+        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+    }
+
+    ticket_key = &tls_session -> nx_secure_tls_ticket_keys -> nx_secure_tls_ticket_key_current;
+
+    /* No key has been installed yet. */
+    if (ticket_key -> nx_secure_tls_ticket_key_size == 0)
+    {
+        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+    }
+
+    if (ticket_size < (state_length + NX_SECURE_TLS_TICKET_KEY_NAME_SIZE + NX_SECURE_TLS_TICKET_IV_SIZE +
+                       NX_SECURE_TLS_TICKET_TAG_SIZE))
+    {
+        return(NX_SECURE_TLS_PACKET_BUFFER_TOO_SMALL);
+    }
+
+    /* Key name, so the server can find the key for this ticket after rotation. */
+    ticket[0] = (UCHAR)(ticket_key -> nx_secure_tls_ticket_key_name >> 24);
+    ticket[1] = (UCHAR)(ticket_key -> nx_secure_tls_ticket_key_name >> 16);
+    ticket[2] = (UCHAR)(ticket_key -> nx_secure_tls_ticket_key_name >> 8);
+    ticket[3] = (UCHAR)(ticket_key -> nx_secure_tls_ticket_key_name);
+    offset = NX_SECURE_TLS_TICKET_KEY_NAME_SIZE;
+
+    /* Random IV. */
+    iv = &ticket[offset];
+    for (i = 0; i < NX_SECURE_TLS_TICKET_IV_SIZE; i += (UINT)sizeof(random_value))
+    {
+        random_value = (UINT)NX_RAND();
+        NX_SECURE_MEMCPY(&iv[i], (UCHAR *)&random_value, sizeof(random_value)); /* Use case of memcpy is verified. */
+    }
+    offset += NX_SECURE_TLS_TICKET_IV_SIZE;
+
+    /* Encrypt the state. */
+    status = _nx_secure_tls_ticket_crypt(tls_session, ticket_key, iv, state, &ticket[offset], state_length);
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
+    offset += state_length;
+
+    /* Authenticate everything before the tag. */
+    status = _nx_secure_tls_ticket_hmac(tls_session, ticket_key, (const UCHAR *)"ticket mac", ticket, offset, NX_NULL, &ticket[offset]);
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
+    offset += NX_SECURE_TLS_TICKET_TAG_SIZE;
+
+    *ticket_length = offset;
+
+    return(NX_SUCCESS);
+}
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_decrypt                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function recovers the resumption state from a session ticket   */
+/*    received by a TLS Server in the ClientHello pre_shared_key          */
+/*    extension. The ticket is accepted if it was protected with the      */
+/*    current or previous ticket key and its tag verifies.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    ticket                                Received ticket               */
+/*    ticket_length                         Length of ticket              */
+/*    state                                 Output state buffer           */
+/*    state_size                            Size of state buffer          */
+/*    state_length                          Length of recovered state     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_crypt           Apply ticket keystream        */
+/*    _nx_secure_tls_ticket_hmac            Compute ticket HMAC           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_process_clienthello_psk_extension                    */
+/*                                          Process ClientHello PSK       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT _nx_secure_tls_ticket_decrypt(NX_SECURE_TLS_SESSION *tls_session, const UCHAR *ticket, UINT ticket_length,
+                                   UCHAR *state, UINT state_size, UINT *state_length)
+{
+UINT                      status;
+UINT                      length;
+ULONG                     key_name;
+NX_SECURE_TLS_TICKET_KEYS *ticket_keys;
+NX_SECURE_TLS_TICKET_KEY *ticket_key;
+UCHAR                     tag[NX_SECURE_TLS_TICKET_TAG_SIZE];
+UINT                      i;
+UCHAR                     diff = 0;
+
+    ticket_keys = tls_session -> nx_secure_tls_ticket_keys;
+    if (ticket_keys == NX_NULL)
+    {
+        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+    }
+
+    /* Tickets that are too short or too long were not issued by us. */
+    if ((ticket_length < (NX_SECURE_TLS_TICKET_KEY_NAME_SIZE + NX_SECURE_TLS_TICKET_IV_SIZE + NX_SECURE_TLS_TICKET_TAG_SIZE)) ||
+        (ticket_length - (NX_SECURE_TLS_TICKET_KEY_NAME_SIZE + NX_SECURE_TLS_TICKET_IV_SIZE + NX_SECURE_TLS_TICKET_TAG_SIZE) > state_size))
+    {
+        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+    }
+
+    /* Find the key the ticket was protected with. */
+    key_name = (ULONG)((ticket[0] << 24) + (ticket[1] << 16) + (ticket[2] << 8) + ticket[3]);
+    if ((ticket_keys -> nx_secure_tls_ticket_key_current.nx_secure_tls_ticket_key_size != 0) &&
+        (ticket_keys -> nx_secure_tls_ticket_key_current.nx_secure_tls_ticket_key_name == key_name))
+    {
+        ticket_key = &ticket_keys -> nx_secure_tls_ticket_key_current;
+    }
+    else if ((ticket_keys -> nx_secure_tls_ticket_key_previous.nx_secure_tls_ticket_key_size != 0) &&
+             (ticket_keys -> nx_secure_tls_ticket_key_previous.nx_secure_tls_ticket_key_name == key_name))
+    {
+        ticket_key = &ticket_keys -> nx_secure_tls_ticket_key_previous;
+    }
+    else
+    {
+        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+    }
+
+    /* Verify the tag before decrypting anything. */
+    length = ticket_length - NX_SECURE_TLS_TICKET_TAG_SIZE;
+    status = _nx_secure_tls_ticket_hmac(tls_session, ticket_key, (const UCHAR *)"ticket mac", ticket, length, NX_NULL, tag);
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Compare the whole tag in constant time so a forged ticket does not learn how many bytes matched. */
+    for (i = 0; i < NX_SECURE_TLS_TICKET_TAG_SIZE; i++)
+    {
+        diff |= (UCHAR)(tag[i] ^ ticket[length + i]);
+    }
+
+    if (diff != 0)
+    {
+        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+    }
+
+    /* Decrypt the state. */
+    length -= (NX_SECURE_TLS_TICKET_KEY_NAME_SIZE + NX_SECURE_TLS_TICKET_IV_SIZE);
+    status = _nx_secure_tls_ticket_crypt(tls_session, ticket_key, &ticket[NX_SECURE_TLS_TICKET_KEY_NAME_SIZE],
+                                         &ticket[NX_SECURE_TLS_TICKET_KEY_NAME_SIZE + NX_SECURE_TLS_TICKET_IV_SIZE],
+                                         state, length);
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
+
+    *state_length = length;
+
+    return(NX_SUCCESS);
+}
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_crypt                         PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function XORs ticket state with the ticket keystream, which    */
+/*    both encrypts and decrypts. Block n of the keystream is             */
+/*    HMAC-SHA256(key, "ticket enc" || IV || n).                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    ticket_key                            Ticket key                    */
+/*    iv                                    Ticket IV                     */
+/*    input                                 Input data                    */
+/*    output                                Output data                   */
+/*    length                                Length of data                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_hmac            Compute ticket HMAC           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_decrypt         Recover ticket state          */
+/*    _nx_secure_tls_ticket_encrypt         Protect ticket state          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+static UINT _nx_secure_tls_ticket_crypt(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_KEY *ticket_key,
+                                        const UCHAR *iv, const UCHAR *input, UCHAR *output, UINT length)
+{
+UINT  status;
+UINT  i;
+UINT  block_length;
+UCHAR counter;
+UCHAR keystream[NX_SECURE_TLS_TICKET_TAG_SIZE];
+
+    counter = 0;
+    while (length > 0)
+    {
+        status = _nx_secure_tls_ticket_hmac(tls_session, ticket_key, (const UCHAR *)"ticket enc", iv,
+                                            NX_SECURE_TLS_TICKET_IV_SIZE, &counter, keystream);
+        if (status != NX_SUCCESS)
+        {
+            return(status);
+        }
+
+        block_length = (length < sizeof(keystream)) ? length : (UINT)sizeof(keystream);
+        for (i = 0; i < block_length; i++)
+        {
+            output[i] = (UCHAR)(input[i] ^ keystream[i]);
+        }
+
+        input += block_length;
+        output += block_length;
+        length -= block_length;
+        counter++;
+    }
+
+    return(NX_SUCCESS);
+}
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_hmac                          PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes HMAC-SHA256(key, label || input), followed   */
+/*    by the counter byte for keystream blocks, with the crypto table     */
+/*    HMAC method. The handshake hash scratch area is used as metadata so */
+/*    the session cipher state is left untouched.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    ticket_key                            Ticket key                    */
+/*    label                                 10-byte domain label          */
+/*    input                                 Input data                    */
+/*    input_length                          Length of input               */
+/*    counter                               Keystream block counter, or   */
+/*                                            NX_NULL for the ticket tag  */
+/*    output                                HMAC output (32 bytes)        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_init]                      Initialize HMAC               */
+/*    [nx_crypto_operation]                 Compute HMAC                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_ticket_crypt           Apply ticket keystream        */
+/*    _nx_secure_tls_ticket_decrypt         Recover ticket state          */
+/*    _nx_secure_tls_ticket_encrypt         Protect ticket state          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+static UINT _nx_secure_tls_ticket_hmac(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_KEY *ticket_key,
+                                       const UCHAR *label, const UCHAR *input, UINT input_length,
+                                       const UCHAR *counter, UCHAR *output)
+{
+UINT                    status;
+const NX_CRYPTO_METHOD *hmac_method;
+const NX_CRYPTO_METHOD *hash_method;
+VOID                   *handler = NX_NULL;
+VOID                   *metadata;
+UINT                    metadata_size;
+UCHAR                  *key;
+UINT                    key_length;
+
+    hmac_method = tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_hmac_method;
+    hash_method = tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_sha256_method;
+
+    if ((hmac_method == NX_NULL) || (hmac_method -> nx_crypto_operation == NX_NULL) || (hash_method == NX_NULL))
+    {
+        return(NX_SECURE_TLS_MISSING_CRYPTO_ROUTINE);
+    }
+
+    metadata = tls_session -> nx_secure_tls_handshake_hash.nx_secure_tls_handshake_hash_scratch;
+    metadata_size = tls_session -> nx_secure_tls_handshake_hash.nx_secure_tls_handshake_hash_scratch_size;
+    key = ticket_key -> nx_secure_tls_ticket_key_data;
+    key_length = ticket_key -> nx_secure_tls_ticket_key_size;
+
+    if (hmac_method -> nx_crypto_init)
+    {
+        status = hmac_method -> nx_crypto_init((NX_CRYPTO_METHOD *)hmac_method, key, (NX_CRYPTO_KEY_SIZE)(key_length << 3),
+                                               &handler, metadata, metadata_size);
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
+    /* HMAC-SHA256 regardless of the session ciphersuite. */
+    status = hmac_method -> nx_crypto_operation(NX_CRYPTO_HMAC_SET_HASH, NX_NULL, (NX_CRYPTO_METHOD *)hash_method, NX_NULL, 0,
+                                                NX_NULL, 0, NX_NULL, NX_NULL, 0, metadata, metadata_size, NX_NULL, NX_NULL);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    status = hmac_method -> nx_crypto_operation(NX_CRYPTO_HASH_INITIALIZE, handler, (NX_CRYPTO_METHOD *)hmac_method,
+                                                key, (NX_CRYPTO_KEY_SIZE)(key_length << 3), NX_NULL, 0, NX_NULL,
+                                                NX_NULL, 0, metadata, metadata_size, NX_NULL, NX_NULL);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    status = hmac_method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handler, (NX_CRYPTO_METHOD *)hmac_method,
+                                                NX_NULL, 0, (UCHAR *)label, 10, NX_NULL,
+                                                NX_NULL, 0, metadata, metadata_size, NX_NULL, NX_NULL);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    status = hmac_method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handler, (NX_CRYPTO_METHOD *)hmac_method,
+                                                NX_NULL, 0, (UCHAR *)input, input_length, NX_NULL,
+                                                NX_NULL, 0, metadata, metadata_size, NX_NULL, NX_NULL);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    if (counter != NX_NULL)
+    {
+
+        /* Keystream block counter. */
+        status = hmac_method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handler, (NX_CRYPTO_METHOD *)hmac_method,
+                                                    NX_NULL, 0, (UCHAR *)counter, 1, NX_NULL,
+                                                    NX_NULL, 0, metadata, metadata_size, NX_NULL, NX_NULL);
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
+    status = hmac_method -> nx_crypto_operation(NX_CRYPTO_HASH_CALCULATE, handler, (NX_CRYPTO_METHOD *)hmac_method,
+                                                NX_NULL, 0, NX_NULL, 0, NX_NULL,
+                                                output, NX_SECURE_TLS_TICKET_TAG_SIZE, metadata, metadata_size,
+                                                NX_NULL, NX_NULL);
+
+    if (hmac_method -> nx_crypto_cleanup)
+    {
+        hmac_method -> nx_crypto_cleanup(metadata);
+    }
+
+    return(status);
+}
+#endif
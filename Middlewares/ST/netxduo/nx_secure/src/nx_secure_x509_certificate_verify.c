@@ -26,6 +26,13 @@
 
 static UCHAR generated_hash[64];       /* We need to be able to hold the entire generated hash - SHA-512 = 64 bytes. */
 static UCHAR decrypted_signature[512]; /* This needs to hold the entire decrypted data - RSA 2048-bit key = 256 bytes. */
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+static UCHAR link_digest[64];          /* Digest of the issuer public key and the signature, same hash as generated_hash. */
+
+static UINT _nx_secure_x509_verify_cache_link_digest(const NX_CRYPTO_METHOD *hash_method,
+                                                      NX_SECURE_X509_CERT *certificate,
+                                                      NX_SECURE_X509_CERT *issuer_certificate);
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 
 
 
@@ -34,7 +41,7 @@ static UCHAR decrypted_signature[512]; /* This needs to hold the entire decrypte
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_x509_certificate_verify                  PORTABLE C      */
-/*                                                           6.1.6        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -63,6 +70,8 @@ static UCHAR decrypted_signature[512]; /* This needs to hold the entire decrypte
 /*                                          Find certificate methods      */
 /*    _nx_secure_x509_find_curve_method     Find named curve used         */
 /*    _nx_secure_x509_asn1_tlv_block_parse  Parse ASN.1 block             */
+/*    _nx_secure_x509_verify_cache_add      Add to verify cache           */
+/*    _nx_secure_x509_verify_cache_find     Find in verify cache          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -81,6 +90,9 @@ static UCHAR decrypted_signature[512]; /* This needs to hold the entire decrypte
 /*  04-02-2021     Timothy Stapko           Modified comment(s),          */
 /*                                            removed dependency on TLS,  */
 /*                                            resulting in version 6.1.6  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), added    */
+/*                                            verified signature cache,   */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_x509_certificate_verify(NX_SECURE_X509_CERTIFICATE_STORE *store,
@@ -109,8 +121,12 @@ USHORT                  key_usage_bitfield = 0;
 NX_SECURE_EC_PUBLIC_KEY *ec_pubkey;
 const NX_CRYPTO_METHOD  *curve_method;
 #endif /* NX_SECURE_ENABLE_ECC_CIPHERSUITE */
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+NX_SECURE_X509_VERIFY_CACHE *verify_cache = NX_CRYPTO_NULL;
+#else
 
     NX_CRYPTO_PARAMETER_NOT_USED(store);
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
 
 #ifndef NX_SECURE_X509_DISABLE_KEY_USAGE_CHECK
     /* Before we do any crypto verification, we need to check the KeyUsage extension. */
@@ -200,6 +216,26 @@ const NX_CRYPTO_METHOD  *curve_method;
 
     hash_length = (hash_method -> nx_crypto_ICV_size_in_bits >> 3);
 
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+    /* If this certificate was already verified against the same issuer key, skip the
+       public-key operation. The KeyUsage check above still applies. */
+    if ((store != NX_CRYPTO_NULL) && (store -> nx_secure_x509_verify_cache != NX_CRYPTO_NULL) &&
+        (_nx_secure_x509_verify_cache_link_digest(hash_method, certificate, issuer_certificate) == NX_SECURE_X509_SUCCESS))
+    {
+        verify_cache = store -> nx_secure_x509_verify_cache;
+
+        if (_nx_secure_x509_verify_cache_find(verify_cache, certificate, issuer_certificate,
+                                              generated_hash, link_digest, hash_length) == NX_SECURE_X509_SUCCESS)
+        {
+#ifdef NX_SECURE_KEY_CLEAR
+            NX_SECURE_MEMSET(generated_hash, 0, sizeof(generated_hash));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+            return(NX_SECURE_X509_SUCCESS);
+        }
+    }
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
+
     /* Perform a public-key decryption operation on the extracted signature from the certificate.
      * In this case, the operation is doing a "reverse decryption", using the public key to decrypt, rather
      * than the private. This allows us to tie a trusted root certificate to a signature of a certificate
@@ -305,6 +341,14 @@ const NX_CRYPTO_METHOD  *curve_method;
         /* Compare generated hash with decrypted hash. */
         compare_result = (UINT)NX_SECURE_MEMCMP(generated_hash, decrypted_hash, decrypted_hash_length);
 
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+        if ((compare_result == 0) && (verify_cache != NX_CRYPTO_NULL))
+        {
+            _nx_secure_x509_verify_cache_add(verify_cache, certificate, issuer_certificate,
+                                             generated_hash, link_digest, hash_length);
+        }
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
+
 #ifdef NX_SECURE_KEY_CLEAR
         NX_SECURE_MEMSET(generated_hash, 0, sizeof(generated_hash));
         NX_SECURE_MEMSET(decrypted_signature, 0, sizeof(decrypted_signature));
@@ -406,6 +450,15 @@ const NX_CRYPTO_METHOD  *curve_method;
                                                              certificate -> nx_secure_x509_public_cipher_metadata_area,
                                                              certificate -> nx_secure_x509_public_cipher_metadata_size,
                                                              NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+        if ((status == NX_CRYPTO_SUCCESS) && (verify_cache != NX_CRYPTO_NULL))
+        {
+            _nx_secure_x509_verify_cache_add(verify_cache, certificate, issuer_certificate,
+                                             generated_hash, link_digest, hash_length);
+        }
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
+
 #ifdef NX_SECURE_KEY_CLEAR
         NX_SECURE_MEMSET(generated_hash, 0, sizeof(generated_hash));
 #endif /* NX_SECURE_KEY_CLEAR  */
@@ -429,3 +482,168 @@ const NX_CRYPTO_METHOD  *curve_method;
     return(NX_SECURE_X509_CERTIFICATE_SIG_CHECK_FAILED);
 }
 
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_x509_verify_cache_link_digest            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function hashes the issuer public key algorithm, named curve,  */
+/*    public key and the certificate signature into link_digest, each     */
+/*    field prefixed with its length. Together with the digest of the     */
+/*    signed data it identifies a signature verification in the verify    */
+/*    cache.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hash_method                           Signature hash method         */
+/*    certificate                           Pointer to certificate        */
+/*    issuer_certificate                    Pointer to issuer certificate */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_init]                      Crypto initialization         */
+/*    [nx_crypto_operation]                 Crypto operation              */
+/*    [nx_crypto_cleanup]                   Crypto cleanup                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_x509_certificate_verify    Verify a certificate          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_x509_verify_cache_link_digest(const NX_CRYPTO_METHOD *hash_method,
+                                                      NX_SECURE_X509_CERT *certificate,
+                                                      NX_SECURE_X509_CERT *issuer_certificate)
+{
+UINT         status;
+UINT         i;
+UINT         count = 0;
+const UCHAR *input[3];
+UINT         input_length[3];
+UINT         named_curve = 0;
+UCHAR        key_info[8];
+UCHAR        length_prefix[4];
+VOID        *handler = NX_CRYPTO_NULL;
+UCHAR       *metadata = certificate -> nx_secure_x509_hash_metadata_area;
+UINT         metadata_size = certificate -> nx_secure_x509_hash_metadata_size;
+
+    if ((hash_method -> nx_crypto_operation == NX_CRYPTO_NULL) ||
+        ((hash_method -> nx_crypto_ICV_size_in_bits >> 3) > sizeof(link_digest)))
+    {
+        return(NX_SECURE_X509_MISSING_CRYPTO_ROUTINE);
+    }
+
+    if (issuer_certificate -> nx_secure_x509_public_algorithm == NX_SECURE_TLS_X509_TYPE_RSA)
+    {
+        input[count] = issuer_certificate -> nx_secure_x509_public_key.rsa_public_key.nx_secure_rsa_public_modulus;
+        input_length[count++] = issuer_certificate -> nx_secure_x509_public_key.rsa_public_key.nx_secure_rsa_public_modulus_length;
+        input[count] = issuer_certificate -> nx_secure_x509_public_key.rsa_public_key.nx_secure_rsa_public_exponent;
+        input_length[count++] = issuer_certificate -> nx_secure_x509_public_key.rsa_public_key.nx_secure_rsa_public_exponent_length;
+    }
+#ifdef NX_SECURE_ENABLE_ECC_CIPHERSUITE
+    else if (issuer_certificate -> nx_secure_x509_public_algorithm == NX_SECURE_TLS_X509_TYPE_EC)
+    {
+        input[count] = issuer_certificate -> nx_secure_x509_public_key.ec_public_key.nx_secure_ec_public_key;
+        input_length[count++] = issuer_certificate -> nx_secure_x509_public_key.ec_public_key.nx_secure_ec_public_key_length;
+        named_curve = issuer_certificate -> nx_secure_x509_public_key.ec_public_key.nx_secure_ec_named_curve;
+    }
+#endif /* NX_SECURE_ENABLE_ECC_CIPHERSUITE */
+    else
+    {
+        return(NX_SECURE_X509_UNSUPPORTED_PUBLIC_CIPHER);
+    }
+
+    input[count] = certificate -> nx_secure_x509_signature_data;
+    input_length[count++] = certificate -> nx_secure_x509_signature_data_length;
+
+    /* Bind the key type and curve so keys with equal bytes on different algorithms never collide. */
+    key_info[0] = (UCHAR)(issuer_certificate -> nx_secure_x509_public_algorithm >> 24);
+    key_info[1] = (UCHAR)(issuer_certificate -> nx_secure_x509_public_algorithm >> 16);
+    key_info[2] = (UCHAR)(issuer_certificate -> nx_secure_x509_public_algorithm >> 8);
+    key_info[3] = (UCHAR)(issuer_certificate -> nx_secure_x509_public_algorithm);
+    key_info[4] = (UCHAR)(named_curve >> 24);
+    key_info[5] = (UCHAR)(named_curve >> 16);
+    key_info[6] = (UCHAR)(named_curve >> 8);
+    key_info[7] = (UCHAR)(named_curve);
+
+    if (hash_method -> nx_crypto_init)
+    {
+        status = hash_method -> nx_crypto_init((NX_CRYPTO_METHOD*)hash_method, NX_CRYPTO_NULL, 0,
+                                               &handler, metadata, metadata_size);
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
+    status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_INITIALIZE, handler, (NX_CRYPTO_METHOD*)hash_method,
+                                                NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0,
+                                                metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handler, (NX_CRYPTO_METHOD*)hash_method,
+                                                    NX_CRYPTO_NULL, 0, key_info, sizeof(key_info), NX_CRYPTO_NULL,
+                                                    NX_CRYPTO_NULL, 0, metadata, metadata_size,
+                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    }
+
+    /* Prefix each field with its length so bytes cannot shift between adjacent fields. */
+    for (i = 0; (i < count) && (status == NX_CRYPTO_SUCCESS); i++)
+    {
+        length_prefix[0] = (UCHAR)(input_length[i] >> 24);
+        length_prefix[1] = (UCHAR)(input_length[i] >> 16);
+        length_prefix[2] = (UCHAR)(input_length[i] >> 8);
+        length_prefix[3] = (UCHAR)(input_length[i]);
+
+        status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handler, (NX_CRYPTO_METHOD*)hash_method,
+                                                    NX_CRYPTO_NULL, 0, length_prefix, sizeof(length_prefix), NX_CRYPTO_NULL,
+                                                    NX_CRYPTO_NULL, 0, metadata, metadata_size,
+                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            break;
+        }
+
+        status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handler, (NX_CRYPTO_METHOD*)hash_method,
+                                                    NX_CRYPTO_NULL, 0, (UCHAR *)input[i], input_length[i], NX_CRYPTO_NULL,
+                                                    NX_CRYPTO_NULL, 0, metadata, metadata_size,
+                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    }
+
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_CALCULATE, handler, (NX_CRYPTO_METHOD*)hash_method,
+                                                    NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL,
+                                                    link_digest, sizeof(link_digest), metadata, metadata_size,
+                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    }
+
+    if (hash_method -> nx_crypto_cleanup)
+    {
+        if (hash_method -> nx_crypto_cleanup(metadata) != NX_CRYPTO_SUCCESS)
+        {
+            status = NX_SECURE_X509_MISSING_CRYPTO_ROUTINE;
+        }
+    }
+
+    return(status);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
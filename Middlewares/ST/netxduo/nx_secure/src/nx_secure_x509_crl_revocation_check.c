@@ -35,7 +35,7 @@ static UINT _nx_secure_x509_crl_parse_entry(const UCHAR *buffer, ULONG length, U
 /*  FUNCTION                                               RELEASE        */
 /*                                                                        */
 /*    _nx_secure_x509_crl_revocation_check                PORTABLE C      */
-/*                                                           6.1.6        */
+/*                                                           6.1.8        */
 /*  AUTHOR                                                                */
 /*                                                                        */
 /*    Timothy Stapko, Microsoft Corporation                               */
@@ -75,6 +75,7 @@ static UINT _nx_secure_x509_crl_parse_entry(const UCHAR *buffer, ULONG length, U
 /*                                          Compare distinguished name    */
 /*    _nx_secure_x509_store_certificate_find                              */
 /*                                          Find a cert in a store        */
+/*    _nx_secure_x509_verify_cache_flush    Flush verify cache            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -90,6 +91,9 @@ static UINT _nx_secure_x509_crl_parse_entry(const UCHAR *buffer, ULONG length, U
 /*  04-02-2021     Timothy Stapko           Modified comment(s),          */
 /*                                            removed dependency on TLS,  */
 /*                                            resulting in version 6.1.6  */
+/*  10-18-2026     Timothy Stapko           Modified comment(s), flushed  */
+/*                                            verify cache on revocation, */
+/*                                            resulting in version 6.1.8  */
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_x509_crl_revocation_check(const UCHAR *crl_data, UINT crl_length,
@@ -194,6 +198,13 @@ UINT                 serial_number_length;
         if (compare_value == 0)
         {
             /* This certificate has been revoked! */
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+            /* Drop every cached verification so nothing signed by or through it is reused. */
+            if (store -> nx_secure_x509_verify_cache != NX_CRYPTO_NULL)
+            {
+                _nx_secure_x509_verify_cache_flush(store -> nx_secure_x509_verify_cache);
+            }
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
             return(NX_SECURE_X509_CRL_CERTIFICATE_REVOKED);
         }
 
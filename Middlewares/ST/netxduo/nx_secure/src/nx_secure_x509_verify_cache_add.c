@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    X.509 Digital Certificates                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_x509.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_x509_verify_cache_add                    PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function records a certificate signature that was just         */
+/*    verified against its issuer in a cache of verified X.509            */
+/*    certificate signatures, replacing a free or the least recently      */
+/*    used entry. Nothing is recorded if the cache knows the current      */
+/*    time and either certificate is outside its validity period.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Verify cache control block    */
+/*    certificate                           Certificate being verified    */
+/*    issuer_certificate                    Issuer of the certificate     */
+/*    certificate_digest                    Digest of signed data         */
+/*    link_digest                           Digest of issuer key and      */
+/*                                          signature                     */
+/*    digest_length                         Length of the digests         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_x509_expiration_check      Verify expiration of a        */
+/*                                          certificate                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_x509_certificate_verify                                  */
+/*                                          Verify a certificate          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nx_secure_x509_verify_cache_add(NX_SECURE_X509_VERIFY_CACHE *cache, NX_SECURE_X509_CERT *certificate,
+                                      NX_SECURE_X509_CERT *issuer_certificate, const UCHAR *certificate_digest,
+                                      const UCHAR *link_digest, UINT digest_length)
+{
+UINT                               i;
+NX_SECURE_X509_VERIFY_CACHE_ENTRY *entry;
+NX_SECURE_X509_VERIFY_CACHE_ENTRY *replace = NX_CRYPTO_NULL;
+
+    if ((cache -> nx_secure_x509_verify_cache_count == 0) || (certificate -> nx_secure_x509_signature_algorithm == 0))
+    {
+        return(NX_SECURE_X509_SUCCESS);
+    }
+
+    if ((cache -> nx_secure_x509_verify_cache_current_time != 0) &&
+        ((_nx_secure_x509_expiration_check(certificate, cache -> nx_secure_x509_verify_cache_current_time) != NX_SECURE_X509_SUCCESS) ||
+         (_nx_secure_x509_expiration_check(issuer_certificate, cache -> nx_secure_x509_verify_cache_current_time) != NX_SECURE_X509_SUCCESS)))
+    {
+        return(NX_SECURE_X509_SUCCESS);
+    }
+
+    if (digest_length > NX_SECURE_X509_VERIFY_CACHE_DIGEST_SIZE)
+    {
+        digest_length = NX_SECURE_X509_VERIFY_CACHE_DIGEST_SIZE;
+    }
+
+    /* Take a free entry, otherwise the least recently used one. */
+    for (i = 0; i < cache -> nx_secure_x509_verify_cache_count; i++)
+    {
+        entry = &cache -> nx_secure_x509_verify_cache_entries[i];
+
+        if (entry -> nx_secure_x509_verify_cache_entry_signature_algorithm == 0)
+        {
+            replace = entry;
+            break;
+        }
+
+        if ((replace == NX_CRYPTO_NULL) ||
+            ((ULONG)(cache -> nx_secure_x509_verify_cache_use_counter - entry -> nx_secure_x509_verify_cache_entry_last_use) >
+             (ULONG)(cache -> nx_secure_x509_verify_cache_use_counter - replace -> nx_secure_x509_verify_cache_entry_last_use)))
+        {
+            replace = entry;
+        }
+    }
+
+    NX_SECURE_MEMCPY(replace -> nx_secure_x509_verify_cache_entry_certificate, certificate_digest, digest_length); /* Use case of memcpy is verified. */
+    NX_SECURE_MEMCPY(replace -> nx_secure_x509_verify_cache_entry_link, link_digest, digest_length); /* Use case of memcpy is verified. */
+    replace -> nx_secure_x509_verify_cache_entry_signature_algorithm = (USHORT)certificate -> nx_secure_x509_signature_algorithm;
+    replace -> nx_secure_x509_verify_cache_entry_digest_length = (USHORT)digest_length;
+    replace -> nx_secure_x509_verify_cache_entry_last_use = ++cache -> nx_secure_x509_verify_cache_use_counter;
+
+    return(NX_SECURE_X509_SUCCESS);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    X.509 Digital Certificates                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_x509.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_x509_verify_cache_create                 PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes a cache of verified X.509 certificate     */
+/*    signatures in the memory supplied by the application. The cache     */
+/*    holds memory_size / sizeof(NX_SECURE_X509_VERIFY_CACHE_ENTRY)       */
+/*    entries and replaces the least recently used entry when full. Once  */
+/*    attached to a certificate store, a certificate whose signature was  */
+/*    already verified against the same issuer key skips the public-key   */
+/*    signature operation. A cache may be shared by any number of         */
+/*    certificate stores.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Verify cache control block    */
+/*    memory_ptr                            Memory for cache entries      */
+/*    memory_size                           Size of memory                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_SECURE_MEMSET                      Clear cache entries           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nx_secure_x509_verify_cache_create(NX_SECURE_X509_VERIFY_CACHE *cache, VOID *memory_ptr, ULONG memory_size)
+{
+UINT count;
+
+    count = (UINT)(memory_size / sizeof(NX_SECURE_X509_VERIFY_CACHE_ENTRY));
+
+    /* A zero signature algorithm marks the entries free. */
+    NX_SECURE_MEMSET(memory_ptr, 0, count * sizeof(NX_SECURE_X509_VERIFY_CACHE_ENTRY));
+    NX_SECURE_MEMSET(cache, 0, sizeof(NX_SECURE_X509_VERIFY_CACHE));
+
+    cache -> nx_secure_x509_verify_cache_entries = (NX_SECURE_X509_VERIFY_CACHE_ENTRY *)memory_ptr;
+    cache -> nx_secure_x509_verify_cache_count = count;
+
+    return(NX_SECURE_X509_SUCCESS);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
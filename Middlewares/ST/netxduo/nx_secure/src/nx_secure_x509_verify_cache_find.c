@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    X.509 Digital Certificates                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_x509.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_x509_verify_cache_find                   PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function looks up a certificate signature in a cache of        */
+/*    verified X.509 certificate signatures. The certificate is           */
+/*    identified by the digest of its signed data under the signature     */
+/*    hash, and the issuer by a digest of the issuer public key and the   */
+/*    signature value. An entry is only used while both certificates are  */
+/*    within their validity period if the cache knows the current time;   */
+/*    an entry for an expired certificate is removed. The hit and miss    */
+/*    counters are updated.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Verify cache control block    */
+/*    certificate                           Certificate being verified    */
+/*    issuer_certificate                    Issuer of the certificate     */
+/*    certificate_digest                    Digest of signed data         */
+/*    link_digest                           Digest of issuer key and      */
+/*                                          signature                     */
+/*    digest_length                         Length of the digests         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_x509_expiration_check      Verify expiration of a        */
+/*                                          certificate                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_x509_certificate_verify                                  */
+/*                                          Verify a certificate          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nx_secure_x509_verify_cache_find(NX_SECURE_X509_VERIFY_CACHE *cache, NX_SECURE_X509_CERT *certificate,
+                                       NX_SECURE_X509_CERT *issuer_certificate, const UCHAR *certificate_digest,
+                                       const UCHAR *link_digest, UINT digest_length)
+{
+UINT                               i;
+NX_SECURE_X509_VERIFY_CACHE_ENTRY *entry;
+
+    if (digest_length > NX_SECURE_X509_VERIFY_CACHE_DIGEST_SIZE)
+    {
+        digest_length = NX_SECURE_X509_VERIFY_CACHE_DIGEST_SIZE;
+    }
+
+    for (i = 0; i < cache -> nx_secure_x509_verify_cache_count; i++)
+    {
+        entry = &cache -> nx_secure_x509_verify_cache_entries[i];
+
+        if ((entry -> nx_secure_x509_verify_cache_entry_signature_algorithm != certificate -> nx_secure_x509_signature_algorithm) ||
+            (entry -> nx_secure_x509_verify_cache_entry_digest_length != digest_length) ||
+            (NX_SECURE_MEMCMP(entry -> nx_secure_x509_verify_cache_entry_certificate, certificate_digest, digest_length) != 0) ||
+            (NX_SECURE_MEMCMP(entry -> nx_secure_x509_verify_cache_entry_link, link_digest, digest_length) != 0))
+        {
+            continue;
+        }
+
+        /* Do not keep a verification past the validity of either certificate. */
+        if ((cache -> nx_secure_x509_verify_cache_current_time != 0) &&
+            ((_nx_secure_x509_expiration_check(certificate, cache -> nx_secure_x509_verify_cache_current_time) != NX_SECURE_X509_SUCCESS) ||
+             (_nx_secure_x509_expiration_check(issuer_certificate, cache -> nx_secure_x509_verify_cache_current_time) != NX_SECURE_X509_SUCCESS)))
+        {
+            NX_SECURE_MEMSET(entry, 0, sizeof(NX_SECURE_X509_VERIFY_CACHE_ENTRY));
+            break;
+        }
+
+        entry -> nx_secure_x509_verify_cache_entry_last_use = ++cache -> nx_secure_x509_verify_cache_use_counter;
+        cache -> nx_secure_x509_verify_cache_hits++;
+
+        return(NX_SECURE_X509_SUCCESS);
+    }
+
+    cache -> nx_secure_x509_verify_cache_misses++;
+
+    return(NX_SECURE_X509_CERTIFICATE_NOT_FOUND);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
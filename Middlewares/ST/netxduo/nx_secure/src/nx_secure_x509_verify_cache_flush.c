@@ -0,0 +1,81 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    X.509 Digital Certificates                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_x509.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_x509_verify_cache_flush                  PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes all entries from a cache of verified X.509    */
+/*    certificate signatures, so every certificate is verified again.     */
+/*    Applications should flush the cache when a certificate is removed   */
+/*    from the trusted store or otherwise no longer trusted. It is also   */
+/*    flushed when a CRL check finds a revoked certificate. The hit and   */
+/*    miss counters are preserved.                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Verify cache control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_SECURE_MEMSET                      Clear cache entries           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_x509_crl_revocation_check                                */
+/*                                          Check revocation in crl       */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nx_secure_x509_verify_cache_flush(NX_SECURE_X509_VERIFY_CACHE *cache)
+{
+
+    NX_SECURE_MEMSET(cache -> nx_secure_x509_verify_cache_entries, 0,
+                     cache -> nx_secure_x509_verify_cache_count * sizeof(NX_SECURE_X509_VERIFY_CACHE_ENTRY));
+    cache -> nx_secure_x509_verify_cache_use_counter = 0;
+
+    return(NX_SECURE_X509_SUCCESS);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    X.509 Digital Certificates                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_x509.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_x509_verify_cache_info_get               PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of entries in use and the hit and  */
+/*    miss counters of a cache of verified X.509 certificate signatures.  */
+/*    A hit is a certificate signature that did not need to be verified   */
+/*    again; a miss is a signature that was verified with the issuer      */
+/*    public key. Any output pointer may be NULL.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Verify cache control block    */
+/*    entries_used                          Number of entries in use      */
+/*    hits                                  Number of cache hits          */
+/*    misses                                Number of cache misses        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nx_secure_x509_verify_cache_info_get(NX_SECURE_X509_VERIFY_CACHE *cache, UINT *entries_used,
+                                           ULONG *hits, ULONG *misses)
+{
+UINT i;
+UINT used = 0;
+
+    for (i = 0; i < cache -> nx_secure_x509_verify_cache_count; i++)
+    {
+        if (cache -> nx_secure_x509_verify_cache_entries[i].nx_secure_x509_verify_cache_entry_signature_algorithm != 0)
+        {
+            used++;
+        }
+    }
+
+    if (entries_used != NX_CRYPTO_NULL)
+    {
+        *entries_used = used;
+    }
+
+    if (hits != NX_CRYPTO_NULL)
+    {
+        *hits = cache -> nx_secure_x509_verify_cache_hits;
+    }
+
+    if (misses != NX_CRYPTO_NULL)
+    {
+        *misses = cache -> nx_secure_x509_verify_cache_misses;
+    }
+
+    return(NX_SECURE_X509_SUCCESS);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */
@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/* Bring in externs for caller checking code.  */
+
+NX_SECURE_CALLER_CHECKING_EXTERNS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_secure_tls_session_coalesce_set                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors when configuring application data   */
+/*    coalescing for a TLS session.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    threshold                             Bytes that trigger a record   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_session_coalesce_set   Actual coalescing set call    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_secure_tls_session_coalesce_set(NX_SECURE_TLS_SESSION *tls_session, ULONG threshold)
+{
+UINT status;
+
+
+    if (tls_session == NX_NULL)
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Make sure the session is initialized. */
+    if(tls_session -> nx_secure_tls_id != NX_SECURE_TLS_ID)
+    {
+        return(NX_SECURE_TLS_SESSION_UNINITIALIZED);
+    }
+
+    /* A record cannot carry more than the maximum plaintext length. */
+    if (threshold > NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH)
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    status = _nx_secure_tls_session_coalesce_set(tls_session, threshold);
+
+    return(status);
+}
+
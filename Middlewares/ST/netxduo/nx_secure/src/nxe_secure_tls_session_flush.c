@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/* Bring in externs for caller checking code.  */
+
+NX_SECURE_CALLER_CHECKING_EXTERNS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_secure_tls_session_flush                       PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors when flushing application data      */
+/*    held back by record coalescing.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    wait_option                           Indicates behavior if TCP     */
+/*                                          socket cannot send packet     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_session_flush          Actual session flush call     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_secure_tls_session_flush(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option)
+{
+UINT status;
+
+
+    if (tls_session == NX_NULL)
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    if (tls_session -> nx_secure_tls_tcp_socket == NX_NULL)
+    {
+        return(NX_SECURE_TLS_SESSION_UNINITIALIZED);
+    }
+
+    /* Make sure the session is initialized. */
+    if(tls_session -> nx_secure_tls_id != NX_SECURE_TLS_ID)
+    {
+        return(NX_SECURE_TLS_SESSION_UNINITIALIZED);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    status = _nx_secure_tls_session_flush(tls_session, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+/* Bring in externs for caller checking code.  */
+
+NX_SECURE_CALLER_CHECKING_EXTERNS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_secure_tls_session_ticket_cache_set            PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors when setting the session ticket     */
+/*    cache of a TLS Client session.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    ticket_cache                          Ticket cache, or NX_NULL      */
+/*    server_id                             Identity of the server        */
+/*    server_id_length                      Length of server identity     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_session_ticket_cache_set                             */
+/*                                          Actual ticket cache set call  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+UINT _nxe_secure_tls_session_ticket_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_TICKET_CACHE *ticket_cache,
+                                              UCHAR *server_id, UINT server_id_length)
+{
+UINT status;
+
+
+    if (tls_session == NX_NULL)
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Make sure the session is initialized. */
+    if(tls_session -> nx_secure_tls_id != NX_SECURE_TLS_ID)
+    {
+        return(NX_SECURE_TLS_SESSION_UNINITIALIZED);
+    }
+
+    if (ticket_cache != NX_NULL)
+    {
+        if (server_id == NX_NULL)
+        {
+            return(NX_PTR_ERROR);
+        }
+
+        /* Tickets are stored under the server identity. */
+        if ((server_id_length == 0) || (server_id_length > NX_SECURE_TLS_MAX_TICKET_SERVER_ID_SIZE))
+        {
+            return(NX_INVALID_PARAMETERS);
+        }
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    status = _nx_secure_tls_session_ticket_cache_set(tls_session, ticket_cache, server_id, server_id_length);
+
+    return(status);
+}
+#endif
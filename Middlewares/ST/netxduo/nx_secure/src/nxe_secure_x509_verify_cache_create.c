@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    X.509 Digital Certificates                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_x509.h"
+
+/* Bring in externs for caller checking code.  */
+
+NX_SECURE_CALLER_CHECKING_EXTERNS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_secure_x509_verify_cache_create                PORTABLE C      */
+/*                                                           6.1.8        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    Timothy Stapko, Microsoft Corporation                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors when creating a cache of verified   */
+/*    X.509 certificate signatures.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Verify cache control block    */
+/*    memory_ptr                            Memory for cache entries      */
+/*    memory_size                           Size of memory                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_x509_verify_cache_create   Actual cache create call      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     Timothy Stapko           Initial Version 6.1.8         */
+/*                                                                        */
+/**************************************************************************/
+#ifndef NX_SECURE_X509_DISABLE_VERIFY_CACHE
+UINT _nxe_secure_x509_verify_cache_create(NX_SECURE_X509_VERIFY_CACHE *cache, VOID *memory_ptr, ULONG memory_size)
+{
+UINT status;
+
+    /* Check for pointer errors. */
+    if ((cache == NX_CRYPTO_NULL) || (memory_ptr == NX_CRYPTO_NULL))
+    {
+#ifdef NX_CRYPTO_STANDALONE_ENABLE
+        return(NX_CRYPTO_PTR_ERROR);
+#else
+        return(NX_PTR_ERROR);
+#endif /* NX_CRYPTO_STANDALONE_ENABLE */
+    }
+
+    /* The memory must hold at least one entry. */
+    if (memory_size < sizeof(NX_SECURE_X509_VERIFY_CACHE_ENTRY))
+    {
+#ifdef NX_CRYPTO_STANDALONE_ENABLE
+        return(NX_CRYPTO_SIZE_ERROR);
+#else
+        return(NX_INVALID_PARAMETERS);
+#endif /* NX_CRYPTO_STANDALONE_ENABLE */
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Make the actual call. */
+    status = _nx_secure_x509_verify_cache_create(cache, memory_ptr, memory_size);
+
+    return(status);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFY_CACHE */